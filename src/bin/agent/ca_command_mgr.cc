@@ -9,6 +9,7 @@
 #include <boost/pointer_cast.hpp>
 
 using namespace isc::data;
+using namespace isc::util::thread;
 
 namespace isc {
 namespace agent {
@@ -26,9 +27,24 @@ CtrlAgentCommandMgr::CtrlAgentCommandMgr()
 ConstElementPtr
 CtrlAgentCommandMgr::handleCommand(const std::string& cmd_name,
                                    const isc::data::ConstElementPtr& params) {
+    ConstElementPtr answer;
+    bool handled = false;
+    {
+        Mutex::Locker lock(callouts_mutex_);
+        if (hasCommandCallouts()) {
+            answer = HookedCommandMgr::handleCommand(cmd_name, params);
+            handled = true;
+        }
+    }
+
+    // Without the callouts the command is handled by the local handler,
+    // which may run concurrently with other commands.
+    if (!handled) {
+        answer = BaseCommandMgr::handleCommand(cmd_name, params);
+    }
+
     ElementPtr answer_list = Element::createList();
-    answer_list->add(boost::const_pointer_cast<
-                     Element>(HookedCommandMgr::handleCommand(cmd_name, params)));
+    answer_list->add(boost::const_pointer_cast<Element>(answer));
     return (answer_list);
 }
 
@@ -8,6 +8,7 @@
 #define CTRL_AGENT_COMMAND_MGR_H
 
 #include <config/hooked_command_mgr.h>
+#include <util/threads/sync.h>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 
@@ -27,6 +28,13 @@ namespace agent {
 /// are registered using @c CtrlAgentCommandMgr::instance().registerCommand().
 /// The @ref CtrlAgentResponseCreator uses the sole instance of the Command
 /// Manager to handle incoming commands.
+///
+/// The HTTP requests may be received and the commands handled by many
+/// threads. The callouts of the hook libraries share the callout handle
+/// and are not required to be thread safe, so the commands passed to them
+/// are handled one at a time. The mutex serializing them is also held
+/// while the Control Agent applies the new configuration, which may load
+/// other hook libraries. The remaining commands are handled concurrently.
 class CtrlAgentCommandMgr : public config::HookedCommandMgr,
                             public boost::noncopyable {
 public:
@@ -52,6 +60,11 @@ public:
     handleCommand(const std::string& cmd_name,
                   const isc::data::ConstElementPtr& params);
 
+    /// @brief Returns the mutex serializing the hook callouts.
+    util::thread::Mutex& getCalloutsMutex() {
+        return (callouts_mutex_);
+    }
+
 private:
     /// @brief Private constructor.
     ///
@@ -59,6 +72,8 @@ private:
     /// thus the constructor is private.
     CtrlAgentCommandMgr();
 
+    /// @brief Mutex serializing the hook callouts.
+    util::thread::Mutex callouts_mutex_;
 };
 
 } // end of namespace isc::agent
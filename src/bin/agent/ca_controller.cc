@@ -9,9 +9,17 @@
 #include <agent/ca_controller.h>
 #include <agent/ca_process.h>
 #include <agent/parser_context.h>
+#include <boost/lexical_cast.hpp>
 
 using namespace isc::process;
 
+namespace {
+
+/// @brief Maximum number of threads handling HTTP requests.
+const unsigned int MAX_THREAD_COUNT = 256;
+
+}
+
 namespace isc {
 namespace agent {
 
@@ -38,7 +46,41 @@ DProcessBase*
 CtrlAgentController::createProcess() {
     // Instantiate and return an instance of the D2 application process. Note
     // that the process is passed the controller's io_service.
-    return (new CtrlAgentProcess(getAppName().c_str(), getIOService()));
+    CtrlAgentProcess* process = new CtrlAgentProcess(getAppName().c_str(),
+                                                     getIOService());
+    process->setThreadCount(thread_count_);
+    return (process);
+}
+
+bool
+CtrlAgentController::customOption(int option, char* optarg) {
+    if (option != 'T') {
+        return (false);
+    }
+
+    unsigned int thread_count = 0;
+    try {
+        thread_count = boost::lexical_cast<unsigned int>(optarg);
+    } catch (const boost::bad_lexical_cast&) {
+        // Reported below.
+    }
+    if ((thread_count == 0) || (thread_count > MAX_THREAD_COUNT)) {
+        isc_throw(InvalidUsage, "number of threads must be between 1 and "
+                  << MAX_THREAD_COUNT << ": " << optarg);
+    }
+    thread_count_ = thread_count;
+    return (true);
+}
+
+const std::string
+CtrlAgentController::getCustomOpts() const {
+    return ("T:");
+}
+
+const std::string
+CtrlAgentController::getUsageText() const {
+    return ("  -T <threads> : optional, number of threads handling HTTP"
+            " requests (default 1)");
 }
 
 isc::data::ConstElementPtr
@@ -48,7 +90,7 @@ CtrlAgentController::parseFile(const std::string& name) {
 }
 
 CtrlAgentController::CtrlAgentController()
-    : DControllerBase(agent_app_name_, agent_bin_name_) {
+    : DControllerBase(agent_app_name_, agent_bin_name_), thread_count_(1) {
 }
 
 CtrlAgentController::~CtrlAgentController() {
@@ -47,6 +47,31 @@ public:
     isc::data::ConstElementPtr
     parseFile(const std::string& name);
 
+    /// @brief Returns the number of threads handling HTTP requests.
+    size_t getThreadCount() const {
+        return (thread_count_);
+    }
+
+protected:
+
+    /// @brief Handles the Control Agent specific command line options.
+    ///
+    /// The -T option specifies the number of threads handling HTTP requests.
+    ///
+    /// @param option Option character.
+    /// @param optarg Option argument.
+    ///
+    /// @return true if the option is supported.
+    /// @throw InvalidUsage if the number of threads is invalid.
+    virtual bool customOption(int option, char* optarg);
+
+    /// @brief Returns the Control Agent specific command line options.
+    virtual const std::string getCustomOpts() const;
+
+    /// @brief Returns the usage text of the Control Agent specific command
+    /// line options.
+    virtual const std::string getUsageText() const;
+
 private:
 
     /// @brief Creates an instance of the Control Agent application
@@ -65,6 +90,8 @@ private:
     /// the singleton instance.
     CtrlAgentController();
 
+    /// @brief Number of threads handling HTTP requests.
+    size_t thread_count_;
 };
 
 } // namespace isc::agent
@@ -5,6 +5,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <agent/ca_command_mgr.h>
 #include <agent/ca_process.h>
 #include <agent/ca_response_creator_factory.h>
 #include <agent/ca_log.h>
@@ -24,6 +25,9 @@ namespace {
 
 const long REQUEST_TIMEOUT = 10000;
 
+/// @brief Timeout after which the idle persistent connection is closed (ms).
+const long IDLE_TIMEOUT = 30000;
+
 }
 
 namespace isc {
@@ -31,7 +35,8 @@ namespace agent {
 
 CtrlAgentProcess::CtrlAgentProcess(const char* name,
                                    const asiolink::IOServicePtr& io_service)
-    : DProcessBase(name, io_service, DCfgMgrBasePtr(new CtrlAgentCfgMgr())) {
+    : DProcessBase(name, io_service, DCfgMgrBasePtr(new CtrlAgentCfgMgr())),
+      thread_count_(1) {
 }
 
 CtrlAgentProcess::~CtrlAgentProcess() {
@@ -72,7 +77,8 @@ CtrlAgentProcess::run() {
         // Create http listener. It will open up a TCP socket and be prepared
         // to accept incoming connection.
         HttpListener http_listener(*getIoService(), server_address,
-                                   server_port, rcf, REQUEST_TIMEOUT);
+                                   server_port, rcf, REQUEST_TIMEOUT,
+                                   IDLE_TIMEOUT);
 
         // Instruct the http listener to actually open socket, install callback
         // and start listening.
@@ -82,10 +88,33 @@ CtrlAgentProcess::run() {
         LOG_INFO(agent_logger, CTRL_AGENT_HTTP_SERVICE_STARTED)
             .arg(server_address.toText()).arg(server_port);
 
-        // Let's process incoming data or expiring timers in a loop until
-        // shutdown condition is detected.
-        while (!shouldShutdown()) {
-            getIoService()->run_one();
+        if (thread_count_ > 1) {
+            // All handlers are run by the threads and this thread waits
+            // for the shutdown. The listener must not be destroyed while
+            // the threads may be running its handlers, so the threads are
+            // stopped in this scope. Stopping them waits for the handler
+            // which requested the shutdown, so as its response is sent.
+            getIoService()->startThreads(thread_count_);
+            LOG_INFO(agent_logger, CTRL_AGENT_HTTP_SERVICE_THREADS)
+                .arg(thread_count_);
+            try {
+                waitForShutdown();
+            } catch (...) {
+                try {
+                    getIoService()->stopThreads();
+                } catch (...) {
+                    // Ignore double errors
+                }
+                throw;
+            }
+            getIoService()->stopThreads();
+
+        } else {
+            // Let's process incoming data or expiring timers in a loop until
+            // shutdown condition is detected.
+            while (!shouldShutdown()) {
+                getIoService()->run_one();
+            }
         }
         stopIOService();
     } catch (const std::exception& ex) {
@@ -104,6 +133,8 @@ CtrlAgentProcess::run() {
 
 isc::data::ConstElementPtr
 CtrlAgentProcess::shutdown(isc::data::ConstElementPtr /*args*/) {
+    // The IO service is stopped by the event loop after this handler has
+    // returned, so as the response to the command is sent first.
     setShutdownFlag(true);
     return (isc::config::createAnswer(0, "Control Agent is shutting down"));
 }
@@ -111,6 +142,9 @@ CtrlAgentProcess::shutdown(isc::data::ConstElementPtr /*args*/) {
 isc::data::ConstElementPtr
 CtrlAgentProcess::configure(isc::data::ConstElementPtr config_set,
                             bool check_only) {
+    // The hook libraries must not be reloaded while their callouts run.
+    util::thread::Mutex::Locker
+        lock(CtrlAgentCommandMgr::instance().getCalloutsMutex());
     int rcode = 0;
     isc::data::ConstElementPtr answer = getCfgMgr()->simpleParseConfig(config_set,
                                                                        check_only);
@@ -131,5 +165,14 @@ CtrlAgentProcess::getCtrlAgentCfgMgr() {
     return(boost::dynamic_pointer_cast<CtrlAgentCfgMgr>(getCfgMgr()));
 }
 
+void
+CtrlAgentProcess::setThreadCount(const size_t thread_count) {
+    if (thread_count == 0) {
+        isc_throw(BadValue, "number of threads handling HTTP requests"
+                  " must be greater than 0");
+    }
+    thread_count_ = thread_count;
+}
+
 } // namespace isc::agent
 } // namespace isc
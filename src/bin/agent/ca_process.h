@@ -51,6 +51,10 @@ public:
 
     /// @brief Implements the process's event loop.
     ///
+    /// If the number of threads is greater than 1, the threads are started
+    /// to run the IO service and the calling thread waits for the shutdown.
+    /// They are stopped before this method returns.
+    ///
     /// @throw DProcessBaseError if an operational error is encountered.
     virtual void run();
 
@@ -58,6 +62,9 @@ public:
     ///
     /// This is last step in the shutdown event callback chain, that is
     /// intended to notify the process it is to begin its shutdown process.
+    /// It only sets the shutdown flag, which may be requested by any of the
+    /// threads running the IO service. The event loop stops the IO service
+    /// after this handler has returned.
     ///
     /// @param args an Element set of shutdown arguments (if any) that are
     /// supported by the process derivation.
@@ -108,6 +115,23 @@ public:
 
     /// @brief Returns a pointer to the configuration manager.
     CtrlAgentCfgMgrPtr getCtrlAgentCfgMgr();
+
+    /// @brief Sets the number of threads handling HTTP requests.
+    ///
+    /// @param thread_count Number of threads. If it is 1, the handlers are
+    /// run by the thread calling @ref run.
+    /// @throw BadValue if the number of threads is 0.
+    void setThreadCount(const size_t thread_count);
+
+    /// @brief Returns the number of threads handling HTTP requests.
+    size_t getThreadCount() const {
+        return (thread_count_);
+    }
+
+private:
+
+    /// @brief Number of threads handling HTTP requests.
+    size_t thread_count_;
 };
 
 /// @brief Defines a shared pointer to CtrlAgentProcess.
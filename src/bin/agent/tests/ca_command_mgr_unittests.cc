@@ -7,13 +7,25 @@
 #include <config.h>
 #include <agent/ca_command_mgr.h>
 #include <cc/command_interpreter.h>
+#include <util/threads/thread.h>
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
 #include <gtest/gtest.h>
+#include <vector>
 
 using namespace isc::agent;
 using namespace isc::data;
 
 namespace {
 
+/// @brief Handler of the command registered by the tests.
+ConstElementPtr
+testCommandHandler(const std::string& /*name*/,
+                   const ConstElementPtr& /*params*/) {
+    return (isc::config::createAnswer(isc::config::CONTROL_RESULT_SUCCESS,
+                                      "ok"));
+}
+
 /// @brief Test fixture class for @ref CtrlAgentCommandMgr.
 ///
 /// @todo Add tests for various commands, including the cases when the
@@ -58,6 +70,18 @@ public:
         }
     }
 
+    /// @brief Handles 'list-commands' many times.
+    ///
+    /// This is run by the threads checking the concurrent handling of
+    /// the commands.
+    void listCommandsManyTimes() {
+        for (int i = 0; i < 100; ++i) {
+            ConstElementPtr answer = mgr_.handleCommand("list-commands",
+                                                        ConstElementPtr());
+            checkAnswer(answer, isc::config::CONTROL_RESULT_SUCCESS);
+        }
+    }
+
     /// @brief a convenience reference to control agent command manager
     CtrlAgentCommandMgr& mgr_;
 };
@@ -79,5 +103,25 @@ TEST_F(CtrlAgentCommandMgrTest, listCommands) {
     checkAnswer(answer, isc::config::CONTROL_RESULT_SUCCESS);
 };
 
+/// Checks that the commands can be handled by many threads at the same
+/// time while other commands are registered.
+TEST_F(CtrlAgentCommandMgrTest, concurrentCommands) {
+    typedef boost::shared_ptr<isc::util::thread::Thread> ThreadPtr;
+    std::vector<ThreadPtr> threads;
+    for (int i = 0; i < 4; ++i) {
+        threads.push_back(ThreadPtr(new isc::util::thread::Thread(
+            boost::bind(&CtrlAgentCommandMgrTest::listCommandsManyTimes,
+                        this))));
+    }
+
+    for (int i = 0; i < 100; ++i) {
+        mgr_.registerCommand("test-command", testCommandHandler);
+        mgr_.deregisterCommand("test-command");
+    }
+
+    for (auto thread = threads.begin(); thread != threads.end(); ++thread) {
+        EXPECT_NO_THROW((*thread)->wait());
+    }
+}
 
 }
@@ -35,6 +35,36 @@ public:
         : DControllerTest(CtrlAgentController::instance) {
     }
 
+    /// @brief Runs the Control Agent with many threads.
+    ///
+    /// This is the counterpart of @c runWithConfig which specifies the
+    /// number of threads handling HTTP requests on the command line.
+    ///
+    /// @param config configuration file content to write before calling
+    /// launch.
+    /// @param run_time_ms maximum amount of time to allow runProcess() to
+    /// continue.
+    /// @param thread_count number of threads, as text.
+    /// @param[out] elapsed_time the actual time in ms spent in launch().
+    void runWithThreads(const std::string& config, int run_time_ms,
+                        const char* thread_count,
+                        time_duration& elapsed_time) {
+        writeFile(config);
+
+        // Shutdown (without error) after runtime.
+        isc::asiolink::IntervalTimer timer(*getIOService());
+        timer.setup(genShutdownCallback, run_time_ms);
+
+        ptime start = microsec_clock::universal_time();
+        char* argv[] = { const_cast<char*>("progName"),
+                         const_cast<char*>("-c"),
+                         const_cast<char*>(DControllerTest::CFG_TEST_FILE),
+                         const_cast<char*>("-d"),
+                         const_cast<char*>("-T"),
+                         const_cast<char*>(thread_count) };
+        launch(6, argv);
+        elapsed_time = microsec_clock::universal_time() - start;
+    }
 };
 
 // Basic Controller instantiation testing.
@@ -91,6 +121,38 @@ TEST_F(CtrlAgentControllerTest, commandLineArgs) {
     EXPECT_THROW(parseArgs(argc, argv2), InvalidUsage);
 }
 
+// Tests that the number of threads handling HTTP requests can be specified
+// on the command line.
+TEST_F(CtrlAgentControllerTest, threadCountArg) {
+    boost::shared_ptr<CtrlAgentController> controller =
+        boost::dynamic_pointer_cast<CtrlAgentController>(getController());
+    ASSERT_TRUE(controller);
+    EXPECT_EQ(1, controller->getThreadCount());
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>(DControllerTest::CFG_TEST_FILE),
+                     const_cast<char*>("-T"),
+                     const_cast<char*>("4") };
+    EXPECT_NO_THROW(parseArgs(5, argv));
+    EXPECT_EQ(4, controller->getThreadCount());
+
+    // The number of threads is passed to the process.
+    ASSERT_NO_THROW(initProcess());
+    CtrlAgentProcessPtr process =
+        boost::dynamic_pointer_cast<CtrlAgentProcess>(getProcess());
+    ASSERT_TRUE(process);
+    EXPECT_EQ(4, process->getThreadCount());
+
+    // Invalid numbers of threads are rejected.
+    argv[4] = const_cast<char*>("0");
+    EXPECT_THROW(parseArgs(5, argv), InvalidUsage);
+    argv[4] = const_cast<char*>("many");
+    EXPECT_THROW(parseArgs(5, argv), InvalidUsage);
+    argv[4] = const_cast<char*>("100000");
+    EXPECT_THROW(parseArgs(5, argv), InvalidUsage);
+}
+
 // Tests application process creation and initialization.
 // Verifies that the process can be successfully created and initialized.
 TEST_F(CtrlAgentControllerTest, initProcessTesting) {
@@ -142,4 +204,32 @@ TEST_F(CtrlAgentControllerTest, sigtermShutdown) {
     EXPECT_TRUE(elapsed_time.total_milliseconds() < 300);
 }
 
+// Tests launch and normal shutdown when the HTTP requests are handled
+// by many threads. The shutdown is requested by one of them.
+TEST_F(CtrlAgentControllerTest, launchNormalShutdownMultipleThreads) {
+    time_duration elapsed_time;
+    ASSERT_NO_THROW(runWithThreads(valid_agent_config, 1000, "4",
+                                   elapsed_time));
+
+    // The threads have been stopped.
+    EXPECT_EQ(0, getIOService()->getThreadCount());
+
+    EXPECT_TRUE(elapsed_time.total_milliseconds() >= 800 &&
+                elapsed_time.total_milliseconds() <= 1300);
+}
+
+// Tests that the SIGTERM triggers a normal shutdown when the HTTP requests
+// are handled by many threads.
+TEST_F(CtrlAgentControllerTest, sigtermShutdownMultipleThreads) {
+    // Setup to raise SIGTERM in 1 ms.
+    TimedSignal sigterm(*getIOService(), SIGTERM, 1);
+
+    time_duration elapsed_time;
+    ASSERT_NO_THROW(runWithThreads(valid_agent_config, 1000, "4",
+                                   elapsed_time));
+
+    EXPECT_EQ(0, getIOService()->getThreadCount());
+    EXPECT_TRUE(elapsed_time.total_milliseconds() < 300);
+}
+
 }
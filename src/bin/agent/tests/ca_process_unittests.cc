@@ -13,6 +13,7 @@
 #include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <gtest/gtest.h>
+#include <unistd.h>
 
 using namespace boost::posix_time;
 using namespace isc;
@@ -28,7 +29,8 @@ public:
     /// @brief Constructor
     CtrlAgentProcessTest() :
         CtrlAgentProcess("agent-test",
-                         IOServicePtr(new isc::asiolink::IOService())) {
+                         IOServicePtr(new isc::asiolink::IOService())),
+        replied_(false) {
         CtrlAgentCfgContextPtr ctx = getCtrlAgentCfgMgr()->getCtrlAgentCfgContext();
         ctx->setHttpHost("127.0.0.1");
         ctx->setHttpPort(8081);
@@ -42,6 +44,18 @@ public:
     void genShutdownCallback() {
         shutdown(isc::data::ConstElementPtr());
     }
+
+    /// @brief Callback that invokes shutdown and then takes some time
+    /// to send the response.
+    void genShutdownAndReplyCallback() {
+        shutdown(isc::data::ConstElementPtr());
+        usleep(100000);
+        replied_ = true;
+    }
+
+    /// @brief Indicates if the handler requesting the shutdown has
+    /// completed.
+    bool replied_;
 };
 
 // Test construction of the CtrlAgentProcess object.
@@ -86,5 +100,43 @@ TEST_F(CtrlAgentProcessTest, shutdown) {
                 elapsed.total_milliseconds() <= 2200);
 }
 
+// Verifies that the shutdown causes the run method to exit gracefully when
+// the IO service is run by many threads.
+TEST_F(CtrlAgentProcessTest, shutdownMultipleThreads) {
+    EXPECT_EQ(1, getThreadCount());
+    EXPECT_THROW(setThreadCount(0), BadValue);
+    ASSERT_NO_THROW(setThreadCount(4));
+    EXPECT_EQ(4, getThreadCount());
+
+    // The shutdown is invoked by one of the threads running the IO service.
+    IntervalTimer timer(*getIoService());
+    timer.setup(boost::bind(&CtrlAgentProcessTest::genShutdownCallback, this),
+                1000);
+
+    ptime start = microsec_clock::universal_time();
+    EXPECT_NO_THROW(run());
+    ptime stop = microsec_clock::universal_time();
+
+    // The threads have been stopped.
+    EXPECT_EQ(0, getIoService()->getThreadCount());
+
+    time_duration elapsed = stop - start;
+    EXPECT_TRUE(elapsed.total_milliseconds() >= 900 &&
+                elapsed.total_milliseconds() <= 1200);
+}
+
+// Verifies that the handler which requested the shutdown completes, so
+// as its response is sent, before the threads are stopped.
+TEST_F(CtrlAgentProcessTest, shutdownSendsResponse) {
+    ASSERT_NO_THROW(setThreadCount(4));
+
+    IntervalTimer timer(*getIoService());
+    timer.setup(boost::bind(&CtrlAgentProcessTest::genShutdownAndReplyCallback,
+                            this), 100);
+
+    EXPECT_NO_THROW(run());
+    EXPECT_TRUE(replied_);
+    EXPECT_EQ(0, getIoService()->getThreadCount());
+}
 
 }
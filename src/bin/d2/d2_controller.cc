@@ -11,10 +11,19 @@
 #include <d2/parser_context.h>
 #include <process/spec_config.h>
 
+#include <boost/lexical_cast.hpp>
+
 #include <stdlib.h>
 
 using namespace isc::process;
 
+namespace {
+
+/// @brief Maximum number of threads running the DNS update transactions.
+const unsigned int MAX_THREAD_COUNT = 256;
+
+}
+
 namespace isc {
 namespace d2 {
 
@@ -40,11 +49,44 @@ D2Controller::instance() {
 DProcessBase* D2Controller::createProcess() {
     // Instantiate and return an instance of the D2 application process. Note
     // that the process is passed the controller's io_service.
-    return (new D2Process(getAppName().c_str(), getIOService()));
+    D2Process* process = new D2Process(getAppName().c_str(), getIOService());
+    process->setThreadCount(thread_count_);
+    return (process);
+}
+
+bool
+D2Controller::customOption(int option, char* optarg) {
+    if (option != 'T') {
+        return (false);
+    }
+
+    unsigned int thread_count = 0;
+    try {
+        thread_count = boost::lexical_cast<unsigned int>(optarg);
+    } catch (const boost::bad_lexical_cast&) {
+        // Reported below.
+    }
+    if ((thread_count == 0) || (thread_count > MAX_THREAD_COUNT)) {
+        isc_throw(InvalidUsage, "number of threads must be between 1 and "
+                  << MAX_THREAD_COUNT << ": " << optarg);
+    }
+    thread_count_ = thread_count;
+    return (true);
+}
+
+const std::string
+D2Controller::getCustomOpts() const {
+    return ("T:");
+}
+
+const std::string
+D2Controller::getUsageText() const {
+    return ("  -T <threads> : optional, number of threads running DNS update"
+            " transactions (default 1)");
 }
 
 D2Controller::D2Controller()
-    : DControllerBase(d2_app_name_, d2_bin_name_) {
+    : DControllerBase(d2_app_name_, d2_bin_name_), thread_count_(1) {
     // set the spec file either from the environment or
     // use the production value.
     if (getenv("KEA_FROM_BUILD")) {
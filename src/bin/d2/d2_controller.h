@@ -42,6 +42,32 @@ public:
     /// by convention this should match the executable name.
     static const char* d2_bin_name_;
 
+    /// @brief Returns the number of threads running the DNS update
+    /// transactions.
+    size_t getThreadCount() const {
+        return (thread_count_);
+    }
+
+protected:
+    /// @brief Handles the DHCP-DDNS specific command line options.
+    ///
+    /// The -T option specifies the number of threads running the DNS
+    /// update transactions.
+    ///
+    /// @param option Option character.
+    /// @param optarg Option argument.
+    ///
+    /// @return true if the option is supported.
+    /// @throw InvalidUsage if the number of threads is invalid.
+    virtual bool customOption(int option, char* optarg);
+
+    /// @brief Returns the DHCP-DDNS specific command line options.
+    virtual const std::string getCustomOpts() const;
+
+    /// @brief Returns the usage text of the DHCP-DDNS specific command
+    /// line options.
+    virtual const std::string getUsageText() const;
+
 private:
     /// @brief Creates an instance of the DHCP-DDNS specific application
     /// process.  This method is invoked during the process initialization
@@ -67,6 +93,9 @@ private:
     /// @brief Constructor is declared private to maintain the integrity of
     /// the singleton instance.
     D2Controller();
+
+    /// @brief Number of threads running the DNS update transactions.
+    size_t thread_count_;
 };
 
 }; // namespace isc::d2
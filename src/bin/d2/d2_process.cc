@@ -22,7 +22,7 @@ const unsigned int D2Process::QUEUE_RESTART_PERCENT =  80;
 
 D2Process::D2Process(const char* name, const asiolink::IOServicePtr& io_service)
     : DProcessBase(name, io_service, DCfgMgrBasePtr(new D2CfgMgr())),
-     reconf_queue_flag_(false), shutdown_type_(SD_NORMAL) {
+     reconf_queue_flag_(false), shutdown_type_(SD_NORMAL), thread_count_(1) {
 
     // Instantiate queue manager.  Note that queue manager does not start
     // listening at this point.  That can only occur after configuration has
@@ -45,6 +45,18 @@ D2Process::init() {
 void
 D2Process::run() {
     LOG_INFO(d2_logger, DHCP_DDNS_STARTED).arg(VERSION);
+
+    // The transactions are run by a pool of threads, each of them in its
+    // own strand. The requests are still received and queued by this thread.
+    if (thread_count_ > 1) {
+        if (!update_mgr_->getTransactionIOService()) {
+            asiolink::IOServicePtr io_service(new asiolink::IOService());
+            update_mgr_->setTransactionIOService(io_service);
+        }
+        update_mgr_->getTransactionIOService()->startThreads(thread_count_);
+        LOG_INFO(d2_logger, DHCP_DDNS_TRANSACTION_THREADS).arg(thread_count_);
+    }
+
     // Loop forever until we are allowed to shutdown.
     while (!canShutdown()) {
         try {
@@ -71,11 +83,14 @@ D2Process::run() {
             }
         } catch (const std::exception& ex) {
             LOG_FATAL(d2_logger, DHCP_DDNS_FAILED).arg(ex.what());
+            stopTransactionThreads();
             isc_throw (DProcessBaseError,
                        "Process run method failed: " << ex.what());
         }
     }
 
+    stopTransactionThreads();
+
     // @todo - if queue isn't empty, we may need to persist its contents
     // this might be the place to do it, once there is a persistence mgr.
     // This may also be better in checkQueueStatus.
@@ -84,6 +99,24 @@ D2Process::run() {
 
 };
 
+void
+D2Process::stopTransactionThreads() {
+    const asiolink::IOServicePtr& io_service =
+        update_mgr_->getTransactionIOService();
+    if (io_service) {
+        io_service->stopThreads();
+    }
+}
+
+void
+D2Process::setThreadCount(const size_t thread_count) {
+    if (thread_count == 0) {
+        isc_throw(BadValue, "number of threads running the DNS update"
+                  " transactions must be greater than 0");
+    }
+    thread_count_ = thread_count;
+}
+
 size_t
 D2Process::runIO() {
     // We want to block until at least one handler is called.  We'll use
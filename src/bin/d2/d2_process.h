@@ -104,6 +104,11 @@ public:
     /// This includes exceptions generated but not caught by IO callbacks.
     /// Services which rely on callbacks are expected to be well behaved and
     /// any errors they encounter handled internally.
+    ///
+    /// If the number of threads is greater than 1, the DNS update
+    /// transactions are run by a pool of threads started by this method,
+    /// each transaction in its own strand. The event loop itself remains
+    /// single threaded. The threads are stopped before this method returns.
     virtual void run();
 
     /// @brief Initiates the D2Process shutdown process.
@@ -218,6 +223,11 @@ protected:
     /// This method is exception safe.
     virtual void reconfigureQueueMgr();
 
+    /// @brief Stops the threads running the DNS update transactions.
+    ///
+    /// It has no effect if the transactions are run by the event loop.
+    void stopTransactionThreads();
+
     /// @brief Allows IO processing to run until at least callback is invoked.
     ///
     /// This method is called from within the D2Process main event loop and is
@@ -295,6 +305,19 @@ public:
         return (shutdown_type_);
     }
 
+    /// @brief Sets the number of threads running the DNS update transactions.
+    ///
+    /// @param thread_count Number of threads. If it is 1, the transactions
+    /// are run by the thread calling @ref run.
+    /// @throw BadValue if the number of threads is 0.
+    void setThreadCount(const size_t thread_count);
+
+    /// @brief Returns the number of threads running the DNS update
+    /// transactions.
+    size_t getThreadCount() const {
+        return (thread_count_);
+    }
+
     /// @brief Returns a text label for the given shutdown type.
     ///
     /// @param type the numerical shutdown type for which the label is desired.
@@ -315,6 +338,9 @@ private:
 
     /// @brief Indicates the type of shutdown requested.
     ShutdownType shutdown_type_;
+
+    /// @brief Number of threads running the DNS update transactions.
+    size_t thread_count_;
 };
 
 /// @brief Defines a shared pointer to D2Process.
@@ -10,10 +10,25 @@
 #include <d2/nc_add.h>
 #include <d2/nc_remove.h>
 
+#include <boost/bind.hpp>
+
 #include <sstream>
 #include <iostream>
 #include <vector>
 
+namespace {
+
+/// @brief Does nothing.
+///
+/// It is posted to the primary IOService when a transaction run by
+/// another thread has finished, so as the upper layer's event loop
+/// wakes up and sweeps the transaction.
+void
+transactionFinished() {
+}
+
+}
+
 namespace isc {
 namespace d2 {
 
@@ -22,7 +37,8 @@ const size_t D2UpdateMgr::MAX_TRANSACTIONS_DEFAULT;
 D2UpdateMgr::D2UpdateMgr(D2QueueMgrPtr& queue_mgr, D2CfgMgrPtr& cfg_mgr,
                          asiolink::IOServicePtr& io_service,
                          const size_t max_transactions)
-    :queue_mgr_(queue_mgr), cfg_mgr_(cfg_mgr), io_service_(io_service) {
+    :queue_mgr_(queue_mgr), cfg_mgr_(cfg_mgr), io_service_(io_service),
+     transaction_io_service_() {
     if (!queue_mgr_) {
         isc_throw(D2UpdateMgrError, "D2UpdateMgr queue manager cannot be null");
     }
@@ -81,7 +97,7 @@ D2UpdateMgr::checkFinishedTransactions() {
     TransactionList::iterator it = transaction_list_.begin();
     while (it != transaction_list_.end()) {
         NameChangeTransactionPtr trans = (*it).second;
-        if (trans->isModelDone()) {
+        if (trans->isFinished()) {
             // @todo  Addtional actions based on NCR status could be
             // performed here.
             transaction_list_.erase(it++);
@@ -190,21 +206,31 @@ D2UpdateMgr::makeTransaction(dhcp_ddns::NameChangeRequestPtr& next_ncr) {
     }
 
     // We matched to the required servers, so construct the transaction.
-    // @todo If multi-threading is implemented, one would pass in an
-    // empty IOServicePtr, rather than our instance value.  This would cause
-    // the transaction to instantiate its own, separate IOService to handle
-    // the transaction's IO.
+    // If the transactions are run by a pool of threads, each of them gets
+    // its own strand.
+    asiolink::IOServicePtr trans_io_service = (transaction_io_service_ ?
+                                               transaction_io_service_ :
+                                               io_service_);
     NameChangeTransactionPtr trans;
     if (next_ncr->getChangeType() == dhcp_ddns::CHG_ADD) {
-        trans.reset(new NameAddTransaction(io_service_, next_ncr,
+        trans.reset(new NameAddTransaction(trans_io_service, next_ncr,
                                            forward_domain, reverse_domain,
                                            cfg_mgr_));
     } else {
-        trans.reset(new NameRemoveTransaction(io_service_, next_ncr,
+        trans.reset(new NameRemoveTransaction(trans_io_service, next_ncr,
                                               forward_domain, reverse_domain,
                                               cfg_mgr_));
     }
 
+    if (transaction_io_service_) {
+        asiolink::IOStrandPtr strand(new asiolink::IOStrand(
+                                         *transaction_io_service_));
+        trans->setStrand(strand,
+                         boost::bind(&asiolink::IOService::post, io_service_,
+                                     boost::function<void()>(
+                                         &transactionFinished)));
+    }
+
     // Add the new transaction to the list.
     transaction_list_[key] = trans;
 
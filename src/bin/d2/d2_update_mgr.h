@@ -118,7 +118,7 @@ protected:
     /// @brief Performs post-completion cleanup on completed transactions.
     ///
     /// Iterates through the list of transactions and removes any that have
-    /// reached completion.  This method may expand in complexity or even
+    /// finished.  This method may expand in complexity or even
     /// disappear altogether as the implementation matures.
     void checkFinishedTransactions();
 
@@ -169,6 +169,28 @@ public:
         return (io_service_);
     }
 
+    /// @brief Sets the IOService running the transactions.
+    ///
+    /// If it is set, the new transactions use this IOService, which is
+    /// expected to be run by a pool of threads, and each of them is run
+    /// in its own strand. When a transaction has finished, a handler is
+    /// posted to the primary IOService, so the upper layer calls
+    /// @ref sweep to remove it. Otherwise, the transactions use the
+    /// primary IOService.
+    ///
+    /// @param io_service IOService running the transactions or null.
+    void setTransactionIOService(const asiolink::IOServicePtr& io_service) {
+        transaction_io_service_ = io_service;
+    }
+
+    /// @brief Gets the IOService running the transactions.
+    ///
+    /// @return returns a reference to the IOService or null if the
+    /// transactions use the primary IOService.
+    const asiolink::IOServicePtr& getTransactionIOService() const {
+        return (transaction_io_service_);
+    }
+
     /// @brief Returns the maximum number of concurrent transactions.
     size_t getMaxTransactions() const {
         return (max_transactions_);
@@ -235,11 +257,15 @@ private:
     /// @brief Primary IOService instance.
     /// This is the IOService that the upper layer(s) use for IO events, such
     /// as shutdown and configuration commands.  It is the IOService that is
-    /// passed into transactions to manager their IO events.
-    /// (For future reference, multi-threaded transactions would each use their
-    /// own IOService instance.)
+    /// passed into transactions to manager their IO events, unless the
+    /// transactions are run by a pool of threads.
     asiolink::IOServicePtr io_service_;
 
+    /// @brief IOService run by a pool of threads for the transactions.
+    ///
+    /// It is null if the transactions use the primary IOService.
+    asiolink::IOServicePtr transaction_io_service_;
+
     /// @brief Maximum number of concurrent transactions.
     size_t max_transactions_;
 
@@ -74,7 +74,8 @@ public:
                   const uint16_t ns_port,
                   D2UpdateMessage& update,
                   const unsigned int wait,
-                  const dns::TSIGKeyPtr& tsig_key);
+                  const dns::TSIGKeyPtr& tsig_key,
+                  const asiolink::IOStrandPtr& strand);
 
     // This function maps the IO error to the DNSClient error.
     DNSClient::Status getStatus(const asiodns::IOFetch::Result);
@@ -180,7 +181,8 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
                         const uint16_t ns_port,
                         D2UpdateMessage& update,
                         const unsigned int wait,
-                        const dns::TSIGKeyPtr& tsig_key) {
+                        const dns::TSIGKeyPtr& tsig_key,
+                        const asiolink::IOStrandPtr& strand) {
     // The underlying implementation which we use to send DNS Updates uses
     // signed integers for timeout. If we want to avoid overflows we need to
     // respect this limitation here.
@@ -225,8 +227,14 @@ DNSClientImpl::doUpdate(asiolink::IOService& io_service,
                      in_buf_, this, static_cast<int>(wait));
 
     // Post the task to the task queue in the IO service. Caller will actually
-    // run these tasks by executing IOService::run.
-    io_service.post(io_fetch);
+    // run these tasks by executing IOService::run. When the IO service is
+    // run by many threads, the exchange is run in the caller's strand.
+    if (strand) {
+        io_fetch.setStrand(strand);
+        strand->post(io_fetch);
+    } else {
+        io_service.post(io_fetch);
+    }
 }
 
 DNSClient::DNSClient(D2UpdateMessagePtr& response_placeholder,
@@ -250,8 +258,10 @@ DNSClient::doUpdate(asiolink::IOService& io_service,
                     const uint16_t ns_port,
                     D2UpdateMessage& update,
                     const unsigned int wait,
-                    const dns::TSIGKeyPtr& tsig_key) {
-    impl_->doUpdate(io_service, ns_addr, ns_port, update, wait, tsig_key);
+                    const dns::TSIGKeyPtr& tsig_key,
+                    const asiolink::IOStrandPtr& strand) {
+    impl_->doUpdate(io_service, ns_addr, ns_port, update, wait, tsig_key,
+                    strand);
 }
 
 } // namespace d2
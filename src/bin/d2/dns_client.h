@@ -10,6 +10,7 @@
 #include <d2/d2_update_message.h>
 
 #include <asiolink/io_service.h>
+#include <asiolink/io_strand.h>
 #include <util/buffer.h>
 
 #include <asiodns/io_fetch.h>
@@ -141,12 +142,17 @@ public:
     /// @param tsig_key A pointer to an @c isc::dns::TSIGKey object that will
     /// (if not null) be used to sign the DNS Update message and verify the
     /// response.
+    /// @param strand A pointer to the strand in which the message exchange
+    /// and the callback are run. If it is null, they are run directly by
+    /// the IO service, which must be then run by a single thread.
     void doUpdate(asiolink::IOService& io_service,
                   const asiolink::IOAddress& ns_addr,
                   const uint16_t ns_port,
                   D2UpdateMessage& update,
                   const unsigned int wait,
-                  const dns::TSIGKeyPtr& tsig_key = dns::TSIGKeyPtr());
+                  const dns::TSIGKeyPtr& tsig_key = dns::TSIGKeyPtr(),
+                  const asiolink::IOStrandPtr& strand =
+                  asiolink::IOStrandPtr());
 
 private:
     DNSClientImpl* impl_;  ///< Pointer to DNSClient implementation.
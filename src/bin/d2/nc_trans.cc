@@ -10,9 +10,12 @@
 #include <d2/nc_trans.h>
 #include <dns/rdata.h>
 
+#include <boost/bind.hpp>
+
 #include <sstream>
 
 using namespace isc::util;
+using namespace isc::util::thread;
 
 namespace isc {
 namespace d2 {
@@ -45,12 +48,13 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
                       DdnsDomainPtr& forward_domain,
                       DdnsDomainPtr& reverse_domain,
                       D2CfgMgrPtr& cfg_mgr)
-    : io_service_(io_service), ncr_(ncr), forward_domain_(forward_domain),
+    : io_service_(io_service), strand_(), finished_handler_(),
+     finished_(false), ncr_(ncr), forward_domain_(forward_domain),
      reverse_domain_(reverse_domain), dns_client_(), dns_update_request_(),
      dns_update_status_(DNSClient::OTHER), dns_update_response_(),
      forward_change_completed_(false), reverse_change_completed_(false),
      current_server_list_(), current_server_(), next_server_pos_(0),
-     update_attempts_(0), cfg_mgr_(cfg_mgr), tsig_key_() {
+     update_attempts_(0), cfg_mgr_(cfg_mgr), d2_params_(), tsig_key_() {
     /// @todo if io_service is NULL we are multi-threading and should
     /// instantiate our own
     if (!io_service_) {
@@ -76,19 +80,64 @@ NameChangeTransaction(asiolink::IOServicePtr& io_service,
         isc_throw(NameChangeTransactionError,
                   "Configuration manager cannot be null");
     }
+
+    d2_params_ = cfg_mgr_->getD2Params();
 }
 
 NameChangeTransaction::~NameChangeTransaction(){
 }
 
+void
+NameChangeTransaction::setStrand(const asiolink::IOStrandPtr& strand,
+                                 const boost::function<void()>&
+                                 finished_handler) {
+    strand_ = strand;
+    finished_handler_ = finished_handler;
+}
+
 void
 NameChangeTransaction::startTransaction() {
+    if (strand_ && !strand_->runningInThisThread()) {
+        strand_->post(boost::bind(&NameChangeTransaction::startTransaction,
+                                  this));
+        return;
+    }
+
     LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
               DHCP_DDNS_STARTING_TRANSACTION)
               .arg(getRequestId());
 
     setNcrStatus(dhcp_ddns::ST_PENDING);
     startModel(READY_ST);
+    checkFinished();
+}
+
+bool
+NameChangeTransaction::isFinished() const {
+    if (!strand_) {
+        return (isModelDone());
+    }
+
+    Mutex::Locker lock(finished_mutex_);
+    return (finished_);
+}
+
+void
+NameChangeTransaction::checkFinished() {
+    if (!strand_ || !isModelDone()) {
+        return;
+    }
+
+    // The transaction may be destroyed as soon as the flag is set, so
+    // the members must not be used afterwards.
+    boost::function<void()> finished_handler = finished_handler_;
+    {
+        Mutex::Locker lock(finished_mutex_);
+        finished_ = true;
+    }
+    if (finished_handler) {
+        finished_handler();
+    }
 }
 
 void
@@ -105,6 +154,7 @@ NameChangeTransaction::operator()(DNSClient::Status status) {
               .arg(responseString());
 
     runModel(IO_COMPLETED_EVT);
+    checkFinished();
 }
 
 std::string
@@ -171,10 +221,10 @@ NameChangeTransaction::sendUpdate(const std::string& comment) {
         // use_tsig_ is true. We should be able to navigate to the TSIG key
         // for the current server.  If not we would need to add that.
 
-        D2ParamsPtr d2_params = cfg_mgr_->getD2Params();
         dns_client_->doUpdate(*io_service_, current_server_->getIpAddress(),
                               current_server_->getPort(), *dns_update_request_,
-                              d2_params->getDnsServerTimeout(), tsig_key_);
+                              d2_params_->getDnsServerTimeout(), tsig_key_,
+                              strand_);
         // Message is on its way, so the next event should be NOP_EVT.
         postNextEvent(NOP_EVT);
         LOG_DEBUG(d2_to_dns_logger, DBGLVL_TRACE_DETAIL,
@@ -10,13 +10,16 @@
 /// @file nc_trans.h This file defines the class NameChangeTransaction.
 
 #include <asiolink/io_service.h>
+#include <asiolink/io_strand.h>
 #include <exceptions/exceptions.h>
 #include <d2/d2_cfg_mgr.h>
 #include <d2/dns_client.h>
 #include <dhcp_ddns/ncr_msg.h>
 #include <dns/tsig.h>
 #include <util/state_model.h>
+#include <util/threads/sync.h>
 
+#include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
 
@@ -175,13 +178,36 @@ public:
     /// @brief Destructor
     virtual ~NameChangeTransaction();
 
+    /// @brief Sets the strand running the transaction.
+    ///
+    /// It is used when the IO service of the transaction is run by many
+    /// threads. The state model and the DNS exchanges of the transaction
+    /// are then run in the strand, so the transactions are carried out in
+    /// parallel, but each of them by one thread at a time. It must be
+    /// called before the transaction is started.
+    ///
+    /// @param strand pointer to the strand running the transaction
+    /// @param finished_handler function invoked in the strand when the
+    /// transaction has finished. The transaction may be destroyed by
+    /// another thread as soon as this function has been invoked.
+    void setStrand(const asiolink::IOStrandPtr& strand,
+                   const boost::function<void()>& finished_handler);
+
     /// @brief Begins execution of the transaction.
     ///
     /// This method invokes StateModel::startModel() with a value of READY_ST.
     /// This causes transaction's state model to attempt to begin execution
-    /// with the state handler for READY_ST.
+    /// with the state handler for READY_ST. If the strand has been set, the
+    /// state model is started in the strand.
     void startTransaction();
 
+    /// @brief Checks if the transaction has finished.
+    ///
+    /// If the strand has been set, this method may be called by any thread.
+    ///
+    /// @return true if the state model of the transaction has ended.
+    bool isFinished() const;
+
     /// @brief Serves as the DNSClient IO completion event handler.
     ///
     /// This is the implementation of the method inherited by our derivation
@@ -256,6 +282,12 @@ protected:
     /// @throw StateModelError if an event value is undefined.
     virtual void verifyStates();
 
+    /// @brief Marks the transaction finished if its state model has ended.
+    ///
+    /// It is called in the strand after the state model has been run. It
+    /// has no effect if the strand has not been set.
+    void checkFinished();
+
     /// @brief Handler for fatal model execution errors.
     ///
     /// This handler is called by the StateModel implementation when the model
@@ -527,6 +559,18 @@ private:
     /// @brief The IOService which should be used to for IO processing.
     asiolink::IOServicePtr io_service_;
 
+    /// @brief The strand running the transaction (if any).
+    asiolink::IOStrandPtr strand_;
+
+    /// @brief The function invoked when the transaction has finished.
+    boost::function<void()> finished_handler_;
+
+    /// @brief Indicates if the transaction run in the strand has finished.
+    bool finished_;
+
+    /// @brief Mutex protecting the finished flag.
+    mutable util::thread::Mutex finished_mutex_;
+
     /// @brief The NameChangeRequest that the transaction is to fulfill.
     dhcp_ddns::NameChangeRequestPtr ncr_;
 
@@ -580,6 +624,12 @@ private:
     /// @brief Pointer to the configuration manager.
     D2CfgMgrPtr cfg_mgr_;
 
+    /// @brief Pointer to the global parameters.
+    ///
+    /// They are fetched when the transaction is created, so the
+    /// configuration is not accessed by the thread running the transaction.
+    D2ParamsPtr d2_params_;
+
     /// @brief Pointer to the TSIG key which should be used (if any).
     dns::TSIGKeyPtr tsig_key_;
 };
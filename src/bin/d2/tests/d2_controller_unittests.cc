@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <asiolink/interval_timer.h>
 #include <cc/command_interpreter.h>
 #include <d2/d2_controller.h>
 #include <d2/d2_process.h>
@@ -77,6 +78,38 @@ public:
 
         return (p);
     }
+
+    /// @brief Runs the D2 with many threads.
+    ///
+    /// This is the counterpart of @c runWithConfig which specifies the
+    /// number of threads running the DNS update transactions on the
+    /// command line.
+    ///
+    /// @param config configuration file content to write before calling
+    /// launch.
+    /// @param run_time_ms maximum amount of time to allow runProcess() to
+    /// continue.
+    /// @param thread_count number of threads, as text.
+    /// @param[out] elapsed_time the actual time in ms spent in launch().
+    void runWithThreads(const std::string& config, int run_time_ms,
+                        const char* thread_count,
+                        time_duration& elapsed_time) {
+        writeFile(config);
+
+        // Shutdown (without error) after runtime.
+        isc::asiolink::IntervalTimer timer(*getIOService());
+        timer.setup(genShutdownCallback, run_time_ms);
+
+        ptime start = microsec_clock::universal_time();
+        char* argv[] = { const_cast<char*>("progName"),
+                         const_cast<char*>("-c"),
+                         const_cast<char*>(DControllerTest::CFG_TEST_FILE),
+                         const_cast<char*>("-d"),
+                         const_cast<char*>("-T"),
+                         const_cast<char*>(thread_count) };
+        launch(6, argv);
+        elapsed_time = microsec_clock::universal_time() - start;
+    }
 };
 
 /// @brief Basic Controller instantiation testing.
@@ -135,6 +168,37 @@ TEST_F(D2ControllerTest, commandLineArgs) {
     EXPECT_THROW(parseArgs(argc, argv2), InvalidUsage);
 }
 
+/// @brief Tests that the number of threads running the DNS update
+/// transactions can be specified on the command line.
+TEST_F(D2ControllerTest, threadCountArg) {
+    boost::shared_ptr<D2Controller> controller =
+        boost::dynamic_pointer_cast<D2Controller>(getController());
+    ASSERT_TRUE(controller);
+    EXPECT_EQ(1, controller->getThreadCount());
+
+    char* argv[] = { const_cast<char*>("progName"),
+                     const_cast<char*>("-c"),
+                     const_cast<char*>(DControllerTest::CFG_TEST_FILE),
+                     const_cast<char*>("-T"),
+                     const_cast<char*>("4") };
+    EXPECT_NO_THROW(parseArgs(5, argv));
+    EXPECT_EQ(4, controller->getThreadCount());
+
+    // The number of threads is passed to the process.
+    ASSERT_NO_THROW(initProcess());
+    D2ProcessPtr process = getD2Process();
+    ASSERT_TRUE(process);
+    EXPECT_EQ(4, process->getThreadCount());
+
+    // Invalid numbers of threads are rejected.
+    argv[4] = const_cast<char*>("0");
+    EXPECT_THROW(parseArgs(5, argv), InvalidUsage);
+    argv[4] = const_cast<char*>("many");
+    EXPECT_THROW(parseArgs(5, argv), InvalidUsage);
+    argv[4] = const_cast<char*>("100000");
+    EXPECT_THROW(parseArgs(5, argv), InvalidUsage);
+}
+
 /// @brief Tests application process creation and initialization.
 /// Verifies that the process can be successfully created and initialized.
 TEST_F(D2ControllerTest, initProcessTesting) {
@@ -155,6 +219,25 @@ TEST_F(D2ControllerTest, launchNormalShutdown) {
                 elapsed_time.total_milliseconds() <= 1300);
 }
 
+/// @brief Tests launch and normal shutdown when the DNS update transactions
+/// are run by many threads.
+TEST_F(D2ControllerTest, launchNormalShutdownMultipleThreads) {
+    time_duration elapsed_time;
+    ASSERT_NO_THROW(runWithThreads(valid_d2_config, 1000, "4",
+                                   elapsed_time));
+
+    // The transactions were run by the separate IO service, whose threads
+    // have been stopped.
+    ASSERT_TRUE(getD2Process());
+    asiolink::IOServicePtr io_service =
+        getD2Process()->getD2UpdateMgr()->getTransactionIOService();
+    ASSERT_TRUE(io_service);
+    EXPECT_EQ(0, io_service->getThreadCount());
+
+    EXPECT_TRUE(elapsed_time.total_milliseconds() >= 800 &&
+                elapsed_time.total_milliseconds() <= 1300);
+}
+
 /// @brief Configuration update event testing.
 /// This really tests just the ability of the handlers to invoke the necessary
 /// chain of methods and handle error conditions. Configuration parsing and
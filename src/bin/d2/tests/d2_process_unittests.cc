@@ -160,6 +160,23 @@ TEST(D2Process, construction) {
     ASSERT_TRUE(update_mgr);
 }
 
+/// @brief Verifies that the number of threads running the DNS update
+/// transactions can be set and that it can't be zero.
+TEST(D2Process, threadCount) {
+    asiolink::IOServicePtr lcl_io_service(new isc::asiolink::IOService());
+    D2Process d2process("TestProcess", lcl_io_service);
+    EXPECT_EQ(1, d2process.getThreadCount());
+
+    EXPECT_NO_THROW(d2process.setThreadCount(4));
+    EXPECT_EQ(4, d2process.getThreadCount());
+
+    EXPECT_THROW(d2process.setThreadCount(0), BadValue);
+    EXPECT_EQ(4, d2process.getThreadCount());
+
+    // The transactions use the primary IO service until the process runs.
+    EXPECT_FALSE(d2process.getD2UpdateMgr()->getTransactionIOService());
+}
+
 /// @brief Verifies basic configure method behavior.
 /// This test primarily verifies that upon receipt of a new configuration,
 /// D2Process will reconfigure the queue manager if the configuration is valid,
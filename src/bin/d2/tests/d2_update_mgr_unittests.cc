@@ -860,4 +860,48 @@ TEST_F(D2UpdateMgrTest, multiTransactionTimeout) {
     }
 }
 
+/// @brief Tests processing of multiple transactions run by many threads.
+/// This test verifies that the transactions can be run by a pool of threads,
+/// each of them in its own strand, while the update manager is used by the
+/// test thread. It uses a fake server run by the test thread that responds
+/// to all requests with NOERROR.
+TEST_F(D2UpdateMgrTest, multiTransactionThreads) {
+    asiolink::IOServicePtr trans_io_service(new asiolink::IOService());
+    update_mgr_->setTransactionIOService(trans_io_service);
+
+    // Queue up all the requests.
+    int test_count = canned_count_;
+    for (int i = test_count; i > 0; i--) {
+        canned_ncrs_[i-1]->setReverseChange(true);
+        ASSERT_NO_THROW(queue_mgr_->enqueue(canned_ncrs_[i-1]));
+    }
+
+    asiolink::IOAddress server_ip("127.0.0.1");
+    FauxServer server(*io_service_, server_ip, 5301);
+    server.receive(FauxServer::USE_RCODE, dns::Rcode::NOERROR());
+
+    ASSERT_NO_THROW(trans_io_service->startThreads(4));
+
+    // Run sweep and IO until everything is done. The transactions can't be
+    // inspected by this thread while they are running, so the IO service
+    // is run whenever there is a transaction in progress. It is woken up
+    // by the server receiving the requests and by the finished transactions.
+    size_t timeout = cfg_mgr_->getD2Params()->getDnsServerTimeout() + 100;
+    size_t passes = 0;
+    while (update_mgr_->getQueueCount() ||
+           update_mgr_->getTransactionCount()) {
+        update_mgr_->sweep();
+        if (update_mgr_->getTransactionCount()) {
+            ASSERT_NE(0, runTimedIO(timeout));
+        }
+        ASSERT_LT(++passes, 1000);
+    }
+
+    ASSERT_NO_THROW(trans_io_service->stopThreads());
+
+    for (int i = 0; i < test_count; i++) {
+        EXPECT_EQ(dhcp_ddns::ST_COMPLETED, canned_ncrs_[i]->getStatus());
+    }
+}
+
 }
@@ -6,6 +6,8 @@
 
 #include <config.h>
 #include <cc/data.h>
+#include <dhcp/iface_mgr.h>
+#include <dhcp/libdhcp++.h>
 #include <dhcp4/ctrl_dhcp4_srv.h>
 #include <dhcp4/dhcp4_log.h>
 #include <dhcp4/dhcp4to6_ipc.h>
@@ -13,6 +15,7 @@
 #include <dhcp4/json_config_parser.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_db_access.h>
+#include <dhcpsrv/lease_cmds.h>
 #include <config/command_mgr.h>
 #include <stats/stats_mgr.h>
 
@@ -44,6 +47,12 @@ ControlledDhcpv4Srv::commandShutdownHandler(const string&, ConstElementPtr) {
 ConstElementPtr
 ControlledDhcpv4Srv::commandLibReloadHandler(const string&, ConstElementPtr) {
 
+    // The hook libraries are validated by the background configuration.
+    if (backgroundConfigInProgress()) {
+        return (isc::config::createAnswer(1, "Configuration is being parsed"
+                                          " in the background."));
+    }
+
     /// @todo delete any stored CalloutHandles referring to the old libraries
     /// Get list of currently loaded libraries and reload them.
     HookLibsCollection loaded = HooksManager::getLibraryInfo();
@@ -85,9 +94,18 @@ ControlledDhcpv4Srv::commandSetConfigHandler(const string&,
             message = "Missing mandatory 'Dhcp4' parameter.";
         } else if (dhcp4->getType() != Element::map) {
             message = "'Dhcp4' parameter expected to be a map.";
+        } else if (args->contains("background") &&
+                   (args->get("background")->getType() != Element::boolean)) {
+            message = "'background' parameter expected to be a boolean.";
         }
     }
 
+    // The staging configuration is in use by the background thread.
+    if (message.empty() && backgroundConfigInProgress()) {
+        message = "Previous configuration is still being parsed in the"
+            " background.";
+    }
+
     if (!message.empty()) {
         // Something is amiss with arguments, return a failure response.
         ConstElementPtr result = isc::config::createAnswer(status_code,
@@ -109,6 +127,12 @@ ControlledDhcpv4Srv::commandSetConfigHandler(const string&,
     Daemon::configureLogger(args->get("Logging"),
                             CfgMgr::instance().getStagingCfg());
 
+    // The server continues to process packets while the configuration
+    // is parsed in the background. It is applied when parsed.
+    if (args->contains("background") && args->get("background")->boolValue()) {
+        return (startBackgroundConfig(dhcp4));
+    }
+
     // Now we configure the server proper.
     ConstElementPtr result = processConfig(dhcp4);
 
@@ -127,6 +151,103 @@ ControlledDhcpv4Srv::commandSetConfigHandler(const string&,
     return (result);
 }
 
+ConstElementPtr
+ControlledDhcpv4Srv::startBackgroundConfig(ConstElementPtr dhcp4) {
+    // The option definitions are parsed into the staging configuration
+    // only. The runtime option definitions used by the packet processing
+    // are replaced when the configuration is applied.
+    ConstElementPtr answer = beginDhcp4Config(dhcp4, false);
+    if (answer) {
+        return (commitDhcp4Config(answer, false));
+    }
+
+    try {
+        config_watch_.reset(new isc::util::WatchSocket());
+        IfaceMgr::instance().addExternalSocket(config_watch_->getSelectFd(),
+            boost::bind(&ControlledDhcpv4Srv::commitBackgroundConfig, this));
+        config_thread_.reset(new isc::util::thread::Thread(
+            boost::bind(&ControlledDhcpv4Srv::parseBackgroundConfig, this,
+                        dhcp4)));
+    } catch (const std::exception& ex) {
+        if (config_watch_) {
+            IfaceMgr::instance().deleteExternalSocket(config_watch_->
+                                                      getSelectFd());
+            config_watch_.reset();
+        }
+        std::ostringstream err;
+        err << "Unable to start parsing configuration in the background: "
+            << ex.what();
+        return (commitDhcp4Config(isc::config::createAnswer(1, err.str()),
+                                  false));
+    }
+
+    LOG_INFO(dhcp4_logger, DHCP4_BACKGROUND_CONFIG_START);
+    return (isc::config::createAnswer(0, "Configuration is being parsed in"
+                                      " the background."));
+}
+
+void
+ControlledDhcpv4Srv::parseBackgroundConfig(ConstElementPtr dhcp4) {
+    config_answer_ = parseDhcp4Config(dhcp4);
+    config_watch_->markReady();
+}
+
+void
+ControlledDhcpv4Srv::commitBackgroundConfig() {
+    IfaceMgr::instance().deleteExternalSocket(config_watch_->getSelectFd());
+    ConstElementPtr answer;
+    try {
+        config_thread_->wait();
+        answer = config_answer_;
+    } catch (const std::exception& ex) {
+        answer = isc::config::createAnswer(1, ex.what());
+    }
+    config_thread_.reset();
+    config_watch_.reset();
+    config_answer_.reset();
+
+    // The timers are unregistered when the configuration is applied. This
+    // is not allowed when the thread is running.
+    if (!answer) {
+        try {
+            timer_mgr_->stopThread();
+            timer_mgr_->unregisterTimers();
+        } catch (const std::exception& ex) {
+            std::ostringstream err;
+            err << "Unable to stop worker thread running timers: "
+                << ex.what() << ".";
+            answer = isc::config::createAnswer(1, err.str());
+        }
+    }
+
+    // The packets received so far have been processed with the current
+    // option definitions. Stage the parsed ones now.
+    if (!answer) {
+        LibDHCP::setRuntimeOptionDefs(CfgMgr::instance().getStagingCfg()->
+                                      getCfgOptionDef()->getContainer());
+    }
+
+    answer = applyConfig(commitDhcp4Config(answer, false));
+
+    int rcode = 0;
+    ConstElementPtr comment = isc::config::parseAnswer(rcode, answer);
+    if (rcode != 0) {
+        LOG_ERROR(dhcp4_logger, DHCP4_BACKGROUND_CONFIG_FAIL)
+            .arg(comment ? comment->stringValue() : "no details available");
+        LibDHCP::revertRuntimeOptionDefs();
+        CfgMgr::instance().rollback();
+        return;
+    }
+
+    // Apply the logging configuration and replace the current configuration.
+    CfgMgr::instance().getStagingCfg()->applyLoggingCfg();
+    CfgMgr::instance().commit();
+
+    // Finally, we can commit runtime option definitions in libdhcp++. This is
+    // exception free.
+    LibDHCP::commitRuntimeOptionDefs();
+}
+
 ConstElementPtr
 ControlledDhcpv4Srv::commandLeasesReclaimHandler(const string&,
                                                  ConstElementPtr args) {
@@ -220,7 +341,25 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
-    ConstElementPtr answer = configureDhcp4Server(*srv, config);
+    ConstElementPtr answer = applyConfig(configureDhcp4Server(*srv, config));
+
+    // Commit the runtime option definitions so as the failed background
+    // configuration reverts to them.
+    int rcode = 0;
+    isc::config::parseAnswer(rcode, answer);
+    if (rcode == 0) {
+        LibDHCP::commitRuntimeOptionDefs();
+    }
+
+    return (answer);
+}
+
+ConstElementPtr
+ControlledDhcpv4Srv::applyConfig(ConstElementPtr answer) {
+    ControlledDhcpv4Srv* srv = ControlledDhcpv4Srv::getInstance();
+
+    // Single stream instance used in all error clauses
+    std::ostringstream err;
 
     // Check that configuration was successful. If not, do not reopen sockets
     // and don't bother with DDNS stuff.
@@ -289,6 +428,13 @@ ControlledDhcpv4Srv::processConfig(isc::data::ConstElementPtr config) {
         return (isc::config::createAnswer(1, err.str()));
     }
 
+    // Set the time for which the released and reclaimed addresses are held
+    // before they are reused.
+    if (srv->alloc_engine_) {
+        srv->alloc_engine_->setReuseQuarantineTime(CfgMgr::instance().
+            getStagingCfg()->getCfgExpiration()->getReuseQuarantineTime());
+    }
+
     // Start worker thread if there are any timers installed.
     if (TimerMgr::instance()->timersCount() > 0) {
         try {
@@ -344,6 +490,16 @@ ControlledDhcpv4Srv::ControlledDhcpv4Srv(uint16_t port /*= DHCP4_SERVER_PORT*/)
 
     CommandMgr::instance().registerCommand("statistic-remove-all",
         boost::bind(&StatsMgr::statisticRemoveAllHandler, _1, _2));
+
+    // Register lease related commands
+    CommandMgr::instance().registerCommand("lease4-get-page",
+        boost::bind(&LeaseCmds::lease4GetPageHandler, _1, _2));
+
+    CommandMgr::instance().registerStreamCommand("lease4-export",
+        boost::bind(&LeaseCmds::lease4ExportHandler, _1, _2));
+
+    CommandMgr::instance().registerCommand("lease4-import",
+        boost::bind(&LeaseCmds::lease4ImportHandler, _1, _2));
 }
 
 void ControlledDhcpv4Srv::shutdown() {
@@ -355,6 +511,21 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
     try {
         cleanup();
 
+        // Wait for the background configuration parsing to finish and
+        // discard its result.
+        if (config_thread_) {
+            IfaceMgr::instance().deleteExternalSocket(config_watch_->
+                                                      getSelectFd());
+            try {
+                config_thread_->wait();
+            } catch (...) {
+                // The result is discarded anyway.
+            }
+            config_thread_.reset();
+            config_watch_.reset();
+            CfgMgr::instance().rollback();
+        }
+
         // Stop worker thread running timers, if it is running. Then
         // unregister any timers.
         timer_mgr_->stopThread();
@@ -374,6 +545,9 @@ ControlledDhcpv4Srv::~ControlledDhcpv4Srv() {
         CommandMgr::instance().deregisterCommand("statistic-get-all");
         CommandMgr::instance().deregisterCommand("statistic-reset-all");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
+        CommandMgr::instance().deregisterCommand("lease4-get-page");
+        CommandMgr::instance().deregisterCommand("lease4-export");
+        CommandMgr::instance().deregisterCommand("lease4-import");
 
     } catch (...) {
         // Don't want to throw exceptions from the destructor. The server
@@ -13,6 +13,9 @@
 #include <cc/command_interpreter.h>
 #include <dhcpsrv/timer_mgr.h>
 #include <dhcp4/dhcp4_srv.h>
+#include <util/threads/thread.h>
+#include <util/watch_socket.h>
+#include <boost/scoped_ptr.hpp>
 
 namespace isc {
 namespace dhcp {
@@ -96,6 +99,37 @@ public:
         return (server_);
     }
 
+    /// @brief Checks if a configuration is being parsed in the background.
+    ///
+    /// While the configuration is parsed in the background the staging
+    /// configuration must not be used, so no other configuration can be
+    /// applied.
+    ///
+    /// @return true if the background parsing is in progress.
+    bool backgroundConfigInProgress() const {
+        return (static_cast<bool>(config_thread_));
+    }
+
+    /// @brief Sets the name of the configuration cache file.
+    ///
+    /// When set, the configuration parsed from the configuration file is
+    /// stored in this file after it has been successfully applied. The
+    /// following loads of the unchanged configuration file use the cached
+    /// configuration instead of parsing the file.
+    ///
+    /// @param cache_file name of the cache file or empty string to disable
+    /// the cache.
+    void setConfigCacheFile(const std::string& cache_file) {
+        config_cache_file_ = cache_file;
+    }
+
+    /// @brief Returns the name of the configuration cache file.
+    ///
+    /// @return name of the cache file or empty string if the cache is
+    /// disabled.
+    const std::string& getConfigCacheFile() const {
+        return (config_cache_file_);
+    }
 
 private:
     /// @brief Callback that will be called from iface_mgr when data
@@ -106,6 +140,47 @@ private:
     /// (that was sent from some yet unspecified sender).
     static void sessionReader(void);
 
+    /// @brief Applies the parsed configuration to the server.
+    ///
+    /// This is the part of @c processConfig run after the configuration
+    /// has been parsed. It opens the databases, sockets, starts the D2
+    /// client and sets up the timers according to the staging configuration.
+    ///
+    /// @param answer result of the configuration parsing.
+    ///
+    /// @return status of the config update
+    static isc::data::ConstElementPtr
+    applyConfig(isc::data::ConstElementPtr answer);
+
+    /// @brief Starts parsing the configuration in the background.
+    ///
+    /// The option definitions are parsed by the calling thread, because they
+    /// are used by the packet processing. The rest of the configuration is
+    /// parsed into the staging configuration by a new thread, while the
+    /// server continues to process packets with the current configuration.
+    /// When the thread finishes, it marks the watch socket ready and the
+    /// @c commitBackgroundConfig is invoked by the @c IfaceMgr between the
+    /// packets.
+    ///
+    /// @param dhcp4 DHCPv4 server configuration.
+    ///
+    /// @return status of the command
+    isc::data::ConstElementPtr
+    startBackgroundConfig(isc::data::ConstElementPtr dhcp4);
+
+    /// @brief Parses the configuration in the background thread.
+    ///
+    /// @param dhcp4 DHCPv4 server configuration.
+    void parseBackgroundConfig(isc::data::ConstElementPtr dhcp4);
+
+    /// @brief Applies the configuration parsed in the background.
+    ///
+    /// This callback is invoked by the @c IfaceMgr when the background
+    /// thread has finished. The new configuration replaces the current one
+    /// with a single commit, so the packets are processed either with the
+    /// old or the new configuration.
+    void commitBackgroundConfig();
+
     /// @brief Handler for processing 'shutdown' command
     ///
     /// This handler processes shutdown command, which initializes shutdown
@@ -219,6 +294,19 @@ private:
     /// Shared pointer to the instance of timer @c TimerMgr is held here to
     /// make sure that the @c TimerMgr outlives instance of this class.
     TimerMgrPtr timer_mgr_;
+
+    /// @brief Thread parsing the configuration in the background.
+    boost::scoped_ptr<isc::util::thread::Thread> config_thread_;
+
+    /// @brief Watch socket used to signal that the background thread
+    /// has finished.
+    boost::scoped_ptr<isc::util::WatchSocket> config_watch_;
+
+    /// @brief Result of the configuration parsing in the background.
+    isc::data::ConstElementPtr config_answer_;
+
+    /// @brief Name of the configuration cache file.
+    std::string config_cache_file_;
 };
 
 }; // namespace isc::dhcp
@@ -92,6 +92,12 @@
             "item_type": "integer",
             "item_optional": false,
             "item_default": 5
+        },
+        {
+            "item_name": "reuse-quarantine-time",
+            "item_type": "integer",
+            "item_optional": false,
+            "item_default": 0
         }
         ]
       },
@@ -524,8 +524,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to parser4_text[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 143
-#define YY_END_OF_BUFFER 144
+#define YY_NUM_RULES 146
+#define YY_END_OF_BUFFER 147
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -533,136 +533,143 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1166] =
+static const flex_int16_t yy_accept[1224] =
     {   0,
-      136,  136,    0,    0,    0,    0,    0,    0,    0,    0,
-      144,  142,   10,   11,  142,    1,  136,  133,  136,  136,
-      142,  135,  134,  142,  142,  142,  142,  142,  129,  130,
-      142,  142,  142,  131,  132,    5,    5,    5,  142,  142,
-      142,   10,   11,    0,    0,  125,    0,    0,    0,    0,
+      139,  139,    0,    0,    0,    0,    0,    0,    0,    0,
+      147,  145,   10,   11,  145,    1,  139,  136,  139,  139,
+      145,  138,  137,  145,  145,  145,  145,  145,  132,  133,
+      145,  145,  145,  134,  135,    5,    5,   11,    5,  145,
+       10,   11,  145,  145,   10,   11,  145,  145,   10,   11,
+      145,   10,   11,    0,    0,  128,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    1,  136,
-      136,    0,  135,  136,    3,    2,    6,    0,  136,    0,
-        0,    0,    0,    0,    0,    4,    0,    0,    9,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    1,  139,
+      139,    0,  138,    3,    2,    6,    0,  139,    0,    0,
 
-      126,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  128,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   10,   11,    4,   10,   11,    0,
+       10,   11,    0,   10,   11,    9,  129,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      131,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    2,    0,
-        0,    0,    0,    0,    0,    0,    8,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      127,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    8,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,  130,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   50,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   52,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,  141,  139,    0,  138,  137,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,  107,    0,  106,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-       25,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      144,  142,    0,  141,  140,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,  110,    0,  109,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,    0,   25,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   15,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   16,
-        0,    0,    0,  140,  137,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  108,    0,    0,  110,    0,    0,
-        0,    0,    0,    0,    0,   53,    0,    0,    0,    0,
-       43,    0,    0,    0,    0,   65,    0,    0,    0,    0,
-        0,    0,    0,    0,   28,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   42,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   45,    0,   29,    0,    0,    0,    0,    0,    0,
+       15,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   16,    0,
+        0,    0,  143,  140,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  111,    0,    0,  113,    0,    0,    0,
+        0,    0,    0,    0,    0,   55,    0,    0,    0,    0,
+
+       45,    0,    0,    0,    0,   67,    0,    0,    0,    0,
+        0,    0,    0,    0,   28,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   63,   21,    0,   26,    0,    0,    0,    0,    0,
-        0,    0,   12,  115,    0,  112,    0,  111,    0,    0,
-        0,   74,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   44,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   47,    0,   29,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   65,   21,    0,   26,    0,    0,    0,    0,
+        0,    0,    0,   12,  118,    0,  115,    0,  114,    0,
+        0,    0,   76,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   23,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,   44,    0,    0,
-        0,    0,    0,    0,    0,   75,    0,    0,    0,    0,
-        0,    0,    0,   70,    0,    0,    0,    0,    7,    0,
-        0,  113,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   23,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   46,
+        0,    0,    0,    0,    0,    0,    0,   77,    0,    0,
+        0,    0,    0,    0,    0,    0,   72,    0,    0,    0,
+        0,    7,    0,    0,  116,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   58,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   47,    0,    0,    0,
 
-        0,    0,    0,    0,   55,    0,    0,    0,    0,    0,
+       60,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   49,    0,    0,    0,    0,    0,    0,    0,   57,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   79,   56,
-        0,    0,    0,   22,    0,    0,    0,    0,    0,    0,
-        0,    0,   30,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   39,    0,    0,    0,    0,    0,  116,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   81,   58,    0,    0,    0,
+       22,    0,    0,    0,    0,    0,    0,    0,    0,   30,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   41,
 
-        0,    0,    0,   69,    0,    0,    0,    0,   33,    0,
+        0,    0,    0,    0,    0,  119,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   71,    0,    0,    0,    0,   35,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,   27,    0,    0,    0,   20,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   60,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   62,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   67,    0,    0,    0,    0,    0,    0,   91,
+        0,    0,    0,    0,   69,    0,    0,    0,    0,    0,
+        0,    0,   94,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,   50,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   48,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   99,    0,    0,   97,    0,    0,
+        0,    0,    0,    0,    0,  122,    0,    0,    0,    0,
+       34,   70,    0,    0,    0,    0,    0,   73,   61,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   68,    0,   17,    0,   78,    0,    0,    0,
+        0,    0,  103,    0,    0,    0,   42,    0,    0,    0,
+       80,   24,    0,    0,    0,    0,    0,    0,    0,    0,
 
-       96,    0,    0,   94,    0,    0,    0,    0,    0,    0,
-        0,  119,    0,    0,    0,    0,   68,    0,    0,    0,
-        0,   71,   59,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   66,    0,   17,    0,
-       76,    0,    0,    0,    0,    0,  100,    0,    0,    0,
-       40,    0,    0,    0,   78,   24,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   73,    0,    0,    0,
+        0,    0,    0,    0,   75,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,  122,   41,    0,    0,    0,    0,    0,    0,
-        0,    0,   36,    0,    0,    0,   97,    0,   95,   90,
-       89,    0,    0,    0,    0,    0,  109,    0,    0,   62,
-        0,    0,    0,    0,    0,    0,   87,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   49,    0,    0,   31,
-        0,    0,    0,    0,   99,    0,    0,    0,    0,   51,
-       37,    0,   72,    0,    0,   64,    0,    0,   46,    0,
-      117,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      125,   43,    0,    0,    0,    0,    0,    0,    0,    0,
+       38,    0,    0,    0,    0,  100,    0,   98,   93,   92,
+        0,    0,    0,    0,    0,  112,    0,    0,   64,    0,
+        0,    0,    0,    0,    0,    0,   90,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   51,    0,    0,   31,
+        0,    0,    0,    0,  102,    0,    0,    0,    0,   53,
+
+       39,    0,   74,    0,    0,   66,    0,    0,    0,   48,
+        0,  120,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  124,
-       61,    0,   34,   88,    0,    0,  120,   92,    0,    0,
-        0,    0,    0,    0,   19,    0,   18,    0,   98,    0,
-        0,   57,    0,    0,    0,    0,    0,    0,    0,    0,
-       35,    0,    0,    0,   32,    0,    0,    0,    0,    0,
-        0,   77,    0,    0,  121,    0,    0,    0,    0,    0,
-        0,    0,    0,  123,    0,  118,  114,    0,    0,   14,
-        0,    0,  105,    0,    0,    0,    0,   85,    0,    0,
-        0,    0,    0,   52,    0,    0,    0,    0,    0,    0,
-        0,   13,    0,    0,    0,   93,    0,    0,    0,    0,
-
-        0,    0,    0,    0,    0,   84,    0,  102,    0,    0,
-        0,  101,    0,    0,    0,   83,    0,    0,    0,  104,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  103,
-        0,    0,    0,    0,    0,    0,   81,   86,   38,    0,
-        0,    0,   80,    0,    0,    0,    0,    0,    0,    0,
-       54,    0,    0,   82,    0
+        0,    0,  127,   63,    0,    0,   36,   91,    0,    0,
+      123,   95,    0,    0,    0,    0,    0,    0,   19,    0,
+       18,    0,  101,    0,    0,   59,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,   37,    0,    0,    0,   32,
+        0,    0,    0,    0,    0,    0,    0,   79,    0,    0,
+
+      124,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      126,    0,  121,  117,    0,    0,    0,   14,    0,    0,
+      108,    0,    0,    0,    0,   88,    0,    0,    0,    0,
+        0,   54,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   13,    0,    0,    0,   96,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   87,    0,  105,
+        0,    0,    0,    0,  104,    0,    0,    0,    0,   85,
+        0,    0,    0,  107,    0,    0,   33,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,   86,    0,    0,    0,    0,    0,  106,    0,    0,
+
+        0,    0,    0,    0,   83,   89,   40,    0,    0,    0,
+       82,    0,    0,    0,    0,    0,    0,    0,   56,    0,
+        0,   84,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -678,9 +685,9 @@ static const YY_CHAR yy_ec[256] =
         5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
        40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
-       58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
-       68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
+       48,   49,   50,   51,   52,   28,   53,   54,   55,   56,
+       57,   58,   59,   60,   61,   62,   63,   64,   65,   66,
+       67,   68,   69,    5,   70,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -697,642 +704,835 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[72] =
+static const YY_CHAR yy_meta[71] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1178] =
+static const flex_int16_t yy_base[1224] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1527, 1528,   32, 1523,  141,    0,  201, 1528,  206,   88,
-       11,  213, 1528, 1505,  114,   25,    2,    6, 1528, 1528,
-       73,   11,   17, 1528, 1528, 1528,  104, 1511, 1466,    0,
-     1503,  107, 1518,  217,  247, 1528, 1462,  185, 1468,   93,
-       58, 1460,   91,  209,  200,   14,  273,  190, 1459,  181,
-      186,  189,  223, 1468,   66,  206, 1467,  232,  204,  294,
-      256,  216, 1450,   78,  268,  300,  300, 1469,    0,  329,
-      344,  356,  364,  359, 1528,    0, 1528,  273,  335,  300,
-      335,  289,  353,  354,  299, 1528, 1466, 1505, 1528,  311,
-
-     1528,  375, 1494,  328, 1463,  356,  355, 1458,  350,  359,
-      357,  363,  371, 1501,    0,  426,  359, 1445, 1447, 1443,
-     1451,   74, 1447, 1436, 1437,   89, 1453, 1446, 1446,  213,
-     1437, 1431, 1437,  343, 1482, 1486, 1428, 1479, 1421, 1444,
-     1441, 1441, 1435,  336, 1428, 1421, 1426, 1420,  363, 1417,
-     1416, 1430,  365, 1416,  373, 1432,  351,  399,  372, 1429,
-     1430, 1428, 1410, 1412,  421, 1404, 1421, 1413,    0,  421,
-      430,  398,  426,  434,  439, 1412, 1528,    0, 1455,  446,
-     1406,  431,  427, 1414,  443, 1457,  444, 1456,  446, 1455,
-     1528,  490,  456, 1416, 1396, 1412, 1409, 1408,  438, 1449,
-
-     1443, 1409, 1388, 1396, 1391, 1402, 1390, 1402, 1402, 1393,
-     1382, 1395, 1395, 1387, 1377, 1395, 1528, 1390, 1393, 1374,
-     1373, 1423, 1372, 1382, 1385, 1419, 1380, 1368, 1379, 1415,
-     1362, 1372, 1364, 1361, 1377, 1358, 1357, 1363, 1354, 1353,
-     1360, 1362, 1407, 1365, 1359,  211, 1366, 1361, 1353, 1359,
-     1359, 1340, 1356, 1349, 1356, 1344, 1337, 1351, 1392, 1353,
-     1335, 1343,  454, 1528, 1528,  461, 1528, 1528, 1330,    0,
-      279,  439,  502,  471, 1387, 1340,  433, 1528, 1385, 1528,
-     1379,  526,  442, 1321, 1377, 1323, 1329, 1379, 1336,  438,
-     1528, 1334, 1376, 1331, 1328,  391, 1373, 1367, 1322, 1317,
-
-     1314, 1323, 1312, 1361, 1309,  519, 1323, 1308, 1321, 1308,
-     1318, 1313, 1320, 1315, 1311,  437, 1309, 1305, 1353,  355,
-     1347, 1299, 1292, 1294, 1298, 1287, 1300,  502, 1345, 1300,
-     1297, 1301, 1528, 1289, 1289, 1301, 1283, 1275, 1276, 1297,
-     1279, 1291, 1290, 1276, 1288, 1287, 1286, 1327, 1326, 1528,
-     1270,  516, 1283, 1528, 1528, 1282,    0, 1271, 1263,  494,
-     1320, 1319, 1277, 1317, 1528, 1265, 1315, 1528,  501,  568,
-      495, 1314, 1270, 1266, 1254, 1528, 1270, 1269, 1256, 1255,
-     1528, 1257, 1254,  497, 1252, 1528, 1263, 1260, 1245, 1258,
-     1294, 1260, 1242, 1291, 1528, 1240, 1256, 1288, 1251, 1248,
-
-     1249, 1251, 1283, 1236, 1231, 1230, 1279, 1225, 1240, 1232,
-     1280, 1528, 1227, 1223, 1221, 1225, 1218, 1228, 1231, 1220,
-     1215, 1528, 1270, 1528, 1214, 1225, 1262, 1215, 1224, 1218,
-     1222, 1262, 1256, 1220, 1200, 1203, 1202, 1210, 1198, 1254,
-     1196, 1528, 1528, 1201, 1528, 1211, 1245, 1207,    0, 1191,
-     1208, 1246, 1528, 1528, 1194, 1528, 1200, 1528,  522,  534,
-      555, 1528, 1197, 1185, 1236, 1183, 1182, 1189, 1182, 1194,
-     1193, 1193, 1181, 1222, 1182, 1225, 1171, 1187, 1172, 1169,
-     1183, 1175, 1181, 1172, 1180, 1165, 1181, 1163, 1177, 1175,
-     1158, 1152, 1157, 1172, 1169, 1170, 1167, 1528, 1153, 1155,
-
-     1164, 1200,  526, 1163, 1146, 1147, 1144, 1528, 1158, 1137,
-     1158, 1148, 1191, 1145, 1189, 1528, 1136, 1150, 1153, 1185,
-     1184, 1131, 1182, 1528,   14, 1144, 1133, 1135, 1528, 1141,
-     1131, 1528, 1125, 1180,  533,  495, 1133, 1129, 1172,  533,
-     1171, 1170, 1169, 1123, 1113, 1166, 1119, 1129, 1163, 1121,
-     1108, 1116, 1159, 1121, 1120, 1121, 1114, 1103, 1116, 1119,
-     1114, 1115, 1112, 1111, 1114, 1109, 1150, 1149, 1099, 1089,
-     1097, 1145, 1094, 1086, 1087, 1100, 1528, 1088, 1097, 1096,
-     1096, 1136, 1079, 1088, 1081, 1070, 1074, 1125, 1072, 1082,
-     1122, 1069,  503,  546, 1063,  543, 1528, 1124, 1082, 1071,
-
-     1075, 1065, 1077, 1118, 1528, 1112,  565, 1065, 1073, 1068,
-     1064, 1071, 1054, 1057, 1053, 1070, 1065, 1053, 1049, 1056,
-     1050, 1060, 1048, 1062, 1050, 1058, 1056, 1047, 1056, 1052,
-     1093, 1035, 1035, 1048, 1033, 1088, 1030, 1031, 1528, 1528,
-     1039, 1042, 1045, 1528, 1044, 1029, 1021,  559, 1026, 1073,
-     1022, 1076, 1528, 1021, 1023, 1023, 1072, 1025, 1013, 1007,
-     1018, 1027, 1020, 1012, 1012, 1011, 1009, 1009, 1060, 1021,
-      996, 1528, 1052,  999, 1012, 1011,  996, 1528,  545,  498,
-     1012, 1046, 1009, 1011, 1048, 1001,  994,  993,  987,  994,
-      987, 1041,  998,  987,  987,  996,  979,  993,  985, 1028,
-
-      994,  976,  975, 1528,  991,  972,  612,  971, 1528,  988,
-      966,  982, 1018,    7,    5,   92,  280,  276,  413,  458,
-      508,  462, 1528,  490,  513,  522, 1528,  530,  535,  529,
-      553,  547,  550,  603,  549,  549,  613,  559, 1528,  565,
-      563,  563,  577,  578,  584,  623,  597,  602,  576,  576,
-      628,  573, 1528,  580,  585,  592,  633,  634,  583, 1528,
-      579,  582,  581,  601,  598,  603,  604,  590,  598,  607,
-      587,  608,  648, 1528,  603,  650,  651,  615,  618,  606,
-      602,  609,  660,  609,  607,  625,  664,  619,  617,  615,
-      669,  670,  666,  626,  631,  624,  633,  621,  631,  627,
-
-     1528,  622,  623, 1528,  624,  640,  641,  642,  624,  629,
-      647, 1528,  669,  660,  632,  653, 1528,  636,  651,  643,
-      647, 1528, 1528,  657,  692,  641,  694,  643,  701,  646,
-      657,  649,  655,  651,  669,  670, 1528,  668, 1528,  670,
-     1528,  674,  664,  657,  669,  711, 1528,  669,  719,  720,
-     1528,  669,  676,  718, 1528, 1528,  668,  668,  671,  685,
-      672,  729,  688,  726,  732,  682,  734,  735,  736,  697,
-      681,  693,  698,  713,  742,  702,  694,  745,  694,  690,
-      706,  711,  693,  751,  706,  711, 1528,  712,  705,  714,
-      715,  712,  702,  704,  761,  710,  707,  764,  760,  703,
-
-      718,  768, 1528, 1528,  719,  729,  714,  715,  774,  776,
-      722,  778, 1528,  728,  730,  781, 1528,  745, 1528, 1528,
-     1528,  735,  785,  736,  788,  770, 1528,  748,  749, 1528,
-      736,  736,  739,  739,  740,  736, 1528,  758,  744,  745,
-      760,  760,  763,  763,  760,  765, 1528,  757,  767, 1528,
-      764,  769,  771,  768, 1528,  759,  765,  764,  775, 1528,
-     1528,  814, 1528,  763,  769, 1528,  772,  785, 1528,  782,
-     1528,  779,  802,  822,  828,  829,  773,  831,  832,  787,
-      781,  835,  836,  832,  797,  793,  835,  785,  790,  843,
-      801,  845,  805,  847,  810,  799,  850,  794,  811,  811,
-
-      795,  851,  816,  816,  813,  860,  820,  833,  820, 1528,
-     1528,  864, 1528, 1528,  813,  824, 1528, 1528,  814,  863,
-      808,  813,  871,  821, 1528,  827, 1528,  874, 1528,  819,
-      834, 1528,  872,  840,  833,  842,  830,  840,  883,  834,
-     1528,  885,  886,  833, 1528,  837,  889,  836,  835,  893,
-      848, 1528,  890,  852, 1528,  855,  898,  841,  843,  840,
-      856,  865,  904, 1528,  900, 1528, 1528,  865,  902, 1528,
-      856,  863, 1528,  860,  865,  912,  857, 1528,  861,  873,
-      916,  860,  868, 1528,  879,  869,  868,  882,  873,  882,
-      884, 1528,  926,  886,  928, 1528,  924,  888,  869,  932,
-
-      891,  892,  893,  936,  895, 1528,  900, 1528,  882,  940,
-      901, 1528,  887,  887,  889, 1528,  894,  889,  901, 1528,
-      899,  903,  894,  946,  895,  911,  904,  913,  904,  911,
-      898,  913,  960,  919,  906,  922,  913,  927,  923, 1528,
-      967,  968,  969,  926,  925,  926, 1528, 1528, 1528,  973,
-      917,  933, 1528,  971,  922,  921,  923,  934,  981,  932,
-     1528,  941,  984, 1528, 1528,  990,  995, 1000, 1005, 1010,
-     1015, 1020, 1023,  997, 1002, 1004, 1017
+       72,  143,  144,  215,  216,  287,  288,  359,  360,  431,
+      432,  433,  434,  141,  438,  508,  567,  435,  570,  575,
+      580,  437,  511,  196,  585,  559,  561,  562,  598,  602,
+      244,  297,  374,  604,  605,  606,  607,  609,  594,  608,
+      612,  610,  554,  617,  616,  618,  624,  619,  693,  620,
+      611,  627,  696,  694,  750,  766,  710,  739,  718,  795,
+      756,  713,  793,  796,  797,  798,  856,  721,  715,  776,
+      783,  872,  719,  729,  726,  789,  734,  882,  868,  778,
+      790,  885,  724,  807,  888,  802,  893,  740,  792,  823,
+      832,  838,  840,  843,  951,  852,  932,  901,  993,  994,
+
+      869,  735,  873,  874,  944,  947,  948,  950,  964,  978,
+     1025, 1026, 1021, 1028, 1029, 1030, 1031, 1027, 1016,  996,
+      989, 1008, 1007,  986, 1002, 1009, 1006, 1012, 1032, 1050,
+     1043, 1101,  980,  990,  992, 1000,  995, 1013, 1037, 1004,
+     1010,  997, 1033, 1014, 1019, 1003, 1042, 1015, 1018, 1036,
+     1040, 1064, 1071, 1020, 1074, 1038, 1052, 1054, 1053, 1058,
+     1066, 1056, 1048, 1059, 1060, 1055, 1057, 1067, 1070, 1073,
+     1075, 1079, 1086, 1093, 1098, 1104, 1085, 1094, 1092, 1080,
+     1095, 1097, 1100, 1109, 1108, 1129, 1137, 1144, 1106, 1116,
+     1123, 1118, 1173, 1160, 1166, 1157, 1121, 1153, 1159, 1130,
+
+     1163, 1187, 1169, 1189, 1167, 1196, 1204, 1154, 1155, 1138,
+     1151, 1164, 1165, 1168, 1175, 1197, 1201, 1177, 1161, 1178,
+     1176, 1186, 1179, 1190, 1194, 1170, 1180, 1191, 1193, 1192,
+     1181, 1198, 1244, 1199, 1202, 1195, 1200, 1243, 1203, 1205,
+     1211, 1247, 1210, 1206, 1212, 1251, 1207, 1214, 1209, 1208,
+     1220, 1213, 1215, 1216, 1217, 1218, 1219, 1223, 1265, 1225,
+     1226, 1227, 1233, 1234, 1229, 1237, 1228, 1239, 1224, 1242,
+     1238, 1241, 1236, 1231, 1246, 1289, 1252, 1240, 1245, 1273,
+     1299, 1301, 1254, 1303, 1304, 1248, 1291, 1257, 1280, 1307,
+     1285, 1302, 1268, 1292, 1324, 1320, 1327, 1317, 1334, 1262,
+
+     1263, 1321, 1286, 1278, 1287, 1336, 1296, 1309, 1345, 1297,
+     1348, 1311, 1310, 1352, 1358, 1340, 1312, 1313, 1305, 1319,
+     1308, 1361, 1314, 1378, 1326, 1316, 1330, 1328, 1337, 1322,
+     1343, 1342, 1341, 1335, 1339, 1344, 1382, 1347, 1386, 1346,
+     1338, 1333, 1349, 1350, 1354, 1393, 1394, 1357, 1356, 1355,
+     1409, 1353, 1360, 1367, 1359, 1351, 1362, 1368, 1363, 1365,
+     1366, 1369, 1364, 1372, 1373, 1374, 1419, 1420, 1428, 1370,
+     1425, 1385, 1429, 1433, 1388, 1426, 1381, 1375, 1421, 1437,
+     1438, 1398, 1440, 1453, 1400, 1451, 1458, 1430, 1469, 1402,
+     1455, 1410, 1454, 1412, 1404, 1467, 1422, 1423, 1424, 1432,
+
+     1476, 1442, 1431, 1450, 1441, 1477, 1434, 1452, 1417, 1456,
+     1468, 1457, 1439, 1491, 1503, 1445, 1462, 1496, 1461, 1460,
+     1463, 1475, 1501, 1464, 1465, 1466, 1510, 1459, 1479, 1470,
+     1517, 1528, 1472, 1471, 1473, 1474, 1478, 1480, 1485, 1481,
+     1482, 1535, 1530, 1537, 1484, 1490, 1531, 1489, 1494, 1495,
+     1499, 1542, 1538, 1504, 1487, 1541, 1493, 1497, 1502, 1498,
+     1549, 1500, 1556, 1558, 1505, 1559, 1518, 1552, 1519, 1554,
+     1509, 1520, 1560, 1572, 1573, 1525, 1574, 1532, 1583, 1553,
+     1555, 1575, 1585, 1539, 1526, 1527, 1579, 1533, 1534, 1540,
+     1544, 1545, 1557, 1550, 1551, 1576, 1562, 1595, 1546, 1564,
+
+     1547, 1561, 1565, 1563, 1566, 1567, 1571, 1568, 1577, 1569,
+     1578, 1580, 1570, 1581, 1582, 1584, 1586, 1587, 1588, 1612,
+     1589, 1590, 1591, 1608, 1614, 1593, 1592, 1596, 1597, 1625,
+     1594, 1598, 1599, 1601, 1615, 1603, 1620, 1635, 1600, 1602,
+     1607, 1604, 1626, 1627, 1605, 1630, 1644, 1646, 1616, 1609,
+     1606, 1653, 1621, 1617, 1668, 1610, 1640, 1637, 1645, 1622,
+     1623, 1624, 1664, 1632, 1669, 1670, 1671, 1628, 1631, 1674,
+     1633, 1641, 1675, 1636, 1629, 1642, 1679, 1643, 1649, 1648,
+     1650, 1618, 1652, 1654, 1655, 1658, 1657, 1659, 1662, 1660,
+     1695, 1703, 1656, 1651, 1661, 1705, 1663, 1665, 1666, 1672,
+
+     1712, 1667, 1677, 1680, 1673, 1707, 1676, 1678, 1681, 1682,
+     1683, 1706, 1684, 1687, 1711, 1685, 1688, 1690, 1692, 1686,
+     1696, 1716, 1717, 1689, 1698, 1704, 1697, 1693, 1723, 1731,
+     1721, 1699, 1708, 1713, 1691, 1710, 1701, 1718, 1709, 1715,
+     1719, 1702, 1722, 1720, 1724, 1714, 1725, 1726, 1728, 1727,
+     1729, 1732, 1694, 1733, 1734, 1736, 1735, 1761, 1730, 1737,
+     1739, 1738, 1763, 1740, 1741, 1770, 1774, 1742, 1743, 1745,
+     1779, 1746, 1747, 1744, 1749, 1748, 1784, 1750, 1790, 1800,
+     1752, 1751, 1754, 1797, 1753, 1755, 1756, 1757, 1767, 1762,
+     1771, 1758, 1764, 1765, 1760, 1768, 1813, 1776, 1759, 1824,
+
+     1816, 1766, 1780, 1781, 1769, 1832, 1801, 1809, 1789, 1825,
+     1791, 1793, 1794, 1831, 1792, 1785, 1786, 1788, 1787, 1796,
+     1782, 1840, 1799, 1795, 1798, 1804, 1802, 1805, 1806, 1837,
+     1811, 1803, 1807, 1856, 1814, 1808, 1855, 1810, 1862, 1821,
+     1812, 1820, 1859, 1822, 1815, 1826, 1827, 1817, 1829, 1818,
+     1835, 1823, 1873, 1828, 1833, 1830, 1886, 1834, 1836, 1838,
+     1839, 1841, 1842, 1843, 1884, 1844, 1845, 1887, 1847, 1892,
+     1846, 1850, 1849, 1852, 1854, 1853, 1888, 1865, 1875, 1857,
+     1858, 1904, 1906, 1860, 1913, 1863, 1908, 1868, 1869, 1911,
+     1916, 1866, 1924, 1864, 1867, 1870, 1885, 1880, 1889, 1890,
+
+     1872, 1883, 1893, 1874, 1891, 1933, 1940, 1894, 1936, 1935,
+     1898, 1900, 1895, 1896, 1897, 1939, 1899, 1901, 1905, 1942,
+     1902, 1909, 1903, 1944, 1947, 1948, 1910, 1907, 1912, 1917,
+     1914, 1918, 1915, 1920, 1958, 1919, 1921, 1966, 1922, 1925,
+     1927, 1928, 1923, 1926, 1931, 1968, 1953, 1934, 1929, 1938,
+     1972, 1979, 1930, 1932, 1937, 1941, 1945, 1985, 1986, 1949,
+     1976, 1943, 1982, 1946, 1984, 1950, 1951, 1952, 1954, 1955,
+     1956, 1960, 1999, 1959, 2002, 1961, 2010, 1969, 1962, 1957,
+     1965, 2003, 2018, 1967, 2014, 2016, 2023, 1970, 1973, 2013,
+     2026, 2028, 1971, 1974, 1975, 1981, 1977, 2024, 1983, 2022,
+
+     1978, 2031, 1987, 2033, 2034, 2035, 1996, 1988, 1992, 1997,
+     2012, 2041, 2001, 1994, 2045, 1995, 1998, 1991, 2006, 2015,
+     2000, 2050, 2005, 2017, 2058, 2019, 2008, 2020, 2021, 2009,
+     2004, 2011, 2054, 2007, 2025, 2064, 2060, 2027, 2030, 2068,
+     2075, 2076, 2029, 2032, 2036, 2037, 2071, 2072, 2038, 2073,
+     2081, 2040, 2039, 2082, 2042, 2087, 2046, 2089, 2091, 2097,
+     2047, 2096, 2048, 2099, 2083, 2106, 2059, 2061, 2111, 2051,
+     2052, 2056, 2053, 2055, 2057, 2049, 2118, 2074, 2062, 2063,
+     2077, 2078, 2079, 2080, 2070, 2084, 2120, 2085, 2086, 2129,
+     2088, 2090, 2094, 2092, 2130, 2093, 2095, 2098, 2100, 2133,
+
+     2135, 2125, 2137, 2101, 2102, 2139, 2103, 2105, 2104, 2143,
+     2109, 2145, 2110, 2116, 2136, 2144, 2146, 2107, 2112, 2147,
+     2152, 2113, 2115, 2155, 2158, 2156, 2121, 2119, 2159, 2114,
+     2117, 2170, 2128, 2172, 2132, 2174, 2138, 2126, 2177, 2122,
+     2140, 2141, 2123, 2175, 2142, 2148, 2149, 2150, 2179, 2151,
+     2157, 2154, 2191, 2193, 2188, 2184, 2196, 2199, 2153, 2160,
+     2200, 2201, 2162, 2194, 2161, 2163, 2203, 2165, 2206, 2164,
+     2207, 2205, 2212, 2167, 2166, 2213, 2204, 2173, 2171, 2178,
+     2168, 2181, 2182, 2220, 2176, 2218, 2226, 2227, 2180, 2234,
+     2183, 2185, 2229, 2186, 2187, 2230, 2190, 2237, 2232, 2195,
+
+     2238, 2192, 2241, 2189, 2197, 2198, 2202, 2209, 2242, 2239,
+     2251, 2244, 2256, 2257, 2211, 2208, 2250, 2262, 2210, 2214,
+     2263, 2215, 2216, 2259, 2217, 2269, 2219, 2223, 2266, 2221,
+     2224, 2273, 2222, 2228, 2225, 2231, 2233, 2236, 2235, 2240,
+     2245, 2275, 2270, 2246, 2274, 2285, 2276, 2247, 2248, 2243,
+     2280, 2249, 2253, 2254, 2255, 2283, 2258, 2294, 2252, 2298,
+     2260, 2299, 2261, 2265, 2304, 2301, 2264, 2267, 2271, 2308,
+     2277, 2268, 2282, 2309, 2272, 2278, 2312, 2284, 2279, 2302,
+     2281, 2287, 2286, 2311, 2289, 2288, 2290, 2291, 2292, 2313,
+     2300, 2314, 2293, 2303, 2295, 2305, 2297, 2315, 2317, 2319,
+
+     2320, 2307, 2306, 2310, 2318, 2321, 2327, 2323, 2316, 2322,
+     2338, 2328, 2324, 2325, 2329, 2330, 2341, 2326, 2352, 2331,
+     2347, 2355,    1
     } ;
 
-static const flex_int16_t yy_def[1178] =
+static const flex_int16_t yy_def[1224] =
     {   0,
-     1166, 1166, 1167, 1167, 1166, 1166, 1166, 1166, 1166, 1166,
-     1165, 1165, 1165, 1165, 1165, 1168, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1169,
-     1165, 1165, 1165, 1170,   15, 1165,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1171,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1168, 1165,
-     1165, 1165, 1165, 1165, 1165, 1172, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1169, 1165, 1170,
-
-     1165, 1165,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1173,   45, 1171,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1172, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1174,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1173,
-     1165, 1171,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1165,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1175,
-       45,   45,   45,   45,   45,   45,   45, 1165,   45, 1165,
-       45, 1171,   45,   45,   45,   45,   45,   45,   45,   45,
-     1165,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1165,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1165,
-       45,   45,   45, 1165, 1165, 1165, 1176,   45,   45,   45,
-       45,   45,   45,   45, 1165,   45,   45, 1165,   45, 1171,
-       45,   45,   45,   45,   45, 1165,   45,   45,   45,   45,
-     1165,   45,   45,   45,   45, 1165,   45,   45,   45,   45,
-       45,   45,   45,   45, 1165,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1165,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1165,   45, 1165,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1165, 1165,   45, 1165,   45,   45, 1165, 1177,   45,
-       45,   45, 1165, 1165,   45, 1165,   45, 1165,   45,   45,
-       45, 1165,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1165,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45, 1165,   45,   45,
-       45,   45,   45,   45,   45, 1165,   45,   45,   45,   45,
-       45,   45,   45, 1165,   45,   45,   45,   45, 1165,   45,
-       45, 1165,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1165,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1165,   45,   45,   45,
-
-       45,   45,   45,   45, 1165,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1165, 1165,
-       45,   45,   45, 1165,   45,   45,   45,   45,   45,   45,
-       45,   45, 1165,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1165,   45,   45,   45,   45,   45, 1165,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45, 1165,   45,   45,   45,   45, 1165,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1165,   45,   45,   45, 1165,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1165,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1165,   45,   45,   45,   45,   45,   45, 1165,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1165,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-     1165,   45,   45, 1165,   45,   45,   45,   45,   45,   45,
-       45, 1165,   45,   45,   45,   45, 1165,   45,   45,   45,
-       45, 1165, 1165,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1165,   45, 1165,   45,
-     1165,   45,   45,   45,   45,   45, 1165,   45,   45,   45,
-     1165,   45,   45,   45, 1165, 1165,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1165,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45, 1165, 1165,   45,   45,   45,   45,   45,   45,
-       45,   45, 1165,   45,   45,   45, 1165,   45, 1165, 1165,
-     1165,   45,   45,   45,   45,   45, 1165,   45,   45, 1165,
-       45,   45,   45,   45,   45,   45, 1165,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1165,   45,   45, 1165,
-       45,   45,   45,   45, 1165,   45,   45,   45,   45, 1165,
-     1165,   45, 1165,   45,   45, 1165,   45,   45, 1165,   45,
-     1165,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1165,
-     1165,   45, 1165, 1165,   45,   45, 1165, 1165,   45,   45,
-       45,   45,   45,   45, 1165,   45, 1165,   45, 1165,   45,
-       45, 1165,   45,   45,   45,   45,   45,   45,   45,   45,
-     1165,   45,   45,   45, 1165,   45,   45,   45,   45,   45,
-       45, 1165,   45,   45, 1165,   45,   45,   45,   45,   45,
-       45,   45,   45, 1165,   45, 1165, 1165,   45,   45, 1165,
-       45,   45, 1165,   45,   45,   45,   45, 1165,   45,   45,
-       45,   45,   45, 1165,   45,   45,   45,   45,   45,   45,
-       45, 1165,   45,   45,   45, 1165,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45, 1165,   45, 1165,   45,   45,
-       45, 1165,   45,   45,   45, 1165,   45,   45,   45, 1165,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1165,
-       45,   45,   45,   45,   45,   45, 1165, 1165, 1165,   45,
-       45,   45, 1165,   45,   45,   45,   45,   45,   45,   45,
-     1165,   45,   45, 1165,    0, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165
+     1223,    1,    1,    3,    1,    5,    1,    7,    1,    9,
+     1223, 1223,   12,   12,    1,   12,   12,   12,   17,   17,
+       12,   19,   12,   12,   12,   12,   12,   12,   12,   12,
+       26,   27,   28,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   13,   14,   15,   15,   12,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   58,   55,   55,
+       55,   55,   60,   55,   55,   55,   55,   55,   55,   63,
+       55,   55,   55,   55,   55,   64,   65,   55,   16,   20,
+       17,   25,   19,   12,   21,   12,   25,   97,   12,   12,
+
+       12,   99,  100,  101,   37,   38,   12,   41,   42,   12,
+       45,   46,   47,   49,   50,   12,   12,   12,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   67,
+       55,  130,  120,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,  125,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,  128,   55,   55,   55,   12,   12,   12,  186,  187,
+      188,   12,   12,   12,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   12,  132,  196,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+       12,   12,  280,   12,   12,   12,   12,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   12,   55,  132,  289,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   12,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   12,   55,
+       55,   55,   12,   12,   12,   12,   55,   55,   55,   55,
+       55,   55,   55,   12,   55,   55,   12,   55,  132,  379,
+       55,   55,   55,   55,   55,   12,   55,   55,   55,   55,
+
+       12,   55,   55,   55,   55,   12,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   12,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   12,   55,   12,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   12,   55,   12,   55,   55,   12,   12,
+       55,   55,   55,   12,   12,   55,   12,   55,   12,   55,
+       55,  473,   12,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   12,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   12,   55,   55,   12,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       12,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   12,   55,   55,   55,   55,   55,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   12,   12,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+
+       55,   55,   55,   55,   55,   12,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   12,   55,   55,   55,   55,   12,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   12,   55,   55,
+       55,   55,   55,   55,   55,   12,   55,   55,   55,   55,
+       12,   12,   55,   55,   55,   55,   55,   12,   12,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   12,   55,   12,   55,   55,   55,
+       55,   55,   12,   55,   55,   55,   12,   55,   55,   55,
+       12,   12,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       12,   12,   55,   55,   55,   55,   55,   55,   55,   55,
+       12,   55,   55,   55,   55,   12,   55,   12,   12,   12,
+       55,   55,   55,   55,   55,   12,   55,   55,   12,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   12,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   12,
+
+       12,   55,   12,   55,   55,   12,   55,   55,   55,   12,
+       55,   12,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   12,   55,   55,   12,   12,   55,   55,
+       12,   12,   55,   55,   55,   55,   55,   55,   12,   55,
+       12,   55,   12,   55,   55,   12,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   12,   55,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   12,   55,   55,
+
+       12,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       12,   55,   12,   12,   55,   55,   55,   12,   55,   55,
+       12,   55,   55,   55,   55,   12,   55,   55,   55,   55,
+       55,   12,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   12,   55,   55,   55,   12,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   12,   55,   12,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   12,
+       55,   55,   55,   12,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   12,   55,   55,   55,   55,   55,   12,   55,   55,
+
+       55,   55,   55,   55,   12,   12,   12,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   55,   55,   12,   55,
+       55,   12,    0
     } ;
 
-static const flex_int16_t yy_nxt[1600] =
+static const flex_int16_t yy_nxt[2426] =
     {   0,
-     1165,   13,   14,   13, 1165,   15,   16, 1165,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   85,  597,
-       37,   14,   37,   86,   25,   26,   38, 1165,  598,   27,
-       37,   14,   37,   42,   28,   42,   38,   91,   92,   29,
-      113,   30,   13,   14,   13,   90,   91,   25,   31,   92,
-       13,   14,   13,   13,   14,   13,   32,   40,  782,   13,
-       14,   13,   33,   40,  113,   91,   92,  783,   90,   34,
-       35,   13,   14,   13,   94,   15,   16,   95,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  107,   39,   90,   25,   26,   13,   14,   13,   27,
-
-       39,   84,   84,   84,   28,   42,   41,   42,   42,   29,
-       42,   30,   82,  106,   41,  109,   93,   25,   31,  107,
-      198,  157,   88,  134,   88,  158,   32,   89,   89,   89,
-      199,  135,   33,  203,  204,   82,  106,  784,  109,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
-       45,   45,   45,   45,   45,   47,   45,   45,   45,   45,
-       45,   48,   45,   45,   49,   45,   50,   45,   51,   52,
-       53,   45,   45,   45,   45,   54,   55,   45,   56,   45,
-       45,   57,   45,   45,   58,   59,   60,   61,   62,   63,
-       64,   65,   66,   51,   67,   68,   69,   70,   71,   72,
-
-       73,   74,   75,   76,   77,   78,   56,   45,   45,   45,
-       45,   45,   80,  104,   81,   81,   81,   80,  104,   83,
-       83,   83,  101,  112,   80,   82,   83,   83,   83,  125,
-       82,  110,  120,  126,  129,  121,  127,   82,  122,  104,
-      123,  111,  124,  106,  117,  130,  112,  144,   82,  128,
-      118,  145,  136,   82,  110,  131,  208,  102,  209,  153,
-       82,   45,  137,  154,  138,  336,  106,   45,  337,  111,
-       45,  146,   45,  155,   45,   45,   45,  132,  115,  140,
-      141,   45,   45,  142,   45,   45,   89,   89,   89,  143,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,  150,  159,  101,   45,  109,  151,
-      152,   45,  110,  112,  172,  160,  161,  785,  170,   45,
-      358,  162,  111,   45,  172,   45,  116,  147,  786,  148,
-      359,  149,   84,   84,   84,  110,  165,  163,   89,   89,
-       89,  102,  172,   82,  170,   80,  166,   81,   81,   81,
-      111,  167,  175,  171,   88,  180,   88,  164,   82,   89,
-       89,   89,   84,   84,   84,   80,   82,   83,   83,   83,
-      100,  170,  171,   82,  182,  183,  185,  100,   82,  171,
-      186,   82,  187,  180,  188,  189,  180,  213,  225,  185,
-
-      214,  384,  226,  413,  215,  385,   82,  173,  174,  242,
-      182,   82,  183,  414,  185,  100,  243,  186,  189,  100,
-      187,  188,  265,  100,  193,  235,  236,  185,  251,  231,
-      238,  100,  252,  239,  240,  100,  253,  100,  178,  192,
-      192,  192,  244,  245,  246,  265,  192,  192,  192,  192,
-      192,  192,  188,  247,  263,  248,  275,  249,  264,  263,
-      250,  787,  264,  265,  274,  367,  272,  277,  279,  192,
-      192,  192,  192,  192,  192,  281,  272,  360,  354,  259,
-      360,  378,  263,  275,  264,  354,  268,  266,  267,  272,
-      277,  279,  274,  367,  289,  364,  408,  409,  379,  283,
-
-      290,  354,  281,  282,  282,  282,  360,  422,  355,  371,
-      282,  282,  282,  282,  282,  282,  361,  362,  364,  607,
-      788,  445,  748,  791,  395,  363,  446,  452,  452,  396,
-      459,  577,  460,  282,  282,  282,  282,  282,  282,  370,
-      370,  370,  607,  472,  792,  748,  370,  370,  370,  370,
-      370,  370,  535,  789,  664,  452,  461,  459,  473,  460,
-      532,  665,  793,  423,  790,  537,  536,  606,  578,  370,
-      370,  370,  370,  370,  370,  397,  747,  794,  611,  535,
-      398,   45,   45,   45,  612,  795,  796,  797,   45,   45,
-       45,   45,   45,   45,  536,  606,  666,  667,  680,  670,
-
-      798,  799,  718,  747,  668,  671,  719,  800,  801,  802,
-      803,   45,   45,   45,   45,   45,   45,  774,  804,  805,
-      806,  807,  775,  808,  809,  810,  680,  811,  812,  813,
-      815,  814,  816,  817,  818,  819,  820,  821,  822,  823,
-      824,  825,  826,  827,  828,  829,  830,  831,  832,  833,
-      834,  835,  836,  837,  838,  839,  841,  813,  814,  842,
-      840,  843,  844,  845,  846,  847,  848,  849,  850,  851,
-      852,  853,  854,  776,  855,  856,  857,  858,  859,  860,
-      861,  862,  863,  864,  865,  866,  867,  868,  869,  870,
-      871,  872,  873,  874,  875,  876,  877,  878,  879,  880,
-
-      881,  882,  883,  884,  885,  886,  887,  888,  889,  890,
-      891,  892,  893,  894,  895,  896,  874,  897,  898,  899,
-      900,  901,  875,  902,  903,  904,  905,  906,  907,  908,
-      909,  910,  911,  912,  913,  914,  915,  917,  918,  919,
-      920,  921,  922,  923,  924,  925,  926,  927,  928,  929,
-      930,  932,  933,  934,  935,  936,  937,  938,  939,  940,
-      941,  942,  943,  944,  945,  946,  947,  948,  949,  950,
-      951,  952,  953,  955,  926,  956,  957,  958,  959,  960,
-      954,  961,  962,  963,  964,  965,  966,  916,  967,  968,
-      969,  970,  931,  971,  973,  974,  975,  976,  972,  977,
-
-      978,  979,  980,  981,  982,  983,  984,  985,  986,  987,
-      988,  989,  990,  991,  992,  993,  994,  973,  995,  996,
-      997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
-     1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016,
-     1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026,
-     1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1008, 1035,
-     1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1045,
-     1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054, 1055,
-     1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063, 1064, 1065,
-     1066, 1067, 1068, 1069, 1070, 1043, 1071, 1072, 1073, 1074,
-
-     1075, 1076, 1077, 1078, 1079, 1080, 1081, 1082, 1083, 1084,
-     1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093, 1094,
-     1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103, 1104,
-     1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114,
-     1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123, 1124,
-     1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133, 1134,
-     1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143, 1144,
-     1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154,
-     1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
-       12,   12,   12,   12,   12,   36,   36,   36,   36,   36,
-
-       79,  270,   79,   79,   79,   98,  357,   98,  449,   98,
-      100,  100,  100,  100,  100,  114,  114,  114,  114,  114,
-      169,  100,  169,  169,  169,  190,  190,  190,  781,  780,
-      779,  778,  777,  773,  772,  771,  770,  769,  768,  767,
-      766,  765,  764,  763,  762,  761,  760,  759,  758,  757,
-      756,  755,  754,  753,  752,  751,  750,  749,  746,  745,
-      744,  743,  742,  741,  740,  739,  738,  737,  736,  735,
-      734,  733,  732,  731,  730,  729,  728,  727,  726,  725,
-      724,  723,  722,  721,  720,  717,  716,  715,  714,  713,
-      712,  711,  710,  709,  708,  707,  706,  705,  704,  703,
-
-      702,  701,  700,  699,  698,  697,  696,  695,  694,  693,
-      692,  691,  690,  689,  688,  687,  686,  685,  684,  683,
-      682,  681,  679,  678,  677,  676,  675,  674,  673,  672,
-      669,  663,  662,  661,  660,  659,  658,  657,  656,  655,
-      654,  653,  652,  651,  650,  649,  648,  647,  646,  645,
-      644,  643,  642,  641,  640,  639,  638,  637,  636,  635,
-      634,  633,  632,  631,  630,  629,  628,  627,  626,  625,
-      624,  623,  622,  621,  620,  619,  618,  617,  616,  615,
-      614,  613,  610,  609,  608,  605,  604,  603,  602,  601,
-      600,  599,  596,  595,  594,  593,  592,  591,  590,  589,
-
-      588,  587,  586,  585,  584,  583,  582,  581,  580,  579,
-      576,  575,  574,  573,  572,  571,  570,  569,  568,  567,
-      566,  565,  564,  563,  562,  561,  560,  559,  558,  557,
-      556,  555,  554,  553,  552,  551,  550,  549,  548,  547,
-      546,  545,  544,  543,  542,  541,  540,  539,  538,  534,
-      533,  532,  531,  530,  529,  528,  527,  526,  525,  524,
-      523,  522,  521,  520,  519,  518,  517,  516,  515,  514,
-      513,  512,  511,  510,  509,  508,  507,  506,  505,  504,
-      503,  502,  501,  500,  499,  498,  497,  496,  495,  494,
-      493,  492,  491,  490,  489,  488,  487,  486,  485,  484,
-
-      483,  482,  481,  480,  479,  478,  477,  476,  475,  474,
-      471,  470,  469,  468,  467,  466,  465,  464,  463,  462,
-      458,  457,  456,  455,  454,  453,  451,  450,  448,  447,
-      444,  443,  442,  441,  440,  439,  438,  437,  436,  435,
-      434,  433,  432,  431,  430,  429,  428,  427,  426,  425,
-      424,  421,  420,  419,  418,  417,  416,  415,  412,  411,
-      410,  407,  406,  405,  404,  403,  402,  401,  400,  399,
-      394,  393,  392,  391,  390,  389,  388,  387,  386,  383,
-      382,  381,  380,  377,  376,  375,  374,  373,  372,  369,
-      368,  366,  365,  356,  353,  352,  351,  350,  349,  348,
-
-      347,  346,  345,  344,  343,  342,  341,  340,  339,  338,
-      335,  334,  333,  332,  331,  330,  329,  328,  327,  326,
-      325,  324,  323,  322,  321,  320,  319,  318,  317,  316,
-      315,  314,  313,  312,  311,  310,  309,  308,  307,  306,
-      305,  304,  303,  302,  301,  300,  299,  298,  297,  296,
-      295,  294,  293,  292,  291,  288,  287,  286,  285,  284,
-      191,  280,  278,  276,  273,  271,  269,  262,  261,  260,
-      258,  257,  256,  255,  254,  241,  237,  234,  233,  232,
-      230,  229,  228,  227,  224,  223,  222,  221,  220,  219,
-      218,  217,  216,  212,  211,  210,  207,  206,  205,  202,
-
-      201,  200,  197,  196,  195,  194,  191,  184,  181,  179,
-      177,  176,  168,  156,  139,  133,  119,  108,  105,  103,
-       43,   99,   97,   96,   87,   43, 1165,   11, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223,   11,   12,   13,   14,   13,   12,   15,   16,   12,
+       17,   18,   19,   20,   21,   22,   22,   22,   23,   24,
+       12,   12,   12,   12,   12,   12,   25,   26,   12,   12,
+
+       12,   27,   12,   12,   12,   12,   28,   12,   12,   12,
+       12,   29,   12,   30,   12,   12,   12,   12,   12,   25,
+       31,   12,   12,   12,   12,   12,   12,   32,   12,   12,
+       12,   12,   12,   33,   12,   12,   12,   12,   12,   12,
+       34,   35,   11,   53,   36,   37,   38,   37,   36,   36,
+       36,   39,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   11,   96,   40,   41,   42,   41,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   43,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   11,  102,   44,   45,
+       46,   45,   44,   47,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   11,  103,
+       48,   49,   50,   49,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   51,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       11, 1223,   11,  104,   11,   52,   11,   52,   54,   54,
+       54,   55,   55,   56,   55,   55,   55,   55,   55,   55,
+       55,   55,   57,   55,   55,   55,   55,   55,   58,   55,
+       55,   59,   55,   60,   55,   61,   62,   63,   55,   55,
+       55,   55,   64,   65,   55,   66,   55,   55,   67,   55,
+       55,   68,   69,   70,   71,   72,   73,   74,   75,   76,
+       77,   78,   79,   80,   81,   82,   83,   84,   85,   86,
+
+       87,   88,   66,   55,   55,   55,   55,   55,   89,   89,
+       11,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   89,   89,
+       89,   89,   89,   89,   89,   89,   89,   89,   90,   99,
+       91,   91,   91,   93,   93,   93, 1223,   94,   90,   90,
+       90,   92,   95,   97,  101,   97,  100,   11,   98,   98,
+
+       98,   11,   99,   11,   11,   11,  107,   11,  105,  110,
+      105,  106,  109,  108,   92,  108,   11,  111,   11,  111,
+      112,  101,  115,  100,  113,  113,   11,  113,  113,  116,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  113,  113,  113,  113,  113,  113,
+      113,  113,  113,  113,  114,   11,  114,   54,   54,  117,
+
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,  118,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   55,   11,  119,  120,  121,  124,
+       55,  135,  149,   55,  133,   55,  150,   55,   55,   55,
+      134,  156,  151,  185,   55,   55,  173,   55,  189,  123,
+      152,   11,  120,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,  122,  123,  125,  126,  136,
+      128,  164,   11,  165,  129,  166,  142,  137,  127,  138,
+      143,   11,  139,  144,  140,  153,  141,   11,  122,   11,
+      125,  126,   11,  128,  154,  145,  155,  167,  129,  180,
+      174,   11,  168,  169,  175,  127,  130,  130,  130,  130,
+      130,  131,  130,  130,  130,  130,  130,  130,  181,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,   55,  130,  130,  130,
+
+       11,  130,  130,  130,  188,  130,  130,  130,  130,  130,
+      130,  161,  130,  130,  130,  162,  130,  146,  132,  130,
+      130,  130,  130,  130,  130,  130,  190,  147,  170,  157,
+      158,  188,  171,  159,  163,  176,  191,  148,  160,  182,
+     1223,  172, 1223,   11,  177,  178,   11,   11,  183,   11,
+      179,   95,   95,  184,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   11,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,  186,  187,  192,   11,   11,  193,   11,   11,   11,
+       11,  195,   54,  196,  197,  200,  198,  199,  201,   54,
+      202,  203,   11,  204,  208,  211,  186,  187,  210,  209,
+     1223, 1223, 1223,  223,  212,  206,  205,  216,  218,  221,
+      196,  198,  130,  199,  213,  201,  202,   54,  203,  204,
+      222,   54,  226,  217,  232,   54,  233,  219,  220,  205,
+      227,  234,   54,  214,  235,  224,   54,  225,   54,  194,
+      130,  228,  215,  229,  130,  237,  230,  239,  130,  238,
+
+      231,  130,  130,  130,  236,  130,  130,  240,  244,  130,
+      243,  130,  130,  245,  207,  207,  207,  250,  248,  246,
+      247,  207,  207,  207,  207,  207,  207,  241,  249,  257,
+      271,  242,  251,  252,  253,  254,  273,  272,  255,  256,
+      274,  260,  261,  262,  207,  207,  207,  207,  207,  207,
+      258,  263,  275,  264,  276,  265,  278,  259,  266,  268,
+      267,  279,  280,  269,  277,  281,  283,  270,  282,  284,
+      285,  286,   11,  287,  287,  287,  288,  289,  290,  293,
+      287,  287,  287,  287,  287,  287,  291,  294,  292,  280,
+      281,  282,  295,  296,  297,   11,  298,  300,  301,  302,
+
+      289,  303,  309,  287,  287,  287,  287,  287,  287,  304,
+      294,  310,  305,  291,  292,  306,  296,  299,  299,  299,
+      311,  319,  298,  312,  299,  299,  299,  299,  299,  299,
+      307,  313,  315,  314,  317,  316,  308,  318,  321,  322,
+      320,  325,  324,   11,  323,  327,  326,  299,  299,  299,
+      299,  299,  299,  330,  332,  328,  333,  334,  335,  337,
+      329,  338,  331,  343,  336,  340,  341,  342,  339,  346,
+      351,  352,  349,  344,  350,  345,  356,  353,  347,  348,
+      354,  357,  358,  355,  359,  361,  365,  362,  360,  363,
+      364,  366,  367,  368,  369,  370,  372,  373,   11,  371,
+
+       11,  374,   11,   11,  376,  376,  376,  384,  377,  383,
+      375,  376,  376,  376,  376,  376,  376,  378,  379,  385,
+      373,  380,  381,   11,  386,  387,   11,  388,  390,  391,
+      382,  392,  383,  393,  376,  376,  376,  376,  376,  376,
+      394,  396,  395,  397,   11,  400,  379,  389,  389,  389,
+      407,  386,  398,  401,  389,  389,  389,  389,  389,  389,
+      402,  403,  404,  406,  410,  408,  405,  412,  399,  411,
+      409,  413,  419,  424,  414,  420,  421,  389,  389,  389,
+      389,  389,  389,  415,  423,  422,  425,  432,  416,  426,
+      430,  427,  438,  428,  429,  433,  435,  431,  442,  444,
+
+      437,  447,  436,  439,  434,  441,  445,  446,   11,  448,
+      450,  454,  456,  457,  440,  449,  458,  452,  451,  460,
+      461,  462,  455,  459,  463,  464,  453,   11,   11,  465,
+      466,  468,   11,  417,  469,  467,  471,  472,  418,  470,
+      470,  470,  474,  475,  476,  477,  470,  470,  470,  470,
+      470,  470,   11,  443,  473,  478,  479,   11,  484,  480,
+      483,  481,  482,  486,  485,  487,   11,  488,  489,  470,
+      470,  470,  470,  470,  470,   11,   11,  499,  501,  497,
+      490,  473,   55,   55,   55,  480,  493,  481,  491,   55,
+       55,   55,   55,   55,   55,  492,  494,  496,  503,  498,
+
+      502,  504,   11,  500,  505,  506,  507,  508,  509,  510,
+      495,  512,   55,   55,   55,   55,   55,   55,  511,  513,
+      516,  517,  520,  519,  514,  515,  518,   11,  521,  524,
+      522,  526,  527,  523,   11,  530,   11,  528,  532,  525,
+      535,  533,  529,  531,  534,  537,  536,  538,  539,  540,
+      541,  542,  543,  545,  547,   11,  544,   11,   11,  546,
+      549,  548,  551,  550,  554,  555,  552,   54,   54,   54,
+      553,   11,   11,   11,   54,   54,   54,   54,   54,   54,
+      556,  557,   11,  558,   11,  560,  562,  559,  563,  564,
+      561,  573,  569,  567,  565,  566,  571,   54,   54,   54,
+
+       54,   54,   54,  568,  570,  575,  578,  572,  576,  558,
+      577,   11,  580,  582,  559,  574,  581,  584,  600,  601,
+      586,  583,  579,  588,   11,  611,  589,  585,  587,  593,
+      613,  590,  595,  594,   11,  596,  618,  619,  599,  603,
+      621,  607,  592,   11,  609,  630,  598,  591,  597,  615,
+      616,  622,   11,  604,  610,  605,  602,  612,  606,  626,
+      623,  614,  617,  624,  608,  625,  620,   11,  627,  632,
+      629,  631,  628,  633,  636,  635,  634,  637,  657,  639,
+      641,  642,  643,  638,  645,  648,  647,  649,  646,  652,
+      653,  650,  632,  655,  644,  651,  654,  659,  631,  658,
+
+      666,  656,  660,  661,  662,  664,  663,  665,  667,  668,
+      671,   11,  680,  669,  670,   11,  686,  672,  675,  679,
+      640,  689,  700,  676,  677,  674,  673,  678,  706,  682,
+       11,  707,  708,    0,    0,  701,  681,  683,  688,  729,
+      705,  692,  694,  695,  685,  687,  690,  693,  684,  696,
+      691,  698,  697,  702,  713,  703,  704,  699,  711,  708,
+      710,  712,  718,  709,  714,  719,  734,  720,  739,   11,
+      715,  716,  727,   11,  722,  725,  717,  723,   11,  730,
+      732,  721,  733,  724,  726,  728,  737,  731,  744,  745,
+      743,  735,  748,  742,  751,  753,  749,  736,  738,   11,
+
+      741,  740,  757,  746,  758,  750,  755,  747,  756,  752,
+      754,  761,  762,  763,  764,  765,  759,  768,  770,  771,
+      766,  767,  760,   11,  769,  772,  773,  774,  775,  776,
+      777,   11,  778,  779,  780,  781,  785,  784,  782,  783,
+      787,  792,  788,  786,  789,  793,  794,  801,  790,  791,
+      797,  795,  799,  796,  802,   11,  779,  805,  778,  800,
+      807,   11,  803,  798,  811,  808,  804,  813,  806,  814,
+      810,  817,   11,  815,  818,  812,  816,  820,  819,  821,
+      822,  825,  826,  824,  827,   11,  831,  829,  828,  835,
+      823,   11,  838,  846,  832,  830,  845,  847,  833,  843,
+
+      840,  844,  834,  836,  848,  837,  839,  841,  842,  851,
+      849,  852,   11,  850,  857,  809,  858,  854,  855,  856,
+      853,  859,  860,   11,  847,  861,  862,  865,  864,  868,
+      848,  863,  866,  867,  869,  872,  870,  871,  873,   11,
+      877,  875,  878,  879,  883,  874,  876,  887,  886,  891,
+      880,  882,  892,  888,  895,  884,  881,   11,  893,  890,
+      885,  894,  889,  901,  897,   11,  896,   11,  912,  899,
+      900,   11,  905,  898,  906,  907,  910,  911,   11,  916,
+      902,  914,  903,  904,   11,   11,  921,  909,  908,  925,
+      915,  913,  923,  920,  917,  912,  918,  919,   11,  931,
+
+      911,   11,  927,  932,  922,  933,  934,  924,  929,   11,
+      926,  928,  935,  939,  930,  936,  938,   11,  937,  941,
+      940,  942,   11,  945,  944,   11,  943,   11,  949,  951,
+      952,  946,  953,  955,  948,  947,  956,  950,  958,  959,
+      960,  961,  957,  963,  964,  965,  966,  967,  968,  962,
+      969,  971,  973,  974,  972,  977,  978,   11,  975,  987,
+      984,  976,  981,  988,  979,  985,  980,  982,  983,  990,
+      991,  986,  965,  995,   11,   11, 1000, 1001, 1003,  997,
+       11,    0,  954,  993,  996,  989,   11, 1006,   11, 1008,
+       11,  994,  970, 1005,  992, 1004,   11, 1002,  998,  999,
+
+     1009, 1010, 1011, 1007, 1012,   11, 1015, 1014, 1016, 1013,
+       11, 1017, 1019, 1020, 1018, 1023, 1021,   11, 1022,   11,
+     1024, 1031, 1025, 1026, 1027, 1029, 1028, 1030,   11,   11,
+     1014, 1032,   11, 1034,   11, 1043,   11, 1036,   11, 1035,
+     1033, 1037,   11, 1038,   11, 1051, 1052, 1048, 1042, 1053,
+     1040, 1054, 1057, 1039, 1046, 1041, 1049, 1058, 1045, 1047,
+     1061, 1050, 1044, 1062, 1059, 1056, 1063, 1064, 1055, 1066,
+     1065, 1051, 1060, 1068, 1067, 1069, 1070, 1071, 1072, 1073,
+     1075, 1074, 1076, 1077, 1086, 1081, 1078, 1080, 1082, 1079,
+       11, 1088,   11, 1090, 1091,   11, 1084, 1087,   11,   11,
+
+       11, 1085, 1089, 1083, 1095,   11,   11, 1093, 1098, 1092,
+     1101,   11,   11, 1103, 1104, 1100, 1105,   11, 1088, 1094,
+     1099, 1107, 1106, 1108, 1097, 1111, 1096, 1102, 1109, 1110,
+     1112, 1113, 1114,   11, 1118, 1121,   11,   11, 1115, 1125,
+     1117, 1122, 1123, 1116, 1124, 1119, 1126, 1132, 1120, 1133,
+       11, 1127, 1131, 1130, 1134,   11,   11, 1135, 1128, 1136,
+     1137,   11,   11, 1129, 1142, 1139, 1138, 1141,   11, 1140,
+     1145, 1146,   11, 1150,   11, 1158, 1144, 1143, 1148, 1160,
+     1151, 1154, 1147, 1149,   11, 1165, 1161, 1156, 1170, 1155,
+     1153, 1157, 1159,   11, 1162, 1172, 1166,   11, 1152, 1163,
+
+     1167, 1168, 1169,   11, 1174, 1171, 1177,   11,   11, 1164,
+     1176,   11, 1188,   11,   11, 1175, 1192,   11, 1198, 1184,
+       11, 1173, 1205, 1178, 1206, 1207,   11, 1179, 1211, 1182,
+     1180, 1185, 1181, 1183, 1190, 1186, 1193,   11, 1214, 1187,
+     1191, 1195, 1189, 1197, 1194, 1204, 1219, 1199, 1203, 1201,
+     1202,   11, 1222, 1200,   11, 1196, 1208, 1209,    0,    0,
+        0, 1210,    0,    0,    0,    0,    0,    0,    0, 1213,
+        0,    0,    0,    0,    0,    0,    0, 1212, 1221,    0,
+     1220, 1218,    0, 1215,    0,    0, 1216,    0,    0, 1217,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0
     } ;
 
-static const flex_int16_t yy_chk[1600] =
+static const flex_int16_t yy_chk[2426] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,  525,
-        3,    3,    3,   21,    1,    1,    3,    0,  525,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       56,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  714,    8,
-        8,    8,    1,    8,   56,   27,   28,  715,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   51,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   50,   10,   53,   31,    2,    2,   51,
-      122,   74,   25,   65,   25,   74,    2,   25,   25,   25,
-      122,   65,    2,  126,  126,   20,   50,  716,   53,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223, 1223,
+     1223,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    2,   14,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    4,   24,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    6,   31,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    8,   32,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       10,   11,   12,   33,   18,   13,   22,   13,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   48,   17,   17,   17,   19,   58,   19,
-       19,   19,   44,   55,   22,   17,   22,   22,   22,   61,
-       19,   54,   60,   61,   62,   60,   61,   22,   60,   48,
-       60,   54,   60,   63,   58,   62,   55,   69,   17,   61,
-       58,   69,   66,   19,   54,   62,  130,   44,  130,   72,
-       22,   45,   66,   72,   66,  246,   63,   45,  246,   54,
-       45,   69,   45,   72,   45,   45,   45,   63,   57,   68,
-       68,   45,   45,   68,   45,   57,   88,   88,   88,   68,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   57,   71,   75,  100,   57,   70,   71,
-       71,   57,   76,   77,   92,   75,   75,  717,   90,   57,
-      271,   75,   76,   57,   95,   57,   57,   70,  718,   70,
-      271,   70,   80,   80,   80,   76,   77,   76,   89,   89,
-       89,  100,   92,   80,   90,   81,   77,   81,   81,   81,
-       76,   77,   95,   91,   82,  104,   82,   76,   81,   82,
-       82,   82,   84,   84,   84,   83,   80,   83,   83,   83,
-      102,   93,   94,   84,  106,  107,  109,  102,   83,   91,
-      110,   81,  111,  104,  112,  113,  117,  134,  144,  149,
-
-      134,  296,  144,  320,  134,  296,   84,   93,   94,  157,
-      106,   83,  107,  320,  109,  102,  157,  110,  113,  102,
-      111,  112,  172,  102,  117,  153,  153,  149,  159,  149,
-      155,  102,  159,  155,  155,  102,  159,  102,  102,  116,
-      116,  116,  158,  158,  158,  172,  116,  116,  116,  116,
-      116,  116,  165,  158,  170,  158,  183,  158,  171,  173,
-      158,  719,  174,  175,  182,  277,  180,  185,  187,  116,
-      116,  116,  116,  116,  116,  189,  193,  272,  263,  165,
-      283,  290,  170,  183,  171,  266,  175,  173,  174,  180,
-      185,  187,  182,  277,  199,  274,  316,  316,  290,  193,
-
-      199,  263,  189,  192,  192,  192,  272,  328,  266,  283,
-      192,  192,  192,  192,  192,  192,  273,  273,  274,  536,
-      720,  352,  680,  722,  306,  273,  352,  360,  371,  306,
-      369,  503,  369,  192,  192,  192,  192,  192,  192,  282,
-      282,  282,  536,  384,  724,  680,  282,  282,  282,  282,
-      282,  282,  459,  721,  593,  360,  371,  369,  384,  369,
-      461,  593,  725,  328,  721,  461,  460,  535,  503,  282,
-      282,  282,  282,  282,  282,  306,  679,  726,  540,  459,
-      306,  370,  370,  370,  540,  728,  729,  730,  370,  370,
-      370,  370,  370,  370,  460,  535,  594,  594,  607,  596,
-
-      731,  732,  648,  679,  594,  596,  648,  733,  734,  735,
-      736,  370,  370,  370,  370,  370,  370,  707,  737,  738,
-      740,  741,  707,  742,  743,  744,  607,  745,  746,  747,
-      749,  748,  750,  751,  752,  754,  755,  756,  757,  758,
-      759,  761,  762,  763,  764,  765,  766,  767,  768,  769,
-      770,  771,  772,  773,  775,  776,  777,  747,  748,  778,
-      776,  779,  780,  781,  782,  783,  784,  785,  786,  787,
-      788,  789,  790,  707,  791,  792,  793,  794,  795,  796,
-      797,  798,  799,  800,  802,  803,  805,  806,  807,  808,
-      809,  810,  811,  813,  814,  815,  816,  818,  819,  820,
-
-      821,  824,  825,  826,  827,  828,  829,  830,  831,  832,
-      833,  834,  835,  836,  838,  840,  813,  842,  843,  844,
-      845,  846,  814,  848,  849,  850,  852,  853,  854,  857,
-      858,  859,  860,  861,  862,  863,  864,  865,  866,  867,
-      868,  869,  870,  871,  872,  873,  874,  875,  876,  877,
-      878,  879,  880,  881,  882,  883,  884,  885,  886,  888,
-      889,  890,  891,  892,  893,  894,  895,  896,  897,  898,
-      899,  900,  901,  902,  874,  905,  906,  907,  908,  909,
-      901,  910,  911,  912,  914,  915,  916,  864,  918,  922,
-      923,  924,  878,  925,  926,  928,  929,  931,  925,  932,
-
-      933,  934,  935,  936,  938,  939,  940,  941,  942,  943,
-      944,  945,  946,  948,  949,  951,  952,  926,  953,  954,
-      956,  957,  958,  959,  962,  964,  965,  967,  968,  970,
-      972,  973,  974,  975,  976,  977,  978,  979,  980,  981,
-      982,  983,  984,  985,  986,  987,  988,  989,  990,  991,
-      992,  993,  994,  995,  996,  997,  998,  999,  973, 1000,
-     1001, 1002, 1003, 1004, 1005, 1006, 1007, 1008, 1009, 1012,
-     1015, 1016, 1019, 1020, 1021, 1022, 1023, 1024, 1026, 1028,
-     1030, 1031, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
-     1042, 1043, 1044, 1046, 1047, 1008, 1048, 1049, 1050, 1051,
-
-     1053, 1054, 1056, 1057, 1058, 1059, 1060, 1061, 1062, 1063,
-     1065, 1068, 1069, 1071, 1072, 1074, 1075, 1076, 1077, 1079,
-     1080, 1081, 1082, 1083, 1085, 1086, 1087, 1088, 1089, 1090,
-     1091, 1093, 1094, 1095, 1097, 1098, 1099, 1100, 1101, 1102,
-     1103, 1104, 1105, 1107, 1109, 1110, 1111, 1113, 1114, 1115,
-     1117, 1118, 1119, 1121, 1122, 1123, 1124, 1125, 1126, 1127,
-     1128, 1129, 1130, 1131, 1132, 1133, 1134, 1135, 1136, 1137,
-     1138, 1139, 1141, 1142, 1143, 1144, 1145, 1146, 1150, 1151,
-     1152, 1154, 1155, 1156, 1157, 1158, 1159, 1160, 1162, 1163,
-     1166, 1166, 1166, 1166, 1166, 1167, 1167, 1167, 1167, 1167,
-
-     1168, 1174, 1168, 1168, 1168, 1169, 1175, 1169, 1176, 1169,
-     1170, 1170, 1170, 1170, 1170, 1171, 1171, 1171, 1171, 1171,
-     1172, 1177, 1172, 1172, 1172, 1173, 1173, 1173,  713,  712,
-      711,  710,  708,  706,  705,  703,  702,  701,  700,  699,
-      698,  697,  696,  695,  694,  693,  692,  691,  690,  689,
-      688,  687,  686,  685,  684,  683,  682,  681,  677,  676,
-      675,  674,  673,  671,  670,  669,  668,  667,  666,  665,
-      664,  663,  662,  661,  660,  659,  658,  657,  656,  655,
-      654,  652,  651,  650,  649,  647,  646,  645,  643,  642,
-      641,  638,  637,  636,  635,  634,  633,  632,  631,  630,
-
-      629,  628,  627,  626,  625,  624,  623,  622,  621,  620,
-      619,  618,  617,  616,  615,  614,  613,  612,  611,  610,
-      609,  608,  606,  604,  603,  602,  601,  600,  599,  598,
-      595,  592,  591,  590,  589,  588,  587,  586,  585,  584,
-      583,  582,  581,  580,  579,  578,  576,  575,  574,  573,
-      572,  571,  570,  569,  568,  567,  566,  565,  564,  563,
-      562,  561,  560,  559,  558,  557,  556,  555,  554,  553,
-      552,  551,  550,  549,  548,  547,  546,  545,  544,  543,
-      542,  541,  539,  538,  537,  534,  533,  531,  530,  528,
-      527,  526,  523,  522,  521,  520,  519,  518,  517,  515,
-
-      514,  513,  512,  511,  510,  509,  507,  506,  505,  504,
-      502,  501,  500,  499,  497,  496,  495,  494,  493,  492,
-      491,  490,  489,  488,  487,  486,  485,  484,  483,  482,
-      481,  480,  479,  478,  477,  476,  475,  474,  473,  472,
-      471,  470,  469,  468,  467,  466,  465,  464,  463,  457,
-      455,  452,  451,  450,  448,  447,  446,  444,  441,  440,
-      439,  438,  437,  436,  435,  434,  433,  432,  431,  430,
-      429,  428,  427,  426,  425,  423,  421,  420,  419,  418,
-      417,  416,  415,  414,  413,  411,  410,  409,  408,  407,
-      406,  405,  404,  403,  402,  401,  400,  399,  398,  397,
-
-      396,  394,  393,  392,  391,  390,  389,  388,  387,  385,
-      383,  382,  380,  379,  378,  377,  375,  374,  373,  372,
-      367,  366,  364,  363,  362,  361,  359,  358,  356,  353,
-      351,  349,  348,  347,  346,  345,  344,  343,  342,  341,
-      340,  339,  338,  337,  336,  335,  334,  332,  331,  330,
-      329,  327,  326,  325,  324,  323,  322,  321,  319,  318,
-      317,  315,  314,  313,  312,  311,  310,  309,  308,  307,
-      305,  304,  303,  302,  301,  300,  299,  298,  297,  295,
-      294,  293,  292,  289,  288,  287,  286,  285,  284,  281,
-      279,  276,  275,  269,  262,  261,  260,  259,  258,  257,
-
-      256,  255,  254,  253,  252,  251,  250,  249,  248,  247,
-      245,  244,  243,  242,  241,  240,  239,  238,  237,  236,
-      235,  234,  233,  232,  231,  230,  229,  228,  227,  226,
-      225,  224,  223,  222,  221,  220,  219,  218,  216,  215,
-      214,  213,  212,  211,  210,  209,  208,  207,  206,  205,
-      204,  203,  202,  201,  200,  198,  197,  196,  195,  194,
-      190,  188,  186,  184,  181,  179,  176,  168,  167,  166,
-      164,  163,  162,  161,  160,  156,  154,  152,  151,  150,
-      148,  147,  146,  145,  143,  142,  141,  140,  139,  138,
-      137,  136,  135,  133,  132,  131,  129,  128,  127,  125,
-
-      124,  123,  121,  120,  119,  118,  114,  108,  105,  103,
-       98,   97,   78,   73,   67,   64,   59,   52,   49,   47,
-       43,   41,   39,   38,   24,   14,   11, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165,
-     1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165, 1165
 
+       15,   15,   15,   15,   15,   15,   15,   15,   16,   16,
+       23,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   17,   26,
+       17,   17,   17,   19,   19,   19,   20,   21,   20,   20,
+       20,   17,   21,   25,   28,   25,   27,   29,   25,   25,
+
+       25,   30,   26,   34,   35,   36,   39,   40,   37,   43,
+       37,   38,   42,   41,   17,   41,   44,   45,   48,   45,
+       46,   28,   50,   27,   47,   47,   52,   47,   47,   51,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   49,   53,   49,   54,   54,   54,
+
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   55,   56,   57,   58,   59,   62,
+       55,   69,   73,   55,   68,   55,   74,   55,   55,   55,
+       68,   77,   75,   88,   55,   55,   83,   55,  102,   61,
+       75,   89,   58,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   60,   61,   63,   64,   70,
+       65,   80,   90,   80,   66,   80,   71,   70,   64,   70,
+       71,   91,   70,   71,   70,   76,   70,   92,   60,   93,
+       63,   64,   94,   65,   76,   71,   76,   81,   66,   86,
+       84,   96,   81,   81,   84,   64,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   86,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+
+       98,   67,   67,   67,  101,   67,   67,   67,   67,   67,
+       67,   79,   67,   67,   67,   79,   67,   72,   67,   67,
+       67,   67,   67,   67,   67,   67,  103,   72,   82,   78,
+       78,  101,   82,   78,   79,   85,  104,   72,   78,   87,
+       97,   82,   97,  105,   85,   85,  106,  107,   87,  108,
+       85,   95,   95,   87,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,  109,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   95,   95,   95,   95,   95,   95,   95,   95,   95,
+       95,   99,  100,  110,  111,  112,  113,  114,  115,  116,
+      117,  119,  118,  120,  121,  124,  122,  123,  125,  118,
+      126,  127,  131,  128,  133,  136,   99,  100,  135,  134,
+      130,  130,  130,  146,  137,  130,  129,  140,  142,  144,
+      120,  122,  130,  123,  138,  125,  126,  118,  127,  128,
+      145,  118,  148,  141,  152,  118,  153,  143,  143,  129,
+      149,  154,  118,  139,  155,  147,  118,  147,  118,  118,
+      130,  150,  139,  151,  130,  157,  151,  159,  130,  158,
+
+      151,  132,  132,  132,  156,  130,  132,  160,  163,  130,
+      162,  130,  130,  164,  132,  132,  132,  169,  167,  165,
+      166,  132,  132,  132,  132,  132,  132,  161,  168,  173,
+      177,  161,  170,  170,  171,  172,  179,  178,  172,  172,
+      180,  175,  175,  175,  132,  132,  132,  132,  132,  132,
+      174,  175,  181,  175,  182,  175,  184,  174,  175,  176,
+      175,  185,  186,  176,  183,  187,  189,  176,  188,  190,
+      191,  192,  193,  194,  194,  194,  195,  196,  197,  200,
+      194,  194,  194,  194,  194,  194,  198,  201,  199,  186,
+      187,  188,  202,  203,  204,  206,  205,  208,  209,  210,
+
+      196,  211,  216,  194,  194,  194,  194,  194,  194,  212,
+      201,  217,  213,  198,  199,  214,  203,  207,  207,  207,
+      218,  226,  205,  219,  207,  207,  207,  207,  207,  207,
+      215,  220,  222,  221,  224,  223,  215,  225,  228,  229,
+      227,  232,  231,  233,  230,  235,  234,  207,  207,  207,
+      207,  207,  207,  238,  240,  236,  241,  242,  243,  245,
+      237,  246,  239,  251,  244,  248,  249,  250,  247,  254,
+      259,  260,  257,  252,  258,  253,  263,  261,  255,  256,
+      262,  264,  265,  262,  266,  268,  272,  269,  267,  270,
+      271,  273,  274,  275,  276,  277,  279,  280,  281,  278,
+
+      282,  283,  284,  285,  287,  287,  287,  292,  288,  291,
+      286,  287,  287,  287,  287,  287,  287,  288,  289,  293,
+      280,  290,  290,  295,  294,  296,  297,  298,  300,  301,
+      290,  302,  291,  303,  287,  287,  287,  287,  287,  287,
+      304,  306,  305,  307,  309,  310,  289,  299,  299,  299,
+      316,  294,  308,  311,  299,  299,  299,  299,  299,  299,
+      312,  313,  314,  315,  319,  317,  314,  321,  308,  320,
+      318,  322,  325,  330,  323,  326,  327,  299,  299,  299,
+      299,  299,  299,  324,  329,  328,  331,  337,  324,  332,
+      335,  333,  342,  334,  334,  338,  339,  336,  346,  347,
+
+      341,  350,  340,  343,  338,  345,  348,  349,  351,  352,
+      354,  358,  360,  361,  344,  353,  362,  356,  355,  364,
+      365,  366,  359,  363,  367,  368,  357,  369,  373,  370,
+      371,  372,  374,  324,  375,  371,  377,  378,  324,  376,
+      376,  376,  380,  381,  382,  383,  376,  376,  376,  376,
+      376,  376,  384,  346,  379,  385,  386,  387,  392,  388,
+      391,  388,  390,  394,  393,  395,  396,  397,  398,  376,
+      376,  376,  376,  376,  376,  401,  406,  409,  411,  407,
+      399,  379,  389,  389,  389,  388,  403,  388,  400,  389,
+      389,  389,  389,  389,  389,  402,  404,  405,  413,  408,
+
+      412,  414,  415,  410,  416,  417,  418,  419,  420,  421,
+      404,  423,  389,  389,  389,  389,  389,  389,  422,  424,
+      427,  428,  431,  430,  425,  426,  429,  432,  433,  436,
+      434,  438,  439,  435,  442,  443,  444,  440,  446,  437,
+      449,  447,  441,  445,  448,  451,  450,  452,  453,  454,
+      455,  456,  457,  459,  461,  463,  458,  464,  466,  460,
+      465,  462,  468,  467,  472,  473,  469,  470,  470,  470,
+      471,  474,  475,  477,  470,  470,  470,  470,  470,  470,
+      476,  478,  479,  480,  483,  482,  485,  481,  486,  487,
+      484,  496,  492,  490,  488,  489,  494,  470,  470,  470,
+
+      470,  470,  470,  491,  493,  498,  501,  495,  499,  480,
+      500,  520,  503,  505,  481,  497,  504,  507,  524,  525,
+      509,  506,  502,  511,  530,  535,  512,  508,  510,  516,
+      537,  513,  518,  517,  538,  519,  543,  544,  523,  526,
+      546,  531,  515,  547,  533,  557,  522,  514,  521,  540,
+      541,  548,  552,  527,  534,  528,  525,  536,  529,  551,
+      548,  539,  542,  549,  532,  550,  545,  555,  553,  559,
+      556,  558,  554,  560,  563,  562,  561,  564,  582,  565,
+      566,  567,  568,  564,  570,  573,  572,  574,  571,  577,
+      578,  575,  559,  580,  569,  576,  579,  584,  558,  583,
+
+      591,  581,  585,  586,  587,  589,  588,  590,  592,  593,
+      596,  601,  606,  594,  595,  622,  612,  597,  600,  605,
+      565,  615,  623,  602,  603,  599,  598,  604,  629,  608,
+      630,  631,  632,    0,    0,  624,  607,  609,  614,  653,
+      628,  618,  619,  619,  611,  613,  616,  618,  610,  619,
+      617,  621,  620,  625,  637,  626,  627,  621,  635,  632,
+      634,  636,  642,  633,  638,  643,  658,  644,  663,  666,
+      639,  640,  651,  667,  646,  649,  641,  647,  671,  654,
+      656,  645,  657,  648,  650,  652,  661,  655,  670,  672,
+      669,  659,  675,  668,  677,  679,  675,  660,  662,  680,
+
+      665,  664,  684,  673,  685,  676,  682,  674,  683,  678,
+      681,  688,  689,  690,  691,  692,  686,  695,  697,  698,
+      693,  694,  687,  700,  696,  699,  701,  702,  703,  704,
+      705,  706,  707,  708,  709,  710,  714,  713,  711,  712,
+      716,  721,  717,  715,  718,  722,  723,  730,  719,  720,
+      726,  724,  728,  725,  731,  734,  708,  735,  707,  729,
+      737,  739,  732,  727,  740,  737,  733,  742,  736,  743,
+      738,  746,  753,  744,  747,  741,  745,  749,  748,  750,
+      751,  754,  755,  752,  756,  757,  761,  759,  758,  765,
+      751,  770,  768,  777,  762,  760,  776,  778,  763,  774,
+
+      771,  775,  764,  766,  779,  767,  769,  772,  773,  782,
+      780,  783,  785,  781,  789,  737,  790,  786,  787,  788,
+      784,  791,  792,  793,  778,  794,  795,  798,  797,  801,
+      779,  796,  799,  800,  802,  805,  803,  804,  806,  807,
+      810,  809,  811,  812,  816,  808,  809,  820,  819,  824,
+      813,  815,  825,  821,  828,  817,  814,  835,  826,  823,
+      818,  827,  822,  834,  830,  838,  829,  846,  848,  832,
+      833,  851,  840,  831,  841,  842,  845,  847,  852,  854,
+      836,  850,  837,  839,  858,  859,  861,  844,  843,  865,
+      853,  849,  863,  860,  855,  848,  856,  857,  873,  871,
+
+      847,  875,  867,  872,  862,  874,  876,  864,  869,  877,
+      866,  868,  878,  882,  870,  879,  881,  883,  880,  885,
+      884,  886,  887,  890,  889,  891,  888,  892,  896,  898,
+      899,  893,  900,  901,  895,  894,  902,  897,  904,  905,
+      906,  907,  903,  909,  910,  911,  912,  913,  914,  908,
+      915,  916,  918,  919,  917,  922,  923,  925,  920,  933,
+      930,  921,  927,  934,  924,  931,  926,  928,  929,  936,
+      937,  932,  911,  940,  941,  942,  947,  948,  950,  944,
+      951,    0,  900,  939,  943,  935,  956,  954,  958,  957,
+      959,  939,  915,  953,  938,  952,  960,  949,  945,  946,
+
+      961,  962,  963,  955,  964,  966,  967,  965,  968,  964,
+      969,  970,  972,  973,  971,  976,  974,  977,  975,  987,
+      978,  985,  979,  980,  981,  983,  982,  984,  990,  995,
+      965,  986, 1000,  989, 1001, 1002, 1003,  992, 1006,  991,
+      988,  993, 1010,  994, 1012, 1014, 1015, 1009,  999, 1016,
+      997, 1017, 1020,  996, 1007,  998, 1011, 1021, 1005, 1008,
+     1024, 1013, 1004, 1025, 1022, 1019, 1026, 1027, 1018, 1029,
+     1028, 1014, 1023, 1031, 1030, 1032, 1033, 1034, 1035, 1036,
+     1038, 1037, 1039, 1040, 1049, 1044, 1041, 1043, 1045, 1042,
+     1053, 1051, 1054, 1055, 1056, 1057, 1047, 1050, 1058, 1061,
+
+     1062, 1048, 1052, 1046, 1064, 1069, 1071, 1060, 1067, 1059,
+     1072, 1073, 1076, 1075, 1077, 1070, 1078, 1086, 1051, 1063,
+     1068, 1080, 1079, 1081, 1066, 1084, 1065, 1074, 1082, 1083,
+     1085, 1087, 1088, 1090, 1093, 1096, 1098, 1101, 1089, 1102,
+     1092, 1097, 1099, 1091, 1100, 1094, 1103, 1109, 1095, 1110,
+     1111, 1104, 1108, 1107, 1112, 1113, 1114, 1115, 1105, 1116,
+     1117, 1118, 1121, 1106, 1124, 1120, 1119, 1123, 1126, 1122,
+     1128, 1129, 1132, 1134, 1142, 1143, 1127, 1125, 1131, 1145,
+     1135, 1138, 1130, 1133, 1146, 1151, 1147, 1140, 1156, 1139,
+     1137, 1141, 1144, 1158, 1148, 1159, 1152, 1160, 1136, 1149,
+
+     1153, 1154, 1155, 1165, 1162, 1157, 1166, 1170, 1174, 1150,
+     1164, 1177, 1180, 1192, 1198, 1163, 1184, 1205, 1190, 1175,
+     1206, 1161, 1199, 1167, 1200, 1201, 1207, 1168, 1208, 1172,
+     1169, 1176, 1171, 1173, 1182, 1178, 1185, 1211, 1212, 1179,
+     1183, 1187, 1181, 1189, 1186, 1197, 1217, 1191, 1196, 1194,
+     1195, 1219, 1221, 1193, 1222, 1188, 1202, 1203,    0,    0,
+        0, 1204,    0,    0,    0,    0,    0,    0,    0, 1210,
+        0,    0,    0,    0,    0,    0,    0, 1209, 1220,    0,
+     1218, 1216,    0, 1213,    0,    0, 1214,    0,    0, 1215,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1341,24 +1541,24 @@ static char *yy_last_accepting_cpos;
 extern int parser4__flex_debug;
 int parser4__flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[143] =
+static const flex_int16_t yy_rule_linenum[146] =
     {   0,
-      131,  133,  135,  140,  141,  146,  147,  148,  160,  163,
-      168,  175,  184,  193,  202,  211,  221,  230,  239,  248,
-      257,  268,  277,  286,  295,  304,  314,  324,  334,  344,
-      354,  364,  374,  384,  394,  404,  414,  424,  433,  442,
-      451,  465,  480,  489,  498,  507,  516,  525,  534,  543,
-      552,  561,  570,  580,  589,  598,  607,  616,  625,  634,
-      643,  653,  663,  673,  682,  692,  702,  712,  722,  731,
-      741,  750,  759,  768,  777,  786,  796,  806,  815,  824,
-      833,  842,  851,  860,  869,  878,  887,  896,  905,  914,
-      923,  932,  941,  950,  959,  968,  977,  986,  995, 1004,
-
-     1013, 1022, 1031, 1040, 1049, 1058, 1068, 1078, 1088, 1098,
-     1108, 1118, 1128, 1138, 1148, 1157, 1166, 1175, 1184, 1193,
-     1203, 1213, 1225, 1236, 1249, 1347, 1352, 1357, 1362, 1363,
-     1364, 1365, 1366, 1367, 1369, 1387, 1400, 1405, 1409, 1411,
-     1413, 1415
+      130,  132,  134,  139,  140,  145,  146,  147,  159,  162,
+      167,  174,  183,  192,  201,  210,  220,  229,  238,  247,
+      256,  267,  276,  285,  294,  303,  313,  323,  333,  343,
+      353,  363,  373,  383,  393,  403,  413,  423,  433,  443,
+      452,  461,  470,  484,  499,  508,  517,  526,  535,  544,
+      553,  562,  571,  580,  589,  599,  608,  617,  626,  635,
+      644,  653,  662,  672,  682,  692,  701,  711,  721,  731,
+      741,  750,  760,  769,  778,  787,  796,  805,  815,  825,
+      834,  843,  852,  861,  870,  879,  888,  897,  906,  915,
+      924,  933,  942,  951,  960,  969,  978,  987,  996, 1005,
+
+     1014, 1023, 1032, 1041, 1050, 1059, 1068, 1077, 1086, 1096,
+     1106, 1116, 1126, 1136, 1146, 1156, 1166, 1176, 1185, 1194,
+     1203, 1212, 1221, 1231, 1241, 1253, 1264, 1277, 1375, 1380,
+     1385, 1390, 1391, 1392, 1393, 1394, 1395, 1397, 1415, 1428,
+     1433, 1437, 1439, 1441, 1443
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1403,7 +1603,7 @@ unsigned int comment_start_line = 0;
 
 // To avoid the call to exit... oops!
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser4Context::fatal(msg)
-#line 1406 "dhcp4_lexer.cc"
+#line 1606 "dhcp4_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1429,8 +1629,8 @@ unsigned int comment_start_line = 0;
 // by moving it ahead by yyleng bytes. yyleng specifies the length of the
 // currently matched token.
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1432 "dhcp4_lexer.cc"
-#line 1433 "dhcp4_lexer.cc"
+#line 1632 "dhcp4_lexer.cc"
+#line 1633 "dhcp4_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1712,11 +1912,11 @@ YY_DECL
 
 	{
 /* %% [7.0] user's declarations go here */
-#line 92 "dhcp4_lexer.ll"
+#line 93 "dhcp4_lexer.ll"
 
 
 
-#line 96 "dhcp4_lexer.ll"
+#line 95 "dhcp4_lexer.ll"
     // This part of the code is copied over to the verbatim to the top
     // of the generated yylex function. Explanation:
     // http://www.gnu.org/software/bison/manual/html_node/Multiple-start_002dsymbols.html
@@ -1751,8 +1951,7 @@ YY_DECL
         }
     }
 
-
-#line 1755 "dhcp4_lexer.cc"
+#line 1954 "dhcp4_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1781,13 +1980,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1166 )
+				if ( yy_current_state >= 1224 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1165 );
+		while ( yy_current_state != 1223 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1806,13 +2005,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 143 )
+			else if ( yy_act < 146 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], parser4_text );
-			else if ( yy_act == 143 )
+			else if ( yy_act == 146 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         parser4_text );
-			else if ( yy_act == 144 )
+			else if ( yy_act == 147 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -1830,17 +2029,17 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 131 "dhcp4_lexer.ll"
+#line 130 "dhcp4_lexer.ll"
 ;
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 133 "dhcp4_lexer.ll"
+#line 132 "dhcp4_lexer.ll"
 ;
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 135 "dhcp4_lexer.ll"
+#line 134 "dhcp4_lexer.ll"
 {
   BEGIN(COMMENT);
   comment_start_line = driver.loc_.end.line;;
@@ -1848,33 +2047,33 @@ YY_RULE_SETUP
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 140 "dhcp4_lexer.ll"
+#line 139 "dhcp4_lexer.ll"
 BEGIN(INITIAL);
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 141 "dhcp4_lexer.ll"
+#line 140 "dhcp4_lexer.ll"
 ;
 	YY_BREAK
 case YY_STATE_EOF(COMMENT):
-#line 142 "dhcp4_lexer.ll"
+#line 141 "dhcp4_lexer.ll"
 {
     isc_throw(Dhcp4ParseError, "Comment not closed. (/* in line " << comment_start_line);
 }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 146 "dhcp4_lexer.ll"
+#line 145 "dhcp4_lexer.ll"
 BEGIN(DIR_ENTER);
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 147 "dhcp4_lexer.ll"
+#line 146 "dhcp4_lexer.ll"
 BEGIN(DIR_INCLUDE);
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 148 "dhcp4_lexer.ll"
+#line 147 "dhcp4_lexer.ll"
 {
     // Include directive.
 
@@ -1888,19 +2087,19 @@ YY_RULE_SETUP
 case YY_STATE_EOF(DIR_ENTER):
 case YY_STATE_EOF(DIR_INCLUDE):
 case YY_STATE_EOF(DIR_EXIT):
-#line 157 "dhcp4_lexer.ll"
+#line 156 "dhcp4_lexer.ll"
 {
     isc_throw(Dhcp4ParseError, "Directive not closed.");
 }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 160 "dhcp4_lexer.ll"
+#line 159 "dhcp4_lexer.ll"
 BEGIN(INITIAL);
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 163 "dhcp4_lexer.ll"
+#line 162 "dhcp4_lexer.ll"
 {
     // Ok, we found a with space. Let's ignore it and update loc variable.
     driver.loc_.step();
@@ -1909,7 +2108,7 @@ YY_RULE_SETUP
 case 11:
 /* rule 11 can match eol */
 YY_RULE_SETUP
-#line 168 "dhcp4_lexer.ll"
+#line 167 "dhcp4_lexer.ll"
 {
     // Newline found. Let's update the location and continue.
     driver.loc_.lines(yyleng);
@@ -1918,7 +2117,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 175 "dhcp4_lexer.ll"
+#line 174 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -1930,7 +2129,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 184 "dhcp4_lexer.ll"
+#line 183 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -1942,7 +2141,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 193 "dhcp4_lexer.ll"
+#line 192 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::INTERFACES_CONFIG:
@@ -1954,7 +2153,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 202 "dhcp4_lexer.ll"
+#line 201 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_SOCKET_TYPE:
@@ -1966,7 +2165,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 211 "dhcp4_lexer.ll"
+#line 210 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_SOCKET_TYPE:
@@ -1979,7 +2178,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 221 "dhcp4_lexer.ll"
+#line 220 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::INTERFACES_CONFIG:
@@ -1991,7 +2190,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 230 "dhcp4_lexer.ll"
+#line 229 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2003,7 +2202,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 239 "dhcp4_lexer.ll"
+#line 238 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2015,7 +2214,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 248 "dhcp4_lexer.ll"
+#line 247 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOSTS_DATABASE:
@@ -2027,7 +2226,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 257 "dhcp4_lexer.ll"
+#line 256 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2041,7 +2240,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 268 "dhcp4_lexer.ll"
+#line 267 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2053,7 +2252,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 277 "dhcp4_lexer.ll"
+#line 276 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2065,7 +2264,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 286 "dhcp4_lexer.ll"
+#line 285 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2077,7 +2276,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 295 "dhcp4_lexer.ll"
+#line 294 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DATABASE_TYPE:
@@ -2089,7 +2288,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 304 "dhcp4_lexer.ll"
+#line 303 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2102,7 +2301,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 314 "dhcp4_lexer.ll"
+#line 313 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2115,7 +2314,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 324 "dhcp4_lexer.ll"
+#line 323 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2128,7 +2327,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 334 "dhcp4_lexer.ll"
+#line 333 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2141,7 +2340,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 344 "dhcp4_lexer.ll"
+#line 343 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2154,7 +2353,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 354 "dhcp4_lexer.ll"
+#line 353 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2167,7 +2366,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 364 "dhcp4_lexer.ll"
+#line 363 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2180,7 +2379,33 @@ YY_RULE_SETUP
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 374 "dhcp4_lexer.ll"
+#line 373 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CONNECTION_POOL_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("connection-pool-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 34:
+YY_RULE_SETUP
+#line 383 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::LEASE_DATABASE:
+    case isc::dhcp::Parser4Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp4Parser::make_CACHE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("cache-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 35:
+YY_RULE_SETUP
+#line 393 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2191,9 +2416,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 34:
+case 36:
 YY_RULE_SETUP
-#line 384 "dhcp4_lexer.ll"
+#line 403 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2204,9 +2429,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 35:
+case 37:
 YY_RULE_SETUP
-#line 394 "dhcp4_lexer.ll"
+#line 413 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2217,9 +2442,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 36:
+case 38:
 YY_RULE_SETUP
-#line 404 "dhcp4_lexer.ll"
+#line 423 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2230,9 +2455,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 37:
+case 39:
 YY_RULE_SETUP
-#line 414 "dhcp4_lexer.ll"
+#line 433 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2243,9 +2468,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 38:
+case 40:
 YY_RULE_SETUP
-#line 424 "dhcp4_lexer.ll"
+#line 443 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2255,9 +2480,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 39:
+case 41:
 YY_RULE_SETUP
-#line 433 "dhcp4_lexer.ll"
+#line 452 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2267,9 +2492,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 40:
+case 42:
 YY_RULE_SETUP
-#line 442 "dhcp4_lexer.ll"
+#line 461 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2279,9 +2504,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 41:
+case 43:
 YY_RULE_SETUP
-#line 451 "dhcp4_lexer.ll"
+#line 470 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2296,9 +2521,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 42:
+case 44:
 YY_RULE_SETUP
-#line 465 "dhcp4_lexer.ll"
+#line 484 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LEASE_DATABASE:
@@ -2314,9 +2539,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 43:
+case 45:
 YY_RULE_SETUP
-#line 480 "dhcp4_lexer.ll"
+#line 499 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2326,9 +2551,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 44:
+case 46:
 YY_RULE_SETUP
-#line 489 "dhcp4_lexer.ll"
+#line 508 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2338,9 +2563,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 45:
+case 47:
 YY_RULE_SETUP
-#line 498 "dhcp4_lexer.ll"
+#line 517 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -2350,9 +2575,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 46:
+case 48:
 YY_RULE_SETUP
-#line 507 "dhcp4_lexer.ll"
+#line 526 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::POOLS:
@@ -2362,9 +2587,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 47:
+case 49:
 YY_RULE_SETUP
-#line 516 "dhcp4_lexer.ll"
+#line 535 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2374,9 +2599,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 48:
+case 50:
 YY_RULE_SETUP
-#line 525 "dhcp4_lexer.ll"
+#line 544 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2386,9 +2611,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 49:
+case 51:
 YY_RULE_SETUP
-#line 534 "dhcp4_lexer.ll"
+#line 553 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2398,9 +2623,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 50:
+case 52:
 YY_RULE_SETUP
-#line 543 "dhcp4_lexer.ll"
+#line 562 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2410,9 +2635,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 51:
+case 53:
 YY_RULE_SETUP
-#line 552 "dhcp4_lexer.ll"
+#line 571 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2422,9 +2647,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 52:
+case 54:
 YY_RULE_SETUP
-#line 561 "dhcp4_lexer.ll"
+#line 580 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2434,9 +2659,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 53:
+case 55:
 YY_RULE_SETUP
-#line 570 "dhcp4_lexer.ll"
+#line 589 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2447,9 +2672,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 56:
 YY_RULE_SETUP
-#line 580 "dhcp4_lexer.ll"
+#line 599 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2459,9 +2684,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 57:
 YY_RULE_SETUP
-#line 589 "dhcp4_lexer.ll"
+#line 608 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -2471,9 +2696,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 58:
 YY_RULE_SETUP
-#line 598 "dhcp4_lexer.ll"
+#line 617 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGING:
@@ -2483,9 +2708,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 59:
 YY_RULE_SETUP
-#line 607 "dhcp4_lexer.ll"
+#line 626 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2495,9 +2720,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 60:
 YY_RULE_SETUP
-#line 616 "dhcp4_lexer.ll"
+#line 635 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OUTPUT_OPTIONS:
@@ -2507,9 +2732,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 61:
 YY_RULE_SETUP
-#line 625 "dhcp4_lexer.ll"
+#line 644 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2519,9 +2744,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 62:
 YY_RULE_SETUP
-#line 634 "dhcp4_lexer.ll"
+#line 653 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::LOGGERS:
@@ -2531,9 +2756,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 63:
 YY_RULE_SETUP
-#line 643 "dhcp4_lexer.ll"
+#line 662 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2544,9 +2769,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 64:
 YY_RULE_SETUP
-#line 653 "dhcp4_lexer.ll"
+#line 672 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2557,9 +2782,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 65:
 YY_RULE_SETUP
-#line 663 "dhcp4_lexer.ll"
+#line 682 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CLIENT_CLASSES:
@@ -2570,9 +2795,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 66:
 YY_RULE_SETUP
-#line 673 "dhcp4_lexer.ll"
+#line 692 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2582,9 +2807,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 67:
 YY_RULE_SETUP
-#line 682 "dhcp4_lexer.ll"
+#line 701 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2595,9 +2820,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 68:
 YY_RULE_SETUP
-#line 692 "dhcp4_lexer.ll"
+#line 711 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2608,9 +2833,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 69:
 YY_RULE_SETUP
-#line 702 "dhcp4_lexer.ll"
+#line 721 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2621,9 +2846,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 70:
 YY_RULE_SETUP
-#line 712 "dhcp4_lexer.ll"
+#line 731 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOST_RESERVATION_IDENTIFIERS:
@@ -2634,9 +2859,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 71:
 YY_RULE_SETUP
-#line 722 "dhcp4_lexer.ll"
+#line 741 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RESERVATIONS:
@@ -2646,9 +2871,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 72:
 YY_RULE_SETUP
-#line 731 "dhcp4_lexer.ll"
+#line 750 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2659,9 +2884,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 73:
 YY_RULE_SETUP
-#line 741 "dhcp4_lexer.ll"
+#line 760 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DATA:
@@ -2671,9 +2896,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 74:
 YY_RULE_SETUP
-#line 750 "dhcp4_lexer.ll"
+#line 769 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2683,9 +2908,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 75:
 YY_RULE_SETUP
-#line 759 "dhcp4_lexer.ll"
+#line 778 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2695,9 +2920,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 76:
 YY_RULE_SETUP
-#line 768 "dhcp4_lexer.ll"
+#line 787 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::OPTION_DEF:
@@ -2707,9 +2932,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 77:
 YY_RULE_SETUP
-#line 777 "dhcp4_lexer.ll"
+#line 796 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -2719,9 +2944,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 78:
 YY_RULE_SETUP
-#line 786 "dhcp4_lexer.ll"
+#line 805 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::RELAY:
@@ -2732,9 +2957,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 79:
 YY_RULE_SETUP
-#line 796 "dhcp4_lexer.ll"
+#line 815 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2744,9 +2969,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 80:
 YY_RULE_SETUP
-#line 806 "dhcp4_lexer.ll"
+#line 825 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -2756,9 +2981,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 81:
 YY_RULE_SETUP
-#line 815 "dhcp4_lexer.ll"
+#line 834 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::HOOKS_LIBRARIES:
@@ -2768,9 +2993,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 82:
 YY_RULE_SETUP
-#line 824 "dhcp4_lexer.ll"
+#line 843 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2780,9 +3005,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 83:
 YY_RULE_SETUP
-#line 833 "dhcp4_lexer.ll"
+#line 852 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2792,9 +3017,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 84:
 YY_RULE_SETUP
-#line 842 "dhcp4_lexer.ll"
+#line 861 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2804,9 +3029,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 85:
 YY_RULE_SETUP
-#line 851 "dhcp4_lexer.ll"
+#line 870 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2816,9 +3041,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 86:
 YY_RULE_SETUP
-#line 860 "dhcp4_lexer.ll"
+#line 879 "dhcp4_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp4Parser::make_REUSE_QUARANTINE_TIME(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp4Parser::make_STRING("reuse-quarantine-time", driver.loc_);
+    }
+}
+	YY_BREAK
+case 87:
+YY_RULE_SETUP
+#line 888 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2828,9 +3065,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 88:
 YY_RULE_SETUP
-#line 869 "dhcp4_lexer.ll"
+#line 897 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2840,9 +3077,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 89:
 YY_RULE_SETUP
-#line 878 "dhcp4_lexer.ll"
+#line 906 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::EXPIRED_LEASES_PROCESSING:
@@ -2852,9 +3089,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 90:
 YY_RULE_SETUP
-#line 887 "dhcp4_lexer.ll"
+#line 915 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2864,9 +3101,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 91:
 YY_RULE_SETUP
-#line 896 "dhcp4_lexer.ll"
+#line 924 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2876,9 +3113,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 92:
 YY_RULE_SETUP
-#line 905 "dhcp4_lexer.ll"
+#line 933 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -2888,9 +3125,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 93:
 YY_RULE_SETUP
-#line 914 "dhcp4_lexer.ll"
+#line 942 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONTROL_SOCKET:
@@ -2900,9 +3137,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 94:
 YY_RULE_SETUP
-#line 923 "dhcp4_lexer.ll"
+#line 951 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -2912,9 +3149,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 95:
 YY_RULE_SETUP
-#line 932 "dhcp4_lexer.ll"
+#line 960 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2924,9 +3161,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 96:
 YY_RULE_SETUP
-#line 941 "dhcp4_lexer.ll"
+#line 969 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2936,9 +3173,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 97:
 YY_RULE_SETUP
-#line 950 "dhcp4_lexer.ll"
+#line 978 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2948,9 +3185,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 98:
 YY_RULE_SETUP
-#line 959 "dhcp4_lexer.ll"
+#line 987 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2960,9 +3197,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 99:
 YY_RULE_SETUP
-#line 968 "dhcp4_lexer.ll"
+#line 996 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2972,9 +3209,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 100:
 YY_RULE_SETUP
-#line 977 "dhcp4_lexer.ll"
+#line 1005 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2984,9 +3221,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 101:
 YY_RULE_SETUP
-#line 986 "dhcp4_lexer.ll"
+#line 1014 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -2996,9 +3233,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 102:
 YY_RULE_SETUP
-#line 995 "dhcp4_lexer.ll"
+#line 1023 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3008,9 +3245,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 103:
 YY_RULE_SETUP
-#line 1004 "dhcp4_lexer.ll"
+#line 1032 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3020,9 +3257,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 104:
 YY_RULE_SETUP
-#line 1013 "dhcp4_lexer.ll"
+#line 1041 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3032,9 +3269,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 105:
 YY_RULE_SETUP
-#line 1022 "dhcp4_lexer.ll"
+#line 1050 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3044,9 +3281,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 106:
 YY_RULE_SETUP
-#line 1031 "dhcp4_lexer.ll"
+#line 1059 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3056,9 +3293,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 107:
 YY_RULE_SETUP
-#line 1040 "dhcp4_lexer.ll"
+#line 1068 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3068,9 +3305,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 108:
 YY_RULE_SETUP
-#line 1049 "dhcp4_lexer.ll"
+#line 1077 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP_DDNS:
@@ -3080,9 +3317,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 109:
 YY_RULE_SETUP
-#line 1058 "dhcp4_lexer.ll"
+#line 1086 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3093,9 +3330,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 107:
+case 110:
 YY_RULE_SETUP
-#line 1068 "dhcp4_lexer.ll"
+#line 1096 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_PROTOCOL) {
@@ -3106,9 +3343,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 108:
+case 111:
 YY_RULE_SETUP
-#line 1078 "dhcp4_lexer.ll"
+#line 1106 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::NCR_FORMAT) {
@@ -3119,9 +3356,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 109:
+case 112:
 YY_RULE_SETUP
-#line 1088 "dhcp4_lexer.ll"
+#line 1116 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3132,9 +3369,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 110:
+case 113:
 YY_RULE_SETUP
-#line 1098 "dhcp4_lexer.ll"
+#line 1126 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3145,9 +3382,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 111:
+case 114:
 YY_RULE_SETUP
-#line 1108 "dhcp4_lexer.ll"
+#line 1136 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3158,9 +3395,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 112:
+case 115:
 YY_RULE_SETUP
-#line 1118 "dhcp4_lexer.ll"
+#line 1146 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3171,9 +3408,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 113:
+case 116:
 YY_RULE_SETUP
-#line 1128 "dhcp4_lexer.ll"
+#line 1156 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3184,9 +3421,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 114:
+case 117:
 YY_RULE_SETUP
-#line 1138 "dhcp4_lexer.ll"
+#line 1166 "dhcp4_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser4Context::REPLACE_CLIENT_NAME) {
@@ -3197,9 +3434,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(tmp, driver.loc_);
 }
 	YY_BREAK
-case 115:
+case 118:
 YY_RULE_SETUP
-#line 1148 "dhcp4_lexer.ll"
+#line 1176 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3209,9 +3446,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 119:
 YY_RULE_SETUP
-#line 1157 "dhcp4_lexer.ll"
+#line 1185 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::CONFIG:
@@ -3221,9 +3458,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 120:
 YY_RULE_SETUP
-#line 1166 "dhcp4_lexer.ll"
+#line 1194 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3233,9 +3470,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 121:
 YY_RULE_SETUP
-#line 1175 "dhcp4_lexer.ll"
+#line 1203 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3245,9 +3482,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 122:
 YY_RULE_SETUP
-#line 1184 "dhcp4_lexer.ll"
+#line 1212 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3257,9 +3494,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 123:
 YY_RULE_SETUP
-#line 1193 "dhcp4_lexer.ll"
+#line 1221 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3270,9 +3507,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 124:
 YY_RULE_SETUP
-#line 1203 "dhcp4_lexer.ll"
+#line 1231 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3283,9 +3520,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 125:
 YY_RULE_SETUP
-#line 1213 "dhcp4_lexer.ll"
+#line 1241 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::DHCP4:
@@ -3298,9 +3535,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 126:
 YY_RULE_SETUP
-#line 1225 "dhcp4_lexer.ll"
+#line 1253 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3312,9 +3549,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 127:
 YY_RULE_SETUP
-#line 1236 "dhcp4_lexer.ll"
+#line 1264 "dhcp4_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser4Context::SUBNET4:
@@ -3326,9 +3563,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 128:
 YY_RULE_SETUP
-#line 1249 "dhcp4_lexer.ll"
+#line 1277 "dhcp4_lexer.ll"
 {
     // A string has been matched. It contains the actual string and single quotes.
     // We need to get those quotes out of the way and just use its content, e.g.
@@ -3427,65 +3664,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 126:
-/* rule 126 can match eol */
+case 129:
+/* rule 129 can match eol */
 YY_RULE_SETUP
-#line 1347 "dhcp4_lexer.ll"
+#line 1375 "dhcp4_lexer.ll"
 {
     // Bad string with a forbidden control character inside
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 127:
-/* rule 127 can match eol */
+case 130:
+/* rule 130 can match eol */
 YY_RULE_SETUP
-#line 1352 "dhcp4_lexer.ll"
+#line 1380 "dhcp4_lexer.ll"
 {
     // Bad string with a bad escape inside
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 128:
+case 131:
 YY_RULE_SETUP
-#line 1357 "dhcp4_lexer.ll"
+#line 1385 "dhcp4_lexer.ll"
 {
     // Bad string with an open escape at the end
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 129:
+case 132:
 YY_RULE_SETUP
-#line 1362 "dhcp4_lexer.ll"
+#line 1390 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 130:
+case 133:
 YY_RULE_SETUP
-#line 1363 "dhcp4_lexer.ll"
+#line 1391 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 131:
+case 134:
 YY_RULE_SETUP
-#line 1364 "dhcp4_lexer.ll"
+#line 1392 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 132:
+case 135:
 YY_RULE_SETUP
-#line 1365 "dhcp4_lexer.ll"
+#line 1393 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 133:
+case 136:
 YY_RULE_SETUP
-#line 1366 "dhcp4_lexer.ll"
+#line 1394 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 134:
+case 137:
 YY_RULE_SETUP
-#line 1367 "dhcp4_lexer.ll"
+#line 1395 "dhcp4_lexer.ll"
 { return isc::dhcp::Dhcp4Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 135:
+case 138:
 YY_RULE_SETUP
-#line 1369 "dhcp4_lexer.ll"
+#line 1397 "dhcp4_lexer.ll"
 {
     // An integer was found.
     std::string tmp(yytext);
@@ -3504,9 +3741,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 136:
+case 139:
 YY_RULE_SETUP
-#line 1387 "dhcp4_lexer.ll"
+#line 1415 "dhcp4_lexer.ll"
 {
     // A floating point was found.
     std::string tmp(yytext);
@@ -3520,43 +3757,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp4Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 137:
+case 140:
 YY_RULE_SETUP
-#line 1400 "dhcp4_lexer.ll"
+#line 1428 "dhcp4_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp4Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 138:
+case 141:
 YY_RULE_SETUP
-#line 1405 "dhcp4_lexer.ll"
+#line 1433 "dhcp4_lexer.ll"
 {
    return isc::dhcp::Dhcp4Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 139:
+case 142:
 YY_RULE_SETUP
-#line 1409 "dhcp4_lexer.ll"
+#line 1437 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 140:
+case 143:
 YY_RULE_SETUP
-#line 1411 "dhcp4_lexer.ll"
+#line 1439 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 141:
+case 144:
 YY_RULE_SETUP
-#line 1413 "dhcp4_lexer.ll"
+#line 1441 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 142:
+case 145:
 YY_RULE_SETUP
-#line 1415 "dhcp4_lexer.ll"
+#line 1443 "dhcp4_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1417 "dhcp4_lexer.ll"
+#line 1445 "dhcp4_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp4Parser::make_END(driver.loc_);
@@ -3580,12 +3817,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 143:
+case 146:
 YY_RULE_SETUP
-#line 1440 "dhcp4_lexer.ll"
+#line 1468 "dhcp4_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 3588 "dhcp4_lexer.cc"
+#line 3825 "dhcp4_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3900,7 +4137,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1166 )
+			if ( yy_current_state >= 1224 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -3933,11 +4170,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1166 )
+		if ( yy_current_state >= 1224 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1165);
+	yy_is_jam = (yy_current_state == 1223);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4686,8 +4923,7 @@ void parser4_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 1440 "dhcp4_lexer.ll"
-
+#line 1468 "dhcp4_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -4788,4 +5024,3 @@ class Dummy {
     void dummy() { yy_fatal_error("Fix me: how to disable its definition?"); }
 };
 }
-
@@ -379,105 +379,108 @@ namespace isc { namespace dhcp {
         TOKEN_LFC_INTERVAL = 288,
         TOKEN_READONLY = 289,
         TOKEN_CONNECT_TIMEOUT = 290,
-        TOKEN_CONTACT_POINTS = 291,
-        TOKEN_KEYSPACE = 292,
-        TOKEN_VALID_LIFETIME = 293,
-        TOKEN_RENEW_TIMER = 294,
-        TOKEN_REBIND_TIMER = 295,
-        TOKEN_DECLINE_PROBATION_PERIOD = 296,
-        TOKEN_SUBNET4 = 297,
-        TOKEN_SUBNET_4O6_INTERFACE = 298,
-        TOKEN_SUBNET_4O6_INTERFACE_ID = 299,
-        TOKEN_SUBNET_4O6_SUBNET = 300,
-        TOKEN_OPTION_DEF = 301,
-        TOKEN_OPTION_DATA = 302,
-        TOKEN_NAME = 303,
-        TOKEN_DATA = 304,
-        TOKEN_CODE = 305,
-        TOKEN_SPACE = 306,
-        TOKEN_CSV_FORMAT = 307,
-        TOKEN_RECORD_TYPES = 308,
-        TOKEN_ENCAPSULATE = 309,
-        TOKEN_ARRAY = 310,
-        TOKEN_POOLS = 311,
-        TOKEN_POOL = 312,
-        TOKEN_USER_CONTEXT = 313,
-        TOKEN_SUBNET = 314,
-        TOKEN_INTERFACE = 315,
-        TOKEN_INTERFACE_ID = 316,
-        TOKEN_ID = 317,
-        TOKEN_RAPID_COMMIT = 318,
-        TOKEN_RESERVATION_MODE = 319,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 320,
-        TOKEN_CLIENT_CLASSES = 321,
-        TOKEN_TEST = 322,
-        TOKEN_CLIENT_CLASS = 323,
-        TOKEN_RESERVATIONS = 324,
-        TOKEN_DUID = 325,
-        TOKEN_HW_ADDRESS = 326,
-        TOKEN_CIRCUIT_ID = 327,
-        TOKEN_CLIENT_ID = 328,
-        TOKEN_HOSTNAME = 329,
-        TOKEN_RELAY = 330,
-        TOKEN_IP_ADDRESS = 331,
-        TOKEN_HOOKS_LIBRARIES = 332,
-        TOKEN_LIBRARY = 333,
-        TOKEN_PARAMETERS = 334,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 335,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 336,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 337,
-        TOKEN_HOLD_RECLAIMED_TIME = 338,
-        TOKEN_MAX_RECLAIM_LEASES = 339,
-        TOKEN_MAX_RECLAIM_TIME = 340,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 341,
-        TOKEN_DHCP4O6_PORT = 342,
-        TOKEN_CONTROL_SOCKET = 343,
-        TOKEN_SOCKET_TYPE = 344,
-        TOKEN_SOCKET_NAME = 345,
-        TOKEN_DHCP_DDNS = 346,
-        TOKEN_ENABLE_UPDATES = 347,
-        TOKEN_QUALIFYING_SUFFIX = 348,
-        TOKEN_SERVER_IP = 349,
-        TOKEN_SERVER_PORT = 350,
-        TOKEN_SENDER_IP = 351,
-        TOKEN_SENDER_PORT = 352,
-        TOKEN_MAX_QUEUE_SIZE = 353,
-        TOKEN_NCR_PROTOCOL = 354,
-        TOKEN_NCR_FORMAT = 355,
-        TOKEN_ALWAYS_INCLUDE_FQDN = 356,
-        TOKEN_OVERRIDE_NO_UPDATE = 357,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 358,
-        TOKEN_REPLACE_CLIENT_NAME = 359,
-        TOKEN_GENERATED_PREFIX = 360,
-        TOKEN_TCP = 361,
-        TOKEN_JSON = 362,
-        TOKEN_WHEN_PRESENT = 363,
-        TOKEN_NEVER = 364,
-        TOKEN_ALWAYS = 365,
-        TOKEN_WHEN_NOT_PRESENT = 366,
-        TOKEN_LOGGING = 367,
-        TOKEN_LOGGERS = 368,
-        TOKEN_OUTPUT_OPTIONS = 369,
-        TOKEN_OUTPUT = 370,
-        TOKEN_DEBUGLEVEL = 371,
-        TOKEN_SEVERITY = 372,
-        TOKEN_DHCP6 = 373,
-        TOKEN_DHCPDDNS = 374,
-        TOKEN_TOPLEVEL_JSON = 375,
-        TOKEN_TOPLEVEL_DHCP4 = 376,
-        TOKEN_SUB_DHCP4 = 377,
-        TOKEN_SUB_INTERFACES4 = 378,
-        TOKEN_SUB_SUBNET4 = 379,
-        TOKEN_SUB_POOL4 = 380,
-        TOKEN_SUB_RESERVATION = 381,
-        TOKEN_SUB_OPTION_DEF = 382,
-        TOKEN_SUB_OPTION_DATA = 383,
-        TOKEN_SUB_HOOKS_LIBRARY = 384,
-        TOKEN_SUB_DHCP_DDNS = 385,
-        TOKEN_STRING = 386,
-        TOKEN_INTEGER = 387,
-        TOKEN_FLOAT = 388,
-        TOKEN_BOOLEAN = 389
+        TOKEN_CONNECTION_POOL_SIZE = 291,
+        TOKEN_CACHE_SIZE = 292,
+        TOKEN_CONTACT_POINTS = 293,
+        TOKEN_KEYSPACE = 294,
+        TOKEN_VALID_LIFETIME = 295,
+        TOKEN_RENEW_TIMER = 296,
+        TOKEN_REBIND_TIMER = 297,
+        TOKEN_DECLINE_PROBATION_PERIOD = 298,
+        TOKEN_SUBNET4 = 299,
+        TOKEN_SUBNET_4O6_INTERFACE = 300,
+        TOKEN_SUBNET_4O6_INTERFACE_ID = 301,
+        TOKEN_SUBNET_4O6_SUBNET = 302,
+        TOKEN_OPTION_DEF = 303,
+        TOKEN_OPTION_DATA = 304,
+        TOKEN_NAME = 305,
+        TOKEN_DATA = 306,
+        TOKEN_CODE = 307,
+        TOKEN_SPACE = 308,
+        TOKEN_CSV_FORMAT = 309,
+        TOKEN_RECORD_TYPES = 310,
+        TOKEN_ENCAPSULATE = 311,
+        TOKEN_ARRAY = 312,
+        TOKEN_POOLS = 313,
+        TOKEN_POOL = 314,
+        TOKEN_USER_CONTEXT = 315,
+        TOKEN_SUBNET = 316,
+        TOKEN_INTERFACE = 317,
+        TOKEN_INTERFACE_ID = 318,
+        TOKEN_ID = 319,
+        TOKEN_RAPID_COMMIT = 320,
+        TOKEN_RESERVATION_MODE = 321,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 322,
+        TOKEN_CLIENT_CLASSES = 323,
+        TOKEN_TEST = 324,
+        TOKEN_CLIENT_CLASS = 325,
+        TOKEN_RESERVATIONS = 326,
+        TOKEN_DUID = 327,
+        TOKEN_HW_ADDRESS = 328,
+        TOKEN_CIRCUIT_ID = 329,
+        TOKEN_CLIENT_ID = 330,
+        TOKEN_HOSTNAME = 331,
+        TOKEN_RELAY = 332,
+        TOKEN_IP_ADDRESS = 333,
+        TOKEN_HOOKS_LIBRARIES = 334,
+        TOKEN_LIBRARY = 335,
+        TOKEN_PARAMETERS = 336,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 337,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 338,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 339,
+        TOKEN_HOLD_RECLAIMED_TIME = 340,
+        TOKEN_REUSE_QUARANTINE_TIME = 341,
+        TOKEN_MAX_RECLAIM_LEASES = 342,
+        TOKEN_MAX_RECLAIM_TIME = 343,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 344,
+        TOKEN_DHCP4O6_PORT = 345,
+        TOKEN_CONTROL_SOCKET = 346,
+        TOKEN_SOCKET_TYPE = 347,
+        TOKEN_SOCKET_NAME = 348,
+        TOKEN_DHCP_DDNS = 349,
+        TOKEN_ENABLE_UPDATES = 350,
+        TOKEN_QUALIFYING_SUFFIX = 351,
+        TOKEN_SERVER_IP = 352,
+        TOKEN_SERVER_PORT = 353,
+        TOKEN_SENDER_IP = 354,
+        TOKEN_SENDER_PORT = 355,
+        TOKEN_MAX_QUEUE_SIZE = 356,
+        TOKEN_NCR_PROTOCOL = 357,
+        TOKEN_NCR_FORMAT = 358,
+        TOKEN_ALWAYS_INCLUDE_FQDN = 359,
+        TOKEN_OVERRIDE_NO_UPDATE = 360,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 361,
+        TOKEN_REPLACE_CLIENT_NAME = 362,
+        TOKEN_GENERATED_PREFIX = 363,
+        TOKEN_TCP = 364,
+        TOKEN_JSON = 365,
+        TOKEN_WHEN_PRESENT = 366,
+        TOKEN_NEVER = 367,
+        TOKEN_ALWAYS = 368,
+        TOKEN_WHEN_NOT_PRESENT = 369,
+        TOKEN_LOGGING = 370,
+        TOKEN_LOGGERS = 371,
+        TOKEN_OUTPUT_OPTIONS = 372,
+        TOKEN_OUTPUT = 373,
+        TOKEN_DEBUGLEVEL = 374,
+        TOKEN_SEVERITY = 375,
+        TOKEN_DHCP6 = 376,
+        TOKEN_DHCPDDNS = 377,
+        TOKEN_TOPLEVEL_JSON = 378,
+        TOKEN_TOPLEVEL_DHCP4 = 379,
+        TOKEN_SUB_DHCP4 = 380,
+        TOKEN_SUB_INTERFACES4 = 381,
+        TOKEN_SUB_SUBNET4 = 382,
+        TOKEN_SUB_POOL4 = 383,
+        TOKEN_SUB_RESERVATION = 384,
+        TOKEN_SUB_OPTION_DEF = 385,
+        TOKEN_SUB_OPTION_DATA = 386,
+        TOKEN_SUB_HOOKS_LIBRARY = 387,
+        TOKEN_SUB_DHCP_DDNS = 388,
+        TOKEN_STRING = 389,
+        TOKEN_INTEGER = 390,
+        TOKEN_FLOAT = 391,
+        TOKEN_BOOLEAN = 392
       };
     };
 
@@ -728,6 +731,14 @@ namespace isc { namespace dhcp {
     symbol_type
     make_CONNECT_TIMEOUT (const location_type& l);
 
+    static inline
+    symbol_type
+    make_CONNECTION_POOL_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CACHE_SIZE (const location_type& l);
+
     static inline
     symbol_type
     make_CONTACT_POINTS (const location_type& l);
@@ -920,6 +931,10 @@ namespace isc { namespace dhcp {
     symbol_type
     make_HOLD_RECLAIMED_TIME (const location_type& l);
 
+    static inline
+    symbol_type
+    make_REUSE_QUARANTINE_TIME (const location_type& l);
+
     static inline
     symbol_type
     make_MAX_RECLAIM_LEASES (const location_type& l);
@@ -1329,12 +1344,12 @@ namespace isc { namespace dhcp {
     enum
     {
       yyeof_ = 0,
-      yylast_ = 729,     ///< Last index in yytable_.
-      yynnts_ = 306,  ///< Number of nonterminal symbols.
+      yylast_ = 741,     ///< Last index in yytable_.
+      yynnts_ = 309,  ///< Number of nonterminal symbols.
       yyfinal_ = 24, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 135  ///< Number of tokens.
+      yyntokens_ = 138  ///< Number of tokens.
     };
 
 
@@ -1389,9 +1404,10 @@ namespace isc { namespace dhcp {
       95,    96,    97,    98,    99,   100,   101,   102,   103,   104,
      105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
      115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
-     125,   126,   127,   128,   129,   130,   131,   132,   133,   134
+     125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
+     135,   136,   137
     };
-    const unsigned int user_token_number_max_ = 389;
+    const unsigned int user_token_number_max_ = 392;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1424,28 +1440,28 @@ namespace isc { namespace dhcp {
   {
       switch (other.type_get ())
     {
-      case 148: // value
-      case 152: // map_value
-      case 190: // socket_type
-      case 199: // db_type
-      case 404: // ncr_protocol_value
-      case 412: // replace_client_name_value
+      case 151: // value
+      case 155: // map_value
+      case 193: // socket_type
+      case 202: // db_type
+      case 410: // ncr_protocol_value
+      case 418: // replace_client_name_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 134: // "boolean"
+      case 137: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 133: // "floating point"
+      case 136: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 132: // "integer"
+      case 135: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 131: // "constant string"
+      case 134: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1466,28 +1482,28 @@ namespace isc { namespace dhcp {
     (void) v;
       switch (this->type_get ())
     {
-      case 148: // value
-      case 152: // map_value
-      case 190: // socket_type
-      case 199: // db_type
-      case 404: // ncr_protocol_value
-      case 412: // replace_client_name_value
+      case 151: // value
+      case 155: // map_value
+      case 193: // socket_type
+      case 202: // db_type
+      case 410: // ncr_protocol_value
+      case 418: // replace_client_name_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 134: // "boolean"
+      case 137: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 133: // "floating point"
+      case 136: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 132: // "integer"
+      case 135: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 131: // "constant string"
+      case 134: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1567,28 +1583,28 @@ namespace isc { namespace dhcp {
     // Type destructor.
     switch (yytype)
     {
-      case 148: // value
-      case 152: // map_value
-      case 190: // socket_type
-      case 199: // db_type
-      case 404: // ncr_protocol_value
-      case 412: // replace_client_name_value
+      case 151: // value
+      case 155: // map_value
+      case 193: // socket_type
+      case 202: // db_type
+      case 410: // ncr_protocol_value
+      case 418: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 134: // "boolean"
+      case 137: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 133: // "floating point"
+      case 136: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 132: // "integer"
+      case 135: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 131: // "constant string"
+      case 134: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1615,28 +1631,28 @@ namespace isc { namespace dhcp {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 148: // value
-      case 152: // map_value
-      case 190: // socket_type
-      case 199: // db_type
-      case 404: // ncr_protocol_value
-      case 412: // replace_client_name_value
+      case 151: // value
+      case 155: // map_value
+      case 193: // socket_type
+      case 202: // db_type
+      case 410: // ncr_protocol_value
+      case 418: // replace_client_name_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 134: // "boolean"
+      case 137: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 133: // "floating point"
+      case 136: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 132: // "integer"
+      case 135: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 131: // "constant string"
+      case 134: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -1708,7 +1724,7 @@ namespace isc { namespace dhcp {
      355,   356,   357,   358,   359,   360,   361,   362,   363,   364,
      365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
      375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
-     385,   386,   387,   388,   389
+     385,   386,   387,   388,   389,   390,   391,   392
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -1917,6 +1933,18 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_CONNECT_TIMEOUT, l);
   }
 
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_CONNECTION_POOL_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CONNECTION_POOL_SIZE, l);
+  }
+
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_CACHE_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CACHE_SIZE, l);
+  }
+
   Dhcp4Parser::symbol_type
   Dhcp4Parser::make_CONTACT_POINTS (const location_type& l)
   {
@@ -2205,6 +2233,12 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, l);
   }
 
+  Dhcp4Parser::symbol_type
+  Dhcp4Parser::make_REUSE_QUARANTINE_TIME (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_REUSE_QUARANTINE_TIME, l);
+  }
+
   Dhcp4Parser::symbol_type
   Dhcp4Parser::make_MAX_RECLAIM_LEASES (const location_type& l)
   {
@@ -2514,7 +2548,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp4_parser.yy" // lalr1.cc:377
 } } // isc::dhcp
-#line 2518 "dhcp4_parser.h" // lalr1.cc:377
+#line 2552 "dhcp4_parser.h" // lalr1.cc:377
 
 
 
@@ -40,6 +40,7 @@
 #include <hooks/hooks_log.h>
 #include <hooks/hooks_manager.h>
 #include <stats/stats_mgr.h>
+#include <util/pool_allocator.h>
 #include <util/strutil.h>
 #include <stats/stats_mgr.h>
 #include <log/logger.h>
@@ -60,6 +61,7 @@
 #include <boost/algorithm/string/join.hpp>
 #include <boost/bind.hpp>
 #include <boost/foreach.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <iomanip>
@@ -83,6 +85,8 @@ struct Dhcp4Hooks {
     int hook_index_pkt4_send_;      ///< index for "pkt4_send" hook point
     int hook_index_buffer4_send_;   ///< index for "buffer4_send" hook point
     int hook_index_lease4_decline_; ///< index for "lease4_decline" hook point
+    int hook_index_lease4_select_;  ///< index for "lease4_select" hook point
+    int hook_index_lease4_renew_;   ///< index for "lease4_renew" hook point
 
     /// Constructor that registers hook points for DHCPv4 engine
     Dhcp4Hooks() {
@@ -93,6 +97,8 @@ struct Dhcp4Hooks {
         hook_index_lease4_release_ = HooksManager::registerHook("lease4_release");
         hook_index_buffer4_send_   = HooksManager::registerHook("buffer4_send");
         hook_index_lease4_decline_ = HooksManager::registerHook("lease4_decline");
+        hook_index_lease4_select_  = HooksManager::registerHook("lease4_select");
+        hook_index_lease4_renew_   = HooksManager::registerHook("lease4_renew");
     }
 };
 
@@ -102,6 +108,44 @@ struct Dhcp4Hooks {
 // module is called.
 Dhcp4Hooks Hooks;
 
+namespace {
+
+/// @brief Options used in the processing of every query.
+///
+/// In the lazy unpack mode, these options are parsed right after the
+/// query is unpacked. The query carrying a malformed instance of any of
+/// these options is dropped as a parse failure, as in the regular mode.
+const uint16_t VALIDATED_OPTIONS[] = {
+    DHO_DHCP_MESSAGE_TYPE,
+    DHO_DHCP_SERVER_IDENTIFIER,
+    DHO_DHCP_CLIENT_IDENTIFIER,
+    DHO_DHCP_REQUESTED_ADDRESS,
+    DHO_VENDOR_CLASS_IDENTIFIER,
+    DHO_DHCP_AGENT_OPTIONS,
+    DHO_SUBNET_SELECTION
+};
+
+/// @brief Logs and counts the query dropped because it failed to parse.
+///
+/// @param query Dropped query.
+/// @param reason Description of the parse error.
+void
+dropUnparsableQuery(const Pkt4Ptr& query, const std::string& reason) {
+    LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_DROP_0001)
+        .arg(query->getRemoteAddr().toText())
+        .arg(query->getLocalAddr().toText())
+        .arg(query->getIface())
+        .arg(reason);
+
+    // Increase the statistics of parse failures and dropped packets.
+    StatsMgr::instance().addValue("pkt4-parse-failed",
+                                  static_cast<int64_t>(1));
+    StatsMgr::instance().addValue("pkt4-receive-drop",
+                                  static_cast<int64_t>(1));
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
@@ -109,7 +153,8 @@ Dhcpv4Exchange::Dhcpv4Exchange(const AllocEnginePtr& alloc_engine,
                                const Pkt4Ptr& query,
                                const Subnet4Ptr& subnet)
     : alloc_engine_(alloc_engine), query_(query), resp_(),
-      context_(new AllocEngine::ClientContext4()) {
+      context_(boost::allocate_shared<AllocEngine::ClientContext4>(
+                   util::PoolAllocator<AllocEngine::ClientContext4>())) {
 
     if (!alloc_engine_) {
         isc_throw(BadValue, "alloc_engine value must not be NULL"
@@ -185,7 +230,9 @@ Dhcpv4Exchange::initResponse() {
     }
     // Only create a response if one is required.
     if (resp_type > 0) {
-        resp_.reset(new Pkt4(resp_type, getQuery()->getTransid()));
+        resp_ = boost::allocate_shared<Pkt4>(util::PoolAllocator<Pkt4>(),
+                                             resp_type,
+                                             getQuery()->getTransid());
         copyDefaultFields();
         copyDefaultOptions();
 
@@ -381,7 +428,8 @@ const std::string Dhcpv4Srv::VENDOR_CLASS_PREFIX("VENDOR_CLASS_");
 Dhcpv4Srv::Dhcpv4Srv(uint16_t port, const bool use_bcast,
                      const bool direct_response_desired)
     : shutdown_(true), alloc_engine_(), port_(port),
-      use_bcast_(use_bcast) {
+      use_bcast_(use_bcast), requested_options_cache_(),
+      requested_options_cache_seq_(0) {
 
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_OPEN_SOCKET).arg(port);
     try {
@@ -417,6 +465,14 @@ Dhcpv4Srv::Dhcpv4Srv(uint16_t port, const bool use_bcast,
 }
 
 Dhcpv4Srv::~Dhcpv4Srv() {
+    // The lookups of the parked packets may still complete. Make sure
+    // they don't use this server.
+    for (std::multimap<std::vector<uint8_t>, ParkedExchangePtr>::const_iterator
+             parked = parked_exchanges_.begin();
+         parked != parked_exchanges_.end(); ++parked) {
+        parked->second->srv_ = NULL;
+    }
+
     try {
         stopD2();
     } catch(const std::exception& ex) {
@@ -617,6 +673,9 @@ Dhcpv4Srv::selectSubnet4o6(const Pkt4Ptr& query) const {
         // We're reusing callout_handle from previous calls
         callout_handle->deleteAllArguments();
 
+        // The callouts may access the options of the query directly.
+        query->unpackLazyOptions();
+
         // Set new arguments
         callout_handle->setArgument("query4", query);
         callout_handle->setArgument("subnet4", subnet);
@@ -770,68 +829,7 @@ Dhcpv4Srv::run_one() {
         return;
     }
 
-    try {
-        // Now all fields and options are constructed into output wire buffer.
-        // Option objects modification does not make sense anymore. Hooks
-        // can only manipulate wire buffer at this stage.
-        // Let's execute all callouts registered for buffer4_send
-        if (HooksManager::calloutsPresent(Hooks.hook_index_buffer4_send_)) {
-            CalloutHandlePtr callout_handle = getCalloutHandle(query);
-
-            // Delete previously set arguments
-            callout_handle->deleteAllArguments();
-
-            // Enable copying options from the packet within hook library.
-            ScopedEnableOptionsCopy<Pkt4> resp4_options_copy(rsp);
-
-            // Pass incoming packet as argument
-            callout_handle->setArgument("response4", rsp);
-
-            // Call callouts
-            HooksManager::callCallouts(Hooks.hook_index_buffer4_send_,
-                                       *callout_handle);
-
-            // Callouts decided to skip the next processing step. The next
-            // processing step would to parse the packet, so skip at this
-            // stage means drop.
-            if (callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP) {
-                LOG_DEBUG(hooks_logger, DBG_DHCP4_HOOKS,
-                          DHCP4_HOOK_BUFFER_SEND_SKIP)
-                    .arg(rsp->getLabel());
-                return;
-            }
-
-            /// @todo: Add support for DROP status.
-
-            callout_handle->getArgument("response4", rsp);
-        }
-
-        LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_SEND)
-            .arg(rsp->getLabel())
-            .arg(rsp->getName())
-            .arg(static_cast<int>(rsp->getType()))
-            .arg(rsp->getLocalAddr())
-            .arg(rsp->getLocalPort())
-            .arg(rsp->getRemoteAddr())
-            .arg(rsp->getRemotePort())
-            .arg(rsp->getIface());
-
-        LOG_DEBUG(packet4_logger, DBG_DHCP4_DETAIL_DATA,
-                  DHCP4_RESPONSE_DATA)
-            .arg(rsp->getLabel())
-            .arg(rsp->getName())
-            .arg(static_cast<int>(rsp->getType()))
-            .arg(rsp->toText());
-        sendPacket(rsp);
-
-        // Update statistics accordingly for sent packet.
-        processStatsSent(rsp);
-
-    } catch (const std::exception& e) {
-        LOG_ERROR(packet4_logger, DHCP4_PACKET_SEND_FAIL)
-            .arg(rsp->getLabel())
-            .arg(e.what());
-    }
+    processPacketBufferSend(query, rsp);
 }
 
 void
@@ -889,21 +887,34 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
                 .arg(query->getRemoteAddr().toText())
                 .arg(query->getLocalAddr().toText())
                 .arg(query->getIface());
+            // Parse the options on demand. Most of the options sent by
+            // the clients are never used by the server.
+            query->setLazyUnpack(true);
             query->unpack();
+
+            // The callouts may access any option of the query, so there
+            // is no point in deferring the parsing. Otherwise, parse the
+            // options used for every query. The options which are
+            // retrieved later throw MalformedOption if they fail to
+            // parse and the query is dropped then.
+            if (HooksManager::calloutsPresent(Hooks.hook_index_pkt4_receive_) ||
+                HooksManager::calloutsPresent(Hooks.hook_index_subnet4_select_) ||
+                HooksManager::calloutsPresent(Hooks.hook_index_lease4_release_) ||
+                HooksManager::calloutsPresent(Hooks.hook_index_lease4_decline_) ||
+                HooksManager::calloutsPresent(Hooks.hook_index_lease4_select_) ||
+                HooksManager::calloutsPresent(Hooks.hook_index_lease4_renew_) ||
+                HooksManager::calloutsPresent(Hooks.hook_index_pkt4_send_)) {
+                query->unpackLazyOptions();
+
+            } else {
+                for (size_t i = 0; i < sizeof(VALIDATED_OPTIONS) /
+                         sizeof(VALIDATED_OPTIONS[0]); ++i) {
+                    query->unpackLazyOptions(VALIDATED_OPTIONS[i]);
+                }
+            }
         } catch (const std::exception& e) {
             // Failed to parse the packet.
-            LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_DETAIL,
-                      DHCP4_PACKET_DROP_0001)
-                .arg(query->getRemoteAddr().toText())
-                .arg(query->getLocalAddr().toText())
-                .arg(query->getIface())
-                .arg(e.what());
-
-            // Increase the statistics of parse failures and dropped packets.
-            isc::stats::StatsMgr::instance().addValue("pkt4-parse-failed",
-                                                      static_cast<int64_t>(1));
-            isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
-                                                      static_cast<int64_t>(1));
+            dropUnparsableQuery(query, e.what());
             return;
         }
     }
@@ -914,7 +925,14 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
     // Assign this packet to one or more classes if needed. We need to do
     // this before calling accept(), because getSubnet4() may need client
     // class information.
-    classifyPacket(query);
+    try {
+        classifyPacket(query);
+
+    } catch (const MalformedOption& e) {
+        // The class expression referenced a malformed option.
+        dropUnparsableQuery(query, e.what());
+        return;
+    }
 
     // Check whether the message should be further processed or discarded.
     // There is no need to log anything here. This function logs by itself.
@@ -1002,6 +1020,10 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
             // "switch" statement.
             ;
         }
+    } catch (const MalformedOption& e) {
+        // An option retrieved while processing the query failed to parse.
+        dropUnparsableQuery(query, e.what());
+
     } catch (const std::exception& e) {
 
         // Catch-all exception (we used to call only isc::Exception, but
@@ -1025,6 +1047,11 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
         return;
     }
 
+    processPacketPktSend(query, rsp);
+}
+
+void
+Dhcpv4Srv::processPacketPktSend(Pkt4Ptr& query, Pkt4Ptr& rsp) {
     // Specifies if server should do the packing
     bool skip_pack = false;
 
@@ -1078,6 +1105,72 @@ Dhcpv4Srv::processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp) {
     }
 }
 
+void
+Dhcpv4Srv::processPacketBufferSend(Pkt4Ptr& query, Pkt4Ptr& rsp) {
+    try {
+        // Now all fields and options are constructed into output wire buffer.
+        // Option objects modification does not make sense anymore. Hooks
+        // can only manipulate wire buffer at this stage.
+        // Let's execute all callouts registered for buffer4_send
+        if (HooksManager::calloutsPresent(Hooks.hook_index_buffer4_send_)) {
+            CalloutHandlePtr callout_handle = getCalloutHandle(query);
+
+            // Delete previously set arguments
+            callout_handle->deleteAllArguments();
+
+            // Enable copying options from the packet within hook library.
+            ScopedEnableOptionsCopy<Pkt4> resp4_options_copy(rsp);
+
+            // Pass incoming packet as argument
+            callout_handle->setArgument("response4", rsp);
+
+            // Call callouts
+            HooksManager::callCallouts(Hooks.hook_index_buffer4_send_,
+                                       *callout_handle);
+
+            // Callouts decided to skip the next processing step. The next
+            // processing step would to parse the packet, so skip at this
+            // stage means drop.
+            if (callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP) {
+                LOG_DEBUG(hooks_logger, DBG_DHCP4_HOOKS,
+                          DHCP4_HOOK_BUFFER_SEND_SKIP)
+                    .arg(rsp->getLabel());
+                return;
+            }
+
+            /// @todo: Add support for DROP status.
+
+            callout_handle->getArgument("response4", rsp);
+        }
+
+        LOG_DEBUG(packet4_logger, DBG_DHCP4_BASIC, DHCP4_PACKET_SEND)
+            .arg(rsp->getLabel())
+            .arg(rsp->getName())
+            .arg(static_cast<int>(rsp->getType()))
+            .arg(rsp->getLocalAddr())
+            .arg(rsp->getLocalPort())
+            .arg(rsp->getRemoteAddr())
+            .arg(rsp->getRemotePort())
+            .arg(rsp->getIface());
+
+        LOG_DEBUG(packet4_logger, DBG_DHCP4_DETAIL_DATA,
+                  DHCP4_RESPONSE_DATA)
+            .arg(rsp->getLabel())
+            .arg(rsp->getName())
+            .arg(static_cast<int>(rsp->getType()))
+            .arg(rsp->toText());
+        sendPacket(rsp);
+
+        // Update statistics accordingly for sent packet.
+        processStatsSent(rsp);
+
+    } catch (const std::exception& e) {
+        LOG_ERROR(packet4_logger, DHCP4_PACKET_SEND_FAIL)
+            .arg(rsp->getLabel())
+            .arg(e.what());
+    }
+}
+
 string
 Dhcpv4Srv::srvidToString(const OptionPtr& srvid) {
     if (!srvid) {
@@ -1200,22 +1293,34 @@ Dhcpv4Srv::appendRequestedOptions(Dhcpv4Exchange& ex) {
 
     // Get the codes of requested options.
     const std::vector<uint8_t>& requested_opts = option_prl->getValues();
-    // For each requested option code get the instance of the option
-    // to be returned to the client.
-    for (std::vector<uint8_t>::const_iterator opt = requested_opts.begin();
-         opt != requested_opts.end(); ++opt) {
-        // Add nothing when it is already there
-        if (!resp->getOption(*opt)) {
-            // Iterate on the configured option list
-            for (CfgOptionList::const_iterator copts = co_list.begin();
-                 copts != co_list.end(); ++copts) {
-                OptionDescriptor desc = (*copts)->get(DHCP4_OPTION_SPACE, *opt);
-                // Got it: add it and jump to the outer loop
-                if (desc.option_) {
-                    resp->addOption(desc.option_);
-                    break;
-                }
-            }
+
+    // Clients in the same subnet and classes typically request the same
+    // options, so the options found for them are cached. Host specific
+    // options are not cached because the host objects returned by the
+    // host databases are different for each query.
+    CfgOptionListCache::OptionPtrVector host_opts;
+    const CfgOptionListCache::OptionPtrVector* opts = &host_opts;
+    const ConstHostPtr& host = ex.getContext()->host_;
+    if (host && !host->getCfgOption4()->empty()) {
+        CfgOptionListCache::find(co_list, DHCP4_OPTION_SPACE, requested_opts,
+                                 host_opts);
+
+    } else {
+        // Drop the options cached for the previous configuration.
+        const uint32_t seq = CfgMgr::instance().getCurrentCfg()->getSequence();
+        if (seq != requested_options_cache_seq_) {
+            requested_options_cache_.clear();
+            requested_options_cache_seq_ = seq;
+        }
+        opts = &requested_options_cache_.get(co_list, DHCP4_OPTION_SPACE,
+                                             requested_opts);
+    }
+
+    // Add the options to the response unless they are already there.
+    for (CfgOptionListCache::OptionPtrVector::const_iterator opt =
+             opts->begin(); opt != opts->end(); ++opt) {
+        if (!resp->getOption((*opt)->getType())) {
+            resp->addOption(*opt);
         }
     }
 }
@@ -1351,6 +1456,10 @@ Dhcpv4Srv::processClientName(Dhcpv4Exchange& ex) {
                     .arg(ex.getQuery()->getLabel());
             processHostnameOption(ex);
         }
+    } catch (const MalformedOption&) {
+        // The query carrying the malformed option is dropped.
+        throw;
+
     } catch (const Exception& e) {
         // In some rare cases it is possible that the client's name processing
         // fails. For example, the Hostname option may be malformed, or there
@@ -2105,14 +2214,25 @@ Pkt4Ptr
 Dhcpv4Srv::processDiscover(Pkt4Ptr& discover) {
     sanityCheck(discover, FORBIDDEN);
 
-    Dhcpv4Exchange ex(alloc_engine_, discover, selectSubnet(discover));
+    Dhcpv4ExchangePtr ex(new Dhcpv4Exchange(alloc_engine_, discover,
+                                            selectSubnet(discover)));
 
     // If DHCPDISCOVER message contains the FQDN or Hostname option, server
     // may respond to the client with the appropriate FQDN or Hostname
     // option to indicate that whether it will take responsibility for
     // updating DNS when the client sends DHCPREQUEST message.
-    processClientName(ex);
+    processClientName(*ex);
 
+    // Process other packets while the client's lease is fetched.
+    if (parkExchange(ex, boost::bind(&Dhcpv4Srv::completeDiscover, this, _1))) {
+        return (Pkt4Ptr());
+    }
+
+    return (completeDiscover(*ex));
+}
+
+Pkt4Ptr
+Dhcpv4Srv::completeDiscover(Dhcpv4Exchange& ex) {
     assignLease(ex);
 
     if (!ex.getResponse()) {
@@ -2154,13 +2274,28 @@ Dhcpv4Srv::processRequest(Pkt4Ptr& request) {
     /// @todo Uncomment this (see ticket #3116)
     /// sanityCheck(request, MANDATORY);
 
-    Dhcpv4Exchange ex(alloc_engine_, request, selectSubnet(request));
+    Dhcpv4ExchangePtr ex(new Dhcpv4Exchange(alloc_engine_, request,
+                                            selectSubnet(request)));
 
     // If DHCPREQUEST message contains the FQDN or Hostname option, server
     // should respond to the client with the appropriate FQDN or Hostname
     // option to indicate if it takes responsibility for the DNS updates.
     // This is performed by the function below.
-    processClientName(ex);
+    processClientName(*ex);
+
+    // Process other packets while the client's lease is fetched.
+    if (parkExchange(ex, boost::bind(&Dhcpv4Srv::completeRequest, this, _1))) {
+        return (Pkt4Ptr());
+    }
+
+    return (completeRequest(*ex));
+}
+
+Pkt4Ptr
+Dhcpv4Srv::completeRequest(Dhcpv4Exchange& ex) {
+    // The lease of the client is about to change, so the leases fetched
+    // for its other parked packets are no longer valid.
+    invalidateFetchedLeases(ex.getQuery());
 
     // Note that we treat REQUEST message uniformly, regardless if this is a
     // first request (requesting for new address), renewing existing address
@@ -2196,11 +2331,186 @@ Dhcpv4Srv::processRequest(Pkt4Ptr& request) {
     return (ex.getResponse());
 }
 
+void
+Dhcpv4Srv::asyncGetClientLease(const AllocEngine::ClientContext4& ctx,
+                               const bool by_client_id,
+                               const Lease4Handler& handler) {
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    if (by_client_id) {
+        lease_mgr.asyncGetLease4(*ctx.clientid_, ctx.subnet_->getID(), handler);
+    } else {
+        lease_mgr.asyncGetLease4(*ctx.hwaddr_, ctx.subnet_->getID(), handler);
+    }
+}
+
+bool
+Dhcpv4Srv::parkExchange(const Dhcpv4ExchangePtr& ex,
+                        const boost::function<Pkt4Ptr (Dhcpv4Exchange&)>& complete) {
+    AllocEngine::ClientContext4Ptr ctx = ex->getContext();
+
+    // Leave the lookup to the allocation engine when the lease can't be
+    // allocated anyway. The responses to the DHCPv4-over-DHCPv6 messages
+    // are sent by the caller, so these messages can't be parked.
+    if (!ctx->subnet_ || !ctx->hwaddr_ || ex->getQuery()->isDhcp4o6()) {
+        return (false);
+    }
+
+    ParkedExchangePtr parked(new ParkedExchange());
+    parked->srv_ = this;
+    parked->ex_ = ex;
+    parked->complete_ = complete;
+    parked->parked_ = false;
+    parked->done_ = false;
+    parked->stale_ = false;
+
+    // The lookup may complete immediately, e.g. for the memfile backend.
+    lookupClientLease(parked, static_cast<bool>(ctx->clientid_));
+    if (parked->done_) {
+        return (false);
+    }
+
+    parked->parked_ = true;
+    parked_exchanges_.insert(std::make_pair(ctx->hwaddr_->hwaddr_, parked));
+
+    LOG_DEBUG(packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_PARKED)
+        .arg(ex->getQuery()->getLabel());
+
+    return (true);
+}
+
+void
+Dhcpv4Srv::lookupClientLease(const ParkedExchangePtr& parked,
+                             const bool by_client_id) {
+    try {
+        asyncGetClientLease(*parked->ex_->getContext(), by_client_id,
+                            boost::bind(&Dhcpv4Srv::clientLeaseFetched, parked,
+                                        by_client_id, _1, _2));
+    } catch (const std::exception& ex) {
+        clientLeaseFetched(parked, by_client_id, Lease4Ptr(), ex.what());
+    }
+}
+
+void
+Dhcpv4Srv::clientLeaseFetched(const ParkedExchangePtr& parked,
+                              const bool by_client_id,
+                              const Lease4Ptr& lease,
+                              const std::string& error) {
+    Dhcpv4Srv* srv = parked->srv_;
+    if (!srv || parked->done_) {
+        return;
+    }
+
+    AllocEngine::ClientContext4Ptr ctx = parked->ex_->getContext();
+    if (!error.empty()) {
+        // The allocation engine will look up the lease again.
+        LOG_DEBUG(packet4_logger, DBG_DHCP4_DETAIL, DHCP4_CLIENT_LEASE_LOOKUP_FAIL)
+            .arg(parked->ex_->getQuery()->getLabel())
+            .arg(error);
+
+    } else if (lease) {
+        // The lease found by the HW address may belong to another client
+        // using the same HW address. The allocation engine deals with it.
+        if (by_client_id || lease->belongsToClient(ctx->hwaddr_, ctx->clientid_)) {
+            ctx->client_lease_ = lease;
+            ctx->client_lease_fetched_ = !parked->stale_;
+        }
+
+    } else if (by_client_id) {
+        // No lease for the client identifier, try the HW address.
+        srv->lookupClientLease(parked, false);
+        return;
+
+    } else {
+        // The client has no lease in this subnet.
+        ctx->client_lease_fetched_ = !parked->stale_;
+    }
+
+    parked->done_ = true;
+    if (parked->parked_) {
+        srv->resumeExchange(parked);
+    }
+}
+
+void
+Dhcpv4Srv::resumeExchange(const ParkedExchangePtr& parked) {
+    Pkt4Ptr query = parked->ex_->getQuery();
+
+    typedef std::multimap<std::vector<uint8_t>, ParkedExchangePtr>::iterator
+        ParkedIterator;
+    std::pair<ParkedIterator, ParkedIterator> range =
+        parked_exchanges_.equal_range(parked->ex_->getContext()->hwaddr_->hwaddr_);
+    for (ParkedIterator it = range.first; it != range.second; ++it) {
+        if (it->second == parked) {
+            parked_exchanges_.erase(it);
+            break;
+        }
+    }
+
+    LOG_DEBUG(packet4_logger, DBG_DHCP4_DETAIL, DHCP4_PACKET_RESUMED)
+        .arg(query->getLabel());
+
+    Pkt4Ptr rsp;
+    try {
+        rsp = parked->complete_(*parked->ex_);
+
+    } catch (const MalformedOption& e) {
+        dropUnparsableQuery(query, e.what());
+        return;
+
+    } catch (const std::exception& e) {
+        LOG_DEBUG(bad_packet4_logger, DBG_DHCP4_BASIC,
+                  DHCP4_PACKET_DROP_0007)
+            .arg(query->getLabel())
+            .arg(e.what());
+
+        // Increase the statistic of dropped packets.
+        isc::stats::StatsMgr::instance().addValue("pkt4-receive-drop",
+                                                  static_cast<int64_t>(1));
+        return;
+    }
+
+    if (!rsp) {
+        return;
+    }
+
+    try {
+        processPacketPktSend(query, rsp);
+        processPacketBufferSend(query, rsp);
+
+    } catch (const std::exception& e) {
+        LOG_ERROR(packet4_logger, DHCP4_PACKET_PROCESS_STD_EXCEPTION)
+            .arg(e.what());
+    }
+}
+
+void
+Dhcpv4Srv::invalidateFetchedLeases(const Pkt4Ptr& query) {
+    HWAddrPtr hwaddr = query->getHWAddr();
+    if (!hwaddr || parked_exchanges_.empty()) {
+        return;
+    }
+
+    typedef std::multimap<std::vector<uint8_t>, ParkedExchangePtr>::iterator
+        ParkedIterator;
+    std::pair<ParkedIterator, ParkedIterator> range =
+        parked_exchanges_.equal_range(hwaddr->hwaddr_);
+    for (ParkedIterator it = range.first; it != range.second; ++it) {
+        it->second->stale_ = true;
+        AllocEngine::ClientContext4Ptr ctx = it->second->ex_->getContext();
+        ctx->client_lease_.reset();
+        ctx->client_lease_fetched_ = false;
+    }
+}
+
 void
 Dhcpv4Srv::processRelease(Pkt4Ptr& release) {
     /// @todo Uncomment this (see ticket #3116)
     /// sanityCheck(release, MANDATORY);
 
+    // The leases fetched for the parked packets of this client may
+    // become invalid.
+    invalidateFetchedLeases(release);
+
     // Try to find client-id. Note that for the DHCPRELEASE we don't check if the
     // match-client-id configuration parameter is disabled because this parameter
     // is configured for subnets and we don't select subnet for the DHCPRELEASE.
@@ -2290,6 +2600,10 @@ Dhcpv4Srv::processRelease(Pkt4Ptr& release) {
                 // Remove existing DNS entries for the lease, if any.
                 queueNCR(CHG_REMOVE, lease);
 
+                // The released address can be handed out to other clients
+                // ahead of the rest of the pool.
+                AllocEngine::queueFreeAddress(lease);
+
             } else {
                 // Release failed
                 LOG_ERROR(lease4_logger, DHCP4_RELEASE_FAIL)
@@ -2312,6 +2626,10 @@ Dhcpv4Srv::processDecline(Pkt4Ptr& decline) {
     /// @todo Uncomment this (see ticket #3116)
     // sanityCheck(decline, MANDATORY);
 
+    // The leases fetched for the parked packets of this client may
+    // become invalid.
+    invalidateFetchedLeases(decline);
+
     // Client is supposed to specify the address being declined in
     // Requested IP address option, but must not set its ciaddr.
     // (again, see table 5 in RFC2131).
@@ -2725,6 +3043,9 @@ void Dhcpv4Srv::classifyPacket(const Pkt4Ptr& pkt) {
                     .arg(it->first)
                     .arg(status);
             }
+        } catch (const MalformedOption&) {
+            // The query is dropped by the caller.
+            throw;
         } catch (const Exception& ex) {
             LOG_ERROR(options4_logger, EVAL_RESULT)
                 .arg(it->first)
@@ -18,12 +18,15 @@
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/alloc_engine.h>
 #include <dhcpsrv/cfg_option.h>
+#include <dhcpsrv/lease_mgr.h>
 #include <hooks/callout_handle.h>
 #include <dhcpsrv/daemon.h>
 
+#include <boost/function.hpp>
 #include <boost/noncopyable.hpp>
 
 #include <iostream>
+#include <map>
 #include <queue>
 
 // Undefine the macro OPTIONAL which is defined in some operating
@@ -246,10 +249,33 @@ public:
     /// It verifies correctness of the passed packet, call per-type processXXX
     /// methods, generates appropriate answer.
     ///
+    /// The DHCPDISCOVER and DHCPREQUEST may be parked while the client's
+    /// lease is fetched from the lease database. In this case the response
+    /// is not returned. It is sent when the processing of the packet is
+    /// resumed.
+    ///
     /// @param query A pointer to the packet to be processed.
     /// @param rsp A pointer to the response
     void processPacket(Pkt4Ptr& query, Pkt4Ptr& rsp);
 
+    /// @brief Executes pkt4_send callouts and packs the response.
+    ///
+    /// @param query A pointer to the client's message.
+    /// @param rsp A pointer to the response.
+    void processPacketPktSend(Pkt4Ptr& query, Pkt4Ptr& rsp);
+
+    /// @brief Executes buffer4_send callouts and sends the response.
+    ///
+    /// @param query A pointer to the client's message.
+    /// @param rsp A pointer to the response.
+    void processPacketBufferSend(Pkt4Ptr& query, Pkt4Ptr& rsp);
+
+    /// @brief Returns the number of packets parked until the client's
+    /// lease is fetched.
+    size_t getParkedPacketsCount() const {
+        return (parked_exchanges_.size());
+    }
+
     /// @brief Instructs the server to shut down.
     void shutdown();
 
@@ -422,9 +448,21 @@ protected:
     ///
     /// @param discover DISCOVER message received from client
     ///
+    /// The packet may be parked while the client's lease is fetched. In
+    /// this case NULL is returned and the OFFER is sent when the processing
+    /// is resumed.
+    ///
     /// @return OFFER message or NULL
     Pkt4Ptr processDiscover(Pkt4Ptr& discover);
 
+    /// @brief Completes the processing of the DHCPDISCOVER once the
+    /// client's lease has been fetched.
+    ///
+    /// @param ex DHCPv4 exchange holding the client's message.
+    ///
+    /// @return OFFER message or NULL
+    Pkt4Ptr completeDiscover(Dhcpv4Exchange& ex);
+
     /// @brief Processes incoming REQUEST and returns REPLY response.
     ///
     /// Processes incoming REQUEST message and verifies that its sender
@@ -434,11 +472,38 @@ protected:
     ///
     /// Returns ACK message, NAK message, or NULL
     ///
+    /// The packet may be parked while the client's lease is fetched. In
+    /// this case NULL is returned and the response is sent when the
+    /// processing is resumed.
+    ///
     /// @param request a message received from client
     ///
     /// @return ACK or NAK message
     Pkt4Ptr processRequest(Pkt4Ptr& request);
 
+    /// @brief Completes the processing of the DHCPREQUEST once the
+    /// client's lease has been fetched.
+    ///
+    /// @param ex DHCPv4 exchange holding the client's message.
+    ///
+    /// @return ACK or NAK message
+    Pkt4Ptr completeRequest(Dhcpv4Exchange& ex);
+
+    /// @brief Issues an asynchronous lookup of the client's lease.
+    ///
+    /// This method is useful for testing purposes, where its replacement
+    /// can delay the completion of the lookup. For that purpose it is
+    /// protected.
+    ///
+    /// @param ctx Client context holding the selected subnet, the client
+    /// identifier and the HW address.
+    /// @param by_client_id Look up the lease by the client identifier if
+    /// true, by the HW address otherwise.
+    /// @param handler Callback invoked when the lookup completes.
+    virtual void asyncGetClientLease(const AllocEngine::ClientContext4& ctx,
+                                     const bool by_client_id,
+                                     const Lease4Handler& handler);
+
     /// @brief Processes incoming DHCPRELEASE messages.
     ///
     /// In DHCPv4, server does not respond to RELEASE messages, therefore
@@ -819,6 +884,95 @@ private:
     uint16_t port_;  ///< UDP port number on which server listens.
     bool use_bcast_; ///< Should broadcast be enabled on sockets (if true).
 
+    /// @brief Exchange waiting for the lookup of the client's lease.
+    struct ParkedExchange {
+        /// @brief Server processing the exchange or NULL if the server
+        /// has been destroyed.
+        Dhcpv4Srv* srv_;
+
+        /// @brief The parked exchange.
+        Dhcpv4ExchangePtr ex_;
+
+        /// @brief Function completing the processing of the exchange.
+        boost::function<Pkt4Ptr (Dhcpv4Exchange&)> complete_;
+
+        /// @brief Indicates if the packet has been parked, i.e. the lookup
+        /// has not completed immediately.
+        bool parked_;
+
+        /// @brief Indicates if the lookup has completed.
+        bool done_;
+
+        /// @brief Indicates if the client's leases have changed since the
+        /// lookup was issued.
+        bool stale_;
+    };
+
+    /// @brief Pointer to the @c ParkedExchange.
+    typedef boost::shared_ptr<ParkedExchange> ParkedExchangePtr;
+
+    /// @brief Fetches the client's lease before the allocation.
+    ///
+    /// The lease is looked up by the client identifier and then by the
+    /// HW address, as the allocation engine would do. If the lease backend
+    /// completes the lookups immediately, the lease is stored in the
+    /// client context and false is returned, so as the caller completes
+    /// the exchange. Otherwise the packet is parked and @c complete is
+    /// called when the lookups are complete.
+    ///
+    /// @param ex DHCPv4 exchange for which the lease is fetched.
+    /// @param complete Function completing the processing of the exchange.
+    ///
+    /// @return true if the packet has been parked, false otherwise.
+    bool parkExchange(const Dhcpv4ExchangePtr& ex,
+                      const boost::function<Pkt4Ptr (Dhcpv4Exchange&)>& complete);
+
+    /// @brief Issues the lookup of the client's lease for the exchange.
+    ///
+    /// @param parked Exchange waiting for the client's lease.
+    /// @param by_client_id Look up the lease by the client identifier if
+    /// true, by the HW address otherwise.
+    void lookupClientLease(const ParkedExchangePtr& parked,
+                           const bool by_client_id);
+
+    /// @brief Handles the completion of the lookup of the client's lease.
+    ///
+    /// @param parked Exchange waiting for the client's lease.
+    /// @param by_client_id Indicates if the lease has been looked up by the
+    /// client identifier.
+    /// @param lease Lease found or null.
+    /// @param error Error description or empty string.
+    static void clientLeaseFetched(const ParkedExchangePtr& parked,
+                                   const bool by_client_id,
+                                   const Lease4Ptr& lease,
+                                   const std::string& error);
+
+    /// @brief Resumes the processing of the parked packet and sends the
+    /// response.
+    ///
+    /// @param parked Exchange which client's lease has been fetched.
+    void resumeExchange(const ParkedExchangePtr& parked);
+
+    /// @brief Discards the leases fetched for the parked packets of the
+    /// client.
+    ///
+    /// This is called when the client's leases are modified, so as the
+    /// parked packets are processed with the current leases.
+    ///
+    /// @param query Client's message which modifies the leases.
+    void invalidateFetchedLeases(const Pkt4Ptr& query);
+
+    /// @brief Packets parked until the client's lease is fetched, by
+    /// the client's HW address.
+    std::multimap<std::vector<uint8_t>, ParkedExchangePtr> parked_exchanges_;
+
+    /// @brief Cache of the options returned for the requested codes.
+    CfgOptionListCache requested_options_cache_;
+
+    /// @brief Sequence of the configuration for which the options
+    /// have been cached.
+    uint32_t requested_options_cache_seq_;
+
 public:
     /// Class methods for DHCPv4-over-DHCPv6 handler
 
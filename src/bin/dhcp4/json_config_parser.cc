@@ -274,6 +274,14 @@ protected:
 /// This is a wrapper parser that handles the whole list of Subnet4
 /// definitions. It iterates over all entries and creates Subnet4ConfigParser
 /// for each entry.
+///
+/// The subnets which have an explicitly specified identifier and whose
+/// configuration is the same as the configuration of the subnet with this
+/// identifier in the current configuration are not parsed. Instead, the
+/// current subnet instances are used in the new configuration. This avoids
+/// parsing and allocation of the unchanged subnets when a large
+/// configuration is updated and preserves the allocation state of these
+/// subnets, e.g. last allocated addresses.
 class Subnets4ListConfigParser : public isc::data::SimpleParser {
 public:
 
@@ -283,21 +291,41 @@ public:
     /// (by instantiating Subnet6ConfigParser) and adds to specified
     /// configuration.
     ///
+    /// @param cfg server configuration to which the subnets are added
     /// @param subnets_list pointer to a list of IPv4 subnets
+    /// @param current_subnets subnets of the current configuration which
+    /// may be reused. If NULL, all subnets are created.
     /// @return number of subnets created
-    size_t parse(SrvConfigPtr cfg, ConstElementPtr subnets_list) {
+    size_t parse(SrvConfigPtr cfg, ConstElementPtr subnets_list,
+                 ConstCfgSubnets4Ptr current_subnets = ConstCfgSubnets4Ptr()) {
         size_t cnt = 0;
         BOOST_FOREACH(ConstElementPtr subnet_json, subnets_list->listValue()) {
 
-            Subnet4ConfigParser parser;
-            Subnet4Ptr subnet = parser.parse(subnet_json);
+            Subnet4Ptr subnet = getUnchanged(current_subnets, subnet_json);
+            if (subnet) {
+                LOG_DEBUG(dhcp4_logger, DBG_DHCP4_DETAIL,
+                          DHCP4_CONFIG_KEEP_SUBNET).arg(subnet->toText());
+
+                // The host reservations are held outside of the subnet,
+                // so they have to be parsed again.
+                ConstElementPtr reservations = subnet_json->get("reservations");
+                if (reservations) {
+                    HostReservationsListParser<HostReservationParser4> parser;
+                    parser.parse(subnet->getID(), reservations);
+                }
+
+            } else {
+                Subnet4ConfigParser parser;
+                subnet = parser.parse(subnet_json);
+            }
+
             if (subnet) {
 
                 // Adding a subnet to the Configuration Manager may fail if the
                 // subnet id is invalid (duplicate). Thus, we catch exceptions
                 // here to append a position in the configuration string.
                 try {
-                    cfg->getCfgSubnets4()->add(subnet);
+                    cfg->getCfgSubnets4()->add(subnet, subnet_json);
                     cnt++;
                 } catch (const std::exception& ex) {
                     isc_throw(DhcpConfigError, ex.what() << " ("
@@ -307,6 +335,37 @@ public:
         }
         return (cnt);
     }
+
+private:
+
+    /// @brief Returns the current subnet if its configuration is unchanged.
+    ///
+    /// @param current_subnets subnets of the current configuration.
+    /// @param subnet_json new configuration of the subnet.
+    /// @return Pointer to the current subnet or NULL if the subnet has to
+    /// be created.
+    Subnet4Ptr getUnchanged(const ConstCfgSubnets4Ptr& current_subnets,
+                            const ConstElementPtr& subnet_json) const {
+        if (!current_subnets) {
+            return (Subnet4Ptr());
+        }
+
+        // Subnets with the autogenerated identifiers are always created
+        // because their identifiers depend on the order of the subnets.
+        ConstElementPtr id = subnet_json->get("id");
+        if (!id || (id->getType() != Element::integer) ||
+            (id->intValue() <= 0)) {
+            return (Subnet4Ptr());
+        }
+
+        SubnetID subnet_id = static_cast<SubnetID>(id->intValue());
+        ConstElementPtr current_json =
+            current_subnets->getSubnetConfig(subnet_id);
+        if (!current_json || !current_json->equals(*subnet_json)) {
+            return (Subnet4Ptr());
+        }
+        return (current_subnets->getSubnet(subnet_id));
+    }
 };
 
 /// @brief Parser that takes care of global DHCPv4 parameters.
@@ -393,14 +452,7 @@ void configureCommandChannel() {
 }
 
 isc::data::ConstElementPtr
-configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
-                     bool check_only) {
-    if (!config_set) {
-        ConstElementPtr answer = isc::config::createAnswer(1,
-                                 string("Can't parse NULL config"));
-        return (answer);
-    }
-
+beginDhcp4Config(isc::data::ConstElementPtr config_set, bool runtime_defs) {
     LOG_DEBUG(dhcp4_logger, DBG_DHCP4_COMMAND,
               DHCP4_CONFIG_START).arg(config_set->str());
 
@@ -408,24 +460,18 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
     // so newly recreated configuration starts with first subnet-id equal 1.
     Subnet::resetSubnetID();
 
-    // Remove any existing timers.
-    TimerMgr::instance()->unregisterTimers();
-
-    // Revert any runtime option definitions configured so far and not committed.
-    LibDHCP::revertRuntimeOptionDefs();
-    // Let's set empty container in case a user hasn't specified any configuration
-    // for option definitions. This is equivalent to commiting empty container.
-    LibDHCP::setRuntimeOptionDefs(OptionDefSpaceContainer());
+    if (runtime_defs) {
+        // Revert any runtime option definitions configured so far and not
+        // committed.
+        LibDHCP::revertRuntimeOptionDefs();
+        // Let's set empty container in case a user hasn't specified any
+        // configuration for option definitions. This is equivalent to
+        // commiting empty container.
+        LibDHCP::setRuntimeOptionDefs(OptionDefSpaceContainer());
+    }
 
-    // Answer will hold the result.
-    ConstElementPtr answer;
-    // Rollback informs whether error occurred and original data
-    // have to be restored to global storages.
-    bool rollback = false;
-    // config_pair holds the details of the current parser when iterating over
-    // the parsers.  It is declared outside the loops so in case of an error,
-    // the name of the failing parser can be retrieved in the "catch" clause.
-    ConfigPair config_pair;
+    // Name of the parameter being parsed, used in the error message.
+    std::string parameter;
     try {
 
         SrvConfigPtr srv_cfg = CfgMgr::instance().getStagingCfg();
@@ -444,11 +490,40 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
         // We need definitions first
         ConstElementPtr option_defs = mutable_cfg->get("option-def");
         if (option_defs) {
+            parameter = "option-def";
             OptionDefListParser parser;
             CfgOptionDefPtr cfg_option_def = srv_cfg->getCfgOptionDef();
-            parser.parse(cfg_option_def, option_defs);
+            parser.parse(cfg_option_def, option_defs, runtime_defs);
         }
 
+    } catch (const isc::Exception& ex) {
+        LOG_ERROR(dhcp4_logger, DHCP4_PARSER_FAIL)
+                  .arg(parameter).arg(ex.what());
+        return (isc::config::createAnswer(1, ex.what()));
+
+    } catch (...) {
+        // For things like bad_cast in boost::lexical_cast
+        LOG_ERROR(dhcp4_logger, DHCP4_PARSER_EXCEPTION).arg(parameter);
+        return (isc::config::createAnswer(1, "undefined configuration"
+                                          " processing error"));
+    }
+
+    return (ConstElementPtr());
+}
+
+isc::data::ConstElementPtr
+parseDhcp4Config(isc::data::ConstElementPtr config_set) {
+    // config_pair holds the details of the current parser when iterating over
+    // the parsers.  It is declared outside the loops so in case of an error,
+    // the name of the failing parser can be retrieved in the "catch" clause.
+    ConfigPair config_pair;
+    try {
+
+        SrvConfigPtr srv_cfg = CfgMgr::instance().getStagingCfg();
+
+        // The defaults have been set by beginDhcp4Config.
+        ElementPtr mutable_cfg = boost::const_pointer_cast<Element>(config_set);
+
         // Make parsers grouping.
         const std::map<std::string, ConstElementPtr>& values_map =
                                                         mutable_cfg->mapValue();
@@ -459,7 +534,8 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
             // with the parser code debugability, so I decided to keep it as a
             // series of independent ifs.
             if (config_pair.first == "option-def") {
-                // This is converted to SimpleParser and is handled already above.
+                // This is converted to SimpleParser and is handled already
+                // by beginDhcp4Config.
                 continue;
             }
 
@@ -538,9 +614,16 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
 
             if (config_pair.first == "subnet4") {
                 SrvConfigPtr srv_cfg = CfgMgr::instance().getStagingCfg();
+                // The current subnets may be reused only if the options
+                // they hold were created with the same option definitions.
+                ConstSrvConfigPtr current_cfg = CfgMgr::instance().getCurrentCfg();
+                ConstCfgSubnets4Ptr current_subnets;
+                if (srv_cfg->getCfgOptionDef()->equals(*current_cfg->getCfgOptionDef())) {
+                    current_subnets = current_cfg->getCfgSubnets4();
+                }
                 Subnets4ListConfigParser subnets_parser;
                 // parse() returns number of subnets parsed. We may log it one day.
-                subnets_parser.parse(srv_cfg, config_pair.second);
+                subnets_parser.parse(srv_cfg, config_pair.second, current_subnets);
                 continue;
             }
 
@@ -573,21 +656,24 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
     } catch (const isc::Exception& ex) {
         LOG_ERROR(dhcp4_logger, DHCP4_PARSER_FAIL)
                   .arg(config_pair.first).arg(ex.what());
-        answer = isc::config::createAnswer(1, ex.what());
-
-        // An error occurred, so make sure that we restore original data.
-        rollback = true;
+        return (isc::config::createAnswer(1, ex.what()));
 
     } catch (...) {
         // For things like bad_cast in boost::lexical_cast
         LOG_ERROR(dhcp4_logger, DHCP4_PARSER_EXCEPTION).arg(config_pair.first);
-        answer = isc::config::createAnswer(1, "undefined configuration"
-                                           " processing error");
-
-        // An error occurred, so make sure that we restore original data.
-        rollback = true;
+        return (isc::config::createAnswer(1, "undefined configuration"
+                                          " processing error"));
     }
 
+    return (ConstElementPtr());
+}
+
+isc::data::ConstElementPtr
+commitDhcp4Config(isc::data::ConstElementPtr answer, bool check_only) {
+    // Rollback informs whether error occurred and original data
+    // have to be restored to global storages.
+    bool rollback = answer ? true : false;
+
     if (check_only) {
         rollback = true;
         if (!answer) {
@@ -652,5 +738,24 @@ configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
     return (answer);
 }
 
+isc::data::ConstElementPtr
+configureDhcp4Server(Dhcpv4Srv&, isc::data::ConstElementPtr config_set,
+                     bool check_only) {
+    if (!config_set) {
+        ConstElementPtr answer = isc::config::createAnswer(1,
+                                 string("Can't parse NULL config"));
+        return (answer);
+    }
+
+    // Remove any existing timers.
+    TimerMgr::instance()->unregisterTimers();
+
+    ConstElementPtr answer = beginDhcp4Config(config_set);
+    if (!answer) {
+        answer = parseDhcp4Config(config_set);
+    }
+    return (commitDhcp4Config(answer, check_only));
+}
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
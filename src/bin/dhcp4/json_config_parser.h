@@ -59,6 +59,55 @@ configureDhcp4Server(Dhcpv4Srv&,
                      isc::data::ConstElementPtr config_set,
                      bool check_only = false);
 
+/// @brief Starts parsing the DHCPv4 configuration.
+///
+/// This is the first step of @c configureDhcp4Server. It sets the default
+/// values in the configuration, derives the global parameters to the subnets
+/// and parses the option definitions into the staging configuration.
+///
+/// The runtime option definitions in the libdhcp++ are used by the packet
+/// processing. Unless @c runtime_defs is false, this function also stages
+/// the parsed option definitions as runtime option definitions, so it must
+/// be called by the thread which processes packets. When the configuration
+/// is parsed in the background the runtime option definitions are set by
+/// the caller once the configuration is applied.
+///
+/// @param config_set a new configuration (JSON) for DHCPv4 server. It is
+/// modified by this function.
+/// @param runtime_defs whether the runtime option definitions are staged.
+/// @return NULL on success or the answer holding the error.
+isc::data::ConstElementPtr
+beginDhcp4Config(isc::data::ConstElementPtr config_set,
+                 bool runtime_defs = true);
+
+/// @brief Parses the DHCPv4 configuration into the staging configuration.
+///
+/// This is the second step of @c configureDhcp4Server. It parses the
+/// configuration prepared by @c beginDhcp4Config into the staging
+/// configuration. It doesn't modify the state used by the packet processing,
+/// so it may be called by a background thread while the server processes
+/// packets, as long as the staging configuration is not used by any other
+/// thread until it returns.
+///
+/// @param config_set configuration returned by @c beginDhcp4Config.
+/// @return NULL on success or the answer holding the error.
+isc::data::ConstElementPtr
+parseDhcp4Config(isc::data::ConstElementPtr config_set);
+
+/// @brief Applies the parsed DHCPv4 configuration.
+///
+/// This is the last step of @c configureDhcp4Server. It sets up the command
+/// channel, D2 client and hook libraries according to the staging
+/// configuration. If any of the previous steps failed or the configuration
+/// is only checked, the runtime option definitions are reverted.
+///
+/// @param answer NULL if the configuration has been parsed successfully or
+/// the answer holding the parsing error.
+/// @param check_only whether this configuration is for testing only
+/// @return answer that contains result of reconfiguration
+isc::data::ConstElementPtr
+commitDhcp4Config(isc::data::ConstElementPtr answer, bool check_only);
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
@@ -10,9 +10,12 @@
 #include <dhcp4/ctrl_dhcp4_srv.h>
 #include <dhcp4/dhcp4_log.h>
 #include <dhcp4/parser_context.h>
+#include <cc/element_cache.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <exceptions/exceptions.h>
 
+#include <fstream>
+#include <sstream>
 #include <string>
 
 using namespace isc::asiolink;
@@ -21,6 +24,103 @@ using namespace std;
 
 namespace {
 
+/// @brief Reads the content of the configuration file.
+///
+/// @param file_name Configuration file location.
+/// @param [out] text Content of the configuration file.
+///
+/// @return true if the file has been read, false otherwise.
+bool readConfigText(const std::string& file_name, std::string& text) {
+    std::ifstream infile(file_name.c_str(), std::ios::in | std::ios::binary);
+    if (!infile.is_open()) {
+        return (false);
+    }
+    std::ostringstream content;
+    content << infile.rdbuf();
+    if (infile.bad()) {
+        return (false);
+    }
+    text = content.str();
+    return (true);
+}
+
+/// @brief Loads the configuration cached for the configuration file.
+///
+/// The cache is not used for the configuration files including other
+/// files, because the changes in the included files are not detected.
+///
+/// @param file_name Configuration file location.
+/// @param cache_file Configuration cache file location.
+/// @param [out] text Content of the configuration file, set if the cache
+/// can be used for this file.
+///
+/// @return Cached configuration or null pointer if the cache can't be used.
+isc::data::ElementPtr
+loadCachedConfig(const std::string& file_name, const std::string& cache_file,
+                 std::string& text) {
+    std::string reason;
+    if (!readConfigText(file_name, text)) {
+        reason = "unable to read the configuration file";
+    } else if (text.find("<?include") != std::string::npos) {
+        reason = "the configuration file includes other files";
+    }
+    if (!reason.empty()) {
+        text.clear();
+        LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_CONFIG_CACHE_NOT_USED)
+            .arg(cache_file).arg(reason);
+        return (isc::data::ElementPtr());
+    }
+
+    try {
+        isc::data::ElementCache cache(cache_file, VERSION);
+        isc::data::ElementPtr json = cache.load(text);
+        if (json) {
+            LOG_INFO(dhcp4_logger, DHCP4_CONFIG_CACHE_LOADED)
+                .arg(file_name).arg(cache_file);
+        } else {
+            LOG_DEBUG(dhcp4_logger, DBG_DHCP4_START, DHCP4_CONFIG_CACHE_NOT_USED)
+                .arg(cache_file).arg("the cache doesn't exist or has been"
+                                     " created for a different configuration");
+        }
+        return (json);
+
+    } catch (const std::exception& ex) {
+        LOG_WARN(dhcp4_logger, DHCP4_CONFIG_CACHE_LOAD_FAIL)
+            .arg(cache_file).arg(ex.what());
+    }
+    return (isc::data::ElementPtr());
+}
+
+/// @brief Stores the applied configuration in the configuration cache.
+///
+/// The configuration is not stored if the configuration file has been
+/// modified while it was being applied.
+///
+/// @param file_name Configuration file location.
+/// @param cache_file Configuration cache file location.
+/// @param text Content of the configuration file the configuration has
+/// been parsed from.
+/// @param json Applied configuration.
+void
+storeCachedConfig(const std::string& file_name, const std::string& cache_file,
+                  const std::string& text,
+                  const isc::data::ConstElementPtr& json) {
+    try {
+        std::string current;
+        if (!readConfigText(file_name, current) || (current != text)) {
+            isc_throw(isc::BadValue, "the configuration file has been"
+                      " modified");
+        }
+        isc::data::ElementCache cache(cache_file, VERSION);
+        cache.store(text, json);
+        LOG_INFO(dhcp4_logger, DHCP4_CONFIG_CACHE_STORED).arg(cache_file);
+
+    } catch (const std::exception& ex) {
+        LOG_WARN(dhcp4_logger, DHCP4_CONFIG_CACHE_STORE_FAIL)
+            .arg(cache_file).arg(ex.what());
+    }
+}
+
 /// @brief Configure DHCPv4 server using the configuration file specified.
 ///
 /// This function is used to both configure the DHCP server on its startup
@@ -29,6 +129,12 @@ namespace {
 /// It fetches DHCPv6 server's configuration from the 'Dhcp4' section of
 /// the JSON configuration file.
 ///
+/// If the configuration cache file is set for the server, the configuration
+/// cached for the unchanged configuration file is used instead of parsing
+/// the file. The configuration parsed from the file is stored in the cache
+/// when it has been successfully applied. It includes the default values
+/// inserted by the configuration parsers.
+///
 /// @param file_name Configuration file location.
 void configure(const std::string& file_name) {
     // This is a configuration backend implementation that reads the
@@ -39,6 +145,18 @@ void configure(const std::string& file_name) {
     isc::data::ConstElementPtr logger;
     isc::data::ConstElementPtr result;
 
+    // The staging configuration is in use while a configuration is parsed
+    // in the background, so it must not be rolled back here.
+    ControlledDhcpv4Srv* srv = ControlledDhcpv4Srv::getInstance();
+    if (srv && srv->backgroundConfigInProgress()) {
+        LOG_ERROR(dhcp4_logger, DHCP4_CONFIG_LOAD_FAIL)
+            .arg(file_name).arg("configuration is being parsed in the"
+                                " background");
+        isc_throw(isc::BadValue, "configuration error using file '"
+                  << file_name << "': configuration is being parsed in the"
+                  " background");
+    }
+
     // Basic sanity check: file name must not be empty.
     try {
         if (file_name.empty()) {
@@ -47,9 +165,22 @@ void configure(const std::string& file_name) {
                       " Please use -c command line option.");
         }
 
+        // Use the configuration cached for this file if the file hasn't
+        // changed.
+        const std::string cache_file = srv ? srv->getConfigCacheFile() :
+            std::string();
+        std::string text;
+        bool cached = false;
+        if (!cache_file.empty()) {
+            json = loadCachedConfig(file_name, cache_file, text);
+            cached = static_cast<bool>(json);
+        }
+
         // Read contents of the file and parse it as JSON
-        Parser4Context parser;
-        json = parser.parseFile(file_name, Parser4Context::PARSER_DHCP4);
+        if (!cached) {
+            Parser4Context parser;
+            json = parser.parseFile(file_name, Parser4Context::PARSER_DHCP4);
+        }
         if (!json) {
             isc_throw(isc::BadValue, "no configuration found");
         }
@@ -85,6 +216,12 @@ void configure(const std::string& file_name) {
                 "no details available";
             isc_throw(isc::BadValue, reason);
         }
+
+        // The configuration has been applied, so it can be cached. It
+        // has been extended with the default values by the parsers.
+        if (!cached && !text.empty()) {
+            storeCachedConfig(file_name, cache_file, text, json);
+        }
     }  catch (const std::exception& ex) {
         // If configuration failed at any stage, we drop the staging
         // configuration and continue to use the previous one.
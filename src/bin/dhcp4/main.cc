@@ -42,13 +42,15 @@ usage() {
     cerr << "Kea DHCPv4 server, version " << VERSION << endl;
     cerr << endl;
     cerr << "Usage: " << DHCP4_NAME
-         << " -[v|V|W] [-d] [-{c|t} cfgfile] [-p number]" << endl;
+         << " -[v|V|W] [-d] [-{c|t} cfgfile] [-b cachefile] [-p number]"
+         << endl;
     cerr << "  -v: print version number and exit" << endl;
     cerr << "  -V: print extended version and exit" << endl;
     cerr << "  -W: display the configuration report and exit" << endl;
     cerr << "  -d: debug mode with extra verbosity (former -v)" << endl;
     cerr << "  -c file: specify configuration file" << endl;
     cerr << "  -t file: check the configuration file syntax and exit" << endl;
+    cerr << "  -b file: specify configuration cache file" << endl;
     cerr << "  -p number: specify non-standard port number 1-65535 "
          << "(useful for testing only)" << endl;
     exit(EXIT_FAILURE);
@@ -66,7 +68,10 @@ main(int argc, char* argv[]) {
     // The standard config file
     std::string config_file("");
 
-    while ((ch = getopt(argc, argv, "dvVWc:p:t:")) != -1) {
+    // The configuration cache file (none by default)
+    std::string cache_file("");
+
+    while ((ch = getopt(argc, argv, "dvVWb:c:p:t:")) != -1) {
         switch (ch) {
         case 'd':
             verbose_mode = true;
@@ -92,6 +97,10 @@ main(int argc, char* argv[]) {
             config_file = optarg;
             break;
 
+        case 'b': // config cache file
+            cache_file = optarg;
+            break;
+
         case 'p':
             try {
                 port_number = boost::lexical_cast<int>(optarg);
@@ -198,6 +207,7 @@ main(int argc, char* argv[]) {
         // Create our PID file.
         server.setProcName(DHCP4_NAME);
         server.setConfigFile(config_file);
+        server.setConfigCacheFile(cache_file);
         server.createPIDFile();
 
         try {
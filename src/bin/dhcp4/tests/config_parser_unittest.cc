@@ -1034,6 +1034,74 @@ TEST_F(Dhcp4ParserTest, reconfigureRemoveSubnet) {
 
 /// @todo: implement subnet removal test as part of #3281.
 
+// This test verifies that the unchanged subnets with explicit identifiers
+// are kept in the new configuration together with their allocation state
+// and that the modified subnets are created again.
+TEST_F(Dhcp4ParserTest, reconfigureKeepUnchangedSubnet) {
+    ConstElementPtr x;
+    string config = "{ " + genIfaceConfig() + "," +
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, "
+        "\"subnet4\": [ { "
+        "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.100\" } ],"
+        "    \"subnet\": \"192.0.2.0/24\", "
+        "    \"id\": 10 "
+        " },"
+        " {"
+        "    \"pools\": [ { \"pool\": \"192.0.3.1 - 192.0.3.100\" } ],"
+        "    \"subnet\": \"192.0.3.0/24\", "
+        "    \"id\": 20 "
+        " } ],"
+        "\"valid-lifetime\": 4000 }";
+
+    // The second subnet has a different pool.
+    string config_modified = "{ " + genIfaceConfig() + "," +
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, "
+        "\"subnet4\": [ { "
+        "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.100\" } ],"
+        "    \"subnet\": \"192.0.2.0/24\", "
+        "    \"id\": 10 "
+        " },"
+        " {"
+        "    \"pools\": [ { \"pool\": \"192.0.3.1 - 192.0.3.50\" } ],"
+        "    \"subnet\": \"192.0.3.0/24\", "
+        "    \"id\": 20 "
+        " } ],"
+        "\"valid-lifetime\": 4000 }";
+
+    ConstElementPtr json;
+    ASSERT_NO_THROW(json = parseDHCP4(config));
+    EXPECT_NO_THROW(x = configureDhcp4Server(*srv_, json));
+    checkResult(x, 0);
+    CfgMgr::instance().commit();
+
+    ConstCfgSubnets4Ptr subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    Subnet4Ptr subnet1 = subnets->getSubnet(10);
+    Subnet4Ptr subnet2 = subnets->getSubnet(20);
+    ASSERT_TRUE(subnet1);
+    ASSERT_TRUE(subnet2);
+    subnet1->setLastAllocated(Lease::TYPE_V4, IOAddress("192.0.2.50"));
+
+    ASSERT_NO_THROW(json = parseDHCP4(config_modified));
+    EXPECT_NO_THROW(x = configureDhcp4Server(*srv_, json));
+    checkResult(x, 0);
+    CfgMgr::instance().commit();
+
+    // The unchanged subnet is kept with its state.
+    subnets = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    EXPECT_EQ(subnet1, subnets->getSubnet(10));
+    EXPECT_EQ("192.0.2.50",
+              subnets->getSubnet(10)->getLastAllocated(Lease::TYPE_V4).toText());
+
+    // The modified subnet is replaced.
+    Subnet4Ptr new_subnet2 = subnets->getSubnet(20);
+    ASSERT_TRUE(new_subnet2);
+    EXPECT_NE(subnet2, new_subnet2);
+    EXPECT_FALSE(new_subnet2->inPool(Lease::TYPE_V4, IOAddress("192.0.3.75")));
+}
+
 // Checks if the next-server defined as global parameter is taken into
 // consideration.
 TEST_F(Dhcp4ParserTest, nextServerGlobal) {
@@ -4233,7 +4301,8 @@ TEST_F(Dhcp4ParserTest, expiredLeasesProcessing) {
         "    \"hold-reclaimed-time\": 1800,"
         "    \"max-reclaim-leases\": 50,"
         "    \"max-reclaim-time\": 100,"
-        "    \"unwarned-reclaim-cycles\": 10"
+        "    \"unwarned-reclaim-cycles\": 10,"
+        "    \"reuse-quarantine-time\": 30"
         "},"
         "\"subnet4\": [ ]"
         "}";
@@ -4260,6 +4329,7 @@ TEST_F(Dhcp4ParserTest, expiredLeasesProcessing) {
     EXPECT_EQ(50, cfg->getMaxReclaimLeases());
     EXPECT_EQ(100, cfg->getMaxReclaimTime());
     EXPECT_EQ(10, cfg->getUnwarnedReclaimCycles());
+    EXPECT_EQ(30, cfg->getReuseQuarantineTime());
 }
 
 // Check that invalid configuration for the expired leases processing is
@@ -9,6 +9,7 @@
 #include <cc/command_interpreter.h>
 #include <config/command_mgr.h>
 #include <dhcp/dhcp4.h>
+#include <dhcp/libdhcp++.h>
 #include <dhcp4/ctrl_dhcp4_srv.h>
 #include <dhcp4/tests/dhcp4_test_utils.h>
 #include <dhcpsrv/cfgmgr.h>
@@ -23,14 +24,17 @@
 #include "marker_file.h"
 #include "test_libraries.h"
 
+#include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <vector>
 
 #include <arpa/inet.h>
+#include <sys/socket.h>
 #include <unistd.h>
 
 using namespace std;
@@ -86,7 +90,10 @@ public:
         reset();
     };
 
-    void createUnixChannelServer() {
+    /// @brief Configures the server with the control channel.
+    ///
+    /// @param subnets Text of the subnets configured, empty by default.
+    void createUnixChannelServer(const std::string& subnets = "") {
         ::remove(socket_path_.c_str());
 
         // Just a simple config. The important part here is the socket
@@ -103,7 +110,7 @@ public:
             "    },"
             "    \"rebind-timer\": 2000, "
             "    \"renew-timer\": 1000, "
-            "    \"subnet4\": [ ],"
+            "    \"subnet4\": [ " + subnets + " ],"
             "    \"valid-lifetime\": 4000,"
             "    \"control-socket\": {"
             "        \"socket-type\": \"unix\","
@@ -198,6 +205,48 @@ public:
         client->disconnectFromServer();
         ASSERT_NO_THROW(server_->receivePacket(0));
     }
+
+    /// @brief Reads responses which may not fit in a single read.
+    ///
+    /// This method reads the data sent by the server until the specified
+    /// number of complete JSON responses has been received. It calls the
+    /// server's receivePacket() method between the reads so as the server
+    /// can send the parts of the responses which didn't fit in the socket
+    /// buffer.
+    ///
+    /// @param client client connected to the server.
+    /// @param count number of responses to be received.
+    /// @param [out] responses received responses.
+    void receiveResponses(UnixControlClient& client, const size_t count,
+                          std::vector<ConstElementPtr>& responses) {
+        responses.clear();
+        std::string data;
+        for (int i = 0; (i < 100) && (responses.size() < count); ++i) {
+            ASSERT_NO_THROW(server_->receivePacket(0));
+
+            char buf[65536];
+            ssize_t bytes_rcvd;
+            while ((bytes_rcvd = recv(client.socket_fd_, buf, sizeof(buf),
+                                      MSG_DONTWAIT)) > 0) {
+                data.append(buf, bytes_rcvd);
+            }
+
+            // Try to parse the responses received so far.
+            responses.clear();
+            std::istringstream in(data);
+            in >> std::ws;
+            try {
+                while ((responses.size() < count) && (in.peek() != EOF)) {
+                    responses.push_back(Element::fromJSON(in));
+                    in >> std::ws;
+                }
+            } catch (const std::exception&) {
+                // The last response is incomplete. Read more data.
+            }
+        }
+        ASSERT_EQ(count, responses.size()) << "received: " << data.size()
+                                           << " bytes";
+    }
 };
 
 TEST_F(CtrlChannelDhcpv4SrvTest, commands) {
@@ -296,6 +345,9 @@ TEST_F(CtrlChannelDhcpv4SrvTest, commandsRegistration) {
     std::string command_list = answer->get("arguments")->str();
 
     EXPECT_TRUE(command_list.find("\"list-commands\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"lease4-export\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"lease4-get-page\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"lease4-import\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get-all\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-remove\"") != string::npos);
@@ -625,4 +677,402 @@ TEST_F(CtrlChannelDhcpv4SrvTest, set_config) {
     CfgMgr::instance().clear();
 }
 
+// Check that the "set-config" command parses the configuration in the
+// background when requested and applies it when parsing is finished.
+TEST_F(CtrlChannelDhcpv4SrvTest, setConfigBackground) {
+    createUnixChannelServer();
+
+    string dhcp4_cfg_txt =
+        "{ \"Dhcp4\": { \n"
+        "    \"interfaces-config\": { \n"
+        "        \"interfaces\": [\"*\"] \n"
+        "    }, \n"
+        "    \"valid-lifetime\": 4000, \n"
+        "    \"renew-timer\": 1000, \n"
+        "    \"rebind-timer\": 2000, \n"
+        "    \"lease-database\": { \n"
+        "        \"type\": \"memfile\", \n"
+        "        \"persist\": false \n"
+        "    }, \n"
+        "    \"option-def\": [ { \n"
+        "        \"name\": \"foo\", \n"
+        "        \"code\": 222, \n"
+        "        \"type\": \"uint32\" \n"
+        "    } ], \n"
+        "    \"subnet4\": [ { \n"
+        "        \"subnet\": \"192.2.0.0/24\", \n"
+        "        \"pools\": [ { \"pool\": \"192.2.0.1-192.2.0.50\" } ] \n"
+        "    } ], \n"
+        "    \"control-socket\": { \n"
+        "        \"socket-type\": \"unix\", \n"
+        "        \"socket-name\": \"" + socket_path_ + "\" \n"
+        "    } \n"
+        "}, \n";
+
+    LibDHCP::clearRuntimeOptionDefs();
+
+    // The background parameter must be a boolean.
+    ElementPtr args = Element::fromJSON(dhcp4_cfg_txt +
+                                        "\"background\": \"yes\" }");
+    ConstElementPtr answer = ControlledDhcpv4Srv::processCommand("set-config",
+                                                                 args);
+    int rcode = 0;
+    ConstElementPtr comment = parseAnswer(rcode, answer);
+    EXPECT_EQ(1, rcode);
+
+    args = Element::fromJSON(dhcp4_cfg_txt + "\"background\": true }");
+    answer = ControlledDhcpv4Srv::processCommand("set-config", args);
+    comment = parseAnswer(rcode, answer);
+    ASSERT_EQ(0, rcode) << comment->str();
+    EXPECT_TRUE(server_->backgroundConfigInProgress());
+
+    // Another configuration is rejected until the parsed one is applied.
+    answer = ControlledDhcpv4Srv::processCommand("set-config", args);
+    comment = parseAnswer(rcode, answer);
+    EXPECT_EQ(1, rcode);
+
+    // The current configuration is in use until the packet loop notices
+    // that the parsing has finished.
+    EXPECT_TRUE(CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+                getAll()->empty());
+
+    // The received packets are not parsed with the new option definitions
+    // before the configuration is applied.
+    EXPECT_FALSE(LibDHCP::getRuntimeOptionDef(DHCP4_OPTION_SPACE, 222));
+
+    for (int i = 0; (i < 10) && server_->backgroundConfigInProgress(); ++i) {
+        ASSERT_NO_THROW(server_->receivePacket(1));
+    }
+    ASSERT_FALSE(server_->backgroundConfigInProgress());
+
+    // The new configuration has been committed.
+    EXPECT_EQ(1, CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->
+              getAll()->size());
+    EXPECT_TRUE(LibDHCP::getRuntimeOptionDef(DHCP4_OPTION_SPACE, 222));
+
+    // Clean up after the test.
+    CfgMgr::instance().clear();
+    LibDHCP::clearRuntimeOptionDefs();
+}
+
+/// @brief Command handler which returns the received arguments.
+ConstElementPtr
+echoCommand(const std::string&, const ConstElementPtr& params) {
+    return (createAnswer(CONTROL_RESULT_SUCCESS, params));
+}
+
+// This test verifies that the commands and responses larger than the
+// socket buffers are received and sent in parts.
+TEST_F(CtrlChannelDhcpv4SrvTest, longCommandAndResponse) {
+    createUnixChannelServer();
+    CommandMgr::instance().registerCommand("test-echo",
+                                           boost::bind(&echoCommand, _1, _2));
+
+    UnixControlClient client;
+    ASSERT_TRUE(client.connectToServer(socket_path_));
+    ASSERT_NO_THROW(server_->receivePacket(0));
+
+    // Build the command with 1MB of data.
+    const std::string payload(1024 * 1024, 'x');
+    const std::string command = "{ \"command\": \"test-echo\", "
+        "\"arguments\": { \"data\": \"" + payload + "\" } }";
+
+    // Send it in chunks, so as the server receives it in parts.
+    const size_t chunk_size = 64 * 1024;
+    for (size_t pos = 0; pos < command.size(); pos += chunk_size) {
+        ASSERT_TRUE(client.sendCommand(command.substr(pos, chunk_size)));
+        ASSERT_NO_THROW(server_->receivePacket(0));
+    }
+
+    std::vector<ConstElementPtr> responses;
+    receiveResponses(client, 1, responses);
+    ASSERT_EQ(1, responses.size());
+
+    int status = -1;
+    ConstElementPtr args = parseAnswer(status, responses[0]);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status);
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("data"));
+    EXPECT_EQ(payload, args->get("data")->stringValue());
+
+    client.disconnectFromServer();
+    ASSERT_NO_THROW(server_->receivePacket(0));
+    CommandMgr::instance().deregisterCommand("test-echo");
+}
+
+// This test verifies that the commands sent one after another over the
+// same connection are all processed and the responses are sent in order.
+TEST_F(CtrlChannelDhcpv4SrvTest, multipleCommands) {
+    createUnixChannelServer();
+
+    UnixControlClient client;
+    ASSERT_TRUE(client.connectToServer(socket_path_));
+    ASSERT_NO_THROW(server_->receivePacket(0));
+
+    // The second command is split between two writes.
+    ASSERT_TRUE(client.sendCommand("{ \"command\": \"bogus\" }\n"
+                                   "{ \"command\": \"statistic-"));
+    ASSERT_NO_THROW(server_->receivePacket(0));
+    ASSERT_TRUE(client.sendCommand("get-all\", \"arguments\": {} }"));
+
+    std::vector<ConstElementPtr> responses;
+    receiveResponses(client, 2, responses);
+    ASSERT_EQ(2, responses.size());
+
+    int status = -1;
+    parseAnswer(status, responses[0]);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status);
+    parseAnswer(status, responses[1]);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status);
+
+    // The connection remains open for the next commands.
+    ASSERT_TRUE(client.sendCommand("{ \"command\": \"list-commands\" }"));
+    receiveResponses(client, 1, responses);
+    ASSERT_EQ(1, responses.size());
+    parseAnswer(status, responses[0]);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status);
+
+    client.disconnectFromServer();
+    ASSERT_NO_THROW(server_->receivePacket(0));
+}
+
+// This test verifies that the leases can be read in pages using the
+// lease4-get-page command.
+TEST_F(CtrlChannelDhcpv4SrvTest, lease4GetPage) {
+    createUnixChannelServer();
+
+    // Add leases in two subnets.
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    for (uint32_t i = 1; i <= 5; ++i) {
+        HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText("00:01:02:03:04:0" +
+                                                     std::string(1, '0' + i))));
+        Lease4Ptr lease(new Lease4(IOAddress(0x0a000000 + i), hwaddr,
+                                   ClientIdPtr(), 60, 10, 20, time(NULL),
+                                   SubnetID(i % 2 + 1)));
+        ASSERT_TRUE(lease_mgr.addLease(lease));
+    }
+
+    // Get the first page.
+    std::string response;
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"from\": \"start\", \"limit\": 2 } }",
+                    response);
+    ConstElementPtr answer;
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    int status = -1;
+    ConstElementPtr args = parseAnswer(status, answer);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status) << response;
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(2, args->get("count")->intValue());
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("10.0.0.1", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ("00:01:02:03:04:01",
+              leases->get(0)->get("hw-address")->stringValue());
+    EXPECT_EQ(2, leases->get(0)->get("subnet-id")->intValue());
+    EXPECT_EQ("10.0.0.2", leases->get(1)->get("ip-address")->stringValue());
+
+    // Get the next page of the leases in the subnet 2.
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"from\": \"10.0.0.1\", "
+                    "\"subnet-id\": 2 } }", response);
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    args = parseAnswer(status, answer);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status) << response;
+    leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("10.0.0.3", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ("10.0.0.5", leases->get(1)->get("ip-address")->stringValue());
+
+    // Invalid arguments are reported.
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"from\": \"2001:db8::1\" } }",
+                    response);
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    parseAnswer(status, answer);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status);
+
+    sendUnixCommand("{ \"command\": \"lease4-get-page\", "
+                    "\"arguments\": { \"limit\": 0 } }", response);
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    parseAnswer(status, answer);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status);
+}
+
+// This test verifies that all leases are exported in parts using the
+// lease4-export command and that the connection remains usable.
+TEST_F(CtrlChannelDhcpv4SrvTest, lease4Export) {
+    createUnixChannelServer();
+
+    // Add enough leases to span multiple pages.
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    const size_t lease_count = 2000;
+    for (uint32_t i = 0; i < lease_count; ++i) {
+        HWAddrPtr hwaddr(new HWAddr(std::vector<uint8_t>(6, i % 256),
+                                    HTYPE_ETHER));
+        Lease4Ptr lease(new Lease4(IOAddress(0x0a000000 + i), hwaddr,
+                                   ClientIdPtr(), 60, 10, 20, time(NULL),
+                                   SubnetID(1)));
+        ASSERT_TRUE(lease_mgr.addLease(lease));
+    }
+
+    UnixControlClient client;
+    ASSERT_TRUE(client.connectToServer(socket_path_));
+    ASSERT_NO_THROW(server_->receivePacket(0));
+
+    // The second command is processed when the export is complete.
+    ASSERT_TRUE(client.sendCommand("{ \"command\": \"lease4-export\", "
+                                   "\"arguments\": { \"page-size\": 100 } }"
+                                   "{ \"command\": \"list-commands\" }"));
+
+    std::vector<ConstElementPtr> responses;
+    receiveResponses(client, 2, responses);
+    ASSERT_EQ(2, responses.size());
+
+    int status = -1;
+    ConstElementPtr args = parseAnswer(status, responses[0]);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status);
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(lease_count, static_cast<size_t>(args->get("count")->intValue()));
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(lease_count, leases->size());
+    for (uint32_t i = 0; i < lease_count; ++i) {
+        ASSERT_EQ(IOAddress(0x0a000000 + i).toText(),
+                  leases->get(i)->get("ip-address")->stringValue());
+    }
+
+    parseAnswer(status, responses[1]);
+    EXPECT_EQ(CONTROL_RESULT_SUCCESS, status);
+
+    // Invalid arguments are reported in the regular response.
+    ASSERT_TRUE(client.sendCommand("{ \"command\": \"lease4-export\", "
+                                   "\"arguments\": { \"subnet-id\": \"1\" } }"));
+    receiveResponses(client, 1, responses);
+    ASSERT_EQ(1, responses.size());
+    parseAnswer(status, responses[0]);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status);
+
+    client.disconnectFromServer();
+    ASSERT_NO_THROW(server_->receivePacket(0));
+
+    // The command processed without the control connection gets the
+    // whole response at once.
+    ConstElementPtr answer = CommandMgr::instance().
+        processCommand(createCommand("lease4-export"));
+    args = parseAnswer(status, answer);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status);
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("leases"));
+    EXPECT_EQ(lease_count, args->get("leases")->size());
+}
+
+// This test verifies that the leases are imported in bulk using the
+// lease4-import command and that the statistics are updated.
+TEST_F(CtrlChannelDhcpv4SrvTest, lease4Import) {
+    createUnixChannelServer("{ \"id\": 1, \"subnet\": \"10.0.0.0/24\" }, "
+                            "{ \"id\": 2, \"subnet\": \"10.0.1.0/24\" }");
+
+    // The first lease exists and is counted as assigned.
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText("00:01:02:03:04:05")));
+    ASSERT_TRUE(lease_mgr.addLease(Lease4Ptr(new Lease4(IOAddress("10.0.0.1"),
+                                                        hwaddr, ClientIdPtr(),
+                                                        60, 10, 20, time(NULL),
+                                                        SubnetID(1)))));
+    StatsMgr& stats_mgr = StatsMgr::instance();
+    stats_mgr.setValue("subnet[1].assigned-addresses", static_cast<int64_t>(1));
+    stats_mgr.setValue("declined-addresses", static_cast<int64_t>(0));
+
+    // Import the declined first lease, 199 other leases in the subnet 1
+    // and 50 leases without the subnet identifier in the subnet 2.
+    std::ostringstream cmd;
+    cmd << "{ \"command\": \"lease4-import\", \"arguments\": { \"leases\": [ "
+        << "{ \"ip-address\": \"10.0.0.1\", \"hw-address\": \"\", "
+        << "\"subnet-id\": 1, \"valid-lft\": 60, \"state\": 1 }";
+    for (uint32_t i = 2; i <= 200; ++i) {
+        cmd << ", { \"ip-address\": \"" << IOAddress(0x0a000000 + i)
+            << "\", \"hw-address\": \"00:01:02:03:04:05\", "
+            << "\"subnet-id\": 1, \"valid-lft\": 60 }";
+    }
+    for (uint32_t i = 1; i <= 50; ++i) {
+        cmd << ", { \"ip-address\": \"" << IOAddress(0x0a000100 + i)
+            << "\", \"hw-address\": \"00:01:02:03:04:05\", "
+            << "\"valid-lft\": 60 }";
+    }
+    cmd << " ] } }";
+
+    std::string response;
+    sendUnixCommand(cmd.str(), response);
+    ConstElementPtr answer;
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    int status = -1;
+    ConstElementPtr args = parseAnswer(status, answer);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status) << response;
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("added"));
+    EXPECT_EQ(249, args->get("added")->intValue());
+    ASSERT_TRUE(args->get("replaced"));
+    EXPECT_EQ(1, args->get("replaced")->intValue());
+
+    Lease4Ptr lease = lease_mgr.getLease4(IOAddress("10.0.0.1"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(Lease::STATE_DECLINED, lease->state_);
+    lease = lease_mgr.getLease4(IOAddress("10.0.1.50"));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ(2, lease->subnet_id_);
+
+    ObservationPtr stat = stats_mgr.getObservation("subnet[1].assigned-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(199, stat->getInteger().first);
+    stat = stats_mgr.getObservation("subnet[1].declined-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(1, stat->getInteger().first);
+    stat = stats_mgr.getObservation("subnet[2].assigned-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(50, stat->getInteger().first);
+    stat = stats_mgr.getObservation("declined-addresses");
+    ASSERT_TRUE(stat);
+    EXPECT_EQ(1, stat->getInteger().first);
+
+    // None of the leases is imported if any of them is invalid.
+    const char* lease1 = "{ \"ip-address\": \"10.0.0.250\", "
+        "\"hw-address\": \"00:01:02:03:04:05\", \"valid-lft\": 60 }";
+    const char* invalid[] = {
+        // The address doesn't belong to the subnet.
+        "{ \"ip-address\": \"10.0.1.250\", \"hw-address\": \"00:01\", "
+        "\"subnet-id\": 1, \"valid-lft\": 60 }",
+        // The subnet doesn't exist.
+        "{ \"ip-address\": \"10.0.0.251\", \"hw-address\": \"00:01\", "
+        "\"subnet-id\": 3, \"valid-lft\": 60 }",
+        // There is no subnet for the address.
+        "{ \"ip-address\": \"10.0.2.1\", \"hw-address\": \"00:01\", "
+        "\"valid-lft\": 60 }",
+        // Duplicate address.
+        lease1,
+        // Missing valid lifetime.
+        "{ \"ip-address\": \"10.0.0.251\", \"hw-address\": \"00:01\" }"
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        SCOPED_TRACE(invalid[i]);
+        sendUnixCommand(std::string("{ \"command\": \"lease4-import\", "
+                                    "\"arguments\": { \"leases\": [ ") +
+                        lease1 + ", " + invalid[i] + " ] } }", response);
+        ASSERT_NO_THROW(answer = Element::fromJSON(response));
+        parseAnswer(status, answer);
+        EXPECT_EQ(CONTROL_RESULT_ERROR, status);
+        EXPECT_FALSE(lease_mgr.getLease4(IOAddress("10.0.0.250")));
+    }
+
+    sendUnixCommand("{ \"command\": \"lease4-import\", "
+                    "\"arguments\": { } }", response);
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    parseAnswer(status, answer);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status);
+}
+
 } // End of anonymous namespace
@@ -36,6 +36,7 @@
 #include <dhcpsrv/host_mgr.h>
 #include <gtest/gtest.h>
 #include <stats/stats_mgr.h>
+#include <util/pool_allocator.h>
 #include <boost/scoped_ptr.hpp>
 
 #include <iostream>
@@ -1013,6 +1014,123 @@ TEST_F(Dhcpv4SrvTest, sanityCheck) {
                  RFCViolation);
 }
 
+/// @brief Server which delays the lookups of the clients' leases until
+/// the test completes them.
+class ParkingDhcpv4Srv : public NakedDhcpv4Srv {
+public:
+
+    /// @brief Queues the lookup of the client's lease.
+    virtual void asyncGetClientLease(const AllocEngine::ClientContext4& ctx,
+                                     const bool by_client_id,
+                                     const Lease4Handler& handler) {
+        lookups_.push_back(boost::bind(&ParkingDhcpv4Srv::getClientLease,
+                                       this, &ctx, by_client_id, handler));
+    }
+
+    /// @brief Completes the lookup issued last.
+    void completeLastLookup() {
+        boost::function<void ()> lookup = lookups_.back();
+        lookups_.pop_back();
+        lookup();
+    }
+
+    /// @brief Completes all lookups, including those issued meanwhile.
+    void completeLookups() {
+        while (!lookups_.empty()) {
+            boost::function<void ()> lookup = lookups_.front();
+            lookups_.pop_front();
+            lookup();
+        }
+    }
+
+    /// @brief Looks up the lease in the lease database.
+    void getClientLease(const AllocEngine::ClientContext4* ctx,
+                        const bool by_client_id,
+                        const Lease4Handler& handler) {
+        Dhcpv4Srv::asyncGetClientLease(*ctx, by_client_id, handler);
+    }
+
+    /// @brief Lookups which haven't completed yet.
+    std::list<boost::function<void ()> > lookups_;
+};
+
+// Checks that the DHCPDISCOVER is parked while the client's lease is
+// fetched, other packets are processed meanwhile and the response is
+// sent when the lease has been fetched.
+TEST_F(Dhcpv4SrvTest, parkDiscover) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    ParkingDhcpv4Srv srv;
+
+    // The captured packets are relayed from 10.254.226.1.
+    configure(CONFIGS[0]);
+
+    // Two DHCPDISCOVERs from different clients.
+    Pkt4Ptr dis1;
+    ASSERT_NO_THROW(dis1 = PktCaptures::captureRelayedDiscover());
+    Pkt4Ptr dis2;
+    ASSERT_NO_THROW(dis2 = PktCaptures::captureRelayedDiscover2());
+    srv.fakeReceive(dis1);
+    srv.fakeReceive(dis2);
+
+    // Both packets are received and parked.
+    srv.run();
+    EXPECT_TRUE(srv.fake_sent_.empty());
+    EXPECT_EQ(2, srv.getParkedPacketsCount());
+    ASSERT_EQ(2, srv.lookups_.size());
+
+    // The second client has no lease for its client identifier, so the
+    // server looks it up by the HW address. When this completes, the
+    // second packet is resumed while the first is still parked.
+    srv.completeLastLookup();
+    ASSERT_EQ(2, srv.lookups_.size());
+    srv.completeLastLookup();
+    EXPECT_EQ(1, srv.getParkedPacketsCount());
+    ASSERT_EQ(1, srv.fake_sent_.size());
+    EXPECT_EQ(DHCPOFFER, srv.fake_sent_.back()->getType());
+    EXPECT_EQ(dis2->getTransid(), srv.fake_sent_.back()->getTransid());
+
+    // Complete the lookups for the first client.
+    srv.completeLookups();
+    EXPECT_EQ(0, srv.getParkedPacketsCount());
+    ASSERT_EQ(2, srv.fake_sent_.size());
+    EXPECT_EQ(DHCPOFFER, srv.fake_sent_.back()->getType());
+    EXPECT_EQ(dis1->getTransid(), srv.fake_sent_.back()->getTransid());
+}
+
+// Checks that the memory of the packets, options, client identifiers and
+// HW addresses created while processing a query is recycled. Once the
+// free lists are filled, processing the same query again doesn't allocate
+// any new blocks from the system.
+TEST_F(Dhcpv4SrvTest, processPacketPoolAllocations) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    NakedDhcpv4Srv srv(0);
+
+    // The captured packets are relayed from 10.254.226.1.
+    configure(CONFIGS[0]);
+
+    isc::util::BlockFreeListStats& stats =
+        isc::util::BlockFreeListStats::instance();
+    size_t system_alloc_count = 0;
+    for (int i = 0; i < 20; ++i) {
+        // The first queries fill the free lists.
+        if (i == 10) {
+            system_alloc_count = stats.getSystemAllocCount();
+        }
+
+        Pkt4Ptr query = PktCaptures::captureRelayedDiscover();
+        Pkt4Ptr rsp;
+        srv.processPacket(query, rsp);
+        ASSERT_TRUE(rsp);
+        EXPECT_EQ(DHCPOFFER, rsp->getType());
+    }
+
+    EXPECT_EQ(system_alloc_count, stats.getSystemAllocCount());
+}
+
 // Checks if received relay agent info option is echoed back to the client
 TEST_F(Dhcpv4SrvTest, relayAgentInfoEcho) {
     IfaceMgrTestConfig test_config(true);
@@ -2505,6 +2623,34 @@ TEST_F(Dhcpv4SrvTest, statisticsUnknownRcvd) {
     EXPECT_EQ(1, drop_stat->getInteger().first);
 }
 
+// Test checks that the message carrying a malformed server identifier is
+// dropped and counted as a parse failure, although the server parses the
+// options on demand.
+TEST_F(Dhcpv4SrvTest, statisticsMalformedServerId) {
+    NakedDhcpv4Srv srv(0);
+
+    // The server identifier must be 4 bytes long.
+    const uint8_t server_id[] = { DHO_DHCP_SERVER_IDENTIFIER, 2, 192, 0 };
+    pretendReceivingMalformedOption(srv, CONFIGS[0],
+                                    std::vector<uint8_t>(server_id,
+                                                         server_id +
+                                                         sizeof(server_id)));
+}
+
+// Test checks that the message carrying a malformed option which the
+// server only retrieves while processing the message is also dropped
+// and counted as a parse failure.
+TEST_F(Dhcpv4SrvTest, statisticsMalformedHostname) {
+    NakedDhcpv4Srv srv(0);
+
+    // The Hostname option must not be empty.
+    const uint8_t hostname[] = { DHO_HOST_NAME, 0 };
+    pretendReceivingMalformedOption(srv, CONFIGS[0],
+                                    std::vector<uint8_t>(hostname,
+                                                         hostname +
+                                                         sizeof(hostname)));
+}
+
 // This test verifies that the server is able to handle an empty client-id
 // in incoming client message.
 TEST_F(Dhcpv4SrvTest, emptyClientId) {
@@ -87,6 +87,10 @@ Dhcpv4SrvTest::~Dhcpv4SrvTest() {
 
     LibDHCP::clearRuntimeOptionDefs();
 
+    // The lease manager is kept across the configurations, so it has to
+    // be removed for the next test to start with no leases.
+    LeaseMgrFactory::destroy();
+
     // Let's wipe all existing statistics.
     isc::stats::StatsMgr::instance().removeAll();
 }
@@ -677,6 +681,48 @@ Dhcpv4SrvTest::pretendReceivingPkt(NakedDhcpv4Srv& srv, const std::string& confi
     EXPECT_EQ(1, tested_stat->getInteger().first);
 }
 
+void
+Dhcpv4SrvTest::pretendReceivingMalformedOption(NakedDhcpv4Srv& srv,
+                                               const std::string& config,
+                                               const std::vector<uint8_t>& option) {
+    IfaceMgrTestConfig test_config(true);
+    IfaceMgr::instance().openSockets4();
+
+    configure(config);
+
+    // Go through the unpack/pack cycle to get the on-wire format of
+    // the captured Discover (see pretendReceivingPkt).
+    Pkt4Ptr pkt = PktCaptures::captureRelayedDiscover();
+    pkt->unpack();
+    pkt->pack();
+    const uint8_t* wire = static_cast<const uint8_t*>(pkt->getBuffer().getData());
+    pkt->data_.assign(wire, wire + pkt->getBuffer().getLength());
+
+    // Insert the malformed option in front of the END option.
+    ASSERT_EQ(DHO_END, pkt->data_.back());
+    pkt->data_.insert(pkt->data_.end() - 1, option.begin(), option.end());
+
+    srv.fakeReceive(pkt);
+    srv.run();
+
+    // The server must not respond.
+    EXPECT_TRUE(srv.fake_sent_.empty());
+
+    using namespace isc::stats;
+    StatsMgr& mgr = StatsMgr::instance();
+    ObservationPtr pkt4_rcvd = mgr.getObservation("pkt4-received");
+    ObservationPtr parse_failed = mgr.getObservation("pkt4-parse-failed");
+    ObservationPtr drop = mgr.getObservation("pkt4-receive-drop");
+
+    ASSERT_TRUE(pkt4_rcvd);
+    ASSERT_TRUE(parse_failed);
+    ASSERT_TRUE(drop);
+
+    EXPECT_EQ(1, pkt4_rcvd->getInteger().first);
+    EXPECT_EQ(1, parse_failed->getInteger().first);
+    EXPECT_EQ(1, drop->getInteger().first);
+}
+
 }; // end of isc::dhcp::test namespace
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
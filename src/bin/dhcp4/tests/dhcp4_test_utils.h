@@ -432,6 +432,21 @@ public:
     void pretendReceivingPkt(NakedDhcpv4Srv& srv, const std::string& config,
                              uint8_t pkt_type, const std::string& stat_name);
 
+    /// @brief Pretends a Discover carrying a malformed option was received.
+    ///
+    /// Instantiates fake network interfaces, configures passed Dhcpv4Srv,
+    /// then appends the specified option to a Discover message and sends
+    /// it to the server. Then it checks that the message has been dropped
+    /// and counted as a parse failure.
+    ///
+    /// @param srv the DHCPv4 server to be used
+    /// @param config JSON configuration to be used
+    /// @param option on-wire format of the malformed option, including
+    /// the option code and length
+    void pretendReceivingMalformedOption(NakedDhcpv4Srv& srv,
+                                         const std::string& config,
+                                         const std::vector<uint8_t>& option);
+
     /// @brief Create @c Dhcpv4Exchange from client's query.
     Dhcpv4Exchange createExchange(const Pkt4Ptr& query);
 
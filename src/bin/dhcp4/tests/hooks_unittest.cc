@@ -108,6 +108,7 @@ public:
         HooksManager::preCalloutsLibraryHandle().deregisterAllCallouts("pkt4_receive");
         HooksManager::preCalloutsLibraryHandle().deregisterAllCallouts("pkt4_send");
         HooksManager::preCalloutsLibraryHandle().deregisterAllCallouts("subnet4_select");
+        HooksManager::preCalloutsLibraryHandle().deregisterAllCallouts("lease4_select");
         HooksManager::preCalloutsLibraryHandle().deregisterAllCallouts("lease4_renew");
         HooksManager::preCalloutsLibraryHandle().deregisterAllCallouts("lease4_release");
         HooksManager::preCalloutsLibraryHandle().deregisterAllCallouts("lease4_decline");
@@ -514,6 +515,20 @@ public:
         return (0);
     }
 
+    /// Test lease4_select callback that retrieves the Time Offset option
+    /// of the query.
+    ///
+    /// @param callout_handle handle passed by the hooks framework
+    /// @return always 0
+    static int
+    lease4_select_callout(CalloutHandle& callout_handle) {
+        callback_name_ = string("lease4_select");
+        callout_handle.getArgument("query4", callback_qry_pkt4_);
+        callback_qry_pkt4_->getOption(DHO_TIME_OFFSET);
+
+        return (0);
+    }
+
     /// Test lease4_decline callback that stores received parameters.
     ///
     /// @param callout_handle handle passed by the hooks framework
@@ -1604,6 +1619,40 @@ TEST_F(HooksDhcpv4SrvTest, lease4ReleaseSkip) {
     EXPECT_EQ(leases.size(), 1);
 }
 
+// Checks that the query carrying a malformed option is dropped up front
+// when the lease4_select callouts, which may retrieve the option, are
+// installed.
+TEST_F(HooksDhcpv4SrvTest, lease4SelectMalformedOption) {
+    // Configuration used for the recorded traffic sent by
+    // pretendReceivingMalformedOption.
+    const std::string config =
+        "{ \"interfaces-config\": {"
+        "    \"interfaces\": [ \"*\" ]"
+        "},"
+        "\"rebind-timer\": 2000, "
+        "\"renew-timer\": 1000, "
+        "\"subnet4\": [ { "
+        "    \"pools\": [ { \"pool\": \"10.254.226.0/25\" } ],"
+        "    \"subnet\": \"10.254.226.0/24\" "
+        " } ],"
+        "\"valid-lifetime\": 4000 }";
+
+    // Install a callout
+    EXPECT_NO_THROW(HooksManager::preCalloutsLibraryHandle().registerCallout(
+                        "lease4_select", lease4_select_callout));
+
+    // The Time Offset option must be 4 bytes long. The server doesn't use
+    // it, so the query is dropped only because the callout may retrieve it.
+    const uint8_t time_offset[] = { DHO_TIME_OFFSET, 2, 0, 1 };
+    pretendReceivingMalformedOption(*srv_, config,
+                                    std::vector<uint8_t>(time_offset,
+                                                         time_offset +
+                                                         sizeof(time_offset)));
+
+    // The callout must not be called for the dropped query.
+    EXPECT_TRUE(callback_name_.empty());
+}
+
 // Checks that decline4 hooks (lease4_decline) are triggered properly.
 TEST_F(HooksDhcpv4SrvTest, HooksDecline) {
     IfaceMgrTestConfig test_config(true);
@@ -8,6 +8,7 @@
 
 #include <asiolink/io_address.h>
 #include <cc/command_interpreter.h>
+#include <cc/element_cache.h>
 #include <dhcp/dhcp4.h>
 #include <dhcp/hwaddr.h>
 #include <dhcp/iface_mgr.h>
@@ -65,6 +66,7 @@ public:
         LeaseMgrFactory::destroy();
         static_cast<void>(remove(TEST_FILE));
         static_cast<void>(remove(TEST_INCLUDE));
+        static_cast<void>(remove(TEST_CACHE));
     };
 
     /// @brief writes specified content to a well known file
@@ -101,10 +103,12 @@ public:
     /// Name of a config file used during tests
     static const char* TEST_FILE;
     static const char* TEST_INCLUDE;
+    static const char* TEST_CACHE;
 };
 
 const char* JSONFileBackendTest::TEST_FILE  = "test-config.json";
 const char* JSONFileBackendTest::TEST_INCLUDE = "test-include.json";
+const char* JSONFileBackendTest::TEST_CACHE = "test-config-cache.bin";
 
 // This test checks if configuration can be read from a JSON file.
 TEST_F(JSONFileBackendTest, jsonFile) {
@@ -379,6 +383,75 @@ TEST_F(JSONFileBackendTest, include) {
     EXPECT_EQ(Lease::TYPE_V4, pools1.at(0)->getType());
 }
 
+// This test checks that the configuration is stored in the cache file
+// and that the cache is used as long as the configuration file doesn't
+// change.
+TEST_F(JSONFileBackendTest, configCache) {
+    string config = "{ \"Dhcp4\": {"
+        "\"interfaces-config\": {"
+        "    \"interfaces\": [ \"*\" ]"
+        "},"
+        "\"subnet4\": [ { "
+        "    \"pools\": [ { \"pool\": \"192.0.2.1 - 192.0.2.100\" } ],"
+        "    \"subnet\": \"192.0.2.0/24\" "
+        " } ],"
+        "\"valid-lifetime\": 4000 }"
+        "}";
+    writeFile(TEST_FILE, config);
+
+    boost::scoped_ptr<ControlledDhcpv4Srv> srv;
+    ASSERT_NO_THROW(srv.reset(new ControlledDhcpv4Srv(0)));
+    srv->setConfigCacheFile(TEST_CACHE);
+    ASSERT_NO_THROW(srv->init(TEST_FILE));
+
+    const Subnet4Collection* subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getAll();
+    ASSERT_TRUE(subnets);
+    ASSERT_EQ(1, subnets->size());
+    EXPECT_EQ(4000, subnets->at(0)->getValid().get());
+
+    // The applied configuration including the default values has been
+    // cached.
+    ElementCache cache(TEST_CACHE, VERSION);
+    ElementPtr cached = cache.load(config);
+    ASSERT_TRUE(cached);
+    ASSERT_TRUE(cached->get("Dhcp4"));
+    EXPECT_TRUE(cached->get("Dhcp4")->get("decline-probation-period"));
+
+    // Modify the cached configuration to check that it is used instead
+    // of the configuration file.
+    ElementPtr modified = Element::fromJSON(config);
+    boost::const_pointer_cast<Element>(modified->get("Dhcp4"))->
+        set("valid-lifetime", Element::create(5000));
+    ASSERT_NO_THROW(cache.store(config, modified));
+    ASSERT_NO_THROW(srv->init(TEST_FILE));
+    subnets = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getAll();
+    ASSERT_EQ(1, subnets->size());
+    EXPECT_EQ(5000, subnets->at(0)->getValid().get());
+
+    // The cache is not used when the configuration file changes. The
+    // cache is updated instead.
+    config.replace(config.find("4000"), 4, "3000");
+    writeFile(TEST_FILE, config);
+    ASSERT_NO_THROW(srv->init(TEST_FILE));
+    subnets = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getAll();
+    ASSERT_EQ(1, subnets->size());
+    EXPECT_EQ(3000, subnets->at(0)->getValid().get());
+    EXPECT_TRUE(cache.load(config));
+
+    // The configuration including other files is not cached.
+    string include = "\"valid-lifetime\": 2000\n";
+    config.replace(config.find("\"valid-lifetime\": 3000"), 22,
+                   "<?include \"" + string(TEST_INCLUDE) + "\"?>");
+    writeFile(TEST_FILE, config);
+    writeFile(TEST_INCLUDE, include);
+    ASSERT_NO_THROW(srv->init(TEST_FILE));
+    subnets = CfgMgr::instance().getCurrentCfg()->getCfgSubnets4()->getAll();
+    ASSERT_EQ(1, subnets->size());
+    EXPECT_EQ(2000, subnets->at(0)->getValid().get());
+    EXPECT_FALSE(cache.load(config));
+}
+
 // This test checks if recursive include of a file is detected
 TEST_F(JSONFileBackendTest, recursiveInclude) {
 
@@ -10,6 +10,7 @@
 #include <dhcp/libdhcp++.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/cfg_db_access.h>
+#include <dhcpsrv/lease_cmds.h>
 #include <dhcp6/ctrl_dhcp6_srv.h>
 #include <dhcp6/dhcp6to4_ipc.h>
 #include <dhcp6/dhcp6_log.h>
@@ -373,6 +374,13 @@ ControlledDhcpv6Srv::ControlledDhcpv6Srv(uint16_t port)
 
     CommandMgr::instance().registerCommand("statistic-remove-all",
         boost::bind(&StatsMgr::statisticRemoveAllHandler, _1, _2));
+
+    // Register lease related commands
+    CommandMgr::instance().registerCommand("lease6-get-page",
+        boost::bind(&LeaseCmds::lease6GetPageHandler, _1, _2));
+
+    CommandMgr::instance().registerStreamCommand("lease6-export",
+        boost::bind(&LeaseCmds::lease6ExportHandler, _1, _2));
 }
 
 void ControlledDhcpv6Srv::shutdown() {
@@ -403,6 +411,8 @@ ControlledDhcpv6Srv::~ControlledDhcpv6Srv() {
         CommandMgr::instance().deregisterCommand("statistic-get-all");
         CommandMgr::instance().deregisterCommand("statistic-reset-all");
         CommandMgr::instance().deregisterCommand("statistic-remove-all");
+        CommandMgr::instance().deregisterCommand("lease6-get-page");
+        CommandMgr::instance().deregisterCommand("lease6-export");
 
     } catch (...) {
         // Don't want to throw exceptions from the destructor. The server
@@ -524,8 +524,8 @@ static void yynoreturn yy_fatal_error ( const char* msg  );
 /* %% [3.0] code to copy yytext_ptr to parser6_text[] goes here, if %array \ */\
 	(yy_c_buf_p) = yy_cp;
 /* %% [4.0] data tables for the DFA and the user's section 1 definitions go here */
-#define YY_NUM_RULES 149
-#define YY_END_OF_BUFFER 150
+#define YY_NUM_RULES 152
+#define YY_END_OF_BUFFER 153
 /* This struct is not used in this scanner,
    but its presence is necessary. */
 struct yy_trans_info
@@ -533,138 +533,145 @@ struct yy_trans_info
 	flex_int32_t yy_verify;
 	flex_int32_t yy_nxt;
 	};
-static const flex_int16_t yy_accept[1186] =
+static const flex_int16_t yy_accept[1244] =
     {   0,
-      142,  142,    0,    0,    0,    0,    0,    0,    0,    0,
-      150,  148,   10,   11,  148,    1,  142,  139,  142,  142,
-      148,  141,  140,  148,  148,  148,  148,  148,  135,  136,
-      148,  148,  148,  137,  138,    5,    5,    5,  148,  148,
-      148,   10,   11,    0,    0,  131,    0,    0,    0,    0,
+      145,  145,    0,    0,    0,    0,    0,    0,    0,    0,
+      153,  151,   10,   11,  151,    1,  145,  142,  145,  145,
+      151,  144,  143,  151,  151,  151,  151,  151,  138,  139,
+      151,  151,  151,  140,  141,    5,    5,   11,    5,  151,
+       10,   11,  151,  151,   10,   11,  151,  151,   10,   11,
+      151,   10,   11,    0,    0,  134,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    1,  142,  142,
-        0,  141,  142,    3,    2,    6,    0,  142,    0,    0,
-        0,    0,    0,    0,    4,    0,    0,    9,    0,  132,
+        0,    0,    0,    0,    0,    0,    0,    1,  145,  145,
+        0,  144,    3,    2,    6,    0,  145,    0,    0,    0,
 
+        0,    0,    0,   10,   11,    4,   10,   11,    0,   10,
+       11,    0,   10,   11,    9,  135,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  134,    0,    0,    0,    0,    0,
+      137,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    2,    0,    0,
-        0,    0,    0,    0,    0,    8,    0,    0,    0,  111,
-        0,    0,  112,    0,    0,    0,    0,    0,    0,    0,
-        0,  133,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    8,    0,    0,    0,  113,    0,    0,  114,    0,
 
+        0,    0,    0,    0,    0,    0,  136,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   77,    0,
+        0,    0,    0,    0,   79,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  147,  145,    0,  144,
-      143,    0,    0,    0,    0,    0,    0,  110,    0,    0,
-       27,    0,   26,    0,    0,    0,    0,    0,    0,    0,
-        0,   45,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,  150,  148,    0,  147,  146,    0,    0,
+        0,    0,    0,    0,  112,    0,    0,   27,    0,   26,
 
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   45,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  146,  143,
-        0,    0,    0,    0,    0,    0,    0,   28,    0,    0,
-       30,    0,    0,    0,    0,    0,   80,    0,    0,    0,
-        0,   64,    0,    0,    0,    0,    0,   96,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,   48,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   63,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   72,    0,   49,    0,
+        0,    0,    0,    0,    0,    0,    0,  149,  146,    0,
+        0,    0,    0,    0,    0,    0,   28,    0,    0,   30,
+        0,    0,    0,    0,    0,    0,   82,    0,    0,    0,
+
+        0,   66,    0,    0,    0,    0,    0,   98,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   48,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   92,  115,
-       41,    0,   46,    0,    0,    0,    0,    0,  129,   35,
-        0,   32,    0,   31,    0,    0,    0,  103,    0,    0,
+        0,    0,    0,    0,    0,    0,   65,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   74,    0,   49,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   94,
+      117,   41,    0,   46,    0,    0,    0,    0,    0,  132,
+       35,    0,   32,    0,   31,    0,    0,    0,  105,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      114,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,   43,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   65,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,  104,    0,    0,    0,    0,    0,
-        0,    0,    0,   99,    0,    0,    0,    0,    7,   33,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,  116,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   43,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,   67,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  106,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,  101,    0,    0,    0,
+        0,    7,   33,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   87,    0,    0,    0,    0,    0,    0,
-        0,    0,   67,    0,    0,    0,    0,    0,    0,    0,
 
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   74,
-        0,    0,    0,    0,    0,   84,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   89,    0,    0,
+        0,    0,    0,    0,    0,    0,   69,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   76,    0,    0,    0,    0,    0,
+       86,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  108,   85,
-        0,    0,    0,   42,    0,    0,    0,    0,    0,    0,
-        0,    0,   50,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   60,    0,    0,    0,  130,    0,
+        0,    0,    0,    0,    0,  110,   87,    0,    0,    0,
+       42,    0,    0,    0,    0,    0,    0,    0,    0,   50,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
 
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   98,    0,    0,    0,    0,    0,   53,    0,
+        0,    0,   62,    0,    0,    0,  133,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   47,   66,    0,    0,    0,   95,    0,    0,   40,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,   89,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,  128,
+        0,    0,  100,    0,    0,    0,    0,    0,   55,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,   75,    0,    0,    0,    0,    0,
+        0,   47,   68,    0,    0,    0,   97,    0,    0,   40,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-
+        0,    0,    0,   91,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   16,    0,  109,   14,    0,    0,    0,
+
+        0,    0,  131,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   77,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-      100,   88,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   97,  113,    0,   37,
-        0,  105,    0,    0,    0,    0,    0,    0,   20,    0,
-        0,   61,    0,    0,    0,  107,   44,    0,   68,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,   16,    0,  111,
+       14,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       54,    0,    0,    0,    0,    0,  102,   90,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,  102,    0,    0,    0,
+        0,    0,   99,  115,    0,   37,    0,  107,    0,    0,
+        0,    0,    0,    0,   20,    0,    0,   63,    0,    0,
 
+        0,  109,   44,    0,   70,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,   81,    0,    0,    0,   62,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,   57,    0,    0,    0,
-       17,   15,  127,  126,    0,    0,    0,    0,   29,    0,
-       91,    0,    0,    0,    0,    0,    0,  124,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   76,    0,
-       94,    0,   51,    0,    0,    0,   19,    0,    0,    0,
-        0,    0,   78,   58,    0,  101,    0,    0,    0,   93,
-        0,   73,    0,    0,    0,    0,    0,    0,    0,    0,
-       71,    0,  116,    0,    0,    0,    0,    0,    0,    0,
-
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,    0,   90,
-        0,   54,  125,    0,   12,    0,    0,    0,    0,    0,
-        0,    0,   39,    0,   38,   18,    0,    0,   86,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   56,    0,
-        0,   52,    0,   69,    0,    0,    0,    0,    0,  106,
+        0,    0,    0,    0,  104,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,   83,
+        0,    0,    0,   64,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,   59,    0,    0,    0,    0,   17,
+       15,  130,  129,    0,    0,    0,    0,   29,    0,   93,
+        0,    0,    0,    0,    0,    0,    0,  127,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,   78,    0,
+
+       96,    0,   51,    0,    0,    0,   19,    0,    0,    0,
+        0,    0,   80,   60,    0,  103,    0,    0,    0,   95,
+        0,    0,   75,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   73,    0,  118,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,   34,    0,    0,    0,    0,    0,   25,
-        0,    0,    0,    0,  122,    0,    0,    0,    0,    0,
-        0,    0,   79,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,   92,    0,    0,   56,  128,    0,   12,    0,
+        0,    0,    0,    0,    0,    0,   39,    0,   38,   18,
+        0,    0,   88,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,   58,    0,    0,   52,    0,    0,   71,
 
+        0,    0,    0,    0,    0,  108,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+       34,    0,    0,    0,    0,    0,    0,   25,    0,    0,
+        0,    0,  125,    0,    0,    0,    0,    0,    0,    0,
+       81,    0,    0,    0,    0,    0,    0,    0,    0,    0,
         0,   36,    0,    0,    0,    0,   13,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,  121,    0,
-       22,   55,    0,    0,    0,    0,   21,    0,   70,    0,
-        0,  120,    0,    0,    0,    0,   24,    0,    0,    0,
         0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
-        0,    0,    0,    0,    0,    0,    0,    0,   23,    0,
-       82,    0,    0,    0,    0,    0,  118,  123,   59,    0,
-        0,    0,  117,    0,    0,    0,    0,    0,    0,    0,
-       83,    0,    0,  119,    0
+      124,    0,   22,   57,    0,    0,    0,    0,    0,   21,
+        0,    0,   72,    0,    0,  122,    0,    0,    0,    0,
+       24,    0,    0,   53,    0,    0,    0,    0,    0,    0,
+
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+      123,    0,    0,    0,    0,    0,   23,    0,   84,    0,
+        0,    0,    0,    0,  120,  126,   61,    0,    0,    0,
+      119,    0,    0,    0,    0,    0,    0,    0,   85,    0,
+        0,  121,    0
     } ;
 
 static const YY_CHAR yy_ec[256] =
@@ -680,9 +687,9 @@ static const YY_CHAR yy_ec[256] =
         5,   33,   34,   35,   36,   37,   38,    5,   39,    5,
        40,   41,   42,    5,   43,    5,   44,   45,   46,   47,
 
-       48,   49,   50,   51,   52,   53,   54,   55,   56,   57,
-       58,   59,   60,   61,   62,   63,   64,   65,   66,   67,
-       68,   69,   70,    5,   71,    5,    5,    5,    5,    5,
+       48,   49,   50,   51,   52,   28,   53,   54,   55,   56,
+       57,   58,   59,   60,   61,   62,   63,   64,   65,   66,
+       67,   68,   69,    5,   70,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
         5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
@@ -699,652 +706,843 @@ static const YY_CHAR yy_ec[256] =
         5,    5,    5,    5,    5
     } ;
 
-static const YY_CHAR yy_meta[72] =
+static const YY_CHAR yy_meta[71] =
     {   0,
-        1,    1,    2,    3,    3,    4,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    3,    3,    3,    3,
-        5,    5,    5,    5,    5,    5,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    5,    5,    5,    5,    5,    5,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
-        3
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1
     } ;
 
-static const flex_int16_t yy_base[1198] =
+static const flex_int16_t yy_base[1244] =
     {   0,
-        0,   70,   19,   29,   41,   49,   52,   58,   87,   95,
-     1548, 1549,   32, 1544,  141,    0,  201, 1549,  206,   88,
-       11,  213, 1549, 1526,  114,   25,    2,    6, 1549, 1549,
-       73,   11,   17, 1549, 1549, 1549,  104, 1532, 1487,    0,
-     1524,  107, 1539,  217,  241, 1549,  185, 1490, 1510,   93,
-       58,  190,   91,  211,  200,   14,  267,  213,  175,  188,
-       64,  220, 1491,  187,   75, 1490,  261,  215,  289,  256,
-      278, 1473,  207,  284,  311,  293, 1492,    0,  337,  352,
-      360,  366,  372, 1549,    0, 1549,  331,  378,  227,  231,
-      320,  294,  341,  325, 1549, 1489, 1528, 1549,  237, 1549,
-
-      377,  335, 1487, 1526,  366,  253,  323, 1481,  362,  295,
-      366,  306,  293, 1524,    0,  428,  365, 1468, 1476,  351,
-     1472, 1461, 1462,  360, 1478, 1471,  365,  358, 1458, 1464,
-      361, 1452, 1508,  407, 1455, 1506, 1448, 1471, 1468, 1468,
-     1462,  366, 1455, 1448, 1453, 1447, 1444, 1443, 1457,  363,
-     1493, 1442,  374, 1454, 1457, 1441,  401,  400, 1453, 1454,
-     1452, 1434, 1439, 1435, 1427, 1444, 1436,    0,  405,  430,
-      423,  428,  437,  439, 1435, 1549,    0,  447, 1430, 1549,
-      435,  380, 1549, 1482, 1437,  445, 1480,  453, 1479,  449,
-     1478, 1549,  493,  459, 1439, 1434, 1433,  425, 1474, 1468,
-
-     1434, 1413, 1421, 1427, 1415, 1426, 1427, 1427, 1422, 1414,
-     1416, 1405, 1418, 1418, 1410, 1400, 1403, 1417, 1549, 1403,
-     1411, 1414, 1395, 1394, 1444, 1393, 1403, 1441, 1440, 1401,
-     1389, 1400, 1436, 1394, 1386, 1383, 1399, 1380, 1382, 1378,
-     1384, 1375, 1374, 1387, 1380, 1382, 1386, 1380,   80, 1387,
-     1382, 1374, 1380, 1380, 1361, 1377, 1370, 1377, 1365, 1358,
-     1372, 1371, 1374, 1356, 1364,  456, 1549, 1549,  464, 1549,
-     1549, 1351,    0,  445,  505,  474, 1408, 1549, 1361,  450,
-     1549, 1406, 1549, 1400,  529,  455, 1342, 1352, 1402, 1359,
-      466, 1549, 1357, 1399, 1354, 1351, 1352,  485, 1395, 1345,
-
-     1340, 1337, 1333, 1335, 1344, 1333, 1382, 1330,  522, 1343,
-     1343, 1326, 1327, 1340, 1327, 1337, 1332, 1339, 1334, 1319,
-      464, 1328, 1324, 1372,  446, 1319, 1312, 1314, 1318, 1307,
-     1314, 1319,   62, 1364, 1319,  450, 1316, 1320, 1308, 1308,
-     1320, 1302, 1294, 1295, 1316, 1298, 1310, 1309, 1295, 1307,
-     1306, 1305, 1346, 1345, 1344, 1288,  520, 1301, 1549, 1549,
-     1300,    0,  496, 1340, 1339, 1297, 1337, 1549, 1285, 1335,
-     1549,  502,  571,  501, 1334, 1276, 1549, 1292, 1291, 1278,
-     1277, 1549, 1279, 1276, 1288, 1284, 1272, 1549, 1281, 1266,
-     1268, 1279, 1277, 1313, 1279, 1261, 1310, 1549, 1259, 1275,
-
-     1307, 1311, 1269, 1263, 1265, 1266, 1268, 1300, 1253, 1248,
-     1247, 1249, 1242, 1257, 1249, 1297, 1549, 1244, 1240, 1243,
-     1236, 1246, 1249, 1238, 1237, 1232, 1549, 1287, 1549, 1231,
-     1230, 1223, 1240, 1277, 1230, 1239, 1233, 1237,  551, 1272,
-     1236, 1216, 1219, 1218, 1226, 1214, 1270, 1212, 1549, 1549,
-     1549, 1217, 1549, 1227, 1261, 1223,    0, 1264, 1549, 1549,
-     1212, 1549, 1218, 1549,  525,  503,  554, 1549, 1256, 1203,
-     1202, 1209, 1202, 1214, 1213, 1197, 1212, 1242, 1246, 1192,
-     1194, 1206, 1206, 1191, 1188, 1202, 1194, 1200, 1191, 1199,
-     1549, 1184, 1195, 1199, 1181, 1195, 1193, 1176, 1170, 1175,
-
-     1172, 1187, 1188, 1185, 1549, 1171, 1173, 1219,  560, 1182,
-     1165, 1166, 1171, 1162, 1549, 1176, 1162,  561, 1154, 1175,
-     1165, 1208, 1162, 1206, 1549, 1154, 1152, 1166, 1169, 1201,
-     1200, 1147, 1198, 1549,  564, 1160, 1149, 1151, 1549, 1549,
-     1143, 1198,  536,  521, 1151, 1156, 1190, 1189, 1188, 1142,
-     1132, 1185, 1147, 1137, 1182, 1128, 1136, 1138, 1142, 1177,
-     1139, 1138, 1139, 1132, 1121, 1134, 1137, 1132, 1127, 1132,
-     1129, 1128, 1131, 1126, 1167, 1166, 1110, 1106, 1114, 1162,
-     1111, 1103, 1118, 1549, 1106, 1115, 1114, 1114, 1098, 1153,
-     1096, 1109, 1549, 1101, 1093, 1102, 1095, 1084, 1088, 1139,
-
-     1086, 1084, 1095, 1135, 1082,  529,  530, 1076,  541, 1549,
-     1137, 1095, 1084, 1088, 1133, 1549, 1127,  566, 1080, 1081,
-     1072, 1075, 1071, 1088, 1083, 1071, 1082, 1066, 1068, 1067,
-     1081, 1062, 1112, 1067, 1075, 1073, 1064, 1073, 1069, 1110,
-     1052, 1052, 1065, 1064, 1049, 1104, 1046, 1047, 1549, 1549,
-     1061, 1058, 1061, 1549, 1060, 1045,  557, 1043, 1090, 1039,
-     1093, 1092, 1549, 1037, 1049, 1047, 1088, 1036, 1036, 1085,
-     1038, 1026, 1020, 1028, 1030, 1039, 1032, 1024, 1024,  543,
-     1023, 1074, 1035, 1010, 1549, 1066, 1013, 1026, 1549,  574,
-      543, 1028, 1029, 1020, 1013, 1012, 1006, 1013, 1006, 1055,
-
-     1059, 1006, 1016,  999, 1013, 1001, 1011, 1003, 1046, 1012,
-      994,  993, 1549, 1009,  990,  990,  601,  988, 1549,   15,
-       61,  198,  270,  308,  344,  383,  423,  498,  485,  564,
-      487, 1549, 1549,  553,  600,  556, 1549,  564,  566, 1549,
-      567,  572,  566,  567,  579,  574,  572,  625,  571,  628,
-      629,  575, 1549,  581,  579,  578,  592,  593,  609,  614,
-      588,  583,  590,  595,  602,  643,  644,  593,  597, 1549,
-      592,  610,  607,  645,  596,  614,  615,  601,  609,  618,
-      599,  620,  660,  661, 1549,  616,  663,  666,  628,  631,
-      614,  615,  622,  673,  622,  637,  676,  631,  629,  627,
-
-      680,  681,  633,  683,  679,  639,  644,  637,  646,  640,
-      635,  645,  641, 1549,  636, 1549, 1549,  637,  653,  654,
-      655,  637,  642,  681,  672,  644,  647,  662,  654,  658,
-     1549, 1549,  668,  667,  653,  654,  712,  667,  672,  659,
-      670,  662,  668,  664,  682,  683, 1549, 1549,  681, 1549,
-      684, 1549,  669,  688,  678,  728,  684,  726, 1549,  683,
-      733, 1549,  682,  689,  731, 1549, 1549,  691, 1549,  682,
-      682,  685,  699,  686,  697,  744,  703,  741,  747,  748,
-      749,  750,  711,  695,  707,  726,  755,  715,  757,  706,
-      702,  718,  723,  711,  763,  722, 1549,  724,  723,  725,
-
-      718,  727,  728,  725,  715,  717,  774,  723,  776,  721,
-      778, 1549,  716,  731,  781, 1549,  732,  742,  727,  743,
-      729,  789,  790,  736,  792,  751, 1549,  743,  745,  796,
-     1549, 1549, 1549, 1549,  749,  800,  751,  783, 1549,  761,
-     1549,  748,  747,  750,  750,  751,  809, 1549,  754,  811,
-      766,  757,  772,  772,  775,  775,  772,  777, 1549,  769,
-     1549,  779, 1549,  780,  781,  778, 1549,  770,  776,  775,
-      787,  787, 1549, 1549,  826, 1549,  791,  776,  782, 1549,
-      797, 1549,  794,  813,  833,  839,  783,  841,  842,  797,
-     1549,  844, 1549,  784,  841,  806,  802,  844,  794,  799,
-
-      852,  810,  854,  855,  818,  807,  858,  802,  819,  804,
-      819,  803,  860,  861,  826,  822,  869,  841,  828, 1549,
-      872, 1549, 1549,  821, 1549,  874,  822,  871,  816,  821,
-      880,  830, 1549,  836, 1549, 1549,  827,  842, 1549,  880,
-      848,  841,  842,  851,  838,  840,  850,  843, 1549,  894,
-      841, 1549,  845, 1549,  848,  844,  843,  901,  856, 1549,
-      898,  860,  863,  906,  849,  851,  859,  849,  865,  859,
-      875,  914,  910, 1549,  875,  912,  876,  867,  874, 1549,
-      871,  876,  923,  868, 1549,  872,  884,  885,  928,  872,
-      873,  881, 1549,  892,  882,  881,  884,  896,  887,  896,
-
-      898, 1549,  940,  900,  942,  943, 1549,  939,  899,  904,
-      885,  948,  907,  950,  909,  910,  953,  912, 1549,  917,
-     1549, 1549,  899,  905,  958,  919, 1549,  905, 1549,  905,
-      907, 1549,  912,  907,  919,  915, 1549,  918,  922,  913,
-      965,  914,  930,  923,  918,  933,  924,  931,  918,  933,
-      980,  939,  982,  927,  943,  934,  948,  944, 1549,  988,
-     1549,  989,  990,  947,  946,  947, 1549, 1549, 1549,  994,
-      938,  954, 1549,  992,  943,  942,  944,  955, 1002,  953,
-     1549,  962, 1005, 1549, 1549, 1011, 1016, 1021, 1026, 1031,
-     1036, 1041, 1044, 1018, 1023, 1025, 1038
-
+       72,  143,  144,  215,  216,  287,  288,  359,  360,  431,
+      432,  433,  434,  141,  438,  508,  567,  435,  570,  575,
+      580,  437,  511,  196,  585,  559,  561,  562,  598,  602,
+      244,  297,  374,  604,  605,  606,  607,  609,  594,  608,
+      612,  610,  554,  617,  616,  618,  624,  619,  693,  620,
+      611,  627,  696,  694,  744,  766,  756,  716,  741,  768,
+      750,  757,  788,  792,  793,  791,  852,  721,  772,  776,
+      778,  722,  729,  784,  774,  730,  875,  864,  799,  870,
+      882,  720,  775,  887,  888,  885,  743,  822,  828,  835,
+      837,  847,  848,  952,  850,  938,  851,  994,  995,  889,
+
+      811,  843,  838,  914,  937,  943,  948,  951,  892,  965,
+     1025, 1020, 1027, 1028, 1029, 1030, 1026,  993,  987, 1031,
+     1005, 1004, 1034,  986, 1001, 1010, 1007, 1014, 1016, 1049,
+     1044, 1100,  980,  996, 1008, 1011, 1036,  999,  983,  998,
+     1033, 1035, 1021, 1051, 1038, 1003, 1018, 1073,  990, 1065,
+     1071, 1023, 1069, 1024, 1055, 1047, 1059, 1050, 1062, 1052,
+     1056, 1063, 1060, 1048, 1067, 1083, 1072, 1124, 1076, 1080,
+     1090, 1095, 1084, 1106, 1097, 1108, 1099, 1110, 1098, 1101,
+     1105, 1093, 1117, 1112, 1134, 1142, 1145, 1111, 1119, 1126,
+     1121, 1176, 1163, 1159, 1123, 1182, 1156, 1162, 1183, 1185,
+
+     1144, 1172, 1192, 1174, 1194, 1171, 1202, 1209, 1160, 1161,
+     1155, 1165, 1166, 1180, 1210, 1204, 1175, 1158, 1184, 1178,
+     1170, 1190, 1195, 1197, 1181, 1189, 1187, 1186, 1196, 1198,
+     1193, 1188, 1191, 1207, 1248, 1203, 1212, 1208, 1200, 1201,
+     1252, 1205, 1214, 1255, 1256, 1219, 1211, 1221, 1260, 1220,
+     1215, 1216, 1230, 1217, 1222, 1218, 1223, 1213, 1224, 1232,
+     1228, 1231, 1237, 1233, 1234, 1243, 1241, 1236, 1244, 1235,
+     1246, 1238, 1247, 1245, 1251, 1249, 1239, 1258, 1259, 1250,
+     1240, 1257, 1274, 1303, 1304, 1262, 1308, 1311, 1253, 1305,
+     1273, 1299, 1288, 1312, 1317, 1272, 1300, 1325, 1326, 1334,
+
+     1324, 1341, 1270, 1271, 1291, 1285, 1336, 1295, 1301, 1344,
+     1297, 1342, 1309, 1306, 1318, 1358, 1364, 1293, 1313, 1314,
+     1315, 1316, 1321, 1319, 1366, 1320, 1369, 1335, 1337, 1329,
+     1322, 1345, 1338, 1346, 1343, 1349, 1350, 1339, 1347, 1351,
+     1348, 1391, 1352, 1354, 1353, 1355, 1357, 1340, 1356, 1362,
+     1393, 1398, 1359, 1370, 1365, 1361, 1363, 1367, 1375, 1368,
+     1360, 1371, 1377, 1372, 1376, 1378, 1381, 1373, 1383, 1386,
+     1387, 1431, 1432, 1433, 1380, 1435, 1395, 1443, 1444, 1400,
+     1434, 1411, 1445, 1446, 1406, 1455, 1462, 1407, 1458, 1465,
+     1436, 1474, 1408, 1461, 1459, 1409, 1473, 1428, 1429, 1419,
+
+     1420, 1484, 1437, 1430, 1441, 1440, 1447, 1493, 1453, 1442,
+     1448, 1460, 1454, 1494, 1464, 1449, 1499, 1511, 1452, 1469,
+     1503, 1509, 1470, 1472, 1467, 1478, 1482, 1516, 1475, 1468,
+     1476, 1477, 1466, 1485, 1481, 1524, 1532, 1480, 1479, 1486,
+     1483, 1488, 1490, 1487, 1489, 1491, 1541, 1537, 1547, 1495,
+     1496, 1492, 1500, 1539, 1497, 1501, 1502, 1504, 1551, 1548,
+     1514, 1505, 1550, 1506, 1507, 1512, 1508, 1557, 1510, 1565,
+     1568, 1571, 1517, 1574, 1529, 1566, 1528, 1564, 1575, 1582,
+     1583, 1535, 1584, 1542, 1593, 1563, 1562, 1585, 1597, 1538,
+     1587, 1540, 1543, 1546, 1544, 1553, 1555, 1545, 1559, 1598,
+
+     1604, 1554, 1556, 1570, 1572, 1561, 1567, 1576, 1569, 1577,
+     1573, 1579, 1627, 1578, 1581, 1588, 1580, 1589, 1586, 1590,
+     1591, 1592, 1594, 1595, 1596, 1599, 1631, 1600, 1602, 1623,
+     1630, 1601, 1603, 1606, 1607, 1605, 1637, 1608, 1609, 1633,
+     1610, 1616, 1614, 1634, 1615, 1635, 1641, 1611, 1612, 1628,
+     1619, 1620, 1638, 1639, 1613, 1640, 1654, 1672, 1632, 1625,
+     1617, 1655, 1664, 1622, 1678, 1650, 1661, 1642, 1643, 1644,
+     1676, 1680, 1681, 1645, 1629, 1685, 1649, 1646, 1687, 1626,
+     1647, 1651, 1652, 1693, 1657, 1658, 1662, 1659, 1653, 1665,
+     1663, 1667, 1666, 1670, 1669, 1671, 1677, 1674, 1704, 1714,
+
+     1673, 1660, 1675, 1718, 1679, 1668, 1684, 1725, 1682, 1688,
+     1689, 1691, 1683, 1720, 1686, 1692, 1727, 1694, 1690, 1697,
+     1695, 1696, 1698, 1721, 1699, 1701, 1702, 1724, 1700, 1703,
+     1707, 1715, 1705, 1712, 1741, 1736, 1706, 1713, 1719, 1737,
+     1745, 1735, 1716, 1722, 1708, 1726, 1717, 1728, 1723, 1709,
+     1711, 1710, 1729, 1739, 1730, 1731, 1732, 1738, 1733, 1746,
+     1734, 1747, 1748, 1742, 1752, 1744, 1750, 1740, 1743, 1751,
+     1753, 1749, 1769, 1754, 1755, 1783, 1784, 1757, 1758, 1756,
+     1798, 1761, 1760, 1763, 1762, 1797, 1759, 1803, 1806, 1813,
+     1764, 1767, 1770, 1815, 1766, 1771, 1818, 1773, 1765, 1768,
+
+     1772, 1774, 1782, 1779, 1788, 1775, 1777, 1789, 1780, 1832,
+     1795, 1776, 1840, 1830, 1786, 1793, 1844, 1814, 1820, 1804,
+     1801, 1807, 1800, 1799, 1796, 1802, 1792, 1808, 1805, 1845,
+     1851, 1809, 1811, 1812, 1816, 1817, 1819, 1822, 1849, 1825,
+     1810, 1821, 1861, 1827, 1823, 1826, 1867, 1824, 1863, 1833,
+     1828, 1831, 1869, 1835, 1829, 1836, 1834, 1839, 1837, 1847,
+     1841, 1883, 1889, 1843, 1879, 1838, 1895, 1848, 1846, 1900,
+     1850, 1852, 1853, 1854, 1858, 1855, 1856, 1857, 1901, 1859,
+     1902, 1904, 1860, 1914, 1866, 1864, 1865, 1868, 1870, 1882,
+     1893, 1872, 1918, 1871, 1874, 1916, 1878, 1885, 1927, 1928,
+
+     1880, 1881, 1936, 1884, 1894, 1891, 1929, 1886, 1897, 1899,
+     1887, 1896, 1903, 1888, 1905, 1945, 1947, 1954, 1906, 1949,
+     1950, 1912, 1915, 1907, 1908, 1909, 1955, 1910, 1919, 1956,
+     1913, 1917, 1920, 1960, 1964, 1921, 1966, 1962, 1922, 1930,
+     1924, 1932, 1931, 1923, 1934, 1925, 1938, 1976, 1926, 1984,
+     1987, 1933, 1941, 1942, 1943, 1935, 1937, 1967, 1958, 1939,
+     1994, 1944, 1948, 1946, 1951, 1953, 1997, 2000, 1963, 1961,
+     1952, 1957, 2004, 1959, 1965, 1968, 1969, 1970, 1971, 1972,
+     1973, 1974, 2003, 2012, 1975, 2016, 1977, 2024, 1978, 1981,
+     1979, 2021, 1982, 2017, 2031, 1983, 2029, 2036, 1985, 1986,
+
+     2030, 2040, 2043, 1992, 2045, 1988, 1989, 1990, 1998, 1991,
+     1995, 2042, 2005, 2044, 2001, 2048, 2050, 2052, 2053, 2014,
+     1999, 2010, 2032, 2057, 2018, 2058, 2011, 2013, 2007, 2019,
+     2027, 2020, 2066, 2025, 2074, 2028, 2033, 2035, 2022, 2037,
+     2038, 2026, 2034, 2023, 2073, 2041, 2075, 2039, 2081, 2080,
+     2046, 2047, 2082, 2089, 2051, 2049, 2054, 2055, 2056, 2084,
+     2085, 2060, 2086, 2062, 2094, 2059, 2061, 2093, 2063, 2095,
+     2102, 2103, 2108, 2064, 2105, 2067, 2087, 2113, 2076, 2121,
+     2065, 2068, 2070, 2069, 2071, 2072, 2117, 2128, 2077, 2123,
+     2088, 2078, 2096, 2083, 2090, 2097, 2091, 2098, 2136, 2092,
+
+     2141, 2099, 2142, 2101, 2104, 2106, 2150, 2100, 2107, 2109,
+     2111, 2115, 2151, 2153, 2143, 2155, 2110, 2112, 2114, 2156,
+     2116, 2118, 2160, 2122, 2135, 2158, 2166, 2119, 2124, 2167,
+     2169, 2125, 2176, 2173, 2180, 2120, 2171, 2137, 2131, 2174,
+     2126, 2132, 2182, 2144, 2184, 2186, 2152, 2139, 2189, 2138,
+     2154, 2140, 2148, 2133, 2188, 2192, 2157, 2149, 2159, 2200,
+     2172, 2161, 2208, 2203, 2201, 2213, 2214, 2162, 2215, 2210,
+     2164, 2206, 2163, 2165, 2212, 2168, 2220, 2178, 2223, 2225,
+     2170, 2185, 2226, 2217, 2191, 2187, 2190, 2193, 2175, 2194,
+     2195, 2196, 2181, 2238, 2234, 2197, 2241, 2198, 2199, 2245,
+
+     2204, 2202, 2205, 2240, 2209, 2247, 2237, 2207, 2216, 2243,
+     2211, 2218, 2221, 2219, 2227, 2224, 2222, 2246, 2242, 2249,
+     2251, 2228, 2229, 2252, 2230, 2231, 2232, 2254, 2235, 2239,
+     2259, 2233, 2268, 2244, 2248, 2250, 2263, 2253, 2255, 2256,
+     2270, 2257, 2258, 2236, 2260, 2262, 2265, 2261, 2267, 2264,
+     2266, 2271, 2277, 2269, 2280, 2281, 2272, 2278, 2273, 2275,
+     2274, 2276, 2287, 2279, 2282, 2289, 2283, 2284, 2291, 2285,
+     2299, 2290, 2300, 2301, 2286, 2288, 2297, 2292, 2293, 2305,
+     2302, 2294, 2306, 2295, 2298, 2309, 2296, 2303, 2307, 2304,
+     2310, 2313, 2308, 2314, 2311, 2312, 2318, 2315, 2316, 2317,
+
+     2319, 2329, 2320, 2321, 2322, 2323, 2324, 2330, 2327, 2331,
+     2338, 2325, 2332, 2326, 2337, 2334, 2340, 2335, 2342, 2343,
+     2344, 2339, 2333, 2341, 2346, 2351, 2353, 2349, 2328, 2336,
+     2357, 2355, 2345, 2347, 2350, 2348, 2361, 2352, 2369, 2354,
+     2364, 2371,    1
     } ;
 
-static const flex_int16_t yy_def[1198] =
+static const flex_int16_t yy_def[1244] =
     {   0,
-     1186, 1186, 1187, 1187, 1186, 1186, 1186, 1186, 1186, 1186,
-     1185, 1185, 1185, 1185, 1185, 1188, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1189,
-     1185, 1185, 1185, 1190,   15, 1185,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1191,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1188, 1185, 1185,
-     1185, 1185, 1185, 1185, 1192, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1189, 1185, 1190, 1185,
-
-     1185,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1193,   45, 1191,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1192, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1194,   45,   45, 1185,
-       45,   45, 1185,   45,   45,   45,   45,   45,   45,   45,
-     1193, 1185, 1191,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1185,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1195,   45,   45,   45,   45, 1185,   45,   45,
-     1185,   45, 1185,   45, 1191,   45,   45,   45,   45,   45,
-       45, 1185,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1185, 1185,
-     1185, 1196,   45,   45,   45,   45,   45, 1185,   45,   45,
-     1185,   45, 1191,   45,   45,   45, 1185,   45,   45,   45,
-       45, 1185,   45,   45,   45,   45,   45, 1185,   45,   45,
-       45,   45,   45,   45,   45,   45,   45, 1185,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1185,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1185,   45, 1185,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1185, 1185,
-     1185,   45, 1185,   45,   45, 1185, 1197,   45, 1185, 1185,
-       45, 1185,   45, 1185,   45,   45,   45, 1185,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1185,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45, 1185,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1185,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1185,   45,   45,   45,   45,   45,
-       45,   45,   45, 1185,   45,   45,   45,   45, 1185, 1185,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1185,   45,   45,   45,   45,   45,   45,
-       45,   45, 1185,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1185,
-       45,   45,   45,   45,   45, 1185,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1185, 1185,
-       45,   45,   45, 1185,   45,   45,   45,   45,   45,   45,
-       45,   45, 1185,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1185,   45,   45,   45, 1185,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1185,   45,   45,   45,   45,   45, 1185,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1185, 1185,   45,   45,   45, 1185,   45,   45, 1185,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45, 1185,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1185,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45, 1185,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1185,   45, 1185, 1185,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-     1185, 1185,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1185, 1185,   45, 1185,
-       45, 1185,   45,   45,   45,   45,   45,   45, 1185,   45,
-       45, 1185,   45,   45,   45, 1185, 1185,   45, 1185,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1185,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45, 1185,   45,   45,   45, 1185,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45, 1185,   45,   45,   45,
-     1185, 1185, 1185, 1185,   45,   45,   45,   45, 1185,   45,
-     1185,   45,   45,   45,   45,   45,   45, 1185,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1185,   45,
-     1185,   45, 1185,   45,   45,   45, 1185,   45,   45,   45,
-       45,   45, 1185, 1185,   45, 1185,   45,   45,   45, 1185,
-       45, 1185,   45,   45,   45,   45,   45,   45,   45,   45,
-     1185,   45, 1185,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45, 1185,
-       45, 1185, 1185,   45, 1185,   45,   45,   45,   45,   45,
-       45,   45, 1185,   45, 1185, 1185,   45,   45, 1185,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1185,   45,
-       45, 1185,   45, 1185,   45,   45,   45,   45,   45, 1185,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45, 1185,   45,   45,   45,   45,   45, 1185,
-       45,   45,   45,   45, 1185,   45,   45,   45,   45,   45,
-       45,   45, 1185,   45,   45,   45,   45,   45,   45,   45,
-
-       45, 1185,   45,   45,   45,   45, 1185,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1185,   45,
-     1185, 1185,   45,   45,   45,   45, 1185,   45, 1185,   45,
-       45, 1185,   45,   45,   45,   45, 1185,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45, 1185,   45,
-     1185,   45,   45,   45,   45,   45, 1185, 1185, 1185,   45,
-       45,   45, 1185,   45,   45,   45,   45,   45,   45,   45,
-     1185,   45,   45, 1185,    0, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185
-
+     1243,    1,    1,    3,    1,    5,    1,    7,    1,    9,
+     1243, 1243,   12,   12,    1,   12,   12,   12,   17,   17,
+       12,   19,   12,   12,   12,   12,   12,   12,   12,   12,
+       26,   27,   28,   12,   12,   12,   12,   12,   12,   12,
+       12,   12,   12,   12,   12,   12,   12,   12,   12,   12,
+       12,   13,   14,   15,   15,   12,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   57,   55,   55,
+       55,   60,   55,   55,   55,   55,   55,   55,   63,   55,
+       55,   55,   55,   55,   64,   65,   55,   16,   20,   17,
+       25,   19,   12,   21,   12,   25,   96,   12,   12,   12,
+
+       98,   99,  100,   37,   38,   12,   41,   42,   12,   45,
+       46,   47,   49,   50,   12,   12,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   67,
+       55,  130,  118,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   12,   12,  185,  186,  187,
+       12,   12,   12,   55,   55,   12,   55,   55,   12,   55,
+
+       55,   55,   55,   55,   55,   55,   12,  132,  194,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   12,   12,  283,   12,   12,   12,   12,
+       55,   55,   55,   55,   12,   55,   55,   12,   55,   12,
+
+       55,  132,  291,   55,   55,   55,   55,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   12,   12,   12,
+       12,   55,   55,   55,   55,   55,   12,   55,   55,   12,
+       55,  132,  382,   55,   55,   55,   12,   55,   55,   55,
+
+       55,   12,   55,   55,   55,   55,   55,   12,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   12,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   12,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+       12,   12,   55,   12,   55,   55,   12,   12,   55,   12,
+       12,   55,   12,   55,   12,   55,   55,  479,   12,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   12,   12,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   12,   55,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   12,   12,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   55,   55,   55,   55,   12,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   12,   12,   55,   55,   55,   12,   55,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   12,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   12,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   12,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   12,   55,   12,
+       12,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   12,   12,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   12,   55,   12,   55,   12,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   12,   55,   55,
+
+       55,   12,   12,   55,   12,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   12,
+       55,   55,   55,   12,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   12,   55,   55,   55,   55,   12,
+       12,   12,   12,   55,   55,   55,   55,   12,   55,   12,
+       55,   55,   55,   55,   55,   55,   55,   12,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   12,   55,
+
+       12,   55,   12,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   12,   12,   55,   12,   55,   55,   55,   12,
+       55,   55,   12,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   12,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   12,   55,   55,   12,   12,   55,   12,   55,
+       55,   55,   55,   55,   55,   55,   12,   55,   12,   12,
+       55,   55,   12,   55,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   12,   55,   55,   12,   55,   55,   12,
+
+       55,   55,   55,   55,   55,   12,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   55,   12,   55,   55,
+       55,   55,   12,   55,   55,   55,   55,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       55,   12,   55,   55,   55,   55,   12,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       12,   55,   12,   12,   55,   55,   55,   55,   55,   12,
+       55,   55,   12,   55,   55,   12,   55,   55,   55,   55,
+       12,   55,   55,   12,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   12,   55,   12,   55,
+       55,   55,   55,   55,   12,   12,   12,   55,   55,   55,
+       12,   55,   55,   55,   55,   55,   55,   55,   12,   55,
+       55,   12,    0
     } ;
 
-static const flex_int16_t yy_nxt[1621] =
+static const flex_int16_t yy_nxt[2442] =
     {   0,
-     1185,   13,   14,   13, 1185,   15,   16, 1185,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   84, 1185,
-       37,   14,   37,   85,   25,   26,   38, 1185, 1185,   27,
-       37,   14,   37,   42,   28,   42,   38,   90,   91,   29,
-      113,   30,   13,   14,   13,   89,   90,   25,   31,   91,
-       13,   14,   13,   13,   14,   13,   32,   40,  789,   13,
-       14,   13,   33,   40,  113,   90,   91,  427,   89,   34,
-       35,   13,   14,   13,   93,   15,   16,   94,   17,   18,
-       19,   20,   21,   22,   22,   22,   23,   24,   13,   14,
-       13,  106,   39,   89,   25,   26,   13,   14,   13,   27,
-
-       39,   83,   83,   83,   28,   42,   41,   42,   42,   29,
-       42,   30,   81,  105,   41,  109,   92,   25,   31,  106,
-      127,  134,   87,  428,   87,  790,   32,   88,   88,   88,
-      128,  135,   33,  136,  341,   81,  105,  342,  109,   34,
-       35,   44,   44,   44,   45,   45,   46,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-       45,   47,   45,   45,   48,   49,   50,   45,   51,   52,
-       53,   45,   45,   45,   45,   54,   55,   45,   56,   45,
-       45,   57,   45,   45,   58,   45,   59,   60,   61,   62,
-       63,   64,   65,   51,   66,   67,   68,   69,   70,   71,
-
-       72,   73,   74,   75,   76,   77,   56,   45,   45,   45,
-       45,   45,   79,  102,   80,   80,   80,   79,  107,   82,
-       82,   82,  100,  112,   79,   81,   82,   82,   82,  119,
-       81,  123,  120,  110,  121,  124,  122,   81,  125,  102,
-      105,  102,  100,  111,  131,  791,  112,  108,   81,  132,
-      156,  126,  133,   81,  157,  169,  110,  101,  142,  170,
-       81,   45,  143,  105,   45,   45,   45,  117,   45,   45,
-       45,  111,  115,  118,  129,   45,   45,  101,   45,   45,
-      792,  169,  144,  182,   45,  170,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   45,  138,  139,
-      182,   45,  140,  109,  147,   45,  112,  190,  141,  148,
-      149,  150,  169,   45,  151,  152,  187,   45,  183,   45,
-      116,  158,  145,  110,  146,  153,  109,  189,  154,  112,
-      190,  159,  160,  111,   88,   88,   88,  161,  172,  165,
-       83,   83,   83,  187,  166,  171,  110,  184,  162,  793,
-      171,   81,  163,   79,  189,   80,   80,   80,   87,  170,
-       87,  111,  178,   88,   88,   88,   81,   79,  164,   82,
-       82,   82,   99,  171,   81,   83,   83,   83,  174,   99,
-       81,   88,   88,   88,  181,  173,   81,  197,  186,   81,
-
-      178,  188,  178,  210,  202,  203,  794,  198,  207,  277,
-      208,  228,  219,   81,  204,  214,  211,   99,  215,   81,
-      181,   99,  216,  237,  238,   99,  186,  209,  795,  188,
-      194,  241,  229,   99,  242,  243,  277,   99,  266,   99,
-      177,  193,  193,  193,  247,  248,  249,  268,  193,  193,
-      193,  193,  193,  193,  220,  250,  254,  251,  267,  252,
-      255,  266,  253,  268,  256,  267,  266,  274,  276,  280,
-      268,  193,  193,  193,  193,  193,  193,  282,  284,  274,
-      359,  290,  370,  363,  267,  796,  271,  291,  359,  269,
-      274,  270,  280,  363,  418,  386,  276,  431,  367,  387,
-
-      282,  432,  286,  359,  419,  284,  285,  285,  285,  379,
-      370,  360,  363,  285,  285,  285,  285,  285,  285,  364,
-      365,  367,  374,  413,  414,  453,  380,  398,  366,  458,
-      454,  465,  399,  466,  458,  544,  285,  285,  285,  285,
-      285,  285,  373,  373,  373,  618,  797,  798,  801,  373,
-      373,  373,  373,  373,  373,  543,  525,  458,  465,  540,
-      466,  526,  467,  544,  545,  584,  593,  760,  618,  610,
-      617,  594,  373,  373,  373,  373,  373,  373,  400,  611,
-      678,  680,  543,  401,   45,   45,   45,  679,  681,  750,
-      760,   45,   45,   45,   45,   45,   45,  683,  617,  691,
-
-      727,  751,  585,  684,  728,  759,  785,  802,  595,  799,
-      803,  786,  804,  805,   45,   45,   45,   45,   45,   45,
-      800,  806,  807,  808,  809,  810,  811,  691,  812,  813,
-      814,  815,  759,  816,  817,  818,  819,  820,  821,  822,
-      823,  824,  826,  825,  827,  828,  829,  830,  831,  832,
-      833,  834,  835,  836,  837,  838,  839,  840,  841,  842,
-      843,  844,  787,  845,  846,  847,  848,  849,  850,  824,
-      825,  852,  854,  851,  855,  856,  857,  858,  859,  860,
-      861,  862,  863,  864,  865,  866,  867,  868,  869,  870,
-      871,  872,  873,  874,  875,  876,  877,  878,  879,  880,
-
-      881,  882,  883,  884,  885,  886,  887,  888,  889,  890,
-      891,  892,  893,  853,  894,  895,  896,  897,  898,  899,
-      900,  901,  902,  903,  904,  905,  906,  907,  886,  908,
-      909,  910,  911,  912,  887,  913,  914,  915,  916,  917,
-      918,  919,  920,  921,  922,  923,  924,  925,  926,  927,
-      928,  929,  931,  932,  933,  934,  935,  936,  937,  938,
-      939,  940,  941,  943,  944,  945,  946,  947,  948,  949,
-      950,  951,  952,  953,  954,  955,  956,  957,  958,  959,
-      960,  961,  962,  963,  964,  965,  967,  938,  968,  969,
-      970,  971,  972,  966,  973,  974,  975,  976,  977,  978,
-
-      979,  980,  930,  981,  942,  982,  983,  984,  985,  986,
-      987,  988,  989,  990,  991,  992,  993,  994,  995,  996,
-      997,  998,  999, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
-      984, 1007, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015,
-     1016, 1017, 1018, 1019, 1020, 1021, 1022, 1023, 1024, 1025,
-     1026, 1027, 1028, 1029, 1030, 1031, 1032, 1033, 1034, 1035,
-     1036, 1037, 1038, 1039, 1040, 1041, 1042, 1043, 1044, 1018,
-     1045, 1046, 1047, 1048, 1049, 1050, 1051, 1052, 1053, 1054,
-     1056, 1057, 1058, 1059, 1055, 1060, 1061, 1062, 1063, 1064,
-     1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072, 1073, 1074,
-
-     1075, 1076, 1077, 1050, 1078, 1079, 1080, 1081, 1082, 1083,
-     1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 1092, 1093,
-     1094, 1095, 1096, 1097, 1098, 1099, 1100, 1101, 1102, 1103,
-     1104, 1105, 1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113,
-     1114, 1115, 1116, 1117, 1118, 1119, 1120, 1121, 1122, 1123,
-     1124, 1125, 1126, 1127, 1128, 1129, 1130, 1131, 1132, 1133,
-     1134, 1135, 1136, 1137, 1138, 1139, 1140, 1141, 1142, 1143,
-     1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153,
-     1154, 1155, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163,
-     1164, 1165, 1166, 1167, 1168, 1169, 1170, 1171, 1172, 1173,
-
-     1174, 1175, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 1183,
-     1184,   12,   12,   12,   12,   12,   36,   36,   36,   36,
-       36,   78,  273,   78,   78,   78,   97,  362,   97,  457,
-       97,   99,   99,   99,   99,   99,  114,  114,  114,  114,
-      114,  168,   99,  168,  168,  168,  191,  191,  191,  788,
-      784,  783,  782,  781,  780,  779,  778,  777,  776,  775,
-      774,  773,  772,  771,  770,  769,  768,  767,  766,  765,
-      764,  763,  762,  761,  758,  757,  756,  755,  754,  753,
-      752,  749,  748,  747,  746,  745,  744,  743,  742,  741,
-      740,  739,  738,  737,  736,  735,  734,  733,  732,  731,
-
-      730,  729,  726,  725,  724,  723,  722,  721,  720,  719,
-      718,  717,  716,  715,  714,  713,  712,  711,  710,  709,
-      708,  707,  706,  705,  704,  703,  702,  701,  700,  699,
-      698,  697,  696,  695,  694,  693,  692,  690,  689,  688,
-      687,  686,  685,  682,  677,  676,  675,  674,  673,  672,
-      671,  670,  669,  668,  667,  666,  665,  664,  663,  662,
-      661,  660,  659,  658,  657,  656,  655,  654,  653,  652,
-      651,  650,  649,  648,  647,  646,  645,  644,  643,  642,
-      641,  640,  639,  638,  637,  636,  635,  634,  633,  632,
-      631,  630,  629,  628,  627,  626,  625,  624,  623,  622,
-
-      621,  620,  619,  616,  615,  614,  613,  612,  609,  608,
-      607,  606,  605,  604,  603,  602,  601,  600,  599,  598,
-      597,  596,  592,  591,  590,  589,  588,  587,  586,  583,
-      582,  581,  580,  579,  578,  577,  576,  575,  574,  573,
-      572,  571,  570,  569,  568,  567,  566,  565,  564,  563,
-      562,  561,  560,  559,  558,  557,  556,  555,  554,  553,
-      552,  551,  550,  549,  548,  547,  546,  542,  541,  540,
-      539,  538,  537,  536,  535,  534,  533,  532,  531,  530,
-      529,  528,  527,  524,  523,  522,  521,  520,  519,  518,
-      517,  516,  515,  514,  513,  512,  511,  510,  509,  508,
-
-      507,  506,  505,  504,  503,  502,  501,  500,  499,  498,
-      497,  496,  495,  494,  493,  492,  491,  490,  489,  488,
-      487,  486,  485,  484,  483,  482,  481,  480,  479,  478,
-      477,  476,  475,  474,  473,  472,  471,  470,  469,  468,
-      464,  463,  462,  461,  460,  459,  456,  455,  452,  451,
-      450,  449,  448,  447,  446,  445,  444,  443,  442,  441,
-      440,  439,  438,  437,  436,  435,  434,  433,  430,  429,
-      426,  425,  424,  423,  422,  421,  420,  417,  416,  415,
-      412,  411,  410,  409,  408,  407,  406,  405,  404,  403,
-      402,  397,  396,  395,  394,  393,  392,  391,  390,  389,
-
-      388,  385,  384,  383,  382,  381,  378,  377,  376,  375,
-      372,  371,  369,  368,  361,  358,  357,  356,  355,  354,
-      353,  352,  351,  350,  349,  348,  347,  346,  345,  344,
-      343,  340,  339,  338,  337,  336,  335,  334,  333,  332,
-      331,  330,  329,  328,  327,  326,  325,  324,  323,  322,
-      321,  320,  319,  318,  317,  316,  315,  314,  313,  312,
-      311,  310,  309,  308,  307,  306,  305,  304,  303,  302,
-      301,  300,  299,  298,  297,  296,  295,  294,  293,  292,
-      289,  288,  287,  192,  283,  281,  279,  278,  275,  272,
-      265,  264,  263,  262,  261,  260,  259,  258,  257,  246,
-
-      245,  244,  240,  239,  236,  235,  234,  233,  232,  231,
-      230,  227,  226,  225,  224,  223,  222,  221,  218,  217,
-      213,  212,  206,  205,  201,  200,  199,  196,  195,  192,
-      185,  180,  179,  176,  175,  167,  155,  137,  130,  104,
-      103,   43,   98,   96,   95,   86,   43, 1185,   11, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243,   11,   12,   13,   14,   13,   12,   15,   16,   12,
+       17,   18,   19,   20,   21,   22,   22,   22,   23,   24,
+       12,   12,   12,   12,   12,   12,   25,   26,   12,   12,
+
+       12,   27,   12,   12,   12,   12,   28,   12,   12,   12,
+       12,   29,   12,   30,   12,   12,   12,   12,   12,   25,
+       31,   12,   12,   12,   12,   12,   12,   32,   12,   12,
+       12,   12,   12,   33,   12,   12,   12,   12,   12,   12,
+       34,   35,   11,   53,   36,   37,   38,   37,   36,   36,
+       36,   39,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+
+       36,   36,   36,   36,   36,   36,   36,   36,   36,   36,
+       36,   36,   36,   36,   11,   95,   40,   41,   42,   41,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   43,   40,   40,
+       40,   40,   40,   40,   40,   40,   40,   40,   40,   40,
+       40,   40,   40,   40,   40,   40,   11,  101,   44,   45,
+       46,   45,   44,   47,   44,   44,   44,   44,   44,   44,
+
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   44,   44,
+       44,   44,   44,   44,   44,   44,   44,   44,   11,  102,
+       48,   49,   50,   49,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   51,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       48,   48,   48,   48,   48,   48,   48,   48,   48,   48,
+       11, 1243,   11,  103,   11,   52,   11,   52,   54,   54,
+       54,   55,   55,   56,   55,   55,   55,   55,   55,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   57,   55,
+       55,   58,   59,   60,   55,   61,   62,   63,   55,   55,
+       55,   55,   64,   65,   55,   66,   55,   55,   67,   55,
+       55,   68,   55,   69,   70,   71,   72,   73,   74,   75,
+       76,   77,   78,   79,   80,   81,   82,   83,   84,   85,
+
+       86,   87,   66,   55,   55,   55,   55,   55,   88,   88,
+       11,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   88,   88,
+       88,   88,   88,   88,   88,   88,   88,   88,   89,   98,
+       90,   90,   90,   92,   92,   92, 1243,   93,   89,   89,
+       89,   91,   94,   96,  100,   96,   99,   11,   97,   97,
+
+       97,   11,   98,   11,   11,   11,  106,   11,  104,  109,
+      104,  105,  108,  107,   91,  107,   11,  110,   11,  110,
+      111,  100,  114,   99,  112,  112,   11,  112,  112,  115,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  112,  112,  112,  112,  112,  112,
+      112,  112,  112,  112,  113,   11,  113,   54,   54,  116,
+
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,  117,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   55,   11,  119,   55,   55,   55,
+      120,   55,   55,   55,  133,  146,  147,  154,   55,   55,
+      134,   55,  172,  122,  118,  123,  184,   55,  121,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,  118,
+      122,  121,  125,  124,  126,  135,  128,  129,  173,  140,
+      151,   11,  174,  141,  127,  136,  142,   11,  137,  152,
+      138,  153,  139,  144,   11,  125,   11,  126,  143,  128,
+      148,  129,  162,  145,  163,  149,   11,   11,  150,   11,
+       11,  127,  130,  130,  130,  130,  130,  131,  130,  130,
+      130,  130,  130,  130,  188,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,  130,  130,  130,  130,  130,  130,  130,  130,
+      130,  130,   55,  130,  130,  130,  189,  130,  130,  130,
+
+      190,  130,  130,  130,  130,  130,  130,  159,  130,  130,
+      130,  160,  130,   11,  132,  130,  130,  130,  130,  130,
+      130,  130,  155,  156,  187,  167,  157,  164,  168,  169,
+      161,  158,  165,  166,  175,  179,   11,  191,  170,  180,
+      182,  171,   11,  176,  177,  183, 1243,   11, 1243,  178,
+       11,  187,   94,   94,  181,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   11,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,  185,  186,   11,  192,   11,   11,   11,   11,
+      194,   54,  195,  197,  198,  201,  196,  202,   54,  199,
+      206,  203,  204,   11,  209,  205,  216,  185,  186, 1243,
+     1243, 1243,  215,  211,  207,  210,  233,  194,  197,  217,
+      198,  130,  212,  206,  202,  228,   54,  203,  200,  204,
+       54,  205,  222,  229,   54,  234,  235,  218,  219,  238,
+      221,   54,  213,  226,  237,   54,  220,   54,  193,  130,
+      239,  214,  241,  130,  223,  227,  224,  130,  240,  243,
+
+      130,  130,  130,  242,  130,  130,  246,  244,  130,  250,
+      130,  130,  225,  208,  208,  208,  247,  248,  236,  249,
+      208,  208,  208,  208,  208,  208,  230,  245,  251,  231,
+      252,  253,  254,  232,  255,  256,  257,  260,  261,  258,
+      259,  262,  275,  208,  208,  208,  208,  208,  208,  263,
+      264,  265,  271,  274,  276,  278,  272,  280,  277,  266,
+      273,  267,  279,  268,  281,  282,  269,  283,  270,  285,
+      284,  286,  287,  288,  289,   11,  290,  290,  290,  291,
+      292,   11,   11,  290,  290,  290,  290,  290,  290,  293,
+      295,  294,  285,  296,  283,  284,  297,  298,  299,  300,
+
+      301,   11,  291,  303,  304,  305,  290,  290,  290,  290,
+      290,  290,  306,  307,  311,  310,  293,  294,  312,  297,
+      313,  299,  302,  302,  302,  315,  301,  316,  320,  302,
+      302,  302,  302,  302,  302,  308,  317,  314,  322,  318,
+      319,  309,  321,  324,  325,  326,  323,   11,  328,  327,
+      329,  332,  302,  302,  302,  302,  302,  302,  330,  331,
+      333,  334,  335,  337,  336,  338,  339,  340,  342,  341,
+      343,  344,  345,  347,  352,  346,  351,  348,  350,  349,
+      354,  355,  356,  357,  358,  353,  361,  359,  362,  363,
+      360,  364,  366,  375,  368,  365,  370,  369,  378,  376,
+
+      372,  367,   11,   11,  371,  373,  374,   11,  377,  379,
+       11,  382,  386,  383,  384,  380,   11,  387,  381,  381,
+      381,  378,  385,  388,   11,  381,  381,  381,  381,  381,
+      381,  390,  389,   11,  391,  386,  393,  394,  395,  382,
+      396,  397,  398,   11,  399,  401,  409,  402,  381,  381,
+      381,  381,  381,  381,  392,  392,  392,  404,  403,  389,
+      400,  392,  392,  392,  392,  392,  392,  405,  406,  408,
+      410,  414,  407,  411,  418,  413,  416,  412,  415,  419,
+      417,  425,  422,  423,  392,  392,  392,  392,  392,  392,
+      424,  426,  430,  428,  429,  427,  437,  431,  447,  432,
+
+      438,  436,  435,  449,  444,  433,  434,  454,  450,  439,
+      440,  443,  445,  446,  442,  441,  453,  451,  457,  455,
+      461,  452,  456,  463,  420,  464,  459,  458,  465,  421,
+      467,  462,  466,  468,  469,  460,  470,  471,  472,  473,
+      474,  476,   11,   11,  479,  475,  477,  478,  478,  478,
+      480,  481,  482,  448,  478,  478,  478,  478,  478,  478,
+      483,   11,  484,  485,   11,  486,  489,  487,  488,  490,
+      491,  479,   11,  492,  493,  494,  495,  478,  478,  478,
+      478,  478,  478,   11,  498,  497,  499,   55,   55,   55,
+      496,  486,   11,  487,   55,   55,   55,   55,   55,   55,
+
+      501,  505,  502,  500,  506,  503,  504,  507,  508,  509,
+       11,  510,  511,  512,  513,  516,  514,   55,   55,   55,
+       55,   55,   55,  515,  517,  518,  519,  521,  524,  527,
+      520,   11,  525,  523,  526,  522,  528,  533,  529,  532,
+       11,  530,  537,  534,  531,  535,   11,  544,  541,  542,
+      546,  536,  543,  545,  538,  539,  547,  540,  549,  550,
+      552,  548,  557,  555,   11,  553,  554,   11,  551,  556,
+       11,  558,  559,   11,  560,  562,  561,   54,   54,   54,
+      563,   11,   11,   11,   54,   54,   54,   54,   54,   54,
+      564,  565,   11,  566,  567,  568,   11,  570,  569,  573,
+
+      575,  571,  576,  574,  572,  578,  577,   54,   54,   54,
+       54,   54,   54,  579,  580,  582,  581,  583,  584,  566,
+      585,  567,  588,  587,  589,  591,   11,  590,  586,  593,
+       11,  594,  597,  607,  596,  608,   11,  592,  617,  595,
+       11,  603,  602,  618,  623,  625,  604,  610,  631,  632,
+      634,  598,  600,   11,   11,  615,  601,  599,  606,  605,
+      613,  621,  629,   11,  611,  612,  614,  622,  616,  624,
+      639,  626,  609,  627,  633,  628,  620,  635,  630,  637,
+      619,  638,  640,  641,  642,  643,  647,  636,  657,  646,
+      649,  650,  652,  644,  645,  653,  654,  656,  660,  651,
+
+      658,  655,  659,  661,  662,  663,  668,  664,  643,  676,
+      665,  642,  667,  666,  669,  671,  672,  670,  673,  677,
+      674,  675,  679,  681,   11,  690,   11,  648,  680,  683,
+      684,  699,  678,  682,  703,  686,  687,  688,  685,  692,
+       11,  713,  717,  689,   11,  718,  691,  693,  695,  719,
+      694,  696,  714,  702,  727,  743,  736,  728,  706,  698,
+      700,  704,  697,  701,  707,  705,  708,  711,  715,  726,
+      716,  710,  709,  712,  749,  721,  719,  720,  723,  722,
+      725,  734,   11,   11,  724,  730,  729,  737,  732,  733,
+      731,  742,  738,  735,  739,  740,  741,   11,  746,  754,
+
+      747,  744,  752,  745,  755,  753,  757,  760,  762,  748,
+      758,  763,   11,  765,  751,  750,  756,  766,  761,  759,
+      767,  768,  764,  770,  771,  769,  772,  776,  775,  774,
+      777,  778,  779,  780,  773,  781,  783,  784,  785,   11,
+      787,  789,  786,   11,  791,  790,  782,  788,  793,  792,
+      794,  795,  797,  799,  796,  802,  803,  805,  798,  811,
+       11,  800,   11,  807,  801,  804,  809,  791,  812,  813,
+      815,  790,  818,  806,  808,  810,  822,  819,  824,  825,
+      814,  828,   11,  816,  821,  817,  826,  830,   11,  836,
+      827,  823,  832,  837,   11,  829,  835,  838,  831,   11,
+
+      839,  834,  833,  841,  840,  844,  848,  850,  845,  851,
+      842,  843,  846,   11,  858,  856,  847,  857,  849,  852,
+      853,  854,  859,  861,  855,  860,  864,  820,  863,  865,
+      866,  862,  867,  868,  870,   11,  869,  872,  873,  874,
+      876,  858,  877,  871,  878,  875,  880,  879,  859,  882,
+      883,  881,  884,   11,  886,  888,  890,  885,  891,  887,
+      895,  898,  897,  894,  899,  902,  896,  892,  893,  903,
+      900,  905,  906,  907,  904,   11,  901,  908,  909,  910,
+      914,  915,  912,   11,  911,  913,   11,  916,  918,  919,
+      920,  923,  924,   11,  917,  927,   11,  889,  922,   11,
+
+      921,  925,   11,  928,  926,  930,  929,  931,  932,  935,
+      936,   11,  937,  933,  923,   11,  943,  944,  934,  924,
+      939,  945,  946,   11,  948,  941,  950,  952,  938,  940,
+       11,  942,  949,  951,  954,   11,  953,  956,  947,   11,
+      957,  955,   11,  958,   11,  962,  964,  965,  959,  961,
+      960,  963,  966,  970,  967,  971,  969,  972,  973,  974,
+      975,  976,  978,  980,  979,  977,  985,  982,  984,  983,
+      986,  988,  989,   11,  990,  987,  993,  996,  999,   11,
+     1001,  991,  992,  998,  994,  995, 1003, 1007,   11, 1013,
+     1014, 1016,  977,   11,   11,  997, 1009, 1000, 1020, 1002,
+
+     1005,   11,   11, 1011,  968,  981, 1008,   11, 1006, 1017,
+     1023, 1025,   11, 1004, 1018, 1019, 1010, 1022, 1012, 1015,
+       11, 1024, 1033, 1026, 1021, 1027, 1029,   11, 1035, 1030,
+     1028, 1039, 1031, 1032, 1025,   11, 1040, 1034, 1037, 1036,
+       11,   11, 1042, 1038, 1041, 1043, 1045, 1044, 1046,   11,
+       11, 1047,   11, 1054,   11,   11, 1055, 1048, 1052,   11,
+     1049, 1059, 1050, 1053, 1061,    0, 1051, 1058, 1062, 1060,
+     1057, 1063, 1066, 1056, 1067,   11, 1068, 1065, 1069,   11,
+     1064, 1071, 1073, 1072, 1074, 1070, 1075, 1077, 1076, 1079,
+     1061, 1080, 1078, 1082, 1083, 1081, 1087, 1088, 1089, 1084,
+
+     1085, 1086, 1090, 1091, 1092, 1094, 1095,   11, 1097, 1096,
+     1093, 1098,   11,   11,   11, 1100, 1103, 1106, 1099,   11,
+     1101, 1102,   11, 1107,   11,   11, 1105, 1111, 1104, 1108,
+     1109, 1116, 1110, 1095, 1112, 1120, 1115,   11, 1113, 1121,
+       11, 1114, 1118, 1119,   11, 1128,   11, 1130, 1133, 1117,
+       11, 1141, 1142,   11, 1124, 1122, 1131, 1125, 1123, 1143,
+     1129, 1126, 1146, 1132, 1152, 1140, 1127,   11, 1157,   11,
+       11,   11,    0, 1134, 1144, 1136,    0, 1147, 1138, 1135,
+     1145, 1139, 1171, 1149, 1137, 1173, 1174, 1148, 1175, 1150,
+     1151, 1163, 1180, 1153, 1183, 1155, 1186, 1156,   11,   11,
+
+       11, 1154, 1191, 1162,   11,   11, 1167, 1194,   11,   11,
+     1160, 1169, 1170,   11, 1158, 1172, 1159,    0, 1161, 1165,
+     1166, 1168, 1177,    0, 1176, 1178, 1181, 1164, 1206, 1182,
+     1184, 1185, 1187, 1188, 1211, 1217, 1219,   11, 1193,   11,
+     1225,   11, 1179,    0, 1190,   11, 1192, 1189, 1226, 1227,
+       11, 1198,   11, 1195, 1231, 1196,   11, 1197, 1200, 1201,
+     1202, 1203, 1204, 1208, 1199, 1234, 1239, 1212,   11, 1242,
+       11, 1209, 1205, 1214, 1218, 1216, 1207, 1213, 1221, 1210,
+     1223, 1222, 1224, 1233, 1229, 1220,    0, 1215, 1228, 1232,
+        0,    0, 1230,    0,    0,    0,    0,    0,    0, 1238,
+
+        0, 1241,    0,    0, 1235,    0, 1240,    0, 1236,    0,
+     1237,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0
     } ;
 
-static const flex_int16_t yy_chk[1621] =
+static const flex_int16_t yy_chk[2442] =
     {   0,
-        0,    1,    1,    1,    0,    1,    1,    0,    1,    1,
-        1,    1,    1,    1,    1,    1,    1,    1,   21,    0,
-        3,    3,    3,   21,    1,    1,    3,    0,    0,    1,
-        4,    4,    4,   13,    1,   13,    4,   27,   28,    1,
-       56,    1,    5,    5,    5,   26,   32,    1,    1,   33,
-        6,    6,    6,    7,    7,    7,    1,    7,  720,    8,
-        8,    8,    1,    8,   56,   27,   28,  333,   26,    1,
-        1,    2,    2,    2,   32,    2,    2,   33,    2,    2,
-        2,    2,    2,    2,    2,    2,    2,    2,    9,    9,
-        9,   51,    5,   31,    2,    2,   10,   10,   10,    2,
-
-        6,   20,   20,   20,    2,   37,    9,   37,   42,    2,
-       42,    2,   20,   50,   10,   53,   31,    2,    2,   51,
-       61,   65,   25,  333,   25,  721,    2,   25,   25,   25,
-       61,   65,    2,   65,  249,   20,   50,  249,   53,    2,
-        2,   15,   15,   15,   15,   15,   15,   15,   15,   15,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243, 1243,
+     1243,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    1,    1,    1,    1,    1,    1,    1,    1,
+        1,    1,    2,   14,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+
+        3,    3,    3,    3,    3,    3,    3,    3,    3,    3,
+        3,    3,    3,    3,    4,   24,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    5,    5,    5,    5,
+        5,    5,    5,    5,    5,    5,    6,   31,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    7,    7,
+        7,    7,    7,    7,    7,    7,    7,    7,    8,   32,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+        9,    9,    9,    9,    9,    9,    9,    9,    9,    9,
+       10,   11,   12,   33,   18,   13,   22,   13,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-
        15,   15,   15,   15,   15,   15,   15,   15,   15,   15,
-       15,   15,   17,   47,   17,   17,   17,   19,   52,   19,
-       19,   19,   44,   55,   22,   17,   22,   22,   22,   59,
-       19,   60,   59,   54,   59,   60,   59,   22,   60,   47,
-       62,   58,   99,   54,   64,  722,   55,   52,   17,   64,
-       73,   60,   64,   19,   73,   89,   54,   44,   68,   90,
-       22,   45,   68,   62,   45,   45,   45,   58,   45,   45,
-       45,   54,   57,   58,   62,   45,   45,   99,   45,   57,
-      723,   89,   68,  106,   45,   90,   45,   45,   45,   45,
-       45,   45,   45,   45,   45,   45,   45,   45,   45,   45,
-
-       45,   45,   45,   45,   45,   45,   45,   57,   67,   67,
-      106,   57,   67,   69,   70,   57,   76,  113,   67,   70,
-       70,   71,   92,   57,   71,   71,  110,   57,  107,   57,
-       57,   74,   69,   75,   69,   71,   69,  112,   71,   76,
-      113,   74,   74,   75,   87,   87,   87,   74,   92,   76,
-       79,   79,   79,  110,   76,   91,   75,  107,   75,  724,
-       94,   79,   75,   80,  112,   80,   80,   80,   81,   93,
-       81,   75,  102,   81,   81,   81,   80,   82,   75,   82,
-       82,   82,  101,   91,   79,   83,   83,   83,   94,  101,
-       82,   88,   88,   88,  105,   93,   83,  120,  109,   80,
-
-      102,  111,  117,  128,  124,  124,  725,  120,  127,  182,
-      127,  142,  134,   82,  124,  131,  128,  101,  131,   83,
-      105,  101,  131,  150,  150,  101,  109,  127,  726,  111,
-      117,  153,  142,  101,  153,  153,  182,  101,  169,  101,
-      101,  116,  116,  116,  157,  157,  157,  171,  116,  116,
-      116,  116,  116,  116,  134,  157,  158,  157,  170,  157,
-      158,  172,  157,  174,  158,  173,  169,  178,  181,  186,
-      171,  116,  116,  116,  116,  116,  116,  188,  190,  194,
-      266,  198,  280,  274,  170,  727,  174,  198,  269,  172,
-      178,  173,  186,  286,  325,  298,  181,  336,  276,  298,
-
-      188,  336,  194,  266,  325,  190,  193,  193,  193,  291,
-      280,  269,  274,  193,  193,  193,  193,  193,  193,  275,
-      275,  276,  286,  321,  321,  357,  291,  309,  275,  363,
-      357,  372,  309,  372,  374,  466,  193,  193,  193,  193,
-      193,  193,  285,  285,  285,  544,  728,  729,  731,  285,
-      285,  285,  285,  285,  285,  465,  439,  363,  372,  467,
-      372,  439,  374,  466,  467,  509,  518,  691,  544,  535,
-      543,  518,  285,  285,  285,  285,  285,  285,  309,  535,
-      606,  607,  465,  309,  373,  373,  373,  606,  607,  680,
-      691,  373,  373,  373,  373,  373,  373,  609,  543,  618,
-
-      657,  680,  509,  609,  657,  690,  717,  734,  518,  730,
-      735,  717,  736,  738,  373,  373,  373,  373,  373,  373,
-      730,  739,  741,  742,  743,  744,  745,  618,  746,  747,
-      748,  749,  690,  750,  751,  752,  754,  755,  756,  757,
-      758,  759,  761,  760,  762,  763,  764,  765,  766,  767,
-      768,  769,  771,  772,  773,  774,  775,  776,  777,  778,
-      779,  780,  717,  781,  782,  783,  784,  786,  787,  759,
-      760,  788,  789,  787,  790,  791,  792,  793,  794,  795,
-      796,  797,  798,  799,  800,  801,  802,  803,  804,  805,
-      806,  807,  808,  809,  810,  811,  812,  813,  815,  818,
-
-      819,  820,  821,  822,  823,  824,  825,  826,  827,  828,
-      829,  830,  833,  788,  834,  835,  836,  837,  838,  839,
-      840,  841,  842,  843,  844,  845,  846,  849,  824,  851,
-      853,  854,  855,  856,  825,  857,  858,  860,  861,  863,
-      864,  865,  868,  870,  871,  872,  873,  874,  875,  876,
-      877,  878,  879,  880,  881,  882,  883,  884,  885,  886,
-      887,  888,  889,  890,  891,  892,  893,  894,  895,  896,
-      898,  899,  900,  901,  902,  903,  904,  905,  906,  907,
-      908,  909,  910,  911,  913,  914,  915,  886,  917,  918,
-      919,  920,  921,  914,  922,  923,  924,  925,  926,  928,
-
-      929,  930,  878,  935,  889,  936,  937,  938,  940,  942,
-      943,  944,  945,  946,  947,  949,  950,  951,  952,  953,
-      954,  955,  956,  957,  958,  960,  962,  964,  965,  966,
-      938,  968,  969,  970,  971,  972,  975,  977,  978,  979,
-      981,  983,  984,  985,  986,  987,  988,  989,  990,  992,
-      994,  995,  996,  997,  998,  999, 1000, 1001, 1002, 1003,
-     1004, 1005, 1006, 1007, 1008, 1009, 1010, 1011, 1012,  984,
-     1013, 1014, 1015, 1016, 1017, 1018, 1019, 1021, 1024, 1026,
-     1027, 1028, 1029, 1030, 1026, 1031, 1032, 1034, 1037, 1038,
-     1040, 1041, 1042, 1043, 1044, 1045, 1046, 1047, 1048, 1050,
-
-     1051, 1053, 1055, 1018, 1056, 1057, 1058, 1059, 1061, 1062,
-     1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072,
-     1073, 1075, 1076, 1077, 1078, 1079, 1081, 1082, 1083, 1084,
-     1086, 1087, 1088, 1089, 1090, 1091, 1092, 1094, 1095, 1096,
-     1097, 1098, 1099, 1100, 1101, 1103, 1104, 1105, 1106, 1108,
-     1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 1117, 1118,
-     1120, 1123, 1124, 1125, 1126, 1128, 1130, 1131, 1133, 1134,
-     1135, 1136, 1138, 1139, 1140, 1141, 1142, 1143, 1144, 1145,
-     1146, 1147, 1148, 1149, 1150, 1151, 1152, 1153, 1154, 1155,
-     1156, 1157, 1158, 1160, 1162, 1163, 1164, 1165, 1166, 1170,
-
-     1171, 1172, 1174, 1175, 1176, 1177, 1178, 1179, 1180, 1182,
-     1183, 1186, 1186, 1186, 1186, 1186, 1187, 1187, 1187, 1187,
-     1187, 1188, 1194, 1188, 1188, 1188, 1189, 1195, 1189, 1196,
-     1189, 1190, 1190, 1190, 1190, 1190, 1191, 1191, 1191, 1191,
-     1191, 1192, 1197, 1192, 1192, 1192, 1193, 1193, 1193,  718,
-      716,  715,  714,  712,  711,  710,  709,  708,  707,  706,
-      705,  704,  703,  702,  701,  700,  699,  698,  697,  696,
-      695,  694,  693,  692,  688,  687,  686,  684,  683,  682,
-      681,  679,  678,  677,  676,  675,  674,  673,  672,  671,
-      670,  669,  668,  667,  666,  665,  664,  662,  661,  660,
-
-      659,  658,  656,  655,  653,  652,  651,  648,  647,  646,
-      645,  644,  643,  642,  641,  640,  639,  638,  637,  636,
-      635,  634,  633,  632,  631,  630,  629,  628,  627,  626,
-      625,  624,  623,  622,  621,  620,  619,  617,  615,  614,
-      613,  612,  611,  608,  605,  604,  603,  602,  601,  600,
-      599,  598,  597,  596,  595,  594,  592,  591,  590,  589,
-      588,  587,  586,  585,  583,  582,  581,  580,  579,  578,
-      577,  576,  575,  574,  573,  572,  571,  570,  569,  568,
-      567,  566,  565,  564,  563,  562,  561,  560,  559,  558,
-      557,  556,  555,  554,  553,  552,  551,  550,  549,  548,
-
-      547,  546,  545,  542,  541,  538,  537,  536,  533,  532,
-      531,  530,  529,  528,  527,  526,  524,  523,  522,  521,
-      520,  519,  517,  516,  514,  513,  512,  511,  510,  508,
-      507,  506,  504,  503,  502,  501,  500,  499,  498,  497,
-      496,  495,  494,  493,  492,  490,  489,  488,  487,  486,
-      485,  484,  483,  482,  481,  480,  479,  478,  477,  476,
-      475,  474,  473,  472,  471,  470,  469,  463,  461,  458,
-      456,  455,  454,  452,  448,  447,  446,  445,  444,  443,
-      442,  441,  440,  438,  437,  436,  435,  434,  433,  432,
-      431,  430,  428,  426,  425,  424,  423,  422,  421,  420,
-
-      419,  418,  416,  415,  414,  413,  412,  411,  410,  409,
-      408,  407,  406,  405,  404,  403,  402,  401,  400,  399,
-      397,  396,  395,  394,  393,  392,  391,  390,  389,  387,
-      386,  385,  384,  383,  381,  380,  379,  378,  376,  375,
-      370,  369,  367,  366,  365,  364,  361,  358,  356,  355,
-      354,  353,  352,  351,  350,  349,  348,  347,  346,  345,
-      344,  343,  342,  341,  340,  339,  338,  337,  335,  334,
-      332,  331,  330,  329,  328,  327,  326,  324,  323,  322,
-      320,  319,  318,  317,  316,  315,  314,  313,  312,  311,
-      310,  308,  307,  306,  305,  304,  303,  302,  301,  300,
-
-      299,  297,  296,  295,  294,  293,  290,  289,  288,  287,
-      284,  282,  279,  277,  272,  265,  264,  263,  262,  261,
-      260,  259,  258,  257,  256,  255,  254,  253,  252,  251,
-      250,  248,  247,  246,  245,  244,  243,  242,  241,  240,
-      239,  238,  237,  236,  235,  234,  233,  232,  231,  230,
-      229,  228,  227,  226,  225,  224,  223,  222,  221,  220,
-      218,  217,  216,  215,  214,  213,  212,  211,  210,  209,
-      208,  207,  206,  205,  204,  203,  202,  201,  200,  199,
-      197,  196,  195,  191,  189,  187,  185,  184,  179,  175,
-      167,  166,  165,  164,  163,  162,  161,  160,  159,  156,
-
-      155,  154,  152,  151,  149,  148,  147,  146,  145,  144,
-      143,  141,  140,  139,  138,  137,  136,  135,  133,  132,
-      130,  129,  126,  125,  123,  122,  121,  119,  118,  114,
-      108,  104,  103,   97,   96,   77,   72,   66,   63,   49,
-       48,   43,   41,   39,   38,   24,   14,   11, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185,
-     1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185, 1185
+
+       15,   15,   15,   15,   15,   15,   15,   15,   16,   16,
+       23,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   16,   16,
+       16,   16,   16,   16,   16,   16,   16,   16,   17,   26,
+       17,   17,   17,   19,   19,   19,   20,   21,   20,   20,
+       20,   17,   21,   25,   28,   25,   27,   29,   25,   25,
+
+       25,   30,   26,   34,   35,   36,   39,   40,   37,   43,
+       37,   38,   42,   41,   17,   41,   44,   45,   48,   45,
+       46,   28,   50,   27,   47,   47,   52,   47,   47,   51,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   47,   47,   47,   47,   47,   47,
+       47,   47,   47,   47,   49,   53,   49,   54,   54,   54,
+
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   54,   54,   54,   54,   54,   54,
+       54,   54,   54,   54,   55,   56,   58,   55,   55,   55,
+       59,   55,   55,   55,   68,   72,   73,   76,   55,   55,
+       68,   55,   82,   61,   57,   62,   87,   55,   60,   55,
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   55,
+
+       55,   55,   55,   55,   55,   55,   55,   55,   55,   57,
+       61,   60,   63,   62,   64,   69,   65,   66,   83,   70,
+       75,   88,   83,   70,   64,   69,   70,   89,   69,   75,
+       69,   75,   69,   71,   90,   63,   91,   64,   70,   65,
+       74,   66,   79,   71,   79,   74,   92,   93,   74,   95,
+       97,   64,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,  101,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,   67,   67,   67,   67,
+       67,   67,   67,   67,   67,   67,  102,   67,   67,   67,
+
+      103,   67,   67,   67,   67,   67,   67,   78,   67,   67,
+       67,   78,   67,  104,   67,   67,   67,   67,   67,   67,
+       67,   67,   77,   77,  100,   81,   77,   80,   81,   81,
+       78,   77,   80,   80,   84,   85,  105,  109,   81,   85,
+       86,   81,  106,   84,   84,   86,   96,  107,   96,   84,
+      108,  100,   94,   94,   85,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,  110,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   94,   94,   94,   94,   94,   94,   94,   94,
+       94,   94,   98,   99,  111,  112,  113,  114,  115,  116,
+      118,  117,  119,  121,  122,  124,  120,  125,  117,  123,
+      129,  126,  127,  131,  133,  128,  139,   98,   99,  130,
+      130,  130,  138,  135,  130,  134,  149,  118,  121,  140,
+      122,  130,  136,  129,  125,  146,  117,  126,  123,  127,
+      117,  128,  143,  147,  117,  150,  151,  141,  141,  153,
+      142,  117,  137,  145,  152,  117,  141,  117,  117,  130,
+      154,  137,  156,  130,  144,  145,  144,  130,  155,  158,
+
+      132,  132,  132,  157,  130,  132,  160,  159,  130,  164,
+      130,  130,  144,  132,  132,  132,  161,  162,  151,  163,
+      132,  132,  132,  132,  132,  132,  148,  159,  165,  148,
+      166,  167,  167,  148,  168,  169,  170,  171,  172,  170,
+      170,  173,  177,  132,  132,  132,  132,  132,  132,  174,
+      174,  174,  175,  176,  178,  180,  175,  182,  179,  174,
+      175,  174,  181,  174,  183,  184,  174,  185,  174,  187,
+      186,  188,  189,  190,  191,  192,  193,  193,  193,  194,
+      195,  196,  199,  193,  193,  193,  193,  193,  193,  197,
+      200,  198,  187,  201,  185,  186,  202,  203,  204,  205,
+
+      206,  207,  194,  209,  210,  211,  193,  193,  193,  193,
+      193,  193,  212,  213,  216,  215,  197,  198,  217,  202,
+      218,  204,  208,  208,  208,  220,  206,  221,  225,  208,
+      208,  208,  208,  208,  208,  214,  222,  219,  227,  223,
+      224,  214,  226,  229,  230,  231,  228,  235,  233,  232,
+      234,  238,  208,  208,  208,  208,  208,  208,  236,  237,
+      239,  240,  241,  243,  242,  244,  245,  246,  248,  247,
+      249,  250,  251,  253,  258,  252,  257,  254,  256,  255,
+      260,  261,  262,  263,  264,  259,  266,  265,  267,  268,
+      265,  269,  271,  280,  273,  270,  275,  274,  283,  281,
+
+      277,  272,  284,  285,  276,  278,  279,  287,  282,  286,
+      288,  291,  293,  292,  292,  289,  295,  294,  290,  290,
+      290,  283,  292,  296,  298,  290,  290,  290,  290,  290,
+      290,  299,  297,  300,  301,  293,  303,  304,  305,  291,
+      306,  307,  308,  310,  309,  311,  318,  312,  290,  290,
+      290,  290,  290,  290,  302,  302,  302,  314,  313,  297,
+      309,  302,  302,  302,  302,  302,  302,  315,  316,  317,
+      319,  323,  316,  320,  327,  322,  325,  321,  324,  327,
+      326,  331,  328,  329,  302,  302,  302,  302,  302,  302,
+      330,  332,  336,  334,  335,  333,  342,  337,  351,  338,
+
+      343,  341,  340,  352,  348,  339,  339,  356,  353,  343,
+      344,  347,  349,  350,  346,  345,  355,  354,  359,  357,
+      363,  354,  358,  365,  327,  366,  361,  360,  367,  327,
+      369,  364,  368,  370,  371,  362,  372,  373,  374,  375,
+      376,  377,  378,  379,  382,  376,  380,  381,  381,  381,
+      383,  384,  385,  351,  381,  381,  381,  381,  381,  381,
+      386,  387,  388,  389,  390,  391,  394,  391,  393,  395,
+      396,  382,  397,  398,  399,  400,  401,  381,  381,  381,
+      381,  381,  381,  402,  405,  404,  406,  392,  392,  392,
+      403,  391,  408,  391,  392,  392,  392,  392,  392,  392,
+
+      409,  413,  410,  407,  414,  411,  412,  415,  416,  417,
+      418,  419,  420,  421,  422,  425,  423,  392,  392,  392,
+      392,  392,  392,  424,  426,  427,  428,  430,  433,  436,
+      429,  437,  434,  432,  435,  431,  438,  443,  439,  442,
+      447,  440,  448,  444,  441,  445,  449,  456,  453,  454,
+      458,  446,  455,  457,  450,  451,  459,  452,  460,  461,
+      463,  459,  468,  466,  470,  464,  465,  471,  462,  467,
+      472,  469,  473,  474,  475,  477,  476,  478,  478,  478,
+      479,  480,  481,  483,  478,  478,  478,  478,  478,  478,
+      482,  484,  485,  486,  487,  488,  489,  491,  490,  494,
+
+      496,  492,  497,  495,  493,  499,  498,  478,  478,  478,
+      478,  478,  478,  500,  501,  503,  502,  504,  505,  486,
+      506,  487,  509,  508,  510,  512,  513,  511,  507,  515,
+      527,  516,  519,  530,  518,  531,  537,  514,  540,  517,
+      547,  525,  524,  540,  544,  546,  526,  532,  553,  554,
+      556,  520,  522,  557,  562,  538,  523,  521,  529,  528,
+      535,  542,  551,  563,  533,  534,  536,  543,  539,  545,
+      561,  548,  531,  549,  555,  550,  541,  558,  552,  559,
+      540,  560,  564,  565,  566,  567,  571,  558,  580,  570,
+      572,  573,  575,  568,  569,  576,  577,  579,  583,  574,
+
+      581,  578,  582,  584,  585,  586,  591,  587,  567,  599,
+      588,  566,  590,  589,  592,  594,  595,  593,  596,  600,
+      597,  598,  602,  604,  608,  614,  617,  571,  603,  606,
+      607,  624,  601,  605,  628,  610,  611,  612,  609,  616,
+      635,  636,  640,  613,  641,  642,  615,  618,  620,  643,
+      619,  621,  637,  627,  651,  667,  660,  652,  631,  623,
+      625,  629,  622,  626,  631,  630,  632,  634,  638,  650,
+      639,  633,  632,  634,  673,  645,  643,  644,  647,  646,
+      649,  658,  676,  677,  648,  654,  653,  661,  656,  657,
+      655,  666,  662,  659,  663,  664,  665,  681,  670,  680,
+
+      671,  668,  678,  669,  682,  679,  684,  686,  688,  672,
+      684,  689,  690,  692,  675,  674,  683,  693,  687,  685,
+      694,  695,  691,  697,  698,  696,  699,  703,  702,  701,
+      704,  705,  706,  707,  700,  708,  709,  710,  711,  713,
+      714,  716,  712,  717,  719,  718,  708,  715,  721,  720,
+      722,  723,  725,  727,  724,  730,  731,  733,  726,  739,
+      743,  728,  749,  735,  729,  732,  737,  719,  740,  741,
+      744,  718,  747,  734,  736,  738,  750,  747,  752,  753,
+      742,  756,  762,  745,  748,  746,  754,  758,  763,  765,
+      755,  751,  760,  766,  767,  757,  764,  768,  759,  770,
+
+      769,  761,  760,  772,  771,  775,  779,  781,  776,  782,
+      773,  774,  777,  784,  790,  788,  778,  789,  780,  783,
+      785,  786,  791,  793,  787,  792,  796,  747,  795,  797,
+      798,  794,  799,  800,  802,  803,  801,  805,  806,  807,
+      809,  790,  810,  804,  811,  808,  813,  812,  791,  815,
+      816,  814,  817,  818,  820,  821,  822,  819,  823,  820,
+      827,  830,  829,  826,  831,  834,  828,  824,  825,  835,
+      832,  837,  838,  839,  836,  848,  833,  840,  841,  842,
+      846,  847,  844,  850,  843,  845,  851,  849,  853,  854,
+      855,  858,  859,  861,  852,  863,  867,  821,  857,  868,
+
+      856,  860,  883,  864,  862,  866,  865,  869,  870,  873,
+      874,  884,  875,  871,  858,  886,  881,  882,  872,  859,
+      877,  885,  887,  888,  890,  879,  892,  894,  876,  878,
+      895,  880,  891,  893,  897,  898,  896,  900,  889,  902,
+      901,  899,  903,  904,  905,  909,  911,  912,  906,  908,
+      907,  910,  913,  916,  914,  917,  915,  918,  919,  920,
+      921,  922,  924,  926,  925,  923,  930,  927,  929,  928,
+      931,  933,  934,  935,  936,  932,  939,  942,  945,  950,
+      947,  937,  938,  944,  940,  941,  949,  953,  954,  960,
+      961,  963,  923,  965,  970,  943,  956,  946,  968,  948,
+
+      952,  971,  972,  958,  914,  926,  955,  973,  952,  964,
+      975,  977,  978,  951,  966,  967,  957,  974,  959,  962,
+      980,  976,  987,  979,  969,  981,  983,  988,  990,  984,
+      982,  994,  985,  986,  977,  999,  995,  989,  992,  991,
+     1001, 1003,  997,  993,  996,  998, 1002, 1000, 1004, 1007,
+     1013, 1005, 1014, 1015, 1016, 1020, 1017, 1006, 1011, 1023,
+     1008, 1022, 1009, 1012, 1025,    0, 1010, 1021, 1026, 1024,
+     1019, 1027, 1030, 1018, 1031, 1033, 1032, 1029, 1034, 1035,
+     1028, 1037, 1039, 1038, 1040, 1036, 1041, 1043, 1042, 1045,
+     1025, 1046, 1044, 1048, 1049, 1047, 1053, 1054, 1055, 1050,
+
+     1051, 1052, 1056, 1057, 1058, 1060, 1061, 1063, 1064, 1062,
+     1059, 1065, 1066, 1067, 1069, 1070, 1072, 1075, 1068, 1077,
+     1070, 1071, 1079, 1076, 1080, 1083, 1074, 1084, 1073, 1078,
+     1081, 1089, 1082, 1061, 1085, 1093, 1088, 1094, 1086, 1095,
+     1097, 1087, 1091, 1092, 1100, 1104, 1106, 1107, 1110, 1090,
+     1121, 1118, 1119, 1128, 1099, 1096, 1108, 1101, 1098, 1120,
+     1105, 1102, 1124, 1109, 1131, 1117, 1103, 1133, 1137, 1141,
+     1152, 1157,    0, 1111, 1122, 1113,    0, 1125, 1115, 1112,
+     1123, 1116, 1153, 1127, 1114, 1155, 1156, 1126, 1158, 1129,
+     1130, 1144, 1163, 1132, 1166, 1135, 1169, 1136, 1171, 1173,
+
+     1174, 1134, 1177, 1143, 1180, 1183, 1148, 1181, 1186, 1191,
+     1140, 1150, 1151, 1194, 1138, 1154, 1139,    0, 1142, 1146,
+     1147, 1149, 1160,    0, 1159, 1161, 1164, 1145, 1197, 1165,
+     1167, 1168, 1170, 1172, 1202, 1208, 1210, 1211, 1179, 1217,
+     1218, 1219, 1162,    0, 1176, 1225, 1178, 1175, 1220, 1221,
+     1226, 1187, 1227, 1182, 1228, 1184, 1231, 1185, 1189, 1190,
+     1192, 1193, 1195, 1199, 1188, 1232, 1237, 1203, 1239, 1241,
+     1242, 1200, 1196, 1205, 1209, 1207, 1198, 1204, 1213, 1201,
+     1215, 1214, 1216, 1230, 1223, 1212,    0, 1206, 1222, 1229,
+        0,    0, 1224,    0,    0,    0,    0,    0,    0, 1236,
+
+        0, 1240,    0,    0, 1233,    0, 1238,    0, 1234,    0,
+     1235,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0,    0,    0,    0,    0,    0,    0,    0,    0,    0,
+        0
     } ;
 
 static yy_state_type yy_last_accepting_state;
@@ -1353,24 +1551,25 @@ static char *yy_last_accepting_cpos;
 extern int parser6__flex_debug;
 int parser6__flex_debug = 1;
 
-static const flex_int16_t yy_rule_linenum[149] =
+static const flex_int16_t yy_rule_linenum[152] =
     {   0,
-      133,  135,  137,  142,  143,  148,  149,  150,  162,  165,
-      170,  177,  186,  195,  204,  213,  222,  231,  240,  249,
-      258,  267,  276,  285,  294,  303,  313,  323,  333,  343,
-      353,  363,  373,  383,  393,  402,  411,  420,  429,  438,
-      447,  459,  468,  477,  486,  495,  505,  515,  525,  535,
-      546,  556,  566,  576,  586,  596,  606,  616,  626,  635,
-      644,  653,  668,  683,  692,  701,  710,  719,  728,  737,
-      746,  755,  764,  774,  783,  792,  801,  810,  819,  828,
-      838,  847,  856,  865,  874,  883,  892,  901,  910,  919,
-      929,  939,  949,  958,  967,  976,  987,  997, 1006, 1016,
-
-     1025, 1034, 1043, 1052, 1061, 1070, 1080, 1089, 1098, 1107,
-     1116, 1125, 1134, 1143, 1152, 1161, 1170, 1179, 1188, 1197,
-     1206, 1215, 1224, 1233, 1242, 1251, 1260, 1269, 1278, 1287,
-     1296, 1394, 1399, 1404, 1409, 1410, 1411, 1412, 1413, 1414,
-     1416, 1434, 1447, 1452, 1456, 1458, 1460, 1462
+      132,  134,  136,  141,  142,  147,  148,  149,  161,  164,
+      169,  176,  185,  194,  203,  212,  221,  230,  239,  248,
+      257,  266,  275,  284,  293,  302,  312,  322,  332,  342,
+      352,  362,  372,  382,  392,  401,  410,  419,  428,  437,
+      446,  458,  467,  476,  485,  494,  504,  514,  524,  534,
+      545,  555,  565,  575,  585,  595,  605,  615,  625,  635,
+      645,  654,  663,  672,  687,  702,  711,  720,  729,  738,
+      747,  756,  765,  774,  783,  793,  802,  811,  820,  829,
+      838,  847,  857,  866,  875,  884,  893,  902,  911,  920,
+      929,  938,  948,  958,  968,  977,  986,  995, 1006, 1016,
+
+     1025, 1035, 1044, 1053, 1062, 1071, 1080, 1089, 1099, 1108,
+     1117, 1126, 1135, 1144, 1153, 1162, 1171, 1180, 1189, 1198,
+     1207, 1216, 1225, 1234, 1243, 1252, 1261, 1270, 1279, 1288,
+     1297, 1306, 1315, 1324, 1422, 1427, 1432, 1437, 1438, 1439,
+     1440, 1441, 1442, 1444, 1462, 1475, 1480, 1484, 1486, 1488,
+     1490
     } ;
 
 /* The intent behind this definition is that it'll catch
@@ -1415,7 +1614,7 @@ unsigned int comment_start_line = 0;
 
 // To avoid the call to exit... oops!
 #define YY_FATAL_ERROR(msg) isc::dhcp::Parser6Context::fatal(msg)
-#line 1418 "dhcp6_lexer.cc"
+#line 1617 "dhcp6_lexer.cc"
 /* noyywrap disables automatic rewinding for the next file to parse. Since we
    always parse only a single string, there's no need to do any wraps. And
    using yywrap requires linking with -lfl, which provides the default yywrap
@@ -1441,8 +1640,8 @@ unsigned int comment_start_line = 0;
 // by moving it ahead by yyleng bytes. yyleng specifies the length of the
 // currently matched token.
 #define YY_USER_ACTION  driver.loc_.columns(yyleng);
-#line 1444 "dhcp6_lexer.cc"
-#line 1445 "dhcp6_lexer.cc"
+#line 1643 "dhcp6_lexer.cc"
+#line 1644 "dhcp6_lexer.cc"
 
 #define INITIAL 0
 #define COMMENT 1
@@ -1724,11 +1923,11 @@ YY_DECL
 
 	{
 /* %% [7.0] user's declarations go here */
-#line 92 "dhcp6_lexer.ll"
+#line 93 "dhcp6_lexer.ll"
 
 
 
-#line 96 "dhcp6_lexer.ll"
+#line 95 "dhcp6_lexer.ll"
     // This part of the code is copied over to the verbatim to the top
     // of the generated yylex function. Explanation:
     // http://www.gnu.org/software/bison/manual/html_node/Multiple-start_002dsymbols.html
@@ -1765,8 +1964,7 @@ YY_DECL
         }
     }
 
-
-#line 1769 "dhcp6_lexer.cc"
+#line 1967 "dhcp6_lexer.cc"
 
 	while ( /*CONSTCOND*/1 )		/* loops until end-of-file is reached */
 		{
@@ -1795,13 +1993,13 @@ yy_match:
 			while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 				{
 				yy_current_state = (int) yy_def[yy_current_state];
-				if ( yy_current_state >= 1186 )
+				if ( yy_current_state >= 1244 )
 					yy_c = yy_meta[yy_c];
 				}
 			yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
 			++yy_cp;
 			}
-		while ( yy_current_state != 1185 );
+		while ( yy_current_state != 1243 );
 		yy_cp = (yy_last_accepting_cpos);
 		yy_current_state = (yy_last_accepting_state);
 
@@ -1820,13 +2018,13 @@ do_action:	/* This label is used only to access EOF actions. */
 			{
 			if ( yy_act == 0 )
 				fprintf( stderr, "--scanner backing up\n" );
-			else if ( yy_act < 149 )
+			else if ( yy_act < 152 )
 				fprintf( stderr, "--accepting rule at line %ld (\"%s\")\n",
 				         (long)yy_rule_linenum[yy_act], parser6_text );
-			else if ( yy_act == 149 )
+			else if ( yy_act == 152 )
 				fprintf( stderr, "--accepting default rule (\"%s\")\n",
 				         parser6_text );
-			else if ( yy_act == 150 )
+			else if ( yy_act == 153 )
 				fprintf( stderr, "--(end of buffer or a NUL)\n" );
 			else
 				fprintf( stderr, "--EOF (start condition %d)\n", YY_START );
@@ -1844,17 +2042,17 @@ do_action:	/* This label is used only to access EOF actions. */
 
 case 1:
 YY_RULE_SETUP
-#line 133 "dhcp6_lexer.ll"
+#line 132 "dhcp6_lexer.ll"
 ;
 	YY_BREAK
 case 2:
 YY_RULE_SETUP
-#line 135 "dhcp6_lexer.ll"
+#line 134 "dhcp6_lexer.ll"
 ;
 	YY_BREAK
 case 3:
 YY_RULE_SETUP
-#line 137 "dhcp6_lexer.ll"
+#line 136 "dhcp6_lexer.ll"
 {
   BEGIN(COMMENT);
   comment_start_line = driver.loc_.end.line;;
@@ -1862,33 +2060,33 @@ YY_RULE_SETUP
 	YY_BREAK
 case 4:
 YY_RULE_SETUP
-#line 142 "dhcp6_lexer.ll"
+#line 141 "dhcp6_lexer.ll"
 BEGIN(INITIAL);
 	YY_BREAK
 case 5:
 YY_RULE_SETUP
-#line 143 "dhcp6_lexer.ll"
+#line 142 "dhcp6_lexer.ll"
 ;
 	YY_BREAK
 case YY_STATE_EOF(COMMENT):
-#line 144 "dhcp6_lexer.ll"
+#line 143 "dhcp6_lexer.ll"
 {
     isc_throw(Dhcp6ParseError, "Comment not closed. (/* in line " << comment_start_line);
 }
 	YY_BREAK
 case 6:
 YY_RULE_SETUP
-#line 148 "dhcp6_lexer.ll"
+#line 147 "dhcp6_lexer.ll"
 BEGIN(DIR_ENTER);
 	YY_BREAK
 case 7:
 YY_RULE_SETUP
-#line 149 "dhcp6_lexer.ll"
+#line 148 "dhcp6_lexer.ll"
 BEGIN(DIR_INCLUDE);
 	YY_BREAK
 case 8:
 YY_RULE_SETUP
-#line 150 "dhcp6_lexer.ll"
+#line 149 "dhcp6_lexer.ll"
 {
     // Include directive.
 
@@ -1902,19 +2100,19 @@ YY_RULE_SETUP
 case YY_STATE_EOF(DIR_ENTER):
 case YY_STATE_EOF(DIR_INCLUDE):
 case YY_STATE_EOF(DIR_EXIT):
-#line 159 "dhcp6_lexer.ll"
+#line 158 "dhcp6_lexer.ll"
 {
     isc_throw(Dhcp6ParseError, "Directive not closed.");
 }
 	YY_BREAK
 case 9:
 YY_RULE_SETUP
-#line 162 "dhcp6_lexer.ll"
+#line 161 "dhcp6_lexer.ll"
 BEGIN(INITIAL);
 	YY_BREAK
 case 10:
 YY_RULE_SETUP
-#line 165 "dhcp6_lexer.ll"
+#line 164 "dhcp6_lexer.ll"
 {
     // Ok, we found a with space. Let's ignore it and update loc variable.
     driver.loc_.step();
@@ -1923,7 +2121,7 @@ YY_RULE_SETUP
 case 11:
 /* rule 11 can match eol */
 YY_RULE_SETUP
-#line 170 "dhcp6_lexer.ll"
+#line 169 "dhcp6_lexer.ll"
 {
     // Newline found. Let's update the location and continue.
     driver.loc_.lines(yyleng);
@@ -1932,7 +2130,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 12:
 YY_RULE_SETUP
-#line 177 "dhcp6_lexer.ll"
+#line 176 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -1944,7 +2142,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 13:
 YY_RULE_SETUP
-#line 186 "dhcp6_lexer.ll"
+#line 185 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -1956,7 +2154,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 14:
 YY_RULE_SETUP
-#line 195 "dhcp6_lexer.ll"
+#line 194 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -1968,7 +2166,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 15:
 YY_RULE_SETUP
-#line 204 "dhcp6_lexer.ll"
+#line 203 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -1980,7 +2178,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 16:
 YY_RULE_SETUP
-#line 213 "dhcp6_lexer.ll"
+#line 212 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -1992,7 +2190,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 17:
 YY_RULE_SETUP
-#line 222 "dhcp6_lexer.ll"
+#line 221 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2004,7 +2202,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 18:
 YY_RULE_SETUP
-#line 231 "dhcp6_lexer.ll"
+#line 230 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2016,7 +2214,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 19:
 YY_RULE_SETUP
-#line 240 "dhcp6_lexer.ll"
+#line 239 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2028,7 +2226,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 20:
 YY_RULE_SETUP
-#line 249 "dhcp6_lexer.ll"
+#line 248 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2040,7 +2238,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 21:
 YY_RULE_SETUP
-#line 258 "dhcp6_lexer.ll"
+#line 257 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2052,7 +2250,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 22:
 YY_RULE_SETUP
-#line 267 "dhcp6_lexer.ll"
+#line 266 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2064,7 +2262,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 23:
 YY_RULE_SETUP
-#line 276 "dhcp6_lexer.ll"
+#line 275 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2076,7 +2274,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 24:
 YY_RULE_SETUP
-#line 285 "dhcp6_lexer.ll"
+#line 284 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2088,7 +2286,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 25:
 YY_RULE_SETUP
-#line 294 "dhcp6_lexer.ll"
+#line 293 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP_DDNS:
@@ -2100,7 +2298,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 26:
 YY_RULE_SETUP
-#line 303 "dhcp6_lexer.ll"
+#line 302 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::NCR_PROTOCOL) {
@@ -2113,7 +2311,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 27:
 YY_RULE_SETUP
-#line 313 "dhcp6_lexer.ll"
+#line 312 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::NCR_PROTOCOL) {
@@ -2126,7 +2324,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 28:
 YY_RULE_SETUP
-#line 323 "dhcp6_lexer.ll"
+#line 322 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::NCR_FORMAT) {
@@ -2139,7 +2337,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 29:
 YY_RULE_SETUP
-#line 333 "dhcp6_lexer.ll"
+#line 332 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2152,7 +2350,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 30:
 YY_RULE_SETUP
-#line 343 "dhcp6_lexer.ll"
+#line 342 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2165,7 +2363,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 31:
 YY_RULE_SETUP
-#line 353 "dhcp6_lexer.ll"
+#line 352 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2178,7 +2376,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 32:
 YY_RULE_SETUP
-#line 363 "dhcp6_lexer.ll"
+#line 362 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2191,7 +2389,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 33:
 YY_RULE_SETUP
-#line 373 "dhcp6_lexer.ll"
+#line 372 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2204,7 +2402,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 34:
 YY_RULE_SETUP
-#line 383 "dhcp6_lexer.ll"
+#line 382 "dhcp6_lexer.ll"
 {
     /* dhcp-ddns value keywords are case insensitive */
     if (driver.ctx_ == isc::dhcp::Parser6Context::REPLACE_CLIENT_NAME) {
@@ -2217,7 +2415,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 35:
 YY_RULE_SETUP
-#line 393 "dhcp6_lexer.ll"
+#line 392 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -2229,7 +2427,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 36:
 YY_RULE_SETUP
-#line 402 "dhcp6_lexer.ll"
+#line 401 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2241,7 +2439,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 37:
 YY_RULE_SETUP
-#line 411 "dhcp6_lexer.ll"
+#line 410 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::INTERFACES_CONFIG:
@@ -2253,7 +2451,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 38:
 YY_RULE_SETUP
-#line 420 "dhcp6_lexer.ll"
+#line 419 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2265,7 +2463,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 39:
 YY_RULE_SETUP
-#line 429 "dhcp6_lexer.ll"
+#line 428 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2277,7 +2475,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 40:
 YY_RULE_SETUP
-#line 438 "dhcp6_lexer.ll"
+#line 437 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOSTS_DATABASE:
@@ -2289,7 +2487,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 41:
 YY_RULE_SETUP
-#line 447 "dhcp6_lexer.ll"
+#line 446 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2304,7 +2502,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 42:
 YY_RULE_SETUP
-#line 459 "dhcp6_lexer.ll"
+#line 458 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2316,7 +2514,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 43:
 YY_RULE_SETUP
-#line 468 "dhcp6_lexer.ll"
+#line 467 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2328,7 +2526,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 44:
 YY_RULE_SETUP
-#line 477 "dhcp6_lexer.ll"
+#line 476 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2340,7 +2538,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 45:
 YY_RULE_SETUP
-#line 486 "dhcp6_lexer.ll"
+#line 485 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DATABASE_TYPE:
@@ -2352,7 +2550,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 46:
 YY_RULE_SETUP
-#line 495 "dhcp6_lexer.ll"
+#line 494 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2365,7 +2563,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 47:
 YY_RULE_SETUP
-#line 505 "dhcp6_lexer.ll"
+#line 504 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2378,7 +2576,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 48:
 YY_RULE_SETUP
-#line 515 "dhcp6_lexer.ll"
+#line 514 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2391,7 +2589,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 49:
 YY_RULE_SETUP
-#line 525 "dhcp6_lexer.ll"
+#line 524 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2404,7 +2602,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 50:
 YY_RULE_SETUP
-#line 535 "dhcp6_lexer.ll"
+#line 534 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2418,7 +2616,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 51:
 YY_RULE_SETUP
-#line 546 "dhcp6_lexer.ll"
+#line 545 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2431,7 +2629,7 @@ YY_RULE_SETUP
 	YY_BREAK
 case 52:
 YY_RULE_SETUP
-#line 556 "dhcp6_lexer.ll"
+#line 555 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2444,7 +2642,33 @@ YY_RULE_SETUP
 	YY_BREAK
 case 53:
 YY_RULE_SETUP
-#line 566 "dhcp6_lexer.ll"
+#line 565 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_CONNECTION_POOL_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("connection-pool-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 54:
+YY_RULE_SETUP
+#line 575 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::LEASE_DATABASE:
+    case isc::dhcp::Parser6Context::HOSTS_DATABASE:
+        return isc::dhcp::Dhcp6Parser::make_CACHE_SIZE(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("cache-size", driver.loc_);
+    }
+}
+	YY_BREAK
+case 55:
+YY_RULE_SETUP
+#line 585 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2455,9 +2679,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 54:
+case 56:
 YY_RULE_SETUP
-#line 576 "dhcp6_lexer.ll"
+#line 595 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2468,9 +2692,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 55:
+case 57:
 YY_RULE_SETUP
-#line 586 "dhcp6_lexer.ll"
+#line 605 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2481,9 +2705,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 56:
+case 58:
 YY_RULE_SETUP
-#line 596 "dhcp6_lexer.ll"
+#line 615 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2494,9 +2718,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 57:
+case 59:
 YY_RULE_SETUP
-#line 606 "dhcp6_lexer.ll"
+#line 625 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2507,9 +2731,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 58:
+case 60:
 YY_RULE_SETUP
-#line 616 "dhcp6_lexer.ll"
+#line 635 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2520,9 +2744,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 59:
+case 61:
 YY_RULE_SETUP
-#line 626 "dhcp6_lexer.ll"
+#line 645 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2532,9 +2756,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 60:
+case 62:
 YY_RULE_SETUP
-#line 635 "dhcp6_lexer.ll"
+#line 654 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2544,9 +2768,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 61:
+case 63:
 YY_RULE_SETUP
-#line 644 "dhcp6_lexer.ll"
+#line 663 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2556,9 +2780,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 62:
+case 64:
 YY_RULE_SETUP
-#line 653 "dhcp6_lexer.ll"
+#line 672 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2574,9 +2798,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 63:
+case 65:
 YY_RULE_SETUP
-#line 668 "dhcp6_lexer.ll"
+#line 687 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LEASE_DATABASE:
@@ -2592,9 +2816,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 64:
+case 66:
 YY_RULE_SETUP
-#line 683 "dhcp6_lexer.ll"
+#line 702 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -2604,9 +2828,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 65:
+case 67:
 YY_RULE_SETUP
-#line 692 "dhcp6_lexer.ll"
+#line 711 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2616,9 +2840,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 66:
+case 68:
 YY_RULE_SETUP
-#line 701 "dhcp6_lexer.ll"
+#line 720 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2628,9 +2852,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 67:
+case 69:
 YY_RULE_SETUP
-#line 710 "dhcp6_lexer.ll"
+#line 729 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2640,9 +2864,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 68:
+case 70:
 YY_RULE_SETUP
-#line 719 "dhcp6_lexer.ll"
+#line 738 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2652,9 +2876,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 69:
+case 71:
 YY_RULE_SETUP
-#line 728 "dhcp6_lexer.ll"
+#line 747 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2664,9 +2888,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 70:
+case 72:
 YY_RULE_SETUP
-#line 737 "dhcp6_lexer.ll"
+#line 756 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2676,9 +2900,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 71:
+case 73:
 YY_RULE_SETUP
-#line 746 "dhcp6_lexer.ll"
+#line 765 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::PD_POOLS:
@@ -2688,9 +2912,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 72:
+case 74:
 YY_RULE_SETUP
-#line 755 "dhcp6_lexer.ll"
+#line 774 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -2700,9 +2924,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 73:
+case 75:
 YY_RULE_SETUP
-#line 764 "dhcp6_lexer.ll"
+#line 783 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::POOLS:
@@ -2713,9 +2937,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 74:
+case 76:
 YY_RULE_SETUP
-#line 774 "dhcp6_lexer.ll"
+#line 793 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2725,9 +2949,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 75:
+case 77:
 YY_RULE_SETUP
-#line 783 "dhcp6_lexer.ll"
+#line 802 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2737,9 +2961,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 76:
+case 78:
 YY_RULE_SETUP
-#line 792 "dhcp6_lexer.ll"
+#line 811 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2749,9 +2973,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 77:
+case 79:
 YY_RULE_SETUP
-#line 801 "dhcp6_lexer.ll"
+#line 820 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2761,9 +2985,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 78:
+case 80:
 YY_RULE_SETUP
-#line 810 "dhcp6_lexer.ll"
+#line 829 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2773,9 +2997,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 79:
+case 81:
 YY_RULE_SETUP
-#line 819 "dhcp6_lexer.ll"
+#line 838 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2785,9 +3009,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 80:
+case 82:
 YY_RULE_SETUP
-#line 828 "dhcp6_lexer.ll"
+#line 847 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -2798,9 +3022,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 81:
+case 83:
 YY_RULE_SETUP
-#line 838 "dhcp6_lexer.ll"
+#line 857 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2810,9 +3034,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 82:
+case 84:
 YY_RULE_SETUP
-#line 847 "dhcp6_lexer.ll"
+#line 866 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2822,9 +3046,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 83:
+case 85:
 YY_RULE_SETUP
-#line 856 "dhcp6_lexer.ll"
+#line 875 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2834,9 +3058,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 84:
+case 86:
 YY_RULE_SETUP
-#line 865 "dhcp6_lexer.ll"
+#line 884 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -2846,9 +3070,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 85:
+case 87:
 YY_RULE_SETUP
-#line 874 "dhcp6_lexer.ll"
+#line 893 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGING:
@@ -2858,9 +3082,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 86:
+case 88:
 YY_RULE_SETUP
-#line 883 "dhcp6_lexer.ll"
+#line 902 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -2870,9 +3094,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 87:
+case 89:
 YY_RULE_SETUP
-#line 892 "dhcp6_lexer.ll"
+#line 911 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OUTPUT_OPTIONS:
@@ -2882,9 +3106,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 88:
+case 90:
 YY_RULE_SETUP
-#line 901 "dhcp6_lexer.ll"
+#line 920 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -2894,9 +3118,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 89:
+case 91:
 YY_RULE_SETUP
-#line 910 "dhcp6_lexer.ll"
+#line 929 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::LOGGERS:
@@ -2906,9 +3130,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 90:
+case 92:
 YY_RULE_SETUP
-#line 919 "dhcp6_lexer.ll"
+#line 938 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -2919,9 +3143,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 91:
+case 93:
 YY_RULE_SETUP
-#line 929 "dhcp6_lexer.ll"
+#line 948 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2932,9 +3156,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 92:
+case 94:
 YY_RULE_SETUP
-#line 939 "dhcp6_lexer.ll"
+#line 958 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CLIENT_CLASSES:
@@ -2945,9 +3169,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 93:
+case 95:
 YY_RULE_SETUP
-#line 949 "dhcp6_lexer.ll"
+#line 968 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -2957,9 +3181,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 94:
+case 96:
 YY_RULE_SETUP
-#line 958 "dhcp6_lexer.ll"
+#line 977 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -2969,9 +3193,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 95:
+case 97:
 YY_RULE_SETUP
-#line 967 "dhcp6_lexer.ll"
+#line 986 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -2981,9 +3205,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 96:
+case 98:
 YY_RULE_SETUP
-#line 976 "dhcp6_lexer.ll"
+#line 995 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::MAC_SOURCES:
@@ -2995,9 +3219,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 97:
+case 99:
 YY_RULE_SETUP
-#line 987 "dhcp6_lexer.ll"
+#line 1006 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOST_RESERVATION_IDENTIFIERS:
@@ -3008,9 +3232,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 98:
+case 100:
 YY_RULE_SETUP
-#line 997 "dhcp6_lexer.ll"
+#line 1016 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RESERVATIONS:
@@ -3020,9 +3244,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 99:
+case 101:
 YY_RULE_SETUP
-#line 1006 "dhcp6_lexer.ll"
+#line 1025 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3033,9 +3257,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 100:
+case 102:
 YY_RULE_SETUP
-#line 1016 "dhcp6_lexer.ll"
+#line 1035 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DATA:
@@ -3045,9 +3269,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 101:
+case 103:
 YY_RULE_SETUP
-#line 1025 "dhcp6_lexer.ll"
+#line 1044 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3057,9 +3281,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 102:
+case 104:
 YY_RULE_SETUP
-#line 1034 "dhcp6_lexer.ll"
+#line 1053 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3069,9 +3293,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 103:
+case 105:
 YY_RULE_SETUP
-#line 1043 "dhcp6_lexer.ll"
+#line 1062 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::OPTION_DEF:
@@ -3081,9 +3305,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 104:
+case 106:
 YY_RULE_SETUP
-#line 1052 "dhcp6_lexer.ll"
+#line 1071 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SUBNET6:
@@ -3093,9 +3317,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 105:
+case 107:
 YY_RULE_SETUP
-#line 1061 "dhcp6_lexer.ll"
+#line 1080 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::RELAY:
@@ -3105,9 +3329,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 106:
+case 108:
 YY_RULE_SETUP
-#line 1070 "dhcp6_lexer.ll"
+#line 1089 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3117,9 +3341,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 107:
+case 109:
 YY_RULE_SETUP
-#line 1080 "dhcp6_lexer.ll"
+#line 1099 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3129,9 +3353,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 108:
+case 110:
 YY_RULE_SETUP
-#line 1089 "dhcp6_lexer.ll"
+#line 1108 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::HOOKS_LIBRARIES:
@@ -3141,9 +3365,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 109:
+case 111:
 YY_RULE_SETUP
-#line 1098 "dhcp6_lexer.ll"
+#line 1117 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3153,9 +3377,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 110:
+case 112:
 YY_RULE_SETUP
-#line 1107 "dhcp6_lexer.ll"
+#line 1126 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3165,9 +3389,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 111:
+case 113:
 YY_RULE_SETUP
-#line 1116 "dhcp6_lexer.ll"
+#line 1135 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3177,9 +3401,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 112:
+case 114:
 YY_RULE_SETUP
-#line 1125 "dhcp6_lexer.ll"
+#line 1144 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DUID_TYPE:
@@ -3189,9 +3413,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 113:
+case 115:
 YY_RULE_SETUP
-#line 1134 "dhcp6_lexer.ll"
+#line 1153 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3201,9 +3425,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 114:
+case 116:
 YY_RULE_SETUP
-#line 1143 "dhcp6_lexer.ll"
+#line 1162 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3213,9 +3437,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 115:
+case 117:
 YY_RULE_SETUP
-#line 1152 "dhcp6_lexer.ll"
+#line 1171 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3225,9 +3449,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 116:
+case 118:
 YY_RULE_SETUP
-#line 1161 "dhcp6_lexer.ll"
+#line 1180 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::SERVER_ID:
@@ -3237,9 +3461,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 117:
+case 119:
 YY_RULE_SETUP
-#line 1170 "dhcp6_lexer.ll"
+#line 1189 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3249,9 +3473,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 118:
+case 120:
 YY_RULE_SETUP
-#line 1179 "dhcp6_lexer.ll"
+#line 1198 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3261,9 +3485,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 119:
+case 121:
 YY_RULE_SETUP
-#line 1188 "dhcp6_lexer.ll"
+#line 1207 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3273,9 +3497,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 120:
+case 122:
 YY_RULE_SETUP
-#line 1197 "dhcp6_lexer.ll"
+#line 1216 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3285,9 +3509,21 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 121:
+case 123:
+YY_RULE_SETUP
+#line 1225 "dhcp6_lexer.ll"
+{
+    switch(driver.ctx_) {
+    case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
+        return isc::dhcp::Dhcp6Parser::make_REUSE_QUARANTINE_TIME(driver.loc_);
+    default:
+        return isc::dhcp::Dhcp6Parser::make_STRING("reuse-quarantine-time", driver.loc_);
+    }
+}
+	YY_BREAK
+case 124:
 YY_RULE_SETUP
-#line 1206 "dhcp6_lexer.ll"
+#line 1234 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3297,9 +3533,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 122:
+case 125:
 YY_RULE_SETUP
-#line 1215 "dhcp6_lexer.ll"
+#line 1243 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3309,9 +3545,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 123:
+case 126:
 YY_RULE_SETUP
-#line 1224 "dhcp6_lexer.ll"
+#line 1252 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::EXPIRED_LEASES_PROCESSING:
@@ -3321,9 +3557,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 124:
+case 127:
 YY_RULE_SETUP
-#line 1233 "dhcp6_lexer.ll"
+#line 1261 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3333,9 +3569,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 125:
+case 128:
 YY_RULE_SETUP
-#line 1242 "dhcp6_lexer.ll"
+#line 1270 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3345,9 +3581,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 126:
+case 129:
 YY_RULE_SETUP
-#line 1251 "dhcp6_lexer.ll"
+#line 1279 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3357,9 +3593,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 127:
+case 130:
 YY_RULE_SETUP
-#line 1260 "dhcp6_lexer.ll"
+#line 1288 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONTROL_SOCKET:
@@ -3369,9 +3605,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 128:
+case 131:
 YY_RULE_SETUP
-#line 1269 "dhcp6_lexer.ll"
+#line 1297 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::DHCP6:
@@ -3381,9 +3617,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 129:
+case 132:
 YY_RULE_SETUP
-#line 1278 "dhcp6_lexer.ll"
+#line 1306 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3393,9 +3629,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 130:
+case 133:
 YY_RULE_SETUP
-#line 1287 "dhcp6_lexer.ll"
+#line 1315 "dhcp6_lexer.ll"
 {
     switch(driver.ctx_) {
     case isc::dhcp::Parser6Context::CONFIG:
@@ -3405,9 +3641,9 @@ YY_RULE_SETUP
     }
 }
 	YY_BREAK
-case 131:
+case 134:
 YY_RULE_SETUP
-#line 1296 "dhcp6_lexer.ll"
+#line 1324 "dhcp6_lexer.ll"
 {
     // A string has been matched. It contains the actual string and single quotes.
     // We need to get those quotes out of the way and just use its content, e.g.
@@ -3506,65 +3742,65 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_STRING(decoded, driver.loc_);
 }
 	YY_BREAK
-case 132:
-/* rule 132 can match eol */
+case 135:
+/* rule 135 can match eol */
 YY_RULE_SETUP
-#line 1394 "dhcp6_lexer.ll"
+#line 1422 "dhcp6_lexer.ll"
 {
     // Bad string with a forbidden control character inside
     driver.error(driver.loc_, "Invalid control in " + std::string(yytext));
 }
 	YY_BREAK
-case 133:
-/* rule 133 can match eol */
+case 136:
+/* rule 136 can match eol */
 YY_RULE_SETUP
-#line 1399 "dhcp6_lexer.ll"
+#line 1427 "dhcp6_lexer.ll"
 {
     // Bad string with a bad escape inside
     driver.error(driver.loc_, "Bad escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 134:
+case 137:
 YY_RULE_SETUP
-#line 1404 "dhcp6_lexer.ll"
+#line 1432 "dhcp6_lexer.ll"
 {
     // Bad string with an open escape at the end
     driver.error(driver.loc_, "Overflow escape in " + std::string(yytext));
 }
 	YY_BREAK
-case 135:
+case 138:
 YY_RULE_SETUP
-#line 1409 "dhcp6_lexer.ll"
+#line 1437 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 136:
+case 139:
 YY_RULE_SETUP
-#line 1410 "dhcp6_lexer.ll"
+#line 1438 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RSQUARE_BRACKET(driver.loc_); }
 	YY_BREAK
-case 137:
+case 140:
 YY_RULE_SETUP
-#line 1411 "dhcp6_lexer.ll"
+#line 1439 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_LCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 138:
+case 141:
 YY_RULE_SETUP
-#line 1412 "dhcp6_lexer.ll"
+#line 1440 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_RCURLY_BRACKET(driver.loc_); }
 	YY_BREAK
-case 139:
+case 142:
 YY_RULE_SETUP
-#line 1413 "dhcp6_lexer.ll"
+#line 1441 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COMMA(driver.loc_); }
 	YY_BREAK
-case 140:
+case 143:
 YY_RULE_SETUP
-#line 1414 "dhcp6_lexer.ll"
+#line 1442 "dhcp6_lexer.ll"
 { return isc::dhcp::Dhcp6Parser::make_COLON(driver.loc_); }
 	YY_BREAK
-case 141:
+case 144:
 YY_RULE_SETUP
-#line 1416 "dhcp6_lexer.ll"
+#line 1444 "dhcp6_lexer.ll"
 {
     // An integer was found.
     std::string tmp(yytext);
@@ -3583,9 +3819,9 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_INTEGER(integer, driver.loc_);
 }
 	YY_BREAK
-case 142:
+case 145:
 YY_RULE_SETUP
-#line 1434 "dhcp6_lexer.ll"
+#line 1462 "dhcp6_lexer.ll"
 {
     // A floating point was found.
     std::string tmp(yytext);
@@ -3599,43 +3835,43 @@ YY_RULE_SETUP
     return isc::dhcp::Dhcp6Parser::make_FLOAT(fp, driver.loc_);
 }
 	YY_BREAK
-case 143:
+case 146:
 YY_RULE_SETUP
-#line 1447 "dhcp6_lexer.ll"
+#line 1475 "dhcp6_lexer.ll"
 {
     string tmp(yytext);
     return isc::dhcp::Dhcp6Parser::make_BOOLEAN(tmp == "true", driver.loc_);
 }
 	YY_BREAK
-case 144:
+case 147:
 YY_RULE_SETUP
-#line 1452 "dhcp6_lexer.ll"
+#line 1480 "dhcp6_lexer.ll"
 {
    return isc::dhcp::Dhcp6Parser::make_NULL_TYPE(driver.loc_);
 }
 	YY_BREAK
-case 145:
+case 148:
 YY_RULE_SETUP
-#line 1456 "dhcp6_lexer.ll"
+#line 1484 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON true reserved keyword is lower case only");
 	YY_BREAK
-case 146:
+case 149:
 YY_RULE_SETUP
-#line 1458 "dhcp6_lexer.ll"
+#line 1486 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON false reserved keyword is lower case only");
 	YY_BREAK
-case 147:
+case 150:
 YY_RULE_SETUP
-#line 1460 "dhcp6_lexer.ll"
+#line 1488 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "JSON null reserved keyword is lower case only");
 	YY_BREAK
-case 148:
+case 151:
 YY_RULE_SETUP
-#line 1462 "dhcp6_lexer.ll"
+#line 1490 "dhcp6_lexer.ll"
 driver.error (driver.loc_, "Invalid character: " + std::string(yytext));
 	YY_BREAK
 case YY_STATE_EOF(INITIAL):
-#line 1464 "dhcp6_lexer.ll"
+#line 1492 "dhcp6_lexer.ll"
 {
     if (driver.states_.empty()) {
         return isc::dhcp::Dhcp6Parser::make_END(driver.loc_);
@@ -3659,12 +3895,12 @@ case YY_STATE_EOF(INITIAL):
     BEGIN(DIR_EXIT);
 }
 	YY_BREAK
-case 149:
+case 152:
 YY_RULE_SETUP
-#line 1487 "dhcp6_lexer.ll"
+#line 1515 "dhcp6_lexer.ll"
 ECHO;
 	YY_BREAK
-#line 3667 "dhcp6_lexer.cc"
+#line 3903 "dhcp6_lexer.cc"
 
 	case YY_END_OF_BUFFER:
 		{
@@ -3979,7 +4215,7 @@ static int yy_get_next_buffer (void)
 		while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 			{
 			yy_current_state = (int) yy_def[yy_current_state];
-			if ( yy_current_state >= 1186 )
+			if ( yy_current_state >= 1244 )
 				yy_c = yy_meta[yy_c];
 			}
 		yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
@@ -4012,11 +4248,11 @@ static int yy_get_next_buffer (void)
 	while ( yy_chk[yy_base[yy_current_state] + yy_c] != yy_current_state )
 		{
 		yy_current_state = (int) yy_def[yy_current_state];
-		if ( yy_current_state >= 1186 )
+		if ( yy_current_state >= 1244 )
 			yy_c = yy_meta[yy_c];
 		}
 	yy_current_state = yy_nxt[yy_base[yy_current_state] + yy_c];
-	yy_is_jam = (yy_current_state == 1185);
+	yy_is_jam = (yy_current_state == 1243);
 
 		return yy_is_jam ? 0 : yy_current_state;
 }
@@ -4765,8 +5001,7 @@ void parser6_free (void * ptr )
 
 /* %ok-for-header */
 
-#line 1487 "dhcp6_lexer.ll"
-
+#line 1515 "dhcp6_lexer.ll"
 
 using namespace isc::dhcp;
 
@@ -4867,4 +5102,3 @@ class Dummy {
     void dummy() { yy_fatal_error("Fix me: how to disable its definition?"); }
 };
 }
-
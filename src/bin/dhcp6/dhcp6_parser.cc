@@ -253,28 +253,28 @@ namespace isc { namespace dhcp {
   {
       switch (that.type_get ())
     {
-      case 157: // value
-      case 161: // map_value
-      case 202: // db_type
-      case 394: // duid_type
-      case 427: // ncr_protocol_value
-      case 435: // replace_client_name_value
+      case 160: // value
+      case 164: // map_value
+      case 205: // db_type
+      case 400: // duid_type
+      case 433: // ncr_protocol_value
+      case 441: // replace_client_name_value
         value.move< ElementPtr > (that.value);
         break;
 
-      case 142: // "boolean"
+      case 145: // "boolean"
         value.move< bool > (that.value);
         break;
 
-      case 141: // "floating point"
+      case 144: // "floating point"
         value.move< double > (that.value);
         break;
 
-      case 140: // "integer"
+      case 143: // "integer"
         value.move< int64_t > (that.value);
         break;
 
-      case 139: // "constant string"
+      case 142: // "constant string"
         value.move< std::string > (that.value);
         break;
 
@@ -293,28 +293,28 @@ namespace isc { namespace dhcp {
     state = that.state;
       switch (that.type_get ())
     {
-      case 157: // value
-      case 161: // map_value
-      case 202: // db_type
-      case 394: // duid_type
-      case 427: // ncr_protocol_value
-      case 435: // replace_client_name_value
+      case 160: // value
+      case 164: // map_value
+      case 205: // db_type
+      case 400: // duid_type
+      case 433: // ncr_protocol_value
+      case 441: // replace_client_name_value
         value.copy< ElementPtr > (that.value);
         break;
 
-      case 142: // "boolean"
+      case 145: // "boolean"
         value.copy< bool > (that.value);
         break;
 
-      case 141: // "floating point"
+      case 144: // "floating point"
         value.copy< double > (that.value);
         break;
 
-      case 140: // "integer"
+      case 143: // "integer"
         value.copy< int64_t > (that.value);
         break;
 
-      case 139: // "constant string"
+      case 142: // "constant string"
         value.copy< std::string > (that.value);
         break;
 
@@ -354,72 +354,72 @@ namespace isc { namespace dhcp {
         << yysym.location << ": ";
     switch (yytype)
     {
-            case 139: // "constant string"
+            case 142: // "constant string"
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< std::string > (); }
 #line 362 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 140: // "integer"
+      case 143: // "integer"
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< int64_t > (); }
 #line 369 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 141: // "floating point"
+      case 144: // "floating point"
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< double > (); }
 #line 376 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 142: // "boolean"
+      case 145: // "boolean"
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< bool > (); }
 #line 383 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 157: // value
+      case 160: // value
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 390 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 161: // map_value
+      case 164: // map_value
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 397 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 202: // db_type
+      case 205: // db_type
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 404 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 394: // duid_type
+      case 400: // duid_type
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 411 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 427: // ncr_protocol_value
+      case 433: // ncr_protocol_value
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 418 "dhcp6_parser.cc" // lalr1.cc:636
         break;
 
-      case 435: // replace_client_name_value
+      case 441: // replace_client_name_value
 
-#line 214 "dhcp6_parser.yy" // lalr1.cc:636
+#line 217 "dhcp6_parser.yy" // lalr1.cc:636
         { yyoutput << yysym.value.template as< ElementPtr > (); }
 #line 425 "dhcp6_parser.cc" // lalr1.cc:636
         break;
@@ -621,28 +621,28 @@ namespace isc { namespace dhcp {
          when using variants.  */
         switch (yyr1_[yyn])
     {
-      case 157: // value
-      case 161: // map_value
-      case 202: // db_type
-      case 394: // duid_type
-      case 427: // ncr_protocol_value
-      case 435: // replace_client_name_value
+      case 160: // value
+      case 164: // map_value
+      case 205: // db_type
+      case 400: // duid_type
+      case 433: // ncr_protocol_value
+      case 441: // replace_client_name_value
         yylhs.value.build< ElementPtr > ();
         break;
 
-      case 142: // "boolean"
+      case 145: // "boolean"
         yylhs.value.build< bool > ();
         break;
 
-      case 141: // "floating point"
+      case 144: // "floating point"
         yylhs.value.build< double > ();
         break;
 
-      case 140: // "integer"
+      case 143: // "integer"
         yylhs.value.build< int64_t > ();
         break;
 
-      case 139: // "constant string"
+      case 142: // "constant string"
         yylhs.value.build< std::string > ();
         break;
 
@@ -664,121 +664,121 @@ namespace isc { namespace dhcp {
           switch (yyn)
             {
   case 2:
-#line 223 "dhcp6_parser.yy" // lalr1.cc:859
+#line 226 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.NO_KEYWORD; }
 #line 670 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 4:
-#line 224 "dhcp6_parser.yy" // lalr1.cc:859
+#line 227 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.CONFIG; }
 #line 676 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 6:
-#line 225 "dhcp6_parser.yy" // lalr1.cc:859
+#line 228 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP6; }
 #line 682 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 8:
-#line 226 "dhcp6_parser.yy" // lalr1.cc:859
+#line 229 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.INTERFACES_CONFIG; }
 #line 688 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 10:
-#line 227 "dhcp6_parser.yy" // lalr1.cc:859
+#line 230 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.SUBNET6; }
 #line 694 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 12:
-#line 228 "dhcp6_parser.yy" // lalr1.cc:859
+#line 231 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.POOLS; }
 #line 700 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 14:
-#line 229 "dhcp6_parser.yy" // lalr1.cc:859
+#line 232 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.PD_POOLS; }
 #line 706 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 16:
-#line 230 "dhcp6_parser.yy" // lalr1.cc:859
+#line 233 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.RESERVATIONS; }
 #line 712 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 18:
-#line 231 "dhcp6_parser.yy" // lalr1.cc:859
+#line 234 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DEF; }
 #line 718 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 20:
-#line 232 "dhcp6_parser.yy" // lalr1.cc:859
+#line 235 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.OPTION_DATA; }
 #line 724 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 22:
-#line 233 "dhcp6_parser.yy" // lalr1.cc:859
+#line 236 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.HOOKS_LIBRARIES; }
 #line 730 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 24:
-#line 234 "dhcp6_parser.yy" // lalr1.cc:859
+#line 237 "dhcp6_parser.yy" // lalr1.cc:859
     { ctx.ctx_ = ctx.DHCP_DDNS; }
 #line 736 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 26:
-#line 242 "dhcp6_parser.yy" // lalr1.cc:859
+#line 245 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location))); }
 #line 742 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 27:
-#line 243 "dhcp6_parser.yy" // lalr1.cc:859
+#line 246 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new DoubleElement(yystack_[0].value.as< double > (), ctx.loc2pos(yystack_[0].location))); }
 #line 748 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 28:
-#line 244 "dhcp6_parser.yy" // lalr1.cc:859
+#line 247 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location))); }
 #line 754 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 29:
-#line 245 "dhcp6_parser.yy" // lalr1.cc:859
+#line 248 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location))); }
 #line 760 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 30:
-#line 246 "dhcp6_parser.yy" // lalr1.cc:859
+#line 249 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new NullElement(ctx.loc2pos(yystack_[0].location))); }
 #line 766 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 31:
-#line 247 "dhcp6_parser.yy" // lalr1.cc:859
+#line 250 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 772 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 32:
-#line 248 "dhcp6_parser.yy" // lalr1.cc:859
+#line 251 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 778 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 33:
-#line 251 "dhcp6_parser.yy" // lalr1.cc:859
+#line 254 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Push back the JSON value on the stack
     ctx.stack_.push_back(yystack_[0].value.as< ElementPtr > ());
@@ -787,7 +787,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 34:
-#line 256 "dhcp6_parser.yy" // lalr1.cc:859
+#line 259 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -798,7 +798,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 35:
-#line 261 "dhcp6_parser.yy" // lalr1.cc:859
+#line 264 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -808,13 +808,13 @@ namespace isc { namespace dhcp {
     break;
 
   case 36:
-#line 267 "dhcp6_parser.yy" // lalr1.cc:859
+#line 270 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ctx.stack_.back(); ctx.stack_.pop_back(); }
 #line 814 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
   case 39:
-#line 274 "dhcp6_parser.yy" // lalr1.cc:859
+#line 277 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // map containing a single entry
                   ctx.stack_.back()->set(yystack_[2].value.as< std::string > (), yystack_[0].value.as< ElementPtr > ());
@@ -823,7 +823,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 40:
-#line 278 "dhcp6_parser.yy" // lalr1.cc:859
+#line 281 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // map consisting of a shorter map followed by
                   // comma and string:value
@@ -833,7 +833,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 41:
-#line 285 "dhcp6_parser.yy" // lalr1.cc:859
+#line 288 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(l);
@@ -842,7 +842,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 42:
-#line 288 "dhcp6_parser.yy" // lalr1.cc:859
+#line 291 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
 }
@@ -850,7 +850,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 45:
-#line 296 "dhcp6_parser.yy" // lalr1.cc:859
+#line 299 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // List consisting of a single element.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -859,7 +859,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 46:
-#line 300 "dhcp6_parser.yy" // lalr1.cc:859
+#line 303 "dhcp6_parser.yy" // lalr1.cc:859
     {
                   // List ending with , and a value.
                   ctx.stack_.back()->add(yystack_[0].value.as< ElementPtr > ());
@@ -868,7 +868,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 47:
-#line 307 "dhcp6_parser.yy" // lalr1.cc:859
+#line 310 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // List parsing about to start
 }
@@ -876,7 +876,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 48:
-#line 309 "dhcp6_parser.yy" // lalr1.cc:859
+#line 312 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // list parsing complete. Put any sanity checking here
     //ctx.stack_.pop_back();
@@ -885,7 +885,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 51:
-#line 318 "dhcp6_parser.yy" // lalr1.cc:859
+#line 321 "dhcp6_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -894,7 +894,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 52:
-#line 322 "dhcp6_parser.yy" // lalr1.cc:859
+#line 325 "dhcp6_parser.yy" // lalr1.cc:859
     {
                           ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
                           ctx.stack_.back()->add(s);
@@ -903,7 +903,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 53:
-#line 333 "dhcp6_parser.yy" // lalr1.cc:859
+#line 336 "dhcp6_parser.yy" // lalr1.cc:859
     {
     const std::string& where = ctx.contextName();
     const std::string& keyword = yystack_[1].value.as< std::string > ();
@@ -914,7 +914,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 54:
-#line 343 "dhcp6_parser.yy" // lalr1.cc:859
+#line 346 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -925,7 +925,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 55:
-#line 348 "dhcp6_parser.yy" // lalr1.cc:859
+#line 351 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -935,7 +935,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 63:
-#line 367 "dhcp6_parser.yy" // lalr1.cc:859
+#line 370 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // This code is executed when we're about to start parsing
     // the content of the map
@@ -948,7 +948,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 64:
-#line 374 "dhcp6_parser.yy" // lalr1.cc:859
+#line 377 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // map parsing completed. If we ever want to do any wrap up
     // (maybe some sanity checking), this would be the best place
@@ -960,7 +960,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 65:
-#line 384 "dhcp6_parser.yy" // lalr1.cc:859
+#line 387 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the Dhcp6 map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -970,7 +970,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 66:
-#line 388 "dhcp6_parser.yy" // lalr1.cc:859
+#line 391 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
@@ -978,7 +978,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 91:
-#line 422 "dhcp6_parser.yy" // lalr1.cc:859
+#line 425 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("preferred-lifetime", prf);
@@ -987,7 +987,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 92:
-#line 427 "dhcp6_parser.yy" // lalr1.cc:859
+#line 430 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("valid-lifetime", prf);
@@ -996,7 +996,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 93:
-#line 432 "dhcp6_parser.yy" // lalr1.cc:859
+#line 435 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("renew-timer", prf);
@@ -1005,7 +1005,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 94:
-#line 437 "dhcp6_parser.yy" // lalr1.cc:859
+#line 440 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rebind-timer", prf);
@@ -1014,7 +1014,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 95:
-#line 442 "dhcp6_parser.yy" // lalr1.cc:859
+#line 445 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr dpp(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("decline-probation-period", dpp);
@@ -1023,7 +1023,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 96:
-#line 447 "dhcp6_parser.yy" // lalr1.cc:859
+#line 450 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces-config", i);
@@ -1034,7 +1034,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 97:
-#line 452 "dhcp6_parser.yy" // lalr1.cc:859
+#line 455 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1043,7 +1043,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 98:
-#line 457 "dhcp6_parser.yy" // lalr1.cc:859
+#line 460 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the interfaces-config map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
@@ -1053,7 +1053,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 99:
-#line 461 "dhcp6_parser.yy" // lalr1.cc:859
+#line 464 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
@@ -1061,7 +1061,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 100:
-#line 465 "dhcp6_parser.yy" // lalr1.cc:859
+#line 468 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interfaces", l);
@@ -1072,7 +1072,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 101:
-#line 470 "dhcp6_parser.yy" // lalr1.cc:859
+#line 473 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1081,7 +1081,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 102:
-#line 475 "dhcp6_parser.yy" // lalr1.cc:859
+#line 478 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lease-database", i);
@@ -1092,7 +1092,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 103:
-#line 480 "dhcp6_parser.yy" // lalr1.cc:859
+#line 483 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1101,7 +1101,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 104:
-#line 485 "dhcp6_parser.yy" // lalr1.cc:859
+#line 488 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hosts-database", i);
@@ -1112,7 +1112,7 @@ namespace isc { namespace dhcp {
     break;
 
   case 105:
-#line 490 "dhcp6_parser.yy" // lalr1.cc:859
+#line 493 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
@@ -1120,16 +1120,16 @@ namespace isc { namespace dhcp {
 #line 1121 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 121:
-#line 514 "dhcp6_parser.yy" // lalr1.cc:859
+  case 123:
+#line 519 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DATABASE_TYPE);
 }
 #line 1129 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 122:
-#line 516 "dhcp6_parser.yy" // lalr1.cc:859
+  case 124:
+#line 521 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
@@ -1137,40 +1137,40 @@ namespace isc { namespace dhcp {
 #line 1138 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 123:
-#line 521 "dhcp6_parser.yy" // lalr1.cc:859
+  case 125:
+#line 526 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("memfile", ctx.loc2pos(yystack_[0].location))); }
 #line 1144 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 124:
-#line 522 "dhcp6_parser.yy" // lalr1.cc:859
+  case 126:
+#line 527 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("mysql", ctx.loc2pos(yystack_[0].location))); }
 #line 1150 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 125:
-#line 523 "dhcp6_parser.yy" // lalr1.cc:859
+  case 127:
+#line 528 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("postgresql", ctx.loc2pos(yystack_[0].location))); }
 #line 1156 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 126:
-#line 524 "dhcp6_parser.yy" // lalr1.cc:859
+  case 128:
+#line 529 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("cql", ctx.loc2pos(yystack_[0].location))); }
 #line 1162 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 127:
-#line 527 "dhcp6_parser.yy" // lalr1.cc:859
+  case 129:
+#line 532 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1170 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 128:
-#line 529 "dhcp6_parser.yy" // lalr1.cc:859
+  case 130:
+#line 534 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr user(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("user", user);
@@ -1179,16 +1179,16 @@ namespace isc { namespace dhcp {
 #line 1180 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 129:
-#line 535 "dhcp6_parser.yy" // lalr1.cc:859
+  case 131:
+#line 540 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1188 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 130:
-#line 537 "dhcp6_parser.yy" // lalr1.cc:859
+  case 132:
+#line 542 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr pwd(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("password", pwd);
@@ -1197,16 +1197,16 @@ namespace isc { namespace dhcp {
 #line 1198 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 131:
-#line 543 "dhcp6_parser.yy" // lalr1.cc:859
+  case 133:
+#line 548 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1206 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 132:
-#line 545 "dhcp6_parser.yy" // lalr1.cc:859
+  case 134:
+#line 550 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr h(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host", h);
@@ -1215,8 +1215,8 @@ namespace isc { namespace dhcp {
 #line 1216 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 133:
-#line 551 "dhcp6_parser.yy" // lalr1.cc:859
+  case 135:
+#line 556 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr p(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("port", p);
@@ -1224,16 +1224,16 @@ namespace isc { namespace dhcp {
 #line 1225 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 134:
-#line 556 "dhcp6_parser.yy" // lalr1.cc:859
+  case 136:
+#line 561 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
 #line 1233 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 135:
-#line 558 "dhcp6_parser.yy" // lalr1.cc:859
+  case 137:
+#line 563 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("name", name);
@@ -1242,8 +1242,8 @@ namespace isc { namespace dhcp {
 #line 1243 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 136:
-#line 564 "dhcp6_parser.yy" // lalr1.cc:859
+  case 138:
+#line 569 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("persist", n);
@@ -1251,8 +1251,8 @@ namespace isc { namespace dhcp {
 #line 1252 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 137:
-#line 569 "dhcp6_parser.yy" // lalr1.cc:859
+  case 139:
+#line 574 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("lfc-interval", n);
@@ -1260,8 +1260,8 @@ namespace isc { namespace dhcp {
 #line 1261 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 138:
-#line 574 "dhcp6_parser.yy" // lalr1.cc:859
+  case 140:
+#line 579 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("readonly", n);
@@ -1269,8 +1269,8 @@ namespace isc { namespace dhcp {
 #line 1270 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 139:
-#line 579 "dhcp6_parser.yy" // lalr1.cc:859
+  case 141:
+#line 584 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("connect-timeout", n);
@@ -1278,326 +1278,353 @@ namespace isc { namespace dhcp {
 #line 1279 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 140:
-#line 584 "dhcp6_parser.yy" // lalr1.cc:859
+  case 142:
+#line 589 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("connection-pool-size", n);
+}
+#line 1288 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 143:
+#line 594 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr n(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("cache-size", n);
+}
+#line 1297 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 144:
+#line 599 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1287 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1305 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 141:
-#line 586 "dhcp6_parser.yy" // lalr1.cc:859
+  case 145:
+#line 601 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr cp(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("contact-points", cp);
     ctx.leave();
 }
-#line 1297 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1315 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 142:
-#line 592 "dhcp6_parser.yy" // lalr1.cc:859
+  case 146:
+#line 607 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1305 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1323 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 143:
-#line 594 "dhcp6_parser.yy" // lalr1.cc:859
+  case 147:
+#line 609 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr ks(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("keyspace", ks);
     ctx.leave();
 }
-#line 1315 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1333 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 144:
-#line 601 "dhcp6_parser.yy" // lalr1.cc:859
+  case 148:
+#line 616 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("mac-sources", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.MAC_SOURCES);
 }
-#line 1326 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1344 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 145:
-#line 606 "dhcp6_parser.yy" // lalr1.cc:859
+  case 149:
+#line 621 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1335 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1353 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 150:
-#line 619 "dhcp6_parser.yy" // lalr1.cc:859
+  case 154:
+#line 634 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement("duid", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1344 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1362 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 151:
-#line 624 "dhcp6_parser.yy" // lalr1.cc:859
+  case 155:
+#line 639 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr duid(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(duid);
 }
-#line 1353 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1371 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 152:
-#line 629 "dhcp6_parser.yy" // lalr1.cc:859
+  case 156:
+#line 644 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("host-reservation-identifiers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOST_RESERVATION_IDENTIFIERS);
 }
-#line 1364 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1382 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 153:
-#line 634 "dhcp6_parser.yy" // lalr1.cc:859
+  case 157:
+#line 649 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1373 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1391 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 158:
-#line 647 "dhcp6_parser.yy" // lalr1.cc:859
+  case 162:
+#line 662 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hwaddr(new StringElement("hw-address", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(hwaddr);
 }
-#line 1382 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1400 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 159:
-#line 654 "dhcp6_parser.yy" // lalr1.cc:859
+  case 163:
+#line 669 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay-supplied-options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1393 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1411 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 160:
-#line 659 "dhcp6_parser.yy" // lalr1.cc:859
+  case 164:
+#line 674 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1402 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1420 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 161:
-#line 664 "dhcp6_parser.yy" // lalr1.cc:859
+  case 165:
+#line 679 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hooks-libraries", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.HOOKS_LIBRARIES);
 }
-#line 1413 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1431 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 162:
-#line 669 "dhcp6_parser.yy" // lalr1.cc:859
+  case 166:
+#line 684 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1422 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1440 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 167:
-#line 682 "dhcp6_parser.yy" // lalr1.cc:859
+  case 171:
+#line 697 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1432 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1450 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 168:
-#line 686 "dhcp6_parser.yy" // lalr1.cc:859
+  case 172:
+#line 701 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 1440 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1458 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 169:
-#line 690 "dhcp6_parser.yy" // lalr1.cc:859
+  case 173:
+#line 705 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the hooks-libraries list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1450 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1468 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 170:
-#line 694 "dhcp6_parser.yy" // lalr1.cc:859
+  case 174:
+#line 709 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 1458 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1476 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 176:
-#line 707 "dhcp6_parser.yy" // lalr1.cc:859
+  case 180:
+#line 722 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1466 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1484 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 177:
-#line 709 "dhcp6_parser.yy" // lalr1.cc:859
+  case 181:
+#line 724 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr lib(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("library", lib);
     ctx.leave();
 }
-#line 1476 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1494 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 178:
-#line 715 "dhcp6_parser.yy" // lalr1.cc:859
+  case 182:
+#line 730 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1484 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1502 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 179:
-#line 717 "dhcp6_parser.yy" // lalr1.cc:859
+  case 183:
+#line 732 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("parameters", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 1493 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1511 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 180:
-#line 723 "dhcp6_parser.yy" // lalr1.cc:859
+  case 184:
+#line 738 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("expired-leases-processing", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.EXPIRED_LEASES_PROCESSING);
 }
-#line 1504 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1522 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 181:
-#line 728 "dhcp6_parser.yy" // lalr1.cc:859
+  case 185:
+#line 743 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1513 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1531 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 190:
-#line 745 "dhcp6_parser.yy" // lalr1.cc:859
+  case 195:
+#line 761 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reclaim-timer-wait-time", value);
 }
-#line 1522 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1540 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 191:
-#line 750 "dhcp6_parser.yy" // lalr1.cc:859
+  case 196:
+#line 766 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("flush-reclaimed-timer-wait-time", value);
 }
-#line 1531 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1549 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 192:
-#line 755 "dhcp6_parser.yy" // lalr1.cc:859
+  case 197:
+#line 771 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 }
-#line 1540 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1558 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 193:
-#line 760 "dhcp6_parser.yy" // lalr1.cc:859
+  case 198:
+#line 776 "dhcp6_parser.yy" // lalr1.cc:859
+    {
+    ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
+    ctx.stack_.back()->set("reuse-quarantine-time", value);
+}
+#line 1567 "dhcp6_parser.cc" // lalr1.cc:859
+    break;
+
+  case 199:
+#line 781 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
 }
-#line 1549 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1576 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 194:
-#line 765 "dhcp6_parser.yy" // lalr1.cc:859
+  case 200:
+#line 786 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-reclaim-time", value);
 }
-#line 1558 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1585 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 195:
-#line 770 "dhcp6_parser.yy" // lalr1.cc:859
+  case 201:
+#line 791 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr value(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("unwarned-reclaim-cycles", value);
 }
-#line 1567 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1594 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 196:
-#line 778 "dhcp6_parser.yy" // lalr1.cc:859
+  case 202:
+#line 799 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet6", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.SUBNET6);
 }
-#line 1578 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1605 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 197:
-#line 783 "dhcp6_parser.yy" // lalr1.cc:859
+  case 203:
+#line 804 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1587 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1614 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 202:
-#line 803 "dhcp6_parser.yy" // lalr1.cc:859
+  case 208:
+#line 824 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1597 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1624 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 203:
-#line 807 "dhcp6_parser.yy" // lalr1.cc:859
+  case 209:
+#line 828 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Once we reached this place, the subnet parsing is now complete.
     // If we want to, we can implement default values here.
@@ -1616,1458 +1643,1458 @@ namespace isc { namespace dhcp {
     // }
     ctx.stack_.pop_back();
 }
-#line 1620 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1647 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 204:
-#line 826 "dhcp6_parser.yy" // lalr1.cc:859
+  case 210:
+#line 847 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the subnet6 list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1630 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1657 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 205:
-#line 830 "dhcp6_parser.yy" // lalr1.cc:859
+  case 211:
+#line 851 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 1638 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1665 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 225:
-#line 859 "dhcp6_parser.yy" // lalr1.cc:859
+  case 231:
+#line 880 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1646 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1673 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 226:
-#line 861 "dhcp6_parser.yy" // lalr1.cc:859
+  case 232:
+#line 882 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr subnet(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("subnet", subnet);
     ctx.leave();
 }
-#line 1656 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1683 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 227:
-#line 867 "dhcp6_parser.yy" // lalr1.cc:859
+  case 233:
+#line 888 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1664 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1691 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 228:
-#line 869 "dhcp6_parser.yy" // lalr1.cc:859
+  case 234:
+#line 890 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface", iface);
     ctx.leave();
 }
-#line 1674 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1701 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 229:
-#line 875 "dhcp6_parser.yy" // lalr1.cc:859
+  case 235:
+#line 896 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1682 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1709 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 230:
-#line 877 "dhcp6_parser.yy" // lalr1.cc:859
+  case 236:
+#line 898 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr iface(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("interface-id", iface);
     ctx.leave();
 }
-#line 1692 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1719 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 231:
-#line 883 "dhcp6_parser.yy" // lalr1.cc:859
+  case 237:
+#line 904 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.CLIENT_CLASS);
 }
-#line 1700 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1727 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 232:
-#line 885 "dhcp6_parser.yy" // lalr1.cc:859
+  case 238:
+#line 906 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr cls(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-class", cls);
     ctx.leave();
 }
-#line 1710 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1737 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 233:
-#line 891 "dhcp6_parser.yy" // lalr1.cc:859
+  case 239:
+#line 912 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1718 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1745 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 234:
-#line 893 "dhcp6_parser.yy" // lalr1.cc:859
+  case 240:
+#line 914 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rm(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservation-mode", rm);
     ctx.leave();
 }
-#line 1728 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1755 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 235:
-#line 899 "dhcp6_parser.yy" // lalr1.cc:859
+  case 241:
+#line 920 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("id", id);
 }
-#line 1737 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1764 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 236:
-#line 904 "dhcp6_parser.yy" // lalr1.cc:859
+  case 242:
+#line 925 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rc(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("rapid-commit", rc);
 }
-#line 1746 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1773 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 237:
-#line 913 "dhcp6_parser.yy" // lalr1.cc:859
+  case 243:
+#line 934 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-def", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DEF);
 }
-#line 1757 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1784 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 238:
-#line 918 "dhcp6_parser.yy" // lalr1.cc:859
+  case 244:
+#line 939 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1766 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1793 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 243:
-#line 935 "dhcp6_parser.yy" // lalr1.cc:859
+  case 249:
+#line 956 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1776 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1803 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 244:
-#line 939 "dhcp6_parser.yy" // lalr1.cc:859
+  case 250:
+#line 960 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 1784 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1811 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 245:
-#line 946 "dhcp6_parser.yy" // lalr1.cc:859
+  case 251:
+#line 967 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the option-def list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1794 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1821 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 246:
-#line 950 "dhcp6_parser.yy" // lalr1.cc:859
+  case 252:
+#line 971 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 1802 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1829 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 260:
-#line 976 "dhcp6_parser.yy" // lalr1.cc:859
+  case 266:
+#line 997 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr code(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("code", code);
 }
-#line 1811 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1838 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 262:
-#line 983 "dhcp6_parser.yy" // lalr1.cc:859
+  case 268:
+#line 1004 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1819 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1846 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 263:
-#line 985 "dhcp6_parser.yy" // lalr1.cc:859
+  case 269:
+#line 1006 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("type", prf);
     ctx.leave();
 }
-#line 1829 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1856 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 264:
-#line 991 "dhcp6_parser.yy" // lalr1.cc:859
+  case 270:
+#line 1012 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1837 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1864 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 265:
-#line 993 "dhcp6_parser.yy" // lalr1.cc:859
+  case 271:
+#line 1014 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr rtypes(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("record-types", rtypes);
     ctx.leave();
 }
-#line 1847 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1874 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 266:
-#line 999 "dhcp6_parser.yy" // lalr1.cc:859
+  case 272:
+#line 1020 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1855 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1882 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 267:
-#line 1001 "dhcp6_parser.yy" // lalr1.cc:859
+  case 273:
+#line 1022 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("space", space);
     ctx.leave();
 }
-#line 1865 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1892 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 269:
-#line 1009 "dhcp6_parser.yy" // lalr1.cc:859
+  case 275:
+#line 1030 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1873 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1900 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 270:
-#line 1011 "dhcp6_parser.yy" // lalr1.cc:859
+  case 276:
+#line 1032 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr encap(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("encapsulate", encap);
     ctx.leave();
 }
-#line 1883 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1910 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 271:
-#line 1017 "dhcp6_parser.yy" // lalr1.cc:859
+  case 277:
+#line 1038 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr array(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("array", array);
 }
-#line 1892 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1919 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 272:
-#line 1026 "dhcp6_parser.yy" // lalr1.cc:859
+  case 278:
+#line 1047 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("option-data", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OPTION_DATA);
 }
-#line 1903 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1930 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 273:
-#line 1031 "dhcp6_parser.yy" // lalr1.cc:859
+  case 279:
+#line 1052 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1912 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1939 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 278:
-#line 1050 "dhcp6_parser.yy" // lalr1.cc:859
+  case 284:
+#line 1071 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 1922 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1949 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 279:
-#line 1054 "dhcp6_parser.yy" // lalr1.cc:859
+  case 285:
+#line 1075 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 1930 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1957 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 280:
-#line 1061 "dhcp6_parser.yy" // lalr1.cc:859
+  case 286:
+#line 1082 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the option-data list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 1940 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1967 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 281:
-#line 1065 "dhcp6_parser.yy" // lalr1.cc:859
+  case 287:
+#line 1086 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 1948 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1975 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 293:
-#line 1094 "dhcp6_parser.yy" // lalr1.cc:859
+  case 299:
+#line 1115 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 1956 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1983 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 294:
-#line 1096 "dhcp6_parser.yy" // lalr1.cc:859
+  case 300:
+#line 1117 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr data(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("data", data);
     ctx.leave();
 }
-#line 1966 "dhcp6_parser.cc" // lalr1.cc:859
+#line 1993 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 297:
-#line 1106 "dhcp6_parser.yy" // lalr1.cc:859
+  case 303:
+#line 1127 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr space(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("csv-format", space);
 }
-#line 1975 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2002 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 298:
-#line 1114 "dhcp6_parser.yy" // lalr1.cc:859
+  case 304:
+#line 1135 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.POOLS);
 }
-#line 1986 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2013 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 299:
-#line 1119 "dhcp6_parser.yy" // lalr1.cc:859
+  case 305:
+#line 1140 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 1995 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2022 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 304:
-#line 1134 "dhcp6_parser.yy" // lalr1.cc:859
+  case 310:
+#line 1155 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2005 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2032 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 305:
-#line 1138 "dhcp6_parser.yy" // lalr1.cc:859
+  case 311:
+#line 1159 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 2013 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2040 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 306:
-#line 1142 "dhcp6_parser.yy" // lalr1.cc:859
+  case 312:
+#line 1163 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2023 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2050 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 307:
-#line 1146 "dhcp6_parser.yy" // lalr1.cc:859
+  case 313:
+#line 1167 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 2031 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2058 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 314:
-#line 1160 "dhcp6_parser.yy" // lalr1.cc:859
+  case 320:
+#line 1181 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2039 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2066 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 315:
-#line 1162 "dhcp6_parser.yy" // lalr1.cc:859
+  case 321:
+#line 1183 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr pool(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pool", pool);
     ctx.leave();
 }
-#line 2049 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2076 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 316:
-#line 1168 "dhcp6_parser.yy" // lalr1.cc:859
+  case 322:
+#line 1189 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2057 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2084 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 317:
-#line 1170 "dhcp6_parser.yy" // lalr1.cc:859
+  case 323:
+#line 1191 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("user-context", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2066 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2093 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 318:
-#line 1178 "dhcp6_parser.yy" // lalr1.cc:859
+  case 324:
+#line 1199 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("pd-pools", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.PD_POOLS);
 }
-#line 2077 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2104 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 319:
-#line 1183 "dhcp6_parser.yy" // lalr1.cc:859
+  case 325:
+#line 1204 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2086 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2113 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 324:
-#line 1198 "dhcp6_parser.yy" // lalr1.cc:859
+  case 330:
+#line 1219 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2096 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2123 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 325:
-#line 1202 "dhcp6_parser.yy" // lalr1.cc:859
+  case 331:
+#line 1223 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 2104 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2131 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 326:
-#line 1206 "dhcp6_parser.yy" // lalr1.cc:859
+  case 332:
+#line 1227 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the pd-pool list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2114 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2141 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 327:
-#line 1210 "dhcp6_parser.yy" // lalr1.cc:859
+  case 333:
+#line 1231 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 2122 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2149 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 338:
-#line 1228 "dhcp6_parser.yy" // lalr1.cc:859
+  case 344:
+#line 1249 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2130 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2157 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 339:
-#line 1230 "dhcp6_parser.yy" // lalr1.cc:859
+  case 345:
+#line 1251 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix", prf);
     ctx.leave();
 }
-#line 2140 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2167 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 340:
-#line 1236 "dhcp6_parser.yy" // lalr1.cc:859
+  case 346:
+#line 1257 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefix-len", prf);
 }
-#line 2149 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2176 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 341:
-#line 1241 "dhcp6_parser.yy" // lalr1.cc:859
+  case 347:
+#line 1262 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2157 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2184 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 342:
-#line 1243 "dhcp6_parser.yy" // lalr1.cc:859
+  case 348:
+#line 1264 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix", prf);
     ctx.leave();
 }
-#line 2167 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2194 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 343:
-#line 1249 "dhcp6_parser.yy" // lalr1.cc:859
+  case 349:
+#line 1270 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr prf(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("excluded-prefix-len", prf);
 }
-#line 2176 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2203 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 344:
-#line 1254 "dhcp6_parser.yy" // lalr1.cc:859
+  case 350:
+#line 1275 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr deleg(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("delegated-len", deleg);
 }
-#line 2185 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2212 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 345:
-#line 1262 "dhcp6_parser.yy" // lalr1.cc:859
+  case 351:
+#line 1283 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("reservations", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.RESERVATIONS);
 }
-#line 2196 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2223 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 346:
-#line 1267 "dhcp6_parser.yy" // lalr1.cc:859
+  case 352:
+#line 1288 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2205 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2232 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 351:
-#line 1280 "dhcp6_parser.yy" // lalr1.cc:859
+  case 357:
+#line 1301 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2215 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2242 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 352:
-#line 1284 "dhcp6_parser.yy" // lalr1.cc:859
+  case 358:
+#line 1305 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 2223 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2250 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 353:
-#line 1288 "dhcp6_parser.yy" // lalr1.cc:859
+  case 359:
+#line 1309 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the reservations list entry map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2233 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2260 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 354:
-#line 1292 "dhcp6_parser.yy" // lalr1.cc:859
+  case 360:
+#line 1313 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 2241 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2268 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 367:
-#line 1315 "dhcp6_parser.yy" // lalr1.cc:859
+  case 373:
+#line 1336 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-addresses", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2252 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2279 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 368:
-#line 1320 "dhcp6_parser.yy" // lalr1.cc:859
+  case 374:
+#line 1341 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2261 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2288 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 369:
-#line 1325 "dhcp6_parser.yy" // lalr1.cc:859
+  case 375:
+#line 1346 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("prefixes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2272 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2299 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 370:
-#line 1330 "dhcp6_parser.yy" // lalr1.cc:859
+  case 376:
+#line 1351 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2281 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2308 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 371:
-#line 1335 "dhcp6_parser.yy" // lalr1.cc:859
+  case 377:
+#line 1356 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2289 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2316 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 372:
-#line 1337 "dhcp6_parser.yy" // lalr1.cc:859
+  case 378:
+#line 1358 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr d(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("duid", d);
     ctx.leave();
 }
-#line 2299 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2326 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 373:
-#line 1343 "dhcp6_parser.yy" // lalr1.cc:859
+  case 379:
+#line 1364 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2307 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2334 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 374:
-#line 1345 "dhcp6_parser.yy" // lalr1.cc:859
+  case 380:
+#line 1366 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr hw(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hw-address", hw);
     ctx.leave();
 }
-#line 2317 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2344 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 375:
-#line 1351 "dhcp6_parser.yy" // lalr1.cc:859
+  case 381:
+#line 1372 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2325 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2352 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 376:
-#line 1353 "dhcp6_parser.yy" // lalr1.cc:859
+  case 382:
+#line 1374 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr host(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("hostname", host);
     ctx.leave();
 }
-#line 2335 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2362 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 377:
-#line 1359 "dhcp6_parser.yy" // lalr1.cc:859
+  case 383:
+#line 1380 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr c(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", c);
     ctx.stack_.push_back(c);
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2346 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2373 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 378:
-#line 1364 "dhcp6_parser.yy" // lalr1.cc:859
+  case 384:
+#line 1385 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2355 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2382 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 379:
-#line 1372 "dhcp6_parser.yy" // lalr1.cc:859
+  case 385:
+#line 1393 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("relay", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.RELAY);
 }
-#line 2366 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2393 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 380:
-#line 1377 "dhcp6_parser.yy" // lalr1.cc:859
+  case 386:
+#line 1398 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2375 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2402 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 381:
-#line 1382 "dhcp6_parser.yy" // lalr1.cc:859
+  case 387:
+#line 1403 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2383 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2410 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 382:
-#line 1384 "dhcp6_parser.yy" // lalr1.cc:859
+  case 388:
+#line 1405 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr ip(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ip-address", ip);
     ctx.leave();
 }
-#line 2393 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2420 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 383:
-#line 1393 "dhcp6_parser.yy" // lalr1.cc:859
+  case 389:
+#line 1414 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("client-classes", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.CLIENT_CLASSES);
 }
-#line 2404 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2431 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 384:
-#line 1398 "dhcp6_parser.yy" // lalr1.cc:859
+  case 390:
+#line 1419 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2413 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2440 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 387:
-#line 1407 "dhcp6_parser.yy" // lalr1.cc:859
+  case 393:
+#line 1428 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 2423 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2450 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 388:
-#line 1411 "dhcp6_parser.yy" // lalr1.cc:859
+  case 394:
+#line 1432 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 2431 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2458 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 398:
-#line 1431 "dhcp6_parser.yy" // lalr1.cc:859
+  case 404:
+#line 1452 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2439 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2466 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 399:
-#line 1433 "dhcp6_parser.yy" // lalr1.cc:859
+  case 405:
+#line 1454 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr test(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("test", test);
     ctx.leave();
 }
-#line 2449 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2476 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 400:
-#line 1442 "dhcp6_parser.yy" // lalr1.cc:859
+  case 406:
+#line 1463 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-id", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.SERVER_ID);
 }
-#line 2460 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2487 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 401:
-#line 1447 "dhcp6_parser.yy" // lalr1.cc:859
+  case 407:
+#line 1468 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2469 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2496 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 411:
-#line 1465 "dhcp6_parser.yy" // lalr1.cc:859
+  case 417:
+#line 1486 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.DUID_TYPE);
 }
-#line 2477 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2504 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 412:
-#line 1467 "dhcp6_parser.yy" // lalr1.cc:859
+  case 418:
+#line 1488 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("type", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2486 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2513 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 413:
-#line 1472 "dhcp6_parser.yy" // lalr1.cc:859
+  case 419:
+#line 1493 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LLT", ctx.loc2pos(yystack_[0].location))); }
-#line 2492 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2519 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 414:
-#line 1473 "dhcp6_parser.yy" // lalr1.cc:859
+  case 420:
+#line 1494 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("EN", ctx.loc2pos(yystack_[0].location))); }
-#line 2498 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2525 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 415:
-#line 1474 "dhcp6_parser.yy" // lalr1.cc:859
+  case 421:
+#line 1495 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("LL", ctx.loc2pos(yystack_[0].location))); }
-#line 2504 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2531 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 416:
-#line 1477 "dhcp6_parser.yy" // lalr1.cc:859
+  case 422:
+#line 1498 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr htype(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("htype", htype);
 }
-#line 2513 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2540 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 417:
-#line 1482 "dhcp6_parser.yy" // lalr1.cc:859
+  case 423:
+#line 1503 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2521 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2548 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 418:
-#line 1484 "dhcp6_parser.yy" // lalr1.cc:859
+  case 424:
+#line 1505 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr id(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("identifier", id);
     ctx.leave();
 }
-#line 2531 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2558 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 419:
-#line 1490 "dhcp6_parser.yy" // lalr1.cc:859
+  case 425:
+#line 1511 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("time", time);
 }
-#line 2540 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2567 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 420:
-#line 1495 "dhcp6_parser.yy" // lalr1.cc:859
+  case 426:
+#line 1516 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enterprise-id", time);
 }
-#line 2549 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2576 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 421:
-#line 1502 "dhcp6_parser.yy" // lalr1.cc:859
+  case 427:
+#line 1523 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr time(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp4o6-port", time);
 }
-#line 2558 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2585 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 422:
-#line 1509 "dhcp6_parser.yy" // lalr1.cc:859
+  case 428:
+#line 1530 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("control-socket", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.CONTROL_SOCKET);
 }
-#line 2569 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2596 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 423:
-#line 1514 "dhcp6_parser.yy" // lalr1.cc:859
+  case 429:
+#line 1535 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2578 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2605 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 428:
-#line 1527 "dhcp6_parser.yy" // lalr1.cc:859
+  case 434:
+#line 1548 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2586 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2613 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 429:
-#line 1529 "dhcp6_parser.yy" // lalr1.cc:859
+  case 435:
+#line 1550 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr stype(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-type", stype);
     ctx.leave();
 }
-#line 2596 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2623 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 430:
-#line 1535 "dhcp6_parser.yy" // lalr1.cc:859
+  case 436:
+#line 1556 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2604 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2631 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 431:
-#line 1537 "dhcp6_parser.yy" // lalr1.cc:859
+  case 437:
+#line 1558 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr name(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("socket-name", name);
     ctx.leave();
 }
-#line 2614 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2641 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 432:
-#line 1545 "dhcp6_parser.yy" // lalr1.cc:859
+  case 438:
+#line 1566 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("dhcp-ddns", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.DHCP_DDNS);
 }
-#line 2625 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2652 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 433:
-#line 1550 "dhcp6_parser.yy" // lalr1.cc:859
+  case 439:
+#line 1571 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2634 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2661 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 434:
-#line 1555 "dhcp6_parser.yy" // lalr1.cc:859
+  case 440:
+#line 1576 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // Parse the dhcp-ddns map
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.push_back(m);
 }
-#line 2644 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2671 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 435:
-#line 1559 "dhcp6_parser.yy" // lalr1.cc:859
+  case 441:
+#line 1580 "dhcp6_parser.yy" // lalr1.cc:859
     {
     // parsing completed
 }
-#line 2652 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2679 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 453:
-#line 1584 "dhcp6_parser.yy" // lalr1.cc:859
+  case 459:
+#line 1605 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("enable-updates", b);
 }
-#line 2661 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2688 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 454:
-#line 1589 "dhcp6_parser.yy" // lalr1.cc:859
+  case 460:
+#line 1610 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2669 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2696 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 455:
-#line 1591 "dhcp6_parser.yy" // lalr1.cc:859
+  case 461:
+#line 1612 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("qualifying-suffix", s);
     ctx.leave();
 }
-#line 2679 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2706 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 456:
-#line 1597 "dhcp6_parser.yy" // lalr1.cc:859
+  case 462:
+#line 1618 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2687 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2714 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 457:
-#line 1599 "dhcp6_parser.yy" // lalr1.cc:859
+  case 463:
+#line 1620 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-ip", s);
     ctx.leave();
 }
-#line 2697 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2724 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 458:
-#line 1605 "dhcp6_parser.yy" // lalr1.cc:859
+  case 464:
+#line 1626 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("server-port", i);
 }
-#line 2706 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2733 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 459:
-#line 1610 "dhcp6_parser.yy" // lalr1.cc:859
+  case 465:
+#line 1631 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2714 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2741 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 460:
-#line 1612 "dhcp6_parser.yy" // lalr1.cc:859
+  case 466:
+#line 1633 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-ip", s);
     ctx.leave();
 }
-#line 2724 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2751 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 461:
-#line 1618 "dhcp6_parser.yy" // lalr1.cc:859
+  case 467:
+#line 1639 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("sender-port", i);
 }
-#line 2733 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2760 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 462:
-#line 1623 "dhcp6_parser.yy" // lalr1.cc:859
+  case 468:
+#line 1644 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr i(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("max-queue-size", i);
 }
-#line 2742 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2769 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 463:
-#line 1628 "dhcp6_parser.yy" // lalr1.cc:859
+  case 469:
+#line 1649 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_PROTOCOL);
 }
-#line 2750 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2777 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 464:
-#line 1630 "dhcp6_parser.yy" // lalr1.cc:859
+  case 470:
+#line 1651 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("ncr-protocol", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2759 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2786 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 465:
-#line 1636 "dhcp6_parser.yy" // lalr1.cc:859
+  case 471:
+#line 1657 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("UDP", ctx.loc2pos(yystack_[0].location))); }
-#line 2765 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2792 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 466:
-#line 1637 "dhcp6_parser.yy" // lalr1.cc:859
+  case 472:
+#line 1658 "dhcp6_parser.yy" // lalr1.cc:859
     { yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("TCP", ctx.loc2pos(yystack_[0].location))); }
-#line 2771 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2798 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 467:
-#line 1640 "dhcp6_parser.yy" // lalr1.cc:859
+  case 473:
+#line 1661 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NCR_FORMAT);
 }
-#line 2779 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2806 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 468:
-#line 1642 "dhcp6_parser.yy" // lalr1.cc:859
+  case 474:
+#line 1663 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr json(new StringElement("JSON", ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("ncr-format", json);
     ctx.leave();
 }
-#line 2789 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2816 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 469:
-#line 1648 "dhcp6_parser.yy" // lalr1.cc:859
+  case 475:
+#line 1669 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("always-include-fqdn", b);
 }
-#line 2798 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2825 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 470:
-#line 1653 "dhcp6_parser.yy" // lalr1.cc:859
+  case 476:
+#line 1674 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-no-update", b);
 }
-#line 2807 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2834 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 471:
-#line 1658 "dhcp6_parser.yy" // lalr1.cc:859
+  case 477:
+#line 1679 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr b(new BoolElement(yystack_[0].value.as< bool > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("override-client-update", b);
 }
-#line 2816 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2843 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 472:
-#line 1663 "dhcp6_parser.yy" // lalr1.cc:859
+  case 478:
+#line 1684 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.REPLACE_CLIENT_NAME);
 }
-#line 2824 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2851 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 473:
-#line 1665 "dhcp6_parser.yy" // lalr1.cc:859
+  case 479:
+#line 1686 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("replace-client-name", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2833 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2860 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 474:
-#line 1671 "dhcp6_parser.yy" // lalr1.cc:859
+  case 480:
+#line 1692 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-present", ctx.loc2pos(yystack_[0].location))); 
       }
-#line 2841 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2868 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 475:
-#line 1674 "dhcp6_parser.yy" // lalr1.cc:859
+  case 481:
+#line 1695 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("never", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2849 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2876 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 476:
-#line 1677 "dhcp6_parser.yy" // lalr1.cc:859
+  case 482:
+#line 1698 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("always", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2857 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2884 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 477:
-#line 1680 "dhcp6_parser.yy" // lalr1.cc:859
+  case 483:
+#line 1701 "dhcp6_parser.yy" // lalr1.cc:859
     {
       yylhs.value.as< ElementPtr > () = ElementPtr(new StringElement("when-not-present", ctx.loc2pos(yystack_[0].location)));
       }
-#line 2865 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2892 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 478:
-#line 1683 "dhcp6_parser.yy" // lalr1.cc:859
+  case 484:
+#line 1704 "dhcp6_parser.yy" // lalr1.cc:859
     {
       error(yystack_[0].location, "boolean values for the replace-client-name are "
                 "no longer supported");
       }
-#line 2874 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2901 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 479:
-#line 1689 "dhcp6_parser.yy" // lalr1.cc:859
+  case 485:
+#line 1710 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2882 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2909 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 480:
-#line 1691 "dhcp6_parser.yy" // lalr1.cc:859
+  case 486:
+#line 1712 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr s(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("generated-prefix", s);
     ctx.leave();
 }
-#line 2892 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2919 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 481:
-#line 1699 "dhcp6_parser.yy" // lalr1.cc:859
+  case 487:
+#line 1720 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2900 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2927 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 482:
-#line 1701 "dhcp6_parser.yy" // lalr1.cc:859
+  case 488:
+#line 1722 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("Dhcp4", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2909 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2936 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 483:
-#line 1706 "dhcp6_parser.yy" // lalr1.cc:859
+  case 489:
+#line 1727 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 2917 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2944 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 484:
-#line 1708 "dhcp6_parser.yy" // lalr1.cc:859
+  case 490:
+#line 1729 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.back()->set("DhcpDdns", yystack_[0].value.as< ElementPtr > ());
     ctx.leave();
 }
-#line 2926 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2953 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 485:
-#line 1718 "dhcp6_parser.yy" // lalr1.cc:859
+  case 491:
+#line 1739 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("Logging", m);
     ctx.stack_.push_back(m);
     ctx.enter(ctx.LOGGING);
 }
-#line 2937 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2964 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 486:
-#line 1723 "dhcp6_parser.yy" // lalr1.cc:859
+  case 492:
+#line 1744 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2946 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2973 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 490:
-#line 1740 "dhcp6_parser.yy" // lalr1.cc:859
+  case 496:
+#line 1761 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("loggers", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.LOGGERS);
 }
-#line 2957 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2984 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 491:
-#line 1745 "dhcp6_parser.yy" // lalr1.cc:859
+  case 497:
+#line 1766 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 2966 "dhcp6_parser.cc" // lalr1.cc:859
+#line 2993 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 494:
-#line 1757 "dhcp6_parser.yy" // lalr1.cc:859
+  case 500:
+#line 1778 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(l);
     ctx.stack_.push_back(l);
 }
-#line 2976 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3003 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 495:
-#line 1761 "dhcp6_parser.yy" // lalr1.cc:859
+  case 501:
+#line 1782 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 2984 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3011 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 503:
-#line 1776 "dhcp6_parser.yy" // lalr1.cc:859
+  case 509:
+#line 1797 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr dl(new IntElement(yystack_[0].value.as< int64_t > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("debuglevel", dl);
 }
-#line 2993 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3020 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 504:
-#line 1781 "dhcp6_parser.yy" // lalr1.cc:859
+  case 510:
+#line 1802 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3001 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3028 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 505:
-#line 1783 "dhcp6_parser.yy" // lalr1.cc:859
+  case 511:
+#line 1804 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("severity", sev);
     ctx.leave();
 }
-#line 3011 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3038 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 506:
-#line 1789 "dhcp6_parser.yy" // lalr1.cc:859
+  case 512:
+#line 1810 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr l(new ListElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output_options", l);
     ctx.stack_.push_back(l);
     ctx.enter(ctx.OUTPUT_OPTIONS);
 }
-#line 3022 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3049 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 507:
-#line 1794 "dhcp6_parser.yy" // lalr1.cc:859
+  case 513:
+#line 1815 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
     ctx.leave();
 }
-#line 3031 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3058 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 510:
-#line 1803 "dhcp6_parser.yy" // lalr1.cc:859
+  case 516:
+#line 1824 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr m(new MapElement(ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->add(m);
     ctx.stack_.push_back(m);
 }
-#line 3041 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3068 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 511:
-#line 1807 "dhcp6_parser.yy" // lalr1.cc:859
+  case 517:
+#line 1828 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.stack_.pop_back();
 }
-#line 3049 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3076 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 514:
-#line 1815 "dhcp6_parser.yy" // lalr1.cc:859
+  case 520:
+#line 1836 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ctx.enter(ctx.NO_KEYWORD);
 }
-#line 3057 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3084 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
-  case 515:
-#line 1817 "dhcp6_parser.yy" // lalr1.cc:859
+  case 521:
+#line 1838 "dhcp6_parser.yy" // lalr1.cc:859
     {
     ElementPtr sev(new StringElement(yystack_[0].value.as< std::string > (), ctx.loc2pos(yystack_[0].location)));
     ctx.stack_.back()->set("output", sev);
     ctx.leave();
 }
-#line 3067 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3094 "dhcp6_parser.cc" // lalr1.cc:859
     break;
 
 
-#line 3071 "dhcp6_parser.cc" // lalr1.cc:859
+#line 3098 "dhcp6_parser.cc" // lalr1.cc:859
             default:
               break;
             }
@@ -3329,92 +3356,94 @@ namespace isc { namespace dhcp {
   const short int
   Dhcp6Parser::yypact_[] =
   {
-      63,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,    50,    19,    67,   116,   122,   131,   137,
-     148,   150,   195,   196,   213,   214,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+     111,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,    29,    19,    26,    34,    82,   126,   140,
+     142,   153,   161,   181,   249,   265,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-      19,   -51,    17,    31,    92,    23,    -8,    48,   104,    32,
-      -5,   -28,   107,  -486,   259,   249,   254,   276,   269,  -486,
-    -486,  -486,  -486,   281,  -486,    83,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,   282,   288,   289,   291,   293,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   295,
-    -486,  -486,  -486,   118,  -486,  -486,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,   296,  -486,  -486,
-    -486,  -486,  -486,  -486,   297,   308,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,   119,  -486,  -486,  -486,  -486,
+      19,  -107,    17,    31,   104,    23,    51,    -5,    70,    59,
+      -4,     8,   112,  -486,   190,   203,   282,   255,   263,  -486,
+    -486,  -486,  -486,   288,  -486,    69,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,   289,   291,   293,   295,   296,  -486,
+    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   297,
+    -486,  -486,  -486,    85,  -486,  -486,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,   127,  -486,  -486,  -486,  -486,   309,  -486,
-     310,   311,  -486,  -486,  -486,   129,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,  -486,  -486,  -486,   304,  -486,  -486,
+    -486,  -486,  -486,  -486,   300,   309,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,  -486,   107,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-     312,   313,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,   314,  -486,  -486,  -486,   315,  -486,  -486,   316,   319,
+    -486,  -486,  -486,   109,  -486,  -486,  -486,  -486,   310,  -486,
+     311,   312,  -486,  -486,  -486,   110,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,   321,  -486,  -486,  -486,  -486,   318,   320,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,   161,  -486,  -486,
-    -486,   323,  -486,  -486,   324,  -486,   325,   326,  -486,  -486,
-     327,   328,   329,  -486,  -486,  -486,   216,  -486,  -486,  -486,
+     314,   315,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,   313,  -486,  -486,  -486,   316,  -486,  -486,   317,   320,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,    19,    19,  -486,   157,   330,   331,   332,
-     333,  -486,    17,  -486,   334,   335,   336,   160,   177,   201,
-     202,   203,   340,   341,   342,   343,   344,   345,   346,   347,
-     348,   349,   215,   350,   352,    31,  -486,   353,  -486,    -6,
-     354,   355,   356,   357,   358,   223,   222,   361,   362,   363,
-     364,    23,  -486,   365,   366,    -8,  -486,   367,   234,   368,
-     235,   237,    48,  -486,   369,   372,   374,   375,   376,   377,
-    -486,   104,   378,   379,   244,   381,   382,   383,   247,  -486,
-      32,   384,   250,  -486,    -5,   386,   387,   -36,  -486,   251,
-     390,   391,   261,   392,   262,   263,   395,   396,   265,   266,
-     267,   400,   401,   107,  -486,  -486,  -486,   402,   403,   404,
-      19,    19,  -486,   405,   406,   407,  -486,  -486,  -486,  -486,
-    -486,   410,   411,   412,   413,   414,   415,   416,   417,   418,
-     421,  -486,   422,   425,  -486,   419,  -486,  -486,  -486,  -486,
-     426,   420,  -486,  -486,  -486,   428,   430,   299,   301,   302,
-    -486,  -486,   303,   304,   431,   438,  -486,   307,   440,  -486,
-     317,  -486,   322,  -486,  -486,  -486,   419,   419,   419,   337,
-     338,   339,  -486,   351,   359,  -486,   360,   370,   371,  -486,
-    -486,   373,  -486,  -486,   380,    19,  -486,  -486,   385,   388,
-    -486,   389,  -486,  -486,   -55,   393,  -486,  -486,  -486,    -3,
-     394,  -486,    19,    31,   397,  -486,  -486,    92,   125,   125,
-     442,   443,   444,   -32,    19,    95,    44,   445,    98,    28,
-     179,   107,  -486,  -486,   449,  -486,    -6,   447,   448,  -486,
-    -486,  -486,  -486,  -486,   450,   399,  -486,  -486,  -486,  -486,
+    -486,   322,  -486,  -486,  -486,  -486,   319,   321,  -486,  -486,
+    -486,  -486,  -486,  -486,  -486,  -486,  -486,   122,  -486,  -486,
+    -486,   324,  -486,  -486,   325,  -486,   326,   327,  -486,  -486,
+     328,   329,   330,  -486,  -486,  -486,   163,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,    19,    19,  -486,   177,   331,   332,   333,
+     334,  -486,    17,  -486,   335,   336,   337,   200,   201,   204,
+     205,   206,   338,   341,   342,   346,   347,   348,   349,   350,
+     351,   352,   214,   354,   355,    31,  -486,   356,  -486,    -8,
+     357,   358,   359,   360,   361,   223,   222,   364,   365,   366,
+     367,    23,  -486,   368,   369,    51,  -486,   370,   232,   372,
+     234,   235,    -5,  -486,   375,   376,   377,   378,   379,   380,
+    -486,    70,   381,   382,   244,   384,   385,   386,   246,  -486,
+      59,   388,   248,  -486,    -4,   390,   391,   150,  -486,   251,
+     395,   396,   258,   398,   260,   261,   401,   402,   264,   266,
+     267,   403,   404,   112,  -486,  -486,  -486,   406,   407,   408,
+      19,    19,  -486,   409,   410,   411,  -486,  -486,  -486,  -486,
+    -486,   414,   415,   416,   417,   418,   419,   420,   423,   422,
+     425,  -486,   426,   427,  -486,   430,  -486,  -486,  -486,  -486,
+     405,   433,  -486,  -486,  -486,   435,   436,   301,   303,   305,
+    -486,  -486,   307,   308,   437,   431,  -486,   318,   439,  -486,
+     323,  -486,   339,  -486,  -486,  -486,   430,   430,   430,   340,
+     343,   344,  -486,   345,   353,  -486,   362,   363,   371,  -486,
+    -486,   373,  -486,  -486,   374,    19,  -486,  -486,   383,   387,
+    -486,   389,  -486,  -486,   -55,   392,  -486,  -486,  -486,    90,
+     393,  -486,    19,    31,   394,  -486,  -486,   104,   154,   154,
+     444,   445,   446,   -18,    19,   202,    46,   447,    71,    28,
+     186,   112,  -486,  -486,   451,  -486,    -8,   449,   450,  -486,
+    -486,  -486,  -486,  -486,   452,   397,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-     219,  -486,   220,  -486,  -486,   451,  -486,  -486,  -486,  -486,
-     456,   458,   459,   460,   461,  -486,  -486,  -486,   226,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,   229,  -486,   462,   463,  -486,  -486,   464,   466,
-    -486,  -486,   465,   471,  -486,  -486,  -486,    81,  -486,  -486,
-    -486,   469,  -486,  -486,   102,  -486,  -486,  -486,   256,  -486,
-     473,   477,  -486,   478,   479,   480,   481,   482,   483,   230,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   484,
-     487,   488,  -486,  -486,   232,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,   233,  -486,  -486,  -486,   236,   398,   408,
-    -486,  -486,   475,   490,  -486,  -486,   489,   491,  -486,  -486,
-     494,   493,  -486,  -486,   495,  -486,   497,   397,  -486,  -486,
-     498,   500,   501,   502,   409,   423,   424,   427,   432,   504,
-     507,   125,  -486,  -486,    23,  -486,   442,    32,  -486,   443,
-      -5,  -486,   444,   -32,  -486,  -486,    95,  -486,    44,  -486,
-     -28,  -486,   445,   433,   434,   435,   436,   437,   439,    98,
-    -486,   509,   510,   441,   446,   452,    28,  -486,   511,   512,
-     179,  -486,  -486,  -486,   514,   515,  -486,    -8,  -486,   447,
-      48,  -486,   448,   104,  -486,   450,   517,  -486,   492,  -486,
-     292,   429,   454,   455,  -486,  -486,  -486,  -486,  -486,   457,
-     467,  -486,   239,  -486,   518,  -486,   521,  -486,  -486,  -486,
-    -486,   242,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-      97,   468,  -486,  -486,  -486,  -486,   470,   472,  -486,  -486,
-     474,   245,  -486,   246,  -486,   522,  -486,   476,   516,  -486,
+     164,  -486,   183,  -486,  -486,   453,  -486,  -486,  -486,  -486,
+     458,   459,   460,   462,   463,   464,   465,  -486,  -486,  -486,
+     189,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,  -486,  -486,   192,  -486,   468,   467,
+    -486,  -486,   469,   473,  -486,  -486,   471,   475,  -486,  -486,
+    -486,    72,  -486,  -486,  -486,   474,  -486,  -486,    73,  -486,
+    -486,  -486,   123,  -486,   477,   476,  -486,   480,   484,   486,
+     487,   488,   489,   490,   195,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,  -486,   492,   493,   494,  -486,  -486,
+     196,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   199,
+    -486,  -486,  -486,   224,   399,   400,  -486,  -486,   495,   496,
+    -486,  -486,   497,   499,  -486,  -486,   500,   504,  -486,  -486,
+     502,  -486,   507,   394,  -486,  -486,   508,   510,   514,   515,
+     412,   413,   421,   424,   428,   429,   432,   516,   517,   154,
+    -486,  -486,    23,  -486,   444,    59,  -486,   445,    -4,  -486,
+     446,   -18,  -486,  -486,   202,  -486,    46,  -486,     8,  -486,
+     447,   434,   438,   440,   441,   442,   443,   448,    71,  -486,
+     518,   519,   454,   455,   456,    28,  -486,   520,   522,   186,
+    -486,  -486,  -486,   521,   505,  -486,    51,  -486,   449,    -5,
+    -486,   450,    70,  -486,   452,   524,  -486,   466,  -486,   292,
+     461,   470,   472,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+     478,   479,  -486,   228,  -486,   525,  -486,   526,  -486,  -486,
+    -486,  -486,   250,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,   148,   481,  -486,  -486,  -486,  -486,   482,   483,
+    -486,  -486,   503,   252,  -486,   256,  -486,   528,  -486,   506,
+     523,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,   260,  -486,    65,   516,
-    -486,  -486,   527,  -486,  -486,  -486,   248,  -486,  -486,  -486,
-    -486,  -486,   528,   486,   530,    65,  -486,   520,  -486,   485,
-    -486,   529,  -486,  -486,   264,  -486,   496,   529,  -486,  -486,
-     252,  -486,  -486,   531,   496,  -486,   503,  -486,  -486
+    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,   129,  -486,
+      63,   523,  -486,  -486,   533,  -486,  -486,  -486,   259,  -486,
+    -486,  -486,  -486,  -486,   534,   457,   535,    63,  -486,   527,
+    -486,   509,  -486,   536,  -486,  -486,   145,  -486,   485,   536,
+    -486,  -486,   262,  -486,  -486,   540,   485,  -486,   511,  -486,
+    -486
   };
 
   const unsigned short int
@@ -3424,126 +3453,128 @@ namespace isc { namespace dhcp {
       20,    22,    24,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     1,    41,    34,    30,
       29,    26,    27,    28,    33,     3,    31,    32,    54,     5,
-      65,     7,    98,     9,   204,    11,   306,    13,   326,    15,
-     353,    17,   245,    19,   280,    21,   169,    23,   434,    25,
-      43,    37,     0,     0,     0,     0,     0,     0,   355,   247,
-     282,     0,     0,    45,     0,    44,     0,     0,    38,    63,
-     485,   481,   483,     0,    62,     0,    56,    58,    60,    61,
-      59,    96,   102,   104,     0,     0,     0,     0,     0,   196,
-     237,   272,   144,   159,   152,   383,   161,   180,   400,     0,
-     422,   432,    90,     0,    67,    69,    70,    71,    72,    73,
+      65,     7,    98,     9,   210,    11,   312,    13,   332,    15,
+     359,    17,   251,    19,   286,    21,   173,    23,   440,    25,
+      43,    37,     0,     0,     0,     0,     0,     0,   361,   253,
+     288,     0,     0,    45,     0,    44,     0,     0,    38,    63,
+     491,   487,   489,     0,    62,     0,    56,    58,    60,    61,
+      59,    96,   102,   104,     0,     0,     0,     0,     0,   202,
+     243,   278,   148,   163,   156,   389,   165,   184,   406,     0,
+     428,   438,    90,     0,    67,    69,    70,    71,    72,    73,
       75,    76,    77,    78,    80,    79,    84,    85,    74,    82,
-      83,    81,    86,    87,    88,    89,   100,     0,   387,   298,
-     318,   225,   227,   229,     0,     0,   233,   231,   345,   379,
-     224,   208,   209,   210,   211,     0,   206,   215,   216,   217,
-     220,   222,   218,   219,   212,   213,   214,   221,   223,   314,
-     316,   313,   311,     0,   308,   310,   312,   338,     0,   341,
-       0,     0,   337,   333,   336,     0,   328,   330,   331,   334,
-     335,   332,   377,   367,   369,   371,   373,   375,   366,   365,
-       0,   356,   357,   361,   362,   359,   363,   364,   360,   262,
-     134,     0,   266,   264,   269,     0,   258,   259,     0,   248,
-     249,   251,   261,   252,   253,   254,   268,   255,   256,   257,
-     293,     0,   291,   292,   295,   296,     0,   283,   284,   286,
-     287,   288,   289,   290,   176,   178,   173,     0,   171,   174,
-     175,     0,   454,   456,     0,   459,     0,     0,   463,   467,
-       0,     0,     0,   472,   479,   452,     0,   436,   438,   439,
-     440,   441,   442,   443,   444,   445,   446,   447,   448,   449,
-     450,   451,    42,     0,     0,    35,     0,     0,     0,     0,
+      83,    81,    86,    87,    88,    89,   100,     0,   393,   304,
+     324,   231,   233,   235,     0,     0,   239,   237,   351,   385,
+     230,   214,   215,   216,   217,     0,   212,   221,   222,   223,
+     226,   228,   224,   225,   218,   219,   220,   227,   229,   320,
+     322,   319,   317,     0,   314,   316,   318,   344,     0,   347,
+       0,     0,   343,   339,   342,     0,   334,   336,   337,   340,
+     341,   338,   383,   373,   375,   377,   379,   381,   372,   371,
+       0,   362,   363,   367,   368,   365,   369,   370,   366,   268,
+     136,     0,   272,   270,   275,     0,   264,   265,     0,   254,
+     255,   257,   267,   258,   259,   260,   274,   261,   262,   263,
+     299,     0,   297,   298,   301,   302,     0,   289,   290,   292,
+     293,   294,   295,   296,   180,   182,   177,     0,   175,   178,
+     179,     0,   460,   462,     0,   465,     0,     0,   469,   473,
+       0,     0,     0,   478,   485,   458,     0,   442,   444,   445,
+     446,   447,   448,   449,   450,   451,   452,   453,   454,   455,
+     456,   457,    42,     0,     0,    35,     0,     0,     0,     0,
        0,    53,     0,    55,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,    66,     0,    99,   389,
+       0,     0,     0,     0,     0,     0,    66,     0,    99,   395,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   205,     0,     0,     0,   307,     0,     0,     0,
-       0,     0,     0,   327,     0,     0,     0,     0,     0,     0,
-     354,     0,     0,     0,     0,     0,     0,     0,     0,   246,
-       0,     0,     0,   281,     0,     0,     0,     0,   170,     0,
+       0,     0,   211,     0,     0,     0,   313,     0,     0,     0,
+       0,     0,     0,   333,     0,     0,     0,     0,     0,     0,
+     360,     0,     0,     0,     0,     0,     0,     0,     0,   252,
+       0,     0,     0,   287,     0,     0,     0,     0,   174,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   435,    46,    39,     0,     0,     0,
+       0,     0,     0,     0,   441,    46,    39,     0,     0,     0,
        0,     0,    57,     0,     0,     0,    91,    92,    93,    94,
       95,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,   421,     0,     0,    68,     0,   398,   396,   397,   395,
-       0,   390,   391,   393,   394,     0,     0,     0,     0,     0,
-     235,   236,     0,     0,     0,     0,   207,     0,     0,   309,
-       0,   340,     0,   343,   344,   329,     0,     0,     0,     0,
-       0,     0,   358,     0,     0,   260,     0,     0,     0,   271,
-     250,     0,   297,   285,     0,     0,   172,   453,     0,     0,
-     458,     0,   461,   462,     0,     0,   469,   470,   471,     0,
-       0,   437,     0,     0,     0,   482,   484,     0,     0,     0,
-     198,   239,   274,     0,    43,     0,     0,   163,     0,     0,
-       0,     0,    47,   101,     0,   388,     0,   300,   320,   226,
-     228,   230,   234,   232,   347,     0,   315,    36,   317,   339,
-     342,   378,   368,   370,   372,   374,   376,   263,   135,   267,
-     265,   270,   294,   177,   179,   455,   457,   460,   465,   466,
-     464,   468,   474,   475,   476,   477,   478,   473,   480,    40,
-       0,   490,     0,   487,   489,     0,   121,   127,   129,   131,
-       0,     0,     0,     0,     0,   140,   142,   120,     0,   106,
-     108,   109,   110,   111,   112,   113,   114,   115,   116,   117,
-     118,   119,     0,   202,     0,   199,   200,   243,     0,   240,
-     241,   278,     0,   275,   276,   150,   151,     0,   146,   148,
-     149,     0,   158,   156,     0,   154,   157,   385,     0,   167,
-       0,   164,   165,     0,     0,     0,     0,     0,     0,     0,
-     182,   184,   185,   186,   187,   188,   189,   411,   417,     0,
-       0,     0,   410,   409,     0,   402,   404,   407,   405,   406,
-     408,   428,   430,     0,   424,   426,   427,     0,    49,     0,
-     392,   304,     0,   301,   302,   324,     0,   321,   322,   351,
-       0,   348,   349,   381,     0,    64,     0,     0,   486,    97,
+       0,   427,     0,     0,    68,     0,   404,   402,   403,   401,
+       0,   396,   397,   399,   400,     0,     0,     0,     0,     0,
+     241,   242,     0,     0,     0,     0,   213,     0,     0,   315,
+       0,   346,     0,   349,   350,   335,     0,     0,     0,     0,
+       0,     0,   364,     0,     0,   266,     0,     0,     0,   277,
+     256,     0,   303,   291,     0,     0,   176,   459,     0,     0,
+     464,     0,   467,   468,     0,     0,   475,   476,   477,     0,
+       0,   443,     0,     0,     0,   488,   490,     0,     0,     0,
+     204,   245,   280,     0,    43,     0,     0,   167,     0,     0,
+       0,     0,    47,   101,     0,   394,     0,   306,   326,   232,
+     234,   236,   240,   238,   353,     0,   321,    36,   323,   345,
+     348,   384,   374,   376,   378,   380,   382,   269,   137,   273,
+     271,   276,   300,   181,   183,   461,   463,   466,   471,   472,
+     470,   474,   480,   481,   482,   483,   484,   479,   486,    40,
+       0,   496,     0,   493,   495,     0,   123,   129,   131,   133,
+       0,     0,     0,     0,     0,     0,     0,   144,   146,   122,
+       0,   106,   108,   109,   110,   111,   112,   113,   114,   115,
+     116,   117,   118,   119,   120,   121,     0,   208,     0,   205,
+     206,   249,     0,   246,   247,   284,     0,   281,   282,   154,
+     155,     0,   150,   152,   153,     0,   162,   160,     0,   158,
+     161,   391,     0,   171,     0,   168,   169,     0,     0,     0,
+       0,     0,     0,     0,     0,   186,   188,   189,   190,   191,
+     192,   193,   194,   417,   423,     0,     0,     0,   416,   415,
+       0,   408,   410,   413,   411,   412,   414,   434,   436,     0,
+     430,   432,   433,     0,    49,     0,   398,   310,     0,   307,
+     308,   330,     0,   327,   328,   357,     0,   354,   355,   387,
+       0,    64,     0,     0,   492,    97,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,   103,   105,     0,   197,     0,   247,   238,     0,
-     282,   273,     0,     0,   145,   160,     0,   153,     0,   384,
-       0,   162,     0,     0,     0,     0,     0,     0,     0,     0,
-     181,     0,     0,     0,     0,     0,     0,   401,     0,     0,
-       0,   423,   433,    51,     0,    50,   399,     0,   299,     0,
-       0,   319,     0,   355,   346,     0,     0,   380,     0,   488,
-       0,     0,     0,     0,   133,   136,   137,   138,   139,     0,
-       0,   107,     0,   201,     0,   242,     0,   277,   147,   155,
-     386,     0,   166,   190,   191,   192,   193,   194,   195,   183,
-       0,     0,   416,   419,   420,   403,     0,     0,   425,    48,
-       0,     0,   303,     0,   323,     0,   350,     0,     0,   123,
-     124,   125,   126,   122,   128,   130,   132,   141,   143,   203,
-     244,   279,   168,   413,   414,   415,   412,   418,   429,   431,
-      52,   305,   325,   352,   382,   494,     0,   492,     0,     0,
-     491,   506,     0,   504,   502,   498,     0,   496,   500,   501,
-     499,   493,     0,     0,     0,     0,   495,     0,   503,     0,
-     497,     0,   505,   510,     0,   508,     0,     0,   507,   514,
-       0,   512,   509,     0,     0,   511,     0,   513,   515
+     103,   105,     0,   203,     0,   253,   244,     0,   288,   279,
+       0,     0,   149,   164,     0,   157,     0,   390,     0,   166,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,   185,
+       0,     0,     0,     0,     0,     0,   407,     0,     0,     0,
+     429,   439,    51,     0,    50,   405,     0,   305,     0,     0,
+     325,     0,   361,   352,     0,     0,   386,     0,   494,     0,
+       0,     0,     0,   135,   138,   139,   140,   141,   142,   143,
+       0,     0,   107,     0,   207,     0,   248,     0,   283,   151,
+     159,   392,     0,   170,   195,   196,   197,   198,   199,   200,
+     201,   187,     0,     0,   422,   425,   426,   409,     0,     0,
+     431,    48,     0,     0,   309,     0,   329,     0,   356,     0,
+       0,   125,   126,   127,   128,   124,   130,   132,   134,   145,
+     147,   209,   250,   285,   172,   419,   420,   421,   418,   424,
+     435,   437,    52,   311,   331,   358,   388,   500,     0,   498,
+       0,     0,   497,   512,     0,   510,   508,   504,     0,   502,
+     506,   507,   505,   499,     0,     0,     0,     0,   501,     0,
+     509,     0,   503,     0,   511,   516,     0,   514,     0,     0,
+     513,   520,     0,   518,   515,     0,     0,   517,     0,   519,
+     521
   };
 
   const short int
   Dhcp6Parser::yypgoto_[] =
   {
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,     7,  -486,    29,  -486,  -486,  -486,
-    -486,  -486,  -486,    45,  -486,  -169,  -486,  -486,  -486,   -62,
-    -486,  -486,  -486,   253,  -486,  -486,  -486,  -486,    39,   225,
-     -63,   -50,   -49,   -43,  -486,  -486,  -486,  -486,  -486,    51,
-    -486,  -486,  -486,  -486,  -486,    52,  -139,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,     7,  -486,    62,  -486,  -486,  -486,
+    -486,  -486,  -486,    52,  -486,  -169,  -486,  -486,  -486,   -62,
+    -486,  -486,  -486,   253,  -486,  -486,  -486,  -486,    57,   233,
+     -63,   -50,   -49,   -43,  -486,  -486,  -486,  -486,  -486,    60,
+    -486,  -486,  -486,  -486,  -486,    61,  -140,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,   -58,  -486,  -485,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -150,  -470,  -486,  -486,  -486,  -486,  -152,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -156,  -486,  -486,  -486,  -149,   181,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -159,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -134,  -486,
-    -486,  -486,  -131,   224,  -486,  -486,  -486,  -486,  -486,  -486,
-    -473,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -135,  -486,  -486,  -486,  -130,  -486,   198,  -486,   -59,  -486,
-    -486,  -486,  -486,  -486,   -57,  -486,  -486,  -486,  -486,  -486,
-     -48,  -486,  -486,  -486,  -136,  -486,  -486,  -486,  -129,  -486,
-     199,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -170,  -486,  -486,  -486,  -167,   227,  -486,  -486,   -66,
-    -486,  -486,  -486,  -486,  -486,  -166,  -486,  -486,  -486,  -163,
-     228,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -164,  -486,  -486,  -486,  -155,  -486,   231,  -486,
+    -486,  -486,  -150,  -470,  -486,  -486,  -486,  -486,  -152,  -486,
+    -486,  -486,  -486,  -486,  -486,  -486,  -157,  -486,  -486,  -486,
+    -154,   193,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -162,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -137,  -486,  -486,  -486,  -133,   230,  -486,  -486,  -486,
+    -486,  -486,  -486,  -473,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -135,  -486,  -486,  -486,  -132,  -486,   207,
+    -486,   -59,  -486,  -486,  -486,  -486,  -486,   -57,  -486,  -486,
+    -486,  -486,  -486,   -48,  -486,  -486,  -486,  -134,  -486,  -486,
+    -486,  -130,  -486,   209,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,  -173,  -486,  -486,  -486,  -166,   239,
+    -486,  -486,   -66,  -486,  -486,  -486,  -486,  -486,  -165,  -486,
+    -486,  -486,  -161,   237,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,  -486,  -164,  -486,  -486,  -486,  -160,
+    -486,   236,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,    74,  -486,  -486,  -486,  -486,  -486,  -486,  -133,  -486,
+    -486,  -486,  -486,  -486,    83,  -486,  -486,  -486,  -486,  -486,
+    -486,  -131,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,  -486,  -141,  -486,  -486,  -486,  -486,  -486,
+    -486,  -486,  -486,    89,   210,  -486,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -132,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-      84,   204,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
     -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,  -486,
-    -486,  -486,   -83,  -486,  -486,  -486,  -230,  -486,  -486,  -245,
-    -486,  -486,  -486,  -486,  -486,  -486,  -256,  -486,  -486,  -259,
-    -486
+    -486,  -486,  -486,  -486,  -486,   -81,  -486,  -486,  -486,  -236,
+    -486,  -486,  -251,  -486,  -486,  -486,  -486,  -486,  -486,  -258,
+    -486,  -486,  -264,  -486
   };
 
   const short int
@@ -3551,120 +3582,121 @@ namespace isc { namespace dhcp {
   {
       -1,    13,    14,    15,    16,    17,    18,    19,    20,    21,
       22,    23,    24,    25,    73,    35,    36,    61,   518,    77,
-      78,    37,    60,    74,    75,   503,   648,   724,   725,   112,
+      78,    37,    60,    74,    75,   503,   654,   733,   734,   112,
       39,    62,    85,    86,    87,   287,    41,    63,   113,   114,
      115,   116,   117,   118,   119,   120,   294,    43,    64,   137,
-     317,   121,   295,   122,   296,   568,   569,   570,   670,   793,
-     571,   671,   572,   672,   573,   673,   574,   217,   353,   576,
-     577,   578,   579,   580,   679,   581,   680,   123,   305,   597,
-     598,   599,   600,   124,   307,   604,   605,   606,   125,   306,
-     126,   309,   610,   611,   612,   700,    57,    71,   247,   248,
-     249,   365,   250,   366,   127,   310,   619,   620,   621,   622,
-     623,   624,   625,   626,   128,   302,   584,   585,   586,   684,
-      45,    65,   155,   156,   157,   322,   158,   323,   159,   324,
-     160,   328,   161,   327,   162,   163,   129,   303,   588,   589,
-     590,   687,    53,    69,   218,   219,   220,   221,   222,   223,
-     224,   352,   225,   356,   226,   355,   227,   228,   357,   229,
-     130,   304,   592,   593,   594,   690,    55,    70,   236,   237,
-     238,   239,   240,   361,   241,   242,   243,   165,   320,   652,
-     653,   654,   727,    47,    66,   173,   174,   175,   333,   176,
-     334,   166,   321,   656,   657,   658,   730,    49,    67,   185,
-     186,   187,   337,   188,   189,   339,   190,   191,   167,   329,
-     660,   661,   662,   733,    51,    68,   200,   201,   202,   203,
-     345,   204,   346,   205,   347,   206,   348,   207,   349,   208,
-     344,   168,   330,   664,   736,   131,   308,   608,   319,   420,
-     421,   422,   423,   424,   504,   132,   311,   634,   635,   636,
-     711,   806,   637,   638,   712,   639,   640,   133,   134,   313,
-     643,   644,   645,   718,   646,   719,   135,   314,    59,    72,
-     266,   267,   268,   269,   370,   270,   371,   271,   272,   373,
-     273,   274,   275,   376,   540,   276,   377,   277,   278,   279,
-     280,   381,   547,   281,   382,    88,   289,    89,   290,    90,
-     288,   552,   553,   554,   666,   816,   817,   818,   826,   827,
-     828,   829,   834,   830,   832,   844,   845,   846,   850,   851,
-     853
+     317,   121,   295,   122,   296,   570,   571,   572,   676,   805,
+     573,   677,   574,   678,   575,   679,   576,   217,   353,   578,
+     579,   580,   581,   582,   583,   584,   687,   585,   688,   123,
+     305,   601,   602,   603,   604,   124,   307,   608,   609,   610,
+     125,   306,   126,   309,   614,   615,   616,   708,    57,    71,
+     247,   248,   249,   365,   250,   366,   127,   310,   624,   625,
+     626,   627,   628,   629,   630,   631,   632,   128,   302,   588,
+     589,   590,   692,    45,    65,   155,   156,   157,   322,   158,
+     323,   159,   324,   160,   328,   161,   327,   162,   163,   129,
+     303,   592,   593,   594,   695,    53,    69,   218,   219,   220,
+     221,   222,   223,   224,   352,   225,   356,   226,   355,   227,
+     228,   357,   229,   130,   304,   596,   597,   598,   698,    55,
+      70,   236,   237,   238,   239,   240,   361,   241,   242,   243,
+     165,   320,   658,   659,   660,   736,    47,    66,   173,   174,
+     175,   333,   176,   334,   166,   321,   662,   663,   664,   739,
+      49,    67,   185,   186,   187,   337,   188,   189,   339,   190,
+     191,   167,   329,   666,   667,   668,   742,    51,    68,   200,
+     201,   202,   203,   345,   204,   346,   205,   347,   206,   348,
+     207,   349,   208,   344,   168,   330,   670,   745,   131,   308,
+     612,   319,   420,   421,   422,   423,   424,   504,   132,   311,
+     640,   641,   642,   720,   818,   643,   644,   721,   645,   646,
+     133,   134,   313,   649,   650,   651,   727,   652,   728,   135,
+     314,    59,    72,   266,   267,   268,   269,   370,   270,   371,
+     271,   272,   373,   273,   274,   275,   376,   540,   276,   377,
+     277,   278,   279,   280,   381,   547,   281,   382,    88,   289,
+      89,   290,    90,   288,   552,   553,   554,   672,   828,   829,
+     830,   838,   839,   840,   841,   846,   842,   844,   856,   857,
+     858,   862,   863,   865
   };
 
   const unsigned short int
   Dhcp6Parser::yytable_[] =
   {
       84,   184,   151,   150,   171,   182,   198,   216,   232,   246,
-     265,   234,   233,   235,   633,   152,   153,   164,   172,   183,
-     199,    34,   154,   607,    27,   603,    28,    79,    29,   101,
-     138,   101,   210,   210,   230,   211,   212,   231,   595,   169,
-     244,   245,    91,   627,    92,    93,   170,   209,   244,   245,
-      26,   138,   561,    94,    95,    96,    97,   538,   539,   416,
-     101,    94,    95,    96,    97,    98,    99,   100,   101,   139,
-     210,   140,   211,   212,    38,   213,   214,   215,   141,   142,
-     143,   144,   145,   146,   693,   101,   292,   694,    76,   147,
-     148,   293,   102,   103,   104,   105,   149,   177,   178,   179,
-     180,   181,   170,   210,   136,   696,   106,   596,   697,   107,
-     147,    83,   542,   543,   544,   545,   108,   628,   629,   630,
-     631,   315,   331,    40,   109,   110,   316,   332,   111,    42,
-     335,    83,   342,    83,    83,   336,    80,   343,    44,   546,
-     556,   101,    81,    82,    46,   557,   558,   559,   560,   561,
-     562,   563,   564,   565,   566,    48,    83,    50,    30,    31,
-      32,    33,    83,   210,   367,   595,   602,    83,   192,   368,
-      83,    83,   193,   194,   195,   196,   197,   613,   614,   615,
-     616,   617,   618,   803,   804,   805,   821,    83,   822,   823,
-       1,     2,     3,     4,     5,     6,     7,     8,     9,    10,
-      11,    12,    52,    54,    83,   251,   252,   253,   254,   255,
-     256,   257,   258,   259,   260,   261,   262,   263,   264,   383,
-      56,    58,   315,   667,   384,   760,   603,   665,   668,   681,
-      84,   633,   681,   709,   682,   716,   720,   683,   710,   383,
-     717,   721,   331,    83,   722,   367,    83,   799,   335,   342,
-     802,   835,   283,   811,   812,   854,   836,   417,   284,   698,
-     855,   418,   699,   819,    83,   282,   820,   847,   151,   150,
-     848,   419,   286,   171,   641,   642,   184,   521,   522,   523,
-     182,   152,   153,   164,   285,   291,   297,   172,   154,   198,
-     385,   386,   298,   299,   183,   300,   387,   301,   216,   312,
-     396,   325,   232,   199,   318,   234,   233,   235,   789,   790,
-     791,   792,   326,   338,   340,   341,   351,   397,   354,   358,
-     350,   265,   360,   364,   359,   362,   363,   369,   372,   374,
-     375,   378,   379,   380,   388,   389,   390,   391,   393,   394,
-     395,   398,   399,   400,   401,   402,   403,   404,   405,   406,
-     407,   408,   409,   410,   412,   411,   413,   415,   425,   426,
-     427,   428,   429,   430,   431,   432,   433,   434,   435,   437,
-     438,   440,   442,   446,   441,   443,   447,   444,   448,   449,
-     450,   451,   453,   454,   455,   456,   457,   458,   461,   459,
-     464,   465,   462,   467,   468,   469,   471,   485,   486,   474,
-     475,   470,   472,   473,   479,   480,   482,   476,   477,   478,
-     483,   484,   487,   488,   489,   490,   491,   492,   493,   494,
-     495,   496,   497,   506,   502,   498,   567,   567,   499,   500,
-     575,   575,   501,   507,   505,   508,   514,   632,   509,   265,
-     510,   511,   512,   513,   417,   515,   516,    28,   418,   583,
-     587,   591,   609,   649,   651,   655,   519,   659,   419,   669,
-     674,   520,   675,   676,   677,   678,   686,   517,   685,   689,
-     688,   691,   534,   663,   692,   695,   524,   525,   526,   701,
-     702,   728,   703,   704,   705,   706,   707,   708,   713,   549,
-     527,   714,   715,   729,   732,   731,   735,   788,   528,   529,
-     734,   738,   740,   737,   741,   742,   743,   541,   749,   530,
-     531,   750,   532,   770,   771,   776,   777,   551,   780,   533,
-     779,   787,   550,   815,   535,   841,   800,   536,   537,   801,
-     813,   833,   837,   548,   839,   856,   843,   723,   555,   601,
-     414,   582,   751,   758,   759,   392,   762,   726,   466,   744,
-     769,   761,   753,   752,   755,   436,   757,   754,   460,   782,
-     781,   756,   439,   463,   746,   745,   784,   783,   794,   747,
-     445,   786,   748,   763,   764,   765,   766,   767,   785,   768,
-     650,   772,   452,   775,   739,   647,   773,   481,   778,   831,
-     840,   852,   774,   795,   796,   857,   797,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   798,   807,     0,   808,
-       0,   809,     0,   810,     0,   814,     0,     0,   849,   567,
-       0,   151,   150,   575,   842,   216,   838,     0,   232,     0,
-       0,   234,   233,   235,   152,   153,   164,     0,   246,     0,
-       0,   154,   858,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   632,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,   184,   171,     0,     0,   182,     0,
-       0,   198,     0,     0,     0,     0,     0,     0,     0,   172,
-       0,     0,   183,     0,     0,   199,     0,     0,     0,     0,
+     265,   234,   233,   235,   639,   152,   153,   164,   172,   183,
+     199,    34,   154,   611,    27,   607,    28,    79,    29,    26,
+     138,   101,   210,    38,   101,    76,   210,   230,   211,   212,
+     231,    40,    91,   633,    92,    93,   177,   178,   179,   180,
+     181,   170,   561,   138,   599,    94,    95,    96,    97,   416,
+     538,   539,   101,    94,    95,    96,    97,    98,    99,   100,
+     101,   139,   292,   140,   209,   701,   704,   293,   702,   705,
+     141,   142,   143,   144,   145,   146,   244,   245,   315,    42,
+     101,   147,   148,   316,   102,   103,   104,   105,   149,   210,
+     169,   211,   212,   210,   213,   214,   215,   170,   106,   101,
+     331,   107,   335,   342,   147,   332,   136,   336,   343,   108,
+     634,   635,   636,   637,   600,   367,   706,   109,   110,   707,
+     368,   111,   831,    44,    83,   832,   192,    83,    83,    80,
+     193,   194,   195,   196,   197,    81,    82,    46,   859,    48,
+      83,   860,   617,   618,   619,   620,   621,   622,   623,    83,
+      50,    30,    31,    32,    33,    83,   383,   315,    52,   556,
+      83,   384,   671,    83,   557,   558,   559,   560,   561,   562,
+     563,   564,   565,   566,   567,   568,   673,   833,    54,   834,
+     835,   674,   689,    83,   210,   689,   282,   690,   718,   725,
+     691,    83,   729,   719,   726,    83,   283,   730,   542,   543,
+     544,   545,    83,   251,   252,   253,   254,   255,   256,   257,
+     258,   259,   260,   261,   262,   263,   264,   383,   244,   245,
+      84,   331,   731,   771,   607,   546,   811,   815,   816,   817,
+     639,     1,     2,     3,     4,     5,     6,     7,     8,     9,
+      10,    11,    12,   367,    83,   335,    56,   417,   814,   342,
+     823,   418,   847,   285,   824,   866,   286,   848,   151,   150,
+     867,   419,    58,   171,   599,   606,   184,   521,   522,   523,
+     182,   152,   153,   164,   647,   648,   284,   172,   154,   198,
+     385,   386,   291,   297,   183,   298,    83,   299,   216,   300,
+     301,   312,   232,   199,   325,   234,   233,   235,   801,   802,
+     803,   804,   318,   326,   338,   340,   341,   354,   351,   387,
+     358,   265,   350,   360,   364,   359,   362,   363,   369,   372,
+     374,   375,   378,   379,   380,   388,   389,   390,   391,   393,
+     394,   395,   401,   396,   397,   402,   403,   398,   399,   400,
+     404,   405,   406,   407,   408,   409,   410,   411,   412,   413,
+     415,   425,   426,   427,   428,   429,   430,   431,   432,   433,
+     434,   435,   437,   438,   440,   441,   442,   443,   444,   446,
+     447,   448,   449,   450,   451,   453,   454,   455,   456,   457,
+     458,   459,   461,   462,   464,   465,   467,   485,   486,   468,
+     469,   470,   471,   472,   473,   474,   475,   479,   480,   476,
+     482,   477,   478,   505,   483,   484,   487,   488,   489,   490,
+     491,   492,   493,   494,   495,   496,   569,   569,   497,   498,
+     577,   577,   499,   500,   501,   502,   506,   638,   515,   265,
+     507,   508,   514,   509,   417,   510,    28,   511,   418,   512,
+     513,   587,   591,   595,   613,   655,   657,   661,   419,   665,
+     516,   675,   680,   681,   682,   519,   683,   684,   685,   686,
+     694,   800,   534,   669,   693,   696,   697,   699,   700,   710,
+     703,   520,   524,   709,   711,   525,   526,   527,   712,   549,
+     713,   714,   715,   716,   717,   528,   722,   723,   724,   738,
+     517,   737,   741,   740,   529,   530,   743,   744,   792,   541,
+     746,   747,   749,   531,   750,   532,   533,   551,   751,   752,
+     760,   761,   782,   783,   788,   535,   789,   791,   799,   536,
+     827,   537,   853,   812,   813,   548,   825,   845,   849,   851,
+     550,   732,   735,   855,   868,   392,   605,   555,   414,   762,
+     586,   769,   770,   773,   772,   753,   781,   764,   754,   763,
+     466,   436,   766,   765,   755,   794,   768,   460,   767,   756,
+     793,   757,   758,   463,   439,   759,   796,   774,   795,   445,
+     798,   775,   797,   776,   777,   778,   779,   452,   790,   656,
+     653,   780,   748,   481,   787,   843,   852,   784,   785,   786,
+     850,   864,   869,   806,     0,     0,     0,     0,     0,     0,
+     861,     0,   807,     0,   808,     0,     0,     0,     0,     0,
+     809,   810,     0,   819,   820,   821,     0,   569,     0,   151,
+     150,   577,     0,   216,     0,     0,   232,     0,     0,   234,
+     233,   235,   152,   153,   164,   822,   246,     0,   826,   154,
+       0,   854,     0,   870,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   638,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,   184,   171,     0,     0,   182,     0,     0,
+     198,     0,     0,     0,     0,     0,     0,     0,   172,     0,
+       0,   183,     0,     0,   199,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
        0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     0,     0,     0,   824,     0,     0,     0,
-     825,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,   824,     0,     0,     0,   825
+       0,     0,     0,     0,     0,     0,     0,     0,   836,     0,
+       0,     0,   837,     0,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     0,     0,   836,     0,     0,     0,   837
   };
 
   const short int
@@ -3672,230 +3704,234 @@ namespace isc { namespace dhcp {
   {
       62,    67,    65,    65,    66,    67,    68,    69,    70,    71,
       72,    70,    70,    70,   499,    65,    65,    65,    66,    67,
-      68,    14,    65,   496,     5,   495,     7,    10,     9,    37,
-       7,    37,    38,    38,    39,    40,    41,    42,    70,    47,
-      76,    77,    11,    15,    13,    14,    54,    15,    76,    77,
-       0,     7,    24,    30,    31,    32,    33,   112,   113,    65,
-      37,    30,    31,    32,    33,    34,    35,    36,    37,    46,
-      38,    48,    40,    41,     7,    43,    44,    45,    55,    56,
-      57,    58,    59,    60,     3,    37,     3,     6,   139,    66,
-      67,     8,    61,    62,    63,    64,    73,    49,    50,    51,
-      52,    53,    54,    38,    12,     3,    75,   139,     6,    78,
-      66,   139,   115,   116,   117,   118,    85,    89,    90,    91,
-      92,     3,     3,     7,    93,    94,     8,     8,    97,     7,
-       3,   139,     3,   139,   139,     8,   119,     8,     7,   142,
-      15,    37,   125,   126,     7,    20,    21,    22,    23,    24,
-      25,    26,    27,    28,    29,     7,   139,     7,   139,   140,
-     141,   142,   139,    38,     3,    70,    71,   139,    64,     8,
-     139,   139,    68,    69,    70,    71,    72,    79,    80,    81,
-      82,    83,    84,    86,    87,    88,   121,   139,   123,   124,
-     127,   128,   129,   130,   131,   132,   133,   134,   135,   136,
-     137,   138,     7,     7,   139,    98,    99,   100,   101,   102,
-     103,   104,   105,   106,   107,   108,   109,   110,   111,     3,
-       7,     7,     3,     3,     8,   698,   696,     8,     8,     3,
-     292,   716,     3,     3,     8,     3,     3,     8,     8,     3,
-       8,     8,     3,   139,     8,     3,   139,     8,     3,     3,
-       8,     3,     3,     8,     8,     3,     8,   319,     4,     3,
-       8,   319,     6,     3,   139,     6,     6,     3,   331,   331,
-       6,   319,     3,   335,    95,    96,   342,   446,   447,   448,
-     342,   331,   331,   331,     8,     4,     4,   335,   331,   351,
-     283,   284,     4,     4,   342,     4,   139,     4,   360,     4,
-     140,     4,   364,   351,     8,   364,   364,   364,    16,    17,
-      18,    19,     4,     4,     4,     4,     3,   140,     4,     4,
-       8,   383,     3,     3,     8,     4,     8,     4,     4,     4,
+      68,    14,    65,   496,     5,   495,     7,    10,     9,     0,
+       7,    39,    40,     7,    39,   142,    40,    41,    42,    43,
+      44,     7,    11,    15,    13,    14,    51,    52,    53,    54,
+      55,    56,    24,     7,    72,    32,    33,    34,    35,    67,
+     115,   116,    39,    32,    33,    34,    35,    36,    37,    38,
+      39,    48,     3,    50,    15,     3,     3,     8,     6,     6,
+      57,    58,    59,    60,    61,    62,    78,    79,     3,     7,
+      39,    68,    69,     8,    63,    64,    65,    66,    75,    40,
+      49,    42,    43,    40,    45,    46,    47,    56,    77,    39,
+       3,    80,     3,     3,    68,     8,    12,     8,     8,    88,
+      92,    93,    94,    95,   142,     3,     3,    96,    97,     6,
+       8,   100,     3,     7,   142,     6,    66,   142,   142,   122,
+      70,    71,    72,    73,    74,   128,   129,     7,     3,     7,
+     142,     6,    81,    82,    83,    84,    85,    86,    87,   142,
+       7,   142,   143,   144,   145,   142,     3,     3,     7,    15,
+     142,     8,     8,   142,    20,    21,    22,    23,    24,    25,
+      26,    27,    28,    29,    30,    31,     3,   124,     7,   126,
+     127,     8,     3,   142,    40,     3,     6,     8,     3,     3,
+       8,   142,     3,     8,     8,   142,     3,     8,   118,   119,
+     120,   121,   142,   101,   102,   103,   104,   105,   106,   107,
+     108,   109,   110,   111,   112,   113,   114,     3,    78,    79,
+     292,     3,     8,   706,   704,   145,     8,    89,    90,    91,
+     725,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,     3,   142,     3,     7,   319,     8,     3,
+       8,   319,     3,     8,     8,     3,     3,     8,   331,   331,
+       8,   319,     7,   335,    72,    73,   342,   446,   447,   448,
+     342,   331,   331,   331,    98,    99,     4,   335,   331,   351,
+     283,   284,     4,     4,   342,     4,   142,     4,   360,     4,
+       4,     4,   364,   351,     4,   364,   364,   364,    16,    17,
+      18,    19,     8,     4,     4,     4,     4,     4,     3,   142,
+       4,   383,     8,     3,     3,     8,     4,     8,     4,     4,
        4,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   140,   140,   140,     4,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,     4,   140,     4,     4,     4,     4,
-       4,     4,     4,   140,   142,     4,     4,     4,     4,     4,
-       4,     4,     4,     4,   140,   140,     4,   140,     4,     4,
-       4,     4,     4,     4,   140,     4,     4,     4,     4,   142,
-       4,     4,   142,   142,     4,     4,     4,   390,   391,     4,
-       4,   140,   140,   140,     4,     4,     4,   142,   142,   142,
-       7,     7,     7,     7,     7,     5,     5,     5,     5,     5,
-       5,     5,     5,     3,     5,     7,   488,   489,     7,     7,
-     488,   489,     7,     5,     8,     5,     5,   499,   139,   501,
-     139,   139,   139,   139,   506,     7,   139,     7,   506,     7,
-       7,     7,     7,     4,     7,     7,   139,     7,   506,     8,
-       4,   139,     4,     4,     4,     4,     3,   438,     6,     3,
-       6,     6,   465,    74,     3,     6,   139,   139,   139,     6,
-       3,     6,     4,     4,     4,     4,     4,     4,     4,   482,
-     139,     4,     4,     3,     3,     6,     3,     5,   139,   139,
-       6,     4,     4,     8,     4,     4,     4,   114,     4,   139,
-     139,     4,   139,     4,     4,     4,     4,   120,     3,   139,
-       6,     4,   483,     7,   139,     5,     8,   139,   139,     8,
-       8,     4,     4,   139,     4,     4,     7,   139,   487,   494,
-     315,   489,   681,   693,   696,   292,   702,   139,   367,   140,
-     709,   700,   686,   684,   689,   331,   692,   687,   360,   729,
-     727,   690,   335,   364,   140,   142,   732,   730,   139,   142,
-     342,   735,   140,   140,   140,   140,   140,   140,   733,   140,
-     506,   140,   351,   716,   667,   501,   140,   383,   720,   819,
-     835,   847,   140,   139,   139,   854,   139,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   139,   139,    -1,   139,
-      -1,   139,    -1,   139,    -1,   139,    -1,    -1,   122,   681,
-      -1,   684,   684,   681,   139,   687,   140,    -1,   690,    -1,
-      -1,   690,   690,   690,   684,   684,   684,    -1,   700,    -1,
-      -1,   684,   139,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   716,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,   730,   727,    -1,    -1,   730,    -1,
-      -1,   733,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   727,
-      -1,    -1,   730,    -1,    -1,   733,    -1,    -1,    -1,    -1,
+       4,     4,     4,   143,   143,     4,     4,   143,   143,   143,
+       4,     4,     4,     4,     4,     4,     4,   143,     4,     4,
+       4,     4,     4,     4,     4,     4,   143,   145,     4,     4,
+       4,     4,     4,     4,     4,   143,     4,   143,   143,     4,
+       4,     4,     4,     4,     4,     4,     4,   143,     4,     4,
+       4,   145,     4,   145,     4,     4,   145,   390,   391,     4,
+       4,   143,     4,   143,   143,     4,     4,     4,     4,   145,
+       4,   145,   145,     8,     7,     7,     7,     7,     7,     5,
+       5,     5,     5,     5,     5,     5,   488,   489,     5,     7,
+     488,   489,     7,     7,     7,     5,     3,   499,     7,   501,
+       5,     5,     5,   142,   506,   142,     7,   142,   506,   142,
+     142,     7,     7,     7,     7,     4,     7,     7,   506,     7,
+     142,     8,     4,     4,     4,   142,     4,     4,     4,     4,
+       3,     5,   465,    76,     6,     6,     3,     6,     3,     3,
+       6,   142,   142,     6,     4,   142,   142,   142,     4,   482,
+       4,     4,     4,     4,     4,   142,     4,     4,     4,     3,
+     438,     6,     3,     6,   142,   142,     6,     3,     3,   117,
+       8,     4,     4,   142,     4,   142,   142,   123,     4,     4,
+       4,     4,     4,     4,     4,   142,     4,     6,     4,   142,
+       7,   142,     5,     8,     8,   142,     8,     4,     4,     4,
+     483,   142,   142,     7,     4,   292,   494,   487,   315,   689,
+     489,   701,   704,   710,   708,   143,   718,   694,   145,   692,
+     367,   331,   697,   695,   143,   738,   700,   360,   698,   145,
+     736,   143,   143,   364,   335,   143,   741,   143,   739,   342,
+     744,   143,   742,   143,   143,   143,   143,   351,   729,   506,
+     501,   143,   673,   383,   725,   831,   847,   143,   143,   143,
+     143,   859,   866,   142,    -1,    -1,    -1,    -1,    -1,    -1,
+     125,    -1,   142,    -1,   142,    -1,    -1,    -1,    -1,    -1,
+     142,   142,    -1,   142,   142,   142,    -1,   689,    -1,   692,
+     692,   689,    -1,   695,    -1,    -1,   698,    -1,    -1,   698,
+     698,   698,   692,   692,   692,   142,   708,    -1,   142,   692,
+      -1,   142,    -1,   142,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   725,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,   739,   736,    -1,    -1,   739,    -1,    -1,
+     742,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   736,    -1,
+      -1,   739,    -1,    -1,   742,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
       -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,    -1,    -1,    -1,   818,    -1,    -1,    -1,
-     818,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
-      -1,    -1,    -1,   835,    -1,    -1,    -1,   835
+      -1,    -1,    -1,    -1,    -1,    -1,    -1,    -1,   830,    -1,
+      -1,    -1,   830,    -1,    -1,    -1,    -1,    -1,    -1,    -1,
+      -1,    -1,    -1,    -1,    -1,   847,    -1,    -1,    -1,   847
   };
 
   const unsigned short int
   Dhcp6Parser::yystos_[] =
   {
-       0,   127,   128,   129,   130,   131,   132,   133,   134,   135,
-     136,   137,   138,   144,   145,   146,   147,   148,   149,   150,
-     151,   152,   153,   154,   155,   156,     0,     5,     7,     9,
-     139,   140,   141,   142,   157,   158,   159,   164,     7,   173,
-       7,   179,     7,   190,     7,   263,     7,   326,     7,   340,
-       7,   357,     7,   285,     7,   309,     7,   239,     7,   411,
-     165,   160,   174,   180,   191,   264,   327,   341,   358,   286,
-     310,   240,   412,   157,   166,   167,   139,   162,   163,    10,
-     119,   125,   126,   139,   172,   175,   176,   177,   438,   440,
-     442,    11,    13,    14,    30,    31,    32,    33,    34,    35,
-      36,    37,    61,    62,    63,    64,    75,    78,    85,    93,
-      94,    97,   172,   181,   182,   183,   184,   185,   186,   187,
-     188,   194,   196,   220,   226,   231,   233,   247,   257,   279,
-     303,   378,   388,   400,   401,   409,    12,   192,     7,    46,
-      48,    55,    56,    57,    58,    59,    60,    66,    67,    73,
-     172,   183,   184,   185,   186,   265,   266,   267,   269,   271,
-     273,   275,   277,   278,   303,   320,   334,   351,   374,    47,
-      54,   172,   303,   328,   329,   330,   332,    49,    50,    51,
-      52,    53,   172,   303,   332,   342,   343,   344,   346,   347,
-     349,   350,    64,    68,    69,    70,    71,    72,   172,   303,
-     359,   360,   361,   362,   364,   366,   368,   370,   372,    15,
-      38,    40,    41,    43,    44,    45,   172,   210,   287,   288,
-     289,   290,   291,   292,   293,   295,   297,   299,   300,   302,
-      39,    42,   172,   210,   291,   297,   311,   312,   313,   314,
-     315,   317,   318,   319,    76,    77,   172,   241,   242,   243,
-     245,    98,    99,   100,   101,   102,   103,   104,   105,   106,
-     107,   108,   109,   110,   111,   172,   413,   414,   415,   416,
-     418,   420,   421,   423,   424,   425,   428,   430,   431,   432,
-     433,   436,     6,     3,     4,     8,     3,   178,   443,   439,
-     441,     4,     3,     8,   189,   195,   197,     4,     4,     4,
-       4,     4,   258,   280,   304,   221,   232,   227,   379,   234,
-     248,   389,     4,   402,   410,     3,     8,   193,     8,   381,
-     321,   335,   268,   270,   272,     4,     4,   276,   274,   352,
-     375,     3,     8,   331,   333,     3,     8,   345,     4,   348,
-       4,     4,     3,     8,   373,   363,   365,   367,   369,   371,
-       8,     3,   294,   211,     4,   298,   296,   301,     4,     8,
-       3,   316,     4,     8,     3,   244,   246,     3,     8,     4,
-     417,   419,     4,   422,     4,     4,   426,   429,     4,     4,
-       4,   434,   437,     3,     8,   157,   157,   139,     4,     4,
-       4,     4,   176,     4,     4,     4,   140,   140,   140,   140,
-     140,     4,     4,     4,     4,     4,     4,     4,     4,     4,
-       4,   140,     4,     4,   182,     4,    65,   172,   210,   303,
-     382,   383,   384,   385,   386,     4,     4,     4,     4,     4,
-     140,   142,     4,     4,     4,     4,   266,     4,     4,   329,
-       4,   140,     4,   140,   140,   343,     4,     4,     4,     4,
-       4,     4,   361,     4,     4,   140,     4,     4,     4,   142,
-     289,     4,   142,   313,     4,     4,   242,   142,     4,     4,
-     140,     4,   140,   140,     4,     4,   142,   142,   142,     4,
-       4,   414,     4,     7,     7,   157,   157,     7,     7,     7,
+       0,   130,   131,   132,   133,   134,   135,   136,   137,   138,
+     139,   140,   141,   147,   148,   149,   150,   151,   152,   153,
+     154,   155,   156,   157,   158,   159,     0,     5,     7,     9,
+     142,   143,   144,   145,   160,   161,   162,   167,     7,   176,
+       7,   182,     7,   193,     7,   269,     7,   332,     7,   346,
+       7,   363,     7,   291,     7,   315,     7,   244,     7,   417,
+     168,   163,   177,   183,   194,   270,   333,   347,   364,   292,
+     316,   245,   418,   160,   169,   170,   142,   165,   166,    10,
+     122,   128,   129,   142,   175,   178,   179,   180,   444,   446,
+     448,    11,    13,    14,    32,    33,    34,    35,    36,    37,
+      38,    39,    63,    64,    65,    66,    77,    80,    88,    96,
+      97,   100,   175,   184,   185,   186,   187,   188,   189,   190,
+     191,   197,   199,   225,   231,   236,   238,   252,   263,   285,
+     309,   384,   394,   406,   407,   415,    12,   195,     7,    48,
+      50,    57,    58,    59,    60,    61,    62,    68,    69,    75,
+     175,   186,   187,   188,   189,   271,   272,   273,   275,   277,
+     279,   281,   283,   284,   309,   326,   340,   357,   380,    49,
+      56,   175,   309,   334,   335,   336,   338,    51,    52,    53,
+      54,    55,   175,   309,   338,   348,   349,   350,   352,   353,
+     355,   356,    66,    70,    71,    72,    73,    74,   175,   309,
+     365,   366,   367,   368,   370,   372,   374,   376,   378,    15,
+      40,    42,    43,    45,    46,    47,   175,   213,   293,   294,
+     295,   296,   297,   298,   299,   301,   303,   305,   306,   308,
+      41,    44,   175,   213,   297,   303,   317,   318,   319,   320,
+     321,   323,   324,   325,    78,    79,   175,   246,   247,   248,
+     250,   101,   102,   103,   104,   105,   106,   107,   108,   109,
+     110,   111,   112,   113,   114,   175,   419,   420,   421,   422,
+     424,   426,   427,   429,   430,   431,   434,   436,   437,   438,
+     439,   442,     6,     3,     4,     8,     3,   181,   449,   445,
+     447,     4,     3,     8,   192,   198,   200,     4,     4,     4,
+       4,     4,   264,   286,   310,   226,   237,   232,   385,   239,
+     253,   395,     4,   408,   416,     3,     8,   196,     8,   387,
+     327,   341,   274,   276,   278,     4,     4,   282,   280,   358,
+     381,     3,     8,   337,   339,     3,     8,   351,     4,   354,
+       4,     4,     3,     8,   379,   369,   371,   373,   375,   377,
+       8,     3,   300,   214,     4,   304,   302,   307,     4,     8,
+       3,   322,     4,     8,     3,   249,   251,     3,     8,     4,
+     423,   425,     4,   428,     4,     4,   432,   435,     4,     4,
+       4,   440,   443,     3,     8,   160,   160,   142,     4,     4,
+       4,     4,   179,     4,     4,     4,   143,   143,   143,   143,
+     143,     4,     4,     4,     4,     4,     4,     4,     4,     4,
+       4,   143,     4,     4,   185,     4,    67,   175,   213,   309,
+     388,   389,   390,   391,   392,     4,     4,     4,     4,     4,
+     143,   145,     4,     4,     4,     4,   272,     4,     4,   335,
+       4,   143,     4,   143,   143,   349,     4,     4,     4,     4,
+       4,     4,   367,     4,     4,   143,     4,     4,     4,   145,
+     295,     4,   145,   319,     4,     4,   247,   145,     4,     4,
+     143,     4,   143,   143,     4,     4,   145,   145,   145,     4,
+       4,   420,     4,     7,     7,   160,   160,     7,     7,     7,
        5,     5,     5,     5,     5,     5,     5,     5,     7,     7,
-       7,     7,     5,   168,   387,     8,     3,     5,     5,   139,
-     139,   139,   139,   139,     5,     7,   139,   159,   161,   139,
-     139,   168,   168,   168,   139,   139,   139,   139,   139,   139,
-     139,   139,   139,   139,   157,   139,   139,   139,   112,   113,
-     427,   114,   115,   116,   117,   118,   142,   435,   139,   157,
-     181,   120,   444,   445,   446,   192,    15,    20,    21,    22,
-      23,    24,    25,    26,    27,    28,    29,   172,   198,   199,
-     200,   203,   205,   207,   209,   210,   212,   213,   214,   215,
-     216,   218,   198,     7,   259,   260,   261,     7,   281,   282,
-     283,     7,   305,   306,   307,    70,   139,   222,   223,   224,
-     225,   166,    71,   224,   228,   229,   230,   273,   380,     7,
-     235,   236,   237,    79,    80,    81,    82,    83,    84,   249,
-     250,   251,   252,   253,   254,   255,   256,    15,    89,    90,
-      91,    92,   172,   212,   390,   391,   392,   395,   396,   398,
-     399,    95,    96,   403,   404,   405,   407,   413,   169,     4,
-     384,     7,   322,   323,   324,     7,   336,   337,   338,     7,
-     353,   354,   355,    74,   376,     8,   447,     3,     8,     8,
-     201,   204,   206,   208,     4,     4,     4,     4,     4,   217,
-     219,     3,     8,     8,   262,     6,     3,   284,     6,     3,
-     308,     6,     3,     3,     6,     6,     3,     6,     3,     6,
-     238,     6,     3,     4,     4,     4,     4,     4,     4,     3,
-       8,   393,   397,     4,     4,     4,     3,     8,   406,   408,
-       3,     8,     8,   139,   170,   171,   139,   325,     6,     3,
-     339,     6,     3,   356,     6,     3,   377,     8,     4,   445,
-       4,     4,     4,     4,   140,   142,   140,   142,   140,     4,
-       4,   199,   265,   261,   287,   283,   311,   307,   223,   229,
-     273,   241,   237,   140,   140,   140,   140,   140,   140,   250,
-       4,     4,   140,   140,   140,   391,     4,     4,   404,     6,
-       3,   328,   324,   342,   338,   359,   355,     4,     5,    16,
-      17,    18,    19,   202,   139,   139,   139,   139,   139,     8,
-       8,     8,     8,    86,    87,    88,   394,   139,   139,   139,
-     139,     8,     8,     8,   139,     7,   448,   449,   450,     3,
-       6,   121,   123,   124,   172,   210,   451,   452,   453,   454,
-     456,   449,   457,     4,   455,     3,     8,     4,   140,     4,
-     452,     5,   139,     7,   458,   459,   460,     3,     6,   122,
-     461,   462,   459,   463,     3,     8,     4,   462,   139
+       7,     7,     5,   171,   393,     8,     3,     5,     5,   142,
+     142,   142,   142,   142,     5,     7,   142,   162,   164,   142,
+     142,   171,   171,   171,   142,   142,   142,   142,   142,   142,
+     142,   142,   142,   142,   160,   142,   142,   142,   115,   116,
+     433,   117,   118,   119,   120,   121,   145,   441,   142,   160,
+     184,   123,   450,   451,   452,   195,    15,    20,    21,    22,
+      23,    24,    25,    26,    27,    28,    29,    30,    31,   175,
+     201,   202,   203,   206,   208,   210,   212,   213,   215,   216,
+     217,   218,   219,   220,   221,   223,   201,     7,   265,   266,
+     267,     7,   287,   288,   289,     7,   311,   312,   313,    72,
+     142,   227,   228,   229,   230,   169,    73,   229,   233,   234,
+     235,   279,   386,     7,   240,   241,   242,    81,    82,    83,
+      84,    85,    86,    87,   254,   255,   256,   257,   258,   259,
+     260,   261,   262,    15,    92,    93,    94,    95,   175,   215,
+     396,   397,   398,   401,   402,   404,   405,    98,    99,   409,
+     410,   411,   413,   419,   172,     4,   390,     7,   328,   329,
+     330,     7,   342,   343,   344,     7,   359,   360,   361,    76,
+     382,     8,   453,     3,     8,     8,   204,   207,   209,   211,
+       4,     4,     4,     4,     4,     4,     4,   222,   224,     3,
+       8,     8,   268,     6,     3,   290,     6,     3,   314,     6,
+       3,     3,     6,     6,     3,     6,     3,     6,   243,     6,
+       3,     4,     4,     4,     4,     4,     4,     4,     3,     8,
+     399,   403,     4,     4,     4,     3,     8,   412,   414,     3,
+       8,     8,   142,   173,   174,   142,   331,     6,     3,   345,
+       6,     3,   362,     6,     3,   383,     8,     4,   451,     4,
+       4,     4,     4,   143,   145,   143,   145,   143,   143,   143,
+       4,     4,   202,   271,   267,   293,   289,   317,   313,   228,
+     234,   279,   246,   242,   143,   143,   143,   143,   143,   143,
+     143,   255,     4,     4,   143,   143,   143,   397,     4,     4,
+     410,     6,     3,   334,   330,   348,   344,   365,   361,     4,
+       5,    16,    17,    18,    19,   205,   142,   142,   142,   142,
+     142,     8,     8,     8,     8,    89,    90,    91,   400,   142,
+     142,   142,   142,     8,     8,     8,   142,     7,   454,   455,
+     456,     3,     6,   124,   126,   127,   175,   213,   457,   458,
+     459,   460,   462,   455,   463,     4,   461,     3,     8,     4,
+     143,     4,   458,     5,   142,     7,   464,   465,   466,     3,
+       6,   125,   467,   468,   465,   469,     3,     8,     4,   468,
+     142
   };
 
   const unsigned short int
   Dhcp6Parser::yyr1_[] =
   {
-       0,   143,   145,   144,   146,   144,   147,   144,   148,   144,
-     149,   144,   150,   144,   151,   144,   152,   144,   153,   144,
-     154,   144,   155,   144,   156,   144,   157,   157,   157,   157,
-     157,   157,   157,   158,   160,   159,   161,   162,   162,   163,
-     163,   165,   164,   166,   166,   167,   167,   169,   168,   170,
-     170,   171,   171,   172,   174,   173,   175,   175,   176,   176,
-     176,   176,   176,   178,   177,   180,   179,   181,   181,   182,
-     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
-     182,   182,   182,   182,   182,   182,   182,   182,   182,   182,
-     182,   183,   184,   185,   186,   187,   189,   188,   191,   190,
-     193,   192,   195,   194,   197,   196,   198,   198,   199,   199,
-     199,   199,   199,   199,   199,   199,   199,   199,   199,   199,
-     199,   201,   200,   202,   202,   202,   202,   204,   203,   206,
-     205,   208,   207,   209,   211,   210,   212,   213,   214,   215,
-     217,   216,   219,   218,   221,   220,   222,   222,   223,   223,
-     224,   225,   227,   226,   228,   228,   229,   229,   230,   232,
-     231,   234,   233,   235,   235,   236,   236,   238,   237,   240,
-     239,   241,   241,   241,   242,   242,   244,   243,   246,   245,
-     248,   247,   249,   249,   250,   250,   250,   250,   250,   250,
-     251,   252,   253,   254,   255,   256,   258,   257,   259,   259,
-     260,   260,   262,   261,   264,   263,   265,   265,   266,   266,
-     266,   266,   266,   266,   266,   266,   266,   266,   266,   266,
-     266,   266,   266,   266,   266,   268,   267,   270,   269,   272,
-     271,   274,   273,   276,   275,   277,   278,   280,   279,   281,
-     281,   282,   282,   284,   283,   286,   285,   287,   287,   288,
-     288,   289,   289,   289,   289,   289,   289,   289,   289,   290,
-     291,   292,   294,   293,   296,   295,   298,   297,   299,   301,
-     300,   302,   304,   303,   305,   305,   306,   306,   308,   307,
-     310,   309,   311,   311,   312,   312,   313,   313,   313,   313,
-     313,   313,   314,   316,   315,   317,   318,   319,   321,   320,
-     322,   322,   323,   323,   325,   324,   327,   326,   328,   328,
-     329,   329,   329,   329,   331,   330,   333,   332,   335,   334,
-     336,   336,   337,   337,   339,   338,   341,   340,   342,   342,
-     343,   343,   343,   343,   343,   343,   343,   343,   345,   344,
-     346,   348,   347,   349,   350,   352,   351,   353,   353,   354,
-     354,   356,   355,   358,   357,   359,   359,   360,   360,   361,
-     361,   361,   361,   361,   361,   361,   361,   363,   362,   365,
-     364,   367,   366,   369,   368,   371,   370,   373,   372,   375,
-     374,   377,   376,   379,   378,   380,   380,   381,   273,   382,
-     382,   383,   383,   384,   384,   384,   384,   385,   387,   386,
-     389,   388,   390,   390,   391,   391,   391,   391,   391,   391,
-     391,   393,   392,   394,   394,   394,   395,   397,   396,   398,
-     399,   400,   402,   401,   403,   403,   404,   404,   406,   405,
-     408,   407,   410,   409,   412,   411,   413,   413,   414,   414,
-     414,   414,   414,   414,   414,   414,   414,   414,   414,   414,
-     414,   414,   414,   415,   417,   416,   419,   418,   420,   422,
-     421,   423,   424,   426,   425,   427,   427,   429,   428,   430,
-     431,   432,   434,   433,   435,   435,   435,   435,   435,   437,
-     436,   439,   438,   441,   440,   443,   442,   444,   444,   445,
-     447,   446,   448,   448,   450,   449,   451,   451,   452,   452,
-     452,   452,   452,   453,   455,   454,   457,   456,   458,   458,
-     460,   459,   461,   461,   463,   462
+       0,   146,   148,   147,   149,   147,   150,   147,   151,   147,
+     152,   147,   153,   147,   154,   147,   155,   147,   156,   147,
+     157,   147,   158,   147,   159,   147,   160,   160,   160,   160,
+     160,   160,   160,   161,   163,   162,   164,   165,   165,   166,
+     166,   168,   167,   169,   169,   170,   170,   172,   171,   173,
+     173,   174,   174,   175,   177,   176,   178,   178,   179,   179,
+     179,   179,   179,   181,   180,   183,   182,   184,   184,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     185,   185,   185,   185,   185,   185,   185,   185,   185,   185,
+     185,   186,   187,   188,   189,   190,   192,   191,   194,   193,
+     196,   195,   198,   197,   200,   199,   201,   201,   202,   202,
+     202,   202,   202,   202,   202,   202,   202,   202,   202,   202,
+     202,   202,   202,   204,   203,   205,   205,   205,   205,   207,
+     206,   209,   208,   211,   210,   212,   214,   213,   215,   216,
+     217,   218,   219,   220,   222,   221,   224,   223,   226,   225,
+     227,   227,   228,   228,   229,   230,   232,   231,   233,   233,
+     234,   234,   235,   237,   236,   239,   238,   240,   240,   241,
+     241,   243,   242,   245,   244,   246,   246,   246,   247,   247,
+     249,   248,   251,   250,   253,   252,   254,   254,   255,   255,
+     255,   255,   255,   255,   255,   256,   257,   258,   259,   260,
+     261,   262,   264,   263,   265,   265,   266,   266,   268,   267,
+     270,   269,   271,   271,   272,   272,   272,   272,   272,   272,
+     272,   272,   272,   272,   272,   272,   272,   272,   272,   272,
+     272,   274,   273,   276,   275,   278,   277,   280,   279,   282,
+     281,   283,   284,   286,   285,   287,   287,   288,   288,   290,
+     289,   292,   291,   293,   293,   294,   294,   295,   295,   295,
+     295,   295,   295,   295,   295,   296,   297,   298,   300,   299,
+     302,   301,   304,   303,   305,   307,   306,   308,   310,   309,
+     311,   311,   312,   312,   314,   313,   316,   315,   317,   317,
+     318,   318,   319,   319,   319,   319,   319,   319,   320,   322,
+     321,   323,   324,   325,   327,   326,   328,   328,   329,   329,
+     331,   330,   333,   332,   334,   334,   335,   335,   335,   335,
+     337,   336,   339,   338,   341,   340,   342,   342,   343,   343,
+     345,   344,   347,   346,   348,   348,   349,   349,   349,   349,
+     349,   349,   349,   349,   351,   350,   352,   354,   353,   355,
+     356,   358,   357,   359,   359,   360,   360,   362,   361,   364,
+     363,   365,   365,   366,   366,   367,   367,   367,   367,   367,
+     367,   367,   367,   369,   368,   371,   370,   373,   372,   375,
+     374,   377,   376,   379,   378,   381,   380,   383,   382,   385,
+     384,   386,   386,   387,   279,   388,   388,   389,   389,   390,
+     390,   390,   390,   391,   393,   392,   395,   394,   396,   396,
+     397,   397,   397,   397,   397,   397,   397,   399,   398,   400,
+     400,   400,   401,   403,   402,   404,   405,   406,   408,   407,
+     409,   409,   410,   410,   412,   411,   414,   413,   416,   415,
+     418,   417,   419,   419,   420,   420,   420,   420,   420,   420,
+     420,   420,   420,   420,   420,   420,   420,   420,   420,   421,
+     423,   422,   425,   424,   426,   428,   427,   429,   430,   432,
+     431,   433,   433,   435,   434,   436,   437,   438,   440,   439,
+     441,   441,   441,   441,   441,   443,   442,   445,   444,   447,
+     446,   449,   448,   450,   450,   451,   453,   452,   454,   454,
+     456,   455,   457,   457,   458,   458,   458,   458,   458,   459,
+     461,   460,   463,   462,   464,   464,   466,   465,   467,   467,
+     469,   468
   };
 
   const unsigned char
@@ -3913,46 +3949,47 @@ namespace isc { namespace dhcp {
        1,     3,     3,     3,     3,     3,     0,     6,     0,     4,
        0,     4,     0,     6,     0,     6,     1,     3,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     3,     0,     4,     3,     3,     3,     3,
+       1,     1,     1,     0,     4,     1,     1,     1,     1,     0,
+       4,     0,     4,     0,     4,     3,     0,     4,     3,     3,
+       3,     3,     3,     3,     0,     4,     0,     4,     0,     6,
+       1,     3,     1,     1,     1,     1,     0,     6,     1,     3,
+       1,     1,     1,     0,     6,     0,     6,     0,     1,     1,
+       3,     0,     4,     0,     4,     1,     3,     1,     1,     1,
        0,     4,     0,     4,     0,     6,     1,     3,     1,     1,
-       1,     1,     0,     6,     1,     3,     1,     1,     1,     0,
-       6,     0,     6,     0,     1,     1,     3,     0,     4,     0,
-       4,     1,     3,     1,     1,     1,     0,     4,     0,     4,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
-       3,     3,     3,     3,     3,     3,     0,     6,     0,     1,
-       1,     3,     0,     4,     0,     4,     1,     3,     1,     1,
+       1,     1,     1,     1,     1,     3,     3,     3,     3,     3,
+       3,     3,     0,     6,     0,     1,     1,     3,     0,     4,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
        1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
+       1,     0,     4,     0,     4,     0,     4,     0,     4,     0,
+       4,     3,     3,     0,     6,     0,     1,     1,     3,     0,
+       4,     0,     4,     0,     1,     1,     3,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     3,     1,     0,     4,
+       0,     4,     0,     4,     1,     0,     4,     3,     0,     6,
+       0,     1,     1,     3,     0,     4,     0,     4,     0,     1,
+       1,     3,     1,     1,     1,     1,     1,     1,     1,     0,
+       4,     1,     1,     3,     0,     6,     0,     1,     1,     3,
+       0,     4,     0,     4,     1,     3,     1,     1,     1,     1,
+       0,     4,     0,     4,     0,     6,     0,     1,     1,     3,
+       0,     4,     0,     4,     1,     3,     1,     1,     1,     1,
+       1,     1,     1,     1,     0,     4,     3,     0,     4,     3,
+       3,     0,     6,     0,     1,     1,     3,     0,     4,     0,
+       4,     0,     1,     1,     3,     1,     1,     1,     1,     1,
+       1,     1,     1,     0,     4,     0,     4,     0,     4,     0,
+       4,     0,     4,     0,     4,     0,     6,     0,     4,     0,
+       6,     1,     3,     0,     4,     0,     1,     1,     3,     1,
+       1,     1,     1,     1,     0,     4,     0,     6,     1,     3,
+       1,     1,     1,     1,     1,     1,     1,     0,     4,     1,
+       1,     1,     3,     0,     4,     3,     3,     3,     0,     6,
+       1,     3,     1,     1,     0,     4,     0,     4,     0,     6,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     1,
+       1,     1,     1,     1,     1,     1,     1,     1,     1,     3,
+       0,     4,     0,     4,     3,     0,     4,     3,     3,     0,
+       4,     1,     1,     0,     4,     3,     3,     3,     0,     4,
        1,     1,     1,     1,     1,     0,     4,     0,     4,     0,
-       4,     0,     4,     0,     4,     3,     3,     0,     6,     0,
-       1,     1,     3,     0,     4,     0,     4,     0,     1,     1,
-       3,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       3,     1,     0,     4,     0,     4,     0,     4,     1,     0,
-       4,     3,     0,     6,     0,     1,     1,     3,     0,     4,
-       0,     4,     0,     1,     1,     3,     1,     1,     1,     1,
-       1,     1,     1,     0,     4,     1,     1,     3,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     0,     4,     0,     4,     0,     6,
-       0,     1,     1,     3,     0,     4,     0,     4,     1,     3,
-       1,     1,     1,     1,     1,     1,     1,     1,     0,     4,
-       3,     0,     4,     3,     3,     0,     6,     0,     1,     1,
-       3,     0,     4,     0,     4,     0,     1,     1,     3,     1,
-       1,     1,     1,     1,     1,     1,     1,     0,     4,     0,
-       4,     0,     4,     0,     4,     0,     4,     0,     4,     0,
-       6,     0,     4,     0,     6,     1,     3,     0,     4,     0,
-       1,     1,     3,     1,     1,     1,     1,     1,     0,     4,
-       0,     6,     1,     3,     1,     1,     1,     1,     1,     1,
-       1,     0,     4,     1,     1,     1,     3,     0,     4,     3,
-       3,     3,     0,     6,     1,     3,     1,     1,     0,     4,
-       0,     4,     0,     6,     0,     4,     1,     3,     1,     1,
-       1,     1,     1,     1,     1,     1,     1,     1,     1,     1,
-       1,     1,     1,     3,     0,     4,     0,     4,     3,     0,
-       4,     3,     3,     0,     4,     1,     1,     0,     4,     3,
-       3,     3,     0,     4,     1,     1,     1,     1,     1,     0,
-       4,     0,     4,     0,     4,     0,     6,     1,     3,     1,
-       0,     6,     1,     3,     0,     4,     1,     3,     1,     1,
-       1,     1,     1,     3,     0,     4,     0,     6,     1,     3,
-       0,     4,     1,     3,     0,     4
+       4,     0,     6,     1,     3,     1,     0,     6,     1,     3,
+       0,     4,     1,     3,     1,     1,     1,     1,     1,     3,
+       0,     4,     0,     6,     1,     3,     0,     4,     1,     3,
+       0,     4
   };
 
 
@@ -3968,44 +4005,44 @@ namespace isc { namespace dhcp {
   "\"hosts-database\"", "\"type\"", "\"memfile\"", "\"mysql\"",
   "\"postgresql\"", "\"cql\"", "\"user\"", "\"password\"", "\"host\"",
   "\"port\"", "\"persist\"", "\"lfc-interval\"", "\"readonly\"",
-  "\"connect-timeout\"", "\"contact-points\"", "\"keyspace\"",
-  "\"preferred-lifetime\"", "\"valid-lifetime\"", "\"renew-timer\"",
-  "\"rebind-timer\"", "\"decline-probation-period\"", "\"subnet6\"",
-  "\"option-def\"", "\"option-data\"", "\"name\"", "\"data\"", "\"code\"",
-  "\"space\"", "\"csv-format\"", "\"record-types\"", "\"encapsulate\"",
-  "\"array\"", "\"pools\"", "\"pool\"", "\"pd-pools\"", "\"prefix\"",
-  "\"prefix-len\"", "\"excluded-prefix\"", "\"excluded-prefix-len\"",
-  "\"delegated-len\"", "\"user-context\"", "\"subnet\"", "\"interface\"",
-  "\"interface-id\"", "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"",
-  "\"mac-sources\"", "\"relay-supplied-options\"",
-  "\"host-reservation-identifiers\"", "\"client-classes\"", "\"test\"",
-  "\"client-class\"", "\"reservations\"", "\"ip-addresses\"",
-  "\"prefixes\"", "\"duid\"", "\"hw-address\"", "\"hostname\"",
-  "\"relay\"", "\"ip-address\"", "\"hooks-libraries\"", "\"library\"",
-  "\"parameters\"", "\"expired-leases-processing\"",
+  "\"connect-timeout\"", "\"connection-pool-size\"", "\"cache-size\"",
+  "\"contact-points\"", "\"keyspace\"", "\"preferred-lifetime\"",
+  "\"valid-lifetime\"", "\"renew-timer\"", "\"rebind-timer\"",
+  "\"decline-probation-period\"", "\"subnet6\"", "\"option-def\"",
+  "\"option-data\"", "\"name\"", "\"data\"", "\"code\"", "\"space\"",
+  "\"csv-format\"", "\"record-types\"", "\"encapsulate\"", "\"array\"",
+  "\"pools\"", "\"pool\"", "\"pd-pools\"", "\"prefix\"", "\"prefix-len\"",
+  "\"excluded-prefix\"", "\"excluded-prefix-len\"", "\"delegated-len\"",
+  "\"user-context\"", "\"subnet\"", "\"interface\"", "\"interface-id\"",
+  "\"id\"", "\"rapid-commit\"", "\"reservation-mode\"", "\"mac-sources\"",
+  "\"relay-supplied-options\"", "\"host-reservation-identifiers\"",
+  "\"client-classes\"", "\"test\"", "\"client-class\"", "\"reservations\"",
+  "\"ip-addresses\"", "\"prefixes\"", "\"duid\"", "\"hw-address\"",
+  "\"hostname\"", "\"relay\"", "\"ip-address\"", "\"hooks-libraries\"",
+  "\"library\"", "\"parameters\"", "\"expired-leases-processing\"",
   "\"reclaim-timer-wait-time\"", "\"flush-reclaimed-timer-wait-time\"",
-  "\"hold-reclaimed-time\"", "\"max-reclaim-leases\"",
-  "\"max-reclaim-time\"", "\"unwarned-reclaim-cycles\"", "\"server-id\"",
-  "\"LLT\"", "\"EN\"", "\"LL\"", "\"identifier\"", "\"htype\"", "\"time\"",
-  "\"enterprise-id\"", "\"dhcp4o6-port\"", "\"control-socket\"",
-  "\"socket-type\"", "\"socket-name\"", "\"dhcp-ddns\"",
-  "\"enable-updates\"", "\"qualifying-suffix\"", "\"server-ip\"",
-  "\"server-port\"", "\"sender-ip\"", "\"sender-port\"",
-  "\"max-queue-size\"", "\"ncr-protocol\"", "\"ncr-format\"",
-  "\"always-include-fqdn\"", "\"override-no-update\"",
-  "\"override-client-update\"", "\"replace-client-name\"",
-  "\"generated-prefix\"", "\"UDP\"", "\"TCP\"", "\"JSON\"",
-  "\"when-present\"", "\"never\"", "\"always\"", "\"when-not-present\"",
-  "\"Logging\"", "\"loggers\"", "\"output_options\"", "\"output\"",
-  "\"debuglevel\"", "\"severity\"", "\"Dhcp4\"", "\"DhcpDdns\"",
-  "TOPLEVEL_JSON", "TOPLEVEL_DHCP6", "SUB_DHCP6", "SUB_INTERFACES6",
-  "SUB_SUBNET6", "SUB_POOL6", "SUB_PD_POOL", "SUB_RESERVATION",
-  "SUB_OPTION_DEF", "SUB_OPTION_DATA", "SUB_HOOKS_LIBRARY",
-  "SUB_DHCP_DDNS", "\"constant string\"", "\"integer\"",
-  "\"floating point\"", "\"boolean\"", "$accept", "start", "$@1", "$@2",
-  "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10", "$@11", "$@12",
-  "value", "sub_json", "map2", "$@13", "map_value", "map_content",
-  "not_empty_map", "list_generic", "$@14", "list_content",
+  "\"hold-reclaimed-time\"", "\"reuse-quarantine-time\"",
+  "\"max-reclaim-leases\"", "\"max-reclaim-time\"",
+  "\"unwarned-reclaim-cycles\"", "\"server-id\"", "\"LLT\"", "\"EN\"",
+  "\"LL\"", "\"identifier\"", "\"htype\"", "\"time\"", "\"enterprise-id\"",
+  "\"dhcp4o6-port\"", "\"control-socket\"", "\"socket-type\"",
+  "\"socket-name\"", "\"dhcp-ddns\"", "\"enable-updates\"",
+  "\"qualifying-suffix\"", "\"server-ip\"", "\"server-port\"",
+  "\"sender-ip\"", "\"sender-port\"", "\"max-queue-size\"",
+  "\"ncr-protocol\"", "\"ncr-format\"", "\"always-include-fqdn\"",
+  "\"override-no-update\"", "\"override-client-update\"",
+  "\"replace-client-name\"", "\"generated-prefix\"", "\"UDP\"", "\"TCP\"",
+  "\"JSON\"", "\"when-present\"", "\"never\"", "\"always\"",
+  "\"when-not-present\"", "\"Logging\"", "\"loggers\"",
+  "\"output_options\"", "\"output\"", "\"debuglevel\"", "\"severity\"",
+  "\"Dhcp4\"", "\"DhcpDdns\"", "TOPLEVEL_JSON", "TOPLEVEL_DHCP6",
+  "SUB_DHCP6", "SUB_INTERFACES6", "SUB_SUBNET6", "SUB_POOL6",
+  "SUB_PD_POOL", "SUB_RESERVATION", "SUB_OPTION_DEF", "SUB_OPTION_DATA",
+  "SUB_HOOKS_LIBRARY", "SUB_DHCP_DDNS", "\"constant string\"",
+  "\"integer\"", "\"floating point\"", "\"boolean\"", "$accept", "start",
+  "$@1", "$@2", "$@3", "$@4", "$@5", "$@6", "$@7", "$@8", "$@9", "$@10",
+  "$@11", "$@12", "value", "sub_json", "map2", "$@13", "map_value",
+  "map_content", "not_empty_map", "list_generic", "$@14", "list_content",
   "not_empty_list", "list_strings", "$@15", "list_strings_content",
   "not_empty_list_strings", "unknown_map_entry", "syntax_map", "$@16",
   "global_objects", "global_object", "dhcp6_object", "$@17", "sub_dhcp6",
@@ -4017,8 +4054,9 @@ namespace isc { namespace dhcp {
   "database_map_params", "database_map_param", "database_type", "$@24",
   "db_type", "user", "$@25", "password", "$@26", "host", "$@27", "port",
   "name", "$@28", "persist", "lfc_interval", "readonly", "connect_timeout",
-  "contact_points", "$@29", "keyspace", "$@30", "mac_sources", "$@31",
-  "mac_sources_list", "mac_sources_value", "duid_id", "string_id",
+  "connection_pool_size", "cache_size", "contact_points", "$@29",
+  "keyspace", "$@30", "mac_sources", "$@31", "mac_sources_list",
+  "mac_sources_value", "duid_id", "string_id",
   "host_reservation_identifiers", "$@32",
   "host_reservation_identifiers_list", "host_reservation_identifier",
   "hw_address_id", "relay_supplied_options", "$@33", "hooks_libraries",
@@ -4028,12 +4066,13 @@ namespace isc { namespace dhcp {
   "expired_leases_processing", "$@39", "expired_leases_params",
   "expired_leases_param", "reclaim_timer_wait_time",
   "flush_reclaimed_timer_wait_time", "hold_reclaimed_time",
-  "max_reclaim_leases", "max_reclaim_time", "unwarned_reclaim_cycles",
-  "subnet6_list", "$@40", "subnet6_list_content", "not_empty_subnet6_list",
-  "subnet6", "$@41", "sub_subnet6", "$@42", "subnet6_params",
-  "subnet6_param", "subnet", "$@43", "interface", "$@44", "interface_id",
-  "$@45", "client_class", "$@46", "reservation_mode", "$@47", "id",
-  "rapid_commit", "option_def_list", "$@48", "option_def_list_content",
+  "reuse_quarantine_time", "max_reclaim_leases", "max_reclaim_time",
+  "unwarned_reclaim_cycles", "subnet6_list", "$@40",
+  "subnet6_list_content", "not_empty_subnet6_list", "subnet6", "$@41",
+  "sub_subnet6", "$@42", "subnet6_params", "subnet6_param", "subnet",
+  "$@43", "interface", "$@44", "interface_id", "$@45", "client_class",
+  "$@46", "reservation_mode", "$@47", "id", "rapid_commit",
+  "option_def_list", "$@48", "option_def_list_content",
   "not_empty_option_def_list", "option_def_entry", "$@49",
   "sub_option_def", "$@50", "option_def_params",
   "not_empty_option_def_params", "option_def_param", "option_def_name",
@@ -4085,58 +4124,59 @@ namespace isc { namespace dhcp {
   const unsigned short int
   Dhcp6Parser::yyrline_[] =
   {
-       0,   223,   223,   223,   224,   224,   225,   225,   226,   226,
-     227,   227,   228,   228,   229,   229,   230,   230,   231,   231,
-     232,   232,   233,   233,   234,   234,   242,   243,   244,   245,
-     246,   247,   248,   251,   256,   256,   267,   270,   271,   274,
-     278,   285,   285,   292,   293,   296,   300,   307,   307,   314,
-     315,   318,   322,   333,   343,   343,   355,   356,   360,   361,
-     362,   363,   364,   367,   367,   384,   384,   392,   393,   398,
-     399,   400,   401,   402,   403,   404,   405,   406,   407,   408,
-     409,   410,   411,   412,   413,   414,   415,   416,   417,   418,
-     419,   422,   427,   432,   437,   442,   447,   447,   457,   457,
-     465,   465,   475,   475,   485,   485,   495,   496,   499,   500,
-     501,   502,   503,   504,   505,   506,   507,   508,   509,   510,
-     511,   514,   514,   521,   522,   523,   524,   527,   527,   535,
-     535,   543,   543,   551,   556,   556,   564,   569,   574,   579,
-     584,   584,   592,   592,   601,   601,   611,   612,   615,   616,
-     619,   624,   629,   629,   639,   640,   643,   644,   647,   654,
-     654,   664,   664,   674,   675,   678,   679,   682,   682,   690,
-     690,   698,   699,   700,   703,   704,   707,   707,   715,   715,
-     723,   723,   733,   734,   737,   738,   739,   740,   741,   742,
-     745,   750,   755,   760,   765,   770,   778,   778,   791,   792,
-     795,   796,   803,   803,   826,   826,   835,   836,   840,   841,
-     842,   843,   844,   845,   846,   847,   848,   849,   850,   851,
-     852,   853,   854,   855,   856,   859,   859,   867,   867,   875,
-     875,   883,   883,   891,   891,   899,   904,   913,   913,   925,
-     926,   929,   930,   935,   935,   946,   946,   956,   957,   960,
-     961,   964,   965,   966,   967,   968,   969,   970,   971,   974,
-     976,   981,   983,   983,   991,   991,   999,   999,  1007,  1009,
-    1009,  1017,  1026,  1026,  1038,  1039,  1044,  1045,  1050,  1050,
-    1061,  1061,  1072,  1073,  1078,  1079,  1084,  1085,  1086,  1087,
-    1088,  1089,  1092,  1094,  1094,  1102,  1104,  1106,  1114,  1114,
-    1126,  1127,  1130,  1131,  1134,  1134,  1142,  1142,  1150,  1151,
-    1154,  1155,  1156,  1157,  1160,  1160,  1168,  1168,  1178,  1178,
-    1190,  1191,  1194,  1195,  1198,  1198,  1206,  1206,  1214,  1215,
-    1218,  1219,  1220,  1221,  1222,  1223,  1224,  1225,  1228,  1228,
-    1236,  1241,  1241,  1249,  1254,  1262,  1262,  1272,  1273,  1276,
-    1277,  1280,  1280,  1288,  1288,  1296,  1297,  1300,  1301,  1305,
-    1306,  1307,  1308,  1309,  1310,  1311,  1312,  1315,  1315,  1325,
-    1325,  1335,  1335,  1343,  1343,  1351,  1351,  1359,  1359,  1372,
-    1372,  1382,  1382,  1393,  1393,  1403,  1404,  1407,  1407,  1415,
-    1416,  1419,  1420,  1423,  1424,  1425,  1426,  1429,  1431,  1431,
-    1442,  1442,  1452,  1453,  1456,  1457,  1458,  1459,  1460,  1461,
-    1462,  1465,  1465,  1472,  1473,  1474,  1477,  1482,  1482,  1490,
-    1495,  1502,  1509,  1509,  1519,  1520,  1523,  1524,  1527,  1527,
-    1535,  1535,  1545,  1545,  1555,  1555,  1563,  1564,  1567,  1568,
-    1569,  1570,  1571,  1572,  1573,  1574,  1575,  1576,  1577,  1578,
-    1579,  1580,  1581,  1584,  1589,  1589,  1597,  1597,  1605,  1610,
-    1610,  1618,  1623,  1628,  1628,  1636,  1637,  1640,  1640,  1648,
-    1653,  1658,  1663,  1663,  1671,  1674,  1677,  1680,  1683,  1689,
-    1689,  1699,  1699,  1706,  1706,  1718,  1718,  1731,  1732,  1736,
-    1740,  1740,  1752,  1753,  1757,  1757,  1765,  1766,  1769,  1770,
-    1771,  1772,  1773,  1776,  1781,  1781,  1789,  1789,  1799,  1800,
-    1803,  1803,  1811,  1812,  1815,  1815
+       0,   226,   226,   226,   227,   227,   228,   228,   229,   229,
+     230,   230,   231,   231,   232,   232,   233,   233,   234,   234,
+     235,   235,   236,   236,   237,   237,   245,   246,   247,   248,
+     249,   250,   251,   254,   259,   259,   270,   273,   274,   277,
+     281,   288,   288,   295,   296,   299,   303,   310,   310,   317,
+     318,   321,   325,   336,   346,   346,   358,   359,   363,   364,
+     365,   366,   367,   370,   370,   387,   387,   395,   396,   401,
+     402,   403,   404,   405,   406,   407,   408,   409,   410,   411,
+     412,   413,   414,   415,   416,   417,   418,   419,   420,   421,
+     422,   425,   430,   435,   440,   445,   450,   450,   460,   460,
+     468,   468,   478,   478,   488,   488,   498,   499,   502,   503,
+     504,   505,   506,   507,   508,   509,   510,   511,   512,   513,
+     514,   515,   516,   519,   519,   526,   527,   528,   529,   532,
+     532,   540,   540,   548,   548,   556,   561,   561,   569,   574,
+     579,   584,   589,   594,   599,   599,   607,   607,   616,   616,
+     626,   627,   630,   631,   634,   639,   644,   644,   654,   655,
+     658,   659,   662,   669,   669,   679,   679,   689,   690,   693,
+     694,   697,   697,   705,   705,   713,   714,   715,   718,   719,
+     722,   722,   730,   730,   738,   738,   748,   749,   752,   753,
+     754,   755,   756,   757,   758,   761,   766,   771,   776,   781,
+     786,   791,   799,   799,   812,   813,   816,   817,   824,   824,
+     847,   847,   856,   857,   861,   862,   863,   864,   865,   866,
+     867,   868,   869,   870,   871,   872,   873,   874,   875,   876,
+     877,   880,   880,   888,   888,   896,   896,   904,   904,   912,
+     912,   920,   925,   934,   934,   946,   947,   950,   951,   956,
+     956,   967,   967,   977,   978,   981,   982,   985,   986,   987,
+     988,   989,   990,   991,   992,   995,   997,  1002,  1004,  1004,
+    1012,  1012,  1020,  1020,  1028,  1030,  1030,  1038,  1047,  1047,
+    1059,  1060,  1065,  1066,  1071,  1071,  1082,  1082,  1093,  1094,
+    1099,  1100,  1105,  1106,  1107,  1108,  1109,  1110,  1113,  1115,
+    1115,  1123,  1125,  1127,  1135,  1135,  1147,  1148,  1151,  1152,
+    1155,  1155,  1163,  1163,  1171,  1172,  1175,  1176,  1177,  1178,
+    1181,  1181,  1189,  1189,  1199,  1199,  1211,  1212,  1215,  1216,
+    1219,  1219,  1227,  1227,  1235,  1236,  1239,  1240,  1241,  1242,
+    1243,  1244,  1245,  1246,  1249,  1249,  1257,  1262,  1262,  1270,
+    1275,  1283,  1283,  1293,  1294,  1297,  1298,  1301,  1301,  1309,
+    1309,  1317,  1318,  1321,  1322,  1326,  1327,  1328,  1329,  1330,
+    1331,  1332,  1333,  1336,  1336,  1346,  1346,  1356,  1356,  1364,
+    1364,  1372,  1372,  1380,  1380,  1393,  1393,  1403,  1403,  1414,
+    1414,  1424,  1425,  1428,  1428,  1436,  1437,  1440,  1441,  1444,
+    1445,  1446,  1447,  1450,  1452,  1452,  1463,  1463,  1473,  1474,
+    1477,  1478,  1479,  1480,  1481,  1482,  1483,  1486,  1486,  1493,
+    1494,  1495,  1498,  1503,  1503,  1511,  1516,  1523,  1530,  1530,
+    1540,  1541,  1544,  1545,  1548,  1548,  1556,  1556,  1566,  1566,
+    1576,  1576,  1584,  1585,  1588,  1589,  1590,  1591,  1592,  1593,
+    1594,  1595,  1596,  1597,  1598,  1599,  1600,  1601,  1602,  1605,
+    1610,  1610,  1618,  1618,  1626,  1631,  1631,  1639,  1644,  1649,
+    1649,  1657,  1658,  1661,  1661,  1669,  1674,  1679,  1684,  1684,
+    1692,  1695,  1698,  1701,  1704,  1710,  1710,  1720,  1720,  1727,
+    1727,  1739,  1739,  1752,  1753,  1757,  1761,  1761,  1773,  1774,
+    1778,  1778,  1786,  1787,  1790,  1791,  1792,  1793,  1794,  1797,
+    1802,  1802,  1810,  1810,  1820,  1821,  1824,  1824,  1832,  1833,
+    1836,  1836
   };
 
   // Print the state stack on the debug stream.
@@ -4171,8 +4211,8 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy" // lalr1.cc:1167
 } } // isc::dhcp
-#line 4175 "dhcp6_parser.cc" // lalr1.cc:1167
-#line 1823 "dhcp6_parser.yy" // lalr1.cc:1168
+#line 4215 "dhcp6_parser.cc" // lalr1.cc:1167
+#line 1844 "dhcp6_parser.yy" // lalr1.cc:1168
 
 
 void
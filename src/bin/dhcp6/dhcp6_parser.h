@@ -371,121 +371,124 @@ namespace isc { namespace dhcp {
         TOKEN_LFC_INTERVAL = 280,
         TOKEN_READONLY = 281,
         TOKEN_CONNECT_TIMEOUT = 282,
-        TOKEN_CONTACT_POINTS = 283,
-        TOKEN_KEYSPACE = 284,
-        TOKEN_PREFERRED_LIFETIME = 285,
-        TOKEN_VALID_LIFETIME = 286,
-        TOKEN_RENEW_TIMER = 287,
-        TOKEN_REBIND_TIMER = 288,
-        TOKEN_DECLINE_PROBATION_PERIOD = 289,
-        TOKEN_SUBNET6 = 290,
-        TOKEN_OPTION_DEF = 291,
-        TOKEN_OPTION_DATA = 292,
-        TOKEN_NAME = 293,
-        TOKEN_DATA = 294,
-        TOKEN_CODE = 295,
-        TOKEN_SPACE = 296,
-        TOKEN_CSV_FORMAT = 297,
-        TOKEN_RECORD_TYPES = 298,
-        TOKEN_ENCAPSULATE = 299,
-        TOKEN_ARRAY = 300,
-        TOKEN_POOLS = 301,
-        TOKEN_POOL = 302,
-        TOKEN_PD_POOLS = 303,
-        TOKEN_PREFIX = 304,
-        TOKEN_PREFIX_LEN = 305,
-        TOKEN_EXCLUDED_PREFIX = 306,
-        TOKEN_EXCLUDED_PREFIX_LEN = 307,
-        TOKEN_DELEGATED_LEN = 308,
-        TOKEN_USER_CONTEXT = 309,
-        TOKEN_SUBNET = 310,
-        TOKEN_INTERFACE = 311,
-        TOKEN_INTERFACE_ID = 312,
-        TOKEN_ID = 313,
-        TOKEN_RAPID_COMMIT = 314,
-        TOKEN_RESERVATION_MODE = 315,
-        TOKEN_MAC_SOURCES = 316,
-        TOKEN_RELAY_SUPPLIED_OPTIONS = 317,
-        TOKEN_HOST_RESERVATION_IDENTIFIERS = 318,
-        TOKEN_CLIENT_CLASSES = 319,
-        TOKEN_TEST = 320,
-        TOKEN_CLIENT_CLASS = 321,
-        TOKEN_RESERVATIONS = 322,
-        TOKEN_IP_ADDRESSES = 323,
-        TOKEN_PREFIXES = 324,
-        TOKEN_DUID = 325,
-        TOKEN_HW_ADDRESS = 326,
-        TOKEN_HOSTNAME = 327,
-        TOKEN_RELAY = 328,
-        TOKEN_IP_ADDRESS = 329,
-        TOKEN_HOOKS_LIBRARIES = 330,
-        TOKEN_LIBRARY = 331,
-        TOKEN_PARAMETERS = 332,
-        TOKEN_EXPIRED_LEASES_PROCESSING = 333,
-        TOKEN_RECLAIM_TIMER_WAIT_TIME = 334,
-        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 335,
-        TOKEN_HOLD_RECLAIMED_TIME = 336,
-        TOKEN_MAX_RECLAIM_LEASES = 337,
-        TOKEN_MAX_RECLAIM_TIME = 338,
-        TOKEN_UNWARNED_RECLAIM_CYCLES = 339,
-        TOKEN_SERVER_ID = 340,
-        TOKEN_LLT = 341,
-        TOKEN_EN = 342,
-        TOKEN_LL = 343,
-        TOKEN_IDENTIFIER = 344,
-        TOKEN_HTYPE = 345,
-        TOKEN_TIME = 346,
-        TOKEN_ENTERPRISE_ID = 347,
-        TOKEN_DHCP4O6_PORT = 348,
-        TOKEN_CONTROL_SOCKET = 349,
-        TOKEN_SOCKET_TYPE = 350,
-        TOKEN_SOCKET_NAME = 351,
-        TOKEN_DHCP_DDNS = 352,
-        TOKEN_ENABLE_UPDATES = 353,
-        TOKEN_QUALIFYING_SUFFIX = 354,
-        TOKEN_SERVER_IP = 355,
-        TOKEN_SERVER_PORT = 356,
-        TOKEN_SENDER_IP = 357,
-        TOKEN_SENDER_PORT = 358,
-        TOKEN_MAX_QUEUE_SIZE = 359,
-        TOKEN_NCR_PROTOCOL = 360,
-        TOKEN_NCR_FORMAT = 361,
-        TOKEN_ALWAYS_INCLUDE_FQDN = 362,
-        TOKEN_OVERRIDE_NO_UPDATE = 363,
-        TOKEN_OVERRIDE_CLIENT_UPDATE = 364,
-        TOKEN_REPLACE_CLIENT_NAME = 365,
-        TOKEN_GENERATED_PREFIX = 366,
-        TOKEN_UDP = 367,
-        TOKEN_TCP = 368,
-        TOKEN_JSON = 369,
-        TOKEN_WHEN_PRESENT = 370,
-        TOKEN_NEVER = 371,
-        TOKEN_ALWAYS = 372,
-        TOKEN_WHEN_NOT_PRESENT = 373,
-        TOKEN_LOGGING = 374,
-        TOKEN_LOGGERS = 375,
-        TOKEN_OUTPUT_OPTIONS = 376,
-        TOKEN_OUTPUT = 377,
-        TOKEN_DEBUGLEVEL = 378,
-        TOKEN_SEVERITY = 379,
-        TOKEN_DHCP4 = 380,
-        TOKEN_DHCPDDNS = 381,
-        TOKEN_TOPLEVEL_JSON = 382,
-        TOKEN_TOPLEVEL_DHCP6 = 383,
-        TOKEN_SUB_DHCP6 = 384,
-        TOKEN_SUB_INTERFACES6 = 385,
-        TOKEN_SUB_SUBNET6 = 386,
-        TOKEN_SUB_POOL6 = 387,
-        TOKEN_SUB_PD_POOL = 388,
-        TOKEN_SUB_RESERVATION = 389,
-        TOKEN_SUB_OPTION_DEF = 390,
-        TOKEN_SUB_OPTION_DATA = 391,
-        TOKEN_SUB_HOOKS_LIBRARY = 392,
-        TOKEN_SUB_DHCP_DDNS = 393,
-        TOKEN_STRING = 394,
-        TOKEN_INTEGER = 395,
-        TOKEN_FLOAT = 396,
-        TOKEN_BOOLEAN = 397
+        TOKEN_CONNECTION_POOL_SIZE = 283,
+        TOKEN_CACHE_SIZE = 284,
+        TOKEN_CONTACT_POINTS = 285,
+        TOKEN_KEYSPACE = 286,
+        TOKEN_PREFERRED_LIFETIME = 287,
+        TOKEN_VALID_LIFETIME = 288,
+        TOKEN_RENEW_TIMER = 289,
+        TOKEN_REBIND_TIMER = 290,
+        TOKEN_DECLINE_PROBATION_PERIOD = 291,
+        TOKEN_SUBNET6 = 292,
+        TOKEN_OPTION_DEF = 293,
+        TOKEN_OPTION_DATA = 294,
+        TOKEN_NAME = 295,
+        TOKEN_DATA = 296,
+        TOKEN_CODE = 297,
+        TOKEN_SPACE = 298,
+        TOKEN_CSV_FORMAT = 299,
+        TOKEN_RECORD_TYPES = 300,
+        TOKEN_ENCAPSULATE = 301,
+        TOKEN_ARRAY = 302,
+        TOKEN_POOLS = 303,
+        TOKEN_POOL = 304,
+        TOKEN_PD_POOLS = 305,
+        TOKEN_PREFIX = 306,
+        TOKEN_PREFIX_LEN = 307,
+        TOKEN_EXCLUDED_PREFIX = 308,
+        TOKEN_EXCLUDED_PREFIX_LEN = 309,
+        TOKEN_DELEGATED_LEN = 310,
+        TOKEN_USER_CONTEXT = 311,
+        TOKEN_SUBNET = 312,
+        TOKEN_INTERFACE = 313,
+        TOKEN_INTERFACE_ID = 314,
+        TOKEN_ID = 315,
+        TOKEN_RAPID_COMMIT = 316,
+        TOKEN_RESERVATION_MODE = 317,
+        TOKEN_MAC_SOURCES = 318,
+        TOKEN_RELAY_SUPPLIED_OPTIONS = 319,
+        TOKEN_HOST_RESERVATION_IDENTIFIERS = 320,
+        TOKEN_CLIENT_CLASSES = 321,
+        TOKEN_TEST = 322,
+        TOKEN_CLIENT_CLASS = 323,
+        TOKEN_RESERVATIONS = 324,
+        TOKEN_IP_ADDRESSES = 325,
+        TOKEN_PREFIXES = 326,
+        TOKEN_DUID = 327,
+        TOKEN_HW_ADDRESS = 328,
+        TOKEN_HOSTNAME = 329,
+        TOKEN_RELAY = 330,
+        TOKEN_IP_ADDRESS = 331,
+        TOKEN_HOOKS_LIBRARIES = 332,
+        TOKEN_LIBRARY = 333,
+        TOKEN_PARAMETERS = 334,
+        TOKEN_EXPIRED_LEASES_PROCESSING = 335,
+        TOKEN_RECLAIM_TIMER_WAIT_TIME = 336,
+        TOKEN_FLUSH_RECLAIMED_TIMER_WAIT_TIME = 337,
+        TOKEN_HOLD_RECLAIMED_TIME = 338,
+        TOKEN_REUSE_QUARANTINE_TIME = 339,
+        TOKEN_MAX_RECLAIM_LEASES = 340,
+        TOKEN_MAX_RECLAIM_TIME = 341,
+        TOKEN_UNWARNED_RECLAIM_CYCLES = 342,
+        TOKEN_SERVER_ID = 343,
+        TOKEN_LLT = 344,
+        TOKEN_EN = 345,
+        TOKEN_LL = 346,
+        TOKEN_IDENTIFIER = 347,
+        TOKEN_HTYPE = 348,
+        TOKEN_TIME = 349,
+        TOKEN_ENTERPRISE_ID = 350,
+        TOKEN_DHCP4O6_PORT = 351,
+        TOKEN_CONTROL_SOCKET = 352,
+        TOKEN_SOCKET_TYPE = 353,
+        TOKEN_SOCKET_NAME = 354,
+        TOKEN_DHCP_DDNS = 355,
+        TOKEN_ENABLE_UPDATES = 356,
+        TOKEN_QUALIFYING_SUFFIX = 357,
+        TOKEN_SERVER_IP = 358,
+        TOKEN_SERVER_PORT = 359,
+        TOKEN_SENDER_IP = 360,
+        TOKEN_SENDER_PORT = 361,
+        TOKEN_MAX_QUEUE_SIZE = 362,
+        TOKEN_NCR_PROTOCOL = 363,
+        TOKEN_NCR_FORMAT = 364,
+        TOKEN_ALWAYS_INCLUDE_FQDN = 365,
+        TOKEN_OVERRIDE_NO_UPDATE = 366,
+        TOKEN_OVERRIDE_CLIENT_UPDATE = 367,
+        TOKEN_REPLACE_CLIENT_NAME = 368,
+        TOKEN_GENERATED_PREFIX = 369,
+        TOKEN_UDP = 370,
+        TOKEN_TCP = 371,
+        TOKEN_JSON = 372,
+        TOKEN_WHEN_PRESENT = 373,
+        TOKEN_NEVER = 374,
+        TOKEN_ALWAYS = 375,
+        TOKEN_WHEN_NOT_PRESENT = 376,
+        TOKEN_LOGGING = 377,
+        TOKEN_LOGGERS = 378,
+        TOKEN_OUTPUT_OPTIONS = 379,
+        TOKEN_OUTPUT = 380,
+        TOKEN_DEBUGLEVEL = 381,
+        TOKEN_SEVERITY = 382,
+        TOKEN_DHCP4 = 383,
+        TOKEN_DHCPDDNS = 384,
+        TOKEN_TOPLEVEL_JSON = 385,
+        TOKEN_TOPLEVEL_DHCP6 = 386,
+        TOKEN_SUB_DHCP6 = 387,
+        TOKEN_SUB_INTERFACES6 = 388,
+        TOKEN_SUB_SUBNET6 = 389,
+        TOKEN_SUB_POOL6 = 390,
+        TOKEN_SUB_PD_POOL = 391,
+        TOKEN_SUB_RESERVATION = 392,
+        TOKEN_SUB_OPTION_DEF = 393,
+        TOKEN_SUB_OPTION_DATA = 394,
+        TOKEN_SUB_HOOKS_LIBRARY = 395,
+        TOKEN_SUB_DHCP_DDNS = 396,
+        TOKEN_STRING = 397,
+        TOKEN_INTEGER = 398,
+        TOKEN_FLOAT = 399,
+        TOKEN_BOOLEAN = 400
       };
     };
 
@@ -704,6 +707,14 @@ namespace isc { namespace dhcp {
     symbol_type
     make_CONNECT_TIMEOUT (const location_type& l);
 
+    static inline
+    symbol_type
+    make_CONNECTION_POOL_SIZE (const location_type& l);
+
+    static inline
+    symbol_type
+    make_CACHE_SIZE (const location_type& l);
+
     static inline
     symbol_type
     make_CONTACT_POINTS (const location_type& l);
@@ -920,6 +931,10 @@ namespace isc { namespace dhcp {
     symbol_type
     make_HOLD_RECLAIMED_TIME (const location_type& l);
 
+    static inline
+    symbol_type
+    make_REUSE_QUARANTINE_TIME (const location_type& l);
+
     static inline
     symbol_type
     make_MAX_RECLAIM_LEASES (const location_type& l);
@@ -1369,12 +1384,12 @@ namespace isc { namespace dhcp {
     enum
     {
       yyeof_ = 0,
-      yylast_ = 777,     ///< Last index in yytable_.
-      yynnts_ = 321,  ///< Number of nonterminal symbols.
+      yylast_ = 789,     ///< Last index in yytable_.
+      yynnts_ = 324,  ///< Number of nonterminal symbols.
       yyfinal_ = 26, ///< Termination state number.
       yyterror_ = 1,
       yyerrcode_ = 256,
-      yyntokens_ = 143  ///< Number of tokens.
+      yyntokens_ = 146  ///< Number of tokens.
     };
 
 
@@ -1430,9 +1445,10 @@ namespace isc { namespace dhcp {
      105,   106,   107,   108,   109,   110,   111,   112,   113,   114,
      115,   116,   117,   118,   119,   120,   121,   122,   123,   124,
      125,   126,   127,   128,   129,   130,   131,   132,   133,   134,
-     135,   136,   137,   138,   139,   140,   141,   142
+     135,   136,   137,   138,   139,   140,   141,   142,   143,   144,
+     145
     };
-    const unsigned int user_token_number_max_ = 397;
+    const unsigned int user_token_number_max_ = 400;
     const token_number_type undef_token_ = 2;
 
     if (static_cast<int>(t) <= yyeof_)
@@ -1465,28 +1481,28 @@ namespace isc { namespace dhcp {
   {
       switch (other.type_get ())
     {
-      case 157: // value
-      case 161: // map_value
-      case 202: // db_type
-      case 394: // duid_type
-      case 427: // ncr_protocol_value
-      case 435: // replace_client_name_value
+      case 160: // value
+      case 164: // map_value
+      case 205: // db_type
+      case 400: // duid_type
+      case 433: // ncr_protocol_value
+      case 441: // replace_client_name_value
         value.copy< ElementPtr > (other.value);
         break;
 
-      case 142: // "boolean"
+      case 145: // "boolean"
         value.copy< bool > (other.value);
         break;
 
-      case 141: // "floating point"
+      case 144: // "floating point"
         value.copy< double > (other.value);
         break;
 
-      case 140: // "integer"
+      case 143: // "integer"
         value.copy< int64_t > (other.value);
         break;
 
-      case 139: // "constant string"
+      case 142: // "constant string"
         value.copy< std::string > (other.value);
         break;
 
@@ -1507,28 +1523,28 @@ namespace isc { namespace dhcp {
     (void) v;
       switch (this->type_get ())
     {
-      case 157: // value
-      case 161: // map_value
-      case 202: // db_type
-      case 394: // duid_type
-      case 427: // ncr_protocol_value
-      case 435: // replace_client_name_value
+      case 160: // value
+      case 164: // map_value
+      case 205: // db_type
+      case 400: // duid_type
+      case 433: // ncr_protocol_value
+      case 441: // replace_client_name_value
         value.copy< ElementPtr > (v);
         break;
 
-      case 142: // "boolean"
+      case 145: // "boolean"
         value.copy< bool > (v);
         break;
 
-      case 141: // "floating point"
+      case 144: // "floating point"
         value.copy< double > (v);
         break;
 
-      case 140: // "integer"
+      case 143: // "integer"
         value.copy< int64_t > (v);
         break;
 
-      case 139: // "constant string"
+      case 142: // "constant string"
         value.copy< std::string > (v);
         break;
 
@@ -1608,28 +1624,28 @@ namespace isc { namespace dhcp {
     // Type destructor.
     switch (yytype)
     {
-      case 157: // value
-      case 161: // map_value
-      case 202: // db_type
-      case 394: // duid_type
-      case 427: // ncr_protocol_value
-      case 435: // replace_client_name_value
+      case 160: // value
+      case 164: // map_value
+      case 205: // db_type
+      case 400: // duid_type
+      case 433: // ncr_protocol_value
+      case 441: // replace_client_name_value
         value.template destroy< ElementPtr > ();
         break;
 
-      case 142: // "boolean"
+      case 145: // "boolean"
         value.template destroy< bool > ();
         break;
 
-      case 141: // "floating point"
+      case 144: // "floating point"
         value.template destroy< double > ();
         break;
 
-      case 140: // "integer"
+      case 143: // "integer"
         value.template destroy< int64_t > ();
         break;
 
-      case 139: // "constant string"
+      case 142: // "constant string"
         value.template destroy< std::string > ();
         break;
 
@@ -1656,28 +1672,28 @@ namespace isc { namespace dhcp {
     super_type::move(s);
       switch (this->type_get ())
     {
-      case 157: // value
-      case 161: // map_value
-      case 202: // db_type
-      case 394: // duid_type
-      case 427: // ncr_protocol_value
-      case 435: // replace_client_name_value
+      case 160: // value
+      case 164: // map_value
+      case 205: // db_type
+      case 400: // duid_type
+      case 433: // ncr_protocol_value
+      case 441: // replace_client_name_value
         value.move< ElementPtr > (s.value);
         break;
 
-      case 142: // "boolean"
+      case 145: // "boolean"
         value.move< bool > (s.value);
         break;
 
-      case 141: // "floating point"
+      case 144: // "floating point"
         value.move< double > (s.value);
         break;
 
-      case 140: // "integer"
+      case 143: // "integer"
         value.move< int64_t > (s.value);
         break;
 
-      case 139: // "constant string"
+      case 142: // "constant string"
         value.move< std::string > (s.value);
         break;
 
@@ -1750,7 +1766,7 @@ namespace isc { namespace dhcp {
      365,   366,   367,   368,   369,   370,   371,   372,   373,   374,
      375,   376,   377,   378,   379,   380,   381,   382,   383,   384,
      385,   386,   387,   388,   389,   390,   391,   392,   393,   394,
-     395,   396,   397
+     395,   396,   397,   398,   399,   400
     };
     return static_cast<token_type> (yytoken_number_[type]);
   }
@@ -1911,6 +1927,18 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_CONNECT_TIMEOUT, l);
   }
 
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_CONNECTION_POOL_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CONNECTION_POOL_SIZE, l);
+  }
+
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_CACHE_SIZE (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_CACHE_SIZE, l);
+  }
+
   Dhcp6Parser::symbol_type
   Dhcp6Parser::make_CONTACT_POINTS (const location_type& l)
   {
@@ -2235,6 +2263,12 @@ namespace isc { namespace dhcp {
     return symbol_type (token::TOKEN_HOLD_RECLAIMED_TIME, l);
   }
 
+  Dhcp6Parser::symbol_type
+  Dhcp6Parser::make_REUSE_QUARANTINE_TIME (const location_type& l)
+  {
+    return symbol_type (token::TOKEN_REUSE_QUARANTINE_TIME, l);
+  }
+
   Dhcp6Parser::symbol_type
   Dhcp6Parser::make_MAX_RECLAIM_LEASES (const location_type& l)
   {
@@ -2604,7 +2638,7 @@ namespace isc { namespace dhcp {
 
 #line 14 "dhcp6_parser.yy" // lalr1.cc:377
 } } // isc::dhcp
-#line 2608 "dhcp6_parser.h" // lalr1.cc:377
+#line 2642 "dhcp6_parser.h" // lalr1.cc:377
 
 
 
@@ -68,6 +68,8 @@ using namespace std;
   LFC_INTERVAL "lfc-interval"
   READONLY "readonly"
   CONNECT_TIMEOUT "connect-timeout"
+  CONNECTION_POOL_SIZE "connection-pool-size"
+  CACHE_SIZE "cache-size"
   CONTACT_POINTS "contact-points"
   KEYSPACE "keyspace"
 
@@ -131,6 +133,7 @@ using namespace std;
   RECLAIM_TIMER_WAIT_TIME "reclaim-timer-wait-time"
   FLUSH_RECLAIMED_TIMER_WAIT_TIME "flush-reclaimed-timer-wait-time"
   HOLD_RECLAIMED_TIME "hold-reclaimed-time"
+  REUSE_QUARANTINE_TIME "reuse-quarantine-time"
   MAX_RECLAIM_LEASES "max-reclaim-leases"
   MAX_RECLAIM_TIME "max-reclaim-time"
   UNWARNED_RECLAIM_CYCLES "unwarned-reclaim-cycles"
@@ -506,6 +509,8 @@ database_map_param: database_type
                   | lfc_interval
                   | readonly
                   | connect_timeout
+                  | connection_pool_size
+                  | cache_size
                   | contact_points
                   | keyspace
                   | unknown_map_entry
@@ -581,6 +586,16 @@ connect_timeout: CONNECT_TIMEOUT COLON INTEGER {
     ctx.stack_.back()->set("connect-timeout", n);
 };
 
+connection_pool_size: CONNECTION_POOL_SIZE COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("connection-pool-size", n);
+};
+
+cache_size: CACHE_SIZE COLON INTEGER {
+    ElementPtr n(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("cache-size", n);
+};
+
 contact_points: CONTACT_POINTS {
     ctx.enter(ctx.NO_KEYWORD);
 } COLON STRING {
@@ -737,6 +752,7 @@ expired_leases_params: expired_leases_param
 expired_leases_param: reclaim_timer_wait_time
                     | flush_reclaimed_timer_wait_time
                     | hold_reclaimed_time
+                    | reuse_quarantine_time
                     | max_reclaim_leases
                     | max_reclaim_time
                     | unwarned_reclaim_cycles
@@ -757,6 +773,11 @@ hold_reclaimed_time: HOLD_RECLAIMED_TIME COLON INTEGER {
     ctx.stack_.back()->set("hold-reclaimed-time", value);
 };
 
+reuse_quarantine_time: REUSE_QUARANTINE_TIME COLON INTEGER {
+    ElementPtr value(new IntElement($3, ctx.loc2pos(@3)));
+    ctx.stack_.back()->set("reuse-quarantine-time", value);
+};
+
 max_reclaim_leases: MAX_RECLAIM_LEASES COLON INTEGER {
     ElementPtr value(new IntElement($3, ctx.loc2pos(@3)));
     ctx.stack_.back()->set("max-reclaim-leases", value);
@@ -48,6 +48,7 @@
 
 #include <util/encode/hex.h>
 #include <util/io_utilities.h>
+#include <util/pool_allocator.h>
 #include <util/range_utilities.h>
 #include <log/logger.h>
 #include <cryptolink/cryptolink.h>
@@ -66,6 +67,7 @@
 
 #include <boost/bind.hpp>
 #include <boost/foreach.hpp>
+#include <boost/make_shared.hpp>
 #include <boost/tokenizer.hpp>
 #include <boost/algorithm/string/erase.hpp>
 #include <boost/algorithm/string/join.hpp>
@@ -2352,7 +2354,9 @@ Dhcpv6Srv::processSolicit(const Pkt6Ptr& solicit) {
     initContext(solicit, ctx);
     setReservedClientClasses(solicit, ctx);
 
-    Pkt6Ptr response(new Pkt6(DHCPV6_ADVERTISE, solicit->getTransid()));
+    Pkt6Ptr response =
+        boost::allocate_shared<Pkt6>(PoolAllocator<Pkt6>(), DHCPV6_ADVERTISE,
+                                     solicit->getTransid());
 
     // Handle Rapid Commit option, if present.
     if (ctx.subnet_ && ctx.subnet_->getRapidCommit()) {
@@ -2398,7 +2402,9 @@ Dhcpv6Srv::processRequest(const Pkt6Ptr& request) {
     initContext(request, ctx);
     setReservedClientClasses(request, ctx);
 
-    Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, request->getTransid()));
+    Pkt6Ptr reply =
+        boost::allocate_shared<Pkt6>(PoolAllocator<Pkt6>(), DHCPV6_REPLY,
+                                     request->getTransid());
 
     processClientFqdn(request, reply, ctx);
     assignLeases(request, reply, ctx);
@@ -2426,7 +2432,9 @@ Dhcpv6Srv::processRenew(const Pkt6Ptr& renew) {
     initContext(renew, ctx);
     setReservedClientClasses(renew, ctx);
 
-    Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, renew->getTransid()));
+    Pkt6Ptr reply =
+        boost::allocate_shared<Pkt6>(PoolAllocator<Pkt6>(), DHCPV6_REPLY,
+                                     renew->getTransid());
 
     processClientFqdn(renew, reply, ctx);
     extendLeases(renew, reply, ctx);
@@ -2454,7 +2462,9 @@ Dhcpv6Srv::processRebind(const Pkt6Ptr& rebind) {
     initContext(rebind, ctx);
     setReservedClientClasses(rebind, ctx);
 
-    Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, rebind->getTransid()));
+    Pkt6Ptr reply =
+        boost::allocate_shared<Pkt6>(PoolAllocator<Pkt6>(), DHCPV6_REPLY,
+                                     rebind->getTransid());
 
     processClientFqdn(rebind, reply, ctx);
     extendLeases(rebind, reply, ctx);
@@ -2490,7 +2500,9 @@ Dhcpv6Srv::processConfirm(const Pkt6Ptr& confirm) {
     }
 
     // The server sends Reply message in response to Confirm.
-    Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, confirm->getTransid()));
+    Pkt6Ptr reply =
+        boost::allocate_shared<Pkt6>(PoolAllocator<Pkt6>(), DHCPV6_REPLY,
+                                     confirm->getTransid());
     // Make sure that the necessary options are included.
     copyClientOptions(confirm, reply);
     CfgOptionList co_list;
@@ -2575,7 +2587,9 @@ Dhcpv6Srv::processRelease(const Pkt6Ptr& release) {
     initContext(release, ctx);
     setReservedClientClasses(release, ctx);
 
-    Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, release->getTransid()));
+    Pkt6Ptr reply =
+        boost::allocate_shared<Pkt6>(PoolAllocator<Pkt6>(), DHCPV6_REPLY,
+                                     release->getTransid());
 
     copyClientOptions(release, reply);
     CfgOptionList co_list;
@@ -2597,7 +2611,9 @@ Dhcpv6Srv::processDecline(const Pkt6Ptr& decline) {
     sanityCheck(decline, MANDATORY, MANDATORY);
 
     // Create an empty Reply message.
-    Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, decline->getTransid()));
+    Pkt6Ptr reply =
+        boost::allocate_shared<Pkt6>(PoolAllocator<Pkt6>(), DHCPV6_REPLY,
+                                     decline->getTransid());
 
     // Let's create a simplified client context here.
     AllocEngine::ClientContext6 ctx;
@@ -2886,7 +2902,9 @@ Dhcpv6Srv::processInfRequest(const Pkt6Ptr& inf_request) {
     setReservedClientClasses(inf_request, ctx);
 
     // Create a Reply packet, with the same trans-id as the client's.
-    Pkt6Ptr reply(new Pkt6(DHCPV6_REPLY, inf_request->getTransid()));
+    Pkt6Ptr reply =
+        boost::allocate_shared<Pkt6>(PoolAllocator<Pkt6>(), DHCPV6_REPLY,
+                                     inf_request->getTransid());
 
     // Copy client options (client-id, also relay information if present)
     copyClientOptions(inf_request, reply);
@@ -4897,7 +4897,8 @@ TEST_F(Dhcp6ParserTest, expiredLeasesProcessing) {
         "    \"hold-reclaimed-time\": 1800,"
         "    \"max-reclaim-leases\": 50,"
         "    \"max-reclaim-time\": 100,"
-        "    \"unwarned-reclaim-cycles\": 10"
+        "    \"unwarned-reclaim-cycles\": 10,"
+        "    \"reuse-quarantine-time\": 30"
         "},"
         "\"subnet6\": [ ]"
         "}";
@@ -4924,6 +4925,7 @@ TEST_F(Dhcp6ParserTest, expiredLeasesProcessing) {
     EXPECT_EQ(50, cfg->getMaxReclaimLeases());
     EXPECT_EQ(100, cfg->getMaxReclaimTime());
     EXPECT_EQ(10, cfg->getUnwarnedReclaimCycles());
+    EXPECT_EQ(30, cfg->getReuseQuarantineTime());
 }
 
 // Check that invalid configuration for the expired leases processing is
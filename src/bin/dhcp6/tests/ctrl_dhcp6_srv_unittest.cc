@@ -516,6 +516,8 @@ TEST_F(CtrlDhcpv6SrvTest, commandsRegistration) {
     ASSERT_TRUE(answer->get("arguments"));
     std::string command_list = answer->get("arguments")->str();
 
+    EXPECT_TRUE(command_list.find("\"lease6-export\"") != string::npos);
+    EXPECT_TRUE(command_list.find("\"lease6-get-page\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"list-commands\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get\"") != string::npos);
     EXPECT_TRUE(command_list.find("\"statistic-get-all\"") != string::npos);
@@ -711,4 +713,72 @@ TEST_F(CtrlChannelDhcpv6SrvTest, controlChannelStats) {
               response);
 }
 
+// This test verifies that the leases can be read in pages using the
+// lease6-get-page command.
+TEST_F(CtrlChannelDhcpv6SrvTest, lease6GetPage) {
+    createUnixChannelServer();
+
+    // Add leases in two subnets.
+    LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    for (uint32_t i = 1; i <= 5; ++i) {
+        DuidPtr duid(new DUID(DUID::fromText("00:01:02:03:04:0" +
+                                             std::string(1, '0' + i)).getDuid()));
+        Lease6Ptr lease(new Lease6(Lease::TYPE_NA,
+                                   IOAddress("3000::" + std::string(1, '0' + i)),
+                                   duid, i, 50, 60, 10, 20,
+                                   SubnetID(i % 2 + 1)));
+        ASSERT_TRUE(lease_mgr.addLease(lease));
+    }
+
+    // Get the first page.
+    std::string response;
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"from\": \"start\", \"limit\": 2 } }",
+                    response);
+    ConstElementPtr answer;
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    int status = -1;
+    ConstElementPtr args = parseAnswer(status, answer);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status) << response;
+    ASSERT_TRUE(args);
+    ASSERT_TRUE(args->get("count"));
+    EXPECT_EQ(2, args->get("count")->intValue());
+    ConstElementPtr leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("3000::1", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ("00:01:02:03:04:01",
+              leases->get(0)->get("duid")->stringValue());
+    EXPECT_EQ("IA_NA", leases->get(0)->get("type")->stringValue());
+    EXPECT_EQ(2, leases->get(0)->get("subnet-id")->intValue());
+    EXPECT_EQ("3000::2", leases->get(1)->get("ip-address")->stringValue());
+
+    // Get the next page of the leases in the subnet 2.
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"from\": \"3000::1\", "
+                    "\"subnet-id\": 2 } }", response);
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    args = parseAnswer(status, answer);
+    ASSERT_EQ(CONTROL_RESULT_SUCCESS, status) << response;
+    leases = args->get("leases");
+    ASSERT_TRUE(leases);
+    ASSERT_EQ(2, leases->size());
+    EXPECT_EQ("3000::3", leases->get(0)->get("ip-address")->stringValue());
+    EXPECT_EQ("3000::5", leases->get(1)->get("ip-address")->stringValue());
+
+    // Invalid arguments are reported.
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"from\": \"192.0.2.1\" } }",
+                    response);
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    parseAnswer(status, answer);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status);
+
+    sendUnixCommand("{ \"command\": \"lease6-get-page\", "
+                    "\"arguments\": { \"limit\": 0 } }", response);
+    ASSERT_NO_THROW(answer = Element::fromJSON(response));
+    parseAnswer(status, answer);
+    EXPECT_EQ(CONTROL_RESULT_ERROR, status);
+}
+
 } // End of anonymous namespace
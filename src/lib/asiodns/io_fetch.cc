@@ -21,6 +21,7 @@
 #include <dns/rcode.h>
 #include <util/buffer.h>
 #include <util/random/qid_gen.h>
+#include <util/threads/sync.h>
 
 #include <boost/bind.hpp>
 #include <boost/scoped_ptr.hpp>
@@ -36,12 +37,30 @@ using namespace isc::asiolink;
 using namespace isc::dns;
 using namespace isc::util;
 using namespace isc::util::random;
+using namespace isc::util::thread;
 using namespace isc::log;
 using namespace std;
 
 namespace isc {
 namespace asiodns {
 
+namespace {
+
+/// \brief Mutex protecting the QID generator.
+///
+/// The generator is shared by all fetches, which may be created by
+/// the different threads.
+Mutex qid_mutex;
+
+/// \brief Generates the QID for the new fetch.
+isc::dns::qid_t
+generateQid() {
+    Mutex::Locker lock(qid_mutex);
+    return (QidGenerator::getInstance().generateQid());
+}
+
+}
+
 // Log debug verbosity
 
 const int DBG_IMPORTANT = DBGLVL_TRACE_BASIC;
@@ -86,6 +105,7 @@ struct IOFetchData {
     uint8_t                     staging[IOFetch::STAGING_LENGTH];
                                             ///< Temporary array for received data
     isc::dns::qid_t             qid;         ///< The QID set in the query
+    IOStrandPtr                 strand;      ///< Strand running the handlers
 
     /// \brief Constructor
     ///
@@ -135,7 +155,8 @@ struct IOFetchData {
         packet(false),
         origin(ASIODNS_UNKNOWN_ORIGIN),
         staging(),
-        qid(QidGenerator::getInstance().generateQid())
+        qid(generateQid()),
+        strand()
     {}
 
     // Checks if the response we received was ok;
@@ -224,12 +245,25 @@ IOFetch::getProtocol() const {
     return (data_->protocol);
 }
 
+void
+IOFetch::setStrand(const IOStrandPtr& strand) {
+    data_->strand = strand;
+}
+
 /// The function operator is implemented with the "stackless coroutine"
 /// pattern; see internal/coroutine.h for details.
 
 void
 IOFetch::operator()(boost::system::error_code ec, size_t length) {
 
+    // The completion handlers are invoked by any thread running the IO
+    // service, so they are moved to the strand.
+    if (data_->strand && !data_->strand->runningInThisThread()) {
+        data_->strand->post(boost::bind(&IOFetch::operator(), *this, ec,
+                                        length));
+        return;
+    }
+
     if (data_->stopped) {
         return;
     } else if (ec) {
@@ -329,6 +363,11 @@ IOFetch::operator()(boost::system::error_code ec, size_t length) {
 void
 IOFetch::stop(Result result) {
 
+    if (data_->strand && !data_->strand->runningInThisThread()) {
+        data_->strand->post(boost::bind(&IOFetch::stop, *this, result));
+        return;
+    }
+
     if (!data_->stopped) {
 
         // Mark the fetch as stopped to prevent other completion callbacks
@@ -336,12 +375,9 @@ IOFetch::stop(Result result) {
         // cancel calls again.
         //
         // In a single threaded environment, the callbacks won't be invoked
-        // until this one completes. In a multi-threaded environment, they may
-        // well be, in which case the testing (and setting) of the stopped_
-        // variable should be done inside a mutex (and the stopped_ variable
-        // declared as "volatile").
-        //
-        // TODO: Update testing of stopped_ if threads are used.
+        // until this one completes. In a multi-threaded environment, all
+        // of them are run in the strand, so they are not invoked
+        // concurrently either.
         data_->stopped = true;
         switch (result) {
             case TIME_OUT:
@@ -16,6 +16,7 @@
 #include <boost/system/error_code.hpp>
 #include <asiolink/io_address.h>
 #include <asiolink/io_service.h>
+#include <asiolink/io_strand.h>
 
 #include <util/buffer.h>
 #include <dns/question.h>
@@ -186,6 +187,15 @@ public:
     /// \return Protocol associated with this IOFetch object.
     Protocol getProtocol() const;
 
+    /// \brief Sets the strand running the handlers of the fetch.
+    ///
+    /// When the IO service is run by many threads, the completion
+    /// handlers of the fetch and the callback are run in this strand.
+    /// The strand must be set before the fetch is started.
+    ///
+    /// \param strand Pointer to the strand.
+    void setStrand(const isc::asiolink::IOStrandPtr& strand);
+
     /// \brief Coroutine entry point
     ///
     /// The operator() method is the method in which the coroutine code enters
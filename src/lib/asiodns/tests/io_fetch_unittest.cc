@@ -9,6 +9,7 @@
 #include <asiolink/io_address.h>
 #include <asiolink/io_endpoint.h>
 #include <asiolink/io_service.h>
+#include <asiolink/io_strand.h>
 #include <asiodns/io_fetch.h>
 #include <dns/question.h>
 #include <dns/message.h>
@@ -65,6 +66,7 @@ public:
     IOFetch::Protocol protocol_;    ///< Protocol being tested
     size_t          cumulative_;    ///< Cumulative data received by "server".
     deadline_timer  timer_;         ///< Timer to measure timeouts
+    IOStrandPtr     strand_;        ///< Strand set for the fetch (if any)
 
     // The next member is the buffer in which the "server" (implemented by the
     // response handler methods in this class) receives the question sent by the
@@ -101,6 +103,7 @@ public:
         protocol_(IOFetch::TCP),        // for initialization - will be changed
         cumulative_(0),
         timer_(service_.get_io_service()),
+        strand_(),
         receive_buffer_(),
         expected_buffer_(new OutputBuffer(512)),
         send_buffer_(),
@@ -428,6 +431,10 @@ public:
 
         EXPECT_EQ(expected_, result);   // Check correct result returned
         EXPECT_FALSE(run_);             // Check it is run only once
+        if (strand_) {
+            // Check it is run in the strand
+            EXPECT_TRUE(strand_->runningInThisThread());
+        }
         run_ = true;                    // Note success
 
         // If the expected result for SUCCESS, then this should have been called
@@ -620,6 +627,20 @@ TEST_F(IOFetchTest, UdpTimeout) {
     timeoutTest(IOFetch::UDP, udp_fetch_);
 }
 
+// UDP stop test with the handlers run in the strand.
+TEST_F(IOFetchTest, UdpStopStrand) {
+    strand_.reset(new IOStrand(service_));
+    udp_fetch_.setStrand(strand_);
+    stopTest(IOFetch::UDP, udp_fetch_);
+}
+
+// UDP timeout test with the handlers run in the strand.
+TEST_F(IOFetchTest, UdpTimeoutStrand) {
+    strand_.reset(new IOStrand(service_));
+    udp_fetch_.setStrand(strand_);
+    timeoutTest(IOFetch::UDP, udp_fetch_);
+}
+
 // UDP SendReceive test.  Set up a UDP server then ports a UDP fetch object.
 // This will send question_ to the server and receive the answer back from it.
 TEST_F(IOFetchTest, UdpSendReceive) {
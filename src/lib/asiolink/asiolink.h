@@ -12,6 +12,7 @@
 // See the description of the namespace below.
 
 #include <asiolink/io_service.h>
+#include <asiolink/io_strand.h>
 #include <asiolink/interval_timer.h>
 
 #include <asiolink/io_address.h>
@@ -15,6 +15,8 @@
 
 #include <exceptions/exceptions.h>
 
+#include <stdint.h>
+
 namespace isc {
 namespace asiolink {
 
@@ -33,15 +35,19 @@ private:
     IntervalTimerImpl(const IntervalTimerImpl& source);
     IntervalTimerImpl& operator=(const IntervalTimerImpl& source);
 public:
-    IntervalTimerImpl(IOService& io_service);
+    IntervalTimerImpl(IOService& io_service, const IOStrandPtr& strand);
     ~IntervalTimerImpl();
     void setup(const IntervalTimer::Callback& cbfunc, const long interval,
                const IntervalTimer::Mode& interval_mode
                = IntervalTimer::REPEATING);
-    void callback(const boost::system::error_code& error);
+    void callback(const boost::system::error_code& error,
+                  const uint64_t generation);
+    void strandCallback(const boost::system::error_code& error,
+                        const uint64_t generation);
     void cancel() {
         timer_.cancel();
         interval_ = 0;
+        ++generation_;
     }
     long getInterval() const { return (interval_); }
 private:
@@ -57,14 +63,23 @@ private:
     // Controls how the timer behaves after expiration.
     IntervalTimer::Mode mode_;
 
+    // Optional strand in which the call back function is called.
+    IOStrandPtr strand_;
+
+    // Incremented whenever the timer is updated or canceled. The expiration
+    // handler queued before that is ignored, rather than calling the call
+    // back function too early.
+    uint64_t generation_;
+
     // interval_ will be set to this value in destructor in order to detect
     // use-after-free type of bugs.
     static const long INVALIDATED_INTERVAL = -1;
 };
 
-IntervalTimerImpl::IntervalTimerImpl(IOService& io_service) :
+IntervalTimerImpl::IntervalTimerImpl(IOService& io_service,
+                                     const IOStrandPtr& strand) :
     interval_(0), timer_(io_service.get_io_service()),
-    mode_(IntervalTimer::REPEATING)
+    mode_(IntervalTimer::REPEATING), strand_(strand), generation_(0)
 {}
 
 IntervalTimerImpl::~IntervalTimerImpl() {
@@ -102,9 +117,12 @@ IntervalTimerImpl::update() {
         timer_.expires_from_now(boost::posix_time::millisec(interval_));
         // Reset timer.
         // Pass a function bound with a shared_ptr to this.
-        timer_.async_wait(boost::bind(&IntervalTimerImpl::callback,
+        timer_.async_wait(boost::bind(strand_ ?
+                                      &IntervalTimerImpl::strandCallback :
+                                      &IntervalTimerImpl::callback,
                                       shared_from_this(),
-                                      boost::asio::placeholders::error));
+                                      boost::asio::placeholders::error,
+                                      ++generation_));
     } catch (const boost::system::system_error& e) {
         isc_throw(isc::Unexpected, "Failed to update timer: " << e.what());
     } catch (const boost::bad_weak_ptr&) {
@@ -114,9 +132,10 @@ IntervalTimerImpl::update() {
 }
 
 void
-IntervalTimerImpl::callback(const boost::system::error_code& ec) {
+IntervalTimerImpl::callback(const boost::system::error_code& ec,
+                            const uint64_t generation) {
     assert(interval_ != INVALIDATED_INTERVAL);
-    if (interval_ == 0 || ec) {
+    if (interval_ == 0 || ec || (generation != generation_)) {
         // timer has been canceled. Do nothing.
     } else {
         // If we should repeat, set next expire time.
@@ -129,10 +148,29 @@ IntervalTimerImpl::callback(const boost::system::error_code& ec) {
     }
 }
 
+void
+IntervalTimerImpl::strandCallback(const boost::system::error_code& ec,
+                                  const uint64_t generation) {
+    // The timer state may only be accessed from within the strand.
+    if (ec != boost::asio::error::operation_aborted) {
+        strand_->dispatch(boost::bind(&IntervalTimerImpl::callback,
+                                      shared_from_this(), ec, generation));
+    }
+}
+
 IntervalTimer::IntervalTimer(IOService& io_service) :
-    impl_(new IntervalTimerImpl(io_service))
+    impl_(new IntervalTimerImpl(io_service, IOStrandPtr()))
 {}
 
+IntervalTimer::IntervalTimer(IOService& io_service,
+                             const IOStrandPtr& strand) :
+    impl_(new IntervalTimerImpl(io_service, strand))
+{
+    if (!strand) {
+        isc_throw(isc::InvalidParameter, "strand must not be null");
+    }
+}
+
 IntervalTimer::~IntervalTimer() {
     // Cancel the timer to make sure cbfunc_() will not be called any more.
     cancel();
@@ -11,6 +11,7 @@
 #include <boost/shared_ptr.hpp>
 
 #include <asiolink/io_service.h>
+#include <asiolink/io_strand.h>
 
 namespace isc {
 namespace asiolink {
@@ -82,6 +83,18 @@ public:
     /// \param io_service A reference to an instance of IOService
     IntervalTimer(IOService& io_service);
 
+    /// \brief The constructor with \c IOService and \c IOStrand.
+    ///
+    /// The call back function is called in the specified strand, i.e.
+    /// it doesn't run concurrently with the other handlers of the strand
+    /// when the \c IOService is run by many threads. The timer must be
+    /// set up and canceled from within the strand.
+    ///
+    /// \param io_service A reference to an instance of IOService
+    /// \param strand Pointer to the strand in which the call back function
+    /// is called.
+    IntervalTimer(IOService& io_service, const IOStrandPtr& strand);
+
     /// \brief The destructor.
     ///
     /// This destructor never throws an exception.
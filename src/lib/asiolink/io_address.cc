@@ -10,7 +10,10 @@
 #include <asiolink/io_error.h>
 #include <exceptions/exceptions.h>
 
-#include <boost/static_assert.hpp>
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <cstring>
 
 #include <unistd.h>             // for some IPC/network system calls
 #include <stdint.h>
@@ -26,29 +29,59 @@ using namespace std;
 namespace isc {
 namespace asiolink {
 
-// XXX: we cannot simply construct the address in the initialization list,
-// because we'd like to throw our own exception on failure.
 IOAddress::IOAddress(const std::string& address_str) {
     boost::system::error_code err;
-    asio_address_ = ip::address::from_string(address_str, err);
+    const ip::address asio_address = ip::address::from_string(address_str,
+                                                              err);
     if (err) {
         isc_throw(IOError, "Failed to convert string to address '"
                   << address_str << "': " << err.message());
     }
+    setAddress(asio_address);
 }
 
-IOAddress::IOAddress(const boost::asio::ip::address& asio_address) :
-    asio_address_(asio_address)
-{}
+IOAddress::IOAddress(const boost::asio::ip::address& asio_address) {
+    setAddress(asio_address);
+}
 
-IOAddress::IOAddress(uint32_t v4address):
-    asio_address_(boost::asio::ip::address_v4(v4address)) {
+IOAddress::IOAddress(uint32_t v4address)
+    : family_(AF_INET), scope_id_(0) {
+    std::memset(bytes_, 0, sizeof(bytes_));
+    bytes_[0] = static_cast<uint8_t>(v4address >> 24);
+    bytes_[1] = static_cast<uint8_t>(v4address >> 16);
+    bytes_[2] = static_cast<uint8_t>(v4address >> 8);
+    bytes_[3] = static_cast<uint8_t>(v4address);
+}
 
+void
+IOAddress::setAddress(const boost::asio::ip::address& asio_address) {
+    std::memset(bytes_, 0, sizeof(bytes_));
+    if (asio_address.is_v4()) {
+        family_ = AF_INET;
+        scope_id_ = 0;
+        const ip::address_v4::bytes_type bytes4 =
+            asio_address.to_v4().to_bytes();
+        std::copy(bytes4.begin(), bytes4.end(), bytes_);
+
+    } else {
+        family_ = AF_INET6;
+        const ip::address_v6 v6 = asio_address.to_v6();
+        scope_id_ = static_cast<uint32_t>(v6.scope_id());
+        const ip::address_v6::bytes_type bytes6 = v6.to_bytes();
+        std::copy(bytes6.begin(), bytes6.end(), bytes_);
+    }
 }
 
 string
 IOAddress::toText() const {
-    return (asio_address_.to_string());
+    if (isV4()) {
+        ip::address_v4::bytes_type bytes4;
+        std::copy(bytes_, bytes_ + V4ADDRESS_LEN, bytes4.begin());
+        return (ip::address_v4(bytes4).to_string());
+    }
+    ip::address_v6::bytes_type bytes6;
+    std::copy(bytes_, bytes_ + V6ADDRESS_LEN, bytes6.begin());
+    return (ip::address_v6(bytes6, scope_id_).to_string());
 }
 
 IOAddress
@@ -61,56 +94,53 @@ IOAddress::fromBytes(short family, const uint8_t* data) {
                   << "are supported");
     }
 
-    BOOST_STATIC_ASSERT(INET6_ADDRSTRLEN >= INET_ADDRSTRLEN);
-    char addr_str[INET6_ADDRSTRLEN];
-    inet_ntop(family, data, addr_str, INET6_ADDRSTRLEN);
-    return IOAddress(string(addr_str));
+    // Start with the zero address of the family and fill in the bytes.
+    IOAddress address(family == AF_INET ? IPV4_ZERO_ADDRESS() :
+                      IPV6_ZERO_ADDRESS());
+    std::memcpy(address.bytes_, data,
+                family == AF_INET ? V4ADDRESS_LEN : V6ADDRESS_LEN);
+    return (address);
 }
 
 std::vector<uint8_t>
 IOAddress::toBytes() const {
-    if (asio_address_.is_v4()) {
-        const boost::asio::ip::address_v4::bytes_type bytes4 =
-            asio_address_.to_v4().to_bytes();
-        return (std::vector<uint8_t>(bytes4.begin(), bytes4.end()));
-    }
-
-    // Not V4 address, so must be a V6 address (else we could never construct
-    // this object).
-    const boost::asio::ip::address_v6::bytes_type bytes6 =
-        asio_address_.to_v6().to_bytes();
-    return (std::vector<uint8_t>(bytes6.begin(), bytes6.end()));
+    return (std::vector<uint8_t>(bytes_, bytes_ + (isV4() ? V4ADDRESS_LEN :
+                                                   V6ADDRESS_LEN)));
 }
 
 short
 IOAddress::getFamily() const {
-    if (asio_address_.is_v4()) {
-        return (AF_INET);
-    } else {
-        return (AF_INET6);
-    }
+    return (family_);
 }
 
 bool
 IOAddress::isV6LinkLocal() const {
-    if (!asio_address_.is_v6()) {
-        return (false);
-    }
-    return (asio_address_.to_v6().is_link_local());
+    // fe80::/10
+    return (isV6() && (bytes_[0] == 0xfe) && ((bytes_[1] & 0xc0) == 0x80));
 }
 
 bool
 IOAddress::isV6Multicast() const {
-    if (!asio_address_.is_v6()) {
-        return (false);
-    }
-    return (asio_address_.to_v6().is_multicast());
+    // ff00::/8
+    return (isV6() && (bytes_[0] == 0xff));
+}
+
+size_t
+IOAddress::hash() const {
+    size_t seed = static_cast<size_t>(family_);
+    boost::hash_combine(seed, scope_id_);
+    boost::hash_range(seed, bytes_, bytes_ + (isV4() ? V4ADDRESS_LEN :
+                                                V6ADDRESS_LEN));
+    return (seed);
 }
 
 uint32_t
 IOAddress::toUint32() const {
-    if (asio_address_.is_v4()) {
-        return (asio_address_.to_v4().to_ulong());
+    if (isV4()) {
+        return ((static_cast<uint32_t>(bytes_[0]) << 24) |
+                (static_cast<uint32_t>(bytes_[1]) << 16) |
+                (static_cast<uint32_t>(bytes_[2]) << 8) |
+                static_cast<uint32_t>(bytes_[3]));
     } else {
         isc_throw(BadValue, "Can't convert " << toText()
                   << " address to IPv4.");
@@ -134,12 +164,8 @@ IOAddress::subtract(const IOAddress& a, const IOAddress& b) {
     } else {
         // v6 is more involved.
 
-        // Let's extract the raw data first.
-        vector<uint8_t> a_vec = a.toBytes();
-        vector<uint8_t> b_vec = b.toBytes();
-
-        // ... and prepare the result
-        vector<uint8_t> result(V6ADDRESS_LEN,0);
+        // Prepare the result.
+        IOAddress result(IPV6_ZERO_ADDRESS());
 
         // Carry is a boolean, but to avoid its frequent casting, let's
         // use uint8_t. Also, some would prefer to call it borrow, but I prefer
@@ -148,30 +174,33 @@ IOAddress::subtract(const IOAddress& a, const IOAddress& b) {
         uint8_t carry = 0;
 
         // Now perform subtraction with borrow.
-        for (int i = a_vec.size() - 1; i >= 0; --i) {
-            result[i] = a_vec[i] - b_vec[i] - carry;
-            carry = (a_vec[i] < b_vec[i] + carry);
+        for (int i = V6ADDRESS_LEN - 1; i >= 0; --i) {
+            result.bytes_[i] = a.bytes_[i] - b.bytes_[i] - carry;
+            carry = (a.bytes_[i] < b.bytes_[i] + carry);
         }
 
-        return (fromBytes(AF_INET6, &result[0]));
+        return (result);
     }
 }
 
 IOAddress
 IOAddress::increase(const IOAddress& addr) {
-    std::vector<uint8_t> packed(addr.toBytes());
+    if (addr.isV4()) {
+        return (IOAddress(addr.toUint32() + 1));
+    }
+
+    IOAddress result(addr);
 
     // Start increasing the least significant byte
-    for (int i = packed.size() - 1; i >= 0; --i) {
+    for (int i = V6ADDRESS_LEN - 1; i >= 0; --i) {
         // if we haven't overflowed (0xff -> 0x0), than we are done
-        if (++packed[i] != 0) {
+        if (++result.bytes_[i] != 0) {
             break;
         }
     }
 
-    return (IOAddress::fromBytes(addr.getFamily(), &packed[0]));
+    return (result);
 }
 
-
 } // namespace asiolink
 } // namespace isc
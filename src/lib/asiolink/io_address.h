@@ -14,6 +14,7 @@
 #include <stdint.h>             // for uint32_t
 #include <boost/asio/ip/address.hpp>
 
+#include <cstring>
 #include <functional>
 #include <string>
 #include <vector>
@@ -32,7 +33,9 @@ namespace asiolink {
 /// \brief The \c IOAddress class represents an IP addresses (version
 /// agnostic)
 ///
-/// This class is a wrapper for the ASIO \c ip::address class.
+/// This class can be converted from and to the ASIO \c ip::address class.
+/// The address is held in a fixed size buffer in the network byte order,
+/// so as it can be copied, compared and hashed without conversions.
 class IOAddress {
 public:
     ///
@@ -92,7 +95,7 @@ public:
     ///
     /// \return true if the address is a V4 address
     bool isV4() const {
-        return (asio_address_.is_v4());
+        return (family_ == AF_INET);
     }
 
     /// \brief Convenience function to check if it is an IPv4 zero address.
@@ -114,7 +117,7 @@ public:
     ///
     /// \return true if the address is a V6 address
     bool isV6() const {
-        return (asio_address_.is_v6());
+        return (family_ == AF_INET6);
     }
 
     /// \brief Convenience function to check if it is an IPv4 zero address.
@@ -154,7 +157,10 @@ public:
     ///
     /// \return true if addresses are equal, false if not.
     bool equals(const IOAddress& other) const {
-        return (asio_address_ == other.asio_address_);
+        // The unused bytes of the IPv4 addresses are zero.
+        return ((family_ == other.family_) &&
+                (scope_id_ == other.scope_id_) &&
+                (std::memcmp(bytes_, other.bytes_, V6ADDRESS_LEN) == 0));
     }
 
     /// \brief Compare addresses for equality
@@ -186,14 +192,16 @@ public:
     /// Comparisons between v4 and v6 will always return v4
     /// being smaller. This follows boost::boost::asio::ip implementation
     bool lessThan(const IOAddress& other) const {
-        if (this->getFamily() == other.getFamily()) {
-            if (this->getFamily() == AF_INET6) {
-                return (this->asio_address_.to_v6() < other.asio_address_.to_v6());
-            } else {
-                return (this->asio_address_.to_v4() < other.asio_address_.to_v4());
+        if (family_ == other.family_) {
+            // The bytes are in the network byte order, so comparing them
+            // gives the numerical order of the addresses.
+            const int cmp = std::memcmp(bytes_, other.bytes_, V6ADDRESS_LEN);
+            if (cmp == 0) {
+                return (scope_id_ < other.scope_id_);
             }
+            return (cmp < 0);
         }
-        return (this->getFamily() < other.getFamily());
+        return (family_ < other.family_);
     }
 
     /// \brief Checks if one address is smaller or equal than the other
@@ -278,6 +286,11 @@ public:
     static IOAddress
     increase(const IOAddress& addr);
 
+    /// @brief Returns the hash value of the address.
+    ///
+    /// @return Hash value suitable for the hashed containers.
+    size_t hash() const;
+
     /// \brief Converts IPv4 address to uint32_t
     ///
     /// Will throw BadValue exception if that is not IPv4
@@ -311,9 +324,36 @@ public:
     //@}
 
 private:
-    boost::asio::ip::address asio_address_;
+
+    /// @brief Sets the address from an ASIO \c ip::address object.
+    ///
+    /// @param asio_address The ASIO address.
+    void setAddress(const boost::asio::ip::address& asio_address);
+
+    /// @brief Address family: AF_INET or AF_INET6.
+    short family_;
+
+    /// @brief Scope identifier of the IPv6 address.
+    uint32_t scope_id_;
+
+    /// @brief Address in the network byte order.
+    ///
+    /// The IPv4 address occupies the first four bytes. The remaining
+    /// bytes are zero.
+    uint8_t bytes_[V6ADDRESS_LEN];
 };
 
+/// @brief Returns the hash value of the address.
+///
+/// This function allows for using the @c IOAddress with @c boost::hash.
+///
+/// @param address The address.
+/// @return Hash value of the address.
+inline size_t
+hash_value(const IOAddress& address) {
+    return (address.hash());
+}
+
 /// \brief Insert the IOAddress as a string into stream.
 ///
 /// This method converts the \c address into a string and inserts it
@@ -7,6 +7,12 @@
 #include <config.h>
 #include <asiolink/asio_wrapper.h>
 #include <asiolink/io_service.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/thread.h>
+
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <vector>
 
 #include <unistd.h>             // for some IPC/network system calls
 #include <netinet/in.h>
@@ -87,9 +93,72 @@ public:
         const CallbackWrapper wrapper(callback);
         io_service_.post(wrapper);
     }
+
+    /// \brief Start the threads running the underlying event loop.
+    ///
+    /// \param thread_count Number of threads to start.
+    void startThreads(const size_t thread_count) {
+        if (thread_count == 0) {
+            isc_throw(BadValue, "number of threads running the IO service"
+                      " must be greater than 0");
+        }
+        if (!threads_.empty()) {
+            isc_throw(InvalidOperation, "threads running the IO service"
+                      " have been already started");
+        }
+        try {
+            for (size_t i = 0; i < thread_count; ++i) {
+                ThreadPtr thread(new util::thread::Thread(
+                    boost::bind(&IOServiceImpl::run, this)));
+                threads_.push_back(thread);
+            }
+        } catch (...) {
+            stopThreads();
+            throw;
+        }
+    }
+
+    /// \brief Stop the threads started with \c startThreads().
+    void stopThreads() {
+        if (threads_.empty()) {
+            return;
+        }
+        io_service_.stop();
+
+        // Wait for all threads before reporting the failure of any of them.
+        boost::scoped_ptr<util::thread::Thread::UncaughtException> error;
+        for (std::vector<ThreadPtr>::const_iterator thread = threads_.begin();
+             thread != threads_.end(); ++thread) {
+            try {
+                (*thread)->wait();
+            } catch (const util::thread::Thread::UncaughtException& ex) {
+                if (!error) {
+                    error.reset(new util::thread::Thread::UncaughtException(ex));
+                }
+            }
+        }
+        threads_.clear();
+        io_service_.reset();
+
+        if (error) {
+            throw *error;
+        }
+    }
+
+    /// \brief Returns the number of threads running the event loop.
+    size_t getThreadCount() const {
+        return (threads_.size());
+    }
+
 private:
+    /// \brief Pointer to the thread running the event loop.
+    typedef boost::shared_ptr<util::thread::Thread> ThreadPtr;
+
     boost::asio::io_service io_service_;
     boost::asio::io_service::work work_;
+
+    /// \brief Threads started with \c startThreads().
+    std::vector<ThreadPtr> threads_;
 };
 
 IOService::IOService() {
@@ -97,6 +166,11 @@ IOService::IOService() {
 }
 
 IOService::~IOService() {
+    try {
+        io_impl_->stopThreads();
+    } catch (...) {
+        // The destructor must not throw.
+    }
     delete io_impl_;
 }
 
@@ -130,5 +204,20 @@ IOService::post(const boost::function<void ()>& callback) {
     return (io_impl_->post(callback));
 }
 
+void
+IOService::startThreads(const size_t thread_count) {
+    io_impl_->startThreads(thread_count);
+}
+
+void
+IOService::stopThreads() {
+    io_impl_->stopThreads();
+}
+
+size_t
+IOService::getThreadCount() const {
+    return (io_impl_->getThreadCount());
+}
+
 } // namespace asiolink
 } // namespace isc
@@ -8,6 +8,8 @@
 #define ASIOLINK_IO_SERVICE_H 1
 
 #include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
+#include <cstddef>
 
 namespace boost {
 namespace asio {
@@ -83,6 +85,34 @@ public:
     /// by small bits that are called from time to time).
     void post(const boost::function<void ()>& callback);
 
+    /// \brief Start the threads running the underlying event loop.
+    ///
+    /// The started threads execute the handlers concurrently with each
+    /// other and with the thread calling \c run() or \c run_one(). The
+    /// handlers which must not run concurrently should be serialized
+    /// with the \c IOStrand.
+    ///
+    /// The threads run until the \c stopThreads() is called.
+    ///
+    /// \param thread_count Number of threads to start.
+    /// \throw isc::BadValue if the number of threads is 0.
+    /// \throw isc::InvalidOperation if the threads are already running.
+    void startThreads(const size_t thread_count);
+
+    /// \brief Stop the threads started with \c startThreads().
+    ///
+    /// This method stops the underlying event loop, waits for the threads
+    /// to terminate and resets the event loop, so as it can be run again.
+    /// It does nothing if no threads are running. It must not be called
+    /// from a handler.
+    ///
+    /// \throw isc::util::thread::Thread::UncaughtException if any of the
+    /// threads terminated by throwing an exception from a handler.
+    void stopThreads();
+
+    /// \brief Returns the number of threads started with \c startThreads().
+    size_t getThreadCount() const;
+
 private:
     IOServiceImpl* io_impl_;
 };
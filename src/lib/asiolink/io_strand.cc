@@ -0,0 +1,52 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/asio_wrapper.h>
+#include <asiolink/io_strand.h>
+
+namespace isc {
+namespace asiolink {
+
+/// \brief Implementation of the \c IOStrand.
+class IOStrandImpl {
+public:
+    /// \brief The constructor.
+    ///
+    /// \param io_service IO service on which the handlers are run.
+    IOStrandImpl(IOService& io_service)
+        : strand_(io_service.get_io_service()) {
+    }
+
+    /// \brief The underlying strand.
+    boost::asio::io_service::strand strand_;
+};
+
+IOStrand::IOStrand(IOService& io_service)
+    : impl_(new IOStrandImpl(io_service)) {
+}
+
+IOStrand::~IOStrand() {
+    delete impl_;
+}
+
+void
+IOStrand::post(const boost::function<void ()>& callback) {
+    impl_->strand_.post(callback);
+}
+
+void
+IOStrand::dispatch(const boost::function<void ()>& callback) {
+    impl_->strand_.dispatch(callback);
+}
+
+bool
+IOStrand::runningInThisThread() const {
+    return (impl_->strand_.running_in_this_thread());
+}
+
+} // namespace asiolink
+} // namespace isc
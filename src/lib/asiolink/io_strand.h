@@ -0,0 +1,66 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ASIOLINK_IO_STRAND_H
+#define ASIOLINK_IO_STRAND_H 1
+
+#include <asiolink/io_service.h>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+
+namespace isc {
+namespace asiolink {
+
+class IOStrandImpl;
+
+/// \brief The \c IOStrand class is a wrapper for the ASIO \c strand class.
+///
+/// When the \c IOService is run by many threads, the handlers may be
+/// executed concurrently. The strand guarantees that none of the handlers
+/// posted or dispatched through it runs concurrently with another one,
+/// and that they are run in the order in which they were posted. The
+/// handlers belonging to the different strands may still run in parallel,
+/// e.g. the handlers of the different connections.
+class IOStrand : public boost::noncopyable {
+public:
+    /// \brief The constructor.
+    ///
+    /// \param io_service IO service on which the handlers are run.
+    explicit IOStrand(IOService& io_service);
+
+    /// \brief The destructor.
+    ~IOStrand();
+
+    /// \brief Post a callback to the strand.
+    ///
+    /// The callback is never called from within this function, even
+    /// if it is called from a handler running in this strand.
+    ///
+    /// \param callback Callback to be called.
+    void post(const boost::function<void ()>& callback);
+
+    /// \brief Dispatch a callback to the strand.
+    ///
+    /// The callback is called from within this function if it is called
+    /// from a handler running in this strand. Otherwise, it is posted.
+    ///
+    /// \param callback Callback to be called.
+    void dispatch(const boost::function<void ()>& callback);
+
+    /// \brief Checks if the current thread runs a handler of this strand.
+    bool runningInThisThread() const;
+
+private:
+    IOStrandImpl* impl_;
+};
+
+/// @brief Defines a smart pointer to an IOStrand instance.
+typedef boost::shared_ptr<IOStrand> IOStrandPtr;
+
+} // namespace asiolink
+} // namespace isc
+#endif // ASIOLINK_IO_STRAND_H
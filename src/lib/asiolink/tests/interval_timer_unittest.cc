@@ -8,6 +8,7 @@
 #include <asiolink/asio_wrapper.h>
 #include <asiolink/asiolink.h>
 
+#include <boost/bind.hpp>
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <gtest/gtest.h>
 
@@ -376,3 +377,37 @@ TEST_F(IntervalTimerTest, timerReuseTest) {
     // Verify the timer repeated.
     EXPECT_GE(one_shot_count, 4);
 }
+
+/// @brief Records if the timer callback was called within the strand.
+///
+/// @param strand Strand in which the callback should be called.
+/// @param [out] in_strand Set to true if the callback was called within
+/// the strand.
+/// @param [out] count Incremented when the callback is called.
+void
+strandTimerCallback(const IOStrandPtr& strand, bool& in_strand, int& count) {
+    in_strand = strand->runningInThisThread();
+    ++count;
+}
+
+// This test verifies that the timer created with the strand calls its
+// callback within this strand.
+TEST_F(IntervalTimerTest, strand) {
+    IOStrandPtr strand(new IOStrand(io_service_));
+    EXPECT_THROW(IntervalTimer(io_service_, IOStrandPtr()),
+                 isc::InvalidParameter);
+
+    bool in_strand = false;
+    int count = 0;
+    IntervalTimer timer(io_service_, strand);
+    timer.setup(boost::bind(&strandTimerCallback, strand,
+                            boost::ref(in_strand), boost::ref(count)),
+                10, IntervalTimer::ONE_SHOT);
+
+    // The expired timer dispatches the callback to the strand, so two
+    // handlers are run.
+    while ((count == 0) && io_service_.get_io_service().run_one()) {
+    }
+    EXPECT_EQ(1, count);
+    EXPECT_TRUE(in_strand);
+}
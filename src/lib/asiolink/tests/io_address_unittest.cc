@@ -11,6 +11,8 @@
 #include <asiolink/io_address.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/functional/hash.hpp>
+
 #include <algorithm>
 #include <cstring>
 #include <vector>
@@ -339,3 +341,30 @@ TEST(IOAddressTest, increaseAddr) {
     EXPECT_EQ(IOAddress("::1"), IOAddress::increase(any6));
     EXPECT_EQ(IOAddress("::"), IOAddress::increase(the_last_one));
 }
+
+// Test checks that equal addresses have equal hash values and that the
+// addresses of different families are distinguished.
+TEST(IOAddressTest, hash) {
+    boost::hash<IOAddress> hasher;
+    EXPECT_EQ(hasher(IOAddress("192.0.2.1")), hasher(IOAddress(0xc0000201)));
+    EXPECT_EQ(hasher(IOAddress("2001:db8::1")),
+              hasher(IOAddress::fromBytes(AF_INET6,
+                                          IOAddress("2001:db8::1").
+                                          toBytes().data())));
+    EXPECT_NE(hasher(IOAddress("192.0.2.1")), hasher(IOAddress("192.0.2.2")));
+    EXPECT_NE(hasher(IOAddress("0.0.0.0")), hasher(IOAddress("::")));
+}
+
+// Test checks that the addresses of the different families and scopes
+// are not equal, and that the IPv4 addresses precede the IPv6 addresses.
+TEST(IOAddressTest, familyAndScope) {
+    EXPECT_NE(IOAddress("0.0.0.0"), IOAddress("::"));
+    EXPECT_TRUE(IOAddress("255.255.255.255") < IOAddress("::"));
+    EXPECT_FALSE(IOAddress("::") < IOAddress("0.0.0.0"));
+
+    IOAddress scoped("fe80::1%1");
+    EXPECT_NE(IOAddress("fe80::1"), scoped);
+    EXPECT_TRUE(IOAddress("fe80::1") < scoped);
+    EXPECT_EQ(scoped, IOAddress(scoped.toText()));
+    EXPECT_TRUE(scoped.isV6LinkLocal());
+}
@@ -5,12 +5,18 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <asiolink/io_service.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
 
 #include <gtest/gtest.h>
 #include <boost/bind.hpp>
+#include <set>
 #include <vector>
 
+using namespace isc;
 using namespace isc::asiolink;
+using namespace isc::util::thread;
 
 namespace {
 
@@ -43,4 +49,97 @@ TEST(IOService, post) {
     EXPECT_EQ(3, called[2]);
 }
 
+/// @brief Counts the handlers executed by the threads.
+class HandlerCounter {
+public:
+
+    /// @brief Constructor.
+    HandlerCounter()
+        : count_(0) {
+    }
+
+    /// @brief Handler recording its thread.
+    void handler() {
+        Mutex::Locker lock(mutex_);
+        threads_.insert(pthread_self());
+        ++count_;
+        cond_.signal();
+    }
+
+    /// @brief Handler throwing an exception after recording its thread.
+    void throwingHandler() {
+        handler();
+        isc_throw(Unexpected, "handler failed");
+    }
+
+    /// @brief Waits until the specified number of handlers was executed.
+    ///
+    /// @param count Number of handlers.
+    void wait(const size_t count) {
+        Mutex::Locker lock(mutex_);
+        while (count_ < count) {
+            cond_.wait(mutex_);
+        }
+    }
+
+    /// @brief Number of the executed handlers.
+    size_t count_;
+
+    /// @brief Threads which executed the handlers.
+    std::set<pthread_t> threads_;
+
+    /// @brief Mutex protecting the counter.
+    Mutex mutex_;
+
+    /// @brief Condition variable signalled by the handlers.
+    CondVar cond_;
+};
+
+// Check the posted events are called by the started threads.
+TEST(IOService, threads) {
+    HandlerCounter counter;
+    IOService service;
+    EXPECT_EQ(0, service.getThreadCount());
+
+    ASSERT_NO_THROW(service.startThreads(4));
+    EXPECT_EQ(4, service.getThreadCount());
+
+    // The threads can't be started twice.
+    EXPECT_THROW(service.startThreads(1), InvalidOperation);
+
+    for (int i = 0; i < 1000; ++i) {
+        service.post(boost::bind(&HandlerCounter::handler, &counter));
+    }
+    counter.wait(1000);
+    ASSERT_NO_THROW(service.stopThreads());
+    EXPECT_EQ(0, service.getThreadCount());
+
+    // The handlers weren't run by this thread.
+    EXPECT_EQ(0, counter.threads_.count(pthread_self()));
+
+    // The service can be run again after stopping the threads.
+    service.post(boost::bind(&HandlerCounter::handler, &counter));
+    service.run_one();
+    EXPECT_EQ(1001, counter.count_);
+    EXPECT_EQ(1, counter.threads_.count(pthread_self()));
+
+    // Stopping the threads which aren't running does nothing.
+    EXPECT_NO_THROW(service.stopThreads());
+
+    // At least one thread must be started.
+    EXPECT_THROW(service.startThreads(0), BadValue);
+}
+
+// Check the exception thrown from a handler is reported when the
+// threads are stopped.
+TEST(IOService, threadException) {
+    HandlerCounter counter;
+    IOService service;
+    ASSERT_NO_THROW(service.startThreads(1));
+    service.post(boost::bind(&HandlerCounter::throwingHandler, &counter));
+    counter.wait(1);
+    EXPECT_THROW(service.stopThreads(), Thread::UncaughtException);
+    EXPECT_EQ(0, service.getThreadCount());
+}
+
 }
@@ -0,0 +1,139 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_service.h>
+#include <asiolink/io_strand.h>
+#include <util/threads/sync.h>
+
+#include <gtest/gtest.h>
+#include <boost/bind.hpp>
+#include <vector>
+
+using namespace isc::asiolink;
+using namespace isc::util::thread;
+
+namespace {
+
+/// @brief Records the order of the handlers run in the strand.
+class StrandTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    StrandTest()
+        : io_service_(), strand_(io_service_), running_(false),
+          concurrent_(false), in_strand_(false), done_(0) {
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Stops the threads in case the test failed.
+    virtual ~StrandTest() {
+        io_service_.stopThreads();
+    }
+
+    /// @brief Handler appending its value to the recorded values.
+    ///
+    /// The values are not protected with the mutex, because the handlers
+    /// are serialized by the strand.
+    ///
+    /// @param value Value to be recorded.
+    void handler(const int value) {
+        if (running_) {
+            concurrent_ = true;
+        }
+        running_ = true;
+        values_.push_back(value);
+        running_ = false;
+
+        Mutex::Locker lock(mutex_);
+        ++done_;
+        cond_.signal();
+    }
+
+    /// @brief Handler dispatching another handler to the strand.
+    ///
+    /// @param value Value to be recorded by the dispatched handler.
+    void dispatchingHandler(const int value) {
+        in_strand_ = strand_.runningInThisThread();
+        strand_.dispatch(boost::bind(&StrandTest::handler, this, value));
+        // The dispatched handler has been already executed.
+        dispatched_ = values_;
+    }
+
+    /// @brief Waits until the specified number of handlers was executed.
+    ///
+    /// @param count Number of handlers.
+    void wait(const size_t count) {
+        Mutex::Locker lock(mutex_);
+        while (done_ < count) {
+            cond_.wait(mutex_);
+        }
+    }
+
+    /// @brief IO service running the handlers.
+    IOService io_service_;
+
+    /// @brief Strand serializing the handlers.
+    IOStrand strand_;
+
+    /// @brief Indicates if the handler is running.
+    bool running_;
+
+    /// @brief Indicates if the handlers ran concurrently.
+    bool concurrent_;
+
+    /// @brief Values recorded by the handlers.
+    std::vector<int> values_;
+
+    /// @brief Values recorded before the dispatch returned.
+    std::vector<int> dispatched_;
+
+    /// @brief Indicates if the dispatching handler ran in the strand.
+    bool in_strand_;
+
+    /// @brief Number of executed handlers.
+    size_t done_;
+
+    /// @brief Mutex protecting the number of executed handlers.
+    Mutex mutex_;
+
+    /// @brief Condition variable signalled by the handlers.
+    CondVar cond_;
+};
+
+// Check that the handlers posted to the strand are run in order, one
+// at a time, even when the IO service is run by many threads.
+TEST_F(StrandTest, post) {
+    ASSERT_NO_THROW(io_service_.startThreads(4));
+    for (int i = 0; i < 1000; ++i) {
+        strand_.post(boost::bind(&StrandTest::handler, this, i));
+    }
+    wait(1000);
+    ASSERT_NO_THROW(io_service_.stopThreads());
+
+    EXPECT_FALSE(concurrent_);
+    ASSERT_EQ(1000, values_.size());
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(i, values_[i]);
+    }
+}
+
+// Check that the handler dispatched from the strand is called immediately.
+TEST_F(StrandTest, dispatch) {
+    EXPECT_FALSE(strand_.runningInThisThread());
+
+    strand_.post(boost::bind(&StrandTest::dispatchingHandler, this, 1));
+    // Nothing is called until the IO service is run.
+    EXPECT_TRUE(values_.empty());
+    io_service_.run_one();
+
+    EXPECT_TRUE(in_strand_);
+    ASSERT_EQ(1, dispatched_.size());
+    EXPECT_EQ(1, dispatched_[0]);
+}
+
+}
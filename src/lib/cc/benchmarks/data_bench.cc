@@ -0,0 +1,146 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <cc/data.h>
+#include <util/stopwatch.h>
+
+#include <boost/lexical_cast.hpp>
+
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+
+using namespace std;
+using namespace isc::data;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Generates the JSON text resembling a DHCPv4 server configuration.
+///
+/// @param subnets Number of subnets in the configuration.
+/// @return JSON text.
+string
+generateConfig(const unsigned subnets) {
+    ostringstream s;
+    s << "{ \"Dhcp4\": { \"valid-lifetime\": 4000, \"subnet4\": [\n";
+    for (unsigned i = 0; i < subnets; ++i) {
+        const unsigned a = (i >> 8) & 0xff;
+        const unsigned b = i & 0xff;
+        if (i > 0) {
+            s << ",\n";
+        }
+        s << "  { \"id\": " << (i + 1) << ", \"subnet\": \"10." << a << "."
+          << b << ".0/24\",\n"
+          << "    \"pools\": [ { \"pool\": \"10." << a << "." << b
+          << ".10 - 10." << a << "." << b << ".200\" } ],\n"
+          << "    \"option-data\": [ { \"name\": \"routers\", \"data\": \"10."
+          << a << "." << b << ".1\" } ],\n"
+          << "    \"reservations\": [ { \"hw-address\": \"00:01:02:03:"
+          << hex << a << ":" << b << dec << "\", \"ip-address\": \"10." << a
+          << "." << b << ".5\", \"hostname\": \"host-" << i << "\" } ],\n"
+          << "    \"match-client-id\": true, \"renew-timer\": 1000.5 }";
+    }
+    s << "\n] } }\n";
+    return (s.str());
+}
+
+/// @brief Runs the function and prints its duration.
+///
+/// @param name Name of the benchmark.
+/// @param iterations Number of times the benchmark is run.
+/// @param size Size of the processed JSON text.
+/// @param fun Function to be run.
+template<typename Function>
+void
+run(const string& name, const unsigned iterations, const size_t size,
+    Function fun) {
+    Stopwatch stopwatch;
+    for (unsigned i = 0; i < iterations; ++i) {
+        fun();
+    }
+    stopwatch.stop();
+    const long usecs = stopwatch.getTotalMicroseconds();
+    cout << name << ": " << (usecs / iterations) << " us per iteration, "
+         << (usecs > 0 ? static_cast<double>(size) * iterations / usecs : 0)
+         << " MB/s" << endl;
+}
+
+/// @brief Parses the JSON from the std::istream.
+struct ParseStream {
+    const string& text_;
+    void operator()() const {
+        istringstream s(text_);
+        Element::fromJSON(s);
+    }
+};
+
+/// @brief Parses the JSON from the string.
+struct ParseString {
+    const string& text_;
+    void operator()() const {
+        Element::fromJSON(text_);
+    }
+};
+
+/// @brief Serializes the JSON into the std::ostream.
+struct SerializeStream {
+    const ConstElementPtr& element_;
+    void operator()() const {
+        ostringstream s;
+        element_->toJSON(s);
+    }
+};
+
+/// @brief Serializes the JSON into the string.
+struct SerializeString {
+    const ConstElementPtr& element_;
+    void operator()() const {
+        element_->str();
+    }
+};
+
+}
+
+int
+main(int argc, char* argv[]) {
+    unsigned subnets = 1000;
+    unsigned iterations = 10;
+    try {
+        if (argc > 1) {
+            subnets = boost::lexical_cast<unsigned>(argv[1]);
+        }
+        if (argc > 2) {
+            iterations = boost::lexical_cast<unsigned>(argv[2]);
+        }
+    } catch (const boost::bad_lexical_cast&) {
+        cerr << "usage: data_bench [subnets [iterations]]" << endl;
+        return (1);
+    }
+    if (iterations == 0) {
+        iterations = 1;
+    }
+
+    const string text = generateConfig(subnets);
+    const ConstElementPtr element = Element::fromJSON(text);
+    const size_t size = element->str().size();
+
+    cout << "JSON text of " << text.size() << " bytes, " << iterations
+         << " iterations" << endl;
+
+    ParseStream parse_stream = { text };
+    run("fromJSON(std::istream&)", iterations, text.size(), parse_stream);
+    ParseString parse_string = { text };
+    run("fromJSON(const std::string&)", iterations, text.size(), parse_string);
+    SerializeStream serialize_stream = { element };
+    run("toJSON(std::ostream&)", iterations, size, serialize_stream);
+    SerializeString serialize_string = { element };
+    run("str()", iterations, size, serialize_string);
+
+    return (0);
+}
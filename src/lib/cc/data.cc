@@ -47,20 +47,6 @@ operator<<(std::ostream& out, const Element::Position& pos) {
     return (out);
 }
 
-std::string
-Element::str() const {
-    std::stringstream ss;
-    toJSON(ss);
-    return (ss.str());
-}
-
-std::string
-Element::toWire() const {
-    std::stringstream ss;
-    toJSON(ss);
-    return (ss.str());
-}
-
 void
 Element::toWire(std::ostream& ss) const {
     toJSON(ss);
@@ -273,20 +259,78 @@ Element::createMap(const Position& pos) {
 //
 // helper functions for fromJSON factory
 //
+// The parsing functions are templates accepting any input providing the
+// peek(), get(), ignore() and putback() functions of the std::istream.
+// They are used with the std::istream and with the @c BufferReader, which
+// reads the JSON directly from the memory and is much faster.
+//
 namespace {
+
+/// @brief Input reading JSON text held in the memory.
+///
+/// It provides the subset of the std::istream interface used by the
+/// parsing functions, but without the stream state checks and the virtual
+/// calls of the stream buffer for each character.
+class BufferReader {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param data Pointer to the beginning of the text.
+    /// @param size Length of the text.
+    BufferReader(const char* data, const size_t size)
+        : current_(data), end_(data + size) {
+    }
+
+    /// @brief Returns the next character without consuming it.
+    int peek() const {
+        return (current_ != end_ ? static_cast<unsigned char>(*current_) : EOF);
+    }
+
+    /// @brief Returns the next character and consumes it.
+    int get() {
+        return (current_ != end_ ? static_cast<unsigned char>(*current_++) :
+                EOF);
+    }
+
+    /// @brief Consumes the next character.
+    void ignore() {
+        if (current_ != end_) {
+            ++current_;
+        }
+    }
+
+    /// @brief Returns the last consumed character to the input.
+    void putback(char) {
+        --current_;
+    }
+
+private:
+
+    /// @brief Position of the next character.
+    const char* current_;
+
+    /// @brief End of the text.
+    const char* end_;
+};
+
 bool
 charIn(const int c, const char* chars) {
-    const size_t chars_len = std::strlen(chars);
-    for (size_t i = 0; i < chars_len; ++i) {
-        if (chars[i] == c) {
+    for (; *chars != '\0'; ++chars) {
+        if (*chars == c) {
             return (true);
         }
     }
     return (false);
 }
 
+template<typename Input>
+ElementPtr
+fromJSONValue(Input& in, const std::string& file, int& line, int& pos);
+
+template<typename Input>
 void
-skipChars(std::istream& in, const char* chars, int& line, int& pos) {
+skipChars(Input& in, const char* chars, int& line, int& pos) {
     int c = in.peek();
     while (charIn(c, chars) && c != EOF) {
         if (c == '\n') {
@@ -305,8 +349,9 @@ skipChars(std::istream& in, const char* chars, int& line, int& pos) {
 // unless that character is specified in the optional may_skip
 //
 // It returns the found character (as an int value).
+template<typename Input>
 int
-skipTo(std::istream& in, const std::string& file, int& line,
+skipTo(Input& in, const std::string& file, int& line,
        int& pos, const char* chars, const char* may_skip="")
 {
     int c = in.get();
@@ -340,11 +385,12 @@ skipTo(std::istream& in, const std::string& file, int& line,
 
 // TODO: Should we check for all other official escapes here (and
 // error on the rest)?
+template<typename Input>
 std::string
-strFromStringstream(std::istream& in, const std::string& file,
+strFromStringstream(Input& in, const std::string& file,
                     const int line, int& pos) throw (JSONError)
 {
-    std::stringstream ss;
+    std::string str;
     int c = in.get();
     ++pos;
     if (c == '"') {
@@ -389,43 +435,46 @@ strFromStringstream(std::istream& in, const std::string& file,
             in.ignore();
             ++pos;
         }
-        ss.put(c);
+        str.push_back(static_cast<char>(c));
         c = in.get();
         ++pos;
     }
     if (c == EOF) {
         throwJSONError("Unterminated string", file, line, pos);
     }
-    return (ss.str());
+    return (str);
 }
 
+template<typename Input>
 std::string
-wordFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
+wordFromStringstream(Input& in, int& pos) {
+    std::string word;
     while (isalpha(in.peek())) {
-        ss << (char) in.get();
+        word.push_back(static_cast<char>(in.get()));
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += word.size();
+    return (word);
 }
 
+template<typename Input>
 std::string
-numberFromStringstream(std::istream& in, int& pos) {
-    std::stringstream ss;
+numberFromStringstream(Input& in, int& pos) {
+    std::string number;
     while (isdigit(in.peek()) || in.peek() == '+' || in.peek() == '-' ||
            in.peek() == '.' || in.peek() == 'e' || in.peek() == 'E') {
-        ss << (char) in.get();
+        number.push_back(static_cast<char>(in.get()));
     }
-    pos += ss.str().size();
-    return (ss.str());
+    pos += number.size();
+    return (number);
 }
 
 // Should we change from IntElement and DoubleElement to NumberElement
 // that can also hold an e value? (and have specific getters if the
 // value is larger than an int can handle)
 //
+template<typename Input>
 ElementPtr
-fromStringstreamNumber(std::istream& in, const std::string& file,
+fromStringstreamNumber(Input& in, const std::string& file,
                        const int& line, int& pos) {
     // Remember position where the value starts. It will be set in the
     // Position structure of the Element to be created.
@@ -453,8 +502,9 @@ fromStringstreamNumber(std::istream& in, const std::string& file,
     return (ElementPtr());
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamBool(std::istream& in, const std::string& file,
+fromStringstreamBool(Input& in, const std::string& file,
                      const int line, int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -476,8 +526,9 @@ fromStringstreamBool(std::istream& in, const std::string& file,
     return (ElementPtr());
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamNull(std::istream& in, const std::string& file,
+fromStringstreamNull(Input& in, const std::string& file,
                      const int line, int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -494,8 +545,9 @@ fromStringstreamNull(std::istream& in, const std::string& file,
     }
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamString(std::istream& in, const std::string& file, int& line,
+fromStringstreamString(Input& in, const std::string& file, int& line,
                        int& pos)
 {
     // Remember position where the value starts. It will be set in the
@@ -507,8 +559,9 @@ fromStringstreamString(std::istream& in, const std::string& file, int& line,
                                                             start_pos)));
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamList(std::istream& in, const std::string& file, int& line,
+fromStringstreamList(Input& in, const std::string& file, int& line,
                      int& pos)
 {
     int c = 0;
@@ -518,7 +571,7 @@ fromStringstreamList(std::istream& in, const std::string& file, int& line,
     skipChars(in, WHITESPACE, line, pos);
     while (c != EOF && c != ']') {
         if (in.peek() != ']') {
-            cur_list_element = Element::fromJSON(in, file, line, pos);
+            cur_list_element = fromJSONValue(in, file, line, pos);
             list->add(cur_list_element);
             c = skipTo(in, file, line, pos, ",]", WHITESPACE);
         } else {
@@ -529,8 +582,9 @@ fromStringstreamList(std::istream& in, const std::string& file, int& line,
     return (list);
 }
 
+template<typename Input>
 ElementPtr
-fromStringstreamMap(std::istream& in, const std::string& file, int& line,
+fromStringstreamMap(Input& in, const std::string& file, int& line,
                     int& pos)
 {
     ElementPtr map = Element::createMap(Element::Position(file, line, pos));
@@ -548,7 +602,7 @@ fromStringstreamMap(std::istream& in, const std::string& file, int& line,
             skipTo(in, file, line, pos, ":", WHITESPACE);
             // skip the :
 
-            ConstElementPtr value = Element::fromJSON(in, file, line, pos);
+            ConstElementPtr value = fromJSONValue(in, file, line, pos);
             map->set(key, value);
 
             c = skipTo(in, file, line, pos, ",}", WHITESPACE);
@@ -556,6 +610,217 @@ fromStringstreamMap(std::istream& in, const std::string& file, int& line,
     }
     return (map);
 }
+
+template<typename Input>
+ElementPtr
+fromJSONValue(Input& in, const std::string& file, int& line, int& pos) {
+    int c = 0;
+    ElementPtr element;
+    bool el_read = false;
+    skipChars(in, WHITESPACE, line, pos);
+    while (c != EOF && !el_read) {
+        c = in.get();
+        pos++;
+        switch(c) {
+            case '1':
+            case '2':
+            case '3':
+            case '4':
+            case '5':
+            case '6':
+            case '7':
+            case '8':
+            case '9':
+            case '0':
+            case '-':
+            case '+':
+            case '.':
+                in.putback(c);
+                --pos;
+                element = fromStringstreamNumber(in, file, line, pos);
+                el_read = true;
+                break;
+            case 't':
+            case 'f':
+                in.putback(c);
+                --pos;
+                element = fromStringstreamBool(in, file, line, pos);
+                el_read = true;
+                break;
+            case 'n':
+                in.putback(c);
+                --pos;
+                element = fromStringstreamNull(in, file, line, pos);
+                el_read = true;
+                break;
+            case '"':
+                in.putback('"');
+                --pos;
+                element = fromStringstreamString(in, file, line, pos);
+                el_read = true;
+                break;
+            case '[':
+                element = fromStringstreamList(in, file, line, pos);
+                el_read = true;
+                break;
+            case '{':
+                element = fromStringstreamMap(in, file, line, pos);
+                el_read = true;
+                break;
+            case EOF:
+                break;
+            default:
+                throwJSONError(std::string("error: unexpected character ") + std::string(1, c), file, line, pos);
+                break;
+        }
+    }
+    if (el_read) {
+        return (element);
+    } else {
+        isc_throw(JSONError, "nothing read");
+    }
+}
+
+//
+// helper functions for the JSON serialization into a string
+//
+
+void
+appendJSON(const Element& element, std::string& out);
+
+void
+appendJSONString(const std::string& str, std::string& out) {
+    static const char hex_digits[] = "0123456789abcdef";
+    out.push_back('"');
+    for (size_t i = 0; i < str.size(); ++i) {
+        const char c = str[i];
+        // Escape characters as defined in JSON spec
+        // Note that we do not escape forward slash; this
+        // is allowed, but not mandatory.
+        switch (c) {
+        case '"':
+            out.append("\\\"");
+            break;
+        case '\\':
+            out.append("\\\\");
+            break;
+        case '\b':
+            out.append("\\b");
+            break;
+        case '\f':
+            out.append("\\f");
+            break;
+        case '\n':
+            out.append("\\n");
+            break;
+        case '\r':
+            out.append("\\r");
+            break;
+        case '\t':
+            out.append("\\t");
+            break;
+        default:
+            if ((c >= 0) && (c < 0x20)) {
+                out.append("\\u00");
+                out.push_back(hex_digits[(c >> 4) & 0xf]);
+                out.push_back(hex_digits[c & 0xf]);
+            } else {
+                out.push_back(c);
+            }
+        }
+    }
+    out.push_back('"');
+}
+
+void
+appendJSONInteger(const int64_t value, std::string& out) {
+    // Digits are written from the end of the buffer. The value is
+    // converted to unsigned, so as the minimal value is handled.
+    char buf[24];
+    char* end = buf + sizeof(buf);
+    char* begin = end;
+    uint64_t abs_value = (value < 0 ? 0 - static_cast<uint64_t>(value) :
+                          static_cast<uint64_t>(value));
+    do {
+        *--begin = static_cast<char>('0' + abs_value % 10);
+        abs_value /= 10;
+    } while (abs_value != 0);
+    if (value < 0) {
+        *--begin = '-';
+    }
+    out.append(begin, end);
+}
+
+void
+appendJSON(const Element& element, std::string& out) {
+    switch (element.getType()) {
+    case Element::integer:
+        appendJSONInteger(element.intValue(), out);
+        break;
+
+    case Element::real: {
+        // Same format as the default formatting of the std::ostream.
+        char buf[32];
+        const int len = snprintf(buf, sizeof(buf), "%g", element.doubleValue());
+        out.append(buf, len);
+        break;
+    }
+
+    case Element::boolean:
+        out.append(element.boolValue() ? "true" : "false");
+        break;
+
+    case Element::null:
+        out.append("null");
+        break;
+
+    case Element::string:
+        appendJSONString(element.stringValue(), out);
+        break;
+
+    case Element::list: {
+        out.append("[ ");
+        const std::vector<ElementPtr>& v = element.listValue();
+        for (std::vector<ElementPtr>::const_iterator it = v.begin();
+             it != v.end(); ++it) {
+            if (it != v.begin()) {
+                out.append(", ");
+            }
+            appendJSON(**it, out);
+        }
+        out.append(" ]");
+        break;
+    }
+
+    case Element::map: {
+        out.append("{ ");
+        const std::map<std::string, ConstElementPtr>& m = element.mapValue();
+        for (std::map<std::string, ConstElementPtr>::const_iterator it =
+                 m.begin(); it != m.end(); ++it) {
+            if (it != m.begin()) {
+                out.append(", ");
+            }
+            out.push_back('"');
+            out.append(it->first);
+            out.append("\": ");
+            if (it->second) {
+                appendJSON(*it->second, out);
+            } else {
+                out.append("None");
+            }
+        }
+        out.append(" }");
+        break;
+    }
+
+    default: {
+        std::ostringstream ss;
+        element.toJSON(ss);
+        out.append(ss.str());
+    }
+    }
+}
+
 } // unnamed namespace
 
 std::string
@@ -637,88 +902,32 @@ ElementPtr
 Element::fromJSON(std::istream& in, const std::string& file, int& line,
                   int& pos) throw(JSONError)
 {
-    int c = 0;
-    ElementPtr element;
-    bool el_read = false;
-    skipChars(in, WHITESPACE, line, pos);
-    while (c != EOF && !el_read) {
-        c = in.get();
-        pos++;
-        switch(c) {
-            case '1':
-            case '2':
-            case '3':
-            case '4':
-            case '5':
-            case '6':
-            case '7':
-            case '8':
-            case '9':
-            case '0':
-            case '-':
-            case '+':
-            case '.':
-                in.putback(c);
-                --pos;
-                element = fromStringstreamNumber(in, file, line, pos);
-                el_read = true;
-                break;
-            case 't':
-            case 'f':
-                in.putback(c);
-                --pos;
-                element = fromStringstreamBool(in, file, line, pos);
-                el_read = true;
-                break;
-            case 'n':
-                in.putback(c);
-                --pos;
-                element = fromStringstreamNull(in, file, line, pos);
-                el_read = true;
-                break;
-            case '"':
-                in.putback('"');
-                --pos;
-                element = fromStringstreamString(in, file, line, pos);
-                el_read = true;
-                break;
-            case '[':
-                element = fromStringstreamList(in, file, line, pos);
-                el_read = true;
-                break;
-            case '{':
-                element = fromStringstreamMap(in, file, line, pos);
-                el_read = true;
-                break;
-            case EOF:
-                break;
-            default:
-                throwJSONError(std::string("error: unexpected character ") + std::string(1, c), file, line, pos);
-                break;
-        }
-    }
-    if (el_read) {
-        return (element);
-    } else {
-        isc_throw(JSONError, "nothing read");
-    }
+    return (fromJSONValue(in, file, line, pos));
 }
 
 ElementPtr
 Element::fromJSON(const std::string& in, bool preproc) {
-    std::stringstream ss;
-    ss << in;
-
     int line = 1, pos = 1;
-    stringstream filtered;
+    std::string filtered;
     if (preproc) {
-        preprocess(ss, filtered);
+        std::istringstream ss(in);
+        std::stringstream out;
+        preprocess(ss, out);
+        filtered = out.str();
     }
-    ElementPtr result(fromJSON(preproc ? filtered : ss, "<string>", line, pos));
-    skipChars(ss, WHITESPACE, line, pos);
-    // ss must now be at end
-    if (ss.peek() != EOF) {
-        throwJSONError("Extra data", "<string>", line, pos);
+    const std::string& text = preproc ? filtered : in;
+
+    // The text is parsed in place, without copying it into a stream.
+    BufferReader reader(text.data(), text.size());
+    ElementPtr result(fromJSONValue(reader, "<string>", line, pos));
+    // The trailing data is not checked for the preprocessed input, which
+    // may end with the comment following the last element.
+    if (!preproc) {
+        skipChars(reader, WHITESPACE, line, pos);
+        // the reader must now be at end
+        if (reader.peek() != EOF) {
+            throwJSONError("Extra data", "<string>", line, pos);
+        }
     }
     return result;
 }
@@ -737,11 +946,34 @@ Element::fromJSONFile(const std::string& file_name,
                   << "': " << error);
     }
 
-    return (fromJSON(infile, file_name, preproc));
+    // Read the whole file and parse it from the memory.
+    std::stringstream content;
+    if (preproc) {
+        preprocess(infile, content);
+    } else {
+        content << infile.rdbuf();
+    }
+    const std::string text = content.str();
+
+    int line = 1, pos = 1;
+    BufferReader reader(text.data(), text.size());
+    return (fromJSONValue(reader, file_name, line, pos));
 }
 
 // to JSON format
 
+std::string
+Element::str() const {
+    std::string out;
+    appendJSON(*this, out);
+    return (out);
+}
+
+std::string
+Element::toWire() const {
+    return (str());
+}
+
 void
 IntElement::toJSON(std::ostream& ss) const {
     ss << intValue();
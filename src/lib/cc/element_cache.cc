@@ -0,0 +1,390 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <cc/element_cache.h>
+#include <exceptions/exceptions.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <vector>
+
+using namespace isc::util;
+
+namespace {
+
+/// @brief Magic number starting the cache file ("KEAC").
+const uint32_t CACHE_MAGIC = 0x4b454143;
+
+/// @brief Writes 64-bit value to the buffer.
+void
+writeUint64(const uint64_t value, OutputBuffer& buffer) {
+    buffer.writeUint32(static_cast<uint32_t>(value >> 32));
+    buffer.writeUint32(static_cast<uint32_t>(value & 0xffffffff));
+}
+
+/// @brief Reads 64-bit value from the buffer.
+uint64_t
+readUint64(InputBuffer& buffer) {
+    uint64_t value = static_cast<uint64_t>(buffer.readUint32()) << 32;
+    return (value | buffer.readUint32());
+}
+
+/// @brief Writes string preceded by its length to the buffer.
+void
+writeString(const std::string& value, OutputBuffer& buffer) {
+    buffer.writeUint32(static_cast<uint32_t>(value.size()));
+    buffer.writeData(value.data(), value.size());
+}
+
+/// @brief Reads string preceded by its length from the buffer.
+std::string
+readString(InputBuffer& buffer) {
+    const uint32_t length = buffer.readUint32();
+    if (length > buffer.getLength() - buffer.getPosition()) {
+        isc_throw(isc::BadValue, "string of length " << length
+                  << " exceeds the cached data");
+    }
+    std::string value(length, '\0');
+    if (length > 0) {
+        buffer.readData(&value[0], length);
+    }
+    return (value);
+}
+
+/// @brief Encoder of the element trees.
+///
+/// The file names of the element positions are written once, when
+/// first used. The following elements refer to them by index.
+class Encoder {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param buffer Buffer to which the elements are written.
+    Encoder(OutputBuffer& buffer)
+        : buffer_(buffer) {
+    }
+
+    /// @brief Encodes the element and its children.
+    ///
+    /// @param element Element to be encoded.
+    void encode(const isc::data::ConstElementPtr& element) {
+        using isc::data::Element;
+
+        if (!element) {
+            isc_throw(isc::BadValue, "unable to cache null element");
+        }
+
+        buffer_.writeUint8(static_cast<uint8_t>(element->getType()));
+        encodePosition(element->getPosition());
+
+        switch (element->getType()) {
+        case Element::integer:
+            writeUint64(static_cast<uint64_t>(element->intValue()), buffer_);
+            break;
+
+        case Element::real:
+        {
+            const double value = element->doubleValue();
+            uint64_t bits;
+            memcpy(&bits, &value, sizeof(bits));
+            writeUint64(bits, buffer_);
+            break;
+        }
+
+        case Element::boolean:
+            buffer_.writeUint8(element->boolValue() ? 1 : 0);
+            break;
+
+        case Element::null:
+            break;
+
+        case Element::string:
+            writeString(element->stringValue(), buffer_);
+            break;
+
+        case Element::list:
+        {
+            const std::vector<isc::data::ElementPtr>& values =
+                element->listValue();
+            buffer_.writeUint32(static_cast<uint32_t>(values.size()));
+            for (std::vector<isc::data::ElementPtr>::const_iterator value =
+                     values.begin(); value != values.end(); ++value) {
+                encode(*value);
+            }
+            break;
+        }
+
+        case Element::map:
+        {
+            const std::map<std::string, isc::data::ConstElementPtr>& values =
+                element->mapValue();
+            buffer_.writeUint32(static_cast<uint32_t>(values.size()));
+            for (std::map<std::string, isc::data::ConstElementPtr>::
+                     const_iterator value = values.begin();
+                 value != values.end(); ++value) {
+                writeString(value->first, buffer_);
+                encode(value->second);
+            }
+            break;
+        }
+
+        default:
+            isc_throw(isc::BadValue, "unable to cache element of type "
+                      << Element::typeToName(static_cast<Element::types>
+                                             (element->getType())));
+        }
+    }
+
+private:
+
+    /// @brief Encodes the element position.
+    ///
+    /// @param position Position of the element.
+    void encodePosition(const isc::data::Element::Position& position) {
+        std::map<std::string, uint16_t>::const_iterator file =
+            files_.find(position.file_);
+        if (file != files_.end()) {
+            buffer_.writeUint16(file->second);
+        } else {
+            if (files_.size() >= 0xffff) {
+                isc_throw(isc::BadValue, "too many files to cache");
+            }
+            const uint16_t index = static_cast<uint16_t>(files_.size());
+            buffer_.writeUint16(index);
+            writeString(position.file_, buffer_);
+            files_[position.file_] = index;
+        }
+        buffer_.writeUint32(position.line_);
+        buffer_.writeUint32(position.pos_);
+    }
+
+    /// @brief Buffer to which the elements are written.
+    OutputBuffer& buffer_;
+
+    /// @brief Indexes of the file names written so far.
+    std::map<std::string, uint16_t> files_;
+};
+
+/// @brief Decoder of the element trees written by the @c Encoder.
+class Decoder {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param buffer Buffer from which the elements are read.
+    Decoder(InputBuffer& buffer)
+        : buffer_(buffer) {
+    }
+
+    /// @brief Decodes the element and its children.
+    ///
+    /// @return Decoded element.
+    isc::data::ElementPtr decode() {
+        using isc::data::Element;
+        using isc::data::ElementPtr;
+
+        const uint8_t type = buffer_.readUint8();
+        const Element::Position position = decodePosition();
+
+        switch (type) {
+        case Element::integer:
+            return (Element::create(static_cast<long long int>
+                                    (readUint64(buffer_)), position));
+
+        case Element::real:
+        {
+            const uint64_t bits = readUint64(buffer_);
+            double value;
+            memcpy(&value, &bits, sizeof(value));
+            return (Element::create(value, position));
+        }
+
+        case Element::boolean:
+            return (Element::create(buffer_.readUint8() != 0, position));
+
+        case Element::null:
+            return (Element::create(position));
+
+        case Element::string:
+            return (Element::create(readString(buffer_), position));
+
+        case Element::list:
+        {
+            ElementPtr list = Element::createList(position);
+            const uint32_t count = buffer_.readUint32();
+            for (uint32_t i = 0; i < count; ++i) {
+                list->add(decode());
+            }
+            return (list);
+        }
+
+        case Element::map:
+        {
+            ElementPtr map = Element::createMap(position);
+            const uint32_t count = buffer_.readUint32();
+            for (uint32_t i = 0; i < count; ++i) {
+                const std::string key = readString(buffer_);
+                map->set(key, decode());
+            }
+            return (map);
+        }
+
+        default:
+            isc_throw(isc::BadValue, "invalid element type "
+                      << static_cast<unsigned>(type) << " in the cache");
+        }
+    }
+
+private:
+
+    /// @brief Decodes the element position.
+    ///
+    /// @return Position of the element.
+    isc::data::Element::Position decodePosition() {
+        const uint16_t index = buffer_.readUint16();
+        if (index == files_.size()) {
+            files_.push_back(readString(buffer_));
+        } else if (index > files_.size()) {
+            isc_throw(isc::BadValue, "invalid file index " << index
+                      << " in the cache");
+        }
+        const uint32_t line = buffer_.readUint32();
+        const uint32_t pos = buffer_.readUint32();
+        return (isc::data::Element::Position(files_[index], line, pos));
+    }
+
+    /// @brief Buffer from which the elements are read.
+    InputBuffer& buffer_;
+
+    /// @brief File names read so far.
+    std::vector<std::string> files_;
+};
+
+}
+
+namespace isc {
+namespace data {
+
+ElementCache::ElementCache(const std::string& cache_file,
+                           const std::string& tag)
+    : cache_file_(cache_file), tag_(tag) {
+    if (cache_file_.empty()) {
+        isc_throw(BadValue, "cache file name must not be empty");
+    }
+}
+
+ElementPtr
+ElementCache::load(const std::string& text) const {
+    std::ifstream infile(cache_file_.c_str(), std::ios::in | std::ios::binary);
+    if (!infile.is_open()) {
+        return (ElementPtr());
+    }
+    std::vector<char> data((std::istreambuf_iterator<char>(infile)),
+                           std::istreambuf_iterator<char>());
+    if (infile.bad()) {
+        isc_throw(BadValue, "failed to read the cache file '"
+                  << cache_file_ << "'");
+    }
+
+    try {
+        InputBuffer buffer(data.empty() ? 0 : &data[0], data.size());
+        if (buffer.readUint32() != CACHE_MAGIC) {
+            isc_throw(BadValue, "'" << cache_file_ << "' is not a cache file");
+        }
+        // The caches written by the other versions and for the other
+        // text are not errors: the configuration is parsed instead.
+        if ((buffer.readUint32() != FORMAT_VERSION) ||
+            (readString(buffer) != tag_) ||
+            (readUint64(buffer) != text.size()) ||
+            (readUint64(buffer) != hash(text))) {
+            return (ElementPtr());
+        }
+        ElementPtr element = fromBinary(buffer);
+        if (buffer.getPosition() != buffer.getLength()) {
+            isc_throw(BadValue, "extra data in the cache file '"
+                      << cache_file_ << "'");
+        }
+        return (element);
+
+    } catch (const isc::util::InvalidBufferPosition&) {
+        isc_throw(BadValue, "the cache file '" << cache_file_
+                  << "' is truncated");
+    }
+}
+
+void
+ElementCache::store(const std::string& text,
+                    const ConstElementPtr& element) const {
+    OutputBuffer buffer(4096);
+    buffer.writeUint32(CACHE_MAGIC);
+    buffer.writeUint32(FORMAT_VERSION);
+    writeString(tag_, buffer);
+    writeUint64(text.size(), buffer);
+    writeUint64(hash(text), buffer);
+    toBinary(element, buffer);
+
+    // Write to the temporary file and then replace the cache file.
+    const std::string tmp_file = cache_file_ + ".tmp";
+    errno = 0;
+    std::ofstream outfile(tmp_file.c_str(), std::ios::out |
+                          std::ios::binary | std::ios::trunc);
+    if (!outfile.is_open()) {
+        const char* error = strerror(errno);
+        isc_throw(InvalidOperation, "failed to open the cache file '"
+                  << tmp_file << "': " << error);
+    }
+    outfile.write(static_cast<const char*>(buffer.getData()),
+                  buffer.getLength());
+    outfile.close();
+    if (outfile.fail()) {
+        static_cast<void>(remove(tmp_file.c_str()));
+        isc_throw(InvalidOperation, "failed to write the cache file '"
+                  << tmp_file << "'");
+    }
+    if (rename(tmp_file.c_str(), cache_file_.c_str()) != 0) {
+        const char* error = strerror(errno);
+        static_cast<void>(remove(tmp_file.c_str()));
+        isc_throw(InvalidOperation, "failed to rename '" << tmp_file
+                  << "' to '" << cache_file_ << "': " << error);
+    }
+}
+
+uint64_t
+ElementCache::hash(const std::string& text) {
+    uint64_t value = 14695981039346656037ULL;
+    for (std::string::const_iterator c = text.begin(); c != text.end(); ++c) {
+        value ^= static_cast<uint8_t>(*c);
+        value *= 1099511628211ULL;
+    }
+    return (value);
+}
+
+void
+ElementCache::toBinary(const ConstElementPtr& element, OutputBuffer& buffer) {
+    Encoder encoder(buffer);
+    encoder.encode(element);
+}
+
+ElementPtr
+ElementCache::fromBinary(InputBuffer& buffer) {
+    try {
+        Decoder decoder(buffer);
+        return (decoder.decode());
+
+    } catch (const isc::util::InvalidBufferPosition&) {
+        isc_throw(BadValue, "the cached element tree is truncated");
+    }
+}
+
+} // end of isc::data namespace
+} // end of isc namespace
@@ -0,0 +1,122 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef ELEMENT_CACHE_H
+#define ELEMENT_CACHE_H
+
+#include <cc/data.h>
+#include <util/buffer.h>
+#include <stdint.h>
+#include <string>
+
+namespace isc {
+namespace data {
+
+/// @brief Binary cache of the parsed configuration.
+///
+/// The configuration files are parsed into the element trees by the
+/// flex/bison parsers, which is slow for very large configurations.
+/// This class stores the element tree in a compact binary form in the
+/// cache file, together with the size and hash of the configuration
+/// text it was parsed from. The subsequent loads return the cached
+/// tree without parsing the text, as long as the text didn't change.
+///
+/// The cached tree preserves the positions of the elements, so the
+/// errors found by the configuration parsers point to the same
+/// locations as for the tree parsed from the text.
+///
+/// The cached tree may include the values which are not in the text, e.g.
+/// the default values inserted by the configuration parsers. Such values
+/// depend on the software version, so the cache is also marked with a tag
+/// identifying the software which created it.
+///
+/// The cache file starts with the header:
+/// - magic "KEAC" (4 bytes),
+/// - format version (4 bytes),
+/// - tag length (4 bytes) followed by the tag,
+/// - size of the configuration text (8 bytes),
+/// - FNV-1a hash of the configuration text (8 bytes),
+///
+/// followed by the encoded element tree. All values are in the network
+/// byte order. The caches with the different format version or tag are
+/// ignored.
+class ElementCache {
+public:
+
+    /// @brief Version of the cache file format.
+    static const uint32_t FORMAT_VERSION = 1;
+
+    /// @brief Constructor.
+    ///
+    /// @param cache_file Name of the cache file.
+    /// @param tag Tag identifying the software using the cache, e.g. its
+    /// version.
+    /// @throw BadValue if the cache file name is empty.
+    explicit ElementCache(const std::string& cache_file,
+                          const std::string& tag = "");
+
+    /// @brief Returns the name of the cache file.
+    const std::string& getCacheFile() const {
+        return (cache_file_);
+    }
+
+    /// @brief Loads the element tree cached for the configuration text.
+    ///
+    /// @param text Configuration text.
+    ///
+    /// @return Cached element tree or null pointer if the cache file
+    /// doesn't exist, has a different format version or tag or was
+    /// created for a different text.
+    /// @throw BadValue if the cache file is malformed.
+    ElementPtr load(const std::string& text) const;
+
+    /// @brief Stores the element tree parsed from the configuration text.
+    ///
+    /// The cache is written to a temporary file which then replaces the
+    /// cache file, so as the interrupted write doesn't leave a truncated
+    /// cache behind.
+    ///
+    /// @param text Configuration text.
+    /// @param element Element tree to be cached.
+    /// @throw InvalidOperation if the cache file can't be written.
+    void store(const std::string& text, const ConstElementPtr& element) const;
+
+    /// @brief Computes the hash of the configuration text.
+    ///
+    /// @param text Configuration text.
+    ///
+    /// @return 64-bit FNV-1a hash of the text.
+    static uint64_t hash(const std::string& text);
+
+    /// @brief Encodes the element tree.
+    ///
+    /// @param element Element tree to be encoded.
+    /// @param [out] buffer Buffer to which the tree is appended.
+    /// @throw BadValue if the tree contains an element of unsupported type.
+    static void toBinary(const ConstElementPtr& element,
+                         util::OutputBuffer& buffer);
+
+    /// @brief Decodes the element tree.
+    ///
+    /// @param buffer Buffer holding the encoded tree.
+    ///
+    /// @return Decoded element tree.
+    /// @throw BadValue if the encoded tree is malformed.
+    static ElementPtr fromBinary(util::InputBuffer& buffer);
+
+private:
+
+    /// @brief Name of the cache file.
+    std::string cache_file_;
+
+    /// @brief Tag identifying the software using the cache.
+    std::string tag_;
+};
+
+} // end of isc::data namespace
+} // end of isc namespace
+
+#endif // ELEMENT_CACHE_H
@@ -732,6 +732,42 @@ TEST(Element, to_and_from_wire) {
     EXPECT_THROW(Element::fromJSON("[ \"a\": \"b\" ]"), isc::data::JSONError);
 }
 
+// This test verifies that the JSON parsed from a string and from a stream
+// yields the same elements and that str() matches the stream output.
+TEST(Element, stringAndStreamJSON) {
+    std::string json = "{ \"a\": [ 1, -9223372036854775807, 2.5, true, null ],"
+        " \"b\": \"esc\\\"aped\\n\\\\\", \"c\": { \"d\": false, \"e\": [ ] } }";
+    ConstElementPtr from_string = Element::fromJSON(json);
+    std::istringstream in(json);
+    ConstElementPtr from_stream = Element::fromJSON(in);
+    ASSERT_TRUE(from_string);
+    ASSERT_TRUE(from_stream);
+    EXPECT_TRUE(from_string->equals(*from_stream));
+
+    std::ostringstream out;
+    from_stream->toJSON(out);
+    EXPECT_EQ(out.str(), from_string->str());
+    EXPECT_TRUE(Element::fromJSON(from_string->str())->equals(*from_stream));
+
+    // The errors report the same position for both inputs.
+    std::string bad = "{ \"a\": 1,\n  \"b\" 2 }";
+    std::string string_error;
+    std::string stream_error;
+    try {
+        Element::fromJSON(bad);
+    } catch (const JSONError& ex) {
+        string_error = ex.what();
+    }
+    std::istringstream bad_in(bad);
+    try {
+        Element::fromJSON(bad_in, std::string("<string>"));
+    } catch (const JSONError& ex) {
+        stream_error = ex.what();
+    }
+    EXPECT_FALSE(string_error.empty());
+    EXPECT_EQ(stream_error, string_error);
+}
+
 ConstElementPtr
 efs(const std::string& str) {
     return (Element::fromJSON(str));
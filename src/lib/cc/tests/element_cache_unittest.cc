@@ -0,0 +1,191 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <cc/element_cache.h>
+#include <exceptions/exceptions.h>
+#include <gtest/gtest.h>
+#include <fstream>
+#include <sstream>
+#include <vector>
+
+using namespace isc;
+using namespace isc::data;
+using namespace isc::util;
+
+namespace {
+
+/// @brief Test fixture class for @c ElementCache.
+class ElementCacheTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Removes the cache file left by the previous tests.
+    ElementCacheTest() {
+        removeFiles();
+    }
+
+    /// @brief Destructor.
+    ///
+    /// Removes the cache file.
+    virtual ~ElementCacheTest() {
+        removeFiles();
+    }
+
+    /// @brief Removes the cache file and its temporary copy.
+    void removeFiles() {
+        static_cast<void>(remove(CACHE_FILE));
+        static_cast<void>(remove((std::string(CACHE_FILE) + ".tmp").c_str()));
+    }
+
+    /// @brief Overwrites the cache file with the specified content.
+    ///
+    /// @param content Content of the cache file.
+    void writeCache(const std::string& content) {
+        std::ofstream out(CACHE_FILE, std::ios::out | std::ios::binary |
+                          std::ios::trunc);
+        ASSERT_TRUE(out.is_open());
+        out << content;
+    }
+
+    /// @brief Reads the content of the cache file.
+    std::string readCache() {
+        std::ifstream in(CACHE_FILE, std::ios::in | std::ios::binary);
+        std::ostringstream content;
+        content << in.rdbuf();
+        return (content.str());
+    }
+
+    /// @brief Name of the cache file used by the tests.
+    static const char* CACHE_FILE;
+};
+
+const char* ElementCacheTest::CACHE_FILE = "test-element-cache.bin";
+
+/// @brief Sample configuration used by the tests.
+const char* CONFIG =
+    "{ \"Dhcp4\": {\n"
+    "    \"valid-lifetime\": 4000,\n"
+    "    \"ratio\": 0.5,\n"
+    "    \"echo-client-id\": true,\n"
+    "    \"next-server\": null,\n"
+    "    \"interfaces-config\": { \"interfaces\": [ \"eth0\", \"eth1\" ] },\n"
+    "    \"subnet4\": [ { \"id\": -1, \"subnet\": \"192.0.2.0/24\" } ]\n"
+    "} }\n";
+
+// This test verifies that the encoded element tree is decoded into
+// the same tree, including the positions of the elements.
+TEST_F(ElementCacheTest, toAndFromBinary) {
+    std::istringstream in(CONFIG);
+    ElementPtr config = Element::fromJSON(in, std::string("kea.conf"));
+    // Elements at the zero position are added by the default values.
+    config->set("renew-timer", Element::create(1000));
+
+    OutputBuffer out(0);
+    ASSERT_NO_THROW(ElementCache::toBinary(config, out));
+    InputBuffer buffer(out.getData(), out.getLength());
+    ElementPtr decoded;
+    ASSERT_NO_THROW(decoded = ElementCache::fromBinary(buffer));
+    ASSERT_TRUE(decoded);
+    EXPECT_EQ(out.getLength(), buffer.getPosition());
+    EXPECT_TRUE(config->equals(*decoded));
+
+    ConstElementPtr dhcp4 = decoded->get("Dhcp4");
+    ASSERT_TRUE(dhcp4);
+    ConstElementPtr lifetime = dhcp4->get("valid-lifetime");
+    ASSERT_TRUE(lifetime);
+    EXPECT_EQ("kea.conf:2:23", lifetime->getPosition().str());
+    ConstElementPtr subnets = dhcp4->get("subnet4");
+    ASSERT_TRUE(subnets);
+    EXPECT_EQ(config->get("Dhcp4")->get("subnet4")->get(0)->
+              getPosition().str(), subnets->get(0)->getPosition().str());
+    ASSERT_TRUE(decoded->get("renew-timer"));
+    EXPECT_EQ(0, decoded->get("renew-timer")->getPosition().line_);
+
+    // The truncated tree can't be decoded.
+    InputBuffer truncated(out.getData(), out.getLength() - 1);
+    EXPECT_THROW(ElementCache::fromBinary(truncated), BadValue);
+}
+
+// This test verifies that the cache is used only for the text it
+// was created for.
+TEST_F(ElementCacheTest, storeAndLoad) {
+    ElementCache cache(CACHE_FILE);
+    const std::string text(CONFIG);
+
+    // The cache file doesn't exist yet.
+    EXPECT_FALSE(cache.load(text));
+
+    ElementPtr config = Element::fromJSON(text);
+    ASSERT_NO_THROW(cache.store(text, config));
+
+    ElementPtr cached;
+    ASSERT_NO_THROW(cached = cache.load(text));
+    ASSERT_TRUE(cached);
+    EXPECT_TRUE(config->equals(*cached));
+
+    // The cache is not used for the modified text.
+    std::string modified = text;
+    modified[modified.find("4000")] = '5';
+    EXPECT_FALSE(cache.load(modified));
+    EXPECT_FALSE(cache.load(text + " "));
+
+    // The cache of the different format version is ignored.
+    std::string content = readCache();
+    ASSERT_GT(content.size(), 8);
+    content[7] = static_cast<char>(ElementCache::FORMAT_VERSION + 1);
+    writeCache(content);
+    EXPECT_FALSE(cache.load(text));
+
+    // The cache created with the different tag is ignored.
+    ElementCache tagged_cache(CACHE_FILE, "1.2.0");
+    ASSERT_NO_THROW(tagged_cache.store(text, config));
+    EXPECT_TRUE(tagged_cache.load(text));
+    EXPECT_FALSE(cache.load(text));
+    EXPECT_FALSE(ElementCache(CACHE_FILE, "1.2.1").load(text));
+}
+
+// This test verifies that the malformed cache is reported.
+TEST_F(ElementCacheTest, malformed) {
+    ElementCache cache(CACHE_FILE);
+    const std::string text(CONFIG);
+    ASSERT_NO_THROW(cache.store(text, Element::fromJSON(text)));
+    const std::string content = readCache();
+
+    // Not a cache file.
+    writeCache("{ \"Dhcp4\": { } }");
+    EXPECT_THROW(cache.load(text), BadValue);
+
+    // Truncated file.
+    writeCache(content.substr(0, content.size() / 2));
+    EXPECT_THROW(cache.load(text), BadValue);
+
+    // Trailing data.
+    writeCache(content + "x");
+    EXPECT_THROW(cache.load(text), BadValue);
+
+    // The empty file name is rejected.
+    EXPECT_THROW(ElementCache(""), BadValue);
+}
+
+// This test verifies that the cache can't be written to the directory
+// which doesn't exist.
+TEST_F(ElementCacheTest, storeFail) {
+    ElementCache cache("/no-such-directory/cache.bin");
+    EXPECT_THROW(cache.store(CONFIG, Element::fromJSON(CONFIG)),
+                 InvalidOperation);
+}
+
+// This test verifies that the hash depends on the whole text.
+TEST_F(ElementCacheTest, hash) {
+    EXPECT_EQ(ElementCache::hash(CONFIG), ElementCache::hash(CONFIG));
+    EXPECT_NE(ElementCache::hash("{ \"a\": 1 }"),
+              ElementCache::hash("{ \"a\": 2 }"));
+    EXPECT_NE(ElementCache::hash(""), ElementCache::hash(" "));
+}
+
+}
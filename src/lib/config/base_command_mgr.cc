@@ -26,6 +26,7 @@ BaseCommandMgr::registerCommand(const std::string& cmd, CommandHandler handler)
         isc_throw(InvalidCommandHandler, "Specified command handler is NULL");
     }
 
+    util::thread::Mutex::Locker lock(handlers_mutex_);
     HandlerContainer::const_iterator it = handlers_.find(cmd);
     if (it != handlers_.end()) {
         isc_throw(InvalidCommandName, "Handler for command '" << cmd
@@ -44,6 +45,7 @@ BaseCommandMgr::deregisterCommand(const std::string& cmd) {
                   "Can't uninstall internal command 'list-commands'");
     }
 
+    util::thread::Mutex::Locker lock(handlers_mutex_);
     HandlerContainer::iterator it = handlers_.find(cmd);
     if (it == handlers_.end()) {
         isc_throw(InvalidCommandName, "Handler for command '" << cmd
@@ -59,7 +61,10 @@ BaseCommandMgr::deregisterAll() {
 
     // No need to log anything here. deregisterAll is not used in production
     // code, just in tests.
-    handlers_.clear();
+    {
+        util::thread::Mutex::Locker lock(handlers_mutex_);
+        handlers_.clear();
+    }
     registerCommand("list-commands",
         boost::bind(&BaseCommandMgr::listCommandsHandler, this, _1, _2));
 }
@@ -141,15 +146,20 @@ BaseCommandMgr::combineCommandsLists(const ConstElementPtr& response1,
 ConstElementPtr
 BaseCommandMgr::handleCommand(const std::string& cmd_name,
                               const ConstElementPtr& params) {
-    auto it = handlers_.find(cmd_name);
-    if (it == handlers_.end()) {
-        // Ok, there's no such command.
-        return (createAnswer(CONTROL_RESULT_ERROR,
-                             "'" + cmd_name + "' command not supported."));
+    CommandHandler handler;
+    {
+        util::thread::Mutex::Locker lock(handlers_mutex_);
+        auto it = handlers_.find(cmd_name);
+        if (it == handlers_.end()) {
+            // Ok, there's no such command.
+            return (createAnswer(CONTROL_RESULT_ERROR,
+                                 "'" + cmd_name + "' command not supported."));
+        }
+        handler = it->second;
     }
 
     // Call the actual handler and return whatever it returned
-    return (it->second(cmd_name, params));
+    return (handler(cmd_name, params));
 }
 
 isc::data::ConstElementPtr
@@ -157,6 +167,7 @@ BaseCommandMgr::listCommandsHandler(const std::string& name,
                                     const isc::data::ConstElementPtr& ) {
     using namespace isc::data;
     ElementPtr commands = Element::createList();
+    util::thread::Mutex::Locker lock(handlers_mutex_);
     for (HandlerContainer::const_iterator it = handlers_.begin();
          it != handlers_.end(); ++it) {
         commands->add(Element::create(it->first));
@@ -9,6 +9,7 @@
 
 #include <cc/data.h>
 #include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
 #include <boost/function.hpp>
 #include <map>
 #include <string>
@@ -161,6 +162,12 @@ protected:
     /// @brief Container for command handlers.
     HandlerContainer handlers_;
 
+    /// @brief Mutex protecting the container of command handlers.
+    ///
+    /// The commands may be handled by many threads. The handlers are
+    /// called without holding the mutex, so they may run concurrently.
+    util::thread::Mutex handlers_mutex_;
+
 private:
 
     /// @brief 'list-commands' command handler.
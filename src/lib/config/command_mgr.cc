@@ -14,6 +14,76 @@
 #include <unistd.h>
 
 using namespace isc::data;
+using namespace isc::config;
+
+namespace {
+
+/// @brief Command handler generating the whole response of the streamed
+/// command at once.
+///
+/// The handlers of the streamed commands are stored as this handler, so as
+/// the streamed commands are handled as any other command when they aren't
+/// received over the control connection.
+class StreamCommandAdapter {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param handler Streamed command handler.
+    StreamCommandAdapter(const CommandMgr::StreamCommandHandler& handler)
+        : handler_(handler) {
+    }
+
+    /// @brief Handles the command.
+    ///
+    /// @param name Name of the command.
+    /// @param params Parameters of the command.
+    ///
+    /// @return Whole response to the command.
+    ConstElementPtr operator()(const std::string& name,
+                               const ConstElementPtr& params) const {
+        ResponseGenerator generator = getGenerator(name, params);
+        std::string response;
+        while (generator(response)) {
+        }
+        return (Element::fromJSON(response));
+    }
+
+    /// @brief Returns generator of the response to the command.
+    ///
+    /// @param name Name of the command.
+    /// @param params Parameters of the command.
+    ///
+    /// @throw Unexpected if the handler returned empty generator.
+    ResponseGenerator getGenerator(const std::string& name,
+                                   const ConstElementPtr& params) const {
+        ResponseGenerator generator = handler_(name, params);
+        if (!generator) {
+            isc_throw(isc::Unexpected, "handler for command '" << name
+                      << "' returned no response generator");
+        }
+        return (generator);
+    }
+
+private:
+
+    /// @brief Streamed command handler.
+    CommandMgr::StreamCommandHandler handler_;
+};
+
+/// @brief Appends the whole response.
+///
+/// @param response Text of the response.
+/// @param [out] part Text to which the response is appended.
+///
+/// @return false as there is nothing to append later.
+bool
+appendResponse(const std::string& response, std::string& part) {
+    part.append(response);
+    return (false);
+}
+
+}
 
 namespace isc {
 namespace config {
@@ -40,12 +110,19 @@ void CommandMgr::closeCommandSocket() {
         socket_.reset();
     }
 
-    // Now let's close all existing connections that we may have.
+    // Now let's close all existing connections that we may have. The
+    // connection processing the command which closes the control socket,
+    // e.g. set-config, is closed after sending the response, so it is
+    // kept until then.
     for (std::list<CommandSocketPtr>::iterator conn = connections_.begin();
-         conn != connections_.end(); ++conn) {
+         conn != connections_.end();) {
         (*conn)->close();
+        if ((*conn)->getFD() < 0) {
+            conn = connections_.erase(conn);
+        } else {
+            ++conn;
+        }
     }
-    connections_.clear();
 }
 
 
@@ -70,108 +147,68 @@ bool CommandMgr::closeConnection(int fd) {
     return (false);
 }
 
-CommandMgr&
-CommandMgr::instance() {
-    static CommandMgr cmd_mgr;
-    return (cmd_mgr);
-}
-
 void
-CommandMgr::commandReader(int sockfd) {
-
-    /// @todo: We do not handle commands that are larger than 64K.
-
-    // We should not expect commands bigger than 64K.
-    char buf[65536];
-    memset(buf, 0, sizeof(buf));
-    ConstElementPtr cmd, rsp;
-
-    // Read incoming data.
-    int rval = read(sockfd, buf, sizeof(buf));
-    if (rval < 0) {
-        // Read failed
-        LOG_ERROR(command_logger, COMMAND_SOCKET_READ_FAIL).arg(rval).arg(sockfd);
-
-        /// @todo: Should we close the connection, similar to what is already
-        /// being done for rval == 0?
-        return;
-    } else if (rval == 0) {
-
-        // Remove it from the active connections list.
-        instance().closeConnection(sockfd);
-
-        return;
+CommandMgr::registerStreamCommand(const std::string& cmd,
+                                  StreamCommandHandler handler) {
+    if (!handler) {
+        isc_throw(InvalidCommandHandler, "Specified command handler is NULL");
     }
+    registerCommand(cmd, StreamCommandAdapter(handler));
+}
 
-    // Duplicate the connection's socket in the event, the command causes the
-    // channel to close (like a reconfig).  This permits us to always have
-    // a socket on which to respond. If for some reason  we can't fall back
-    // to the connection socket.
-    int rsp_fd = dup(sockfd);
-    if (rsp_fd < 0 ) {
-        // Highly unlikely
-        const char* errmsg = strerror(errno);
-        LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_DUP_WARN)
-                  .arg(errmsg);
-        rsp_fd = sockfd;
+ResponseGenerator
+CommandMgr::processStreamCommand(const ConstElementPtr& cmd) {
+    // The hook libraries get the whole commands and responses, and the
+    // malformed commands are reported by processCommand.
+    if (!cmd || hasCommandCallouts()) {
+        return (ResponseGenerator());
     }
 
-    LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_READ).arg(rval).arg(sockfd);
-
-    // Ok, we received something. Let's see if we can make any sense of it.
+    ConstElementPtr arg;
+    std::string name;
     try {
-
-        // Try to interpret it as JSON.
-        std::string sbuf(buf, static_cast<size_t>(rval));
-        cmd = Element::fromJSON(sbuf, true);
-
-        // If successful, then process it as a command.
-        rsp = CommandMgr::instance().processCommand(cmd);
-    } catch (const Exception& ex) {
-        LOG_WARN(command_logger, COMMAND_PROCESS_ERROR1).arg(ex.what());
-        rsp = createAnswer(CONTROL_RESULT_ERROR, std::string(ex.what()));
+        name = parseCommand(arg, cmd);
+    } catch (const Exception&) {
+        return (ResponseGenerator());
     }
 
-    if (!rsp) {
-        LOG_WARN(command_logger, COMMAND_RESPONSE_ERROR);
-        // Only close the duped socket if it's different (should be)
-        if (rsp_fd != sockfd) {
-            close(rsp_fd);
+    CommandHandler handler;
+    {
+        util::thread::Mutex::Locker lock(handlers_mutex_);
+        HandlerContainer::const_iterator it = handlers_.find(name);
+        if (it == handlers_.end()) {
+            return (ResponseGenerator());
         }
-
-        return;
+        handler = it->second;
     }
-
-    // Let's convert JSON response to text. Note that at this stage
-    // the rsp pointer is always set.
-    std::string txt = rsp->str();
-    size_t len = txt.length();
-    if (len > 65535) {
-        // Hmm, our response is too large. Let's send the first
-        // 64KB and hope for the best.
-        LOG_ERROR(command_logger, COMMAND_SOCKET_RESPONSE_TOOLARGE).arg(len);
-
-        len = 65535;
+    const StreamCommandAdapter* adapter =
+        handler.target<StreamCommandAdapter>();
+    if (!adapter) {
+        return (ResponseGenerator());
     }
 
-    // Send the data back over socket.
-    rval = write(rsp_fd, txt.c_str(), len);
-    int saverr = errno;
+    LOG_INFO(command_logger, COMMAND_RECEIVED).arg(name);
 
-    LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_WRITE).arg(len).arg(sockfd);
+    try {
+        return (adapter->getGenerator(name, arg));
 
-    if (rval < 0) {
-        // Response transmission failed. Since the response failed, it doesn't
-        // make sense to send any status codes. Let's log it and be done with
-        // it.
-        LOG_ERROR(command_logger, COMMAND_SOCKET_WRITE_FAIL)
-                  .arg(len).arg(sockfd).arg(strerror(saverr));
+    } catch (const Exception& e) {
+        LOG_WARN(command_logger, COMMAND_PROCESS_ERROR2).arg(e.what());
+        return (createResponseGenerator(createAnswer(CONTROL_RESULT_ERROR,
+                    std::string("Error during command processing: ")
+                    + e.what())));
     }
+}
 
-    // Only close the duped socket if it's different (should be)
-    if (rsp_fd != sockfd) {
-        close(rsp_fd);
-    }
+ResponseGenerator
+CommandMgr::createResponseGenerator(const ConstElementPtr& response) {
+    return (boost::bind(&appendResponse, response->str(), _1));
+}
+
+CommandMgr&
+CommandMgr::instance() {
+    static CommandMgr cmd_mgr;
+    return (cmd_mgr);
 }
 
 }; // end of isc::config
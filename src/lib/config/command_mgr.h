@@ -19,10 +19,25 @@ namespace config {
 /// @brief Commands Manager implementation for the Kea servers.
 ///
 /// This class extends @ref BaseCommandMgr with the ability to receive and
-/// respond to commands over unix domain sockets.
+/// respond to commands over unix domain sockets. The commands received over
+/// the connections are read and the responses are sent by the
+/// @ref ConnectionSocket objects.
 class CommandMgr : public HookedCommandMgr, public boost::noncopyable {
 public:
 
+    /// @brief Defines streamed command handler type
+    ///
+    /// The streamed command handlers return the generator of the response
+    /// rather than the response. The response is generated in parts while
+    /// it is being sent over the connection, so very large responses, e.g.
+    /// all leases, don't have to be held in memory at once.
+    ///
+    /// @param name name of the command
+    /// @param params parameters specific to the command
+    /// @return generator of the response
+    typedef boost::function<ResponseGenerator (const std::string& name,
+        const isc::data::ConstElementPtr& params)> StreamCommandHandler;
+
     /// @brief CommandMgr is a singleton class. This method returns reference
     /// to its sole instance.
     ///
@@ -47,18 +62,6 @@ public:
     /// @brief Shuts down any open control sockets
     void closeCommandSocket();
 
-    /// @brief Reads data from a socket, parses as JSON command and processes it
-    ///
-    /// This method is used to handle traffic on connected socket. This callback
-    /// is installed by the @c isc::config::UnixCommandSocket::receiveHandler
-    /// (located in the src/lib/config/command_socket_factory.cc)
-    /// once the incoming connection is accepted. If end-of-file is detected, this
-    /// method will close the socket and will uninstall itself from
-    /// @ref isc::dhcp::IfaceMgr.
-    ///
-    /// @param sockfd socket descriptor of a connected socket
-    static void commandReader(int sockfd);
-
     /// @brief Adds an information about opened connection socket
     ///
     /// @param conn Connection socket to be stored
@@ -70,6 +73,42 @@ public:
     /// @return true if closed successfully, false if not found
     bool closeConnection(int fd);
 
+    /// @brief Registers specified streamed command handler for a given command
+    ///
+    /// The command is listed by 'list-commands' and deregistered using
+    /// @ref deregisterCommand as any other command. The commands received
+    /// over the control connections are handled using
+    /// @ref processStreamCommand. The commands processed using
+    /// @ref processCommand, e.g. delegated to a hook library, get the
+    /// whole response generated at once.
+    ///
+    /// @param cmd Name of the command to be handled.
+    /// @param handler Pointer to the method that will handle the command.
+    void registerStreamCommand(const std::string& cmd,
+                               StreamCommandHandler handler);
+
+    /// @brief Triggers streamed command processing.
+    ///
+    /// @param cmd Pointer to the data element representing command in JSON
+    /// format.
+    ///
+    /// @return Generator of the response or empty generator if the command
+    /// is not a streamed command, in which case it should be processed
+    /// using @ref processCommand.
+    ResponseGenerator
+    processStreamCommand(const isc::data::ConstElementPtr& cmd);
+
+    /// @brief Creates generator of the response created at once.
+    ///
+    /// This is useful for the streamed command handlers which report
+    /// errors.
+    ///
+    /// @param response Response to the command.
+    ///
+    /// @return Generator returning the whole response.
+    static ResponseGenerator
+    createResponseGenerator(const isc::data::ConstElementPtr& response);
+
     /// @brief Returns control socket descriptor
     ///
     /// This method should be used only in tests.
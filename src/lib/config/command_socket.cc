@@ -1,4 +1,4 @@
-// Copyright (C) 2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -7,24 +7,44 @@
 #include <config/command_socket.h>
 #include <config/command_mgr.h>
 #include <config/config_log.h>
+#include <cc/command_interpreter.h>
 #include <dhcp/iface_mgr.h>
 #include <boost/bind.hpp>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
 #include <unistd.h>
 
+using namespace isc::data;
+
 namespace isc {
 namespace config {
 
-ConnectionSocket::ConnectionSocket(int sockfd) {
+ConnectionSocket::ConnectionSocket(int sockfd)
+    : scan_pos_(0), depth_(0), in_string_(false), escape_(false),
+      in_comment_(false), response_sent_(0), send_handler_installed_(false),
+      busy_(false), close_pending_(false), eof_(false) {
     sockfd_ = sockfd;
 
-    // Install commandReader callback. When there's any data incoming on this
-    // socket, commandReader will be called and process it. It may also
+    // Install receiveHandler callback. When there's any data incoming on
+    // this socket, receiveHandler will be called and process it. It may also
     // eventually close this socket.
     isc::dhcp::IfaceMgr::instance().addExternalSocket(sockfd,
         boost::bind(&ConnectionSocket::receiveHandler, this));
     }
 
 void ConnectionSocket::close() {
+    // The command being processed may close the control channel, e.g.
+    // when it reconfigures the server. Its response should still be sent.
+    if (busy_) {
+        close_pending_ = true;
+        return;
+    }
+
+    if (sockfd_ < 0) {
+        return;
+    }
+
     LOG_INFO(command_logger, COMMAND_SOCKET_CONNECTION_CLOSED).arg(sockfd_);
 
     // Unregister this callback
@@ -33,10 +53,276 @@ void ConnectionSocket::close() {
     // We're closing a connection, not the whole socket. It's ok to just
     // close the connection and don't delete anything.
     ::close(sockfd_);
+    sockfd_ = -1;
 }
 
 void ConnectionSocket::receiveHandler() {
-    CommandMgr::instance().commandReader(sockfd_);
+    char buf[65536];
+
+    // Read all data available in the socket.
+    for (;;) {
+        ssize_t rval = read(sockfd_, buf, sizeof(buf));
+        if (rval > 0) {
+            LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_READ)
+                .arg(rval).arg(sockfd_);
+            request_.append(buf, static_cast<size_t>(rval));
+
+        } else if (rval == 0) {
+            // The client won't send more data, so stop reading from the
+            // socket. The responses to the received commands are still sent.
+            eof_ = true;
+            isc::dhcp::IfaceMgr::instance().
+                addExternalSocket(sockfd_,
+                                  isc::dhcp::IfaceMgr::SocketCallback());
+            break;
+
+        } else if (errno == EINTR) {
+            continue;
+
+        } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+            break;
+
+        } else {
+            LOG_ERROR(command_logger, COMMAND_SOCKET_READ_FAIL)
+                .arg(strerror(errno)).arg(sockfd_);
+            CommandMgr::instance().closeConnection(sockfd_);
+            return;
+        }
+    }
+
+    processRequests();
+}
+
+void ConnectionSocket::sendHandler() {
+    if (!sendResponse()) {
+        CommandMgr::instance().closeConnection(sockfd_);
+        return;
+    }
+
+    // Process the commands received while the response was being sent.
+    processRequests();
+}
+
+void ConnectionSocket::processRequests() {
+    // There is at most one response being sent at any time, so the
+    // responses are sent in order.
+    while (response_.empty() && !generator_ && !close_pending_) {
+        size_t end = 0;
+        if (!findRequestEnd(end)) {
+            // The client has closed the connection in the middle of the
+            // command. Let's process what we have to report the error.
+            if (!eof_ || (request_.find_first_not_of(" \t\r\n") ==
+                          std::string::npos)) {
+                break;
+            }
+            end = request_.size();
+        }
+
+        std::string request = request_.substr(0, end);
+        request_.erase(0, end);
+        scan_pos_ = 0;
+        depth_ = 0;
+        in_string_ = false;
+        escape_ = false;
+        in_comment_ = false;
+
+        processRequest(request);
+        if (!sendResponse()) {
+            CommandMgr::instance().closeConnection(sockfd_);
+            return;
+        }
+    }
+
+    if (response_.empty() && !generator_ && (close_pending_ || eof_)) {
+        CommandMgr::instance().closeConnection(sockfd_);
+    }
+}
+
+void ConnectionSocket::processRequest(const std::string& request) {
+    ConstElementPtr rsp;
+
+    // Ok, we received something. Let's see if we can make any sense of it.
+    busy_ = true;
+    try {
+
+        // Try to interpret it as JSON.
+        ConstElementPtr cmd = Element::fromJSON(request, true);
+
+        // If successful, then process it as a command. The response to
+        // the streamed command is generated while it is being sent.
+        generator_ = CommandMgr::instance().processStreamCommand(cmd);
+        if (!generator_) {
+            rsp = CommandMgr::instance().processCommand(cmd);
+        }
+    } catch (const std::exception& ex) {
+        LOG_WARN(command_logger, COMMAND_PROCESS_ERROR1).arg(ex.what());
+        rsp = createAnswer(CONTROL_RESULT_ERROR, std::string(ex.what()));
+    }
+    busy_ = false;
+
+    if (generator_) {
+        response_.clear();
+        response_sent_ = 0;
+        return;
+    }
+
+    if (!rsp) {
+        LOG_WARN(command_logger, COMMAND_RESPONSE_ERROR);
+        return;
+    }
+
+    // Let's convert JSON response to text. Note that at this stage
+    // the rsp pointer is always set.
+    response_ = rsp->str();
+    response_sent_ = 0;
+}
+
+bool ConnectionSocket::findRequestEnd(size_t& end) {
+    for (; scan_pos_ < request_.size(); ++scan_pos_) {
+        const char c = request_[scan_pos_];
+
+        if (in_comment_) {
+            in_comment_ = (c != '\n');
+            continue;
+        }
+
+        if (in_string_) {
+            if (escape_) {
+                escape_ = false;
+            } else if (c == '\\') {
+                escape_ = true;
+            } else if (c == '"') {
+                in_string_ = false;
+            }
+            continue;
+        }
+
+        // Lines starting with the hash are comments.
+        if ((c == '#') && ((scan_pos_ == 0) ||
+                           (request_[scan_pos_ - 1] == '\n'))) {
+            in_comment_ = true;
+            continue;
+        }
+
+        if (depth_ == 0) {
+            if (isspace(static_cast<unsigned char>(c))) {
+                continue;
+            }
+            // Anything else than a map or list can't be delimited, so
+            // take all data received so far.
+            if ((c != '{') && (c != '[')) {
+                scan_pos_ = request_.size();
+                end = scan_pos_;
+                return (true);
+            }
+        }
+
+        switch (c) {
+        case '"':
+            in_string_ = true;
+            break;
+
+        case '{':
+        case '[':
+            ++depth_;
+            break;
+
+        case '}':
+        case ']':
+            if (--depth_ == 0) {
+                end = ++scan_pos_;
+                return (true);
+            }
+            break;
+
+        default:
+            break;
+        }
+    }
+
+    return (false);
+}
+
+bool ConnectionSocket::generateResponse() {
+    try {
+        if (!generator_(response_)) {
+            generator_ = ResponseGenerator();
+        }
+
+    } catch (const std::exception& ex) {
+        // A part of the response may have been sent already, so the
+        // error can't be reported to the client other than by closing
+        // the connection in the middle of the response.
+        LOG_ERROR(command_logger, COMMAND_SOCKET_STREAM_FAIL)
+            .arg(sockfd_).arg(ex.what());
+        generator_ = ResponseGenerator();
+        return (false);
+    }
+    return (true);
+}
+
+void ConnectionSocket::setSendHandler(const bool install) {
+    if (install == send_handler_installed_) {
+        return;
+    }
+    isc::dhcp::IfaceMgr::SocketCallback callback;
+    if (install) {
+        callback = boost::bind(&ConnectionSocket::sendHandler, this);
+    }
+    isc::dhcp::IfaceMgr::instance().setExternalSocketWriteCallback(sockfd_,
+                                                                   callback);
+    send_handler_installed_ = install;
+}
+
+bool ConnectionSocket::sendResponse() {
+    bool generated = false;
+    for (;;) {
+        while (response_sent_ < response_.size()) {
+            const size_t len = response_.size() - response_sent_;
+            ssize_t rval = write(sockfd_, response_.data() + response_sent_,
+                                 len);
+            if (rval < 0) {
+                if (errno == EINTR) {
+                    continue;
+
+                } else if ((errno == EAGAIN) || (errno == EWOULDBLOCK)) {
+                    // The socket buffer is full. Let's send the rest when
+                    // the socket is ready.
+                    setSendHandler(true);
+                    return (true);
+                }
+
+                // Response transmission failed. Since the response failed,
+                // it doesn't make sense to send any status codes. Let's log
+                // it and be done with it.
+                LOG_ERROR(command_logger, COMMAND_SOCKET_WRITE_FAIL)
+                    .arg(len).arg(sockfd_).arg(strerror(errno));
+                return (false);
+            }
+
+            LOG_DEBUG(command_logger, DBG_COMMAND, COMMAND_SOCKET_WRITE)
+                .arg(rval).arg(sockfd_);
+            response_sent_ += static_cast<size_t>(rval);
+        }
+
+        response_.clear();
+        response_sent_ = 0;
+
+        // Generate at most one part of the streamed response at once, so
+        // as the other events are handled between the parts.
+        if (!generator_ || generated) {
+            break;
+        }
+        generated = true;
+        if (!generateResponse()) {
+            return (false);
+        }
+    }
+
+    // The next part of the streamed response is generated when the
+    // socket is ready. Otherwise, the whole response has been sent.
+    setSendHandler(static_cast<bool>(generator_));
+    return (true);
 }
 
 };
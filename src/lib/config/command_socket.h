@@ -1,4 +1,4 @@
-// Copyright (C) 2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2015-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,8 @@
 #define COMMAND_SOCKET_H
 
 #include <cc/data.h>
+#include <boost/function.hpp>
+#include <string>
 #include <unistd.h>
 
 namespace isc {
@@ -27,6 +29,15 @@ public:
         isc::Exception(file, line, what) { };
 };
 
+/// @brief Generator of the response sent in parts.
+///
+/// The generator is called each time the previous part of the response has
+/// been sent. It appends the next part of the response text to the string
+/// and returns true if more parts follow or false if the response is
+/// complete. The parts need not be valid JSON on their own, but they must
+/// form a valid JSON response together.
+typedef boost::function<bool (std::string& part)> ResponseGenerator;
+
 /// @brief Abstract base class that represents an open command socket
 ///
 /// Derived classes are expected to handle specific socket types (e.g. UNIX
@@ -76,6 +87,21 @@ typedef boost::shared_ptr<CommandSocket> CommandSocketPtr;
 /// @ref UnixCommandSocket). Once incoming connection is detected, that class
 /// calls accept(), which returns a new socket dedicated to handling that
 /// specific connection. That socket is represented by this class.
+///
+/// The socket is non-blocking. The received data are accumulated until
+/// a complete command, i.e. a JSON map, has been received, so the commands
+/// may be of any size and may be split across multiple reads. The commands
+/// are processed in the order in which they have been received. The response
+/// is sent as much as the socket accepts at once and the rest is sent when
+/// the @ref isc::dhcp::IfaceMgr reports that the socket is ready for writing,
+/// so large responses don't block the server.
+///
+/// The responses to the streamed commands (see
+/// @ref CommandMgr::registerStreamCommand) are produced in parts by the
+/// @ref ResponseGenerator. The next part is generated only when the previous
+/// one has been sent and the socket is ready for writing, so the server
+/// processes other events, e.g. DHCP packets, between the parts and the
+/// response is never held in memory as a whole.
 class ConnectionSocket : public CommandSocket {
 public:
     /// @brief Default constructor
@@ -89,14 +115,124 @@ public:
 
     /// @brief Method used to handle incoming data
     ///
-    /// This method calls isc::config::CommandMgr::commandReader method.
+    /// This method reads all data available in the socket and processes
+    /// the complete commands using the @ref isc::config::CommandMgr. If
+    /// end-of-file is detected, the connection is closed once the responses
+    /// to the received commands have been sent.
     virtual void receiveHandler();
 
+    /// @brief Method used to send the remaining part of the response
+    ///
+    /// This method is installed in @ref isc::dhcp::IfaceMgr as the write
+    /// callback when the response doesn't fit in the socket buffer.
+    void sendHandler();
+
     /// @brief Closes socket.
     ///
     /// This method closes the socket, prints appropriate log message and
-    /// unregisters callback from @ref isc::dhcp::IfaceMgr.
+    /// unregisters callback from @ref isc::dhcp::IfaceMgr. If the socket
+    /// is closed while processing a command, e.g. because the command
+    /// reconfigures the control channel, it is closed after the response
+    /// has been sent. The socket descriptor is set to -1 when the socket
+    /// has been closed.
     virtual void close();
+
+private:
+
+    /// @brief Processes the complete commands received so far.
+    ///
+    /// The commands are processed until a response can't be sent at once.
+    /// The connection is closed when all commands have been processed and
+    /// the close is pending or the client has closed its side of the
+    /// connection.
+    ///
+    /// @note The connection object may be destroyed by this method, so it
+    /// must be the last action of the caller.
+    void processRequests();
+
+    /// @brief Processes the command and stores the response to be sent.
+    ///
+    /// The response to the streamed command is not stored, but its
+    /// generator is.
+    ///
+    /// @param request text of the command.
+    void processRequest(const std::string& request);
+
+    /// @brief Generates the next part of the streamed response.
+    ///
+    /// The generator is removed when the response is complete.
+    ///
+    /// @return false if generating the response failed.
+    bool generateResponse();
+
+    /// @brief Installs or removes @c sendHandler.
+    ///
+    /// @param install true if the handler is to be installed, false if it
+    /// is to be removed.
+    void setSendHandler(const bool install);
+
+    /// @brief Finds the end of the first command in the received data.
+    ///
+    /// The command ends with the bracket closing its top level JSON map.
+    /// The data are scanned incrementally, i.e. the data scanned during the
+    /// previous calls are not scanned again. If the data don't start with
+    /// a JSON map or list, all received data are taken as the command, so
+    /// the error is reported for them.
+    ///
+    /// @param [out] end offset following the end of the command.
+    ///
+    /// @return true if the command has been received completely.
+    bool findRequestEnd(size_t& end);
+
+    /// @brief Sends the response.
+    ///
+    /// Sends as much of the response as the socket accepts and installs
+    /// @c sendHandler to send the rest later. At most one part of the
+    /// streamed response is generated per call.
+    ///
+    /// @return false if sending the response failed.
+    bool sendResponse();
+
+    /// @brief Data received and not processed yet.
+    std::string request_;
+
+    /// @brief Offset of the first byte of @c request_ not scanned yet.
+    size_t scan_pos_;
+
+    /// @brief Nesting level of the JSON maps and lists scanned so far.
+    int depth_;
+
+    /// @brief Indicates that the scanner is within a JSON string.
+    bool in_string_;
+
+    /// @brief Indicates that the previous character was an escape.
+    bool escape_;
+
+    /// @brief Indicates that the scanner is within a comment line.
+    bool in_comment_;
+
+    /// @brief Response being sent.
+    std::string response_;
+
+    /// @brief Number of bytes of @c response_ sent so far.
+    size_t response_sent_;
+
+    /// @brief Generator of the streamed response being sent.
+    ResponseGenerator generator_;
+
+    /// @brief Indicates that @c sendHandler is installed.
+    bool send_handler_installed_;
+
+    /// @brief Indicates that a command is being processed.
+    bool busy_;
+
+    /// @brief Indicates that the connection should be closed when the
+    /// response has been sent.
+    bool close_pending_;
+
+    /// @brief Indicates that the client has closed its side of the
+    /// connection.
+    bool eof_;
 };
 
 };
@@ -42,6 +42,11 @@ HookedCommandMgr::HookedCommandMgr()
     : BaseCommandMgr(), callout_handle_(HooksManager::createCalloutHandle()) {
 }
 
+bool
+HookedCommandMgr::hasCommandCallouts() const {
+    return (HooksManager::calloutsPresent(Hooks.hook_index_control_command_receive_));
+}
+
 ConstElementPtr
 HookedCommandMgr::handleCommand(const std::string& cmd_name,
                                 const ConstElementPtr& params) {
@@ -54,7 +59,7 @@ HookedCommandMgr::handleCommand(const std::string& cmd_name,
     ConstElementPtr final_params = boost::const_pointer_cast<Element>(params);
 
     ConstElementPtr hook_response;
-    if (HooksManager::calloutsPresent(Hooks.hook_index_control_command_receive_)) {
+    if (hasCommandCallouts()) {
 
         // Delete previously set arguments.
         callout_handle_->deleteAllArguments();
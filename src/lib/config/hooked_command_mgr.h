@@ -36,6 +36,12 @@ protected:
         return (callout_handle_);
     }
 
+    /// @brief Checks if the commands are delegated to a hook library.
+    ///
+    /// @return true if callouts for the 'control_command_receive' hook
+    /// point are installed.
+    bool hasCommandCallouts() const;
+
     /// @brief Handles the command having a given name and arguments.
     ///
     /// This method checks if the hook library is installed which implements
@@ -13,6 +13,8 @@
 #include <hooks/hooks_manager.h>
 #include <hooks/callout_handle.h>
 #include <hooks/library_handle.h>
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
 #include <string>
 #include <vector>
 
@@ -63,6 +65,41 @@ public:
         return (createAnswer(123, "test error message"));
     }
 
+    /// @brief A streamed command handler generating the response in parts.
+    ///
+    /// @param name Command name.
+    /// @param params Command arguments.
+    static ResponseGenerator my_stream_handler(const std::string& name,
+                                               const ConstElementPtr& params) {
+        handler_name = name;
+        handler_params = params;
+        handler_called = true;
+
+        return (boost::bind(&appendStreamPart,
+                            boost::shared_ptr<int>(new int(0)), _1));
+    }
+
+    /// @brief Appends the next part of the streamed response.
+    ///
+    /// @param index Index of the part to be appended.
+    /// @param [out] part Text to which the part is appended.
+    ///
+    /// @return true if more parts follow.
+    static bool appendStreamPart(const boost::shared_ptr<int>& index,
+                                 std::string& part) {
+        switch ((*index)++) {
+        case 0:
+            part.append("{ \"result\": 0, ");
+            return (true);
+        case 1:
+            part.append("\"arguments\": [ 1, 2 ], ");
+            return (true);
+        default:
+            part.append("\"text\": \"streamed\" }");
+            return (false);
+        }
+    }
+
     /// @brief A simple command handler used from within hook library.
     ///
     /// @param name Command name.
@@ -357,6 +394,66 @@ TEST_F(CommandMgrTest, processCommand) {
     EXPECT_EQ("response", callout_argument_names[1]);
 }
 
+// Verify that the streamed commands are processed in parts or at once.
+TEST_F(CommandMgrTest, processStreamCommand) {
+    EXPECT_NO_THROW(CommandMgr::instance().registerStreamCommand("my-stream",
+        my_stream_handler));
+    EXPECT_NO_THROW(CommandMgr::instance().registerCommand("my-command",
+                                                           my_handler));
+
+    // The streamed command is listed as any other command.
+    ConstElementPtr answer =
+        CommandMgr::instance().processCommand(createCommand("list-commands"));
+    ASSERT_TRUE(answer);
+    ASSERT_TRUE(answer->get("arguments"));
+    EXPECT_EQ("[ \"list-commands\", \"my-command\", \"my-stream\" ]",
+              answer->get("arguments")->str());
+
+    // The response is generated in parts.
+    ElementPtr my_params = Element::fromJSON("{ \"param\": 1 }");
+    ResponseGenerator generator = CommandMgr::instance().
+        processStreamCommand(createCommand("my-stream", my_params));
+    ASSERT_TRUE(generator);
+    EXPECT_TRUE(handler_called);
+    EXPECT_EQ("my-stream", handler_name);
+    ASSERT_TRUE(handler_params);
+    EXPECT_EQ("{ \"param\": 1 }", handler_params->str());
+
+    std::string response;
+    size_t parts = 1;
+    while (generator(response)) {
+        ++parts;
+    }
+    EXPECT_EQ(3, parts);
+    EXPECT_EQ("{ \"result\": 0, \"arguments\": [ 1, 2 ], "
+              "\"text\": \"streamed\" }", response);
+
+    // The response is generated at once by processCommand.
+    ASSERT_NO_THROW(answer = CommandMgr::instance().
+                    processCommand(createCommand("my-stream")));
+    ASSERT_TRUE(answer);
+    int status_code = -1;
+    ConstElementPtr answer_arg = parseAnswer(status_code, answer);
+    EXPECT_EQ(0, status_code);
+    ASSERT_TRUE(answer_arg);
+    EXPECT_EQ("[ 1, 2 ]", answer_arg->str());
+
+    // The other commands are not streamed.
+    EXPECT_FALSE(CommandMgr::instance().
+                 processStreamCommand(createCommand("my-command")));
+    EXPECT_FALSE(CommandMgr::instance().
+                 processStreamCommand(createCommand("bogus")));
+
+    // The streamed command is deregistered as any other command.
+    EXPECT_NO_THROW(CommandMgr::instance().deregisterCommand("my-stream"));
+    EXPECT_FALSE(CommandMgr::instance().
+                 processStreamCommand(createCommand("my-stream")));
+
+    // Empty handler is rejected.
+    EXPECT_THROW(CommandMgr::instance().registerStreamCommand("my-stream",
+                 CommandMgr::StreamCommandHandler()), InvalidCommandHandler);
+}
+
 // Verify that processing a command can be delegated to a hook library.
 TEST_F(CommandMgrTest, delegateProcessCommand) {
     // Register callout so as we can check that it is called before
@@ -8,6 +8,7 @@
 #include <exceptions/exceptions.h>
 #include <util/io_utilities.h>
 #include <util/strutil.h>
+#include <boost/functional/hash.hpp>
 #include <iomanip>
 #include <cctype>
 #include <sstream>
@@ -92,6 +93,11 @@ bool DUID::operator!=(const DUID& other) const {
     return (this->duid_ != other.duid_);
 }
 
+size_t hash_value(const DUID& duid) {
+    const std::vector<uint8_t>& data = duid.getDuid();
+    return (boost::hash_range(data.begin(), data.end()));
+}
+
 // Constructor based on vector<uint8_t>
 ClientId::ClientId(const std::vector<uint8_t>& clientid)
     : DUID(clientid) {
@@ -8,6 +8,7 @@
 #define DUID_H
 
 #include <asiolink/io_address.h>
+#include <util/pool_allocator.h>
 #include <boost/shared_ptr.hpp>
 #include <vector>
 #include <stdint.h>
@@ -24,7 +25,10 @@ typedef boost::shared_ptr<DUID> DuidPtr;
 ///
 /// This class holds DUID, that is used in client-id, server-id and
 /// several other options. It is used to identify DHCPv6 entity.
-class DUID {
+///
+/// The instances, including the DHCPv4 client identifiers, are allocated
+/// from the free lists (see @ref isc::util::PoolAllocated).
+class DUID : public util::PoolAllocated {
  public:
     /// @brief maximum duid size
     /// As defined in RFC3315, section 9.1
@@ -100,6 +104,15 @@ class DUID {
     std::vector<uint8_t> duid_;
 };
 
+/// @brief Returns the hash value of the DUID or client identifier.
+///
+/// This function allows for using the @c DUID and @c ClientId with
+/// @c boost::hash.
+///
+/// @param duid DUID or client identifier.
+/// @return Hash value of the identifier.
+size_t hash_value(const DUID& duid);
+
 /// @brief Forward declaration to the @c ClientId class.
 class ClientId;
 /// @brief Shared pointer to a Client ID.
@@ -8,6 +8,7 @@
 #include <dhcp/dhcp4.h>
 #include <exceptions/exceptions.h>
 #include <util/strutil.h>
+#include <boost/functional/hash.hpp>
 #include <iomanip>
 #include <sstream>
 #include <vector>
@@ -80,5 +81,11 @@ bool HWAddr::operator!=(const HWAddr& other) const {
     return !(*this == other);
 }
 
+size_t hash_value(const HWAddr& hwaddr) {
+    size_t seed = hwaddr.htype_;
+    boost::hash_range(seed, hwaddr.hwaddr_.begin(), hwaddr.hwaddr_.end());
+    return (seed);
+}
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
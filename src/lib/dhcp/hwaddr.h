@@ -11,13 +11,18 @@
 #include <stdint.h>
 #include <stddef.h>
 #include <dhcp/dhcp4.h>
+#include <util/pool_allocator.h>
 #include <boost/shared_ptr.hpp>
 
 namespace isc {
 namespace dhcp {
 
 /// @brief Hardware type that represents information from DHCPv4 packet
-struct HWAddr {
+///
+/// The instances are allocated from the free lists (see
+/// @ref isc::util::PoolAllocated), because one is created for each
+/// received packet.
+struct HWAddr : public util::PoolAllocated {
 public:
 
     /// @brief Size of an ethernet hardware address.
@@ -153,6 +158,14 @@ public:
 /// @brief Shared pointer to a hardware address structure
 typedef boost::shared_ptr<HWAddr> HWAddrPtr;
 
+/// @brief Returns the hash value of the hardware address.
+///
+/// This function allows for using the @c HWAddr with @c boost::hash.
+///
+/// @param hwaddr Hardware address.
+/// @return Hash value of the hardware type and the address.
+size_t hash_value(const HWAddr& hwaddr);
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
@@ -170,6 +170,7 @@ IfaceMgr::IfaceMgr()
      control_buf_(new char[control_buf_len_]),
      packet_filter_(new PktFilterInet()),
      packet_filter6_(new PktFilterInet6()),
+     last_external_socket_(-1), dhcp_sockets_turn_(false),
      test_mode_(false)
 {
 
@@ -291,11 +292,12 @@ IfaceMgr::addExternalSocket(int socketfd, SocketCallback callback) {
         isc_throw(BadValue, "Attempted to install callback for invalid socket "
                   << socketfd);
     }
-    BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
+    for (SocketCallbackInfoContainer::iterator s = callbacks_.begin();
+         s != callbacks_.end(); ++s) {
         // There's such a socket description there already.
         // Update the callback and we're done
-        if (s.socket_ == socketfd) {
-            s.callback_ = callback;
+        if (s->socket_ == socketfd) {
+            s->callback_ = callback;
             return;
         }
     }
@@ -307,6 +309,20 @@ IfaceMgr::addExternalSocket(int socketfd, SocketCallback callback) {
     callbacks_.push_back(x);
 }
 
+void
+IfaceMgr::setExternalSocketWriteCallback(int socketfd,
+                                         SocketCallback callback) {
+    for (SocketCallbackInfoContainer::iterator s = callbacks_.begin();
+         s != callbacks_.end(); ++s) {
+        if (s->socket_ == socketfd) {
+            s->write_callback_ = callback;
+            return;
+        }
+    }
+    isc_throw(BadValue, "Attempted to install write callback for socket "
+              << socketfd << " which is not an external socket");
+}
+
 void
 IfaceMgr::deleteExternalSocket(int socketfd) {
     for (SocketCallbackInfoContainer::iterator s = callbacks_.begin();
@@ -880,6 +896,38 @@ IfaceMgr::send(const Pkt4Ptr& pkt) {
 }
 
 
+IfaceMgr::SocketCallback
+IfaceMgr::getExternalSocketCallback(const fd_set& sockets,
+                                    const fd_set& write_sockets) {
+    // Start after the socket serviced last, so as all ready sockets get
+    // their turn.
+    SocketCallbackInfoContainer::const_iterator s = callbacks_.begin();
+    for (SocketCallbackInfoContainer::const_iterator last = callbacks_.begin();
+         last != callbacks_.end(); ++last) {
+        if (last->socket_ == last_external_socket_) {
+            s = last;
+            ++s;
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < callbacks_.size(); ++i, ++s) {
+        if (s == callbacks_.end()) {
+            s = callbacks_.begin();
+        }
+        if (s->callback_ && FD_ISSET(s->socket_, &sockets)) {
+            last_external_socket_ = s->socket_;
+            return (s->callback_);
+        }
+        if (s->write_callback_ && FD_ISSET(s->socket_, &write_sockets)) {
+            last_external_socket_ = s->socket_;
+            return (s->write_callback_);
+        }
+    }
+
+    return (SocketCallback());
+}
+
 Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */) {
     // Sanity check for microsecond timeout.
     if (timeout_usec >= 1000000) {
@@ -889,9 +937,11 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     boost::scoped_ptr<SocketInfo> candidate;
     IfacePtr iface;
     fd_set sockets;
+    fd_set write_sockets;
     int maxfd = 0;
 
     FD_ZERO(&sockets);
+    FD_ZERO(&write_sockets);
 
     /// @todo: marginal performance optimization. We could create the set once
     /// and then use its copy for select(). Please note that select() modifies
@@ -914,7 +964,14 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     // if there are any callbacks for external sockets registered...
     if (!callbacks_.empty()) {
         BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-            FD_SET(s.socket_, &sockets);
+            if (s.callback_) {
+                FD_SET(s.socket_, &sockets);
+            }
+            // The socket is checked for writing only when there are
+            // data waiting to be sent.
+            if (s.write_callback_) {
+                FD_SET(s.socket_, &write_sockets);
+            }
             if (maxfd < s.socket_) {
                 maxfd = s.socket_;
             }
@@ -928,7 +985,8 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     // zero out the errno to be safe
     errno = 0;
 
-    int result = select(maxfd + 1, &sockets, NULL, NULL, &select_timeout);
+    int result = select(maxfd + 1, &sockets, &write_sockets, NULL,
+                        &select_timeout);
 
     if (result == 0) {
         // nothing received and timeout has been reached
@@ -949,24 +1007,6 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         }
     }
 
-    // Let's find out which socket has the data
-    BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-        if (!FD_ISSET(s.socket_, &sockets)) {
-            continue;
-        }
-
-        // something received over external socket
-
-        // Calling the external socket's callback provides its service
-        // layer access without integrating any specific features
-        // in IfaceMgr
-        if (s.callback_) {
-            s.callback_();
-        }
-
-        return (Pkt4Ptr());
-    }
-
     // Let's find out which interface/socket has the data
     BOOST_FOREACH(iface, ifaces_) {
         BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
@@ -980,6 +1020,24 @@ Pkt4Ptr IfaceMgr::receive4(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         }
     }
 
+    // The external sockets and the DHCP sockets are serviced in turn when
+    // both are ready, so as a long transfer over an external socket, e.g.
+    // a lease export, doesn't hold up the DHCP traffic and vice versa.
+    if (!candidate || !dhcp_sockets_turn_) {
+        SocketCallback callback = getExternalSocketCallback(sockets,
+                                                            write_sockets);
+        if (callback) {
+            dhcp_sockets_turn_ = true;
+
+            // Calling the external socket's callback provides its service
+            // layer access without integrating any specific features
+            // in IfaceMgr
+            callback();
+            return (Pkt4Ptr());
+        }
+    }
+    dhcp_sockets_turn_ = false;
+
     if (!candidate) {
         isc_throw(SocketReadError, "received data over unknown socket");
     }
@@ -998,9 +1056,11 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
 
     boost::scoped_ptr<SocketInfo> candidate;
     fd_set sockets;
+    fd_set write_sockets;
     int maxfd = 0;
 
     FD_ZERO(&sockets);
+    FD_ZERO(&write_sockets);
 
     /// @todo: marginal performance optimization. We could create the set once
     /// and then use its copy for select(). Please note that select() modifies
@@ -1024,7 +1084,14 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     if (!callbacks_.empty()) {
         BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
             // Add it to the set as well
-            FD_SET(s.socket_, &sockets);
+            if (s.callback_) {
+                FD_SET(s.socket_, &sockets);
+            }
+            // The socket is checked for writing only when there are
+            // data waiting to be sent.
+            if (s.write_callback_) {
+                FD_SET(s.socket_, &write_sockets);
+            }
             if (maxfd < s.socket_) {
                 maxfd = s.socket_;
             }
@@ -1038,7 +1105,8 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
     // zero out the errno to be safe
     errno = 0;
 
-    int result = select(maxfd + 1, &sockets, NULL, NULL, &select_timeout);
+    int result = select(maxfd + 1, &sockets, &write_sockets, NULL,
+                        &select_timeout);
 
     if (result == 0) {
         // nothing received and timeout has been reached
@@ -1059,24 +1127,6 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         }
     }
 
-    // Let's find out which socket has the data
-    BOOST_FOREACH(SocketCallbackInfo s, callbacks_) {
-        if (!FD_ISSET(s.socket_, &sockets)) {
-            continue;
-        }
-
-        // something received over external socket
-
-        // Calling the external socket's callback provides its service
-        // layer access without integrating any specific features
-        // in IfaceMgr
-        if (s.callback_) {
-            s.callback_();
-        }
-
-        return (Pkt6Ptr());
-    }
-
     // Let's find out which interface/socket has the data
     BOOST_FOREACH(IfacePtr iface, ifaces_) {
         BOOST_FOREACH(SocketInfo s, iface->getSockets()) {
@@ -1090,6 +1140,24 @@ Pkt6Ptr IfaceMgr::receive6(uint32_t timeout_sec, uint32_t timeout_usec /* = 0 */
         }
     }
 
+    // The external sockets and the DHCP sockets are serviced in turn when
+    // both are ready, so as a long transfer over an external socket, e.g.
+    // a lease export, doesn't hold up the DHCP traffic and vice versa.
+    if (!candidate || !dhcp_sockets_turn_) {
+        SocketCallback callback = getExternalSocketCallback(sockets,
+                                                            write_sockets);
+        if (callback) {
+            dhcp_sockets_turn_ = true;
+
+            // Calling the external socket's callback provides its service
+            // layer access without integrating any specific features
+            // in IfaceMgr
+            callback();
+            return (Pkt6Ptr());
+        }
+    }
+    dhcp_sockets_turn_ = false;
+
     if (!candidate) {
         isc_throw(SocketReadError, "received data over unknown socket");
     }
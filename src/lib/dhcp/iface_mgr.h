@@ -21,6 +21,8 @@
 #include <boost/scoped_array.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <sys/select.h>
+
 #include <list>
 #include <vector>
 
@@ -531,6 +533,10 @@ public:
 
         /// A callback that will be called when data arrives over socket_.
         SocketCallback callback_;
+
+        /// A callback that will be called when data can be sent over
+        /// socket_.
+        SocketCallback write_callback_;
     };
 
     /// Defines storage container for callbacks for external sockets
@@ -718,6 +724,8 @@ public:
     ///
     /// This method also checks if data arrived over registered external socket.
     /// This data may be of a different protocol family than AF_INET6.
+    /// The external sockets and the DHCP sockets are serviced in turn
+    /// when both are ready, so as neither of them is starved.
     ///
     /// @param timeout_sec specifies integral part of the timeout (in seconds)
     /// @param timeout_usec specifies fractional part of the timeout
@@ -740,6 +748,8 @@ public:
     ///
     /// This method also checks if data arrived over registered external socket.
     /// This data may be of a different protocol family than AF_INET.
+    /// The external sockets and the DHCP sockets are serviced in turn
+    /// when both are ready, so as neither of them is starved.
     ///
     /// @param timeout_sec specifies integral part of the timeout (in seconds)
     /// @param timeout_usec specifies fractional part of the timeout
@@ -981,12 +991,29 @@ public:
     /// @brief Adds external socket and a callback
     ///
     /// Specifies external socket and a callback that will be called
-    /// when data will be received over that socket.
+    /// when data will be received over that socket. If the socket has
+    /// been already added, its callback is replaced. The socket with
+    /// an empty callback is not checked for the incoming data.
     ///
     /// @param socketfd socket descriptor
     /// @param callback callback function
     void addExternalSocket(int socketfd, SocketCallback callback);
 
+    /// @brief Sets the callback invoked when the external socket is ready
+    /// for sending data.
+    ///
+    /// The socket is checked for writing only while this callback is set.
+    /// Because the sockets are nearly always ready for writing, the callback
+    /// should be set only when there are data waiting to be sent and it
+    /// should be cleared, by passing an empty callback, when they have been
+    /// sent. The callback is called once per call to @c receive4 or
+    /// @c receive6, so it should send a limited amount of data.
+    ///
+    /// @param socketfd socket descriptor of the external socket
+    /// @param callback callback function or empty callback
+    /// @throw BadValue if the socket hasn't been added.
+    void setExternalSocketWriteCallback(int socketfd, SocketCallback callback);
+
     /// @brief Deletes external socket
     void deleteExternalSocket(int socketfd);
 
@@ -1174,6 +1201,21 @@ private:
                     const uint16_t port);
 
 
+    /// @brief Returns the callback of the next external socket to be
+    /// serviced.
+    ///
+    /// The ready external sockets are serviced in round-robin order,
+    /// starting after the socket serviced last. The read callback of
+    /// the socket takes precedence over its write callback.
+    ///
+    /// @param sockets set of sockets ready for reading.
+    /// @param write_sockets set of sockets ready for writing.
+    ///
+    /// @return copy of the callback or empty callback if none of the
+    /// external sockets is ready.
+    SocketCallback getExternalSocketCallback(const fd_set& sockets,
+                                             const fd_set& write_sockets);
+
     /// @brief Open an IPv6 socket with multicast support.
     ///
     /// This function opens a socket capable of receiving messages sent to
@@ -1215,6 +1257,13 @@ private:
     /// @brief Contains list of callbacks for external sockets
     SocketCallbackInfoContainer callbacks_;
 
+    /// @brief Socket descriptor of the external socket serviced last.
+    int last_external_socket_;
+
+    /// @brief Indicates if the DHCP sockets are serviced before the
+    /// external sockets when both are ready.
+    bool dhcp_sockets_turn_;
+
     /// @brief Indicates if the IfaceMgr is in the test mode.
     bool test_mode_;
 };
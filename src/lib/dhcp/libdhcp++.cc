@@ -26,6 +26,7 @@
 #include <boost/shared_array.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <list>
 
@@ -57,9 +58,24 @@ VendorOptionDefContainers LibDHCP::vendor6_defs_;
 // Static container with option definitions created in runtime.
 StagedValue<OptionDefSpaceContainer> LibDHCP::runtime_option_defs_;
 
+// Static table with DHCPv4 option definitions indexed by option code.
+OptionDefTable LibDHCP::v4option_def_table_;
+
+// Static table with DHCPv6 option definitions indexed by option code.
+OptionDefTable LibDHCP::v6option_def_table_;
+
+// Static tables with DHCPv4 vendor option definitions.
+VendorOptionDefTables LibDHCP::vendor4_def_tables_;
+
+// Static tables with DHCPv6 vendor option definitions.
+VendorOptionDefTables LibDHCP::vendor6_def_tables_;
+
 // Null container.
 const OptionDefContainerPtr null_option_def_container_(new OptionDefContainer());
 
+// Empty table.
+const OptionDefTable null_option_def_table_;
+
 // Those two vendor classes are used for cable modems:
 
 /// DOCSIS3.0 compatible cable modem
@@ -74,16 +90,42 @@ void initOptionSpace(OptionDefContainerPtr& defs,
                      const OptionDefParams* params,
                      size_t params_size);
 
+namespace {
+
+/// @brief Returns the definition of the option from the container.
+///
+/// @param defs Container holding option definitions.
+/// @param code Option code.
+///
+/// @return Pointer to the definition or NULL if there is no definition
+/// for the option code.
+/// @throw isc::Unexpected if there are multiple definitions for the
+/// option code.
+const OptionDefinition*
+getSingleOptionDef(const OptionDefContainerPtr& defs, const uint16_t code) {
+    // Note that option code is non-unique within this container
+    // however at this point we expect to get one option definition
+    // with the particular code. If more are returned we report an
+    // error.
+    const OptionDefContainerTypeRange& range = defs->get<1>().equal_range(code);
+    size_t num_defs = distance(range.first, range.second);
+    if (num_defs > 1) {
+        // Multiple options of the same code are not supported right now!
+        isc_throw(isc::Unexpected, "Internal error: multiple option"
+                  " definitions for option type " << code <<
+                  " returned. Currently it is not supported to initialize"
+                  " multiple option definitions for the same option code."
+                  " This will be supported once support for option spaces"
+                  " is implemented");
+    }
+    return (num_defs == 0 ? NULL : range.first->get());
+}
+
+}
+
 const OptionDefContainerPtr&
 LibDHCP::getOptionDefs(const std::string& space) {
-    // If any of the containers is not initialized, it means that we haven't
-    // initialized option definitions at all.
-    if (v4option_defs_->empty()) {
-        initStdOptionDefs4();
-        initVendorOptsDocsis4();
-        initStdOptionDefs6();
-        initVendorOptsDocsis6();
-    }
+    initOptionDefs();
 
     if (space == DHCP4_OPTION_SPACE) {
         return (v4option_defs_);
@@ -101,11 +143,7 @@ LibDHCP::getOptionDefs(const std::string& space) {
 
 const OptionDefContainerPtr&
 LibDHCP::getVendorOption4Defs(const uint32_t vendor_id) {
-
-    if (vendor_id == VENDOR_ID_CABLE_LABS &&
-        vendor4_defs_.find(VENDOR_ID_CABLE_LABS) == vendor4_defs_.end()) {
-        initVendorOptsDocsis4();
-    }
+    initOptionDefs();
 
     VendorOptionDefContainers::const_iterator def = vendor4_defs_.find(vendor_id);
     if (def == vendor4_defs_.end()) {
@@ -117,16 +155,7 @@ LibDHCP::getVendorOption4Defs(const uint32_t vendor_id) {
 
 const OptionDefContainerPtr&
 LibDHCP::getVendorOption6Defs(const uint32_t vendor_id) {
-
-    if (vendor_id == VENDOR_ID_CABLE_LABS &&
-        vendor6_defs_.find(VENDOR_ID_CABLE_LABS) == vendor6_defs_.end()) {
-        initVendorOptsDocsis6();
-    }
-
-    if (vendor_id == ENTERPRISE_ID_ISC &&
-        vendor6_defs_.find(ENTERPRISE_ID_ISC) == vendor6_defs_.end()) {
-        initVendorOptsIsc6();
-    }
+    initOptionDefs();
 
     VendorOptionDefContainers::const_iterator def = vendor6_defs_.find(vendor_id);
     if (def == vendor6_defs_.end()) {
@@ -226,6 +255,63 @@ LibDHCP::getRuntimeOptionDefs(const std::string& space) {
     return (runtime_option_defs_.getValue().getItems(space));
 }
 
+const OptionDefTable&
+LibDHCP::getOptionDefTable(const Option::Universe u) {
+    // The table always holds the standard option definitions, so it
+    // is empty only if it hasn't been built yet.
+    if (v4option_def_table_.empty()) {
+        updateOptionDefTables();
+    }
+    return (u == Option::V4 ? v4option_def_table_ : v6option_def_table_);
+}
+
+void
+LibDHCP::updateOptionDefTables() {
+    // The runtime option definitions are only used for the option codes
+    // for which there are no standard definitions.
+    v4option_def_table_.clear();
+    v4option_def_table_.add(getOptionDefs(DHCP4_OPTION_SPACE));
+    v4option_def_table_.add(getRuntimeOptionDefs(DHCP4_OPTION_SPACE));
+
+    v6option_def_table_.clear();
+    v6option_def_table_.add(getOptionDefs(DHCP6_OPTION_SPACE));
+    v6option_def_table_.add(getRuntimeOptionDefs(DHCP6_OPTION_SPACE));
+
+    // The vendor option definitions never change, so the vendor tables
+    // are built once, together with the standard tables. They are never
+    // modified afterwards, which allows for parsing the vendor options
+    // in other threads, e.g. the thread parsing the configuration.
+    if (vendor4_def_tables_.empty() && vendor6_def_tables_.empty()) {
+        for (VendorOptionDefContainers::const_iterator defs = vendor4_defs_.begin();
+             defs != vendor4_defs_.end(); ++defs) {
+            vendor4_def_tables_[defs->first].add(defs->second);
+        }
+        for (VendorOptionDefContainers::const_iterator defs = vendor6_defs_.begin();
+             defs != vendor6_defs_.end(); ++defs) {
+            vendor6_def_tables_[defs->first].add(defs->second);
+        }
+    }
+}
+
+const OptionDefTable&
+LibDHCP::getVendorOptionDefTable(const Option::Universe u,
+                                 const uint32_t vendor_id) {
+    // The vendor tables are built with the standard tables.
+    if (v4option_def_table_.empty()) {
+        updateOptionDefTables();
+    }
+
+    // The vendor id is taken from the received packet. No table is
+    // created for the vendors without option definitions.
+    const VendorOptionDefTables& tables = (u == Option::V4 ? vendor4_def_tables_ :
+                                           vendor6_def_tables_);
+    VendorOptionDefTables::const_iterator table = tables.find(vendor_id);
+    if (table != tables.end()) {
+        return (table->second);
+    }
+    return (null_option_def_table_);
+}
+
 void
 LibDHCP::setRuntimeOptionDefs(const OptionDefSpaceContainer& defs) {
     OptionDefSpaceContainer defs_copy;
@@ -240,21 +326,25 @@ LibDHCP::setRuntimeOptionDefs(const OptionDefSpaceContainer& defs) {
         }
     }
     runtime_option_defs_ = defs_copy;
+    updateOptionDefTables();
 }
 
 void
 LibDHCP::clearRuntimeOptionDefs() {
     runtime_option_defs_.reset();
+    updateOptionDefTables();
 }
 
 void
 LibDHCP::revertRuntimeOptionDefs() {
     runtime_option_defs_.revert();
+    updateOptionDefTables();
 }
 
 void
 LibDHCP::commitRuntimeOptionDefs() {
     runtime_option_defs_.commit();
+    updateOptionDefTables();
 }
 
 OptionPtr
@@ -291,20 +381,17 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
     size_t length = buf.size();
     size_t last_offset = 0;
 
-    // Get the list of standard option definitions.
-    const OptionDefContainerPtr& option_defs = LibDHCP::getOptionDefs(option_space);
-    // Runtime option definitions for non standard option space and if
-    // the definition doesn't exist within the standard option definitions.
-    const OptionDefContainerPtr& runtime_option_defs = LibDHCP::getRuntimeOptionDefs(option_space);
-
-    // @todo Once we implement other option spaces we should add else clause
-    // here and gather option definitions for them. For now leaving option_defs
-    // empty will imply creation of generic Option.
-
-    // Get the search indexes #1. It allows to search for option definitions
-    // using option code.
-    const OptionDefContainerTypeIndex& idx = option_defs->get<1>();
-    const OptionDefContainerTypeIndex& runtime_idx = runtime_option_defs->get<1>();
+    // The definitions of the standard options and the runtime definitions
+    // of the other options in the standard space are held in the table
+    // indexed by option code. For other option spaces only the runtime
+    // option definitions are used.
+    const OptionDefTable* table = NULL;
+    OptionDefContainerPtr runtime_option_defs;
+    if (option_space == DHCP6_OPTION_SPACE) {
+        table = &getOptionDefTable(Option::V6);
+    } else {
+        runtime_option_defs = LibDHCP::getRuntimeOptionDefs(option_space);
+    }
 
     // The buffer being read comprises a set of options, each starting with
     // a two-byte type code and a two-byte length field.
@@ -364,37 +451,12 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
             continue;
         }
 
-        // Get all definitions with the particular option code. Note
-        // that option code is non-unique within this container
-        // however at this point we expect to get one option
-        // definition with the particular code. If more are returned
-        // we report an error.
-        OptionDefContainerTypeRange range;
-        // Number of option definitions returned.
-        size_t num_defs = 0;
-        if (option_space == DHCP6_OPTION_SPACE) {
-            range = idx.equal_range(opt_type);
-            num_defs = distance(range.first, range.second);
-        }
-
-        // Standard option definitions do not include the definition for
-        // our option or we're searching for non-standard option. Try to
-        // find the definition among runtime option definitions.
-        if (num_defs == 0) {
-            range = runtime_idx.equal_range(opt_type);
-            num_defs = distance(range.first, range.second);
-        }
+        const OptionDefinition* def = (table ? table->get(opt_type).get() :
+                                       getSingleOptionDef(runtime_option_defs,
+                                                          opt_type));
 
         OptionPtr opt;
-        if (num_defs > 1) {
-            // Multiple options of the same code are not supported right now!
-            isc_throw(isc::Unexpected, "Internal error: multiple option"
-                      " definitions for option type " << opt_type <<
-                      " returned. Currently it is not supported to initialize"
-                      " multiple option definitions for the same option code."
-                      " This will be supported once support for option spaces"
-                      " is implemented");
-        } else if (num_defs == 0) {
+        if (!def) {
             // @todo Don't crash if definition does not exist because
             // only a few option definitions are initialized right
             // now. In the future we will initialize definitions for
@@ -406,8 +468,6 @@ size_t LibDHCP::unpackOptions6(const OptionBuffer& buf,
         } else {
             // The option definition has been found. Use it to create
             // the option instance from the provided buffer chunk.
-            const OptionDefinitionPtr& def = *(range.first);
-            assert(def);
             opt = def->optionFactory(Option::V6, opt_type,
                                      buf.begin() + offset,
                                      buf.begin() + offset + opt_len);
@@ -427,16 +487,14 @@ size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
     size_t offset = 0;
     size_t last_offset = 0;
 
-    // Get the list of standard option definitions.
-    const OptionDefContainerPtr& option_defs = LibDHCP::getOptionDefs(option_space);
-    // Runtime option definitions for non standard option space and if
-    // the definition doesn't exist within the standard option definitions.
-    const OptionDefContainerPtr& runtime_option_defs = LibDHCP::getRuntimeOptionDefs(option_space);
-
-    // Get the search indexes #1. It allows to search for option definitions
-    // using option code.
-    const OptionDefContainerTypeIndex& idx = option_defs->get<1>();
-    const OptionDefContainerTypeIndex& runtime_idx = runtime_option_defs->get<1>();
+    // See unpackOptions6 for the explanation.
+    const OptionDefTable* table = NULL;
+    OptionDefContainerPtr runtime_option_defs;
+    if (option_space == DHCP4_OPTION_SPACE) {
+        table = &getOptionDefTable(Option::V4);
+    } else {
+        runtime_option_defs = LibDHCP::getRuntimeOptionDefs(option_space);
+    }
 
     // The buffer being read comprises a set of options, each starting with
     // a one-byte type code and a one-byte length field.
@@ -480,38 +538,12 @@ size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
             return (last_offset);
         }
 
-        // Get all definitions with the particular option code. Note
-        // that option code is non-unique within this container
-        // however at this point we expect to get one option
-        // definition with the particular code. If more are returned
-        // we report an error.
-        OptionDefContainerTypeRange range;
-        // Number of option definitions returned.
-        size_t num_defs = 0;
-        if (option_space == DHCP4_OPTION_SPACE) {
-            range = idx.equal_range(opt_type);
-            num_defs = distance(range.first, range.second);
-        }
-
-        // Standard option definitions do not include the definition for
-        // our option or we're searching for non-standard option. Try to
-        // find the definition among runtime option definitions.
-        if (num_defs == 0) {
-            range = runtime_idx.equal_range(opt_type);
-            num_defs = distance(range.first, range.second);
-        }
+        const OptionDefinition* def = (table ? table->get(opt_type).get() :
+                                       getSingleOptionDef(runtime_option_defs,
+                                                          opt_type));
 
         OptionPtr opt;
-        if (num_defs > 1) {
-            // Multiple options of the same code are not supported right now!
-            isc_throw(isc::Unexpected, "Internal error: multiple option"
-                      " definitions for option type " <<
-                      static_cast<int>(opt_type) <<
-                      " returned. Currently it is not supported to initialize"
-                      " multiple option definitions for the same option code."
-                      " This will be supported once support for option spaces"
-                      " is implemented");
-        } else if (num_defs == 0) {
+        if (!def) {
             opt = OptionPtr(new Option(Option::V4, opt_type,
                                        buf.begin() + offset,
                                        buf.begin() + offset + opt_len));
@@ -519,8 +551,6 @@ size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
         } else {
             // The option definition has been found. Use it to create
             // the option instance from the provided buffer chunk.
-            const OptionDefinitionPtr& def = *(range.first);
-            assert(def);
             opt = def->optionFactory(Option::V4, opt_type,
                                      buf.begin() + offset,
                                      buf.begin() + offset + opt_len);
@@ -533,22 +563,88 @@ size_t LibDHCP::unpackOptions4(const OptionBuffer& buf,
     return (last_offset);
 }
 
+size_t LibDHCP::scanOptions6(const OptionBuffer& buf, size_t offset,
+                             size_t end, Pkt::OptionLocations& locations) {
+    end = std::min(end, buf.size());
+    size_t last_offset = offset;
+
+    // The options are located with the same checks as in unpackOptions6
+    // so as the lazily parsed packet holds the same set of options.
+    while (offset < end) {
+        last_offset = offset;
+
+        if (offset + 4 > end) {
+            return (last_offset);
+        }
+
+        uint16_t opt_type = isc::util::readUint16(&buf[offset], 2);
+        offset += 2;
+
+        uint16_t opt_len = isc::util::readUint16(&buf[offset], 2);
+        offset += 2;
+
+        if (offset + opt_len > end) {
+            return (last_offset);
+        }
+
+        if ((opt_type == D6O_VENDOR_OPTS) && (offset + 4 > end)) {
+            return (last_offset);
+        }
+
+        locations.push_back(Pkt::OptionLocation(opt_type, last_offset,
+                                                opt_len + 4));
+        offset += opt_len;
+    }
+
+    return (offset);
+}
+
+size_t LibDHCP::scanOptions4(const OptionBuffer& buf, size_t offset,
+                             size_t end, Pkt::OptionLocations& locations) {
+    end = std::min(end, buf.size());
+    size_t last_offset = offset;
+
+    while (offset < end) {
+        last_offset = offset;
+
+        uint8_t opt_type = buf[offset++];
+
+        if (opt_type == DHO_END) {
+            return (last_offset);
+        }
+
+        if (opt_type == DHO_PAD) {
+            continue;
+        }
+
+        if (offset + 1 > end) {
+            return (last_offset);
+        }
+
+        uint8_t opt_len = buf[offset++];
+        if (offset + opt_len > end) {
+            return (last_offset);
+        }
+
+        locations.push_back(Pkt::OptionLocation(opt_type, last_offset,
+                                                opt_len + 2));
+        offset += opt_len;
+    }
+
+    return (offset);
+}
+
 size_t LibDHCP::unpackVendorOptions6(const uint32_t vendor_id,
                                      const OptionBuffer& buf,
                                      isc::dhcp::OptionCollection& options) {
     size_t offset = 0;
     size_t length = buf.size();
 
-    // Get the list of option definitions for this particular vendor-id
-    const OptionDefContainerPtr& option_defs = LibDHCP::getVendorOption6Defs(vendor_id);
-
-    // Get the search index #1. It allows to search for option definitions
-    // using option code. If there's no such vendor-id space, we're out of luck
-    // anyway.
-    const OptionDefContainerTypeIndex* idx = NULL;
-    if (option_defs) {
-        idx = &(option_defs->get<1>());
-    }
+    // Get the option definitions for this particular vendor-id indexed
+    // by option code. If there's no such vendor-id space, the table is
+    // empty and we're out of luck anyway.
+    const OptionDefTable& table = getVendorOptionDefTable(Option::V6,
+                                                          vendor_id);
 
     // The buffer being read comprises a set of options, each starting with
     // a two-byte type code and a two-byte length field.
@@ -574,36 +670,13 @@ size_t LibDHCP::unpackVendorOptions6(const uint32_t vendor_id,
         opt.reset();
 
         // If there is a definition for such a vendor option...
-        if (idx) {
-            // Get all definitions with the particular option
-            // code. Note that option code is non-unique within this
-            // container however at this point we expect to get one
-            // option definition with the particular code. If more are
-            // returned we report an error.
-            const OptionDefContainerTypeRange& range =
-                idx->equal_range(opt_type);
-            // Get the number of returned option definitions for the
-            // option code.
-            size_t num_defs = distance(range.first, range.second);
-
-            if (num_defs > 1) {
-                // Multiple options of the same code are not supported
-                // right now!
-                isc_throw(isc::Unexpected, "Internal error: multiple option"
-                          " definitions for option type " << opt_type <<
-                          " returned. Currently it is not supported to"
-                          " initialize multiple option definitions for the"
-                          " same option code. This will be supported once"
-                          " support for option spaces is implemented");
-            } else if (num_defs == 1) {
-                // The option definition has been found. Use it to create
-                // the option instance from the provided buffer chunk.
-                const OptionDefinitionPtr& def = *(range.first);
-                assert(def);
-                opt = def->optionFactory(Option::V6, opt_type,
-                                         buf.begin() + offset,
-                                         buf.begin() + offset + opt_len);
-            }
+        const OptionDefinitionPtr& def = table.get(opt_type);
+        if (def) {
+            // The option definition has been found. Use it to create
+            // the option instance from the provided buffer chunk.
+            opt = def->optionFactory(Option::V6, opt_type,
+                                     buf.begin() + offset,
+                                     buf.begin() + offset + opt_len);
         }
 
         // This can happen in one of 2 cases:
@@ -631,14 +704,10 @@ size_t LibDHCP::unpackVendorOptions4(const uint32_t vendor_id, const OptionBuffe
                                      isc::dhcp::OptionCollection& options) {
     size_t offset = 0;
 
-    // Get the list of stdandard option definitions.
-    const OptionDefContainerPtr& option_defs = LibDHCP::getVendorOption4Defs(vendor_id);
-    // Get the search index #1. It allows to search for option definitions
-    // using option code.
-    const OptionDefContainerTypeIndex* idx = NULL;
-    if (option_defs) {
-        idx = &(option_defs->get<1>());
-    }
+    // Get the option definitions for this particular vendor-id indexed
+    // by option code.
+    const OptionDefTable& table = getVendorOptionDefTable(Option::V4,
+                                                          vendor_id);
 
     // The buffer being read comprises a set of options, each starting with
     // a one-byte type code and a one-byte length field.
@@ -680,37 +749,13 @@ size_t LibDHCP::unpackVendorOptions4(const uint32_t vendor_id, const OptionBuffe
             OptionPtr opt;
             opt.reset();
 
-            if (idx) {
-                // Get all definitions with the particular option
-                // code. Note that option code is non-unique within
-                // this container however at this point we expect to
-                // get one option definition with the particular
-                // code. If more are returned we report an error.
-                const OptionDefContainerTypeRange& range =
-                    idx->equal_range(opt_type);
-                // Get the number of returned option definitions for
-                // the option code.
-                size_t num_defs = distance(range.first, range.second);
-
-                if (num_defs > 1) {
-                    // Multiple options of the same code are not
-                    // supported right now!
-                    isc_throw(isc::Unexpected, "Internal error: multiple"
-                              " option definitions for option type "
-                              << opt_type << " returned. Currently it is"
-                              " not supported to initialize multiple option"
-                              " definitions for the same option code."
-                              " This will be supported once support for"
-                              " option spaces is implemented");
-                } else if (num_defs == 1) {
-                    // The option definition has been found. Use it to create
-                    // the option instance from the provided buffer chunk.
-                    const OptionDefinitionPtr& def = *(range.first);
-                    assert(def);
-                    opt = def->optionFactory(Option::V4, opt_type,
-                                             buf.begin() + offset,
-                                             buf.begin() + offset + opt_len);
-                }
+            const OptionDefinitionPtr& def = table.get(opt_type);
+            if (def) {
+                // The option definition has been found. Use it to create
+                // the option instance from the provided buffer chunk.
+                opt = def->optionFactory(Option::V4, opt_type,
+                                         buf.begin() + offset,
+                                         buf.begin() + offset + opt_len);
             }
 
             if (!opt) {
@@ -832,6 +877,19 @@ LibDHCP::initStdOptionDefs6() {
                     V4V6_BIND_OPTION_DEFINITIONS_SIZE);
 }
 
+void
+LibDHCP::initOptionDefs() {
+    // If any of the containers is not initialized, it means that we haven't
+    // initialized option definitions at all.
+    if (v4option_defs_->empty()) {
+        initStdOptionDefs4();
+        initVendorOptsDocsis4();
+        initStdOptionDefs6();
+        initVendorOptsDocsis6();
+        initVendorOptsIsc6();
+    }
+}
+
 void
 LibDHCP::initVendorOptsDocsis4() {
     initOptionSpace(vendor4_defs_[VENDOR_ID_CABLE_LABS], DOCSIS3_V4_DEFS,
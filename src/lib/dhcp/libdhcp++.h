@@ -20,6 +20,9 @@
 namespace isc {
 namespace dhcp {
 
+/// @brief Tables of vendor option definitions indexed by vendor id.
+typedef std::map<uint32_t, OptionDefTable> VendorOptionDefTables;
+
 class LibDHCP {
 
 public:
@@ -218,6 +221,38 @@ public:
                                  const std::string& option_space,
                                  isc::dhcp::OptionCollection& options);
 
+    /// @brief Locates DHCPv6 options in the provided buffer.
+    ///
+    /// This function walks over the headers of the options in the
+    /// specified range of the buffer and records their locations. It
+    /// doesn't create Option objects. It is used by the packets to
+    /// parse the options lazily (see @ref Pkt::setLazyUnpack).
+    ///
+    /// The walk stops at the truncated option, like in
+    /// @ref unpackOptions6.
+    ///
+    /// @param buf Buffer holding options.
+    /// @param offset Offset of the first option within the buffer.
+    /// @param end Offset of the first byte after the options.
+    /// @param [out] locations Locations of the options are appended here.
+    /// @return offset to the first byte after the last located option.
+    static size_t scanOptions6(const OptionBuffer& buf, size_t offset,
+                               size_t end, Pkt::OptionLocations& locations);
+
+    /// @brief Locates DHCPv4 options in the provided buffer.
+    ///
+    /// This is the DHCPv4 variant of @ref scanOptions6. The walk stops
+    /// at the truncated option or at the DHO_END option.
+    ///
+    /// @param buf Buffer holding options.
+    /// @param offset Offset of the first option within the buffer.
+    /// @param end Offset of the first byte after the options.
+    /// @param [out] locations Locations of the options are appended here.
+    /// @return offset to the first byte after the last located option
+    /// or the offset of the DHO_END option type.
+    static size_t scanOptions4(const OptionBuffer& buf, size_t offset,
+                               size_t end, Pkt::OptionLocations& locations);
+
     /// Registers factory method that produces options of specific option types.
     ///
     /// @throw isc::BadValue if provided the type is already registered, has
@@ -340,6 +375,10 @@ private:
     /// is incorrect. This is a programming error.
     static void initStdOptionDefs6();
 
+    /// @brief Initializes the standard and vendor option definitions
+    /// unless they have been initialized already.
+    static void initOptionDefs();
+
     static void initVendorOptsDocsis4();
 
     static void initVendorOptsDocsis6();
@@ -347,6 +386,40 @@ private:
     /// Initialize private DHCPv6 option definitions.
     static void initVendorOptsIsc6();
 
+    /// @brief Returns the table of definitions used to parse the options
+    /// in the standard DHCPv4 or DHCPv6 option space.
+    ///
+    /// The table holds the standard option definitions and the runtime
+    /// option definitions for the remaining option codes. It is built
+    /// on the first use and rebuilt whenever the runtime option
+    /// definitions are modified.
+    ///
+    /// @param u Universe (V4 or V6).
+    ///
+    /// @return Reference to the table.
+    static const OptionDefTable& getOptionDefTable(const Option::Universe u);
+
+    /// @brief Rebuilds the tables of definitions of the options in the
+    /// standard DHCPv4 and DHCPv6 option spaces.
+    ///
+    /// The vendor option tables are built in the first call.
+    static void updateOptionDefTables();
+
+    /// @brief Returns the table of vendor option definitions.
+    ///
+    /// The tables for all vendors having option definitions are built
+    /// together with the tables of the standard option spaces and are
+    /// never modified afterwards. This method doesn't modify the tables
+    /// once they are built, so it may be called from multiple threads.
+    ///
+    /// @param u Universe (V4 or V6).
+    /// @param vendor_id Enterprise id of the vendor.
+    ///
+    /// @return Reference to the table. The table is empty if there are
+    /// no definitions for the vendor.
+    static const OptionDefTable&
+    getVendorOptionDefTable(const Option::Universe u, const uint32_t vendor_id);
+
     /// pointers to factories that produce DHCPv6 options
     static FactoryMap v4factories_;
 
@@ -370,6 +443,18 @@ private:
 
     /// Container for additional option definitions created in runtime.
     static util::StagedValue<OptionDefSpaceContainer> runtime_option_defs_;
+
+    /// Table with DHCPv4 option definitions indexed by option code.
+    static OptionDefTable v4option_def_table_;
+
+    /// Table with DHCPv6 option definitions indexed by option code.
+    static OptionDefTable v6option_def_table_;
+
+    /// Tables with v4 vendor option definitions.
+    static VendorOptionDefTables vendor4_def_tables_;
+
+    /// Tables with v6 vendor option definitions.
+    static VendorOptionDefTables vendor6_def_tables_;
 };
 
 }
@@ -8,6 +8,7 @@
 #define OPTION_H
 
 #include <util/buffer.h>
+#include <util/pool_allocator.h>
 
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
@@ -42,7 +43,12 @@ typedef std::multimap<unsigned int, OptionPtr> OptionCollection;
 /// A pointer to an OptionCollection
 typedef boost::shared_ptr<OptionCollection> OptionCollectionPtr;
 
-class Option {
+/// @brief Base class of the DHCPv4 and DHCPv6 options.
+///
+/// The options of all types are allocated from the free lists (see
+/// @ref isc::util::PoolAllocated), because many of them are created and
+/// destroyed for each processed packet.
+class Option : public util::PoolAllocated {
 public:
     /// length of the usual DHCPv4 option header (there are exceptions)
     const static size_t OPTION4_HDR_LEN = 2;
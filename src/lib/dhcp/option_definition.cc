@@ -799,5 +799,56 @@ OptionDefinition::factorySpecialFormatOption(Option::Universe u,
     return (OptionPtr());
 }
 
+OptionDefTable::OptionDefTable()
+    : defs_(), ambiguous_(), null_def_() {
+}
+
+void
+OptionDefTable::add(const OptionDefContainerPtr& defs) {
+    if (!defs) {
+        return;
+    }
+
+    const OptionDefContainerTypeIndex& idx = defs->get<1>();
+    for (OptionDefContainer::const_iterator def = defs->begin();
+         def != defs->end(); ++def) {
+        const uint16_t code = (*def)->getCode();
+        if (((code < defs_.size()) && defs_[code]) ||
+            (ambiguous_.count(code) > 0)) {
+            continue;
+        }
+
+        // Do not resolve the ambiguity by choosing one of the
+        // definitions. The parsing code reports it as an error.
+        if (idx.count(code) > 1) {
+            ambiguous_.insert(code);
+            continue;
+        }
+
+        if (code >= defs_.size()) {
+            defs_.resize(static_cast<size_t>(code) + 1);
+        }
+        defs_[code] = *def;
+    }
+}
+
+void
+OptionDefTable::clear() {
+    defs_.clear();
+    ambiguous_.clear();
+}
+
+void
+OptionDefTable::checkAmbiguous(const uint16_t code) const {
+    if (ambiguous_.count(code) > 0) {
+        isc_throw(isc::Unexpected, "Internal error: multiple option"
+                  " definitions for option type " << code <<
+                  " returned. Currently it is not supported to initialize"
+                  " multiple option definitions for the same option code."
+                  " This will be supported once support for option spaces"
+                  " is implemented");
+    }
+}
+
 } // end of isc::dhcp namespace
 } // end of isc namespace
@@ -17,7 +17,9 @@
 #include <boost/multi_index_container.hpp>
 #include <boost/shared_ptr.hpp>
 #include <map>
+#include <set>
 #include <string>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -748,6 +750,84 @@ typedef OptionSpaceContainer<
     OptionDefContainer, OptionDefinitionPtr, std::string
 > OptionDefSpaceContainer;
 
+/// @brief Option definitions indexed by option code.
+///
+/// The @c OptionDefContainer finds the definitions by option code using
+/// a hash index, which involves hashing the code and walking the range
+/// of matching definitions. This class holds the definitions in a flat
+/// array indexed by option code, so as finding the definition of the
+/// option being parsed is a single array access. The table is built
+/// once from the definitions of the option space and it is used when
+/// the options are parsed from the received packets.
+///
+/// The size of the table is determined by the highest option code for
+/// which there is a definition.
+class OptionDefTable {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates an empty table.
+    OptionDefTable();
+
+    /// @brief Adds definitions to the table.
+    ///
+    /// The definitions for the option codes which already have
+    /// definitions in the table are not added. This allows for adding
+    /// the standard definitions first and then the runtime definitions
+    /// for the remaining option codes.
+    ///
+    /// If the container holds multiple definitions for the same option
+    /// code, the option code is marked as ambiguous and the @c get
+    /// method throws when the definition for this code is requested.
+    ///
+    /// @param defs Container holding option definitions.
+    void add(const OptionDefContainerPtr& defs);
+
+    /// @brief Removes all definitions from the table.
+    void clear();
+
+    /// @brief Checks if the table holds no definitions.
+    bool empty() const {
+        return (defs_.empty());
+    }
+
+    /// @brief Returns the definition for the option code.
+    ///
+    /// @param code Option code.
+    ///
+    /// @return Reference to the pointer to the option definition. The
+    /// pointer is null if there is no definition for the option code.
+    /// @throw isc::Unexpected if there are multiple definitions for the
+    /// option code.
+    const OptionDefinitionPtr& get(const uint16_t code) const {
+        if ((code < defs_.size()) && defs_[code]) {
+            return (defs_[code]);
+        }
+        if (!ambiguous_.empty()) {
+            checkAmbiguous(code);
+        }
+        return (null_def_);
+    }
+
+private:
+
+    /// @brief Throws if there are multiple definitions for the option
+    /// code.
+    ///
+    /// @param code Option code.
+    void checkAmbiguous(const uint16_t code) const;
+
+    /// @brief Definitions indexed by option code.
+    std::vector<OptionDefinitionPtr> defs_;
+
+    /// @brief Option codes having multiple definitions.
+    std::set<uint16_t> ambiguous_;
+
+    /// @brief Null pointer returned for the codes without definitions.
+    OptionDefinitionPtr null_def_;
+};
+
 
 } // namespace isc::dhcp
 } // namespace isc
@@ -25,7 +25,8 @@ Pkt::Pkt(uint32_t transid, const isc::asiolink::IOAddress& local_addr,
      local_port_(local_port),
      remote_port_(remote_port),
      buffer_out_(0),
-     copy_retrieved_options_(false)
+     copy_retrieved_options_(false),
+     lazy_unpack_(false)
 {
 }
 
@@ -40,7 +41,8 @@ Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local
      local_port_(local_port),
      remote_port_(remote_port),
      buffer_out_(0),
-     copy_retrieved_options_(false)
+     copy_retrieved_options_(false),
+     lazy_unpack_(false)
 {
 
     if (len != 0) {
@@ -52,13 +54,34 @@ Pkt::Pkt(const uint8_t* buf, uint32_t len, const isc::asiolink::IOAddress& local
     }
 }
 
+Pkt::Pkt(OptionBuffer& buf, const isc::asiolink::IOAddress& local_addr,
+         const isc::asiolink::IOAddress& remote_addr, uint16_t local_port,
+         uint16_t remote_port)
+    :transid_(0),
+     iface_(""),
+     ifindex_(-1),
+     local_addr_(local_addr),
+     remote_addr_(remote_addr),
+     local_port_(local_port),
+     remote_port_(remote_port),
+     buffer_out_(0),
+     copy_retrieved_options_(false),
+     lazy_unpack_(false)
+{
+    data_.swap(buf);
+}
+
 void
 Pkt::addOption(const OptionPtr& opt) {
+    // Parse the received options of this type first, so as the order of
+    // the options in the packet is preserved.
+    unpackLazyOptions(opt->getType());
     options_.insert(std::pair<int, OptionPtr>(opt->getType(), opt));
 }
 
 OptionPtr
 Pkt::getNonCopiedOption(const uint16_t type) const {
+    unpackLazyOptions(type);
     OptionCollection::const_iterator x = options_.find(type);
     if (x != options_.end()) {
         return (x->second);
@@ -68,6 +91,7 @@ Pkt::getNonCopiedOption(const uint16_t type) const {
 
 OptionPtr
 Pkt::getOption(const uint16_t type) {
+    unpackLazyOptions(type);
     OptionCollection::iterator x = options_.find(type);
     if (x != options_.end()) {
         if (copy_retrieved_options_) {
@@ -81,6 +105,7 @@ Pkt::getOption(const uint16_t type) {
 
 bool
 Pkt::delOption(uint16_t type) {
+    unpackLazyOptions(type);
 
     isc::dhcp::OptionCollection::iterator x = options_.find(type);
     if (x!=options_.end()) {
@@ -91,6 +116,51 @@ Pkt::delOption(uint16_t type) {
     }
 }
 
+void
+Pkt::unpackLazyOptions() const {
+    while (!lazy_options_.empty()) {
+        unpackLazyOptions(lazy_options_.front().type_);
+    }
+}
+
+bool
+Pkt::unpackLazyOptionsNoThrow() const {
+    bool well_formed = true;
+    // Iterate over a copy because the parsed locations are removed.
+    const OptionLocations pending = lazy_options_;
+    for (OptionLocations::const_iterator location = pending.begin();
+         location != pending.end(); ++location) {
+        try {
+            unpackLazyOptions(location->type_);
+        } catch (const MalformedOption&) {
+            well_formed = false;
+        }
+    }
+    return (well_formed);
+}
+
+void
+Pkt::unpackLazyOptions(const uint16_t type) const {
+    OptionLocations::iterator location = lazy_options_.begin();
+    while (location != lazy_options_.end()) {
+        if (location->type_ == type) {
+            // The location is removed only when the option has been
+            // parsed, so as the malformed option is reported on every
+            // attempt to retrieve it rather than treated as absent.
+            try {
+                unpackLazyOption(*location);
+            } catch (const std::exception& ex) {
+                isc_throw(MalformedOption, "failed to parse option "
+                          << type << ": " << ex.what());
+            }
+            location = lazy_options_.erase(location);
+
+        } else {
+            ++location;
+        }
+    }
+}
+
 bool
 Pkt::inClass(const std::string& client_class) {
     return (classes_.find(client_class) != classes_.end());
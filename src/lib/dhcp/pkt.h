@@ -8,6 +8,7 @@
 #define PKT_H
 
 #include <asiolink/io_address.h>
+#include <exceptions/exceptions.h>
 #include <util/buffer.h>
 #include <dhcp/option.h>
 #include <dhcp/hwaddr.h>
@@ -17,11 +18,20 @@
 #include <boost/shared_ptr.hpp>
 
 #include <utility>
+#include <vector>
 
 namespace isc {
 
 namespace dhcp {
 
+/// @brief Exception thrown when the option parsed in the lazy unpack
+/// mode is malformed.
+class MalformedOption : public Exception {
+public:
+    MalformedOption(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) { };
+};
+
 /// @brief RAII object enabling copying options retrieved from the
 /// packet.
 ///
@@ -34,6 +44,10 @@ namespace dhcp {
 /// explicitly re-disabling options copying and is safer in case of
 /// exceptions thrown by callouts and a presence of multiple exit points.
 ///
+/// Hook libraries may access the options of the packet directly, so the
+/// options not yet parsed in the lazy unpack mode are parsed when this
+/// object is created (see @ref Pkt::setLazyUnpack).
+///
 /// @tparam PktType Type of the packet, e.g. Pkt4, Pkt6, Pkt4o6.
 template<typename PktType>
 class ScopedEnableOptionsCopy {
@@ -44,7 +58,8 @@ public:
 
     /// @brief Constructor.
     ///
-    /// Enables options copying on a packet(s).
+    /// Enables options copying on a packet(s) and parses the options
+    /// which haven't been parsed yet.
     ///
     /// @param pkt1 Pointer to first packet.
     /// @param pkt2 Optional pointer to the second packet.
@@ -52,9 +67,11 @@ public:
                             const PktTypePtr& pkt2 = PktTypePtr())
         : pkts_(pkt1, pkt2) {
         if (pkt1) {
+            pkt1->unpackLazyOptions();
             pkt1->setCopyRetrievedOptions(true);
         }
         if (pkt2) {
+            pkt2->unpackLazyOptions();
             pkt2->setCopyRetrievedOptions(true);
         }
     }
@@ -123,8 +140,56 @@ protected:
         const isc::asiolink::IOAddress& remote_addr, uint16_t local_port,
         uint16_t remote_port);
 
+    /// @brief Constructor.
+    ///
+    /// This constructor is used for received messages. It takes over the
+    /// buffer holding the on-wire data instead of copying it, so as the
+    /// data received from the socket are not copied. The buffer passed
+    /// by the caller is left empty.
+    ///
+    /// @param buf buffer holding on-wire data, swapped with @c data_
+    /// @param local_addr local IPv4 or IPv6 address
+    /// @param remote_addr remote IPv4 or IPv6 address
+    /// @param local_port local UDP (one day also TCP) port
+    /// @param remote_port remote UDP (one day also TCP) port
+    Pkt(OptionBuffer& buf,
+        const isc::asiolink::IOAddress& local_addr,
+        const isc::asiolink::IOAddress& remote_addr, uint16_t local_port,
+        uint16_t remote_port);
+
 public:
 
+    /// @brief Location of the received option which hasn't been parsed.
+    ///
+    /// In the lazy unpack mode the received options are not parsed when
+    /// the packet is unpacked. Instead, their locations within the @c data_
+    /// buffer are recorded and the options are parsed when they are
+    /// retrieved from the packet.
+    struct OptionLocation {
+
+        /// @brief Constructor.
+        ///
+        /// @param type Option type.
+        /// @param offset Offset of the option header within the buffer.
+        /// @param len Length of the option, including the header.
+        OptionLocation(const uint16_t type, const size_t offset,
+                       const size_t len)
+            : type_(type), offset_(offset), len_(len) {
+        }
+
+        /// @brief Option type.
+        uint16_t type_;
+
+        /// @brief Offset of the option header within the buffer.
+        size_t offset_;
+
+        /// @brief Length of the option, including the header.
+        size_t len_;
+    };
+
+    /// @brief Collection of the option locations.
+    typedef std::vector<OptionLocation> OptionLocations;
+
     /// @brief Prepares on-wire format of DHCP (either v4 or v6) packet.
     ///
     /// Prepares on-wire format of message and all its options.
@@ -318,6 +383,22 @@ protected:
     /// if such option is not present.
     OptionPtr getNonCopiedOption(const uint16_t type) const;
 
+    /// @brief Parses all options which haven't been parsed yet, skipping
+    /// the malformed options.
+    ///
+    /// This is used by the methods which must not throw, e.g. @c toText.
+    /// The malformed options are left unparsed.
+    ///
+    /// @return false if any of the options is malformed, true otherwise.
+    bool unpackLazyOptionsNoThrow() const;
+
+    /// @brief Parses the option at the specified location.
+    ///
+    /// The parsed option is stored in the @c options_ container.
+    ///
+    /// @param location Location of the option within the @c data_.
+    virtual void unpackLazyOption(const OptionLocation& location) const = 0;
+
 public:
 
     /// @brief Returns the first option of specified type.
@@ -370,6 +451,59 @@ public:
         return (copy_retrieved_options_);
     }
 
+    /// @brief Controls whether the options are parsed lazily.
+    ///
+    /// In the lazy unpack mode, the @c unpack method only records the
+    /// locations of the options within the received data. An option is
+    /// parsed when it is first retrieved with @ref getOption or another
+    /// method returning options of the given type. The options which are
+    /// never retrieved are never parsed, which saves the allocations of
+    /// the option instances the server doesn't use.
+    ///
+    /// The errors in the option contents are reported by the methods
+    /// retrieving the option rather than by @c unpack. They throw
+    /// @ref MalformedOption. The option which failed to parse is kept
+    /// unparsed, so each subsequent retrieval of this option throws
+    /// again rather than reporting the option as absent.
+    ///
+    /// The code which accesses the @c options_ member directly must call
+    /// @ref unpackLazyOptions first.
+    ///
+    /// @param lazy Indicates if the options should be parsed lazily.
+    /// This setting takes effect in the next call to @c unpack.
+    void setLazyUnpack(const bool lazy) {
+        lazy_unpack_ = lazy;
+    }
+
+    /// @brief Returns whether the lazy unpack mode is enabled.
+    ///
+    /// Also see @ref setLazyUnpack.
+    ///
+    /// @return true if the options are parsed lazily.
+    bool isLazyUnpack() const {
+        return (lazy_unpack_);
+    }
+
+    /// @brief Parses all options which haven't been parsed yet.
+    ///
+    /// This method does nothing if the lazy unpack mode is disabled or
+    /// all options have already been parsed.
+    ///
+    /// @throw MalformedOption if any of the options is malformed.
+    void unpackLazyOptions() const;
+
+    /// @brief Parses options of the specified type which haven't been
+    /// parsed yet.
+    ///
+    /// This method is called by the methods retrieving the options from
+    /// the packet in the lazy unpack mode. The server also calls it to
+    /// validate the options it uses for every packet right after the
+    /// packet is unpacked.
+    ///
+    /// @param type Option type.
+    /// @throw MalformedOption if any of the options is malformed.
+    void unpackLazyOptions(const uint16_t type) const;
+
     /// @brief Update packet timestamp.
     ///
     /// Updates packet timestamp. This method is invoked
@@ -575,7 +709,10 @@ public:
     /// behavior must be taken into consideration before making
     /// changes to this member such as access scope restriction or
     /// data format change etc.
-    isc::dhcp::OptionCollection options_;
+    ///
+    /// In the lazy unpack mode, this container holds only the options
+    /// which have been parsed so far (see @ref setLazyUnpack).
+    mutable isc::dhcp::OptionCollection options_;
 
 protected:
 
@@ -733,6 +870,15 @@ protected:
     /// @see the documentation for @ref Pkt::setCopyRetrievedOptions.
     bool copy_retrieved_options_;
 
+    /// @brief Indicates if the options are parsed lazily.
+    ///
+    /// @see the documentation for @ref Pkt::setLazyUnpack.
+    bool lazy_unpack_;
+
+    /// @brief Locations of the received options which haven't been
+    /// parsed yet.
+    mutable OptionLocations lazy_options_;
+
     /// packet timestamp
     boost::posix_time::ptime timestamp_;
 
@@ -71,10 +71,35 @@ Pkt4::Pkt4(const uint8_t* data, size_t len)
     memset(file_, 0, MAX_FILE_LEN);
 }
 
+Pkt4::Pkt4(OptionBuffer& data)
+     :Pkt(data, DEFAULT_ADDRESS, DEFAULT_ADDRESS, DHCP4_SERVER_PORT,
+          DHCP4_CLIENT_PORT),
+      op_(BOOTREQUEST),
+      hwaddr_(new HWAddr()),
+      hops_(0),
+      secs_(0),
+      flags_(0),
+      ciaddr_(DEFAULT_ADDRESS),
+      yiaddr_(DEFAULT_ADDRESS),
+      siaddr_(DEFAULT_ADDRESS),
+      giaddr_(DEFAULT_ADDRESS)
+{
+
+    if (data_.size() < DHCPV4_PKT_HDR_LEN) {
+        isc_throw(OutOfRange, "Truncated DHCPv4 packet (len=" << data_.size()
+                  << ") received, at least " << DHCPV4_PKT_HDR_LEN
+                  << " is expected.");
+    }
+    memset(sname_, 0, MAX_SNAME_LEN);
+    memset(file_, 0, MAX_FILE_LEN);
+}
+
 size_t
 Pkt4::len() {
     size_t length = DHCPV4_PKT_HDR_LEN; // DHCPv4 header
 
+    unpackLazyOptions();
+
     // ... and sum of lengths of all options
     for (OptionCollection::const_iterator it = options_.begin();
          it != options_.end();
@@ -135,6 +160,7 @@ Pkt4::pack() {
         // write DHCP magic cookie
         buffer_out_.writeUint32(DHCP_OPTIONS_COOKIE);
 
+        unpackLazyOptions();
         LibDHCP::packOptions4(buffer_out_, options_);
 
         // add END option that indicates end of options
@@ -149,6 +175,9 @@ Pkt4::pack() {
 void
 Pkt4::unpack() {
 
+    // Forget the options recorded in the previous call in the lazy mode.
+    lazy_options_.clear();
+
     // input buffer (used during message reception)
     isc::util::InputBuffer buffer_in(&data_[0], data_.size());
 
@@ -196,6 +225,14 @@ Pkt4::unpack() {
       isc_throw(Unexpected, "Invalid or missing DHCP magic cookie");
     }
 
+    // In the lazy mode only record where the options are. They will be
+    // parsed when retrieved from the packet.
+    if (lazy_unpack_) {
+        LibDHCP::scanOptions4(data_, buffer_in.getPosition(), data_.size(),
+                              lazy_options_);
+        return;
+    }
+
     size_t opts_len = buffer_in.getLength() - buffer_in.getPosition();
     vector<uint8_t> opts_buffer;
 
@@ -227,6 +264,13 @@ Pkt4::unpack() {
     // so we'll be able to log more detailed drop reason.
 }
 
+void
+Pkt4::unpackLazyOption(const OptionLocation& location) const {
+    OptionBuffer opt_buffer(data_.begin() + location.offset_,
+                            data_.begin() + location.offset_ + location.len_);
+    LibDHCP::unpackOptions4(opt_buffer, DHCP4_OPTION_SPACE, options_);
+}
+
 uint8_t Pkt4::getType() const {
     OptionPtr generic = getNonCopiedOption(DHO_DHCP_MESSAGE_TYPE);
     if (!generic) {
@@ -332,7 +376,13 @@ Pkt4::getLabel() const {
     /// use the instance member rather than fetch it every time.
     std::string suffix;
     ClientIdPtr client_id;
-    OptionPtr client_opt = getNonCopiedOption(DHO_DHCP_CLIENT_IDENTIFIER);
+    OptionPtr client_opt;
+    try {
+        client_opt = getNonCopiedOption(DHO_DHCP_CLIENT_IDENTIFIER);
+    } catch (const MalformedOption&) {
+        // The option failed to parse in the lazy unpack mode.
+        suffix = " (malformed client-id)";
+    }
     if (client_opt) {
         try {
             client_id = ClientIdPtr(new ClientId(client_opt->getData()));
@@ -397,6 +447,9 @@ Pkt4::toText() const {
 
     output << ", transid=0x" << hex << transid_ << dec;
 
+    // The packet may carry malformed options in the lazy unpack mode.
+    // These are not shown.
+    const bool malformed = !unpackLazyOptionsNoThrow();
     if (!options_.empty()) {
         output << "," << std::endl << "options:";
         for (isc::dhcp::OptionCollection::const_iterator opt = options_.begin();
@@ -412,6 +465,10 @@ Pkt4::toText() const {
         output << ", message contains no options";
     }
 
+    if (malformed) {
+        output << "," << std::endl << "message contains malformed options";
+    }
+
     return (output.str());
 }
 
@@ -68,6 +68,16 @@ public:
     /// @param len size of buffer to be allocated for this packet.
     Pkt4(const uint8_t* data, size_t len);
 
+    /// @brief Constructor, used in message reception.
+    ///
+    /// Creates new message from the received data without copying them.
+    /// The contents of the buffer are moved to the packet and the buffer
+    /// passed by the caller is left empty.
+    ///
+    /// @param data buffer holding the received data
+    /// @throw OutOfRange if the buffer is shorter than the DHCPv4 header.
+    explicit Pkt4(OptionBuffer& data);
+
     /// @brief Prepares on-wire format of DHCPv4 packet.
     ///
     /// Prepares on-wire format of message and all its options.
@@ -83,7 +93,9 @@ public:
     /// Parses received packet, stored in on-wire format in bufferIn_.
     ///
     /// Will create a collection of option objects that will
-    /// be stored in options_ container.
+    /// be stored in options_ container. In the lazy unpack mode, the
+    /// options are only located and they are parsed when retrieved (see
+    /// @ref Pkt::setLazyUnpack).
     ///
     /// Method with throw exception if packet parsing fails.
     virtual void unpack();
@@ -402,6 +414,11 @@ private:
 
 protected:
 
+    /// @brief Parses the DHCPv4 option at the specified location.
+    ///
+    /// @param location Location of the option within the @c data_.
+    virtual void unpackLazyOption(const OptionLocation& location) const;
+
     /// converts DHCP message type to BOOTP op type
     ///
     /// @param dhcpType DHCP message type (e.g. DHCPDISCOVER)
@@ -55,6 +55,11 @@ Pkt6::Pkt6(const uint8_t* buf, uint32_t buf_len, DHCPv6Proto proto /* = UDP */)
     proto_(proto), msg_type_(0) {
 }
 
+Pkt6::Pkt6(OptionBuffer& buf, DHCPv6Proto proto /* = UDP */)
+   :Pkt(buf, DEFAULT_ADDRESS6, DEFAULT_ADDRESS6, 0, 0),
+    proto_(proto), msg_type_(0) {
+}
+
 Pkt6::Pkt6(uint8_t msg_type, uint32_t transid, DHCPv6Proto proto /*= UDP*/)
 :Pkt(transid, DEFAULT_ADDRESS6, DEFAULT_ADDRESS6, 0, 0), proto_(proto),
     msg_type_(msg_type) {
@@ -254,6 +259,8 @@ uint16_t Pkt6::calculateRelaySizes() {
 uint16_t Pkt6::directLen() const {
     uint16_t length = DHCPV6_PKT_HDR_LEN; // DHCPv6 header
 
+    unpackLazyOptions();
+
     for (OptionCollection::const_iterator it = options_.begin();
          it != options_.end();
          ++it) {
@@ -335,6 +342,7 @@ Pkt6::packUDP() {
         buffer_out_.writeUint8( (transid_) & 0xff );
 
         // the rest are options
+        unpackLazyOptions();
         LibDHCP::packOptions6(buffer_out_, options_);
     }
     catch (const Exception& e) {
@@ -352,6 +360,9 @@ Pkt6::packTCP() {
 
 void
 Pkt6::unpack() {
+    // Forget the options recorded in the previous call in the lazy mode.
+    lazy_options_.clear();
+
     switch (proto_) {
     case UDP:
         return unpackUDP();
@@ -413,6 +424,18 @@ Pkt6::unpackMsg(OptionBuffer::const_iterator begin,
     // perhaps for stats gathering we can uncomment this.
     //    size -= sizeof(uint32_t); // We just parsed 4 bytes header
 
+    // In the lazy mode only record where the options are. They will be
+    // parsed when retrieved from the packet. The message may be
+    // encapsulated in the relay-msg option, so the offsets are computed
+    // relative to the beginning of the whole packet.
+    if (lazy_unpack_) {
+        const OptionBuffer& data = data_;
+        LibDHCP::scanOptions6(data_, std::distance(data.begin(), begin),
+                              std::distance(data.begin(), end),
+                              lazy_options_);
+        return;
+    }
+
     OptionBuffer opt_buffer(begin, end);
 
     // If custom option parsing function has been set, use this function
@@ -436,6 +459,13 @@ Pkt6::unpackMsg(OptionBuffer::const_iterator begin,
     (void)offset;
 }
 
+void
+Pkt6::unpackLazyOption(const OptionLocation& location) const {
+    OptionBuffer opt_buffer(data_.begin() + location.offset_,
+                            data_.begin() + location.offset_ + location.len_);
+    LibDHCP::unpackOptions6(opt_buffer, DHCP6_OPTION_SPACE, options_);
+}
+
 void
 Pkt6::unpackRelayMsg() {
 
@@ -628,12 +658,17 @@ Pkt6::toText() const {
         << "), transid=0x" <<
         hex << transid_ << dec << endl;
 
-    // Then print the options
+    // Then print the options. The malformed options which failed to
+    // parse in the lazy unpack mode are not shown.
+    const bool malformed = !unpackLazyOptionsNoThrow();
     for (isc::dhcp::OptionCollection::const_iterator opt=options_.begin();
          opt != options_.end();
          ++opt) {
         tmp << opt->second->toText() << std::endl;
     }
+    if (malformed) {
+        tmp << "Malformed options not shown." << endl;
+    }
 
     // Finally, print the relay information (if present)
     if (!relay_info_.empty()) {
@@ -667,6 +702,7 @@ Pkt6::getClientId() const {
 
 isc::dhcp::OptionCollection
 Pkt6::getNonCopiedOptions(const uint16_t opt_type) const {
+    unpackLazyOptions(opt_type);
     std::pair<OptionCollection::const_iterator,
               OptionCollection::const_iterator> range = options_.equal_range(opt_type);
     return (OptionCollection(range.first, range.second));
@@ -674,6 +710,8 @@ Pkt6::getNonCopiedOptions(const uint16_t opt_type) const {
 
 isc::dhcp::OptionCollection
 Pkt6::getOptions(const uint16_t opt_type) {
+    unpackLazyOptions(opt_type);
+
     OptionCollection options_copy;
 
     std::pair<OptionCollection::iterator,
@@ -122,6 +122,16 @@ public:
     /// @param proto protocol (usually UDP, but TCP will be supported eventually)
     Pkt6(const uint8_t* buf, uint32_t len, DHCPv6Proto proto = UDP);
 
+    /// @brief Constructor, used in message reception.
+    ///
+    /// Creates new message from the received data without copying them.
+    /// The contents of the buffer are moved to the packet and the buffer
+    /// passed by the caller is left empty.
+    ///
+    /// @param buf buffer holding the received packet content
+    /// @param proto protocol (usually UDP, but TCP will be supported eventually)
+    explicit Pkt6(OptionBuffer& buf, DHCPv6Proto proto = UDP);
+
     /// @brief Prepares on-wire format.
     ///
     /// Prepares on-wire format of message and all its options.
@@ -138,7 +148,9 @@ public:
     /// @brief Dispatch method that handles binary packet parsing.
     ///
     /// This method calls appropriate dispatch function (unpackUDP or
-    /// unpackTCP).
+    /// unpackTCP). In the lazy unpack mode, the options of the client's
+    /// message are only located and they are parsed when retrieved (see
+    /// @ref Pkt::setLazyUnpack).
     ///
     /// @throw tbd
     virtual void unpack();
@@ -368,6 +380,14 @@ protected:
     /// @return Collection of options found.
     OptionCollection getNonCopiedOptions(const uint16_t opt_type) const;
 
+    /// @brief Parses the DHCPv6 option at the specified location.
+    ///
+    /// Only the options of the client's message are parsed lazily. The
+    /// options inserted by the relays are always parsed by @c unpack.
+    ///
+    /// @param location Location of the option within the @c data_.
+    virtual void unpackLazyOption(const OptionLocation& location) const;
+
 public:
 
     /// @brief Returns all instances of specified type.
@@ -11,6 +11,9 @@
 #include <dhcp/pkt_filter_bpf.h>
 #include <dhcp/protocol_util.h>
 #include <exceptions/exceptions.h>
+#include <util/pool_allocator.h>
+#include <boost/make_shared.hpp>
+#include <boost/ref.hpp>
 #include <algorithm>
 #include <net/bpf.h>
 #include <netinet/if_ether.h>
@@ -519,12 +522,15 @@ PktFilterBPF::receive(Iface& iface, const SocketInfo& socket_info) {
     // Decode IP/UDP headers.
     decodeIpUdpHeader(buf, dummy_pkt);
 
-    // Read the DHCP data.
-    std::vector<uint8_t> dhcp_buf;
-    buf.readVector(dhcp_buf, buf.getLength() - buf.getPosition());
+    // Copy the DHCP data. The read buffer may hold multiple frames, so
+    // this is the only copy made, and the packet takes it over.
+    const uint8_t* frame = iface.getReadBuffer() + offset + bpfh.bh_hdrlen;
+    OptionBuffer dhcp_buf(frame + buf.getPosition(),
+                          frame + buf.getLength());
 
     // Decode DHCP data into the Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(&dhcp_buf[0], dhcp_buf.size()));
+    Pkt4Ptr pkt = boost::allocate_shared<Pkt4>(PoolAllocator<Pkt4>(),
+                                               boost::ref(dhcp_buf));
 
     // Set the appropriate packet members using data collected from
     // the decoded headers.
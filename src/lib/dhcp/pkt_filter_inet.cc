@@ -8,6 +8,9 @@
 #include <dhcp/iface_mgr.h>
 #include <dhcp/pkt4.h>
 #include <dhcp/pkt_filter_inet.h>
+#include <util/pool_allocator.h>
+#include <boost/make_shared.hpp>
+#include <boost/ref.hpp>
 #include <errno.h>
 #include <cstring>
 #include <fcntl.h>
@@ -110,7 +113,9 @@ PktFilterInet::openSocket(Iface& iface,
 Pkt4Ptr
 PktFilterInet::receive(Iface& iface, const SocketInfo& socket_info) {
     struct sockaddr_in from_addr;
-    uint8_t buf[IfaceMgr::RCVBUFSIZE];
+    // The data are received directly into the buffer which is then
+    // handed over to the packet.
+    OptionBuffer buf(IfaceMgr::RCVBUFSIZE);
 
     memset(&control_buf_[0], 0, control_buf_len_);
     memset(&from_addr, 0, sizeof(from_addr));
@@ -124,8 +129,8 @@ PktFilterInet::receive(Iface& iface, const SocketInfo& socket_info) {
     m.msg_namelen = sizeof(from_addr);
 
     struct iovec v;
-    v.iov_base = static_cast<void*>(buf);
-    v.iov_len = IfaceMgr::RCVBUFSIZE;
+    v.iov_base = static_cast<void*>(&buf[0]);
+    v.iov_len = buf.size();
     m.msg_iov = &v;
     m.msg_iovlen = 1;
 
@@ -143,8 +148,11 @@ PktFilterInet::receive(Iface& iface, const SocketInfo& socket_info) {
         isc_throw(SocketReadError, "failed to receive UDP4 data");
     }
 
-    // We have all data let's create Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(buf, result));
+    // We have all data let's create Pkt4 object. Shrinking the buffer
+    // doesn't reallocate it.
+    buf.resize(result);
+    Pkt4Ptr pkt = boost::allocate_shared<Pkt4>(util::PoolAllocator<Pkt4>(),
+                                               boost::ref(buf));
 
     pkt->updateTimestamp();
 
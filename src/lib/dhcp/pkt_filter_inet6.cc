@@ -10,6 +10,9 @@
 #include <dhcp/pkt6.h>
 #include <dhcp/pkt_filter_inet6.h>
 #include <util/io/pktinfo_utilities.h>
+#include <util/pool_allocator.h>
+#include <boost/make_shared.hpp>
+#include <boost/ref.hpp>
 
 #include <fcntl.h>
 #include <netinet/in.h>
@@ -129,8 +132,10 @@ PktFilterInet6::openSocket(const Iface& iface,
 
 Pkt6Ptr
 PktFilterInet6::receive(const SocketInfo& socket_info) {
-    // Now we have a socket, let's get some data from it!
-    uint8_t buf[IfaceMgr::RCVBUFSIZE];
+    // Now we have a socket, let's get some data from it! The data are
+    // received directly into the buffer which is then handed over to
+    // the packet.
+    OptionBuffer buf(IfaceMgr::RCVBUFSIZE);
     memset(&control_buf_[0], 0, control_buf_len_);
     struct sockaddr_in6 from;
     memset(&from, 0, sizeof(from));
@@ -148,8 +153,8 @@ PktFilterInet6::receive(const SocketInfo& socket_info) {
     // sense for us, so we use a single vector entry.)
     struct iovec v;
     memset(&v, 0, sizeof(v));
-    v.iov_base = static_cast<void*>(buf);
-    v.iov_len = IfaceMgr::RCVBUFSIZE;
+    v.iov_base = static_cast<void*>(&buf[0]);
+    v.iov_len = buf.size();
     m.msg_iov = &v;
     m.msg_iovlen = 1;
 
@@ -212,7 +217,9 @@ PktFilterInet6::receive(const SocketInfo& socket_info) {
     // Let's create a packet.
     Pkt6Ptr pkt;
     try {
-        pkt = Pkt6Ptr(new Pkt6(buf, result));
+        buf.resize(result);
+        pkt = boost::allocate_shared<Pkt6>(util::PoolAllocator<Pkt6>(),
+                                           boost::ref(buf));
     } catch (const std::exception& ex) {
         isc_throw(SocketReadError, "failed to create new packet");
     }
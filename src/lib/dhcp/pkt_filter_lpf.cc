@@ -11,6 +11,9 @@
 #include <dhcp/pkt_filter_lpf.h>
 #include <dhcp/protocol_util.h>
 #include <exceptions/exceptions.h>
+#include <util/pool_allocator.h>
+#include <boost/make_shared.hpp>
+#include <boost/ref.hpp>
 #include <fcntl.h>
 #include <linux/filter.h>
 #include <linux/if_ether.h>
@@ -203,7 +206,9 @@ PktFilterLPF::openSocket(Iface& iface,
 
 Pkt4Ptr
 PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
-    uint8_t raw_buf[IfaceMgr::RCVBUFSIZE];
+    // The frame is received directly into the buffer which is then handed
+    // over to the packet.
+    OptionBuffer raw_buf(IfaceMgr::RCVBUFSIZE);
     // First let's get some data from the fallback socket. The data will be
     // discarded but we don't want the socket buffer to bloat. We get the
     // packets from the socket in loop but most of the time the loop will
@@ -220,12 +225,13 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
     // when the DHCP server is idle.
     int datalen;
     do {
-        datalen = recv(socket_info.fallbackfd_, raw_buf, sizeof(raw_buf), 0);
+        datalen = recv(socket_info.fallbackfd_, &raw_buf[0], raw_buf.size(),
+                       0);
     } while (datalen > 0);
 
     // Now that we finished getting data from the fallback socket, we
     // have to get the data from the raw socket too.
-    int data_len = read(socket_info.sockfd_, raw_buf, sizeof(raw_buf));
+    int data_len = read(socket_info.sockfd_, &raw_buf[0], raw_buf.size());
     // If negative value is returned by read(), it indicates that an
     // error occurred. If returned value is 0, no data was read from the
     // socket. In both cases something has gone wrong, because we expect
@@ -235,7 +241,7 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
         return Pkt4Ptr();
     }
 
-    InputBuffer buf(raw_buf, data_len);
+    InputBuffer buf(&raw_buf[0], data_len);
 
     // @todo: This is awkward way to solve the chicken and egg problem
     // whereby we don't know the offset where DHCP data start in the
@@ -255,12 +261,14 @@ PktFilterLPF::receive(Iface& iface, const SocketInfo& socket_info) {
     decodeEthernetHeader(buf, dummy_pkt);
     decodeIpUdpHeader(buf, dummy_pkt);
 
-    // Read the DHCP data.
-    std::vector<uint8_t> dhcp_buf;
-    buf.readVector(dhcp_buf, buf.getLength() - buf.getPosition());
+    // Strip the headers, so as the buffer holds the DHCP data only. The
+    // data are moved within the buffer, which is not reallocated.
+    raw_buf.resize(data_len);
+    raw_buf.erase(raw_buf.begin(), raw_buf.begin() + buf.getPosition());
 
     // Decode DHCP data into the Pkt4 object.
-    Pkt4Ptr pkt = Pkt4Ptr(new Pkt4(&dhcp_buf[0], dhcp_buf.size()));
+    Pkt4Ptr pkt = boost::allocate_shared<Pkt4>(PoolAllocator<Pkt4>(),
+                                               boost::ref(raw_buf));
 
     // Set the appropriate packet members using data collected from
     // the decoded headers.
@@ -10,6 +10,7 @@
 #include <dhcp/duid.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/functional/hash.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 
@@ -198,6 +199,23 @@ TEST(DuidTest, operators) {
     EXPECT_TRUE(*duid1 != *duid3);
 }
 
+// This test verifies that the equal DUIDs and client identifiers have
+// equal hash values.
+TEST(DuidTest, hash) {
+    DUID duid1 = DUID::fromText("00:01:02:03:04:05:06");
+    DUID duid2 = DUID::fromText("00:01:02:03:04:05:06");
+    DUID duid3 = DUID::fromText("00:01:02:03:04:05:07");
+
+    boost::hash<DUID> hasher;
+    EXPECT_EQ(hasher(duid1), hasher(duid2));
+    EXPECT_NE(hasher(duid1), hasher(duid3));
+
+    ClientIdPtr client_id1 = ClientId::fromText("00:01:02:03:04:05:06");
+    ClientIdPtr client_id2 = ClientId::fromText("00:01:02:03:04:05:06");
+    boost::hash<ClientId> client_id_hasher;
+    EXPECT_EQ(client_id_hasher(*client_id1), client_id_hasher(*client_id2));
+}
+
 // This test verifies if the ClientId constructors are working properly
 // and passed parameters are used
 TEST(ClientIdTest, constructor) {
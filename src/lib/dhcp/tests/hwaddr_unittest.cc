@@ -11,6 +11,7 @@
 #include <dhcp/dhcp4.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/functional/hash.hpp>
 #include <boost/scoped_ptr.hpp>
 #include <gtest/gtest.h>
 
@@ -167,4 +168,17 @@ TEST(HWAddrTest, 16bits) {
 
 }
 
+// Checks that the equal hardware addresses have equal hash values.
+TEST(HWAddrTest, hash) {
+    boost::hash<HWAddr> hasher;
+    HWAddr hw1 = HWAddr::fromText("00:01:02:03:04:05");
+    HWAddr hw2 = HWAddr::fromText("00:01:02:03:04:05");
+    HWAddr hw3 = HWAddr::fromText("00:01:02:03:04:06");
+    HWAddr hw4 = HWAddr::fromText("00:01:02:03:04:05", 257);
+
+    EXPECT_EQ(hasher(hw1), hasher(hw2));
+    EXPECT_NE(hasher(hw1), hasher(hw3));
+    EXPECT_NE(hasher(hw1), hasher(hw4));
+}
+
 } // end of anonymous namespace
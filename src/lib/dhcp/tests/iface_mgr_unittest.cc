@@ -2621,6 +2621,246 @@ TEST_F(IfaceMgrTest, DeleteExternalSockets4) {
 }
 
 
+// Tests that the write callback of the external socket is called when
+// the socket is ready for writing and that the read callback can be
+// replaced.
+TEST_F(IfaceMgrTest, ExternalSocketWriteCallback4) {
+
+    callback_ok = false;
+    callback2_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    // The write callback can't be set for unknown socket.
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_THROW(ifacemgr->setExternalSocketWriteCallback(pipefd[1],
+                                                          my_callback2),
+                 BadValue);
+
+    // Register the write end of the pipe without the read callback. It
+    // is not checked at all without the write callback.
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[1],
+                                                IfaceMgr::SocketCallback()));
+    Pkt4Ptr pkt4;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(0, 1000));
+    EXPECT_FALSE(pkt4);
+    EXPECT_FALSE(callback2_ok);
+
+    // The empty pipe is ready for writing, so the write callback is called.
+    EXPECT_NO_THROW(ifacemgr->setExternalSocketWriteCallback(pipefd[1],
+                                                             my_callback2));
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(pkt4);
+    EXPECT_TRUE(callback2_ok);
+
+    // Once cleared it is no longer called.
+    callback2_ok = false;
+    EXPECT_NO_THROW(ifacemgr->setExternalSocketWriteCallback(pipefd[1],
+                                                IfaceMgr::SocketCallback()));
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(0, 1000));
+    EXPECT_FALSE(callback2_ok);
+
+    // Register the read end and then replace its callback.
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[0], my_callback2));
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[0], my_callback));
+    EXPECT_EQ(38, write(pipefd[1], "Hi, this is a message sent over a pipe", 38));
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_TRUE(callback_ok);
+    EXPECT_FALSE(callback2_ok);
+
+    // close both pipe ends
+    close(pipefd[1]);
+    close(pipefd[0]);
+}
+
+// Tests that the write callback of the external socket is called by the
+// receive6() method.
+TEST_F(IfaceMgrTest, ExternalSocketWriteCallback6) {
+
+    callback2_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[1],
+                                                IfaceMgr::SocketCallback()));
+    EXPECT_NO_THROW(ifacemgr->setExternalSocketWriteCallback(pipefd[1],
+                                                             my_callback2));
+
+    Pkt6Ptr pkt6;
+    ASSERT_NO_THROW(pkt6 = ifacemgr->receive6(1));
+    EXPECT_FALSE(pkt6);
+    EXPECT_TRUE(callback2_ok);
+
+    // close both pipe ends
+    close(pipefd[1]);
+    close(pipefd[0]);
+}
+
+// Tests that the DHCPv4 packet received while the write callback of the
+// external socket is sending data, e.g. exporting leases, is not held up
+// until all the data have been sent.
+TEST_F(IfaceMgrTest, ExternalSocketWriteCallbackWithPacket4) {
+
+    callback2_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    int socket1 = 0;
+    ASSERT_NO_THROW(
+        socket1 = ifacemgr->openSocket(LOOPBACK, IOAddress("127.0.0.1"),
+                                       DHCP4_SERVER_PORT + 10000);
+    );
+    EXPECT_GE(socket1, 0);
+
+    // The empty pipe is always ready for writing, so the write callback
+    // is called on each turn of the external sockets.
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[1],
+                                                IfaceMgr::SocketCallback()));
+    EXPECT_NO_THROW(ifacemgr->setExternalSocketWriteCallback(pipefd[1],
+                                                             my_callback2));
+
+    Pkt4Ptr pkt4;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(pkt4);
+    EXPECT_TRUE(callback2_ok);
+
+    // Send the packet in the middle of the export.
+    Pkt4Ptr send_pkt(new Pkt4(DHCPDISCOVER, 1234));
+    send_pkt->setLocalAddr(IOAddress("127.0.0.1"));
+    send_pkt->setLocalPort(DHCP4_SERVER_PORT + 10000 + 1);
+    send_pkt->setRemotePort(DHCP4_SERVER_PORT + 10000);
+    send_pkt->setRemoteAddr(IOAddress("127.0.0.1"));
+    send_pkt->setIndex(1);
+    send_pkt->setIface(string(LOOPBACK));
+    ASSERT_NO_THROW(send_pkt->pack());
+    ASSERT_NO_THROW(ifacemgr->send(send_pkt));
+
+    // The packet is received before the write callback is called again.
+    callback2_ok = false;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    ASSERT_TRUE(pkt4);
+    EXPECT_FALSE(callback2_ok);
+    ASSERT_NO_THROW(pkt4->unpack());
+    EXPECT_EQ(send_pkt->getTransid(), pkt4->getTransid());
+
+    // The export continues.
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(pkt4);
+    EXPECT_TRUE(callback2_ok);
+
+    // close both pipe ends
+    close(pipefd[1]);
+    close(pipefd[0]);
+}
+
+// Tests that the DHCPv6 packet received while the write callback of the
+// external socket is sending data is not held up until all the data
+// have been sent.
+TEST_F(IfaceMgrTest, ExternalSocketWriteCallbackWithPacket6) {
+
+    callback2_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    int socket1 = 0;
+    ASSERT_NO_THROW(
+        socket1 = ifacemgr->openSocket(LOOPBACK, IOAddress("::1"), 10547);
+    );
+    EXPECT_GE(socket1, 0);
+
+    int pipefd[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[1],
+                                                IfaceMgr::SocketCallback()));
+    EXPECT_NO_THROW(ifacemgr->setExternalSocketWriteCallback(pipefd[1],
+                                                             my_callback2));
+
+    Pkt6Ptr pkt6;
+    ASSERT_NO_THROW(pkt6 = ifacemgr->receive6(1));
+    EXPECT_FALSE(pkt6);
+    EXPECT_TRUE(callback2_ok);
+
+    // Send the packet in the middle of the export.
+    uint8_t data[128];
+    for (uint8_t i = 0; i < 128; i++) {
+        data[i] = i;
+    }
+    Pkt6Ptr send_pkt(new Pkt6(data, 128));
+    send_pkt->repack();
+    send_pkt->setRemotePort(10547);
+    send_pkt->setRemoteAddr(IOAddress("::1"));
+    send_pkt->setIndex(1);
+    send_pkt->setIface(LOOPBACK);
+    ASSERT_TRUE(ifacemgr->send(send_pkt));
+
+    // The packet is received before the write callback is called again.
+    callback2_ok = false;
+    ASSERT_NO_THROW(pkt6 = ifacemgr->receive6(1));
+    ASSERT_TRUE(pkt6);
+    EXPECT_FALSE(callback2_ok);
+    ASSERT_EQ(send_pkt->data_.size(), pkt6->data_.size());
+
+    // The export continues.
+    ASSERT_NO_THROW(pkt6 = ifacemgr->receive6(1));
+    EXPECT_FALSE(pkt6);
+    EXPECT_TRUE(callback2_ok);
+
+    // close both pipe ends
+    close(pipefd[1]);
+    close(pipefd[0]);
+}
+
+// Tests that the external sockets ready at the same time are serviced
+// in turn.
+TEST_F(IfaceMgrTest, ExternalSocketWriteCallbackRoundRobin) {
+
+    callback_ok = false;
+    callback2_ok = false;
+
+    scoped_ptr<NakedIfaceMgr> ifacemgr(new NakedIfaceMgr());
+
+    int pipefd[2];
+    int secondpipe[2];
+    EXPECT_TRUE(pipe(pipefd) == 0);
+    EXPECT_TRUE(pipe(secondpipe) == 0);
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(pipefd[1],
+                                                IfaceMgr::SocketCallback()));
+    EXPECT_NO_THROW(ifacemgr->addExternalSocket(secondpipe[1],
+                                                IfaceMgr::SocketCallback()));
+    EXPECT_NO_THROW(ifacemgr->setExternalSocketWriteCallback(pipefd[1],
+                                                             my_callback));
+    EXPECT_NO_THROW(ifacemgr->setExternalSocketWriteCallback(secondpipe[1],
+                                                             my_callback2));
+
+    // Both pipes are ready for writing, so each call services one of them.
+    Pkt4Ptr pkt4;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_TRUE(callback_ok);
+    EXPECT_FALSE(callback2_ok);
+
+    callback_ok = false;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_FALSE(callback_ok);
+    EXPECT_TRUE(callback2_ok);
+
+    callback2_ok = false;
+    ASSERT_NO_THROW(pkt4 = ifacemgr->receive4(1));
+    EXPECT_TRUE(callback_ok);
+    EXPECT_FALSE(callback2_ok);
+
+    // close both pipe ends
+    close(pipefd[1]);
+    close(pipefd[0]);
+
+    close(secondpipe[1]);
+    close(secondpipe[0]);
+}
+
 // Tests if a single external socket and its callback can be passed and
 // it is supported properly by receive6() method.
 TEST_F(IfaceMgrTest, SingleExternalSocket6) {
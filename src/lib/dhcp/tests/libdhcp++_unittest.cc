@@ -1716,6 +1716,58 @@ TEST_F(LibDhcpTest, vendorClass6) {
     EXPECT_EQ("eRouter1.0", vclass->getTuple(0).getText());
 }
 
+// This test verifies that the runtime option definitions in the standard
+// option space are used for parsing options after they are set, reverted
+// or cleared.
+TEST_F(LibDhcpTest, unpackOptions4RuntimeDefs) {
+    // Option 222 carrying a single byte.
+    const uint8_t raw_data[] = { 0xDE, 0x01, 0x05 };
+    OptionBuffer buf(raw_data, raw_data + sizeof(raw_data));
+
+    // Without the definition a generic option is created.
+    OptionCollection options;
+    ASSERT_NO_THROW(LibDHCP::unpackOptions4(buf, DHCP4_OPTION_SPACE, options));
+    ASSERT_EQ(1, options.size());
+    EXPECT_FALSE(boost::dynamic_pointer_cast<OptionInt<uint8_t> >
+                 (options.begin()->second));
+
+    // The staged definition is used for parsing.
+    OptionDefSpaceContainer defs;
+    defs.addItem(OptionDefinitionPtr(new OptionDefinition("option-byte", 222,
+                                                          "uint8")),
+                 DHCP4_OPTION_SPACE);
+    LibDHCP::setRuntimeOptionDefs(defs);
+    options.clear();
+    ASSERT_NO_THROW(LibDHCP::unpackOptions4(buf, DHCP4_OPTION_SPACE, options));
+    ASSERT_EQ(1, options.size());
+    OptionUint8Ptr option_byte = boost::dynamic_pointer_cast<
+        OptionUint8>(options.begin()->second);
+    ASSERT_TRUE(option_byte);
+    EXPECT_EQ(5, option_byte->getValue());
+
+    // The reverted definition is not used.
+    LibDHCP::revertRuntimeOptionDefs();
+    options.clear();
+    ASSERT_NO_THROW(LibDHCP::unpackOptions4(buf, DHCP4_OPTION_SPACE, options));
+    ASSERT_EQ(1, options.size());
+    EXPECT_FALSE(boost::dynamic_pointer_cast<OptionUint8>
+                 (options.begin()->second));
+
+    // The committed definition is used until cleared.
+    LibDHCP::setRuntimeOptionDefs(defs);
+    LibDHCP::commitRuntimeOptionDefs();
+    options.clear();
+    ASSERT_NO_THROW(LibDHCP::unpackOptions4(buf, DHCP4_OPTION_SPACE, options));
+    EXPECT_TRUE(boost::dynamic_pointer_cast<OptionUint8>
+                (options.begin()->second));
+
+    LibDHCP::clearRuntimeOptionDefs();
+    options.clear();
+    ASSERT_NO_THROW(LibDHCP::unpackOptions4(buf, DHCP4_OPTION_SPACE, options));
+    EXPECT_FALSE(boost::dynamic_pointer_cast<OptionUint8>
+                 (options.begin()->second));
+}
+
 // This test verifies that it is possible to add runtime option definitions,
 // retrieve them and remove them.
 TEST_F(LibDhcpTest, setRuntimeOptionDefs) {
@@ -1510,4 +1510,58 @@ TEST_F(OptionDefinitionTest, psidArrayTokenized) {
     EXPECT_EQ(7, psid2.second.asUint16());
 }
 
+// This test verifies that the option definitions are found in the
+// table by option code.
+TEST(OptionDefTableTest, get) {
+    OptionDefTable table;
+    EXPECT_TRUE(table.empty());
+    EXPECT_FALSE(table.get(1));
+
+    OptionDefContainerPtr defs(new OptionDefContainer());
+    OptionDefinitionPtr def1(new OptionDefinition("foo", 1, "uint8"));
+    OptionDefinitionPtr def1000(new OptionDefinition("bar", 1000, "string"));
+    defs->push_back(def1);
+    defs->push_back(def1000);
+    ASSERT_NO_THROW(table.add(defs));
+    EXPECT_FALSE(table.empty());
+
+    EXPECT_TRUE(table.get(1) == def1);
+    EXPECT_TRUE(table.get(1000) == def1000);
+    EXPECT_FALSE(table.get(2));
+    EXPECT_FALSE(table.get(1001));
+    EXPECT_FALSE(table.get(65535));
+
+    // The definitions added later don't replace the existing ones.
+    OptionDefContainerPtr runtime_defs(new OptionDefContainer());
+    OptionDefinitionPtr runtime_def1(new OptionDefinition("baz", 1, "uint16"));
+    OptionDefinitionPtr runtime_def2(new OptionDefinition("qux", 2, "uint16"));
+    runtime_defs->push_back(runtime_def1);
+    runtime_defs->push_back(runtime_def2);
+    ASSERT_NO_THROW(table.add(runtime_defs));
+    EXPECT_TRUE(table.get(1) == def1);
+    EXPECT_TRUE(table.get(2) == runtime_def2);
+
+    table.clear();
+    EXPECT_TRUE(table.empty());
+    EXPECT_FALSE(table.get(1));
+}
+
+// This test verifies that the table reports multiple definitions for the
+// same option code.
+TEST(OptionDefTableTest, ambiguous) {
+    OptionDefContainerPtr defs(new OptionDefContainer());
+    defs->push_back(OptionDefinitionPtr(new OptionDefinition("foo", 5,
+                                                             "uint8")));
+    defs->push_back(OptionDefinitionPtr(new OptionDefinition("bar", 5,
+                                                             "string")));
+    defs->push_back(OptionDefinitionPtr(new OptionDefinition("baz", 6,
+                                                             "string")));
+
+    OptionDefTable table;
+    ASSERT_NO_THROW(table.add(defs));
+    EXPECT_THROW(table.get(5), isc::Unexpected);
+    EXPECT_TRUE(table.get(6));
+    EXPECT_FALSE(table.get(7));
+}
+
 } // anonymous namespace
@@ -16,7 +16,9 @@
 #include <dhcp/pkt4.h>
 #include <exceptions/exceptions.h>
 #include <util/buffer.h>
+#include <util/pool_allocator.h>
 
+#include <boost/make_shared.hpp>
 #include <boost/shared_array.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/scoped_ptr.hpp>
@@ -256,6 +258,27 @@ TEST_F(Pkt4Test, constructor) {
     );
 }
 
+// This test verifies that the packet takes over the received buffer
+// without copying it.
+TEST_F(Pkt4Test, constructorAdoptBuffer) {
+    OptionBuffer buf(Pkt4::DHCPV4_PKT_HDR_LEN);
+    for (size_t i = 0; i < buf.size(); ++i) {
+        buf[i] = static_cast<uint8_t>(i);
+    }
+    const uint8_t* data = &buf[0];
+
+    scoped_ptr<Pkt4> pkt;
+    ASSERT_NO_THROW(pkt.reset(new Pkt4(buf)));
+    EXPECT_TRUE(buf.empty());
+    ASSERT_EQ(static_cast<size_t>(Pkt4::DHCPV4_PKT_HDR_LEN), pkt->data_.size());
+    EXPECT_EQ(data, &pkt->data_[0]);
+    EXPECT_EQ(235, pkt->data_[235]);
+
+    // Truncated messages are rejected.
+    OptionBuffer truncated(Pkt4::DHCPV4_PKT_HDR_LEN - 1);
+    EXPECT_THROW(pkt.reset(new Pkt4(truncated)), OutOfRange);
+}
+
 
 TEST_F(Pkt4Test, fixedFields) {
 
@@ -674,6 +697,133 @@ TEST_F(Pkt4Test, unpackOptions) {
     verifyParsedOptions(pkt);
 }
 
+// This test verifies that the packets created with the pool allocator
+// are unpacked correctly and reuse the memory of the released packets.
+TEST_F(Pkt4Test, poolAllocated) {
+    vector<uint8_t> expectedFormat = generateTestPacket2();
+    expectedFormat.push_back(0x63);
+    expectedFormat.push_back(0x82);
+    expectedFormat.push_back(0x53);
+    expectedFormat.push_back(0x63);
+    for (size_t i = 0; i < sizeof(v4_opts); i++) {
+        expectedFormat.push_back(v4_opts[i]);
+    }
+
+    Pkt4Ptr pkt = boost::allocate_shared<Pkt4>(PoolAllocator<Pkt4>(),
+                                               &expectedFormat[0],
+                                               expectedFormat.size());
+    ASSERT_NO_THROW(pkt->unpack());
+    verifyParsedOptions(pkt);
+    const Pkt4* address = pkt.get();
+
+    // The steady state processing of the packets reuses the same memory.
+    pkt.reset();
+    for (int i = 0; i < 10; ++i) {
+        pkt = boost::allocate_shared<Pkt4>(PoolAllocator<Pkt4>(),
+                                           &expectedFormat[0],
+                                           expectedFormat.size());
+        EXPECT_EQ(address, pkt.get());
+        pkt.reset();
+    }
+}
+
+// This test verifies that the options are parsed on demand in the lazy
+// unpack mode and that the result is the same as in the regular mode.
+TEST_F(Pkt4Test, unpackOptionsLazy) {
+
+    vector<uint8_t> expectedFormat = generateTestPacket2();
+
+    expectedFormat.push_back(0x63);
+    expectedFormat.push_back(0x82);
+    expectedFormat.push_back(0x53);
+    expectedFormat.push_back(0x63);
+
+    for (size_t i = 0; i < sizeof(v4_opts); i++) {
+        expectedFormat.push_back(v4_opts[i]);
+    }
+
+    Pkt4Ptr pkt(new Pkt4(&expectedFormat[0], expectedFormat.size()));
+    pkt->setLazyUnpack(true);
+    ASSERT_NO_THROW(pkt->unpack());
+
+    // No option should have been created yet.
+    EXPECT_TRUE(pkt->options_.empty());
+
+    // Retrieving the option creates this option only.
+    EXPECT_EQ(DHCPOFFER, pkt->getType());
+    ASSERT_EQ(1, pkt->options_.size());
+    EXPECT_EQ(DHO_DHCP_MESSAGE_TYPE, pkt->options_.begin()->first);
+
+    // Absent options are not created.
+    EXPECT_FALSE(pkt->getOption(DHO_DHCP_CLIENT_IDENTIFIER));
+    EXPECT_EQ(1, pkt->options_.size());
+
+    verifyParsedOptions(pkt);
+
+    // The packet parsed in the regular mode should be the same.
+    Pkt4Ptr pkt_eager(new Pkt4(&expectedFormat[0], expectedFormat.size()));
+    ASSERT_NO_THROW(pkt_eager->unpack());
+    EXPECT_EQ(pkt_eager->len(), pkt->len());
+    EXPECT_EQ(pkt_eager->toText(), pkt->toText());
+    EXPECT_EQ(pkt_eager->options_.size(), pkt->options_.size());
+
+    // Unpacking the packet again should not duplicate the options.
+    pkt->options_.clear();
+    ASSERT_NO_THROW(pkt->unpack());
+    pkt->unpackLazyOptions();
+    EXPECT_EQ(pkt_eager->options_.size(), pkt->options_.size());
+}
+
+// Checks that the malformed option is reported when it is retrieved in the
+// lazy unpack mode.
+TEST_F(Pkt4Test, unpackMalformedLazy) {
+
+    vector<uint8_t> orig = generateTestPacket2();
+
+    orig.push_back(0x63);
+    orig.push_back(0x82);
+    orig.push_back(0x53);
+    orig.push_back(0x63);
+
+    orig.push_back(53); // Message Type
+    orig.push_back(0); // length=0, the value is missing
+
+    orig.push_back(12); // Hostname
+    orig.push_back(3); // length=3
+    orig.push_back(102); // data="foo"
+    orig.push_back(111);
+    orig.push_back(111);
+
+    // The regular mode rejects the packet.
+    Pkt4Ptr pkt(new Pkt4(&orig[0], orig.size()));
+    EXPECT_THROW(pkt->unpack(), isc::Exception);
+
+    // The lazy mode only rejects the malformed option, on every attempt
+    // to retrieve it, so as it is never treated as absent.
+    pkt.reset(new Pkt4(&orig[0], orig.size()));
+    pkt->setLazyUnpack(true);
+    ASSERT_NO_THROW(pkt->unpack());
+    EXPECT_TRUE(pkt->getOption(DHO_HOST_NAME));
+    EXPECT_THROW(pkt->getOption(DHO_DHCP_MESSAGE_TYPE), MalformedOption);
+    EXPECT_THROW(pkt->getOption(DHO_DHCP_MESSAGE_TYPE), MalformedOption);
+    EXPECT_THROW(pkt->getType(), MalformedOption);
+    EXPECT_THROW(pkt->unpackLazyOptions(DHO_DHCP_MESSAGE_TYPE),
+                 MalformedOption);
+    EXPECT_THROW(pkt->unpackLazyOptions(), MalformedOption);
+
+    // The text representation skips the malformed option.
+    std::string text;
+    ASSERT_NO_THROW(text = pkt->toText());
+    EXPECT_NE(std::string::npos, text.find("malformed options"));
+
+    // The truncated option is not recorded.
+    orig.resize(orig.size() - 1);
+    pkt.reset(new Pkt4(&orig[0], orig.size()));
+    pkt->setLazyUnpack(true);
+    ASSERT_NO_THROW(pkt->unpack());
+    EXPECT_FALSE(pkt->getOption(DHO_HOST_NAME));
+}
+
 // Checks if the code is able to handle a malformed option
 TEST_F(Pkt4Test, unpackMalformed) {
 
@@ -136,6 +136,14 @@ TEST_F(Pkt6Test, constructor) {
 
     EXPECT_EQ(6, pkt1->data_.size());
     EXPECT_EQ(0, memcmp( &pkt1->data_[0], data, sizeof(data)));
+
+    // The packet created from the buffer takes over its contents.
+    OptionBuffer buf(data, data + sizeof(data));
+    const uint8_t* buf_data = &buf[0];
+    scoped_ptr<Pkt6> pkt2(new Pkt6(buf));
+    EXPECT_TRUE(buf.empty());
+    ASSERT_EQ(6, pkt2->data_.size());
+    EXPECT_EQ(buf_data, &pkt2->data_[0]);
 }
 
 /// @brief returns captured actual SOLICIT packet
@@ -272,6 +280,54 @@ TEST_F(Pkt6Test, unpack_solicit1) {
     EXPECT_FALSE(sol->getOption(D6O_IAADDR));
 }
 
+// Checks that the options are parsed on demand in the lazy unpack mode.
+TEST_F(Pkt6Test, unpackLazy) {
+    Pkt6Ptr sol(capture1());
+    sol->setLazyUnpack(true);
+
+    ASSERT_NO_THROW(sol->unpack());
+    EXPECT_TRUE(sol->options_.empty());
+
+    // Retrieving the option creates this option only.
+    EXPECT_TRUE(sol->getOption(D6O_CLIENTID));
+    EXPECT_EQ(1, sol->options_.size());
+    EXPECT_EQ(1, sol->getOptions(D6O_IA_NA).size());
+    EXPECT_EQ(2, sol->options_.size());
+    EXPECT_FALSE(sol->getOption(D6O_SERVERID));
+    EXPECT_EQ(2, sol->options_.size());
+
+    // The remaining options are created when needed to compute the
+    // packet length or text.
+    Pkt6Ptr sol_eager(capture1());
+    ASSERT_NO_THROW(sol_eager->unpack());
+    EXPECT_EQ(sol_eager->len(), sol->len());
+    EXPECT_EQ(sol_eager->options_.size(), sol->options_.size());
+    EXPECT_EQ(sol_eager->toText(), sol->toText());
+}
+
+// Checks that the options of the relayed message are parsed on demand and
+// that the relay options are parsed by unpack in the lazy unpack mode.
+TEST_F(Pkt6Test, relayUnpackLazy) {
+    Pkt6Ptr msg(capture2());
+    msg->setLazyUnpack(true);
+
+    ASSERT_NO_THROW(msg->unpack());
+    EXPECT_TRUE(msg->options_.empty());
+    ASSERT_EQ(2, msg->relay_info_.size());
+    EXPECT_EQ(2, msg->relay_info_[0].options_.size());
+    EXPECT_TRUE(msg->getRelayOption(D6O_INTERFACE_ID, 0));
+
+    Pkt6Ptr msg_eager(capture2());
+    ASSERT_NO_THROW(msg_eager->unpack());
+
+    // The options are located within the relay-msg option.
+    OptionPtr opt = msg->getOption(D6O_CLIENTID);
+    ASSERT_TRUE(opt);
+    EXPECT_TRUE(opt->equals(msg_eager->getOption(D6O_CLIENTID)));
+    EXPECT_EQ(msg_eager->len(), msg->len());
+    EXPECT_EQ(msg_eager->toText(), msg->toText());
+}
+
 TEST_F(Pkt6Test, packUnpack) {
     // Create an on-wire representation of the test packet and clone it.
     Pkt6Ptr pkt(new Pkt6(DHCPV6_SOLICIT, 0x020304));
@@ -26,12 +26,14 @@
 #include <hooks/server_hooks.h>
 #include <hooks/hooks_manager.h>
 
+#include <boost/bind.hpp>
 #include <boost/foreach.hpp>
 
 #include <algorithm>
 #include <cstring>
 #include <sstream>
 #include <limits>
+#include <set>
 #include <vector>
 #include <stdint.h>
 #include <string.h>
@@ -77,6 +79,117 @@ struct AllocEngineHooks {
 // module is called.
 AllocEngineHooks Hooks;
 
+/// @brief Fetches the next slice of the expired leases to be reclaimed.
+///
+/// The leases which have been processed in the current reclamation pass
+/// may still be expired in the lease database, e.g. because their
+/// reclamation failed or the hooks skipped it. The slices are therefore
+/// fetched using the position of the last lease of the previous slice in
+/// the order of the expiration time and address, so as such leases are not
+/// processed twice in one pass and the cost of fetching a slice doesn't
+/// depend on their number.
+///
+/// @param get_expired Function fetching the expired leases from the lease
+/// database, i.e. @c LeaseMgr::getNextExpiredLeases4 or
+/// @c LeaseMgr::getNextExpiredLeases6.
+/// @param limit Maximum number of leases in the slice or 0 to fetch all
+/// remaining leases.
+/// @param [in,out] last_expire Expiration time of the last lease of the
+/// previous slice. It is set to the expiration time of the last lease of
+/// this slice.
+/// @param [in,out] last_address Address of the last lease of the previous
+/// slice. It is set to the address of the last lease of this slice.
+/// @param [out] leases Leases in the slice.
+///
+/// @return true if there are more expired leases to be reclaimed after
+/// this slice, false otherwise.
+template<typename LeaseCollection>
+bool
+getExpiredLeasesSlice(const boost::function<void (LeaseCollection&, const size_t,
+                                                  const int64_t,
+                                                  const IOAddress&)>& get_expired,
+                      const size_t limit, int64_t& last_expire,
+                      IOAddress& last_address, LeaseCollection& leases) {
+    // Fetch one lease more than needed to see if there will be leases
+    // left after this slice.
+    get_expired(leases, (limit > 0 ? limit + 1 : 0), last_expire,
+                last_address);
+
+    bool more_leases = false;
+    if ((limit > 0) && (leases.size() > limit)) {
+        leases.resize(limit);
+        more_leases = true;
+    }
+
+    // Remember the position of the slice before the leases are modified
+    // by the reclamation.
+    if (!leases.empty()) {
+        last_expire = leases.back()->getExpirationTime();
+        last_address = leases.back()->addr_;
+    }
+    return (more_leases);
+}
+
+/// @brief Updates the lease database for the reclaimed IPv4 leases.
+///
+/// The leases are updated or removed in bulk. If this fails, they are
+/// updated or removed one by one to make sure that a single failing lease
+/// doesn't prevent the others from being reclaimed.
+///
+/// @param lease_mgr Lease manager.
+/// @param updated_leases Leases to be updated.
+/// @param removed_leases Addresses of the leases to be removed.
+///
+/// @return Addresses of the leases which couldn't be updated or removed.
+std::set<IOAddress>
+updateReclaimedLeases4(LeaseMgr& lease_mgr,
+                       const Lease4Collection& updated_leases,
+                       const std::vector<IOAddress>& removed_leases) {
+    std::set<IOAddress> failed;
+
+    if (!updated_leases.empty()) {
+        try {
+            lease_mgr.updateLeases4(updated_leases);
+
+        } catch (const std::exception&) {
+            BOOST_FOREACH(Lease4Ptr lease, updated_leases) {
+                try {
+                    lease_mgr.updateLease4(lease);
+
+                } catch (const std::exception& ex) {
+                    LOG_ERROR(alloc_engine_logger,
+                              ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
+                        .arg(lease->addr_.toText())
+                        .arg(ex.what());
+                    failed.insert(lease->addr_);
+                }
+            }
+        }
+    }
+
+    if (!removed_leases.empty()) {
+        try {
+            lease_mgr.deleteLeases4(removed_leases);
+
+        } catch (const std::exception&) {
+            BOOST_FOREACH(IOAddress addr, removed_leases) {
+                try {
+                    lease_mgr.deleteLease(addr);
+
+                } catch (const std::exception& ex) {
+                    LOG_ERROR(alloc_engine_logger,
+                              ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
+                        .arg(addr.toText())
+                        .arg(ex.what());
+                    failed.insert(addr);
+                }
+            }
+        }
+    }
+
+    return (failed);
+}
+
 }; // anonymous namespace
 
 namespace isc {
@@ -248,7 +361,8 @@ AllocEngine::RandomAllocator::pickAddress(const SubnetPtr&,
 AllocEngine::AllocEngine(AllocType engine_type, uint64_t attempts,
                          bool ipv6)
     : attempts_(attempts), incomplete_v4_reclamations_(0),
-      incomplete_v6_reclamations_(0) {
+      incomplete_v6_reclamations_(0), reclamation_slice_size_(1000),
+      reuse_quarantine_time_(0) {
 
     // Choose the basic (normal address) lease type
     Lease::Type basic_type = ipv6 ? Lease::TYPE_NA : Lease::TYPE_V4;
@@ -1461,71 +1575,89 @@ AllocEngine::reclaimExpiredLeases6(const size_t max_leases, const uint16_t timeo
     util::Stopwatch stopwatch;
 
     LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    boost::function<void (Lease6Collection&, const size_t, const int64_t,
+                          const IOAddress&)> get_expired =
+        boost::bind(&LeaseMgr::getNextExpiredLeases6, &lease_mgr, _1, _2, _3,
+                    _4);
 
     // This value indicates if we have been able to deal with all expired
     // leases in this pass.
     bool incomplete_reclamation = false;
-    Lease6Collection leases;
-    // The value of 0 has a special meaning - reclaim all.
-    if (max_leases > 0) {
-        // If the value is non-zero, the caller has limited the number of
-        // leases to reclaim. We obtain one lease more to see if there will
-        // be still leases left after this pass.
-        lease_mgr.getExpiredLeases6(leases, max_leases + 1);
-        // There are more leases expired leases than we will process in this
-        // pass, so we should mark it as an incomplete reclamation. We also
-        // remove this extra lease (which we don't want to process anyway)
-        // from the collection.
-        if (leases.size() > max_leases) {
-            leases.pop_back();
-            incomplete_reclamation = true;
-        }
 
-    } else {
-        // If there is no limitation on the number of leases to reclaim,
-        // we will try to process all. Hence, we don't mark it as incomplete
-        // reclamation just yet.
-        lease_mgr.getExpiredLeases6(leases, max_leases);
-    }
+    // Position of the last lease fetched in this pass in the order of
+    // the expiration time and address.
+    int64_t last_expire = std::numeric_limits<int64_t>::min();
+    IOAddress last_address = IOAddress::IPV6_ZERO_ADDRESS();
+
+    // Number of the leases fetched in this pass.
+    size_t leases_fetched = 0;
 
     // Do not initialize the callout handle until we know if there are any
     // lease6_expire callouts installed.
     CalloutHandlePtr callout_handle;
-    if (!leases.empty() &&
-        HooksManager::getHooksManager().calloutsPresent(Hooks.hook_index_lease6_expire_)) {
-        callout_handle = HooksManager::createCalloutHandle();
-    }
 
+    // The expired leases are fetched and reclaimed in slices, so as a large
+    // number of leases expiring at once doesn't have to be held in memory
+    // and the timeout is honored.
     size_t leases_processed = 0;
-    BOOST_FOREACH(Lease6Ptr lease, leases) {
+    for (bool more_leases = true; more_leases; ) {
+        // The value of 0 has a special meaning - reclaim all.
+        size_t limit = reclamation_slice_size_;
+        if ((max_leases > 0) && (max_leases - leases_fetched < limit)) {
+            limit = max_leases - leases_fetched;
+        }
 
-        try {
-            // Reclaim the lease.
-            reclaimExpiredLease(lease, remove_lease, callout_handle);
-            ++leases_processed;
+        Lease6Collection leases;
+        more_leases = getExpiredLeasesSlice(get_expired, limit, last_expire,
+                                            last_address, leases);
+        leases_fetched += leases.size();
 
-        } catch (const std::exception& ex) {
-            LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED)
-                .arg(lease->addr_.toText())
-                .arg(ex.what());
-        }
-
-        // Check if we have hit the timeout for running reclamation routine and
-        // return if we have. We're checking it here, because we always want to
-        // allow reclaiming at least one lease.
-        if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
-            // Timeout. This will likely mean that we haven't been able to process
-            // all leases we wanted to process. The reclamation pass will be
-            // probably marked as incomplete.
-            if (!incomplete_reclamation) {
-                if (leases_processed < leases.size()) {
+        if (!callout_handle && !leases.empty() &&
+            HooksManager::getHooksManager().calloutsPresent(Hooks.hook_index_lease6_expire_)) {
+            callout_handle = HooksManager::createCalloutHandle();
+        }
+
+        bool timed_out = false;
+        for (Lease6Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            try {
+                // Reclaim the lease.
+                reclaimExpiredLease(*lease, remove_lease, callout_handle);
+                ++leases_processed;
+
+            } catch (const std::exception& ex) {
+                LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V6_LEASE_RECLAMATION_FAILED)
+                    .arg((*lease)->addr_.toText())
+                    .arg(ex.what());
+            }
+
+            // Check if we have hit the timeout for running reclamation routine and
+            // return if we have. We're checking it here, because we always want to
+            // allow reclaiming at least one lease.
+            if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
+                // Timeout. This will likely mean that we haven't been able to process
+                // all leases we wanted to process. The reclamation pass will be
+                // probably marked as incomplete.
+                if (more_leases || (lease + 1 != leases.end())) {
                     incomplete_reclamation = true;
                 }
+
+                LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                          ALLOC_ENGINE_V6_LEASES_RECLAMATION_TIMEOUT)
+                    .arg(timeout);
+                timed_out = true;
+                break;
             }
+        }
 
-            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-                      ALLOC_ENGINE_V6_LEASES_RECLAMATION_TIMEOUT)
-                .arg(timeout);
+        if (timed_out) {
+            break;
+        }
+
+        // There are more expired leases than we were allowed to process in
+        // this pass, so we should mark it as an incomplete reclamation.
+        if ((max_leases > 0) && (leases_fetched >= max_leases)) {
+            incomplete_reclamation = more_leases;
             break;
         }
     }
@@ -1600,72 +1732,136 @@ AllocEngine::reclaimExpiredLeases4(const size_t max_leases, const uint16_t timeo
     util::Stopwatch stopwatch;
 
     LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+    boost::function<void (Lease4Collection&, const size_t, const int64_t,
+                          const IOAddress&)> get_expired =
+        boost::bind(&LeaseMgr::getNextExpiredLeases4, &lease_mgr, _1, _2, _3,
+                    _4);
 
     // This value indicates if we have been able to deal with all expired
     // leases in this pass.
     bool incomplete_reclamation = false;
-    Lease4Collection leases;
-    // The value of 0 has a special meaning - reclaim all.
-    if (max_leases > 0) {
-        // If the value is non-zero, the caller has limited the number of
-        // leases to reclaim. We obtain one lease more to see if there will
-        // be still leases left after this pass.
-        lease_mgr.getExpiredLeases4(leases, max_leases + 1);
-        // There are more leases expired leases than we will process in this
-        // pass, so we should mark it as an incomplete reclamation. We also
-        // remove this extra lease (which we don't want to process anyway)
-        // from the collection.
-        if (leases.size() > max_leases) {
-            leases.pop_back();
-            incomplete_reclamation = true;
-        }
 
-    } else {
-        // If there is no limitation on the number of leases to reclaim,
-        // we will try to process all. Hence, we don't mark it as incomplete
-        // reclamation just yet.
-        lease_mgr.getExpiredLeases4(leases, max_leases);
-    }
+    // Position of the last lease fetched in this pass in the order of
+    // the expiration time and address.
+    int64_t last_expire = std::numeric_limits<int64_t>::min();
+    IOAddress last_address = IOAddress::IPV4_ZERO_ADDRESS();
 
+    // Number of the leases fetched in this pass.
+    size_t leases_fetched = 0;
 
     // Do not initialize the callout handle until we know if there are any
     // lease4_expire callouts installed.
     CalloutHandlePtr callout_handle;
-    if (!leases.empty() &&
-        HooksManager::getHooksManager().calloutsPresent(Hooks.hook_index_lease4_expire_)) {
-        callout_handle = HooksManager::createCalloutHandle();
-    }
 
+    // The expired leases are fetched and reclaimed in slices, so as a large
+    // number of leases expiring at once doesn't have to be held in memory
+    // and the timeout is honored.
     size_t leases_processed = 0;
-    BOOST_FOREACH(Lease4Ptr lease, leases) {
+    for (bool more_leases = true; more_leases; ) {
+        // The value of 0 has a special meaning - reclaim all.
+        size_t limit = reclamation_slice_size_;
+        if ((max_leases > 0) && (max_leases - leases_fetched < limit)) {
+            limit = max_leases - leases_fetched;
+        }
 
-        try {
-            // Reclaim the lease.
-            reclaimExpiredLease(lease, remove_lease, callout_handle);
-            ++leases_processed;
+        Lease4Collection leases;
+        more_leases = getExpiredLeasesSlice(get_expired, limit, last_expire,
+                                            last_address, leases);
+        leases_fetched += leases.size();
 
-        } catch (const std::exception& ex) {
-            LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
-                .arg(lease->addr_.toText())
-                .arg(ex.what());
-        }
-
-        // Check if we have hit the timeout for running reclamation routine and
-        // return if we have. We're checking it here, because we always want to
-        // allow reclaiming at least one lease.
-        if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
-            // Timeout. This will likely mean that we haven't been able to process
-            // all leases we wanted to process. The reclamation pass will be
-            // probably marked as incomplete.
-            if (!incomplete_reclamation) {
-                if (leases_processed < leases.size()) {
+        if (!callout_handle && !leases.empty() &&
+            HooksManager::getHooksManager().calloutsPresent(Hooks.hook_index_lease4_expire_)) {
+            callout_handle = HooksManager::createCalloutHandle();
+        }
+
+        // Reclaimed leases are collected and the lease database is updated
+        // for all of them at once when the slice is done. This significantly
+        // reduces the number of round trips for the SQL backends. The DNS
+        // updates, statistics and address reuse only follow for the leases
+        // which have been successfully updated.
+        std::vector<Lease4Reclamation> reclamations;
+        Lease4Collection updated_leases;
+        std::vector<IOAddress> removed_leases;
+
+        bool timed_out = false;
+        for (Lease4Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            try {
+                // Reclaim the lease.
+                Lease4Reclamation reclamation =
+                    beginReclamation(*lease, remove_lease ? DB_RECLAIM_REMOVE :
+                                     DB_RECLAIM_UPDATE, callout_handle);
+                if (!reclamation.skipped_) {
+                    if (reclamation.remove_) {
+                        removed_leases.push_back((*lease)->addr_);
+                    } else {
+                        updated_leases.push_back(createReclaimedLease(*lease));
+                    }
+                }
+                reclamations.push_back(reclamation);
+
+            } catch (const std::exception& ex) {
+                LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
+                    .arg((*lease)->addr_.toText())
+                    .arg(ex.what());
+            }
+
+            // Check if we have hit the timeout for running reclamation routine and
+            // return if we have. We're checking it here, because we always want to
+            // allow reclaiming at least one lease.
+            if ((timeout > 0) && (stopwatch.getTotalMilliseconds() >= timeout)) {
+                // Timeout. This will likely mean that we haven't been able to process
+                // all leases we wanted to process. The reclamation pass will be
+                // probably marked as incomplete.
+                if (more_leases || (lease + 1 != leases.end())) {
                     incomplete_reclamation = true;
                 }
+
+                LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                          ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT)
+                    .arg(timeout);
+                timed_out = true;
+                break;
             }
+        }
 
-            LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
-                      ALLOC_ENGINE_V4_LEASES_RECLAMATION_TIMEOUT)
-                .arg(timeout);
+        // Update the lease database for all leases reclaimed in this slice.
+        // This must be done before the next slice is fetched.
+        const std::set<IOAddress> failed =
+            updateReclaimedLeases4(lease_mgr, updated_leases, removed_leases);
+
+        // Complete the reclamation of the leases for which the update
+        // succeeded. The others remain expired in the database.
+        for (std::vector<Lease4Reclamation>::const_iterator reclamation =
+                 reclamations.begin(); reclamation != reclamations.end();
+             ++reclamation) {
+            if (failed.count(reclamation->lease_->addr_) > 0) {
+                continue;
+            }
+            if (!reclamation->skipped_) {
+                LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                          ALLOC_ENGINE_LEASE_RECLAIMED)
+                    .arg(reclamation->lease_->addr_.toText());
+            }
+            try {
+                finishReclamation(*reclamation);
+                ++leases_processed;
+
+            } catch (const std::exception& ex) {
+                LOG_ERROR(alloc_engine_logger, ALLOC_ENGINE_V4_LEASE_RECLAMATION_FAILED)
+                    .arg(reclamation->lease_->addr_.toText())
+                    .arg(ex.what());
+            }
+        }
+
+        if (timed_out) {
+            break;
+        }
+
+        // There are more expired leases than we were allowed to process in
+        // this pass, so we should mark it as an incomplete reclamation.
+        if ((max_leases > 0) && (leases_fetched >= max_leases)) {
+            incomplete_reclamation = more_leases;
             break;
         }
     }
@@ -1817,17 +2013,49 @@ void
 AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
                                  const DbReclaimMode& reclaim_mode,
                                  const CalloutHandlePtr& callout_handle) {
+    Lease4Reclamation reclamation = beginReclamation(lease, reclaim_mode,
+                                                     callout_handle);
+
+    if (!reclamation.skipped_ && (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED)) {
+        // Reclaim the lease - depending on the configuration, set the
+        // expired-reclaimed state or simply remove it. If this throws,
+        // the reclamation is not completed.
+        LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
+        if (reclamation.remove_) {
+            lease_mgr.deleteLease(lease->addr_);
+        } else {
+            lease_mgr.updateLease4(createReclaimedLease(lease));
+        }
+
+        // Lease has been reclaimed.
+        LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
+                  ALLOC_ENGINE_LEASE_RECLAIMED)
+            .arg(lease->addr_.toText());
+    }
+
+    finishReclamation(reclamation);
+}
+
+AllocEngine::Lease4Reclamation
+AllocEngine::beginReclamation(const Lease4Ptr& lease,
+                              const DbReclaimMode& reclaim_mode,
+                              const CalloutHandlePtr& callout_handle) {
 
     LOG_DEBUG(alloc_engine_logger, ALLOC_ENGINE_DBG_TRACE,
               ALLOC_ENGINE_V4_LEASE_RECLAIM)
         .arg(Pkt4::makeLabel(lease->hwaddr_, lease->client_id_))
         .arg(lease->addr_.toText());
 
+    Lease4Reclamation reclamation;
+    reclamation.lease_ = lease;
+    reclamation.skipped_ = false;
+    reclamation.remove_ = (reclaim_mode == DB_RECLAIM_REMOVE);
+    reclamation.declined_ = false;
+
     // The skip flag indicates if the callouts have taken responsibility
     // for reclaiming the lease. The callout will set this to true if
     // it reclaims the lease itself. In this case the reclamation routine
     // will not update DNS nor update the database.
-    bool skipped = false;
     if (callout_handle) {
         callout_handle->deleteAllArguments();
         callout_handle->setArgument("lease4", lease);
@@ -1836,60 +2064,111 @@ AllocEngine::reclaimExpiredLease(const Lease4Ptr& lease,
         HooksManager::callCallouts(Hooks.hook_index_lease4_expire_,
                                    *callout_handle);
 
-        skipped = callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP;
+        reclamation.skipped_ =
+            (callout_handle->getStatus() == CalloutHandle::NEXT_STEP_SKIP);
     }
 
     /// @todo: Maybe add support for DROP status?
     /// Not sure if we need to support every possible status everywhere.
 
-    if (!skipped) {
+    // Let's check if the lease that just expired is in DECLINED state.
+    // If it is, the lease4_recover callouts decide if it is removed.
+    if (!reclamation.skipped_ && (lease->state_ == Lease::STATE_DECLINED)) {
+        // There's no point in keeping a declined lease after its
+        // reclamation. A declined lease doesn't have any client
+        // identifying information anymore.  So we'll flag it for
+        // removal unless the hook has set the skip flag.
+        reclamation.remove_ = reclaimDeclined(lease);
+        reclamation.declined_ = reclamation.remove_;
+    }
+
+    return (reclamation);
+}
+
+void
+AllocEngine::finishReclamation(const Lease4Reclamation& reclamation) {
+    const Lease4Ptr& lease = reclamation.lease_;
+    StatsMgr& stats_mgr = StatsMgr::instance();
+
+    if (!reclamation.skipped_) {
 
         // Generate removal name change request for D2, if required.
         // This will return immediately if the DNS wasn't updated
         // when the lease was created.
         queueNCR(CHG_REMOVE, lease);
 
-        // Let's check if the lease that just expired is in DECLINED state.
-        // If it is, we need to perform a couple extra steps.
-        bool remove_lease = (reclaim_mode == DB_RECLAIM_REMOVE);
-        if (lease->state_ == Lease::STATE_DECLINED) {
-            // Do extra steps required for declined lease reclamation:
-            // - call the recover hook
-            // - bump decline-related stats
-            // - log separate message
-            // There's no point in keeping a declined lease after its
-            // reclamation. A declined lease doesn't have any client
-            // identifying information anymore.  So we'll flag it for
-            // removal unless the hook has set the skip flag.
-            remove_lease = reclaimDeclined(lease);
-        }
+        if (reclamation.declined_) {
+            LOG_INFO(alloc_engine_logger, ALLOC_ENGINE_V4_DECLINED_RECOVERED)
+                .arg(lease->addr_.toText())
+                .arg(lease->valid_lft_);
 
-        if (reclaim_mode != DB_RECLAIM_LEAVE_UNCHANGED) {
-            // Reclaim the lease - depending on the configuration, set the
-            // expired-reclaimed state or simply remove it.
-            LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
-            reclaimLeaseInDatabase<Lease4Ptr>(lease, remove_lease,
-                                              boost::bind(&LeaseMgr::updateLease4,
-                                                          &lease_mgr, _1));
+            // Decrease subnet specific counter for currently declined addresses
+            stats_mgr.addValue(StatsMgr::generateName("subnet", lease->subnet_id_,
+                "declined-addresses"), static_cast<int64_t>(-1));
+
+            // Decrease global counter for declined addresses
+            stats_mgr.addValue("declined-addresses", static_cast<int64_t>(-1));
+
+            stats_mgr.addValue("reclaimed-declined-addresses", static_cast<int64_t>(1));
+
+            stats_mgr.addValue(StatsMgr::generateName("subnet", lease->subnet_id_,
+                "reclaimed-declined-addresses"), static_cast<int64_t>(1));
         }
+
+        // The address is free, so it can be handed out to other clients
+        // ahead of the rest of the pool.
+        queueFreeAddress(lease);
     }
 
     // Update statistics.
 
     // Decrease number of assigned addresses.
-    StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
-                                                         lease->subnet_id_,
-                                                         "assigned-addresses"),
-                                  int64_t(-1));
+    stats_mgr.addValue(StatsMgr::generateName("subnet",
+                                              lease->subnet_id_,
+                                              "assigned-addresses"),
+                       int64_t(-1));
 
     // Increase total number of reclaimed leases.
-    StatsMgr::instance().addValue("reclaimed-leases", int64_t(1));
+    stats_mgr.addValue("reclaimed-leases", int64_t(1));
 
     // Increase number of reclaimed leases for a subnet.
-    StatsMgr::instance().addValue(StatsMgr::generateName("subnet",
-                                                         lease->subnet_id_,
-                                                         "reclaimed-leases"),
-                                  int64_t(1));
+    stats_mgr.addValue(StatsMgr::generateName("subnet",
+                                              lease->subnet_id_,
+                                              "reclaimed-leases"),
+                       int64_t(1));
+}
+
+Lease4Ptr
+AllocEngine::createReclaimedLease(const Lease4Ptr& lease) {
+    Lease4Ptr reclaimed(new Lease4(*lease));
+    // Clear FQDN information as the name change request removes the
+    // DNS record.
+    reclaimed->hostname_.clear();
+    reclaimed->fqdn_fwd_ = false;
+    reclaimed->fqdn_rev_ = false;
+    reclaimed->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    return (reclaimed);
+}
+
+void
+AllocEngine::setReclamationSliceSize(const size_t slice_size) {
+    if (slice_size == 0) {
+        isc_throw(BadValue, "the number of leases reclaimed in a single"
+                  " slice must be greater than 0");
+    }
+    reclamation_slice_size_ = slice_size;
+}
+
+void
+AllocEngine::queueFreeAddress(const Lease4Ptr& lease) {
+    Subnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+        getCfgSubnets4()->getSubnet(lease->subnet_id_);
+    if (subnet) {
+        PoolPtr pool = subnet->getPool(Lease::TYPE_V4, lease->addr_, false);
+        if (pool) {
+            pool->addFreeAddress(lease->addr_);
+        }
+    }
 }
 
 void
@@ -1949,26 +2228,8 @@ AllocEngine::reclaimDeclined(const Lease4Ptr& lease) {
         }
     }
 
-    LOG_INFO(alloc_engine_logger, ALLOC_ENGINE_V4_DECLINED_RECOVERED)
-        .arg(lease->addr_.toText())
-        .arg(lease->valid_lft_);
-
-    StatsMgr& stats_mgr = StatsMgr::instance();
-
-    // Decrease subnet specific counter for currently declined addresses
-    stats_mgr.addValue(StatsMgr::generateName("subnet", lease->subnet_id_,
-        "declined-addresses"), static_cast<int64_t>(-1));
-
-    // Decrease global counter for declined addresses
-    stats_mgr.addValue("declined-addresses", static_cast<int64_t>(-1));
-
-    stats_mgr.addValue("reclaimed-declined-addresses", static_cast<int64_t>(1));
-
-    stats_mgr.addValue(StatsMgr::generateName("subnet", lease->subnet_id_,
-        "reclaimed-declined-addresses"), static_cast<int64_t>(1));
-
-    // Note that we do not touch assigned-addresses counters. Those are
-    // modified in whatever code calls this method.
+    // The recovery is logged and the statistics are updated when the
+    // reclamation is completed, i.e. in finishReclamation.
     return (true);
 }
 
@@ -2142,6 +2403,12 @@ hasAddressReservation(const AllocEngine::ClientContext4& ctx) {
 /// @param [out] client_lease A pointer to the lease returned by this function
 /// or null value if no has been lease found.
 void findClientLease(const AllocEngine::ClientContext4& ctx, Lease4Ptr& client_lease) {
+    // The server may have already fetched the client's lease.
+    if (ctx.client_lease_fetched_) {
+        client_lease = ctx.client_lease_;
+        return;
+    }
+
     LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
     // If client identifier has been supplied, use it to lookup the lease. This
     // search will return no lease if the client doesn't have any lease in the
@@ -2184,8 +2451,8 @@ AllocEngine::ClientContext4::ClientContext4()
       requested_address_(IOAddress::IPV4_ZERO_ADDRESS()),
       fwd_dns_update_(false), rev_dns_update_(false),
       hostname_(""), callout_handle_(), fake_allocation_(false),
-      old_lease_(), host_(), conflicting_lease_(), query_(),
-      host_identifiers_() {
+      old_lease_(), client_lease_(), client_lease_fetched_(false), host_(),
+      conflicting_lease_(), query_(), host_identifiers_() {
 }
 
 AllocEngine::ClientContext4::ClientContext4(const Subnet4Ptr& subnet,
@@ -2200,8 +2467,8 @@ AllocEngine::ClientContext4::ClientContext4(const Subnet4Ptr& subnet,
       requested_address_(requested_addr),
       fwd_dns_update_(fwd_dns_update), rev_dns_update_(rev_dns_update),
       hostname_(hostname), callout_handle_(),
-      fake_allocation_(fake_allocation), old_lease_(), host_(),
-      host_identifiers_() {
+      fake_allocation_(fake_allocation), old_lease_(), client_lease_(),
+      client_lease_fetched_(false), host_(), host_identifiers_() {
 
     // Initialize host identifiers.
     if (hwaddr) {
@@ -2829,9 +3096,45 @@ AllocEngine::allocateOrReuseLease4(const IOAddress& candidate, ClientContext4& c
     return (Lease4Ptr());
 }
 
+Lease4Ptr
+AllocEngine::allocateFreeLease4(ClientContext4& ctx) {
+    const time_t now = time(NULL);
+    const PoolCollection& pools = ctx.subnet_->getPools(Lease::TYPE_V4);
+    for (PoolCollection::const_iterator pool = pools.begin();
+         pool != pools.end(); ++pool) {
+        IOAddress candidate = IOAddress::IPV4_ZERO_ADDRESS();
+        while ((*pool)->popFreeAddress(reuse_quarantine_time_, candidate,
+                                       now)) {
+            // The address reserved for another client is dropped from the
+            // queue. The allocator will skip it too.
+            if (addressReserved(candidate, ctx)) {
+                continue;
+            }
+            Lease4Ptr new_lease = allocateOrReuseLease4(candidate, ctx);
+            if (new_lease) {
+                return (new_lease);
+
+            } else if (ctx.callout_handle_ &&
+                       (ctx.callout_handle_->getStatus() !=
+                        CalloutHandle::NEXT_STEP_CONTINUE)) {
+                // The callouts refused the address, so put it back and
+                // let the caller deal with the callouts' status.
+                (*pool)->addFreeAddress(candidate, now);
+                return (Lease4Ptr());
+            }
+        }
+    }
+    return (Lease4Ptr());
+}
+
 Lease4Ptr
 AllocEngine::allocateUnreservedLease4(ClientContext4& ctx) {
-    Lease4Ptr new_lease;
+    // Try the addresses which have recently become free first.
+    Lease4Ptr new_lease = allocateFreeLease4(ctx);
+    if (new_lease) {
+        return (new_lease);
+    }
+
     AllocatorPtr allocator = getAllocator(Lease::TYPE_V4);
     const uint64_t max_attempts = (attempts_ > 0 ? attempts_ :
                                    ctx.subnet_->getPoolCapacity(Lease::TYPE_V4));
@@ -695,6 +695,54 @@ public:
     /// deleted.
     void deleteExpiredReclaimedLeases4(const uint32_t secs);
 
+    /// @brief Sets the number of expired leases reclaimed in a single slice.
+    ///
+    /// The reclamation routines don't fetch all expired leases at once.
+    /// They fetch and reclaim the leases in slices of the specified size,
+    /// updating the lease database after each slice. This bounds the
+    /// memory used by the reclamation and the time between the checks
+    /// of the reclamation timeout when a large number of leases has
+    /// expired at once, e.g. after the server was down for a long time.
+    ///
+    /// @param slice_size Maximum number of leases in a slice.
+    /// @throw BadValue if the slice size is 0.
+    void setReclamationSliceSize(const size_t slice_size);
+
+    /// @brief Returns the number of expired leases reclaimed in a single
+    /// slice.
+    size_t getReclamationSliceSize() const {
+        return (reclamation_slice_size_);
+    }
+
+    /// @brief Sets the time for which the freed addresses are held before
+    /// they are reused.
+    ///
+    /// The addresses freed by the lease release and the reclamation of the
+    /// expired leases are queued in their pools (see
+    /// @ref Pool::addFreeAddress) and the DHCPv4 allocation tries them
+    /// before walking the pool with the allocator. The address is taken
+    /// from the queue when it has been held there for at least this time.
+    ///
+    /// @param quarantine_time Time in seconds.
+    void setReuseQuarantineTime(const uint32_t quarantine_time) {
+        reuse_quarantine_time_ = quarantine_time;
+    }
+
+    /// @brief Returns the time for which the freed addresses are held
+    /// before they are reused.
+    uint32_t getReuseQuarantineTime() const {
+        return (reuse_quarantine_time_);
+    }
+
+    /// @brief Queues the address of the lease in its pool for the reuse.
+    ///
+    /// The pool is looked up in the subnet of the lease in the current
+    /// configuration. If the subnet or the pool no longer exists, the
+    /// address is not queued.
+    ///
+    /// @param lease Lease which address has become free.
+    static void queueFreeAddress(const Lease4Ptr& lease);
+
 
     /// @anchor findReservationDecl
     /// @brief Attempts to find appropriate host reservation.
@@ -962,6 +1010,65 @@ private:
                              const DbReclaimMode& reclaim_mode,
                              const hooks::CalloutHandlePtr& callout_handle);
 
+    /// @brief Outcome of the reclamation steps preceding the update of the
+    /// lease database.
+    ///
+    /// The @ref reclaimExpiredLeases4 updates the lease database for all
+    /// leases reclaimed in a slice at once, i.e. with @ref LeaseMgr::updateLeases4
+    /// and @ref LeaseMgr::deleteLeases4. This structure holds what is needed
+    /// to complete the reclamation of a lease once its update succeeded.
+    struct Lease4Reclamation {
+        /// @brief Pointer to the reclaimed lease as fetched from the database.
+        Lease4Ptr lease_;
+
+        /// @brief Indicates if the callouts have skipped the reclamation.
+        bool skipped_;
+
+        /// @brief Indicates if the lease is removed from the database.
+        bool remove_;
+
+        /// @brief Indicates if a declined lease is being recovered.
+        bool declined_;
+    };
+
+    /// @brief Starts the reclamation of the DHCPv4 lease.
+    ///
+    /// Calls the lease4_expire callouts and, for a declined lease, the
+    /// lease4_recover callouts. Their results determine if the lease is
+    /// removed from the database or updated. This method doesn't touch
+    /// the lease database, statistics or the DNS, so as nothing needs to be
+    /// undone if the subsequent update of the lease database fails.
+    ///
+    /// @param lease Pointer to the DHCPv4 lease.
+    /// @param reclaim_mode Indicates what should be done with the reclaimed
+    /// lease in the lease database.
+    /// @param callout_handle Pointer to the callout handle.
+    ///
+    /// @return Outcome to be passed to @ref finishReclamation.
+    Lease4Reclamation beginReclamation(const Lease4Ptr& lease,
+                                       const DbReclaimMode& reclaim_mode,
+                                       const hooks::CalloutHandlePtr& callout_handle);
+
+    /// @brief Completes the reclamation of the DHCPv4 lease.
+    ///
+    /// This must only be called when the lease database has been
+    /// successfully updated for the lease. It generates the name change
+    /// request removing the DNS entries, queues the address for the
+    /// reuse and updates the statistics.
+    ///
+    /// @param reclamation Outcome returned by @ref beginReclamation.
+    void finishReclamation(const Lease4Reclamation& reclamation);
+
+    /// @brief Returns a copy of the lease to be stored in the database
+    /// in the expired-reclaimed state.
+    ///
+    /// The FQDN information is cleared in the returned copy. The original
+    /// lease is left unchanged, so as it can still be used to generate the
+    /// name change request once the database has been updated.
+    ///
+    /// @param lease Pointer to the reclaimed lease.
+    static Lease4Ptr createReclaimedLease(const Lease4Ptr& lease);
+
     /// @brief Marks lease as reclaimed in the database.
     ///
     /// This method is called internally by the leases reclamation routines.
@@ -987,12 +1094,11 @@ private:
                                 lease_update_fun) const;
 
     /// @anchor reclaimDeclinedLease4
-    /// @brief Conducts steps necessary for reclaiming declined IPv4 lease.
+    /// @brief Calls the lease4_recover callouts for the declined IPv4 lease.
     ///
-    /// These are the additional steps required when recovering a declined lease:
-    /// - bump decline recovered stat
-    /// - log lease recovery
-    /// - call lease4_recover hook
+    /// The recovery is logged and the decline related statistics are
+    /// updated by @ref finishReclamation, once the lease database has been
+    /// updated.
     ///
     /// @param lease Lease to be reclaimed from Declined state
     /// @return true if it's ok to remove the lease (false = hooks status says
@@ -1072,6 +1178,20 @@ public:
         /// @brief A pointer to an old lease that the client had before update.
         Lease4Ptr old_lease_;
 
+        /// @brief A pointer to the client's lease fetched by the server
+        /// before the allocation.
+        ///
+        /// The server may look up the client's lease asynchronously before
+        /// calling the allocation engine, so as it can process other packets
+        /// while the lookup is in progress. The engine uses this lease rather
+        /// than looking it up again when @c client_lease_fetched_ is set. A
+        /// null pointer then means that the client has no lease in the subnet.
+        Lease4Ptr client_lease_;
+
+        /// @brief Indicates if @c client_lease_ holds the result of the
+        /// lookup of the client's lease.
+        bool client_lease_fetched_;
+
         /// @brief A pointer to the object identifying host reservations.
         ConstHostPtr host_;
 
@@ -1420,6 +1540,24 @@ private:
     /// was not successful.
     Lease4Ptr allocateUnreservedLease4(ClientContext4& ctx);
 
+    /// @brief Allocates the lease using one of the addresses freed in the
+    /// subnet's pools.
+    ///
+    /// This method takes the addresses which have been held in the queues
+    /// of free addresses for at least the reuse quarantine time and tries
+    /// to allocate them, in the order in which they have been freed. The
+    /// addresses which turn out to be reserved or in use are dropped from
+    /// the queue. The address offered to the client (fake allocation) is
+    /// not put back to the queue, so as it is not offered to other clients
+    /// before the client requests it.
+    ///
+    /// @param ctx Client context holding the data extracted from the
+    /// client's message.
+    ///
+    /// @return A pointer to the allocated lease or NULL if none of the
+    /// queued addresses could be allocated.
+    Lease4Ptr allocateFreeLease4(ClientContext4& ctx);
+
     /// @brief Updates the specified lease with the information from a context.
     ///
     /// The context, specified as an argument to this method, holds various
@@ -1474,6 +1612,13 @@ private:
     /// which there are still expired leases in the database.
     uint16_t incomplete_v6_reclamations_;
 
+    /// @brief Maximum number of expired leases reclaimed in a single slice.
+    size_t reclamation_slice_size_;
+
+    /// @brief Time in seconds for which the freed addresses are held
+    /// before they are reused.
+    uint32_t reuse_quarantine_time_;
+
 };
 
 /// @brief A pointer to the @c AllocEngine object.
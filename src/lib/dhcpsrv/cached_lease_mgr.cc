@@ -0,0 +1,671 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/cached_lease_mgr.h>
+#include <dhcpsrv/dhcpsrv_log.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/bind.hpp>
+#include <boost/tuple/tuple.hpp>
+
+using namespace isc::asiolink;
+
+namespace {
+
+/// @brief Remembers that the complete result of a lookup is cached.
+///
+/// The number of remembered lookups is bounded by the maximum number
+/// of cached leases. When the limit is reached, the remembered lookups
+/// are forgotten, which merely causes the subsequent lookups to query
+/// the underlying lease manager.
+///
+/// @param keys Set of the lookup keys.
+/// @param key Key of the lookup.
+/// @param max_size Maximum number of keys.
+template<typename KeyType>
+void
+markComplete(std::set<KeyType>& keys, const KeyType& key, const size_t max_size) {
+    if (keys.size() >= max_size) {
+        keys.clear();
+    }
+    keys.insert(key);
+}
+
+/// @brief Returns a copy of the lease.
+///
+/// @param lease Pointer to the lease or NULL.
+isc::dhcp::Lease4Ptr
+copyLease(const isc::dhcp::Lease4Ptr& lease) {
+    if (lease) {
+        return (isc::dhcp::Lease4Ptr(new isc::dhcp::Lease4(*lease)));
+    }
+    return (isc::dhcp::Lease4Ptr());
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+CachedLeaseMgr::CachedLeaseMgr(LeaseMgr* backend, const size_t max_size)
+    : LeaseMgr(), backend_(backend), max_size_(max_size) {
+    if (!backend_) {
+        isc_throw(BadValue, "lease manager to be cached must not be null");
+    }
+    if (max_size_ == 0) {
+        isc_throw(BadValue, "lease cache size must be greater than 0");
+    }
+}
+
+CachedLeaseMgr::~CachedLeaseMgr() {
+}
+
+bool
+CachedLeaseMgr::addLease(const Lease4Ptr& lease) {
+    bool added = backend_->addLease(lease);
+    if (added) {
+        cacheLease(lease);
+    }
+    return (added);
+}
+
+bool
+CachedLeaseMgr::addLease(const Lease6Ptr& lease) {
+    return (backend_->addLease(lease));
+}
+
+Lease4Ptr
+CachedLeaseMgr::getLease4(const IOAddress& addr) const {
+    Lease4Ptr lease;
+    if (findLease(addr, lease)) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+                  DHCPSRV_LEASE_CACHE_HIT).arg(addr.toText());
+        return (lease);
+    }
+
+    lease = backend_->getLease4(addr);
+    storeLookup(addr, lease);
+    return (lease);
+}
+
+Lease4Collection
+CachedLeaseMgr::getLease4(const HWAddr& hwaddr) const {
+    Lease4Collection collection;
+    if (complete_hwaddrs_.count(hwaddr.hwaddr_) > 0) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+                  DHCPSRV_LEASE_CACHE_HIT).arg(hwaddr.toText());
+        const Lease4Cache::index<HWAddressSubnetIdIndexTag>::type& idx =
+            leases_.get<HWAddressSubnetIdIndexTag>();
+        std::pair<Lease4Cache::index<HWAddressSubnetIdIndexTag>::type::const_iterator,
+                  Lease4Cache::index<HWAddressSubnetIdIndexTag>::type::const_iterator> l =
+            idx.equal_range(boost::make_tuple(hwaddr.hwaddr_));
+        for (; l.first != l.second; ++l.first) {
+            collection.push_back(copyLease(*l.first));
+        }
+        return (collection);
+    }
+
+    collection = backend_->getLease4(hwaddr);
+    for (Lease4Collection::const_iterator lease = collection.begin();
+         lease != collection.end(); ++lease) {
+        cacheLease(*lease);
+    }
+    // Leases may have been evicted while caching the collection.
+    if (collection.size() <= max_size_) {
+        markComplete(complete_hwaddrs_, hwaddr.hwaddr_, max_size_);
+    }
+    return (collection);
+}
+
+Lease4Ptr
+CachedLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
+    Lease4Ptr lease;
+    if (findLease(hwaddr.hwaddr_, subnet_id, lease)) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+                  DHCPSRV_LEASE_CACHE_HIT).arg(hwaddr.toText());
+        return (lease);
+    }
+
+    lease = backend_->getLease4(hwaddr, subnet_id);
+    storeLookup(hwaddr.hwaddr_, subnet_id, lease);
+    return (lease);
+}
+
+Lease4Collection
+CachedLeaseMgr::getLease4(const ClientId& clientid) const {
+    Lease4Collection collection;
+    if (complete_clientids_.count(clientid.getClientId()) > 0) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+                  DHCPSRV_LEASE_CACHE_HIT).arg(clientid.toText());
+        const Lease4Cache::index<ClientIdSubnetIdIndexTag>::type& idx =
+            leases_.get<ClientIdSubnetIdIndexTag>();
+        std::pair<Lease4Cache::index<ClientIdSubnetIdIndexTag>::type::const_iterator,
+                  Lease4Cache::index<ClientIdSubnetIdIndexTag>::type::const_iterator> l =
+            idx.equal_range(boost::make_tuple(clientid.getClientId()));
+        for (; l.first != l.second; ++l.first) {
+            collection.push_back(copyLease(*l.first));
+        }
+        return (collection);
+    }
+
+    collection = backend_->getLease4(clientid);
+    for (Lease4Collection::const_iterator lease = collection.begin();
+         lease != collection.end(); ++lease) {
+        cacheLease(*lease);
+    }
+    if (collection.size() <= max_size_) {
+        markComplete(complete_clientids_, clientid.getClientId(), max_size_);
+    }
+    return (collection);
+}
+
+Lease4Ptr
+CachedLeaseMgr::getLease4(const ClientId& clientid, const HWAddr& hwaddr,
+                          SubnetID subnet_id) const {
+    if ((complete_clientids_.count(clientid.getClientId()) > 0) ||
+        (complete_clientid_subnets_.count(KeySubnet(clientid.getClientId(),
+                                                    subnet_id)) > 0)) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+                  DHCPSRV_LEASE_CACHE_HIT).arg(clientid.toText());
+        const Lease4Cache::index<ClientIdSubnetIdIndexTag>::type& idx =
+            leases_.get<ClientIdSubnetIdIndexTag>();
+        std::pair<Lease4Cache::index<ClientIdSubnetIdIndexTag>::type::const_iterator,
+                  Lease4Cache::index<ClientIdSubnetIdIndexTag>::type::const_iterator> l =
+            idx.equal_range(boost::make_tuple(clientid.getClientId(), subnet_id));
+        for (; l.first != l.second; ++l.first) {
+            if ((*l.first)->getHWAddrVector() == hwaddr.hwaddr_) {
+                return (copyLease(*l.first));
+            }
+        }
+        return (Lease4Ptr());
+    }
+
+    Lease4Ptr lease = backend_->getLease4(clientid, hwaddr, subnet_id);
+    if (lease) {
+        cacheLease(lease);
+    }
+    return (lease);
+}
+
+Lease4Ptr
+CachedLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
+    Lease4Ptr lease;
+    if (findLeaseByClientId(clientid.getClientId(), subnet_id, lease)) {
+        LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+                  DHCPSRV_LEASE_CACHE_HIT).arg(clientid.toText());
+        return (lease);
+    }
+
+    lease = backend_->getLease4(clientid, subnet_id);
+    storeLookupByClientId(clientid.getClientId(), subnet_id, lease);
+    return (lease);
+}
+
+void
+CachedLeaseMgr::asyncGetLease4(const IOAddress& addr,
+                               const Lease4Handler& handler) {
+    Lease4Ptr lease;
+    if (findLease(addr, lease)) {
+        handler(lease, "");
+        return;
+    }
+    backend_->asyncGetLease4(addr, boost::bind(&CachedLeaseMgr::
+                                               asyncAddressFetched,
+                                               this, addr, handler, _1, _2));
+}
+
+void
+CachedLeaseMgr::asyncGetLease4(const HWAddr& hwaddr, SubnetID subnet_id,
+                               const Lease4Handler& handler) {
+    Lease4Ptr lease;
+    if (findLease(hwaddr.hwaddr_, subnet_id, lease)) {
+        handler(lease, "");
+        return;
+    }
+    backend_->asyncGetLease4(hwaddr, subnet_id,
+                             boost::bind(&CachedLeaseMgr::asyncHWAddrFetched,
+                                         this, hwaddr.hwaddr_, subnet_id,
+                                         handler, _1, _2));
+}
+
+void
+CachedLeaseMgr::asyncGetLease4(const ClientId& clientid, SubnetID subnet_id,
+                               const Lease4Handler& handler) {
+    Lease4Ptr lease;
+    if (findLeaseByClientId(clientid.getClientId(), subnet_id, lease)) {
+        handler(lease, "");
+        return;
+    }
+    backend_->asyncGetLease4(clientid, subnet_id,
+                             boost::bind(&CachedLeaseMgr::asyncClientIdFetched,
+                                         this, clientid.getClientId(),
+                                         subnet_id, handler, _1, _2));
+}
+
+size_t
+CachedLeaseMgr::getAsyncPending() const {
+    return (backend_->getAsyncPending());
+}
+
+Lease6Ptr
+CachedLeaseMgr::getLease6(Lease::Type type, const IOAddress& addr) const {
+    return (backend_->getLease6(type, addr));
+}
+
+Lease6Collection
+CachedLeaseMgr::getLeases6(Lease::Type type, const DUID& duid,
+                           uint32_t iaid) const {
+    return (backend_->getLeases6(type, duid, iaid));
+}
+
+Lease6Collection
+CachedLeaseMgr::getLeases6(Lease::Type type, const DUID& duid,
+                           uint32_t iaid, SubnetID subnet_id) const {
+    return (backend_->getLeases6(type, duid, iaid, subnet_id));
+}
+
+void
+CachedLeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
+                                  const size_t max_leases) const {
+    backend_->getExpiredLeases6(expired_leases, max_leases);
+}
+
+void
+CachedLeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
+                                  const size_t max_leases) const {
+    backend_->getExpiredLeases4(expired_leases, max_leases);
+}
+
+void
+CachedLeaseMgr::getNextExpiredLeases6(Lease6Collection& expired_leases,
+                                      const size_t max_leases,
+                                      const int64_t last_expire,
+                                      const isc::asiolink::IOAddress& last_address) const {
+    backend_->getNextExpiredLeases6(expired_leases, max_leases, last_expire,
+                                    last_address);
+}
+
+void
+CachedLeaseMgr::getNextExpiredLeases4(Lease4Collection& expired_leases,
+                                      const size_t max_leases,
+                                      const int64_t last_expire,
+                                      const isc::asiolink::IOAddress& last_address) const {
+    backend_->getNextExpiredLeases4(expired_leases, max_leases, last_expire,
+                                    last_address);
+}
+
+Lease4Collection
+CachedLeaseMgr::getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                               const isc::asiolink::IOAddress& upper_bound_address,
+                               const SubnetID& subnet_id,
+                               const size_t page_size) const {
+    return (backend_->getLeases4Page(lower_bound_address, upper_bound_address,
+                                     subnet_id, page_size));
+}
+
+Lease6Collection
+CachedLeaseMgr::getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                               const SubnetID& subnet_id,
+                               const size_t page_size) const {
+    return (backend_->getLeases6Page(lower_bound_address, subnet_id, page_size));
+}
+
+void
+CachedLeaseMgr::updateLease4(const Lease4Ptr& lease4) {
+    try {
+        backend_->updateLease4(lease4);
+
+    } catch (...) {
+        // The state of the lease in the database is unknown.
+        uncacheLease(lease4->addr_);
+        forgetLookups(*lease4);
+        throw;
+    }
+    cacheLease(lease4);
+}
+
+void
+CachedLeaseMgr::updateLease6(const Lease6Ptr& lease6) {
+    backend_->updateLease6(lease6);
+}
+
+bool
+CachedLeaseMgr::deleteLease(const IOAddress& addr) {
+    if (!addr.isV4()) {
+        return (backend_->deleteLease(addr));
+    }
+
+    bool deleted = false;
+    try {
+        deleted = backend_->deleteLease(addr);
+
+    } catch (...) {
+        uncacheLease(addr);
+        throw;
+    }
+    uncacheLease(addr);
+    markComplete(free_addresses_, addr, max_size_);
+    return (deleted);
+}
+
+void
+CachedLeaseMgr::updateLeases4(const Lease4Collection& leases) {
+    try {
+        backend_->updateLeases4(leases);
+
+    } catch (...) {
+        for (Lease4Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            uncacheLease((*lease)->addr_);
+            forgetLookups(**lease);
+        }
+        throw;
+    }
+
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        cacheLease(*lease);
+    }
+}
+
+uint64_t
+CachedLeaseMgr::deleteLeases4(const std::vector<IOAddress>& addrs) {
+    uint64_t deleted = 0;
+    try {
+        deleted = backend_->deleteLeases4(addrs);
+
+    } catch (...) {
+        for (std::vector<IOAddress>::const_iterator addr = addrs.begin();
+             addr != addrs.end(); ++addr) {
+            uncacheLease(*addr);
+        }
+        throw;
+    }
+
+    for (std::vector<IOAddress>::const_iterator addr = addrs.begin();
+         addr != addrs.end(); ++addr) {
+        uncacheLease(*addr);
+        markComplete(free_addresses_, *addr, max_size_);
+    }
+    return (deleted);
+}
+
+Lease4Collection
+CachedLeaseMgr::storeLeases4(const Lease4Collection& leases) {
+    Lease4Collection replaced;
+    try {
+        replaced = backend_->storeLeases4(leases);
+
+    } catch (...) {
+        for (Lease4Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            uncacheLease((*lease)->addr_);
+            forgetLookups(**lease);
+        }
+        throw;
+    }
+
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        cacheLease(*lease);
+    }
+    return (replaced);
+}
+
+uint64_t
+CachedLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
+    uint64_t deleted = backend_->deleteExpiredReclaimedLeases4(secs);
+    if (deleted > 0) {
+        flush();
+    }
+    return (deleted);
+}
+
+uint64_t
+CachedLeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
+    return (backend_->deleteExpiredReclaimedLeases6(secs));
+}
+
+LeaseStatsQueryPtr
+CachedLeaseMgr::startLeaseStatsQuery4() {
+    return (backend_->startLeaseStatsQuery4());
+}
+
+LeaseStatsQueryPtr
+CachedLeaseMgr::startLeaseStatsQuery6() {
+    return (backend_->startLeaseStatsQuery6());
+}
+
+bool
+CachedLeaseMgr::reconfigure(const DatabaseConnection::ParameterMap& parameters,
+                            const std::set<std::string>& changed) {
+    return (backend_->reconfigure(parameters, changed));
+}
+
+std::string
+CachedLeaseMgr::getType() const {
+    return (backend_->getType());
+}
+
+std::string
+CachedLeaseMgr::getName() const {
+    return (backend_->getName());
+}
+
+std::string
+CachedLeaseMgr::getDescription() const {
+    return (backend_->getDescription() + " (cached)");
+}
+
+std::pair<uint32_t, uint32_t>
+CachedLeaseMgr::getVersion() const {
+    return (backend_->getVersion());
+}
+
+void
+CachedLeaseMgr::commit() {
+    backend_->commit();
+}
+
+void
+CachedLeaseMgr::rollback() {
+    backend_->rollback();
+    flush();
+}
+
+void
+CachedLeaseMgr::flush() {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_LEASE_CACHE_FLUSH)
+        .arg(leases_.size());
+    leases_.clear();
+    free_addresses_.clear();
+    complete_hwaddrs_.clear();
+    complete_clientids_.clear();
+    complete_hwaddr_subnets_.clear();
+    complete_clientid_subnets_.clear();
+}
+
+bool
+CachedLeaseMgr::findLease(const IOAddress& addr, Lease4Ptr& lease) const {
+    Lease4Cache::index<AddressIndexTag>::type& idx =
+        leases_.get<AddressIndexTag>();
+    Lease4Cache::index<AddressIndexTag>::type::iterator l = idx.find(addr);
+    if (l != idx.end()) {
+        touchLease(l);
+        lease = copyLease(*l);
+        return (true);
+    }
+    lease.reset();
+    return (free_addresses_.count(addr) > 0);
+}
+
+bool
+CachedLeaseMgr::findLease(const std::vector<uint8_t>& hwaddr,
+                          SubnetID subnet_id, Lease4Ptr& lease) const {
+    lease.reset();
+    if ((complete_hwaddrs_.count(hwaddr) == 0) &&
+        (complete_hwaddr_subnets_.count(KeySubnet(hwaddr, subnet_id)) == 0)) {
+        return (false);
+    }
+
+    const Lease4Cache::index<HWAddressSubnetIdIndexTag>::type& idx =
+        leases_.get<HWAddressSubnetIdIndexTag>();
+    Lease4Cache::index<HWAddressSubnetIdIndexTag>::type::const_iterator l =
+        idx.find(boost::make_tuple(hwaddr, subnet_id));
+    if (l != idx.end()) {
+        touchLease(leases_.project<AddressIndexTag>(l));
+        lease = copyLease(*l);
+    }
+    return (true);
+}
+
+bool
+CachedLeaseMgr::findLeaseByClientId(const std::vector<uint8_t>& clientid,
+                                    SubnetID subnet_id, Lease4Ptr& lease) const {
+    lease.reset();
+    if ((complete_clientids_.count(clientid) == 0) &&
+        (complete_clientid_subnets_.count(KeySubnet(clientid, subnet_id)) == 0)) {
+        return (false);
+    }
+
+    const Lease4Cache::index<ClientIdSubnetIdIndexTag>::type& idx =
+        leases_.get<ClientIdSubnetIdIndexTag>();
+    Lease4Cache::index<ClientIdSubnetIdIndexTag>::type::const_iterator l =
+        idx.find(boost::make_tuple(clientid, subnet_id));
+    if (l != idx.end()) {
+        touchLease(leases_.project<AddressIndexTag>(l));
+        lease = copyLease(*l);
+    }
+    return (true);
+}
+
+void
+CachedLeaseMgr::storeLookup(const IOAddress& addr, const Lease4Ptr& lease) const {
+    if (lease) {
+        cacheLease(lease);
+
+    } else {
+        markComplete(free_addresses_, addr, max_size_);
+    }
+}
+
+void
+CachedLeaseMgr::storeLookup(const std::vector<uint8_t>& hwaddr,
+                            SubnetID subnet_id, const Lease4Ptr& lease) const {
+    if (lease) {
+        cacheLease(lease);
+    }
+    markComplete(complete_hwaddr_subnets_, KeySubnet(hwaddr, subnet_id),
+                 max_size_);
+}
+
+void
+CachedLeaseMgr::storeLookupByClientId(const std::vector<uint8_t>& clientid,
+                                      SubnetID subnet_id,
+                                      const Lease4Ptr& lease) const {
+    if (lease) {
+        cacheLease(lease);
+    }
+    markComplete(complete_clientid_subnets_, KeySubnet(clientid, subnet_id),
+                 max_size_);
+}
+
+void
+CachedLeaseMgr::asyncAddressFetched(const IOAddress& addr,
+                                    const Lease4Handler& handler,
+                                    const Lease4Ptr& lease,
+                                    const std::string& error) {
+    if (error.empty()) {
+        storeLookup(addr, lease);
+    }
+    handler(lease, error);
+}
+
+void
+CachedLeaseMgr::asyncHWAddrFetched(const std::vector<uint8_t>& hwaddr,
+                                   SubnetID subnet_id,
+                                   const Lease4Handler& handler,
+                                   const Lease4Ptr& lease,
+                                   const std::string& error) {
+    if (error.empty()) {
+        storeLookup(hwaddr, subnet_id, lease);
+    }
+    handler(lease, error);
+}
+
+void
+CachedLeaseMgr::asyncClientIdFetched(const std::vector<uint8_t>& clientid,
+                                     SubnetID subnet_id,
+                                     const Lease4Handler& handler,
+                                     const Lease4Ptr& lease,
+                                     const std::string& error) {
+    if (error.empty()) {
+        storeLookupByClientId(clientid, subnet_id, lease);
+    }
+    handler(lease, error);
+}
+
+void
+CachedLeaseMgr::cacheLease(const Lease4Ptr& lease) const {
+    Lease4Ptr copy = copyLease(lease);
+    free_addresses_.erase(copy->addr_);
+
+    Lease4Cache::index<AddressIndexTag>::type& idx =
+        leases_.get<AddressIndexTag>();
+    Lease4Cache::index<AddressIndexTag>::type::iterator l =
+        idx.find(copy->addr_);
+    if (l != idx.end()) {
+        idx.replace(l, copy);
+        touchLease(l);
+        return;
+    }
+
+    leases_.get<LruIndexTag>().push_front(copy);
+
+    // Evict the least recently used leases. The lookups which returned
+    // the evicted lease are no longer complete.
+    Lease4Cache::index<LruIndexTag>::type& lru = leases_.get<LruIndexTag>();
+    while (lru.size() > max_size_) {
+        Lease4Ptr evicted = lru.back();
+        lru.pop_back();
+        forgetLookups(*evicted);
+    }
+}
+
+void
+CachedLeaseMgr::uncacheLease(const IOAddress& addr) const {
+    free_addresses_.erase(addr);
+
+    Lease4Cache::index<AddressIndexTag>::type& idx =
+        leases_.get<AddressIndexTag>();
+    Lease4Cache::index<AddressIndexTag>::type::iterator l = idx.find(addr);
+    if (l != idx.end()) {
+        Lease4Ptr lease = *l;
+        idx.erase(l);
+        forgetLookups(*lease);
+    }
+}
+
+void
+CachedLeaseMgr::forgetLookups(const Lease4& lease) const {
+    complete_hwaddrs_.erase(lease.getHWAddrVector());
+    complete_clientids_.erase(lease.getClientIdVector());
+    complete_hwaddr_subnets_.erase(KeySubnet(lease.getHWAddrVector(),
+                                             lease.subnet_id_));
+    complete_clientid_subnets_.erase(KeySubnet(lease.getClientIdVector(),
+                                               lease.subnet_id_));
+}
+
+void
+CachedLeaseMgr::touchLease(const Lease4Cache::index<AddressIndexTag>::type::iterator& it) const {
+    Lease4Cache::index<LruIndexTag>::type& lru = leases_.get<LruIndexTag>();
+    lru.relocate(lru.begin(), leases_.project<LruIndexTag>(it));
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,589 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef CACHED_LEASE_MGR_H
+#define CACHED_LEASE_MGR_H
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/lease_mgr.h>
+#include <dhcpsrv/memfile_lease_storage.h>
+
+#include <boost/multi_index/composite_key.hpp>
+#include <boost/multi_index/indexed_by.hpp>
+#include <boost/multi_index/mem_fun.hpp>
+#include <boost/multi_index/member.hpp>
+#include <boost/multi_index/ordered_index.hpp>
+#include <boost/multi_index/sequenced_index.hpp>
+#include <boost/multi_index_container.hpp>
+#include <boost/scoped_ptr.hpp>
+
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Tag for the index ordering the cached leases by their use.
+struct LruIndexTag { };
+
+/// @brief A multi index container holding cached DHCPv4 leases.
+///
+/// The leases are indexed in the same way as in the @c Lease4Storage,
+/// so as the lookups used during the packet processing can be served
+/// from the cache. The additional sequenced index keeps the leases in
+/// the order of their use: the most recently used lease is at the front
+/// and the least recently used lease is evicted from the back.
+typedef boost::multi_index_container<
+    Lease4Ptr,
+    boost::multi_index::indexed_by<
+        // The first index orders the leases by their use.
+        boost::multi_index::sequenced<
+            boost::multi_index::tag<LruIndexTag>
+        >,
+
+        // The second index sorts leases by IPv4 addresses.
+        boost::multi_index::ordered_unique<
+            boost::multi_index::tag<AddressIndexTag>,
+            boost::multi_index::member<Lease, isc::asiolink::IOAddress,
+                                       &Lease::addr_>
+        >,
+
+        // The third index searches leases by hardware address and subnet
+        // id. It is also used to search by hardware address only.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<HWAddressSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                Lease4,
+                boost::multi_index::const_mem_fun<Lease, const std::vector<uint8_t>&,
+                                                  &Lease::getHWAddrVector>,
+                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>
+            >
+        >,
+
+        // The fourth index searches leases by client id and subnet id.
+        // It is also used to search by client id only.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ClientIdSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                Lease4,
+                boost::multi_index::const_mem_fun<Lease4, const std::vector<uint8_t>&,
+                                                  &Lease4::getClientIdVector>,
+                boost::multi_index::member<Lease, SubnetID, &Lease::subnet_id_>
+            >
+        >
+    >
+> Lease4Cache;
+
+/// @brief Lease manager caching DHCPv4 leases in front of another
+/// lease manager.
+///
+/// The server looks up the same client's lease several times while
+/// processing a single packet, and again when processing the next packet
+/// of the same exchange. With the SQL backends each lookup is a separate
+/// query. This lease manager keeps the recently used DHCPv4 leases in
+/// memory and serves these lookups without querying the database.
+///
+/// All modifications are written through to the underlying lease manager
+/// before the cache is updated, so the cache never holds a lease which
+/// the database has rejected. Besides the leases, the cache remembers the
+/// lookups for which the complete result is known, including the lookups
+/// which returned no lease. This allows for answering the lookups for
+/// new clients without querying the database.
+///
+/// The cache is only correct if all modifications of the leases go
+/// through this lease manager, i.e. when a single server owns the lease
+/// database. It must not be used when multiple servers share the
+/// database.
+///
+/// The number of cached leases is bounded. The least recently used lease
+/// is evicted when the limit is exceeded. The leases are copied when they
+/// are stored in and returned from the cache, so as the callers can't
+/// modify the cached leases.
+///
+/// The DHCPv6 leases are not cached.
+class CachedLeaseMgr : public LeaseMgr {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param backend Lease manager holding the leases. The cache takes
+    /// ownership of this object.
+    /// @param max_size Maximum number of cached leases.
+    ///
+    /// @throw BadValue if the backend is null or the maximum number of
+    /// leases is 0.
+    CachedLeaseMgr(LeaseMgr* backend, const size_t max_size);
+
+    /// @brief Destructor.
+    virtual ~CachedLeaseMgr();
+
+    /// @brief Adds an IPv4 lease.
+    ///
+    /// @param lease lease to be added
+    virtual bool addLease(const Lease4Ptr& lease);
+
+    /// @brief Adds an IPv6 lease.
+    ///
+    /// @param lease lease to be added
+    virtual bool addLease(const Lease6Ptr& lease);
+
+    /// @brief Returns existing IPv4 lease for specified IPv4 address.
+    ///
+    /// @param addr address of the searched lease
+    ///
+    /// @return a copy of the lease or NULL if the lease doesn't exist.
+    virtual Lease4Ptr getLease4(const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Returns existing IPv4 leases for specified hardware address.
+    ///
+    /// @param hwaddr hardware address of the client
+    ///
+    /// @return lease collection
+    virtual Lease4Collection getLease4(const isc::dhcp::HWAddr& hwaddr) const;
+
+    /// @brief Returns existing IPv4 lease for specified hardware address
+    /// and a subnet.
+    ///
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    ///
+    /// @return a copy of the lease or NULL if the lease doesn't exist.
+    virtual Lease4Ptr getLease4(const isc::dhcp::HWAddr& hwaddr,
+                                SubnetID subnet_id) const;
+
+    /// @brief Returns existing IPv4 leases for specified client-id.
+    ///
+    /// @param clientid client identifier
+    ///
+    /// @return lease collection
+    virtual Lease4Collection getLease4(const ClientId& clientid) const;
+
+    /// @brief Returns IPv4 lease for specified client-id, hardware address
+    /// and subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    ///
+    /// @return a copy of the lease or NULL if the lease doesn't exist.
+    virtual Lease4Ptr getLease4(const ClientId& clientid, const HWAddr& hwaddr,
+                                SubnetID subnet_id) const;
+
+    /// @brief Returns existing IPv4 lease for specified client-id and
+    /// a subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    ///
+    /// @return a copy of the lease or NULL if the lease doesn't exist.
+    virtual Lease4Ptr getLease4(const ClientId& clientid,
+                                SubnetID subnet_id) const;
+
+    /// @brief Asynchronously returns an IPv4 lease for specified IPv4
+    /// address.
+    ///
+    /// The handler is invoked immediately if the result is cached.
+    /// Otherwise, the lookup is forwarded to the underlying lease manager.
+    ///
+    /// @param addr address of the searched lease
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                                const Lease4Handler& handler);
+
+    /// @brief Asynchronously returns an IPv4 lease for specified hardware
+    /// address and a subnet.
+    ///
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const isc::dhcp::HWAddr& hwaddr,
+                                SubnetID subnet_id,
+                                const Lease4Handler& handler);
+
+    /// @brief Asynchronously returns an IPv4 lease for specified client-id
+    /// and a subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const ClientId& clientid,
+                                SubnetID subnet_id,
+                                const Lease4Handler& handler);
+
+    /// @brief Returns the number of asynchronous lookups in progress.
+    virtual size_t getAsyncPending() const;
+
+    /// @brief Returns existing IPv6 lease for a given IPv6 address.
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param addr address of the searched lease
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual Lease6Ptr getLease6(Lease::Type type,
+                                const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Returns existing IPv6 leases for a given DUID+IA combination
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param duid client DUID
+    /// @param iaid IA identifier
+    ///
+    /// @return collection of IPv6 leases
+    virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
+                                        uint32_t iaid) const;
+
+    /// @brief Returns existing IPv6 leases for a given DUID+IA combination
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param duid client DUID
+    /// @param iaid IA identifier
+    /// @param subnet_id subnet id of the subnet the lease belongs to
+    ///
+    /// @return collection of IPv6 leases
+    virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
+                                        uint32_t iaid, SubnetID subnet_id) const;
+
+    /// @brief Returns a collection of expired DHCPv6 leases.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the underlying lease manager are appended.
+    /// @param max_leases A maximum number of leases to be returned.
+    virtual void getExpiredLeases6(Lease6Collection& expired_leases,
+                                   const size_t max_leases) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases.
+    ///
+    /// The expired leases are always fetched from the underlying lease
+    /// manager.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the underlying lease manager are appended.
+    /// @param max_leases A maximum number of leases to be returned.
+    virtual void getExpiredLeases4(Lease4Collection& expired_leases,
+                                   const size_t max_leases) const;
+
+    /// @brief Returns a collection of expired DHCPv6 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The expired leases are always fetched from the underlying lease
+    /// manager.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the underlying lease manager are appended.
+    /// @param max_leases A maximum number of leases to be returned.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases6(Lease6Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The expired leases are always fetched from the underlying lease
+    /// manager.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the underlying lease manager are appended.
+    /// @param max_leases A maximum number of leases to be returned.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases4(Lease4Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a page of IPv4 leases ordered by address.
+    ///
+    /// The pages are always fetched from the underlying lease manager.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses greater than this address.
+    /// @param upper_bound_address The page includes the leases with the
+    /// addresses lower than or equal to this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    virtual Lease4Collection
+    getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const isc::asiolink::IOAddress& upper_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Returns a page of IPv6 leases ordered by address.
+    ///
+    /// @param lower_bound_address The page includes the leases following
+    /// this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    virtual Lease6Collection
+    getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Updates IPv4 lease.
+    ///
+    /// @param lease4 The lease to be updated.
+    virtual void updateLease4(const Lease4Ptr& lease4);
+
+    /// @brief Updates IPv6 lease.
+    ///
+    /// @param lease6 The lease to be updated.
+    virtual void updateLease6(const Lease6Ptr& lease6);
+
+    /// @brief Deletes a lease.
+    ///
+    /// @param addr Address of the lease to be deleted.
+    ///
+    /// @return true if deletion was successful, false if no such lease
+    /// exists
+    virtual bool deleteLease(const isc::asiolink::IOAddress& addr);
+
+    /// @brief Updates multiple IPv4 leases.
+    ///
+    /// @param leases Collection of leases to be updated.
+    virtual void updateLeases4(const Lease4Collection& leases);
+
+    /// @brief Deletes multiple IPv4 leases.
+    ///
+    /// @param addrs Addresses of the leases to be deleted.
+    ///
+    /// @return Number of deleted leases.
+    virtual uint64_t
+    deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs);
+
+    /// @brief Stores multiple IPv4 leases.
+    ///
+    /// @param leases Collection of leases to be stored.
+    ///
+    /// @return Leases replaced by the stored ones.
+    virtual Lease4Collection storeLeases4(const Lease4Collection& leases);
+
+    /// @brief Deletes all expired and reclaimed DHCPv4 leases.
+    ///
+    /// The leases are deleted by the underlying lease manager which
+    /// doesn't report which leases have been deleted, so the whole cache
+    /// is flushed.
+    ///
+    /// @param secs Number of seconds since expiration of leases before
+    /// they can be removed.
+    ///
+    /// @return Number of leases deleted.
+    virtual uint64_t deleteExpiredReclaimedLeases4(const uint32_t secs);
+
+    /// @brief Deletes all expired and reclaimed DHCPv6 leases.
+    ///
+    /// @param secs Number of seconds since expiration of leases before
+    /// they can be removed.
+    ///
+    /// @return Number of leases deleted.
+    virtual uint64_t deleteExpiredReclaimedLeases6(const uint32_t secs);
+
+    /// @brief Creates and runs the IPv4 lease stats query.
+    virtual LeaseStatsQueryPtr startLeaseStatsQuery4();
+
+    /// @brief Creates and runs the IPv6 lease stats query.
+    virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
+
+    /// @brief Reconfigures the underlying lease manager.
+    ///
+    /// A change of the "cache-size" parameter is rejected by the
+    /// underlying lease manager, so as the cache is recreated.
+    virtual bool
+    reconfigure(const DatabaseConnection::ParameterMap& parameters,
+                const std::set<std::string>& changed);
+
+    /// @brief Returns backend type of the underlying lease manager.
+    virtual std::string getType() const;
+
+    /// @brief Returns backend name of the underlying lease manager.
+    virtual std::string getName() const;
+
+    /// @brief Returns description of the underlying lease manager.
+    virtual std::string getDescription() const;
+
+    /// @brief Returns backend version of the underlying lease manager.
+    virtual std::pair<uint32_t, uint32_t> getVersion() const;
+
+    /// @brief Commits all pending database operations.
+    virtual void commit();
+
+    /// @brief Rolls back all pending database operations.
+    ///
+    /// The cache may hold the leases modified by the rolled back
+    /// operations, so it is flushed.
+    virtual void rollback();
+
+    /// @brief Removes all leases and lookup results from the cache.
+    void flush();
+
+    /// @brief Returns the number of cached leases.
+    size_t getCachedLeasesCount() const {
+        return (leases_.size());
+    }
+
+    /// @brief Returns the maximum number of cached leases.
+    size_t getMaxSize() const {
+        return (max_size_);
+    }
+
+    /// @brief Returns the underlying lease manager.
+    LeaseMgr& getBackend() const {
+        return (*backend_);
+    }
+
+private:
+
+    /// @brief Binary key combined with the subnet identifier.
+    typedef std::pair<std::vector<uint8_t>, SubnetID> KeySubnet;
+
+    /// @brief Looks up the cached lease by address.
+    ///
+    /// @param addr address of the searched lease
+    /// @param [out] lease the cached lease, if found.
+    ///
+    /// @return true if the result of the lookup is known, false if the
+    /// underlying lease manager should be queried.
+    bool findLease(const isc::asiolink::IOAddress& addr,
+                   Lease4Ptr& lease) const;
+
+    /// @brief Looks up the cached lease by hardware address and subnet.
+    ///
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param [out] lease the cached lease, if found.
+    ///
+    /// @return true if the result of the lookup is known, false if the
+    /// underlying lease manager should be queried.
+    bool findLease(const std::vector<uint8_t>& hwaddr, SubnetID subnet_id,
+                   Lease4Ptr& lease) const;
+
+    /// @brief Looks up the cached lease by client id and subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param [out] lease the cached lease, if found.
+    ///
+    /// @return true if the result of the lookup is known, false if the
+    /// underlying lease manager should be queried.
+    bool findLeaseByClientId(const std::vector<uint8_t>& clientid,
+                             SubnetID subnet_id, Lease4Ptr& lease) const;
+
+    /// @brief Stores the lease returned by the lookup by address.
+    ///
+    /// @param addr address of the searched lease
+    /// @param lease lease returned by the underlying lease manager
+    void storeLookup(const isc::asiolink::IOAddress& addr,
+                     const Lease4Ptr& lease) const;
+
+    /// @brief Stores the lease returned by the lookup by hardware address
+    /// and subnet.
+    ///
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param lease lease returned by the underlying lease manager
+    void storeLookup(const std::vector<uint8_t>& hwaddr, SubnetID subnet_id,
+                     const Lease4Ptr& lease) const;
+
+    /// @brief Stores the lease returned by the lookup by client id and
+    /// subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param lease lease returned by the underlying lease manager
+    void storeLookupByClientId(const std::vector<uint8_t>& clientid,
+                               SubnetID subnet_id,
+                               const Lease4Ptr& lease) const;
+
+    /// @brief Completes the asynchronous lookup by address.
+    void asyncAddressFetched(const isc::asiolink::IOAddress& addr,
+                             const Lease4Handler& handler,
+                             const Lease4Ptr& lease,
+                             const std::string& error);
+
+    /// @brief Completes the asynchronous lookup by hardware address.
+    void asyncHWAddrFetched(const std::vector<uint8_t>& hwaddr,
+                            SubnetID subnet_id,
+                            const Lease4Handler& handler,
+                            const Lease4Ptr& lease,
+                            const std::string& error);
+
+    /// @brief Completes the asynchronous lookup by client id.
+    void asyncClientIdFetched(const std::vector<uint8_t>& clientid,
+                              SubnetID subnet_id,
+                              const Lease4Handler& handler,
+                              const Lease4Ptr& lease,
+                              const std::string& error);
+
+    /// @brief Inserts a copy of the lease into the cache or replaces the
+    /// cached lease having the same address.
+    ///
+    /// Evicts the least recently used leases if the cache is full.
+    ///
+    /// @param lease lease to be cached
+    void cacheLease(const Lease4Ptr& lease) const;
+
+    /// @brief Removes the lease from the cache.
+    ///
+    /// The lookups which returned the removed lease are no longer
+    /// complete.
+    ///
+    /// @param addr address of the lease to be removed
+    void uncacheLease(const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Forgets the lookups which could return the lease.
+    ///
+    /// @param lease lease which may be missing from the cache
+    void forgetLookups(const Lease4& lease) const;
+
+    /// @brief Moves the lease to the front of the LRU list.
+    ///
+    /// @param it iterator pointing to the lease in the address index
+    void touchLease(const Lease4Cache::index<AddressIndexTag>::type::iterator& it) const;
+
+    /// @brief Underlying lease manager.
+    boost::scoped_ptr<LeaseMgr> backend_;
+
+    /// @brief Maximum number of cached leases.
+    size_t max_size_;
+
+    /// @brief Cached leases.
+    mutable Lease4Cache leases_;
+
+    /// @brief Addresses known not to be leased.
+    mutable std::set<isc::asiolink::IOAddress> free_addresses_;
+
+    /// @brief Hardware addresses for which all leases are cached.
+    mutable std::set<std::vector<uint8_t> > complete_hwaddrs_;
+
+    /// @brief Client ids for which all leases are cached.
+    mutable std::set<std::vector<uint8_t> > complete_clientids_;
+
+    /// @brief Hardware address and subnet pairs for which all leases
+    /// are cached.
+    mutable std::set<KeySubnet> complete_hwaddr_subnets_;
+
+    /// @brief Client id and subnet pairs for which all leases are cached.
+    mutable std::set<KeySubnet> complete_clientid_subnets_;
+};
+
+}; // end of isc::dhcp namespace
+}; // end of isc namespace
+
+#endif // CACHED_LEASE_MGR_H
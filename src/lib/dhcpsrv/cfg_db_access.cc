@@ -8,6 +8,7 @@
 #include <dhcpsrv/cfg_db_access.h>
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/host_mgr.h>
+#include <dhcpsrv/hosts_log.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <boost/algorithm/string.hpp>
 #include <boost/foreach.hpp>
@@ -39,14 +40,25 @@ CfgDbAccess::getHostDbAccessString() const {
 
 void
 CfgDbAccess::createManagers() const {
-    // Recreate lease manager.
-    LeaseMgrFactory::destroy();
-    LeaseMgrFactory::create(getLeaseDbAccessString());
+    // Reconfigure lease manager. It is only recreated if the lease
+    // database access parameters have changed.
+    LeaseMgrFactory::reconfigure(getLeaseDbAccessString());
 
-    // Recreate host data source.
-    HostDataSourceFactory::destroy();
-    if (!host_db_access_.empty()) {
-        HostMgr::create(getHostDbAccessString());
+    // Keep the host data source if it uses the same database. Otherwise,
+    // recreate it.
+    const std::string host_db_access = getHostDbAccessString();
+    if (!host_db_access.empty() &&
+        HostDataSourceFactory::matchesDbAccess(host_db_access) &&
+        (HostMgr::instance().getHostDataSource() ==
+         HostDataSourceFactory::getHostDataSourcePtr())) {
+        LOG_DEBUG(hosts_logger, HOSTS_DBG_TRACE, HOSTS_CFG_KEEP_HOST_DATA_SOURCE)
+            .arg(HostDataSourceFactory::getHostDataSourcePtr()->getType());
+
+    } else {
+        HostDataSourceFactory::destroy();
+        if (!host_db_access.empty()) {
+            HostMgr::create(host_db_access);
+        }
     }
 }
 
@@ -81,7 +93,9 @@ CfgDbAccess::toElementDbAccessString(const std::string& dbaccess) {
             std::string value = token.substr(pos + 1);
             if ((keyword == "lfc-interval") ||
                 (keyword == "connect-timeout") ||
-                (keyword == "port")) {
+                (keyword == "port") ||
+                (keyword == "connection-pool-size") ||
+                (keyword == "cache-size")) {
                 // integer parameters
                 int64_t int_value;
                 try {
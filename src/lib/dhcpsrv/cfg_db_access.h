@@ -62,6 +62,11 @@ public:
 
     /// @brief Creates instance of lease manager and host data source
     /// according to the configuration specified.
+    ///
+    /// The existing lease manager and host data source are kept when
+    /// they use the same databases as specified in the configuration, so
+    /// as the server reconfiguration doesn't reopen the databases or
+    /// reload the memfile lease files. See @c LeaseMgrFactory::reconfigure.
     void createManagers() const;
 
     /// @brief Unparse an access string
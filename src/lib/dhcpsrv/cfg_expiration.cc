@@ -20,6 +20,7 @@ const uint32_t CfgExpiration::DEFAULT_HOLD_RECLAIMED_TIME = 3600;
 const uint32_t CfgExpiration::DEFAULT_MAX_RECLAIM_LEASES = 100;
 const uint16_t CfgExpiration::DEFAULT_MAX_RECLAIM_TIME = 250;
 const uint16_t CfgExpiration::DEFAULT_UNWARNED_RECLAIM_CYCLES = 5;
+const uint32_t CfgExpiration::DEFAULT_REUSE_QUARANTINE_TIME = 0;
 
 // Maximum values.
 const uint16_t CfgExpiration::LIMIT_RECLAIM_TIMER_WAIT_TIME =
@@ -33,6 +34,8 @@ const uint32_t CfgExpiration::LIMIT_MAX_RECLAIM_LEASES =
 const uint16_t CfgExpiration::LIMIT_MAX_RECLAIM_TIME = 10000;
 const uint16_t CfgExpiration::LIMIT_UNWARNED_RECLAIM_CYCLES =
     std::numeric_limits<uint16_t>::max();
+const uint32_t CfgExpiration::LIMIT_REUSE_QUARANTINE_TIME =
+    std::numeric_limits<uint32_t>::max();
 
 // Timers' names
 const std::string CfgExpiration::RECLAIM_EXPIRED_TIMER_NAME =
@@ -48,6 +51,7 @@ CfgExpiration::CfgExpiration(const bool test_mode)
       max_reclaim_leases_(DEFAULT_MAX_RECLAIM_LEASES),
       max_reclaim_time_(DEFAULT_MAX_RECLAIM_TIME),
       unwarned_reclaim_cycles_(DEFAULT_UNWARNED_RECLAIM_CYCLES),
+      reuse_quarantine_time_(DEFAULT_REUSE_QUARANTINE_TIME),
       timer_mgr_(TimerMgr::instance()),
       test_mode_(test_mode) {
 }
@@ -91,6 +95,13 @@ CfgExpiration::setUnwarnedReclaimCycles(const int64_t unwarned_reclaim_cycles) {
     unwarned_reclaim_cycles_ = unwarned_reclaim_cycles;
 }
 
+void
+CfgExpiration::setReuseQuarantineTime(const int64_t reuse_quarantine_time) {
+    rangeCheck(reuse_quarantine_time, LIMIT_REUSE_QUARANTINE_TIME,
+               "reuse-quarantine-time");
+    reuse_quarantine_time_ = reuse_quarantine_time;
+}
+
 void
 CfgExpiration::rangeCheck(const int64_t value, const uint64_t max_value,
                           const std::string& config_parameter_name) const {
@@ -132,6 +143,13 @@ CfgExpiration::toElement() const {
     result->set("unwarned-reclaim-cycles",
                 Element::create(static_cast<long long>
                                 (unwarned_reclaim_cycles_)));
+    // Set reuse-quarantine-time only when it differs from the default,
+    // so as the unparsed default configuration remains unchanged.
+    if (reuse_quarantine_time_ != DEFAULT_REUSE_QUARANTINE_TIME) {
+        result->set("reuse-quarantine-time",
+                    Element::create(static_cast<long long>
+                                    (reuse_quarantine_time_)));
+    }
     return (result);
 }
 
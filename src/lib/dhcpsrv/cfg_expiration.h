@@ -55,6 +55,11 @@ namespace dhcp {
 ///   there are still expired leases in the database. If this value is 0,
 ///   the warning is never issued.
 ///
+/// - reuse-quarantine-time - is the time for which the addresses returned
+///   to the pools by the release or the reclamation are held before the
+///   allocation engine hands them out to other clients ahead of the
+///   remaining free addresses. This value is expressed in seconds.
+///
 /// The @c CfgExpiration class provides a collection of accessors and
 /// modifiers to manage the data. Each accessor checks if the given value
 /// is in range allowed for this value.
@@ -82,6 +87,9 @@ public:
     /// @brief Default value for unwarned-reclaim-cycles.
     static const uint16_t DEFAULT_UNWARNED_RECLAIM_CYCLES;
 
+    /// @brief Default value for reuse-quarantine-time.
+    static const uint32_t DEFAULT_REUSE_QUARANTINE_TIME;
+
     //@}
 
     /// @name Upper limits for the parameters
@@ -105,6 +113,9 @@ public:
     /// @brief Maximum value for unwarned-reclaim-cycles.
     static const uint16_t LIMIT_UNWARNED_RECLAIM_CYCLES;
 
+    /// @brief Maximum value for reuse-quarantine-time.
+    static const uint32_t LIMIT_REUSE_QUARANTINE_TIME;
+
     //@}
 
     /// @name Timers' names
@@ -188,6 +199,16 @@ public:
     /// @param unwarned_reclaim_cycles New value.
     void setUnwarnedReclaimCycles(const int64_t unwarned_reclaim_cycles);
 
+    /// @brief Returns reuse-quarantine-time.
+    uint32_t getReuseQuarantineTime() const {
+        return (reuse_quarantine_time_);
+    }
+
+    /// @brief Sets reuse-quarantine-time.
+    ///
+    /// @param reuse_quarantine_time New value.
+    void setReuseQuarantineTime(const int64_t reuse_quarantine_time);
+
     /// @brief Setup timers for the reclamation of expired leases according
     /// to the configuration parameters.
     ///
@@ -262,6 +283,9 @@ private:
     /// @brief unwarned-reclaim-cycles.
     uint16_t unwarned_reclaim_cycles_;
 
+    /// @brief reuse-quarantine-time.
+    uint32_t reuse_quarantine_time_;
+
     /// @brief Pointer to the instance of the Timer Manager.
     TimerMgrPtr timer_mgr_;
 
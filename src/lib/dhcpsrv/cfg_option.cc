@@ -25,7 +25,8 @@ OptionDescriptor::equals(const OptionDescriptor& other) const {
             option_->equals(other.option_));
 }
 
-CfgOption::CfgOption() {
+CfgOption::CfgOption()
+    : revision_(0) {
 }
 
 bool
@@ -61,6 +62,7 @@ CfgOption::add(const OptionDescriptor& desc, const std::string& option_space) {
     } else {
         options_.addItem(desc, option_space);
     }
+    ++revision_;
 }
 
 std::list<std::string>
@@ -84,6 +86,7 @@ CfgOption::mergeTo(CfgOption& other) const {
     mergeInternal(options_, other.options_);
     // Merge vendor options.
     mergeInternal(vendor_options_, other.vendor_options_);
+    ++other.revision_;
 }
 
 void
@@ -100,6 +103,7 @@ CfgOption::encapsulate() {
     encapsulateInternal(DHCP4_OPTION_SPACE);
     // Append sub-options to the top level "dhcp6" option space.
     encapsulateInternal(DHCP6_OPTION_SPACE);
+    ++revision_;
 }
 
 void
@@ -272,5 +276,70 @@ CfgOption::toElement() const {
     return (result);
 }
 
+CfgOptionListCache::CfgOptionListCache(const size_t max_size)
+    : max_size_(max_size), cache_() {
+    if (max_size_ == 0) {
+        isc_throw(BadValue, "maximum size of the option list cache must"
+                  " be greater than 0");
+    }
+}
+
+void
+CfgOptionListCache::clear() {
+    cache_.clear();
+}
+
+std::string
+CfgOptionListCache::createKey(const CfgOptionList& co_list,
+                              const std::string& option_space) {
+    // The entry holds pointers to the option configurations, so their
+    // addresses uniquely identify them as long as the entry exists.
+    std::string key;
+    key.reserve(co_list.size() * sizeof(const CfgOption*) +
+                option_space.size() + 1);
+    for (CfgOptionList::const_iterator copts = co_list.begin();
+         copts != co_list.end(); ++copts) {
+        const CfgOption* cfg = copts->get();
+        key.append(reinterpret_cast<const char*>(&cfg), sizeof(cfg));
+    }
+    key.append(option_space);
+    key.push_back('\0');
+    return (key);
+}
+
+CfgOptionListCache::Entry&
+CfgOptionListCache::getEntry(const std::string& key,
+                             const CfgOptionList& co_list) {
+    std::map<std::string, Entry>::iterator it = cache_.find(key);
+    if (it != cache_.end()) {
+        Entry& entry = it->second;
+        size_t i = 0;
+        for (CfgOptionList::const_iterator copts = co_list.begin();
+             copts != co_list.end(); ++copts, ++i) {
+            if (entry.revisions_[i] != (*copts)->getRevision()) {
+                entry.revisions_[i] = (*copts)->getRevision();
+                entry.options_.clear();
+                entry.valid_ = false;
+            }
+        }
+        return (entry);
+    }
+
+    // Start over when the cache is full rather than tracking the usage
+    // of the entries. The entries are cheap to re-create.
+    if (cache_.size() >= max_size_) {
+        cache_.clear();
+    }
+
+    Entry& entry = cache_[key];
+    for (CfgOptionList::const_iterator copts = co_list.begin();
+         copts != co_list.end(); ++copts) {
+        entry.cfg_options_.push_back(*copts);
+        entry.revisions_.push_back((*copts)->getRevision());
+    }
+    entry.valid_ = false;
+    return (entry);
+}
+
 } // end of namespace isc::dhcp
 } // end of namespace isc
@@ -16,10 +16,13 @@
 #include <boost/multi_index/sequenced_index.hpp>
 #include <boost/multi_index/mem_fun.hpp>
 #include <boost/multi_index/member.hpp>
+#include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 #include <stdint.h>
 #include <string>
 #include <list>
+#include <map>
+#include <vector>
 
 namespace isc {
 namespace dhcp {
@@ -395,6 +398,17 @@ public:
     /// @return List comprising option space names for vendor options.
     std::list<std::string> getVendorIdsSpaceNames() const;
 
+    /// @brief Returns the revision of the configuration.
+    ///
+    /// The revision is incremented whenever options are added to or
+    /// removed from this object. It allows for detecting that the
+    /// information derived from this configuration is stale.
+    ///
+    /// @return Revision number.
+    uint64_t getRevision() const {
+        return (revision_);
+    }
+
     /// @brief Unparse a configuration object
     ///
     /// @return a pointer to unparsed configuration
@@ -455,6 +469,9 @@ private:
                                  uint32_t> VendorOptionSpaceCollection;
     /// @brief Container holding options grouped by vendor id.
     VendorOptionSpaceCollection vendor_options_;
+
+    /// @brief Revision of the configuration.
+    uint64_t revision_;
 };
 
 /// @name Pointers to the @c CfgOption objects.
@@ -470,6 +487,148 @@ typedef std::list<ConstCfgOptionPtr> CfgOptionList;
 
 //@}
 
+/// @brief Cache of the configured options returned for the requested
+/// option codes.
+///
+/// The server responding to the client walks over the list of the
+/// option configurations (host, subnet, classes, global) for each
+/// option code requested by the client and picks the first configured
+/// option. The clients belonging to the same subnet and classes usually
+/// request the same set of options, so the result of this lookup is
+/// cached and reused for the subsequent responses.
+///
+/// The cached result is keyed by the option configurations in the list,
+/// the option space and the requested codes. The entry holds pointers
+/// to the option configurations, so these are not destroyed while the
+/// entry exists. The entry is discarded and the options are looked up
+/// again when any of the option configurations has been modified since
+/// the entry was created, see @ref CfgOption::getRevision.
+///
+/// The number of entries is limited. When the limit is reached, the
+/// cache is emptied and populated again by the subsequent lookups.
+class CfgOptionListCache : public boost::noncopyable {
+public:
+
+    /// @brief Collection of the options returned by the cache.
+    typedef std::vector<OptionPtr> OptionPtrVector;
+
+    /// @brief Constructor.
+    ///
+    /// @param max_size Maximum number of cached entries.
+    ///
+    /// @throw BadValue if the maximum number of entries is 0.
+    explicit CfgOptionListCache(const size_t max_size = 1024);
+
+    /// @brief Returns configured options for the requested codes.
+    ///
+    /// @param co_list List of the option configurations ordered by
+    /// precedence.
+    /// @param option_space Option space of the requested options.
+    /// @param codes Requested option codes.
+    /// @tparam CodeType Type of the option code: @c uint8_t for DHCPv4
+    /// or @c uint16_t for DHCPv6.
+    ///
+    /// @return Reference to the collection of options in the order in
+    /// which they have been requested. The codes for which no option is
+    /// configured are skipped. The reference is valid until the next
+    /// call to this function or @c clear.
+    template<typename CodeType>
+    const OptionPtrVector& get(const CfgOptionList& co_list,
+                               const std::string& option_space,
+                               const std::vector<CodeType>& codes) {
+        std::string key = createKey(co_list, option_space);
+        if (!codes.empty()) {
+            key.append(reinterpret_cast<const char*>(&codes[0]),
+                       codes.size() * sizeof(CodeType));
+        }
+        Entry& entry = getEntry(key, co_list);
+        if (!entry.valid_) {
+            find(co_list, option_space, codes, entry.options_);
+            entry.valid_ = true;
+        }
+        return (entry.options_);
+    }
+
+    /// @brief Looks up configured options for the requested codes.
+    ///
+    /// This function doesn't use the cache. It is used when the
+    /// option configurations are not worth caching, e.g. they include
+    /// host specific options.
+    ///
+    /// @param co_list List of the option configurations ordered by
+    /// precedence.
+    /// @param option_space Option space of the requested options.
+    /// @param codes Requested option codes.
+    /// @param [out] options Collection to which the options are appended.
+    /// @tparam CodeType Type of the option code.
+    template<typename CodeType>
+    static void find(const CfgOptionList& co_list,
+                     const std::string& option_space,
+                     const std::vector<CodeType>& codes,
+                     OptionPtrVector& options) {
+        for (typename std::vector<CodeType>::const_iterator code =
+                 codes.begin(); code != codes.end(); ++code) {
+            for (CfgOptionList::const_iterator copts = co_list.begin();
+                 copts != co_list.end(); ++copts) {
+                OptionDescriptor desc = (*copts)->get(option_space, *code);
+                if (desc.option_) {
+                    options.push_back(desc.option_);
+                    break;
+                }
+            }
+        }
+    }
+
+    /// @brief Removes all entries from the cache.
+    void clear();
+
+    /// @brief Returns the number of cached entries.
+    size_t getSize() const {
+        return (cache_.size());
+    }
+
+private:
+
+    /// @brief Cached options for a single lookup key.
+    struct Entry {
+        /// @brief Option configurations used to look up the options.
+        std::vector<ConstCfgOptionPtr> cfg_options_;
+        /// @brief Revisions of the option configurations.
+        std::vector<uint64_t> revisions_;
+        /// @brief Options found.
+        OptionPtrVector options_;
+        /// @brief Indicates if the options have been looked up.
+        bool valid_;
+    };
+
+    /// @brief Creates a key for the option configurations and space.
+    ///
+    /// @param co_list List of the option configurations.
+    /// @param option_space Option space name.
+    ///
+    /// @return Key identifying the option configurations and space.
+    static std::string createKey(const CfgOptionList& co_list,
+                                 const std::string& option_space);
+
+    /// @brief Returns the entry for the key.
+    ///
+    /// The entry is created if it doesn't exist. The existing entry is
+    /// invalidated when any of the option configurations has been modified
+    /// since the entry was created.
+    ///
+    /// @param key Key identifying the entry.
+    /// @param co_list List of the option configurations.
+    ///
+    /// @return Reference to the entry.
+    Entry& getEntry(const std::string& key, const CfgOptionList& co_list);
+
+    /// @brief Maximum number of cached entries.
+    size_t max_size_;
+
+    /// @brief Cached entries.
+    std::map<std::string, Entry> cache_;
+};
+
 }
 }
 
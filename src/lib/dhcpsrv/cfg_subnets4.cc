@@ -22,7 +22,7 @@ namespace isc {
 namespace dhcp {
 
 void
-CfgSubnets4::add(const Subnet4Ptr& subnet) {
+CfgSubnets4::add(const Subnet4Ptr& subnet, const ConstElementPtr& config) {
     /// @todo: Check that this new subnet does not cross boundaries of any
     /// other already defined subnet.
     if (isDuplicate(*subnet)) {
@@ -32,6 +32,10 @@ CfgSubnets4::add(const Subnet4Ptr& subnet) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE, DHCPSRV_CFGMGR_ADD_SUBNET4)
               .arg(subnet->toText());
     subnets_.push_back(subnet);
+    subnets_by_id_[subnet->getID()] = subnet;
+    if (config) {
+        subnet_configs_[subnet->getID()] = config;
+    }
 }
 
 Subnet4Ptr
@@ -219,15 +223,29 @@ CfgSubnets4::selectSubnet(const IOAddress& address,
     return (Subnet4Ptr());
 }
 
+Subnet4Ptr
+CfgSubnets4::getSubnet(const SubnetID subnet_id) const {
+    std::map<SubnetID, Subnet4Ptr>::const_iterator subnet =
+        subnets_by_id_.find(subnet_id);
+    if (subnet != subnets_by_id_.end()) {
+        return (subnet->second);
+    }
+    return (Subnet4Ptr());
+}
+
+ConstElementPtr
+CfgSubnets4::getSubnetConfig(const SubnetID subnet_id) const {
+    std::map<SubnetID, ConstElementPtr>::const_iterator config =
+        subnet_configs_.find(subnet_id);
+    if (config != subnet_configs_.end()) {
+        return (config->second);
+    }
+    return (ConstElementPtr());
+}
+
 bool
 CfgSubnets4::isDuplicate(const Subnet4& subnet) const {
-    for (Subnet4Collection::const_iterator subnet_it = subnets_.begin();
-         subnet_it != subnets_.end(); ++subnet_it) {
-        if ((*subnet_it)->getID() == subnet.getID()) {
-            return (true);
-        }
-    }
-    return (false);
+    return (subnets_by_id_.count(subnet.getID()) > 0);
 }
 
 void
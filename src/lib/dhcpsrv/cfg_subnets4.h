@@ -9,9 +9,11 @@
 
 #include <asiolink/io_address.h>
 #include <cc/cfg_to_element.h>
+#include <cc/data.h>
 #include <dhcpsrv/subnet.h>
 #include <dhcpsrv/subnet_selector.h>
 #include <boost/shared_ptr.hpp>
+#include <map>
 
 namespace isc {
 namespace dhcp {
@@ -32,10 +34,14 @@ public:
     /// @brief Adds new subnet to the configuration.
     ///
     /// @param subnet Pointer to the subnet being added.
+    /// @param config Configuration from which the subnet has been created.
+    /// It is compared with the configuration of this subnet during the next
+    /// reconfiguration to determine whether the subnet can be reused.
     ///
     /// @throw isc::DuplicateSubnetID If the subnet id for the new subnet
     /// duplicates id of an existing subnet.
-    void add(const Subnet4Ptr& subnet);
+    void add(const Subnet4Ptr& subnet,
+             const data::ConstElementPtr& config = data::ConstElementPtr());
 
     /// @brief Returns pointer to the collection of all IPv4 subnets.
     ///
@@ -48,6 +54,21 @@ public:
         return (&subnets_);
     }
 
+    /// @brief Returns a pointer to the subnet with the specified identifier.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    ///
+    /// @return Pointer to the subnet or NULL if no such subnet exists.
+    Subnet4Ptr getSubnet(const SubnetID subnet_id) const;
+
+    /// @brief Returns the configuration from which the subnet was created.
+    ///
+    /// @param subnet_id Identifier of the subnet.
+    ///
+    /// @return Pointer to the subnet configuration or NULL if the subnet
+    /// doesn't exist or it has been added without the configuration.
+    data::ConstElementPtr getSubnetConfig(const SubnetID subnet_id) const;
+
     /// @brief Returns a pointer to the selected subnet.
     ///
     /// This method tries to retrieve the subnet for the client using various
@@ -202,6 +223,12 @@ private:
     /// @brief A container for IPv4 subnets.
     Subnet4Collection subnets_;
 
+    /// @brief Index of the subnets by subnet identifier.
+    std::map<SubnetID, Subnet4Ptr> subnets_by_id_;
+
+    /// @brief Configurations of the subnets by subnet identifier.
+    std::map<SubnetID, data::ConstElementPtr> subnet_configs_;
+
 };
 
 /// @name Pointer to the @c CfgSubnets4 objects.
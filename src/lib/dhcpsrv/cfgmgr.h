@@ -198,6 +198,16 @@ public:
     /// current configuration is not set it will create a default configuration
     /// and return it. Current configuration returned is read-only.
     ///
+    /// The returned pointer keeps the configuration alive when a new
+    /// configuration is committed, because the commit only replaces the
+    /// pointer held by the @c CfgMgr. The code which must see the same
+    /// configuration during an operation, e.g. processing of a packet,
+    /// should hold the returned pointer for the duration of this operation.
+    /// This allows for parsing a new configuration into the staging
+    /// configuration in a background thread, while the current
+    /// configuration is used, as long as the commit is performed by the
+    /// thread using the current configuration.
+    ///
     /// @return Non-null const pointer to the current configuration.
     ConstSrvConfigPtr getCurrentCfg();
 
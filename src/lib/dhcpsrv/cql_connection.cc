@@ -114,6 +114,11 @@ CqlConnection::openDatabase() {
     cluster_ = cass_cluster_new();
     cass_cluster_set_contact_points(cluster_, contact_points);
 
+    // Route the statements directly to the replica owning the partition.
+    // The routing key is taken from the partition key of the prepared
+    // statements, so the lookups by address avoid the coordinator hop.
+    cass_cluster_set_token_aware_routing(cluster_, cass_true);
+
     if (user != NULL && password != NULL) {
         cass_cluster_set_credentials(cluster_, user, password);
     }
@@ -173,6 +173,12 @@ static const char* get_lease4_expired_params[] = {
         static_cast<const char*>("expire"),
         static_cast<const char*>("limit"),
         NULL };
+static const char* get_lease4_expired_next_params[] = {
+        static_cast<const char*>("state"),
+        static_cast<const char*>("expire"),
+        static_cast<const char*>("expire"),
+        static_cast<const char*>("limit"),
+        NULL };
 static const char* get_lease6_addr_params[] = {
         static_cast<const char*>("address"),
         static_cast<const char*>("lease_type"),
@@ -193,6 +199,12 @@ static const char* get_lease6_expired_params[] = {
         static_cast<const char*>("expire"),
         static_cast<const char*>("limit"),
         NULL };
+static const char* get_lease6_expired_next_params[] = {
+        static_cast<const char*>("state"),
+        static_cast<const char*>("expire"),
+        static_cast<const char*>("expire"),
+        static_cast<const char*>("limit"),
+        NULL };
 static const char* get_version_params[] = {
         NULL };
 static const char* insert_lease4_params[] = {
@@ -256,6 +268,8 @@ static const char* update_lease6_params[] = {
         static_cast<const char*>("address"),
         NULL };
 
+const size_t CqlLeaseMgr::MAX_STATEMENTS_IN_FLIGHT;
+
 CqlTaggedStatement CqlLeaseMgr::tagged_statements_[] = {
     // DELETE_LEASE4
     { delete_lease4_params,
@@ -348,6 +362,17 @@ CqlTaggedStatement CqlLeaseMgr::tagged_statements_[] = {
       "LIMIT ? "
       "ALLOW FILTERING" },
 
+    // GET_LEASE4_EXPIRE_NEXT
+    { get_lease4_expired_next_params,
+      "get_lease4_expired_next",
+      "SELECT address, hwaddr, client_id, "
+        "valid_lifetime, expire, subnet_id, "
+        "fqdn_fwd, fqdn_rev, hostname, state "
+      "FROM lease4 "
+      "WHERE state = ? AND expire >= ? AND expire < ? "
+      "LIMIT ? "
+      "ALLOW FILTERING" },
+
     // GET_LEASE6_ADDR
     { get_lease6_addr_params,
       "get_lease6_addr",
@@ -393,6 +418,18 @@ CqlTaggedStatement CqlLeaseMgr::tagged_statements_[] = {
       "LIMIT ? "
       "ALLOW FILTERING" },
 
+    // GET_LEASE6_EXPIRE_NEXT
+    { get_lease6_expired_next_params,
+      "get_lease6_expired_next",
+      "SELECT address, duid, valid_lifetime, "
+        "expire, subnet_id, pref_lifetime, "
+        "lease_type, iaid, prefix_len, fqdn_fwd, fqdn_rev, hostname, "
+        "hwaddr, hwtype, hwaddr_source, state "
+      "FROM lease6 "
+      "WHERE state = ? AND expire >= ? AND expire < ? "
+      "LIMIT ? "
+      "ALLOW FILTERING" },
+
     // GET_VERSION
     { get_version_params,
       "get_version",
@@ -1208,30 +1245,49 @@ CqlLeaseMgr::getData(const CassRow* row, const int pindex, CqlDataArray& data,
 bool
 CqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
                               CqlDataArray& data, CqlLeaseExchange& exchange) {
-    CassError rc;
-    CassStatement* statement = NULL;
-    CassFuture* future = NULL;
+    CassFuture* future = executeAsync(stindex, data, exchange);
+    try {
+        return (waitApplied(future, stindex, exchange, "unable to INSERT"));
+    } catch (const DbOperationError&) {
+        return (false);
+    }
+}
 
-    statement = cass_prepared_bind(dbconn_.statements_[stindex]);
+CassFuture*
+CqlLeaseMgr::executeAsync(StatementIndex stindex, CqlDataArray& data,
+                          CqlLeaseExchange& exchange) {
+    CassStatement* statement = cass_prepared_bind(dbconn_.statements_[stindex]);
     if (NULL == statement) {
         isc_throw(DbOperationError, "unable to bind statement");
     }
 
-    CqlLeaseMgr::bindData(statement, stindex, data, exchange);
+    try {
+        CqlLeaseMgr::bindData(statement, stindex, data, exchange);
+    } catch (...) {
+        cass_statement_free(statement);
+        throw;
+    }
 
-    future = cass_session_execute(dbconn_.session_, statement);
+    // The driver copies the statement, so it can be freed while the
+    // statement is executed.
+    CassFuture* future = cass_session_execute(dbconn_.session_, statement);
+    cass_statement_free(statement);
     if (NULL == future) {
-        cass_statement_free(statement);
         isc_throw(DbOperationError, "unable to execute statement");
     }
+    return (future);
+}
+
+bool
+CqlLeaseMgr::waitApplied(CassFuture* future, StatementIndex stindex,
+                         CqlLeaseExchange& exchange, const char* what) {
     cass_future_wait(future);
     std::string error;
-    dbconn_.checkStatementError(error, future, stindex, "unable to INSERT");
-    rc = cass_future_error_code(future);
+    dbconn_.checkStatementError(error, future, stindex, what);
+    CassError rc = cass_future_error_code(future);
     if (rc != CASS_OK) {
         cass_future_free(future);
-        cass_statement_free(statement);
-        return false;
+        isc_throw(DbOperationError, error);
     }
 
     // Check if statement has been applied.
@@ -1240,22 +1296,48 @@ CqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
     CqlDataArray appliedData;
     CqlDataArray appliedSize;
     bool applied = false;
-    while (cass_iterator_next(rows)) {
-        const CassRow* row = cass_iterator_get_row(rows);
-        // [applied]: bool
-        appliedData.add(reinterpret_cast<void*>(&applied));
-        appliedSize.add(NULL);
-        CqlLeaseMgr::getData(row, exchange.parameters_.size() - 1, appliedData,
-                             appliedSize, 0, exchange);
+    try {
+        while (cass_iterator_next(rows)) {
+            const CassRow* row = cass_iterator_get_row(rows);
+            // [applied]: bool
+            appliedData.add(reinterpret_cast<void*>(&applied));
+            appliedSize.add(NULL);
+            CqlLeaseMgr::getData(row, exchange.parameters_.size() - 1,
+                                 appliedData, appliedSize, 0, exchange);
+        }
+    } catch (...) {
+        cass_iterator_free(rows);
+        cass_result_free(resultCollection);
+        cass_future_free(future);
+        throw;
     }
 
     // Free resources.
     cass_iterator_free(rows);
     cass_result_free(resultCollection);
     cass_future_free(future);
-    cass_statement_free(statement);
 
-    return applied;
+    return (applied);
+}
+
+void
+CqlLeaseMgr::waitInflight(std::deque<CassFuture*>& inflight,
+                          const size_t max_inflight, StatementIndex stindex,
+                          CqlLeaseExchange& exchange, const char* what,
+                          uint64_t& applied, std::string& error) {
+    while (inflight.size() > max_inflight) {
+        CassFuture* future = inflight.front();
+        inflight.pop_front();
+        try {
+            if (waitApplied(future, stindex, exchange, what)) {
+                ++applied;
+            }
+        } catch (const std::exception& ex) {
+            if (error.empty()) {
+                error = ex.what();
+            }
+        }
+    }
 }
 
 bool
@@ -1596,6 +1678,67 @@ CqlLeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
     getExpiredLeasesCommon(expired_leases, max_leases, GET_LEASE4_EXPIRE);
 }
 
+void
+CqlLeaseMgr::getNextExpiredLeases6(Lease6Collection& expired_leases,
+                                   const size_t max_leases,
+                                   const int64_t last_expire,
+                                   const isc::asiolink::IOAddress& last_address) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_EXPIRED6)
+        .arg(max_leases);
+
+    // Cassandra doesn't order the rows by expiration time, so all leases
+    // following the position are fetched and the slice is selected here.
+    Lease6Collection candidates;
+    if (last_expire == std::numeric_limits<int64_t>::min()) {
+        getExpiredLeasesCommon(candidates, 0, GET_LEASE6_EXPIRE);
+    } else {
+        getNextExpiredLeasesCommon(candidates, last_expire,
+                                   GET_LEASE6_EXPIRE_NEXT);
+    }
+    selectNextExpiredLeases6(candidates, max_leases, last_expire, last_address,
+                             expired_leases);
+}
+
+void
+CqlLeaseMgr::getNextExpiredLeases4(Lease4Collection& expired_leases,
+                                   const size_t max_leases,
+                                   const int64_t last_expire,
+                                   const isc::asiolink::IOAddress& last_address) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_CQL_GET_EXPIRED4)
+        .arg(max_leases);
+
+    // Cassandra doesn't order the rows by expiration time, so all leases
+    // following the position are fetched and the slice is selected here.
+    Lease4Collection candidates;
+    if (last_expire == std::numeric_limits<int64_t>::min()) {
+        getExpiredLeasesCommon(candidates, 0, GET_LEASE4_EXPIRE);
+    } else {
+        getNextExpiredLeasesCommon(candidates, last_expire,
+                                   GET_LEASE4_EXPIRE_NEXT);
+    }
+    selectNextExpiredLeases4(candidates, max_leases, last_expire, last_address,
+                             expired_leases);
+}
+
+Lease4Collection
+CqlLeaseMgr::getLeases4Page(const isc::asiolink::IOAddress&,
+                            const isc::asiolink::IOAddress&,
+                            const SubnetID&,
+                            const size_t) const {
+    isc_throw(NotImplemented, "getting IPv4 leases in pages is not supported"
+              " by the cql backend, because it does not return the leases"
+              " ordered by address");
+}
+
+Lease6Collection
+CqlLeaseMgr::getLeases6Page(const isc::asiolink::IOAddress&,
+                            const SubnetID&,
+                            const size_t) const {
+    isc_throw(NotImplemented, "getting IPv6 leases in pages is not supported"
+              " by the cql backend, because it does not return the leases"
+              " ordered by address");
+}
+
 template<typename LeaseCollection>
 void
 CqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
@@ -1634,6 +1777,34 @@ CqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     }
 }
 
+template<typename LeaseCollection>
+void
+CqlLeaseMgr::getNextExpiredLeasesCommon(LeaseCollection& expired_leases,
+                                        const int64_t last_expire,
+                                        StatementIndex statement_index) const {
+    // Set up the WHERE clause value
+    uint32_t keepState = Lease::STATE_EXPIRED_RECLAIMED;
+    uint64_t first_expire = static_cast<uint64_t>(last_expire);
+    uint64_t timestamp = static_cast<int64_t>(time(NULL));
+    uint32_t limit = std::numeric_limits<int32_t>::max();
+
+    for (uint32_t state = Lease::STATE_DEFAULT;
+            state <= Lease::STATE_EXPIRED_RECLAIMED; state++) {
+        if (state == keepState) {
+            continue;
+        }
+        CqlDataArray data;
+
+        data.add(&state);
+        data.add(&first_expire);
+        data.add(&timestamp);
+        data.add(&limit);
+
+        // Retrieve leases from the database.
+        getLeaseCollection(statement_index, data, expired_leases);
+    }
+}
+
 template <typename LeasePtr>
 void
 CqlLeaseMgr::updateLeaseCommon(StatementIndex stindex,
@@ -1642,54 +1813,8 @@ CqlLeaseMgr::updateLeaseCommon(StatementIndex stindex,
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_CQL_ADD_ADDR4).arg(dbconn_.tagged_statements_[stindex].name_);
 
-    CassError rc;
-    CassStatement* statement = NULL;
-    CassFuture* future = NULL;
-
-    statement = cass_prepared_bind(dbconn_.statements_[stindex]);
-    if (NULL == statement) {
-        isc_throw(DbOperationError, "unable to bind statement");
-    }
-
-    CqlLeaseMgr::bindData(statement, stindex, data, exchange);
-
-    future = cass_session_execute(dbconn_.session_, statement);
-    if (NULL == future) {
-        cass_statement_free(statement);
-        isc_throw(DbOperationError, "unable to execute statement");
-    }
-    cass_future_wait(future);
-    std::string error;
-    dbconn_.checkStatementError(error, future, stindex, "unable to UPDATE");
-    rc = cass_future_error_code(future);
-    if (rc != CASS_OK) {
-        cass_future_free(future);
-        cass_statement_free(statement);
-        isc_throw(DbOperationError, error);
-    }
-
-    // Check if statement has been applied.
-    const CassResult* resultCollection = cass_future_get_result(future);
-    CassIterator* rows = cass_iterator_from_result(resultCollection);
-    CqlDataArray appliedData;
-    CqlDataArray appliedSize;
-    bool applied = false;
-    while (cass_iterator_next(rows)) {
-        const CassRow* row = cass_iterator_get_row(rows);
-        // [applied]: bool
-        appliedData.add(reinterpret_cast<void*>(&applied));
-        appliedSize.add(NULL);
-        CqlLeaseMgr::getData(row, exchange.parameters_.size() - 1, appliedData,
-                             appliedSize, 0, exchange);
-    }
-
-    // Free resources.
-    cass_iterator_free(rows);
-    cass_result_free(resultCollection);
-    cass_future_free(future);
-    cass_statement_free(statement);
-
-    if (!applied) {
+    CassFuture* future = executeAsync(stindex, data, exchange);
+    if (!waitApplied(future, stindex, exchange, "unable to UPDATE")) {
         isc_throw(NoSuchLease, "Statement has not been applied.");
     }
 }
@@ -1746,54 +1871,8 @@ CqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 bool
 CqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
                                  CqlDataArray& data, CqlLeaseExchange& exchange) {
-    CassError rc;
-    CassStatement* statement = NULL;
-    CassFuture* future = NULL;
-
-    statement = cass_prepared_bind(dbconn_.statements_[stindex]);
-    if (NULL == statement) {
-        isc_throw(DbOperationError, "unable to bind statement");
-    }
-
-    CqlLeaseMgr::bindData(statement, stindex, data, exchange);
-
-    future = cass_session_execute(dbconn_.session_, statement);
-    if (NULL == future) {
-        cass_statement_free(statement);
-        isc_throw(DbOperationError, "unable to execute statement");
-    }
-    cass_future_wait(future);
-    std::string error;
-    dbconn_.checkStatementError(error, future, stindex, "unable to DELETE");
-    rc = cass_future_error_code(future);
-    if (rc != CASS_OK) {
-        cass_future_free(future);
-        cass_statement_free(statement);
-        isc_throw(DbOperationError, error);
-    }
-
-    // Check if statement has been applied.
-    const CassResult* resultCollection = cass_future_get_result(future);
-    CassIterator* rows = cass_iterator_from_result(resultCollection);
-    CqlDataArray appliedData;
-    CqlDataArray appliedSize;
-    bool applied = false;
-    while (cass_iterator_next(rows)) {
-        const CassRow* row = cass_iterator_get_row(rows);
-        // [applied]: bool
-        appliedData.add(reinterpret_cast<void*>(&applied));
-        appliedSize.add(NULL);
-        CqlLeaseMgr::getData(row, exchange.parameters_.size() - 1, appliedData,
-                             appliedSize, 0, exchange);
-    }
-
-    // Free resources.
-    cass_iterator_free(rows);
-    cass_result_free(resultCollection);
-    cass_future_free(future);
-    cass_statement_free(statement);
-
-    return applied;
+    CassFuture* future = executeAsync(stindex, data, exchange);
+    return (waitApplied(future, stindex, exchange, "unable to DELETE"));
 }
 
 bool
@@ -1801,13 +1880,24 @@ CqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_CQL_DELETE_ADDR).arg(addr.toText());
 
+    CassFuture* future = deleteLeaseAsync(addr);
+    if (addr.isV4()) {
+        return (waitApplied(future, DELETE_LEASE4, *exchange4_,
+                            "unable to DELETE"));
+    }
+    return (waitApplied(future, DELETE_LEASE6, *exchange6_,
+                        "unable to DELETE"));
+}
+
+CassFuture*
+CqlLeaseMgr::deleteLeaseAsync(const isc::asiolink::IOAddress& addr) {
     // Set up the WHERE clause value
     CqlDataArray data;
 
     if (addr.isV4()) {
         uint32_t addr4_data = addr.toUint32();
         data.add(&addr4_data);
-        return (deleteLeaseCommon(DELETE_LEASE4, data, *exchange4_));
+        return (executeAsync(DELETE_LEASE4, data, *exchange4_));
     } else {
         std::string text_buffer = addr.toText();
         uint32_t addr6_length = text_buffer.size();
@@ -1820,8 +1910,97 @@ CqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
         }
         addr6_buffer[addr6_length] = '\0';
         data.add(addr6_buffer);
-        return (deleteLeaseCommon(DELETE_LEASE6, data, *exchange6_));
+        return (executeAsync(DELETE_LEASE6, data, *exchange6_));
+    }
+}
+
+void
+CqlLeaseMgr::updateLeases4(const Lease4Collection& leases) {
+    const StatementIndex stindex = UPDATE_LEASE4;
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_UPDATE_ADDRS4).arg(leases.size());
+
+    std::deque<CassFuture*> inflight;
+    uint64_t applied = 0;
+    std::string error;
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        try {
+            // Create the BIND array for the data being updated. The values
+            // are copied into the statement, so the exchange object can be
+            // reused for the next lease.
+            CqlDataArray data;
+            exchange4_->createBindForSend(*lease, data);
+            data.remove(0);
+            uint32_t addr4_data = (*lease)->addr_.toUint32();
+            data.add(&addr4_data);
+            inflight.push_back(executeAsync(stindex, data, *exchange4_));
+
+        } catch (const std::exception& ex) {
+            error = ex.what();
+            break;
+        }
+        waitInflight(inflight, MAX_STATEMENTS_IN_FLIGHT, stindex, *exchange4_,
+                     "unable to UPDATE", applied, error);
     }
+    waitInflight(inflight, 0, stindex, *exchange4_, "unable to UPDATE",
+                 applied, error);
+
+    if (!error.empty()) {
+        isc_throw(DbOperationError, error);
+    }
+    if (applied < leases.size()) {
+        isc_throw(NoSuchLease, "Statement has not been applied for "
+                  << (leases.size() - applied) << " leases.");
+    }
+}
+
+uint64_t
+CqlLeaseMgr::deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_CQL_DELETE_ADDRS4).arg(addrs.size());
+    return (deleteLeasesCommon(addrs));
+}
+
+uint64_t
+CqlLeaseMgr::deleteLeasesCommon(const std::vector<isc::asiolink::IOAddress>& addrs) {
+    if (addrs.empty()) {
+        return (0);
+    }
+
+    const bool v4 = addrs.front().isV4();
+    const StatementIndex stindex = (v4 ? DELETE_LEASE4 : DELETE_LEASE6);
+    CqlLeaseExchange& exchange = (v4 ?
+                                  static_cast<CqlLeaseExchange&>(*exchange4_) :
+                                  static_cast<CqlLeaseExchange&>(*exchange6_));
+
+    std::deque<CassFuture*> inflight;
+    uint64_t deleted = 0;
+    std::string error;
+    for (std::vector<isc::asiolink::IOAddress>::const_iterator addr =
+             addrs.begin(); addr != addrs.end(); ++addr) {
+        try {
+            if (addr->isV4() != v4) {
+                isc_throw(BadValue, "unable to delete IPv4 and IPv6 leases"
+                          " at the same time");
+            }
+            inflight.push_back(deleteLeaseAsync(*addr));
+
+        } catch (const std::exception& ex) {
+            error = ex.what();
+            break;
+        }
+        waitInflight(inflight, MAX_STATEMENTS_IN_FLIGHT, stindex, exchange,
+                     "unable to DELETE", deleted, error);
+    }
+    waitInflight(inflight, 0, stindex, exchange, "unable to DELETE",
+                 deleted, error);
+
+    if (!error.empty()) {
+        isc_throw(DbOperationError, error);
+    }
+    return (deleted);
 }
 
 uint64_t
@@ -1846,8 +2025,6 @@ CqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
     // Set up the WHERE clause value
 
     CqlDataArray data;
-    uint32_t result = 0;
-
     // State is reclaimed.
     uint32_t state = Lease::STATE_EXPIRED_RECLAIMED;
     data.add(&state);
@@ -1870,19 +2047,17 @@ CqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
     default:
         break;
     }
+    // Delete the leases concurrently rather than one by one.
+    std::vector<isc::asiolink::IOAddress> addrs;
     for (Lease4Collection::iterator it = result4Leases.begin();
             it != result4Leases.end(); ++it) {
-        if (deleteLease((*it)->addr_)) {
-            result++;
-        }
+        addrs.push_back((*it)->addr_);
     }
     for (Lease6Collection::iterator it = result6Leases.begin();
             it != result6Leases.end(); ++it) {
-        if (deleteLease((*it)->addr_)) {
-            result++;
-        }
+        addrs.push_back((*it)->addr_);
     }
-    return (result);
+    return (deleteLeasesCommon(addrs));
 }
 
 std::string
@@ -23,6 +23,7 @@
 #include <boost/scoped_ptr.hpp>
 #include <boost/utility.hpp>
 #include <cassandra.h>
+#include <deque>
 #include <vector>
 
 namespace isc {
@@ -324,6 +325,74 @@ public:
     virtual void getExpiredLeases4(Lease4Collection& ,
                                    const size_t ) const;
 
+    /// @brief Returns a collection of expired DHCPv6 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// Cassandra doesn't return the rows ordered by expiration time, so
+    /// the leases expiring at or after the last expiration time are
+    /// fetched and the leases of the slice are selected and sorted by
+    /// @c LeaseMgr::selectNextExpiredLeases6. The leases returned by the
+    /// previous slices are not fetched again.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the database backend are added.
+    /// @param max_leases A maximum number of leases to be returned. If this
+    /// value is set to 0, all following expired leases are returned.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call or the lowest @c int64_t value to start from the first
+    /// expired lease.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases6(Lease6Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// See @c getNextExpiredLeases6 for details.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the database backend are added.
+    /// @param max_leases A maximum number of leases to be returned. If this
+    /// value is set to 0, all following expired leases are returned.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call or the lowest @c int64_t value to start from the first
+    /// expired lease.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases4(Lease4Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a page of IPv4 leases ordered by address.
+    ///
+    /// Cassandra returns the rows in the order of the partition key tokens,
+    /// not in the order of the addresses, so the leases can't be fetched in
+    /// pages following an address.
+    ///
+    /// @throw isc::NotImplemented On every call, so as the lease export is
+    ///        rejected before any lease is returned.
+    virtual Lease4Collection
+    getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const isc::asiolink::IOAddress& upper_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Returns a page of IPv6 leases ordered by address.
+    ///
+    /// See @c getLeases4Page for the reason why it is not supported.
+    ///
+    /// @throw isc::NotImplemented On every call.
+    virtual Lease6Collection
+    getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
     /// @brief Updates IPv4 lease.
     ///
     /// Updates the record of the lease in the database (as identified by the
@@ -361,6 +430,39 @@ public:
     ///        failed.
     virtual bool deleteLease(const isc::asiolink::IOAddress& addr);
 
+    /// @brief Updates multiple IPv4 leases.
+    ///
+    /// The statements are executed concurrently, with at most
+    /// @c MAX_STATEMENTS_IN_FLIGHT statements awaiting the response at a
+    /// time. The leases are stored in separate partitions and the updates
+    /// are conditional, so they can't be grouped in a batch.
+    ///
+    /// @param leases Collection of leases to be updated.
+    ///
+    /// @throw isc::dhcp::NoSuchLease Attempt to update a lease that did not
+    ///        exist. The remaining leases are updated.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual void updateLeases4(const Lease4Collection& leases);
+
+    /// @brief Deletes multiple IPv4 leases.
+    ///
+    /// The statements are executed concurrently, in the same way as in
+    /// @c updateLeases4.
+    ///
+    /// @param addrs Addresses of the leases to be deleted.
+    ///
+    /// @return Number of deleted leases.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual uint64_t
+    deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs);
+
+    /// @brief Maximum number of statements awaiting the response during
+    /// the bulk operations.
+    static const size_t MAX_STATEMENTS_IN_FLIGHT = 64;
+
     /// @brief Deletes all expired and reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -432,10 +534,12 @@ public:
         GET_LEASE4_HWADDR,          // Get lease4 by HW address
         GET_LEASE4_HWADDR_SUBID,    // Get lease4 by HW address & subnet ID
         GET_LEASE4_EXPIRE,          // Get expired lease4
+        GET_LEASE4_EXPIRE_NEXT,     // Get expired lease4 from expiration time
         GET_LEASE6_ADDR,            // Get lease6 by address
         GET_LEASE6_DUID_IAID,       // Get lease6 by DUID and IAID
         GET_LEASE6_DUID_IAID_SUBID, // Get lease6 by DUID, IAID and subnet ID
         GET_LEASE6_EXPIRE,          // Get expired lease6
+        GET_LEASE6_EXPIRE_NEXT,     // Get expired lease6 from expiration time
         GET_VERSION,                // Obtain version number
         INSERT_LEASE4,              // Add entry to lease4 table
         INSERT_LEASE6,              // Add entry to lease6 table
@@ -611,6 +715,21 @@ private:
                                 const size_t max_leases,
                                 StatementIndex statement_index) const;
 
+    /// @brief Fetches the expired leases expiring at or after the
+    /// specified time.
+    ///
+    /// @param [out] expired_leases A container to which the leases are
+    ///        appended in no particular order.
+    /// @param last_expire Lowest expiration time of the fetched leases.
+    /// @param statement_index One of the @c GET_LEASE4_EXPIRE_NEXT or
+    ///        @c GET_LEASE6_EXPIRE_NEXT.
+    ///
+    /// @tparam One of the @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollection>
+    void getNextExpiredLeasesCommon(LeaseCollection& expired_leases,
+                                    const int64_t last_expire,
+                                    StatementIndex statement_index) const;
+
     /// @brief Update lease common code
     ///
     /// Holds the common code for updating a lease. It binds the parameters
@@ -647,6 +766,75 @@ private:
     bool deleteLeaseCommon(StatementIndex stindex, CqlDataArray& data,
         CqlLeaseExchange& exchange);
 
+    /// @brief Binds the data to the prepared statement and executes it
+    /// without waiting for the result.
+    ///
+    /// The token-aware load balancing policy sends the statement directly
+    /// to the node owning the partition.
+    ///
+    /// @param stindex Index of prepared statement to be executed
+    /// @param data array containing the values to be bound
+    /// @param exchange Exchange object to use
+    ///
+    /// @return Future of the result, which must be passed to @c waitApplied.
+    ///
+    /// @throw isc::dhcp::DbOperationError The statement could not be bound
+    ///        or executed.
+    CassFuture* executeAsync(StatementIndex stindex, CqlDataArray& data,
+                             CqlLeaseExchange& exchange);
+
+    /// @brief Waits for the result of the conditional statement.
+    ///
+    /// The future is freed by this method.
+    ///
+    /// @param future Future returned by @c executeAsync
+    /// @param stindex Index of the executed statement
+    /// @param exchange Exchange object to use
+    /// @param what Description of the operation used in the error message
+    ///
+    /// @return true if the statement has been applied.
+    ///
+    /// @throw isc::dhcp::DbOperationError The statement has failed.
+    bool waitApplied(CassFuture* future, StatementIndex stindex,
+                     CqlLeaseExchange& exchange, const char* what);
+
+    /// @brief Waits until the number of statements in flight drops to the
+    /// specified value.
+    ///
+    /// The errors are not thrown, so as all futures are freed. The first
+    /// error is returned instead.
+    ///
+    /// @param inflight Futures of the statements in flight, oldest first
+    /// @param max_inflight Number of statements which may remain in flight
+    /// @param stindex Index of the executed statement
+    /// @param exchange Exchange object to use
+    /// @param what Description of the operation used in the error message
+    /// @param [out] applied Incremented for each applied statement
+    /// @param [out] error Set to the first error, unless already set
+    void waitInflight(std::deque<CassFuture*>& inflight,
+                      const size_t max_inflight, StatementIndex stindex,
+                      CqlLeaseExchange& exchange, const char* what,
+                      uint64_t& applied, std::string& error);
+
+    /// @brief Executes the statement deleting the lease without waiting
+    /// for the result.
+    ///
+    /// @param addr Address of the lease to be deleted
+    ///
+    /// @return Future of the result.
+    CassFuture* deleteLeaseAsync(const isc::asiolink::IOAddress& addr);
+
+    /// @brief Deletes multiple leases of the same family concurrently.
+    ///
+    /// @param addrs Addresses of the leases to be deleted
+    ///
+    /// @return Number of deleted leases.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    uint64_t
+    deleteLeasesCommon(const std::vector<isc::asiolink::IOAddress>& addrs);
+
     /// @brief Delete expired-reclaimed leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -32,26 +32,7 @@ CSVLeaseFile4::append(const Lease4& lease) {
     // Bump the number of write attempts
     ++writes_;
 
-    CSVRow row(getColumnCount());
-    row.writeAt(getColumnIndex("address"), lease.addr_.toText());
-    if (!lease.hwaddr_) {
-        // Bump the error counter
-        ++write_errs_;
-
-        isc_throw(BadValue, "Lease4 must have hardware address specified.");
-    }
-    row.writeAt(getColumnIndex("hwaddr"), lease.hwaddr_->toText(false));
-    // Client id may be unset (NULL).
-    if (lease.client_id_) {
-        row.writeAt(getColumnIndex("client_id"), lease.client_id_->toText());
-    }
-    row.writeAt(getColumnIndex("valid_lifetime"), lease.valid_lft_);
-    row.writeAt(getColumnIndex("expire"), lease.cltt_ + lease.valid_lft_);
-    row.writeAt(getColumnIndex("subnet_id"), lease.subnet_id_);
-    row.writeAt(getColumnIndex("fqdn_fwd"), lease.fqdn_fwd_);
-    row.writeAt(getColumnIndex("fqdn_rev"), lease.fqdn_rev_);
-    row.writeAt(getColumnIndex("hostname"), lease.hostname_);
-    row.writeAt(getColumnIndex("state"), lease.state_);
+    CSVRow row = makeRow(lease);
 
     try {
         VersionedCSVFile::append(row);
@@ -65,6 +46,36 @@ CSVLeaseFile4::append(const Lease4& lease) {
     ++write_leases_;
 }
 
+void
+CSVLeaseFile4::append(const Lease4Collection& leases) {
+    writes_ += leases.size();
+
+    // Create all rows before writing any of them, so as the invalid lease
+    // doesn't leave a part of the collection in the file.
+    std::vector<CSVRow> rows;
+    rows.reserve(leases.size());
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        try {
+            rows.push_back(makeRow(**lease));
+        } catch (const std::exception&) {
+            // None of the leases is written. The invalid one has been
+            // counted already.
+            write_errs_ += leases.size() - 1;
+            throw;
+        }
+    }
+
+    try {
+        VersionedCSVFile::append(rows);
+    } catch (const std::exception&) {
+        write_errs_ += leases.size();
+        throw;
+    }
+
+    write_leases_ += leases.size();
+}
+
 bool
 CSVLeaseFile4::next(Lease4Ptr& lease) {
     // Bump the number of read attempts
@@ -149,6 +160,31 @@ CSVLeaseFile4::initColumns() {
     setMinimumValidColumns("hostname");
 }
 
+CSVRow
+CSVLeaseFile4::makeRow(const Lease4& lease) {
+    CSVRow row(getColumnCount());
+    row.writeAt(getColumnIndex("address"), lease.addr_.toText());
+    if (!lease.hwaddr_) {
+        // Bump the error counter
+        ++write_errs_;
+
+        isc_throw(BadValue, "Lease4 must have hardware address specified.");
+    }
+    row.writeAt(getColumnIndex("hwaddr"), lease.hwaddr_->toText(false));
+    // Client id may be unset (NULL).
+    if (lease.client_id_) {
+        row.writeAt(getColumnIndex("client_id"), lease.client_id_->toText());
+    }
+    row.writeAt(getColumnIndex("valid_lifetime"), lease.valid_lft_);
+    row.writeAt(getColumnIndex("expire"), lease.cltt_ + lease.valid_lft_);
+    row.writeAt(getColumnIndex("subnet_id"), lease.subnet_id_);
+    row.writeAt(getColumnIndex("fqdn_fwd"), lease.fqdn_fwd_);
+    row.writeAt(getColumnIndex("fqdn_rev"), lease.fqdn_rev_);
+    row.writeAt(getColumnIndex("hostname"), lease.hostname_);
+    row.writeAt(getColumnIndex("state"), lease.state_);
+    return (row);
+}
+
 IOAddress
 CSVLeaseFile4::readAddress(const CSVRow& row) {
     IOAddress address(row.readAt(getColumnIndex("address")));
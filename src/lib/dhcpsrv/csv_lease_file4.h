@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2015 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -60,6 +60,17 @@ public:
     /// @param lease Structure representing a DHCPv4 lease.
     void append(const Lease4& lease);
 
+    /// @brief Appends multiple lease records to the CSV file.
+    ///
+    /// The file is flushed once, after the last record. None of the records
+    /// is written if any of the leases lacks the hardware address.
+    ///
+    /// @param leases Collection of the DHCPv4 leases.
+    ///
+    /// @throw BadValue if any of the leases lacks the hardware address.
+    /// @throw CSVFileError if writing the records failed.
+    void append(const Lease4Collection& leases);
+
     /// @brief Reads next lease from the CSV file.
     ///
     /// If this function hits an error during lease read, it sets the error
@@ -97,6 +108,14 @@ private:
     /// - state
     void initColumns();
 
+    /// @brief Creates the CSV row holding the lease record.
+    ///
+    /// @param lease Structure representing a DHCPv4 lease.
+    ///
+    /// @return CSV row holding the lease record.
+    /// @throw BadValue if the lease lacks the hardware address.
+    util::CSVRow makeRow(const Lease4& lease);
+
     ///
     /// @name Methods which read specific lease fields from the CSV row.
     ///
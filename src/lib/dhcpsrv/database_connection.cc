@@ -11,6 +11,8 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/foreach.hpp>
+#include <boost/lexical_cast.hpp>
+#include <limits>
 #include <vector>
 
 using namespace std;
@@ -106,5 +108,30 @@ DatabaseConnection::configuredReadOnly() const {
     return (readonly_value == "true");
 }
 
+size_t
+DatabaseConnection::configuredPoolSize() const {
+    std::string pool_size_value;
+    try {
+        pool_size_value = getParameter("connection-pool-size");
+    } catch (...) {
+        // Parameter "connection-pool-size" hasn't been specified, so
+        // a single connection is used.
+        return (1);
+    }
+
+    int64_t pool_size = 0;
+    try {
+        pool_size = boost::lexical_cast<int64_t>(pool_size_value);
+    } catch (const boost::bad_lexical_cast&) {
+        // Reported below.
+    }
+    if ((pool_size <= 0) ||
+        (pool_size > std::numeric_limits<uint16_t>::max())) {
+        isc_throw(DbInvalidPoolSize, "invalid value '" << pool_size_value
+                  << "' specified for parameter 'connection-pool-size'");
+    }
+    return (static_cast<size_t>(pool_size));
+}
+
 };
 };
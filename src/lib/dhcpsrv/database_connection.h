@@ -63,6 +63,15 @@ public:
         isc::Exception(file, line, what) {}
 };
 
+/// @brief Invalid connection pool size.
+///
+/// Thrown when the 'connection-pool-size' parameter is invalid.
+class DbInvalidPoolSize : public Exception {
+public:
+    DbInvalidPoolSize(const char* file, size_t line, const char* what) :
+        isc::Exception(file, line, what) {}
+};
+
 
 /// @brief Common database connection class.
 ///
@@ -101,6 +110,17 @@ public:
     /// @throw BadValue if parameter is not found
     std::string getParameter(const std::string& name) const;
 
+    /// @brief Replaces the connection parameters.
+    ///
+    /// This is used by the backends which apply the new parameters without
+    /// reopening the database. The parameters used to open the database
+    /// must not be changed this way.
+    ///
+    /// @param parameters New connection parameters.
+    void setParameters(const ParameterMap& parameters) {
+        parameters_ = parameters;
+    }
+
     /// @brief Parse database access string
     ///
     /// Parses the string of "keyword=value" pairs and separates them
@@ -129,6 +149,17 @@ public:
     /// and set to false.
     bool configuredReadOnly() const;
 
+    /// @brief Returns the maximum number of connections to the database.
+    ///
+    /// The SQL backends open up to this number of connections, so as
+    /// the queries issued by different threads can be executed in
+    /// parallel.
+    ///
+    /// @return Value of the "connection-pool-size" parameter or 1 if
+    /// the parameter is not specified.
+    /// @throw DbInvalidPoolSize if the value is not a positive integer.
+    size_t configuredPoolSize() const;
+
 private:
 
     /// @brief List of parameters passed in dbconfig
@@ -0,0 +1,277 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef DB_CONNECTION_POOL_H
+#define DB_CONNECTION_POOL_H
+
+#include <dhcpsrv/database_connection.h>
+#include <exceptions/exceptions.h>
+#include <util/threads/sync.h>
+#include <boost/function.hpp>
+#include <boost/noncopyable.hpp>
+#include <boost/shared_ptr.hpp>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Pool of database connections.
+///
+/// The pool hands out connections to the callers which need to issue
+/// queries concurrently, e.g. from multiple threads. Each connection is
+/// created by the factory function supplied by the pool's user. The
+/// factory is expected to open the database and prepare the statements,
+/// so as each connection holds its own set of prepared statements.
+///
+/// A connection which is returned to the pool is checked by the
+/// validator function before it is handed out again. If the validator
+/// reports that the connection is unusable (e.g. the database server
+/// has been restarted), the connection is destroyed and a new one is
+/// created in its place.
+///
+/// The pool creates at most the specified number of connections. When
+/// all of them are in use, the caller is blocked until one of the
+/// connections is returned to the pool.
+///
+/// @tparam ConnectionType Type of the pooled connection, e.g.
+/// @c MySqlConnection, @c PgSqlConnection or a lease manager owning
+/// its own connection.
+template<typename ConnectionType>
+class DbConnectionPool : public boost::noncopyable {
+public:
+
+    /// @brief Pointer to the pooled connection.
+    typedef boost::shared_ptr<ConnectionType> ConnectionPtr;
+
+    /// @brief Function creating a new connection.
+    typedef boost::function<ConnectionPtr ()> Factory;
+
+    /// @brief Function checking if the connection is usable.
+    typedef boost::function<bool (ConnectionType&)> Validator;
+
+    /// @brief Connection checked out from the pool.
+    ///
+    /// The connection is returned to the pool when this object goes out
+    /// of scope.
+    class Handle : public boost::noncopyable {
+    public:
+
+        /// @brief Constructor.
+        ///
+        /// Checks out the connection from the pool.
+        ///
+        /// @param pool Pool from which the connection is checked out.
+        Handle(DbConnectionPool& pool)
+            : pool_(pool), conn_(pool.acquire()), valid_(true) {
+        }
+
+        /// @brief Destructor.
+        ///
+        /// Returns the connection to the pool.
+        ~Handle() {
+            pool_.release(conn_, valid_);
+        }
+
+        /// @brief Returns reference to the connection.
+        ConnectionType& operator*() const {
+            return (*conn_);
+        }
+
+        /// @brief Returns pointer to the connection.
+        ConnectionType* operator->() const {
+            return (conn_.get());
+        }
+
+        /// @brief Marks the connection as unusable.
+        ///
+        /// Such connection is destroyed rather than returned to the pool.
+        void invalidate() {
+            valid_ = false;
+        }
+
+    private:
+
+        /// @brief Pool from which the connection has been checked out.
+        DbConnectionPool& pool_;
+
+        /// @brief Checked out connection.
+        ConnectionPtr conn_;
+
+        /// @brief Indicates if the connection can be returned to the pool.
+        bool valid_;
+    };
+
+    /// @brief Constructor.
+    ///
+    /// @param factory Function creating a new connection.
+    /// @param validator Function checking if the idle connection is
+    /// usable. If empty, the idle connections are not checked.
+    /// @param max_size Maximum number of connections.
+    ///
+    /// @throw BadValue if the factory is empty or the maximum number of
+    /// connections is 0.
+    DbConnectionPool(const Factory& factory, const Validator& validator,
+                     const size_t max_size)
+        : factory_(factory), validator_(validator), max_size_(max_size),
+          size_(0), idle_(), mutex_(), cond_() {
+        if (!factory_) {
+            isc_throw(BadValue, "connection factory must not be empty");
+        }
+        if (max_size_ == 0) {
+            isc_throw(BadValue, "maximum number of connections in the pool"
+                      " must be greater than 0");
+        }
+    }
+
+    /// @brief Checks out a connection from the pool.
+    ///
+    /// Idle connections are preferred. An idle connection which fails
+    /// validation is destroyed and the next one is tried. A new
+    /// connection is created if there are no idle connections and the
+    /// maximum number of connections hasn't been reached. Otherwise,
+    /// the call blocks until a connection is returned to the pool.
+    ///
+    /// @return Pointer to the connection.
+    /// @throw DbOpenError or other exception thrown by the factory if the
+    /// new connection can't be created.
+    ConnectionPtr acquire() {
+        for (;;) {
+            ConnectionPtr conn;
+            {
+                util::thread::Mutex::Locker lock(mutex_);
+                while (idle_.empty() && (size_ >= max_size_)) {
+                    cond_.wait(mutex_);
+                }
+                if (!idle_.empty()) {
+                    conn = idle_.back();
+                    idle_.pop_back();
+
+                } else {
+                    // Reserve the slot for the new connection, so as
+                    // other callers don't exceed the limit while it is
+                    // being opened.
+                    ++size_;
+                }
+            }
+
+            // Opening and validating the connection involves talking to
+            // the database, so it is done without holding the lock.
+            if (!conn) {
+                try {
+                    conn = factory_();
+                } catch (...) {
+                    discard();
+                    throw;
+                }
+                if (!conn) {
+                    discard();
+                    isc_throw(DbOpenError, "failed to create a new connection"
+                              " for the pool");
+                }
+                return (conn);
+            }
+
+            bool valid = false;
+            try {
+                valid = !validator_ || validator_(*conn);
+            } catch (...) {
+                // Treat the exception as the broken connection.
+            }
+
+            if (valid) {
+                return (conn);
+            }
+            conn.reset();
+            discard();
+        }
+    }
+
+    /// @brief Returns the connection to the pool.
+    ///
+    /// @param conn Connection checked out with @c acquire.
+    /// @param valid Indicates if the connection is usable. If false, the
+    /// connection is destroyed and a new one is created when needed.
+    void release(const ConnectionPtr& conn, const bool valid = true) {
+        if (!conn) {
+            return;
+        }
+        if (!valid) {
+            discard();
+            return;
+        }
+        util::thread::Mutex::Locker lock(mutex_);
+        idle_.push_back(conn);
+        cond_.signal();
+    }
+
+    /// @brief Destroys all idle connections.
+    ///
+    /// Connections checked out from the pool are not affected.
+    void clear() {
+        std::vector<ConnectionPtr> idle;
+        {
+            util::thread::Mutex::Locker lock(mutex_);
+            idle.swap(idle_);
+            size_ -= idle.size();
+            for (size_t i = 0; i < idle.size(); ++i) {
+                cond_.signal();
+            }
+        }
+    }
+
+    /// @brief Returns the number of connections owned by the pool,
+    /// including the checked out connections.
+    size_t getSize() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (size_);
+    }
+
+    /// @brief Returns the number of idle connections.
+    size_t getIdleCount() const {
+        util::thread::Mutex::Locker lock(mutex_);
+        return (idle_.size());
+    }
+
+    /// @brief Returns the maximum number of connections.
+    size_t getMaxSize() const {
+        return (max_size_);
+    }
+
+private:
+
+    /// @brief Releases the slot of a destroyed connection.
+    void discard() {
+        util::thread::Mutex::Locker lock(mutex_);
+        --size_;
+        cond_.signal();
+    }
+
+    /// @brief Function creating a new connection.
+    Factory factory_;
+
+    /// @brief Function checking if the idle connection is usable.
+    Validator validator_;
+
+    /// @brief Maximum number of connections.
+    size_t max_size_;
+
+    /// @brief Number of connections, including the checked out ones.
+    size_t size_;
+
+    /// @brief Idle connections.
+    std::vector<ConnectionPtr> idle_;
+
+    /// @brief Mutex protecting the state of the pool.
+    mutable util::thread::Mutex mutex_;
+
+    /// @brief Condition variable signalled when a slot becomes available.
+    util::thread::CondVar cond_;
+};
+
+}; // end of isc::dhcp namespace
+}; // end of isc namespace
+
+#endif // DB_CONNECTION_POOL_H
@@ -41,6 +41,12 @@ HostDataSourceFactory::getHostDataSourcePtr() {
     return (hostDataSourcePtr);
 }
 
+DatabaseConnection::ParameterMap&
+HostDataSourceFactory::getParameters() {
+    static DatabaseConnection::ParameterMap parameters;
+    return (parameters);
+}
+
 void
 HostDataSourceFactory::create(const std::string& dbaccess) {
     // Parse the access string and create a redacted string for logging.
@@ -61,6 +67,7 @@ HostDataSourceFactory::create(const std::string& dbaccess) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MYSQL_HOST_DB)
             .arg(DatabaseConnection::redactedAccessString(parameters));
         getHostDataSourcePtr().reset(new MySqlHostDataSource(parameters));
+        getParameters() = parameters;
         return;
     }
 #endif
@@ -70,6 +77,7 @@ HostDataSourceFactory::create(const std::string& dbaccess) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_HOST_DB)
             .arg(DatabaseConnection::redactedAccessString(parameters));
         getHostDataSourcePtr().reset(new PgSqlHostDataSource(parameters));
+        getParameters() = parameters;
         return;
     }
 #endif
@@ -95,6 +103,13 @@ HostDataSourceFactory::destroy() {
             .arg(getHostDataSourcePtr()->getType());
     }
     getHostDataSourcePtr().reset();
+    getParameters().clear();
+}
+
+bool
+HostDataSourceFactory::matchesDbAccess(const std::string& dbaccess) {
+    return (getHostDataSourcePtr() &&
+            (DatabaseConnection::parse(dbaccess) == getParameters()));
 }
 
 #if 0
@@ -71,12 +71,33 @@ public:
     /// host data source is available.
     static void destroy();
 
+    /// @brief Checks if the current host data source uses the specified
+    /// database access parameters.
+    ///
+    /// This is used when the server is reconfigured to keep the host data
+    /// source, and its database connection, when the host database access
+    /// parameters are unchanged.
+    ///
+    /// @param dbaccess Database access parameters.
+    ///
+    /// @return true if the host data source exists and has been created
+    /// with the same parameters, false otherwise.
+    static bool matchesDbAccess(const std::string& dbaccess);
+
     /// @brief Hold pointer to host data source instance
     ///
     /// Holds a pointer to the singleton host data source.  The singleton
     /// is encapsulated in this method to avoid a "static initialization
     /// fiasco" if defined in an external static variable.
     static HostDataSourcePtr& getHostDataSourcePtr();
+
+private:
+
+    /// @brief Hold database access parameters of the host data source.
+    ///
+    /// Holds the parameters with which the current host data source has
+    /// been created.
+    static DatabaseConnection::ParameterMap& getParameters();
 };
 
 
@@ -1,4 +1,4 @@
-// Copyright (C) 2012-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2012-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,12 +6,64 @@
 
 #include <dhcpsrv/lease.h>
 #include <util/pointer_util.h>
+#include <boost/make_shared.hpp>
+#include <algorithm>
+#include <limits>
+#include <map>
 #include <sstream>
 #include <iostream>
 
+using namespace isc::data;
 using namespace isc::util;
 using namespace std;
 
+namespace {
+
+/// @brief Returns the parameter of the lease if it has the expected type.
+///
+/// @param element Element map describing the lease.
+/// @param name Name of the parameter.
+/// @param type Expected type of the parameter.
+///
+/// @return Pointer to the parameter or null if it is not specified.
+/// @throw BadValue if the parameter has other type.
+ConstElementPtr
+getLeaseParam(const ConstElementPtr& element, const std::string& name,
+              const Element::types type) {
+    ConstElementPtr value = element->get(name);
+    if (value && (value->getType() != type)) {
+        isc_throw(isc::BadValue, "'" << name << "' must be "
+                  << (type == Element::integer ? "an " : "a ")
+                  << Element::typeToName(type));
+    }
+    return (value);
+}
+
+/// @brief Returns the integer parameter of the lease.
+///
+/// @param element Element map describing the lease.
+/// @param name Name of the parameter.
+/// @param max Maximum value of the parameter.
+/// @param default_value Value returned if the parameter is not specified.
+///
+/// @return Value of the parameter.
+/// @throw BadValue if the parameter is not an integer between 0 and @c max.
+int64_t
+getLeaseInteger(const ConstElementPtr& element, const std::string& name,
+                const int64_t max, const int64_t default_value) {
+    ConstElementPtr value = getLeaseParam(element, name, Element::integer);
+    if (!value) {
+        return (default_value);
+    }
+    if ((value->intValue() < 0) || (value->intValue() > max)) {
+        isc_throw(isc::BadValue, "'" << name << "' must be between 0 and "
+                  << max << ", not " << value->intValue());
+    }
+    return (value->intValue());
+}
+
+}
+
 namespace isc {
 namespace dhcp {
 
@@ -104,13 +156,14 @@ Lease4::Lease4(const Lease4& other)
 
     // Copy the hardware address if it is defined.
     if (other.hwaddr_) {
-        hwaddr_.reset(new HWAddr(*other.hwaddr_));
+        hwaddr_ = boost::make_shared<HWAddr>(*other.hwaddr_);
     } else {
         hwaddr_.reset();
     }
 
     if (other.client_id_) {
-        client_id_.reset(new ClientId(other.client_id_->getClientId()));
+        client_id_ =
+            boost::make_shared<ClientId>(other.client_id_->getClientId());
 
     } else {
         client_id_.reset();
@@ -206,13 +259,14 @@ Lease4::operator=(const Lease4& other) {
 
         // Copy the hardware address if it is defined.
         if (other.hwaddr_) {
-            hwaddr_.reset(new HWAddr(*other.hwaddr_));
+            hwaddr_ = boost::make_shared<HWAddr>(*other.hwaddr_);
         } else {
             hwaddr_.reset();
         }
 
         if (other.client_id_) {
-            client_id_.reset(new ClientId(other.client_id_->getClientId()));
+            client_id_ =
+                boost::make_shared<ClientId>(other.client_id_->getClientId());
         } else {
             client_id_.reset();
         }
@@ -308,6 +362,28 @@ Lease6::toText() const {
     return (stream.str());
 }
 
+ElementPtr
+Lease6::toElement() const {
+    ElementPtr lease = Element::createMap();
+    lease->set("ip-address", Element::create(addr_.toText()));
+    lease->set("type", Element::create(typeToText(type_)));
+    lease->set("prefix-len", Element::create(static_cast<long int>(prefixlen_)));
+    lease->set("duid", Element::create(duid_ ? duid_->toText() : std::string()));
+    lease->set("iaid", Element::create(static_cast<long int>(iaid_)));
+    if (hwaddr_) {
+        lease->set("hw-address", Element::create(hwaddr_->toText(false)));
+    }
+    lease->set("subnet-id", Element::create(static_cast<long int>(subnet_id_)));
+    lease->set("preferred-lft", Element::create(static_cast<long int>(preferred_lft_)));
+    lease->set("valid-lft", Element::create(static_cast<long int>(valid_lft_)));
+    lease->set("cltt", Element::create(static_cast<long int>(cltt_)));
+    lease->set("fqdn-fwd", Element::create(fqdn_fwd_));
+    lease->set("fqdn-rev", Element::create(fqdn_rev_));
+    lease->set("hostname", Element::create(hostname_));
+    lease->set("state", Element::create(static_cast<long int>(state_)));
+    return (lease);
+}
+
 std::string
 Lease4::toText() const {
     ostringstream stream;
@@ -325,6 +401,111 @@ Lease4::toText() const {
     return (stream.str());
 }
 
+ElementPtr
+Lease4::toElement() const {
+    ElementPtr lease = Element::createMap();
+    lease->set("ip-address", Element::create(addr_.toText()));
+    lease->set("hw-address", Element::create(hwaddr_ ? hwaddr_->toText(false) :
+                                             std::string()));
+    if (client_id_) {
+        lease->set("client-id", Element::create(client_id_->toText()));
+    }
+    lease->set("subnet-id", Element::create(static_cast<long int>(subnet_id_)));
+    lease->set("valid-lft", Element::create(static_cast<long int>(valid_lft_)));
+    lease->set("cltt", Element::create(static_cast<long int>(cltt_)));
+    lease->set("fqdn-fwd", Element::create(fqdn_fwd_));
+    lease->set("fqdn-rev", Element::create(fqdn_rev_));
+    lease->set("hostname", Element::create(hostname_));
+    lease->set("state", Element::create(static_cast<long int>(state_)));
+    return (lease);
+}
+
+Lease4Ptr
+Lease4::fromElement(const ConstElementPtr& element) {
+    if (!element || (element->getType() != Element::map)) {
+        isc_throw(BadValue, "lease must be a map");
+    }
+
+    // Reject the misspelled parameters rather than silently using the
+    // default values.
+    static const char* params[] = {
+        "ip-address", "hw-address", "client-id", "subnet-id", "valid-lft",
+        "cltt", "fqdn-fwd", "fqdn-rev", "hostname", "state"
+    };
+    const char** params_end = params + sizeof(params) / sizeof(params[0]);
+    const std::map<std::string, ConstElementPtr>& map = element->mapValue();
+    for (std::map<std::string, ConstElementPtr>::const_iterator param =
+             map.begin(); param != map.end(); ++param) {
+        if (std::find(params, params_end, param->first) == params_end) {
+            isc_throw(BadValue, "unsupported lease parameter '"
+                      << param->first << "'");
+        }
+    }
+
+    ConstElementPtr value = getLeaseParam(element, "ip-address",
+                                          Element::string);
+    if (!value) {
+        isc_throw(BadValue, "'ip-address' is mandatory");
+    }
+    isc::asiolink::IOAddress addr("0.0.0.0");
+    try {
+        addr = isc::asiolink::IOAddress(value->stringValue());
+    } catch (const std::exception&) {
+        // Reported below.
+    }
+    if (!addr.isV4() || addr.isV4Zero()) {
+        isc_throw(BadValue, "'ip-address' must be an IPv4 address, not '"
+                  << value->stringValue() << "'");
+    }
+
+    if (!element->get("valid-lft")) {
+        isc_throw(BadValue, "'valid-lft' is mandatory");
+    }
+    const uint32_t valid_lft = static_cast<uint32_t>
+        (getLeaseInteger(element, "valid-lft",
+                         std::numeric_limits<uint32_t>::max(), 0));
+
+    const uint32_t state = static_cast<uint32_t>
+        (getLeaseInteger(element, "state", STATE_EXPIRED_RECLAIMED,
+                         STATE_DEFAULT));
+
+    value = getLeaseParam(element, "hw-address", Element::string);
+    if (!value) {
+        isc_throw(BadValue, "'hw-address' is mandatory");
+    }
+    HWAddrPtr hwaddr(new HWAddr(HWAddr::fromText(value->stringValue())));
+    if (hwaddr->hwaddr_.empty() && (state != STATE_DECLINED)) {
+        isc_throw(BadValue, "empty 'hw-address' is only valid for declined"
+                  " leases");
+    }
+
+    std::vector<uint8_t> client_id;
+    value = getLeaseParam(element, "client-id", Element::string);
+    if (value && !value->stringValue().empty()) {
+        client_id = ClientId::fromText(value->stringValue())->getClientId();
+    }
+
+    const SubnetID subnet_id = static_cast<SubnetID>
+        (getLeaseInteger(element, "subnet-id",
+                         std::numeric_limits<SubnetID>::max(), 0));
+    const time_t cltt = static_cast<time_t>
+        (getLeaseInteger(element, "cltt", std::numeric_limits<uint32_t>::max(),
+                         time(NULL)));
+
+    value = getLeaseParam(element, "fqdn-fwd", Element::boolean);
+    const bool fqdn_fwd = value && value->boolValue();
+    value = getLeaseParam(element, "fqdn-rev", Element::boolean);
+    const bool fqdn_rev = value && value->boolValue();
+    value = getLeaseParam(element, "hostname", Element::string);
+    const std::string hostname = value ? value->stringValue() : "";
+
+    Lease4Ptr lease(new Lease4(addr, hwaddr,
+                               client_id.empty() ? NULL : &client_id[0],
+                               client_id.size(), valid_lft, 0, 0, cltt,
+                               subnet_id, fqdn_fwd, fqdn_rev, hostname));
+    lease->state_ = state;
+    return (lease);
+}
 
 bool
 Lease4::operator==(const Lease4& other) const {
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -8,6 +8,7 @@
 #define LEASE_H
 
 #include <asiolink/io_address.h>
+#include <cc/data.h>
 #include <dhcp/duid.h>
 #include <dhcp/option.h>
 #include <dhcp/hwaddr.h>
@@ -393,6 +394,32 @@ struct Lease4 : public Lease {
     /// @return Textual representation of lease data
     virtual std::string toText() const;
 
+    /// @brief Converts the lease to the element map.
+    ///
+    /// The map holds the "ip-address", "hw-address", "client-id" (only
+    /// if the lease has the client identifier), "subnet-id", "valid-lft",
+    /// "cltt", "fqdn-fwd", "fqdn-rev", "hostname" and "state" parameters.
+    /// It is used to return the leases by the control commands.
+    ///
+    /// @return Pointer to the element map describing the lease.
+    isc::data::ElementPtr toElement() const;
+
+    /// @brief Creates the lease from the element map.
+    ///
+    /// The map has the format returned by @c toElement. The "ip-address",
+    /// "hw-address" and "valid-lft" parameters are mandatory, although the
+    /// hardware address may be empty for the declined lease. The "cltt"
+    /// defaults to the current time, the "subnet-id" defaults to 0, the
+    /// flags to false and the "hostname" to the empty string. The subnet
+    /// identifier is not checked against the configuration.
+    ///
+    /// @param element Pointer to the element map describing the lease.
+    ///
+    /// @return Pointer to the lease.
+    /// @throw BadValue if the map is malformed.
+    static boost::shared_ptr<Lease4>
+    fromElement(const isc::data::ConstElementPtr& element);
+
     /// @brief Sets IPv4 lease to declined state.
     ///
     /// See @ref Lease::decline for detailed description.
@@ -528,6 +555,17 @@ struct Lease6 : public Lease {
         return (!operator==(other));
     }
 
+    /// @brief Converts the lease to the element map.
+    ///
+    /// The map holds the "ip-address", "type", "prefix-len", "duid",
+    /// "iaid", "hw-address" (only if the lease has the hardware address),
+    /// "subnet-id", "preferred-lft", "valid-lft", "cltt", "fqdn-fwd",
+    /// "fqdn-rev", "hostname" and "state" parameters. It is used to return
+    /// the leases by the control commands.
+    ///
+    /// @return Pointer to the element map describing the lease.
+    isc::data::ElementPtr toElement() const;
+
     /// @brief Convert Lease to Printable Form
     ///
     /// @return String form of the lease
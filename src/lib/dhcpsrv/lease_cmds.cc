@@ -0,0 +1,624 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <asiolink/io_address.h>
+#include <cc/command_interpreter.h>
+#include <config/command_mgr.h>
+#include <dhcpsrv/addr_utilities.h>
+#include <dhcpsrv/cfgmgr.h>
+#include <dhcpsrv/lease_cmds.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <exceptions/exceptions.h>
+#include <stats/stats_mgr.h>
+#include <boost/bind.hpp>
+#include <boost/shared_ptr.hpp>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+#include <utility>
+
+using namespace isc::asiolink;
+using namespace isc::config;
+using namespace isc::data;
+using namespace isc::dhcp;
+using namespace isc::stats;
+
+namespace {
+
+/// @brief Parameters of the query for the pages of IPv4 leases.
+struct Lease4PageQuery {
+
+    /// @brief Constructor.
+    ///
+    /// Sets the parameters to query all leases.
+    Lease4PageQuery()
+        : lower_bound_("0.0.0.0"), upper_bound_("255.255.255.255"),
+          subnet_id_(0), page_size_(LeaseCmds::DEFAULT_PAGE_SIZE) {
+    }
+
+    /// @brief Address after which the next page starts.
+    IOAddress lower_bound_;
+
+    /// @brief Highest address of the returned leases.
+    IOAddress upper_bound_;
+
+    /// @brief Subnet of the returned leases or 0 for all subnets.
+    SubnetID subnet_id_;
+
+    /// @brief Maximum number of leases in the page.
+    size_t page_size_;
+};
+
+/// @brief Parameters of the query for the pages of IPv6 leases.
+struct Lease6PageQuery {
+
+    /// @brief Constructor.
+    ///
+    /// Sets the parameters to query all leases.
+    Lease6PageQuery()
+        : lower_bound_("::"), subnet_id_(0),
+          page_size_(LeaseCmds::DEFAULT_PAGE_SIZE) {
+    }
+
+    /// @brief Address after which the next page starts.
+    IOAddress lower_bound_;
+
+    /// @brief Subnet of the returned leases or 0 for all subnets.
+    SubnetID subnet_id_;
+
+    /// @brief Maximum number of leases in the page.
+    size_t page_size_;
+};
+
+/// @brief Returns IPv4 address held in the command argument.
+///
+/// @param name Name of the argument.
+/// @param value Value of the argument.
+///
+/// @throw BadValue if the value is not a string holding IPv4 address.
+IOAddress
+getAddress4(const std::string& name, const ConstElementPtr& value) {
+    if (value->getType() != Element::string) {
+        isc_throw(isc::BadValue, "'" << name << "' must be a string");
+    }
+    try {
+        IOAddress address(value->stringValue());
+        if (address.isV4()) {
+            return (address);
+        }
+    } catch (const std::exception&) {
+        // Reported below.
+    }
+    isc_throw(isc::BadValue, "'" << name << "' must be an IPv4 address, not '"
+              << value->stringValue() << "'");
+}
+
+/// @brief Returns IPv6 address held in the command argument.
+///
+/// @param name Name of the argument.
+/// @param value Value of the argument.
+///
+/// @throw BadValue if the value is not a string holding IPv6 address.
+IOAddress
+getAddress6(const std::string& name, const ConstElementPtr& value) {
+    if (value->getType() != Element::string) {
+        isc_throw(isc::BadValue, "'" << name << "' must be a string");
+    }
+    try {
+        IOAddress address(value->stringValue());
+        if (address.isV6()) {
+            return (address);
+        }
+    } catch (const std::exception&) {
+        // Reported below.
+    }
+    isc_throw(isc::BadValue, "'" << name << "' must be an IPv6 address, not '"
+              << value->stringValue() << "'");
+}
+
+/// @brief Returns positive integer held in the command argument.
+///
+/// @param name Name of the argument.
+/// @param value Value of the argument.
+/// @param max Maximum value of the argument.
+///
+/// @throw BadValue if the value is not an integer between 1 and @c max.
+int64_t
+getPositive(const std::string& name, const ConstElementPtr& value,
+            const int64_t max) {
+    if (value->getType() != Element::integer) {
+        isc_throw(isc::BadValue, "'" << name << "' must be an integer");
+    }
+    const int64_t result = value->intValue();
+    if ((result <= 0) || (result > max)) {
+        isc_throw(isc::BadValue, "'" << name << "' must be between 1 and "
+                  << max << ", not " << result);
+    }
+    return (result);
+}
+
+/// @brief Parses the arguments of the commands reading IPv4 leases.
+///
+/// @param args Arguments of the command.
+/// @param size_name Name of the argument specifying the page size.
+///
+/// @return Parameters of the query.
+/// @throw BadValue if the arguments are invalid.
+Lease4PageQuery
+parseLease4PageQuery(const ConstElementPtr& args, const std::string& size_name) {
+    Lease4PageQuery query;
+    if (!args) {
+        return (query);
+    }
+    if (args->getType() != Element::map) {
+        isc_throw(isc::BadValue, "arguments must be a map");
+    }
+
+    ConstElementPtr value = args->get("from");
+    if (value && ((value->getType() != Element::string) ||
+                  (value->stringValue() != "start"))) {
+        query.lower_bound_ = getAddress4("from", value);
+    }
+
+    value = args->get("to");
+    if (value) {
+        query.upper_bound_ = getAddress4("to", value);
+    }
+
+    value = args->get(size_name);
+    if (value) {
+        query.page_size_ = static_cast<size_t>
+            (getPositive(size_name, value, LeaseCmds::MAX_PAGE_SIZE));
+    }
+
+    value = args->get("subnet-id");
+    if (value) {
+        query.subnet_id_ = static_cast<SubnetID>
+            (getPositive("subnet-id", value,
+                         std::numeric_limits<SubnetID>::max()));
+
+        // Skip the addresses outside of the subnet prefix, rather than
+        // walking through the leases of the other subnets.
+        Subnet4Ptr subnet = CfgMgr::instance().getCurrentCfg()->
+            getCfgSubnets4()->getSubnet(query.subnet_id_);
+        if (subnet) {
+            const std::pair<IOAddress, uint8_t> prefix = subnet->get();
+            const uint32_t first = firstAddrInPrefix(prefix.first,
+                                                     prefix.second).toUint32();
+            const IOAddress last = lastAddrInPrefix(prefix.first,
+                                                    prefix.second);
+            // The lower bound is excluded from the page.
+            if ((first > 0) && (query.lower_bound_.toUint32() < first - 1)) {
+                query.lower_bound_ = IOAddress(first - 1);
+            }
+            if (last < query.upper_bound_) {
+                query.upper_bound_ = last;
+            }
+        }
+    }
+
+    return (query);
+}
+
+/// @brief Parses the arguments of the commands reading IPv6 leases.
+///
+/// The SQL backends order the IPv6 leases by the textual representation
+/// of the address, so the page can't be limited to the subnet prefix
+/// and there is no "to" argument. The "subnet-id" only filters the leases.
+///
+/// @param args Arguments of the command.
+/// @param size_name Name of the argument specifying the page size.
+///
+/// @return Parameters of the query.
+/// @throw BadValue if the arguments are invalid.
+Lease6PageQuery
+parseLease6PageQuery(const ConstElementPtr& args, const std::string& size_name) {
+    Lease6PageQuery query;
+    if (!args) {
+        return (query);
+    }
+    if (args->getType() != Element::map) {
+        isc_throw(isc::BadValue, "arguments must be a map");
+    }
+
+    ConstElementPtr value = args->get("from");
+    if (value && ((value->getType() != Element::string) ||
+                  (value->stringValue() != "start"))) {
+        query.lower_bound_ = getAddress6("from", value);
+    }
+
+    value = args->get(size_name);
+    if (value) {
+        query.page_size_ = static_cast<size_t>
+            (getPositive(size_name, value, LeaseCmds::MAX_PAGE_SIZE));
+    }
+
+    value = args->get("subnet-id");
+    if (value) {
+        query.subnet_id_ = static_cast<SubnetID>
+            (getPositive("subnet-id", value,
+                         std::numeric_limits<SubnetID>::max()));
+    }
+
+    return (query);
+}
+
+/// @brief Reads the page of IPv4 leases from the current lease manager.
+///
+/// @param query Parameters of the query.
+///
+/// @return Leases in the page.
+Lease4Collection
+getLeases4Page(const Lease4PageQuery& query) {
+    // The bounds may be out of order if the query has been limited to
+    // the subnet prefix.
+    if (query.upper_bound_ <= query.lower_bound_) {
+        return (Lease4Collection());
+    }
+    return (LeaseMgrFactory::instance().getLeases4Page(query.lower_bound_,
+                                                       query.upper_bound_,
+                                                       query.subnet_id_,
+                                                       query.page_size_));
+}
+
+/// @brief Reads the page of IPv6 leases from the current lease manager.
+///
+/// @param query Parameters of the query.
+///
+/// @return Leases in the page.
+Lease6Collection
+getLeases6Page(const Lease6PageQuery& query) {
+    return (LeaseMgrFactory::instance().getLeases6Page(query.lower_bound_,
+                                                       query.subnet_id_,
+                                                       query.page_size_));
+}
+
+/// @brief Reads the page of the leases from the current lease manager.
+///
+/// @param query Parameters of the query.
+/// @param [out] page Leases in the page.
+void
+getLeasesPage(const Lease4PageQuery& query, Lease4Collection& page) {
+    page = getLeases4Page(query);
+}
+
+/// @brief Reads the page of the leases from the current lease manager.
+///
+/// @param query Parameters of the query.
+/// @param [out] page Leases in the page.
+void
+getLeasesPage(const Lease6PageQuery& query, Lease6Collection& page) {
+    page = getLeases6Page(query);
+}
+
+/// @brief Generator of the response to the 'lease4-export' and
+/// 'lease6-export' commands.
+///
+/// The generator returns one page of the leases at a time. The next page
+/// is read when the previous page has been sent.
+///
+/// @tparam PageQuery Type of the parameters of the query.
+/// @tparam LeaseCollection Type of the collection holding the page.
+template<typename PageQuery, typename LeaseCollection>
+class LeaseExporter {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Reads the first page of the leases.
+    ///
+    /// @param query Parameters of the query.
+    /// @param family Text describing the leases, i.e. "IPv4" or "IPv6".
+    LeaseExporter(const PageQuery& query, const std::string& family)
+        : query_(query), family_(family), started_(false), count_(0) {
+        getLeasesPage(query_, page_);
+    }
+
+    /// @brief Appends the next part of the response.
+    ///
+    /// @param [out] part Text to which the part is appended.
+    ///
+    /// @return true if more parts follow.
+    bool next(std::string& part) {
+        if (!started_) {
+            part.append("{ \"arguments\": { \"leases\": [ ");
+            started_ = true;
+        } else {
+            getLeasesPage(query_, page_);
+        }
+
+        for (typename LeaseCollection::const_iterator lease = page_.begin();
+             lease != page_.end(); ++lease) {
+            if (count_ > 0) {
+                part.append(", ");
+            }
+            part.append((*lease)->toElement()->str());
+            ++count_;
+        }
+
+        // The page which isn't full is the last one.
+        if (page_.size() < query_.page_size_) {
+            std::ostringstream trailer;
+            trailer << " ], \"count\": " << count_ << " }, \"result\": "
+                    << CONTROL_RESULT_SUCCESS << ", \"text\": \"" << count_
+                    << " " << family_ << " lease(s) exported.\" }";
+            part.append(trailer.str());
+            page_.clear();
+            return (false);
+        }
+
+        query_.lower_bound_ = page_.back()->addr_;
+        page_.clear();
+        return (true);
+    }
+
+private:
+
+    /// @brief Parameters of the query for the next page.
+    PageQuery query_;
+
+    /// @brief Text describing the leases.
+    std::string family_;
+
+    /// @brief Page of the leases to be returned.
+    LeaseCollection page_;
+
+    /// @brief Indicates that the response has been started.
+    bool started_;
+
+    /// @brief Number of leases returned so far.
+    size_t count_;
+};
+
+/// @brief Generator of the response to the 'lease4-export' command.
+typedef LeaseExporter<Lease4PageQuery, Lease4Collection> Lease4Exporter;
+
+/// @brief Generator of the response to the 'lease6-export' command.
+typedef LeaseExporter<Lease6PageQuery, Lease6Collection> Lease6Exporter;
+
+/// @brief Changes of the lease statistics caused by the imported leases.
+///
+/// The changes are accumulated for all leases and applied to the
+/// statistics once per subnet, rather than once per lease.
+class Lease4StatsDelta {
+public:
+
+    /// @brief Accounts for the lease added or removed.
+    ///
+    /// @param lease Lease added or removed.
+    /// @param delta 1 if the lease has been added, -1 if it has been
+    /// removed.
+    void count(const Lease4& lease, const int64_t delta) {
+        if (lease.state_ == Lease::STATE_DEFAULT) {
+            deltas_[lease.subnet_id_].first += delta;
+        } else if (lease.state_ == Lease::STATE_DECLINED) {
+            deltas_[lease.subnet_id_].second += delta;
+        }
+    }
+
+    /// @brief Updates the statistics.
+    void apply() const {
+        StatsMgr& stats_mgr = StatsMgr::instance();
+        int64_t declined = 0;
+        for (std::map<SubnetID, std::pair<int64_t, int64_t> >::const_iterator
+                 delta = deltas_.begin(); delta != deltas_.end(); ++delta) {
+            if (delta->second.first != 0) {
+                stats_mgr.addValue(StatsMgr::generateName("subnet",
+                                                          delta->first,
+                                                          "assigned-addresses"),
+                                   delta->second.first);
+            }
+            if (delta->second.second != 0) {
+                stats_mgr.addValue(StatsMgr::generateName("subnet",
+                                                          delta->first,
+                                                          "declined-addresses"),
+                                   delta->second.second);
+                declined += delta->second.second;
+            }
+        }
+        if (declined != 0) {
+            stats_mgr.addValue("declined-addresses", declined);
+        }
+    }
+
+private:
+
+    /// @brief Changes of the assigned and declined addresses by subnet.
+    std::map<SubnetID, std::pair<int64_t, int64_t> > deltas_;
+};
+
+/// @brief Parses and validates the leases to be imported.
+///
+/// The subnet of each lease is checked against the current configuration.
+/// The lease without the subnet identifier is assigned to the subnet
+/// selected by its address.
+///
+/// @param args Arguments of the command.
+///
+/// @return Leases to be imported.
+/// @throw BadValue if any of the leases is invalid. The message specifies
+/// the position of the lease in the list.
+Lease4Collection
+parseLeases4(const ConstElementPtr& args) {
+    if (!args || (args->getType() != Element::map)) {
+        isc_throw(isc::BadValue, "arguments must be a map");
+    }
+    ConstElementPtr leases_list = args->get("leases");
+    if (!leases_list || (leases_list->getType() != Element::list)) {
+        isc_throw(isc::BadValue, "'leases' must be a list");
+    }
+
+    ConstCfgSubnets4Ptr subnets =
+        CfgMgr::instance().getCurrentCfg()->getCfgSubnets4();
+    const std::vector<ElementPtr>& elements = leases_list->listValue();
+    Lease4Collection leases;
+    leases.reserve(elements.size());
+    std::set<IOAddress> addrs;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        try {
+            Lease4Ptr lease = Lease4::fromElement(elements[i]);
+            Subnet4Ptr subnet;
+            if (lease->subnet_id_ == 0) {
+                subnet = subnets->selectSubnet(lease->addr_);
+                if (!subnet) {
+                    isc_throw(isc::BadValue, "no subnet for the address "
+                              << lease->addr_);
+                }
+                lease->subnet_id_ = subnet->getID();
+
+            } else {
+                subnet = subnets->getSubnet(lease->subnet_id_);
+                if (!subnet) {
+                    isc_throw(isc::BadValue, "no subnet with the id "
+                              << lease->subnet_id_);
+                }
+                if (!subnet->inRange(lease->addr_)) {
+                    isc_throw(isc::BadValue, "the address " << lease->addr_
+                              << " doesn't belong to the subnet "
+                              << subnet->toText());
+                }
+            }
+            if (!addrs.insert(lease->addr_).second) {
+                isc_throw(isc::BadValue, "duplicate lease for the address "
+                          << lease->addr_);
+            }
+            leases.push_back(lease);
+
+        } catch (const std::exception& ex) {
+            isc_throw(isc::BadValue, "lease " << i << ": " << ex.what());
+        }
+    }
+    return (leases);
+}
+
+}
+
+namespace isc {
+namespace dhcp {
+
+const size_t LeaseCmds::DEFAULT_PAGE_SIZE;
+const size_t LeaseCmds::MAX_PAGE_SIZE;
+
+ConstElementPtr
+LeaseCmds::lease4GetPageHandler(const std::string&,
+                                const ConstElementPtr& args) {
+    try {
+        const Lease4PageQuery query = parseLease4PageQuery(args, "limit");
+        const Lease4Collection page = getLeases4Page(query);
+
+        ElementPtr leases = Element::createList();
+        for (Lease4Collection::const_iterator lease = page.begin();
+             lease != page.end(); ++lease) {
+            leases->add((*lease)->toElement());
+        }
+        ElementPtr result = Element::createMap();
+        result->set("leases", leases);
+        result->set("count", Element::create(static_cast<long int>(page.size())));
+
+        std::ostringstream text;
+        text << page.size() << " IPv4 lease(s) found.";
+        return (createAnswer(CONTROL_RESULT_SUCCESS, text.str(), result));
+
+    } catch (const std::exception& ex) {
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+}
+
+ResponseGenerator
+LeaseCmds::lease4ExportHandler(const std::string&,
+                               const ConstElementPtr& args) {
+    try {
+        boost::shared_ptr<Lease4Exporter>
+            exporter(new Lease4Exporter(parseLease4PageQuery(args, "page-size"),
+                                        "IPv4"));
+        return (boost::bind(&Lease4Exporter::next, exporter, _1));
+
+    } catch (const std::exception& ex) {
+        return (CommandMgr::createResponseGenerator
+                (createAnswer(CONTROL_RESULT_ERROR, ex.what())));
+    }
+}
+
+ConstElementPtr
+LeaseCmds::lease6GetPageHandler(const std::string&,
+                                const ConstElementPtr& args) {
+    try {
+        const Lease6PageQuery query = parseLease6PageQuery(args, "limit");
+        const Lease6Collection page = getLeases6Page(query);
+
+        ElementPtr leases = Element::createList();
+        for (Lease6Collection::const_iterator lease = page.begin();
+             lease != page.end(); ++lease) {
+            leases->add((*lease)->toElement());
+        }
+        ElementPtr result = Element::createMap();
+        result->set("leases", leases);
+        result->set("count", Element::create(static_cast<long int>(page.size())));
+
+        std::ostringstream text;
+        text << page.size() << " IPv6 lease(s) found.";
+        return (createAnswer(CONTROL_RESULT_SUCCESS, text.str(), result));
+
+    } catch (const std::exception& ex) {
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+}
+
+ResponseGenerator
+LeaseCmds::lease6ExportHandler(const std::string&,
+                               const ConstElementPtr& args) {
+    try {
+        boost::shared_ptr<Lease6Exporter>
+            exporter(new Lease6Exporter(parseLease6PageQuery(args, "page-size"),
+                                        "IPv6"));
+        return (boost::bind(&Lease6Exporter::next, exporter, _1));
+
+    } catch (const std::exception& ex) {
+        return (CommandMgr::createResponseGenerator
+                (createAnswer(CONTROL_RESULT_ERROR, ex.what())));
+    }
+}
+
+ConstElementPtr
+LeaseCmds::lease4ImportHandler(const std::string&,
+                               const ConstElementPtr& args) {
+    try {
+        // All leases are validated before any of them is stored.
+        const Lease4Collection leases = parseLeases4(args);
+        const Lease4Collection replaced =
+            LeaseMgrFactory::instance().storeLeases4(leases);
+
+        Lease4StatsDelta stats;
+        for (Lease4Collection::const_iterator lease = leases.begin();
+             lease != leases.end(); ++lease) {
+            stats.count(**lease, 1);
+        }
+        for (Lease4Collection::const_iterator lease = replaced.begin();
+             lease != replaced.end(); ++lease) {
+            stats.count(**lease, -1);
+        }
+        stats.apply();
+
+        ElementPtr result = Element::createMap();
+        result->set("added", Element::create(static_cast<long int>
+                                             (leases.size() - replaced.size())));
+        result->set("replaced", Element::create(static_cast<long int>
+                                                (replaced.size())));
+
+        std::ostringstream text;
+        text << leases.size() << " IPv4 lease(s) imported.";
+        return (createAnswer(CONTROL_RESULT_SUCCESS, text.str(), result));
+
+    } catch (const std::exception& ex) {
+        return (createAnswer(CONTROL_RESULT_ERROR, ex.what()));
+    }
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
@@ -0,0 +1,158 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef LEASE_CMDS_H
+#define LEASE_CMDS_H
+
+#include <cc/data.h>
+#include <config/command_socket.h>
+#include <string>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Handlers of the control commands reading and importing the leases.
+///
+/// The leases are read from the current lease manager in pages ordered by
+/// address, using @ref LeaseMgr::getLeases4Page. Each page is found using
+/// the address index of the lease manager, so the cost of reading a page
+/// doesn't depend on its position.
+///
+/// The 'lease4-get-page' command returns a single page of the leases:
+/// @code
+/// {
+///     "command": "lease4-get-page",
+///     "arguments": {
+///         "subnet-id": 1,
+///         "from": "192.0.2.10",
+///         "to": "192.0.2.200",
+///         "limit": 100
+///     }
+/// }
+/// @endcode
+///
+/// All arguments are optional. The "from" argument is the address of the
+/// last lease returned in the previous page or "start" (default) to get
+/// the first page. The "to" argument limits the addresses of the returned
+/// leases. If the "subnet-id" is specified, only the leases belonging to
+/// this subnet are returned and, if the subnet is configured, the range of
+/// the addresses is limited to its prefix. The "limit" is the maximum number
+/// of leases returned, by default @c DEFAULT_PAGE_SIZE. The response holds
+/// the "leases" list and their "count". The page holding less leases than
+/// the limit is the last one.
+///
+/// The 'lease4-export' command takes the same arguments, except that the
+/// "limit" is replaced by the "page-size" used to read the leases from
+/// the lease manager, and returns all leases in a single response of the
+/// same format. The response is generated by the @ref ResponseGenerator
+/// reading the next page of the leases only when the previous page has
+/// been sent, so millions of leases can be exported without holding them
+/// in memory and without stalling the packet processing.
+///
+/// The 'lease6-get-page' and 'lease6-export' commands return IPv6 leases
+/// read using @ref LeaseMgr::getLeases6Page. They take the same arguments
+/// as their IPv4 counterparts, except for the "to" argument. The SQL
+/// backends order the IPv6 leases by the textual form of the address, so
+/// the "subnet-id" filters the leases, but doesn't limit the range of the
+/// addresses. The Cassandra backend doesn't support the paging and these
+/// commands return the error before any lease is sent.
+///
+/// The 'lease4-import' command adds or replaces the leases in the format
+/// returned by the commands above:
+/// @code
+/// {
+///     "command": "lease4-import",
+///     "arguments": {
+///         "leases": [
+///             {
+///                 "ip-address": "192.0.2.10",
+///                 "hw-address": "08:00:2b:02:3f:4e",
+///                 "subnet-id": 1,
+///                 "valid-lft": 3600
+///             }
+///         ]
+///     }
+/// }
+/// @endcode
+///
+/// All leases are validated against the configured subnets before any of
+/// them is stored, so the invalid lease causes the whole list to be
+/// rejected. The lease without the "subnet-id" is assigned to the subnet
+/// selected by its address. The leases are stored with a single call to
+/// @ref LeaseMgr::storeLeases4 and the lease statistics are updated once
+/// per subnet. The response holds the numbers of the "added" and
+/// "replaced" leases.
+class LeaseCmds {
+public:
+
+    /// @brief Default number of leases in the page.
+    static const size_t DEFAULT_PAGE_SIZE = 1000;
+
+    /// @brief Maximum number of leases in the page.
+    static const size_t MAX_PAGE_SIZE = 65536;
+
+    /// @brief Handler for the 'lease4-get-page' command.
+    ///
+    /// @param command Name of the command (ignored).
+    /// @param args Arguments of the command.
+    ///
+    /// @return Response holding the page of the leases or the error.
+    static isc::data::ConstElementPtr
+    lease4GetPageHandler(const std::string& command,
+                         const isc::data::ConstElementPtr& args);
+
+    /// @brief Handler for the 'lease4-export' command.
+    ///
+    /// The arguments are checked and the first page of the leases is read
+    /// by this handler, so as the errors are reported in the response.
+    ///
+    /// @param command Name of the command (ignored).
+    /// @param args Arguments of the command.
+    ///
+    /// @return Generator of the response holding all leases or the error.
+    static config::ResponseGenerator
+    lease4ExportHandler(const std::string& command,
+                        const isc::data::ConstElementPtr& args);
+
+    /// @brief Handler for the 'lease6-get-page' command.
+    ///
+    /// @param command Name of the command (ignored).
+    /// @param args Arguments of the command.
+    ///
+    /// @return Response holding the page of the leases or the error.
+    static isc::data::ConstElementPtr
+    lease6GetPageHandler(const std::string& command,
+                         const isc::data::ConstElementPtr& args);
+
+    /// @brief Handler for the 'lease6-export' command.
+    ///
+    /// The arguments are checked and the first page of the leases is read
+    /// by this handler, so as the errors are reported in the response.
+    ///
+    /// @param command Name of the command (ignored).
+    /// @param args Arguments of the command.
+    ///
+    /// @return Generator of the response holding all leases or the error.
+    static config::ResponseGenerator
+    lease6ExportHandler(const std::string& command,
+                        const isc::data::ConstElementPtr& args);
+
+    /// @brief Handler for the 'lease4-import' command.
+    ///
+    /// @param command Name of the command (ignored).
+    /// @param args Arguments of the command.
+    ///
+    /// @return Response holding the numbers of the stored leases or the
+    /// error.
+    static isc::data::ConstElementPtr
+    lease4ImportHandler(const std::string& command,
+                        const isc::data::ConstElementPtr& args);
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // LEASE_CMDS_H
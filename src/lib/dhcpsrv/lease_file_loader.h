@@ -67,7 +67,8 @@ public:
     /// for writing future lease updates.
     /// @tparam LeaseObjectType A @c Lease4 or @c Lease6.
     /// @tparam LeaseFileType A @c CSVLeaseFile4 or @c CSVLeaseFile6.
-    /// @tparam StorageType A @c Lease4Storage or @c Lease6Storage.
+    /// @tparam StorageType A @c Lease4Storage, @c Lease4RecordStorage or
+    /// @c Lease6Storage.
     ///
     /// @throw isc::util::CSVFileError when the maximum number of errors
     /// has been exceeded.
@@ -129,7 +130,7 @@ public:
                 // it has a positive valid lifetime.
                 if (lease_it == storage.end()) {
                     if (lease->valid_lft_ > 0) {
-                        storage.insert(lease);
+                        storage.insert(typename StorageType::value_type(lease));
                     }
                 } else {
                     // The lease exists. If the new entry has a valid
@@ -140,7 +141,8 @@ public:
 
                     } else {
                         // Use replace to re-index leases on update.
-                        storage.replace(lease_it, lease);
+                        storage.replace(lease_it,
+                                        typename StorageType::value_type(lease));
                     }
                 }
 
@@ -27,6 +27,64 @@
 
 using namespace std;
 
+namespace {
+
+/// @brief Orders the leases by expiration time and address.
+///
+/// @param lease1 First lease.
+/// @param lease2 Second lease.
+///
+/// @return true if the first lease precedes the second one.
+template<typename LeasePtrType>
+bool
+expiresEarlier(const LeasePtrType& lease1, const LeasePtrType& lease2) {
+    const int64_t expire1 = lease1->getExpirationTime();
+    const int64_t expire2 = lease2->getExpirationTime();
+    return ((expire1 < expire2) ||
+            ((expire1 == expire2) && (lease1->addr_ < lease2->addr_)));
+}
+
+/// @brief Selects the expired leases following the specified position.
+///
+/// The leases preceding the position are dropped first and only the
+/// leases of the returned slice are sorted.
+///
+/// @param candidates Expired leases in any order. The collection is
+/// modified by this function.
+/// @param max_leases Maximum number of leases to be selected or 0.
+/// @param last_expire Expiration time of the position.
+/// @param last_address Address of the position.
+/// @param [out] expired_leases Container to which the leases are added.
+template<typename LeaseCollection>
+void
+selectNextExpiredLeasesCommon(LeaseCollection& candidates,
+                              const size_t max_leases,
+                              const int64_t last_expire,
+                              const isc::asiolink::IOAddress& last_address,
+                              LeaseCollection& expired_leases) {
+    typename LeaseCollection::iterator next = candidates.begin();
+    for (typename LeaseCollection::const_iterator lease = candidates.begin();
+         lease != candidates.end(); ++lease) {
+        const int64_t expire = (*lease)->getExpirationTime();
+        if ((expire > last_expire) ||
+            ((expire == last_expire) && (last_address < (*lease)->addr_))) {
+            *next++ = *lease;
+        }
+    }
+    candidates.erase(next, candidates.end());
+
+    const size_t selected = ((max_leases == 0) ||
+                             (max_leases > candidates.size()) ?
+                             candidates.size() : max_leases);
+    std::partial_sort(candidates.begin(), candidates.begin() + selected,
+                      candidates.end(),
+                      expiresEarlier<typename LeaseCollection::value_type>);
+    expired_leases.insert(expired_leases.end(), candidates.begin(),
+                          candidates.begin() + selected);
+}
+
+} // end of anonymous namespace
+
 namespace isc {
 namespace dhcp {
 
@@ -47,6 +105,167 @@ LeaseMgr::getLease6(Lease::Type type, const DUID& duid,
     return (*col.begin());
 }
 
+void
+LeaseMgr::asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                         const Lease4Handler& handler) {
+    Lease4Ptr lease;
+    std::string error;
+    try {
+        lease = getLease4(addr);
+    } catch (const std::exception& ex) {
+        error = ex.what();
+    }
+    handler(lease, error);
+}
+
+void
+LeaseMgr::asyncGetLease4(const HWAddr& hwaddr, SubnetID subnet_id,
+                         const Lease4Handler& handler) {
+    Lease4Ptr lease;
+    std::string error;
+    try {
+        lease = getLease4(hwaddr, subnet_id);
+    } catch (const std::exception& ex) {
+        error = ex.what();
+    }
+    handler(lease, error);
+}
+
+void
+LeaseMgr::asyncGetLease4(const ClientId& clientid, SubnetID subnet_id,
+                         const Lease4Handler& handler) {
+    Lease4Ptr lease;
+    std::string error;
+    try {
+        lease = getLease4(clientid, subnet_id);
+    } catch (const std::exception& ex) {
+        error = ex.what();
+    }
+    handler(lease, error);
+}
+
+void
+LeaseMgr::updateLeases4(const Lease4Collection& leases) {
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        updateLease4(*lease);
+    }
+}
+
+uint64_t
+LeaseMgr::deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs) {
+    uint64_t deleted = 0;
+    for (std::vector<isc::asiolink::IOAddress>::const_iterator addr =
+             addrs.begin(); addr != addrs.end(); ++addr) {
+        if (deleteLease(*addr)) {
+            ++deleted;
+        }
+    }
+    return (deleted);
+}
+
+Lease4Collection
+LeaseMgr::storeLeases4(const Lease4Collection& leases) {
+    Lease4Collection replaced;
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        Lease4Ptr old_lease = getLease4((*lease)->addr_);
+        if (old_lease) {
+            updateLease4(*lease);
+            replaced.push_back(old_lease);
+
+        } else if (!addLease(*lease)) {
+            isc_throw(DbOperationError, "failed to store the lease with"
+                      " address " << (*lease)->addr_ << ": the lease has"
+                      " been added concurrently");
+        }
+    }
+    return (replaced);
+}
+
+Lease4Collection
+LeaseMgr::getLeases4Page(const isc::asiolink::IOAddress&,
+                         const isc::asiolink::IOAddress&,
+                         const SubnetID&, const size_t) const {
+    isc_throw(NotImplemented, "getting IPv4 leases in pages is not supported"
+              " by the " << getType() << " backend");
+}
+
+void
+LeaseMgr::checkLeases4PageArgs(const isc::asiolink::IOAddress& lower_bound_address,
+                               const isc::asiolink::IOAddress& upper_bound_address,
+                               const size_t page_size) {
+    if (!lower_bound_address.isV4() || !upper_bound_address.isV4()) {
+        isc_throw(BadValue, "the bounds of the IPv4 lease page must be IPv4"
+                  " addresses, not " << lower_bound_address << " and "
+                  << upper_bound_address);
+    }
+    if (page_size == 0) {
+        isc_throw(BadValue, "the IPv4 lease page size must be greater than 0");
+    }
+}
+
+Lease6Collection
+LeaseMgr::getLeases6Page(const isc::asiolink::IOAddress&,
+                         const SubnetID&, const size_t) const {
+    isc_throw(NotImplemented, "getting IPv6 leases in pages is not supported"
+              " by the " << getType() << " backend");
+}
+
+void
+LeaseMgr::checkLeases6PageArgs(const isc::asiolink::IOAddress& lower_bound_address,
+                               const size_t page_size) {
+    if (!lower_bound_address.isV6()) {
+        isc_throw(BadValue, "the bound of the IPv6 lease page must be an IPv6"
+                  " address, not " << lower_bound_address);
+    }
+    if (page_size == 0) {
+        isc_throw(BadValue, "the IPv6 lease page size must be greater than 0");
+    }
+}
+
+void
+LeaseMgr::getNextExpiredLeases6(Lease6Collection& expired_leases,
+                                const size_t max_leases,
+                                const int64_t last_expire,
+                                const isc::asiolink::IOAddress& last_address) const {
+    Lease6Collection all_leases;
+    getExpiredLeases6(all_leases, 0);
+    selectNextExpiredLeases6(all_leases, max_leases, last_expire, last_address,
+                             expired_leases);
+}
+
+void
+LeaseMgr::getNextExpiredLeases4(Lease4Collection& expired_leases,
+                                const size_t max_leases,
+                                const int64_t last_expire,
+                                const isc::asiolink::IOAddress& last_address) const {
+    Lease4Collection all_leases;
+    getExpiredLeases4(all_leases, 0);
+    selectNextExpiredLeases4(all_leases, max_leases, last_expire, last_address,
+                             expired_leases);
+}
+
+void
+LeaseMgr::selectNextExpiredLeases6(Lease6Collection& candidates,
+                                   const size_t max_leases,
+                                   const int64_t last_expire,
+                                   const isc::asiolink::IOAddress& last_address,
+                                   Lease6Collection& expired_leases) {
+    selectNextExpiredLeasesCommon(candidates, max_leases, last_expire,
+                                  last_address, expired_leases);
+}
+
+void
+LeaseMgr::selectNextExpiredLeases4(Lease4Collection& candidates,
+                                   const size_t max_leases,
+                                   const int64_t last_expire,
+                                   const isc::asiolink::IOAddress& last_address,
+                                   Lease4Collection& expired_leases) {
+    selectNextExpiredLeasesCommon(candidates, max_leases, last_expire,
+                                  last_address, expired_leases);
+}
+
 void
 LeaseMgr::recountLeaseStats4() {
     using namespace stats;
@@ -207,6 +426,12 @@ LeaseMgr::startLeaseStatsQuery6() {
     return(LeaseStatsQueryPtr());
 }
 
+bool
+LeaseMgr::reconfigure(const DatabaseConnection::ParameterMap&,
+                      const std::set<std::string>& changed) {
+    return (changed.empty());
+}
+
 std::string
 LeaseMgr::getDBVersion() {
     isc_throw(NotImplemented, "LeaseMgr::getDBVersion() called");
@@ -14,14 +14,17 @@
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/lease.h>
 #include <dhcpsrv/subnet.h>
+#include <dhcpsrv/database_connection.h>
 #include <dhcpsrv/db_exceptions.h>
 
+#include <boost/function.hpp>
 #include <boost/noncopyable.hpp>
 #include <boost/shared_ptr.hpp>
 
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
@@ -226,6 +229,15 @@ public:
 /// @brief Defines a pointer to an LeaseStatsQuery.
 typedef boost::shared_ptr<LeaseStatsQuery> LeaseStatsQueryPtr;
 
+/// @brief Callback invoked upon completion of an asynchronous IPv4 lease
+/// lookup.
+///
+/// The first argument holds the lease found or a null pointer if no lease
+/// matches the lookup criteria. The second argument is an empty string if
+/// the lookup was successful, or holds the error description otherwise.
+typedef boost::function<void (const Lease4Ptr&, const std::string&)>
+Lease4Handler;
+
 /// @brief Abstract Lease Manager
 ///
 /// This is an abstract API for lease database backends. It provides unified
@@ -344,6 +356,49 @@ public:
     virtual Lease4Ptr getLease4(const ClientId& clientid,
                                 SubnetID subnet_id) const = 0;
 
+    /// @brief Asynchronously returns an IPv4 lease for specified IPv4
+    /// address.
+    ///
+    /// The @c handler is invoked when the lookup completes. The default
+    /// implementation performs the lookup synchronously with @c getLease4
+    /// and invokes the handler before returning. Backends supporting
+    /// non-blocking queries override this method and invoke the handler
+    /// when the result is received from the database, so as the caller can
+    /// continue processing other packets in the meantime.
+    ///
+    /// @param addr address of the searched lease
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                                const Lease4Handler& handler);
+
+    /// @brief Asynchronously returns an IPv4 lease for specified hardware
+    /// address and a subnet.
+    ///
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const isc::dhcp::HWAddr& hwaddr,
+                                SubnetID subnet_id,
+                                const Lease4Handler& handler);
+
+    /// @brief Asynchronously returns an IPv4 lease for specified client-id
+    /// and a subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const ClientId& clientid,
+                                SubnetID subnet_id,
+                                const Lease4Handler& handler);
+
+    /// @brief Returns the number of asynchronous lookups in progress.
+    ///
+    /// @return Number of lookups whose handlers haven't been invoked yet.
+    /// The default implementation always returns 0.
+    virtual size_t getAsyncPending() const {
+        return (0);
+    }
+
     /// @brief Returns existing IPv6 lease for a given IPv6 address.
     ///
     /// For a given address, we assume that there will be only one lease.
@@ -439,6 +494,115 @@ public:
     virtual void getExpiredLeases4(Lease4Collection& expired_leases,
                                    const size_t max_leases) const = 0;
 
+    /// @brief Returns a collection of expired DHCPv6 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The expired (but not reclaimed) leases are ordered by expiration
+    /// time and address, where the order of the addresses may be specific
+    /// to the backend. This method returns at most @c max_leases of them,
+    /// starting after the specified expiration time and address, i.e. after
+    /// the last lease returned by the previous call. It is used to fetch
+    /// the expired leases in slices. The leases which remain expired after
+    /// they have been processed, e.g. because the callouts skipped their
+    /// reclamation, are not returned again by the next slice.
+    ///
+    /// The default implementation fetches all expired leases using
+    /// @c getExpiredLeases6 and sorts the ones of the returned slice. All
+    /// backends override it, so as the next slice is searched by expiration
+    /// time rather than by fetching all expired leases again.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the database backend are added.
+    /// @param max_leases A maximum number of leases to be returned. If this
+    /// value is set to 0, all following expired leases are returned.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call or the lowest @c int64_t value to start from the first
+    /// expired lease.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases6(Lease6Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// See @c getNextExpiredLeases6 for details. The default implementation
+    /// fetches all expired leases using @c getExpiredLeases4 and orders them.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the database backend are added.
+    /// @param max_leases A maximum number of leases to be returned. If this
+    /// value is set to 0, all following expired leases are returned.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call or the lowest @c int64_t value to start from the first
+    /// expired lease.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases4(Lease4Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a page of IPv4 leases ordered by address.
+    ///
+    /// This method is used to read a large number of leases in pages of
+    /// a limited size, e.g. to export them. The next page is obtained by
+    /// passing the address of the last lease of the previous page as the
+    /// lower bound (keyset pagination). Unlike the offset based pagination,
+    /// the pages don't skip or repeat leases when other leases are added or
+    /// removed between the calls, and each page is found using the address
+    /// index rather than by walking all the preceding leases.
+    ///
+    /// The default implementation throws @c isc::NotImplemented.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses greater than this address.
+    /// @param upper_bound_address The page includes the leases with the
+    /// addresses lower than or equal to this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    /// @throw isc::BadValue if the bounds aren't IPv4 addresses or the page
+    /// size is 0.
+    virtual Lease4Collection
+    getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const isc::asiolink::IOAddress& upper_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Returns a page of IPv6 leases ordered by address.
+    ///
+    /// This is the IPv6 counterpart of @c getLeases4Page. The next page is
+    /// obtained by passing the address of the last lease of the previous
+    /// page as the lower bound. The memfile backend orders the leases by
+    /// the numeric value of the address. The SQL backends store the IPv6
+    /// addresses as text and order the leases by this text, so the pages
+    /// are not in the numeric order, but they still neither skip nor repeat
+    /// leases. Passing the "::" address as the lower bound returns the
+    /// first page in either case.
+    ///
+    /// The default implementation throws @c isc::NotImplemented.
+    ///
+    /// @param lower_bound_address The page includes the leases following
+    /// this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    /// @throw isc::BadValue if the bound isn't an IPv6 address or the page
+    /// size is 0.
+    virtual Lease6Collection
+    getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
     /// @brief Updates IPv4 lease.
     ///
     /// @param lease4 The lease to be updated.
@@ -459,6 +623,50 @@ public:
     /// @return true if deletion was successful, false if no such lease exists
     virtual bool deleteLease(const isc::asiolink::IOAddress& addr) = 0;
 
+    /// @brief Updates a collection of IPv4 leases.
+    ///
+    /// This method is used by the lease reclamation routines to update
+    /// multiple leases with a single call. The default implementation
+    /// calls @c updateLease4 for each lease. Backends supporting
+    /// transactions override it to update all leases within a single
+    /// transaction, which significantly reduces the number of round trips
+    /// and commits.
+    ///
+    /// @param leases Collection of leases to be updated.
+    ///
+    /// @throw isc::dhcp::NoSuchLease if any of the leases doesn't exist.
+    /// In such case, backends supporting transactions don't update any
+    /// of the leases.
+    virtual void updateLeases4(const Lease4Collection& leases);
+
+    /// @brief Deletes a collection of IPv4 leases.
+    ///
+    /// The default implementation calls @c deleteLease for each address.
+    /// Backends supporting transactions override it to remove all leases
+    /// within a single transaction or with a single query.
+    ///
+    /// @param addrs Addresses of the leases to be deleted.
+    ///
+    /// @return Number of leases deleted.
+    virtual uint64_t
+    deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs);
+
+    /// @brief Stores a collection of IPv4 leases.
+    ///
+    /// This method is used to import large number of leases with a single
+    /// call. The leases which don't exist are added and the existing leases
+    /// are replaced. The default implementation calls @c addLease or
+    /// @c updateLease4 for each lease. Backends supporting transactions
+    /// override it to store all leases within a single transaction and the
+    /// memfile backend writes all leases to the lease file at once.
+    ///
+    /// @param leases Collection of leases to be stored. It must not hold
+    /// more than one lease for the same address.
+    ///
+    /// @return Leases replaced by the stored ones. The caller uses them
+    /// to update the lease statistics.
+    virtual Lease4Collection storeLeases4(const Lease4Collection& leases);
+
     /// @brief Deletes all expired and reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -539,6 +747,31 @@ public:
     /// @return A populated LeaseStatsQuery
     virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
 
+    /// @brief Applies new database access parameters to the running backend.
+    ///
+    /// This method is called by the @c LeaseMgrFactory when the server is
+    /// reconfigured and the lease database access parameters are the same
+    /// as those the backend has been created with, or differ only in the
+    /// parameters listed in @c changed. The backend which can apply the
+    /// changed parameters without reopening the database returns true and
+    /// is kept, so as the connections and the lease data are not reloaded.
+    /// Otherwise, the factory recreates the backend.
+    ///
+    /// The backend must also restore its state which the server has reset
+    /// for the new configuration, e.g. re-register its timers.
+    ///
+    /// The default implementation accepts unchanged parameters only.
+    ///
+    /// @param parameters New database access parameters.
+    /// @param changed Names of the parameters which have been added, removed
+    /// or which values differ from those the backend has been created with.
+    ///
+    /// @return true if the backend has been reconfigured, false if it has
+    /// to be recreated.
+    virtual bool
+    reconfigure(const DatabaseConnection::ParameterMap& parameters,
+                const std::set<std::string>& changed);
+
     /// @brief Return backend type
     ///
     /// Returns the type of the backend (e.g. "mysql", "memfile" etc.)
@@ -592,6 +825,74 @@ public:
     /// @todo: Add host management here
     /// As host reservation is outside of scope for 2012, support for hosts
     /// is currently postponed.
+
+protected:
+
+    /// @brief Selects the expired DHCPv6 leases following the specified
+    /// position in the expiration order.
+    ///
+    /// It is used by the backends which can't return the expired leases
+    /// ordered by expiration time and address. The leases preceding the
+    /// position are dropped and only the selected leases are sorted.
+    ///
+    /// @param candidates Expired leases in any order. The collection is
+    /// modified by this function.
+    /// @param max_leases Maximum number of leases to be selected or 0 to
+    /// select all leases following the position.
+    /// @param last_expire Expiration time of the position.
+    /// @param last_address Address of the position.
+    /// @param [out] expired_leases Container to which the selected leases
+    /// are appended in the expiration order.
+    static void
+    selectNextExpiredLeases6(Lease6Collection& candidates,
+                             const size_t max_leases,
+                             const int64_t last_expire,
+                             const isc::asiolink::IOAddress& last_address,
+                             Lease6Collection& expired_leases);
+
+    /// @brief Selects the expired DHCPv4 leases following the specified
+    /// position in the expiration order.
+    ///
+    /// See @c selectNextExpiredLeases6 for details.
+    ///
+    /// @param candidates Expired leases in any order. The collection is
+    /// modified by this function.
+    /// @param max_leases Maximum number of leases to be selected or 0 to
+    /// select all leases following the position.
+    /// @param last_expire Expiration time of the position.
+    /// @param last_address Address of the position.
+    /// @param [out] expired_leases Container to which the selected leases
+    /// are appended in the expiration order.
+    static void
+    selectNextExpiredLeases4(Lease4Collection& candidates,
+                             const size_t max_leases,
+                             const int64_t last_expire,
+                             const isc::asiolink::IOAddress& last_address,
+                             Lease4Collection& expired_leases);
+
+    /// @brief Checks the arguments of @c getLeases4Page.
+    ///
+    /// @param lower_bound_address Lower bound of the page.
+    /// @param upper_bound_address Upper bound of the page.
+    /// @param page_size Maximum number of leases in the page.
+    ///
+    /// @throw isc::BadValue if the bounds aren't IPv4 addresses or the page
+    /// size is 0.
+    static void
+    checkLeases4PageArgs(const isc::asiolink::IOAddress& lower_bound_address,
+                         const isc::asiolink::IOAddress& upper_bound_address,
+                         const size_t page_size);
+
+    /// @brief Checks the arguments of @c getLeases6Page.
+    ///
+    /// @param lower_bound_address Lower bound of the page.
+    /// @param page_size Maximum number of leases in the page.
+    ///
+    /// @throw isc::BadValue if the bound isn't an IPv6 address or the page
+    /// size is 0.
+    static void
+    checkLeases6PageArgs(const isc::asiolink::IOAddress& lower_bound_address,
+                         const size_t page_size);
 };
 
 }; // end of isc::dhcp namespace
@@ -6,6 +6,7 @@
 
 #include <config.h>
 
+#include <dhcpsrv/cached_lease_mgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/memfile_lease_mgr.h>
@@ -21,11 +22,14 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/foreach.hpp>
+#include <boost/lexical_cast.hpp>
 
 #include <algorithm>
 #include <iostream>
 #include <iterator>
+#include <limits>
 #include <map>
+#include <set>
 #include <sstream>
 #include <utility>
 
@@ -40,6 +44,12 @@ LeaseMgrFactory::getLeaseMgrPtr() {
     return (leaseMgrPtr);
 }
 
+DatabaseConnection::ParameterMap&
+LeaseMgrFactory::getParameters() {
+    static DatabaseConnection::ParameterMap parameters;
+    return (parameters);
+}
+
 void
 LeaseMgrFactory::create(const std::string& dbaccess) {
     const std::string type = "type";
@@ -56,31 +66,42 @@ LeaseMgrFactory::create(const std::string& dbaccess) {
     }
 
 
+    // The cache size is validated before the lease manager is created.
+    const size_t cache_size = getCacheSize(parameters);
+
     // Yes, check what it is.
 #ifdef HAVE_MYSQL
     if (parameters[type] == string("mysql")) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MYSQL_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new MySqlLeaseMgr(parameters));
+        getLeaseMgrPtr().reset(enableCache(new MySqlLeaseMgr(parameters),
+                                           cache_size));
+        getParameters() = parameters;
         return;
     }
 #endif
 #ifdef HAVE_PGSQL
     if (parameters[type] == string("postgresql")) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_PGSQL_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new PgSqlLeaseMgr(parameters));
+        getLeaseMgrPtr().reset(enableCache(new PgSqlLeaseMgr(parameters),
+                                           cache_size));
+        getParameters() = parameters;
         return;
     }
 #endif
 #ifdef HAVE_CQL
     if (parameters[type] == string("cql")) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_CQL_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new CqlLeaseMgr(parameters));
+        getLeaseMgrPtr().reset(enableCache(new CqlLeaseMgr(parameters),
+                                           cache_size));
+        getParameters() = parameters;
         return;
     }
 #endif
     if (parameters[type] == string("memfile")) {
         LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_DB).arg(redacted);
-        getLeaseMgrPtr().reset(new Memfile_LeaseMgr(parameters));
+        getLeaseMgrPtr().reset(enableCache(new Memfile_LeaseMgr(parameters),
+                                           cache_size));
+        getParameters() = parameters;
         return;
     }
 
@@ -90,6 +111,79 @@ LeaseMgrFactory::create(const std::string& dbaccess) {
               "not specify a supported database backend:" << parameters[type]);
 }
 
+void
+LeaseMgrFactory::reconfigure(const std::string& dbaccess) {
+    if (haveInstance()) {
+        DatabaseConnection::ParameterMap parameters =
+            DatabaseConnection::parse(dbaccess);
+        const DatabaseConnection::ParameterMap& current = getParameters();
+
+        // Collect the names of the parameters which have been added,
+        // removed or modified.
+        std::set<std::string> changed;
+        for (DatabaseConnection::ParameterMap::const_iterator param =
+                 parameters.begin(); param != parameters.end(); ++param) {
+            DatabaseConnection::ParameterMap::const_iterator old =
+                current.find(param->first);
+            if ((old == current.end()) || (old->second != param->second)) {
+                changed.insert(param->first);
+            }
+        }
+        for (DatabaseConnection::ParameterMap::const_iterator old =
+                 current.begin(); old != current.end(); ++old) {
+            if (parameters.find(old->first) == parameters.end()) {
+                changed.insert(old->first);
+            }
+        }
+
+        // The lease manager of a different type has to be created anew.
+        // The other parameters are checked by the lease manager.
+        if ((changed.count("type") == 0) &&
+            getLeaseMgrPtr()->reconfigure(parameters, changed)) {
+            LOG_INFO(dhcpsrv_logger, DHCPSRV_LEASE_MGR_RECONFIGURED)
+                .arg(getLeaseMgrPtr()->getType())
+                .arg(DatabaseConnection::redactedAccessString(parameters));
+            getParameters() = parameters;
+            return;
+        }
+    }
+
+    destroy();
+    create(dbaccess);
+}
+
+size_t
+LeaseMgrFactory::getCacheSize(const DatabaseConnection::ParameterMap& parameters) {
+    DatabaseConnection::ParameterMap::const_iterator param =
+        parameters.find("cache-size");
+    if (param == parameters.end()) {
+        return (0);
+    }
+
+    int64_t cache_size = -1;
+    try {
+        cache_size = boost::lexical_cast<int64_t>(param->second);
+    } catch (const boost::bad_lexical_cast&) {
+        // Reported below.
+    }
+    if ((cache_size < 0) ||
+        (cache_size > std::numeric_limits<uint32_t>::max())) {
+        isc_throw(InvalidParameter, "invalid lease cache size: "
+                  << param->second);
+    }
+    return (static_cast<size_t>(cache_size));
+}
+
+LeaseMgr*
+LeaseMgrFactory::enableCache(LeaseMgr* lease_mgr, const size_t cache_size) {
+    if (cache_size == 0) {
+        return (lease_mgr);
+    }
+    LOG_INFO(dhcpsrv_logger, DHCPSRV_LEASE_CACHE_ENABLED)
+        .arg(cache_size).arg(lease_mgr->getType());
+    return (new CachedLeaseMgr(lease_mgr, cache_size));
+}
+
 void
 LeaseMgrFactory::destroy() {
     // Destroy current lease manager.  This is a no-op if no lease manager
@@ -99,6 +193,7 @@ LeaseMgrFactory::destroy() {
             .arg(getLeaseMgrPtr()->getType());
     }
     getLeaseMgrPtr().reset();
+    getParameters().clear();
 }
 
 bool 
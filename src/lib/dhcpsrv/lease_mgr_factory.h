@@ -63,12 +63,32 @@ public:
     ///        -end specific, although must include the "type" keyword which
     ///        gives the backend in use.
     ///
+    /// If the parameters include the "cache-size" keyword with a non-zero
+    /// value, the lease manager is wrapped in the @c CachedLeaseMgr which
+    /// caches up to the specified number of IPv4 leases.
+    ///
     /// @throw isc::InvalidParameter dbaccess string does not contain the "type"
-    ///        keyword.
+    ///        keyword or the "cache-size" value is invalid.
     /// @throw isc::dhcp::InvalidType The "type" keyword in dbaccess does not
     ///        identify a supported backend.
     static void create(const std::string& dbaccess);
 
+    /// @brief Reconfigure or recreate the lease manager.
+    ///
+    /// This method is used when the server is reconfigured. If the current
+    /// lease manager has been created with the same database access
+    /// parameters, or the parameters which differ can be applied by the
+    /// lease manager in place (see @c LeaseMgr::reconfigure), the current
+    /// lease manager is kept. This avoids reopening the database and, for
+    /// the memfile backend, reloading the lease files. Otherwise, the
+    /// current lease manager is destroyed and a new one is created as with
+    /// @c create.
+    ///
+    /// @param dbaccess Database access parameters.
+    ///
+    /// @throw isc::InvalidParameter, isc::dhcp::InvalidType as @c create.
+    static void reconfigure(const std::string& dbaccess);
+
     /// @brief Destroy lease manager
     ///
     /// Destroys the current lease manager object.  This should have the effect
@@ -98,6 +118,30 @@ private:
     /// fiasco" if defined in an external static variable.
     static boost::scoped_ptr<LeaseMgr>& getLeaseMgrPtr();
 
+    /// @brief Hold database access parameters of the lease manager.
+    ///
+    /// Holds the parameters with which the current lease manager has been
+    /// created or reconfigured.
+    static DatabaseConnection::ParameterMap& getParameters();
+
+    /// @brief Returns the size of the lease cache.
+    ///
+    /// @param parameters Database access parameters.
+    ///
+    /// @return Value of the "cache-size" parameter or 0 if not specified.
+    /// @throw isc::InvalidParameter the "cache-size" value is invalid.
+    static size_t getCacheSize(const DatabaseConnection::ParameterMap& parameters);
+
+    /// @brief Wraps the lease manager in the lease cache.
+    ///
+    /// @param lease_mgr Pointer to the newly created lease manager.
+    /// @param cache_size Maximum number of cached leases. If 0, the cache
+    /// is disabled.
+    ///
+    /// @return Pointer to the lease cache owning the lease manager or the
+    /// lease manager itself if the cache is disabled.
+    static LeaseMgr* enableCache(LeaseMgr* lease_mgr, const size_t cache_size);
+
 };
 
 }; // end of isc::dhcp namespace
@@ -15,12 +15,15 @@
 #include <util/pid_file.h>
 #include <util/process_spawn.h>
 #include <util/signal_set.h>
+#include <boost/make_shared.hpp>
+#include <boost/mpl/size.hpp>
 #include <cstdio>
 #include <cstring>
 #include <errno.h>
 #include <iostream>
 #include <limits>
 #include <sstream>
+#include <set>
 
 namespace {
 
@@ -309,19 +312,18 @@ protected:
 /// @brief Memfile derivation of the IPv4 statistical lease data query
 ///
 /// This class is used to recalculate IPv4 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
-/// The populated result set will contain one entry per monitored state
-/// per subnet.
+/// lease storage.  It does so by copying the lease counts per subnet,
+/// which are maintained by the backend as the leases are added, updated
+/// and removed. The populated result set will contain one entry per
+/// monitored state per subnet.
 ///
 class MemfileLeaseStatsQuery4 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param storage4 A pointer to the v4 lease storage to be counted
-    MemfileLeaseStatsQuery4(Lease4Storage& storage4)
-    : MemfileLeaseStatsQuery(), storage4_(storage4) {
+    /// @param counts The v4 lease counts per subnet
+    MemfileLeaseStatsQuery4(const SubnetLeaseCountsMap& counts)
+    : MemfileLeaseStatsQuery(), counts_(counts) {
     };
 
     /// @brief Destructor
@@ -329,64 +331,21 @@ public:
 
     /// @brief Creates the IPv4 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv4 leases in
-    /// storage, in ascending order by address, accumulating the lease state
-    /// counts per subnet. Note that walking the leases by address should
-    /// inherently group them by subnet, and while this does not guarantee
-    /// ascending order of subnet id, it should be sufficient to accumulate
-    /// state counts per subnet.  This avoids introducing an additional
-    /// subnet_id index.
-    /// At the completion of all entries for a given subnet, the counts are
-    /// used to create LeaseStatsRow instances which are appended to an
-    /// internal vector.  The process results in a vector containing one entry
-    /// per state per subnet.
+    /// The result set is populated from the lease counts, in ascending
+    /// order by subnet id. It takes time proportional to the number of
+    /// subnets rather than the number of leases.
     ///
     /// Currently the states counted are:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     void start() {
-        const Lease4StorageAddressIndex& idx
-            = storage4_.get<AddressIndexTag>();
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        for(Lease4StorageAddressIndex::const_iterator lease = idx.begin();
-            lease != idx.end(); ++lease) {
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
-                                                  assigned));
-                    assigned = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
-                                                  declined));
-                    declined = 0;
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
-            }
-
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                ++assigned;
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                ++declined;
-            }
-        }
-
-        // Make the rows for last subnet, unless there were no rows
-        if (idx.begin() != idx.end()) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DEFAULT,
-                                          assigned));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::STATE_DECLINED,
-                                          declined));
+        for (SubnetLeaseCountsMap::const_iterator counts = counts_.begin();
+             counts != counts_.end(); ++counts) {
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::STATE_DEFAULT,
+                                          counts->second.assigned_));
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::STATE_DECLINED,
+                                          counts->second.declined_));
         }
 
         // Set the next row position to the beginning of the rows.
@@ -394,27 +353,26 @@ public:
     }
 
 private:
-    /// @brief The Memfile storage containing the IPv4 leases to analyze
-    Lease4Storage& storage4_;
+    /// @brief The v4 lease counts per subnet
+    const SubnetLeaseCountsMap& counts_;
 };
 
 
 /// @brief Memfile derivation of the IPv6 statistical lease data query
 ///
 /// This class is used to recalculate IPv6 lease statistics for Memfile
-/// lease storage.  It does so by iterating over the given storage,
-/// accumulating counts of leases in each of the monitored lease states
-/// for each subnet and storing these counts in an internal collection.
-/// The populated result set will contain one entry per monitored state
-/// per subnet.
+/// lease storage.  It does so by copying the lease counts per subnet,
+/// which are maintained by the backend as the leases are added, updated
+/// and removed. The populated result set will contain one entry per
+/// monitored state per lease type per subnet.
 ///
 class MemfileLeaseStatsQuery6 : public MemfileLeaseStatsQuery {
 public:
     /// @brief Constructor
     ///
-    /// @param storage6 A pointer to the v6 lease storage to be counted
-    MemfileLeaseStatsQuery6(Lease6Storage& storage6)
-        : MemfileLeaseStatsQuery(), storage6_(storage6) {
+    /// @param counts The v6 lease counts per subnet
+    MemfileLeaseStatsQuery6(const SubnetLeaseCountsMap& counts)
+        : MemfileLeaseStatsQuery(), counts_(counts) {
     };
 
     /// @brief Destructor
@@ -422,91 +380,26 @@ public:
 
     /// @brief Creates the IPv6 lease statistical data result set
     ///
-    /// The result set is populated by iterating over the IPv6 leases in
-    /// storage, in ascending order by address, accumulating the lease state
-    /// counts per subnet. Note that walking the leases by address should
-    /// inherently group them by subnet, and while this does not guarantee
-    /// ascending order of subnet id, it should be sufficient to accumulate
-    /// state counts per subnet.  This avoids introducing an additional
-    /// subnet_id index.
-    /// At the completion of all entries for a given subnet, the counts
-    /// are used to create LeaseStatsRow instances which are appended to an
-    /// internal vector.  The process results in a vector containing one entry
-    /// per state per lease type per subnet.
+    /// The result set is populated from the lease counts, in ascending
+    /// order by subnet id. It takes time proportional to the number of
+    /// subnets rather than the number of leases.
     ///
     /// Currently the states counted are:
     ///
     /// - Lease::STATE_DEFAULT (i.e. assigned)
     /// - Lease::STATE_DECLINED
     virtual void start() {
-        // Get the subnet_id index
-        const Lease6StorageAddressIndex& idx
-            = storage6_.get<AddressIndexTag>();
-
-        // Iterate over the leases in order by subnet, accumulating per
-        // subnet counts for each state of interest.  As we finish each
-        // subnet, add the appropriate rows to our result set.
-        SubnetID cur_id = 0;
-        int64_t assigned = 0;
-        int64_t declined = 0;
-        int64_t assigned_pds = 0;
-
-        for(Lease6StorageAddressIndex::const_iterator lease = idx.begin();
-            lease != idx.end(); ++lease) {
-
-            // If we've hit the next subnet, add rows for the current subnet
-            // and wipe the accumulators
-            if ((*lease)->subnet_id_ != cur_id) {
-                if (cur_id > 0) {
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                  Lease::STATE_DEFAULT,
-                                                  assigned));
-                    assigned = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
-                                                  Lease::STATE_DECLINED,
-                                                  declined));
-                    declined = 0;
-                    rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
-                                                  Lease::STATE_DEFAULT,
-                                                  assigned_pds));
-                    assigned_pds = 0;
-                }
-
-                // Update current subnet id
-                cur_id = (*lease)->subnet_id_;
-            }
-
-            // Bump the appropriate accumulator
-            if ((*lease)->state_ == Lease::STATE_DEFAULT) {
-                switch((*lease)->type_) {
-                case Lease::TYPE_NA:
-                    ++assigned;
-                    break;
-                case Lease::TYPE_PD:
-                    ++assigned_pds;
-                    break;
-                default:
-                    break;
-                }
-            } else if ((*lease)->state_ == Lease::STATE_DECLINED) {
-                // In theory only NAs can be declined
-                if (((*lease)->type_) == Lease::TYPE_NA) {
-                    ++declined;
-                }
-            }
-        }
-
-        // Make the rows for last subnet, unless there were no rows
-        if (idx.begin() != idx.end()) {
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
+        for (SubnetLeaseCountsMap::const_iterator counts = counts_.begin();
+             counts != counts_.end(); ++counts) {
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::TYPE_NA,
                                           Lease::STATE_DEFAULT,
-                                          assigned));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_NA,
+                                          counts->second.assigned_));
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::TYPE_NA,
                                           Lease::STATE_DECLINED,
-                                          declined));
-            rows_.push_back(LeaseStatsRow(cur_id, Lease::TYPE_PD,
+                                          counts->second.declined_));
+            rows_.push_back(LeaseStatsRow(counts->first, Lease::TYPE_PD,
                                           Lease::STATE_DEFAULT,
-                                          assigned_pds));
+                                          counts->second.assigned_pds_));
         }
 
         // Set the next row position to the beginning of the rows.
@@ -514,12 +407,52 @@ public:
     }
 
 private:
-    /// @brief The Memfile storage containing the IPv6 leases to analyze
-    Lease6Storage& storage6_;
+    /// @brief The v6 lease counts per subnet
+    const SubnetLeaseCountsMap& counts_;
 };
 
 // Explicit definition of class static constants.  Values are given in the
 // declaration so they're not needed here.
+namespace {
+
+/// @brief Creates a copy of the stored DHCPv4 lease.
+///
+/// @param record Lease record held in the storage.
+///
+/// @return Pointer to the copy.
+Lease4Ptr
+copyStoredLease(const Lease4Record& record) {
+    return (record.toLease());
+}
+
+/// @brief Creates a copy of the stored DHCPv6 lease.
+///
+/// @param lease Pointer to the lease held in the storage.
+///
+/// @return Pointer to the copy.
+Lease6Ptr
+copyStoredLease(const Lease6Ptr& lease) {
+    return (boost::make_shared<Lease6>(*lease));
+}
+
+/// @brief Parses the value of the "lfc-interval" parameter.
+///
+/// @param lfc_interval_str Value of the parameter.
+///
+/// @return Interval between the lease file cleanups in seconds.
+/// @throw isc::BadValue if the value is not a valid interval.
+uint32_t
+parseLFCInterval(const std::string& lfc_interval_str) {
+    try {
+        return (boost::lexical_cast<uint32_t>(lfc_interval_str));
+    } catch (boost::bad_lexical_cast&) {
+        isc_throw(isc::BadValue, "invalid value of the lfc-interval "
+                  << lfc_interval_str << " specified");
+    }
+}
+
+} // end of anonymous namespace
+
 const int Memfile_LeaseMgr::MAJOR_VERSION;
 const int Memfile_LeaseMgr::MINOR_VERSION;
 
@@ -537,6 +470,7 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                  CSVLeaseFile4>(file4,
                                                                 lease_file4_,
                                                                 storage4_);
+            logMemoryUsage(V4, storage4_.size());
         }
     } else {
         std::string file6 = initLeaseFilePath(V6);
@@ -545,6 +479,7 @@ Memfile_LeaseMgr::Memfile_LeaseMgr(const DatabaseConnection::ParameterMap& param
                                                  CSVLeaseFile6>(file6,
                                                                 lease_file6_,
                                                                 storage6_);
+            logMemoryUsage(V6, storage6_.size());
         }
     }
 
@@ -600,7 +535,9 @@ Memfile_LeaseMgr::addLease(const Lease4Ptr& lease) {
         lease_file4_->append(*lease);
     }
 
-    storage4_.insert(lease);
+    Lease4Record record(*lease);
+    storage4_.insert(record);
+    countLease(record, 1);
     return (true);
 }
 
@@ -621,7 +558,8 @@ Memfile_LeaseMgr::addLease(const Lease6Ptr& lease) {
         lease_file6_->append(*lease);
     }
 
-    storage6_.insert(lease);
+    storage6_.insert(createStoredLease(*lease));
+    countLease(*lease, 1);
     return (true);
 }
 
@@ -630,12 +568,13 @@ Memfile_LeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_ADDR4).arg(addr.toText());
 
-    const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
-    Lease4StorageAddressIndex::iterator l = idx.find(addr);
+    const Lease4RecordStorageAddressIndex& idx =
+        storage4_.get<AddressIndexTag>();
+    Lease4RecordStorageAddressIndex::iterator l = idx.find(addr);
     if (l == idx.end()) {
         return (Lease4Ptr());
     } else {
-        return (Lease4Ptr(new Lease4(**l)));
+        return (l->toLease());
     }
 }
 
@@ -644,13 +583,14 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_HWADDR).arg(hwaddr.toText());
     Lease4Collection collection;
-    const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
-    for(Lease4StorageAddressIndex::const_iterator lease = idx.begin();
+    const CompactBuffer key(hwaddr.hwaddr_);
+    const Lease4RecordStorageAddressIndex& idx =
+        storage4_.get<AddressIndexTag>();
+    for(Lease4RecordStorageAddressIndex::const_iterator lease = idx.begin();
         lease != idx.end(); ++lease) {
 
-        // Every Lease4 has a hardware address, so we can compare it
-        if ( (*(*lease)->hwaddr_) == hwaddr) {
-            collection.push_back((*lease));
+        if (lease->hasHWAddr(hwaddr, key)) {
+            collection.push_back(lease->toLease());
         }
     }
 
@@ -664,18 +604,18 @@ Memfile_LeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
         .arg(hwaddr.toText());
 
     // Get the index by HW Address and Subnet Identifier.
-    const Lease4StorageHWAddressSubnetIdIndex& idx =
+    const Lease4RecordStorageHWAddressSubnetIdIndex& idx =
         storage4_.get<HWAddressSubnetIdIndexTag>();
     // Try to find the lease using HWAddr and subnet id.
-    Lease4StorageHWAddressSubnetIdIndex::const_iterator lease =
-        idx.find(boost::make_tuple(hwaddr.hwaddr_, subnet_id));
+    Lease4RecordStorageHWAddressSubnetIdIndex::const_iterator lease =
+        idx.find(boost::make_tuple(CompactBuffer(hwaddr.hwaddr_), subnet_id));
     // Lease was not found. Return empty pointer to the caller.
     if (lease == idx.end()) {
         return (Lease4Ptr());
     }
 
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (lease->toLease());
 }
 
 Lease4Collection
@@ -683,14 +623,17 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_GET_CLIENTID).arg(client_id.toText());
     Lease4Collection collection;
-    const Lease4StorageAddressIndex& idx = storage4_.get<AddressIndexTag>();
-    for(Lease4StorageAddressIndex::const_iterator lease = idx.begin();
+    const CompactBuffer key(client_id.getClientId());
+    const Lease4RecordStorageAddressIndex& idx =
+        storage4_.get<AddressIndexTag>();
+    for(Lease4RecordStorageAddressIndex::const_iterator lease = idx.begin();
         lease != idx.end(); ++ lease) {
 
-        // client-id is not mandatory in DHCPv4. There can be a lease that does
-        // not have a client-id. Dereferencing null pointer would be a bad thing
-        if((*lease)->client_id_ && *(*lease)->client_id_ == client_id) {
-            collection.push_back((*lease));
+        // client-id is not mandatory in DHCPv4. The lease records without
+        // a client-id hold an empty buffer, which doesn't match any
+        // client-id.
+        if (lease->client_id_ == key) {
+            collection.push_back(lease->toLease());
         }
     }
 
@@ -707,11 +650,12 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
                                                         .arg(subnet_id);
 
     // Get the index by client id, HW address and subnet id.
-    const Lease4StorageClientIdHWAddressSubnetIdIndex& idx =
+    const Lease4RecordStorageClientIdHWAddressSubnetIdIndex& idx =
         storage4_.get<ClientIdHWAddressSubnetIdIndexTag>();
     // Try to get the lease using client id, hardware address and subnet id.
-    Lease4StorageClientIdHWAddressSubnetIdIndex::const_iterator lease =
-        idx.find(boost::make_tuple(client_id.getClientId(), hwaddr.hwaddr_,
+    Lease4RecordStorageClientIdHWAddressSubnetIdIndex::const_iterator lease =
+        idx.find(boost::make_tuple(CompactBuffer(client_id.getClientId()),
+                                   CompactBuffer(hwaddr.hwaddr_),
                                    subnet_id));
 
     if (lease == idx.end()) {
@@ -720,7 +664,7 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
     }
 
     // Lease was found. Return it to the caller.
-    return (*lease);
+    return (lease->toLease());
 }
 
 Lease4Ptr
@@ -731,17 +675,18 @@ Memfile_LeaseMgr::getLease4(const ClientId& client_id,
               .arg(client_id.toText());
 
     // Get the index by client and subnet id.
-    const Lease4StorageClientIdSubnetIdIndex& idx =
+    const Lease4RecordStorageClientIdSubnetIdIndex& idx =
         storage4_.get<ClientIdSubnetIdIndexTag>();
     // Try to get the lease using client id and subnet id.
-    Lease4StorageClientIdSubnetIdIndex::const_iterator lease =
-        idx.find(boost::make_tuple(client_id.getClientId(), subnet_id));
+    Lease4RecordStorageClientIdSubnetIdIndex::const_iterator lease =
+        idx.find(boost::make_tuple(CompactBuffer(client_id.getClientId()),
+                                   subnet_id));
     // Lease was not found. Return empty pointer to the caller.
     if (lease == idx.end()) {
         return (Lease4Ptr());
     }
     // Lease was found. Return it to the caller.
-    return (Lease4Ptr(new Lease4(**lease)));
+    return (lease->toLease());
 }
 
 Lease6Ptr
@@ -755,7 +700,7 @@ Memfile_LeaseMgr::getLease6(Lease::Type type,
     if (l == storage6_.end() || !(*l) || ((*l)->type_ != type)) {
         return (Lease6Ptr());
     } else {
-        return (Lease6Ptr(new Lease6(**l)));
+        return (boost::make_shared<Lease6>(**l));
     }
 }
 
@@ -777,7 +722,7 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
     Lease6Collection collection;
     for(Lease6StorageDuidIaidTypeIndex::const_iterator lease =
             l.first; lease != l.second; ++lease) {
-        collection.push_back(Lease6Ptr(new Lease6(**lease)));
+        collection.push_back(boost::make_shared<Lease6>(**lease));
     }
 
     return (collection);
@@ -805,7 +750,7 @@ Memfile_LeaseMgr::getLeases6(Lease::Type type,
             l.first; lease != l.second; ++lease) {
         // Filter out the leases which subnet id doesn't match.
         if((*lease)->subnet_id_ == subnet_id) {
-            collection.push_back(Lease6Ptr(new Lease6(**lease)));
+            collection.push_back(boost::make_shared<Lease6>(**lease));
         }
     }
 
@@ -829,11 +774,38 @@ Memfile_LeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
         index.upper_bound(boost::make_tuple(false, time(NULL)));
 
     // Copy only the number of leases indicated by the max_leases parameter.
+    size_t copied = 0;
     for (Lease6StorageExpirationIndex::const_iterator lease = index.begin();
-         (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
-                                                 max_leases));
-         ++lease) {
-        expired_leases.push_back(Lease6Ptr(new Lease6(**lease)));
+         (lease != ub) && ((max_leases == 0) || (copied < max_leases));
+         ++lease, ++copied) {
+        expired_leases.push_back(boost::make_shared<Lease6>(**lease));
+    }
+}
+
+void
+Memfile_LeaseMgr::getNextExpiredLeases6(Lease6Collection& expired_leases,
+                                        const size_t max_leases,
+                                        const int64_t last_expire,
+                                        const isc::asiolink::IOAddress& last_address) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_EXPIRED6)
+        .arg(max_leases);
+
+    const Lease6StorageExpirationIndex& index = storage6_.get<ExpirationIndexTag>();
+
+    // Start from the first not reclaimed lease following the last lease
+    // returned by the previous call.
+    Lease6StorageExpirationIndex::const_iterator lease =
+        index.upper_bound(boost::make_tuple(false, last_expire, last_address));
+
+    // Copy the leases until the first reclaimed lease or the lease which
+    // hasn't expired is found.
+    const int64_t now = static_cast<int64_t>(time(NULL));
+    size_t copied = 0;
+    for (; (lease != index.end()) && !(*lease)->stateExpiredReclaimed() &&
+             ((*lease)->getExpirationTime() <= now) &&
+             ((max_leases == 0) || (copied < max_leases));
+         ++lease, ++copied) {
+        expired_leases.push_back(boost::make_shared<Lease6>(**lease));
     }
 }
 
@@ -844,22 +816,110 @@ Memfile_LeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
         .arg(max_leases);
 
     // Obtain the index which segragates leases by state and time.
-    const Lease4StorageExpirationIndex& index = storage4_.get<ExpirationIndexTag>();
+    const Lease4RecordStorageExpirationIndex& index =
+        storage4_.get<ExpirationIndexTag>();
 
     // Retrieve leases which are not reclaimed and which haven't expired. The
     // 'less-than' operator will be used for both components of the index. So,
     // for the 'state' 'false' is less than 'true'. Also the leases with
     // expiration time lower than current time will be returned.
-    Lease4StorageExpirationIndex::const_iterator ub =
+    Lease4RecordStorageExpirationIndex::const_iterator ub =
         index.upper_bound(boost::make_tuple(false, time(NULL)));
 
     // Copy only the number of leases indicated by the max_leases parameter.
-    for (Lease4StorageExpirationIndex::const_iterator lease = index.begin();
-         (lease != ub) && ((max_leases == 0) || (std::distance(index.begin(), lease) <
-                                                 max_leases));
+    size_t copied = 0;
+    for (Lease4RecordStorageExpirationIndex::const_iterator lease =
+             index.begin();
+         (lease != ub) && ((max_leases == 0) || (copied < max_leases));
+         ++lease, ++copied) {
+        expired_leases.push_back(lease->toLease());
+    }
+}
+
+void
+Memfile_LeaseMgr::getNextExpiredLeases4(Lease4Collection& expired_leases,
+                                        const size_t max_leases,
+                                        const int64_t last_expire,
+                                        const isc::asiolink::IOAddress& last_address) const {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_EXPIRED4)
+        .arg(max_leases);
+
+    const Lease4RecordStorageExpirationIndex& index =
+        storage4_.get<ExpirationIndexTag>();
+
+    // Start from the first not reclaimed lease following the last lease
+    // returned by the previous call.
+    Lease4RecordStorageExpirationIndex::const_iterator lease =
+        index.upper_bound(boost::make_tuple(false, last_expire,
+                                            last_address.toUint32()));
+
+    // Copy the leases until the first reclaimed lease or the lease which
+    // hasn't expired is found.
+    const int64_t now = static_cast<int64_t>(time(NULL));
+    size_t copied = 0;
+    for (; (lease != index.end()) && !lease->stateExpiredReclaimed() &&
+             (lease->getExpirationTime() <= now) &&
+             ((max_leases == 0) || (copied < max_leases));
+         ++lease, ++copied) {
+        expired_leases.push_back(lease->toLease());
+    }
+}
+
+Lease4Collection
+Memfile_LeaseMgr::getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                                 const isc::asiolink::IOAddress& upper_bound_address,
+                                 const SubnetID& subnet_id,
+                                 const size_t page_size) const {
+    checkLeases4PageArgs(lower_bound_address, upper_bound_address, page_size);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_PAGE4)
+        .arg(page_size)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    Lease4Collection collection;
+    const Lease4RecordStorageAddressIndex& index =
+        storage4_.get<AddressIndexTag>();
+
+    // Start at the first lease above the lower bound.
+    for (Lease4RecordStorageAddressIndex::const_iterator lease =
+             index.upper_bound(lower_bound_address);
+         (lease != index.end()) && (collection.size() < page_size) &&
+             (lease->getAddress() <= upper_bound_address);
          ++lease) {
-        expired_leases.push_back(Lease4Ptr(new Lease4(**lease)));
+        if ((subnet_id == 0) || (lease->subnet_id_ == subnet_id)) {
+            collection.push_back(lease->toLease());
+        }
     }
+
+    return (collection);
+}
+
+Lease6Collection
+Memfile_LeaseMgr::getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                                 const SubnetID& subnet_id,
+                                 const size_t page_size) const {
+    checkLeases6PageArgs(lower_bound_address, page_size);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MEMFILE_GET_PAGE6)
+        .arg(page_size)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    Lease6Collection collection;
+    const Lease6StorageAddressIndex& index = storage6_.get<AddressIndexTag>();
+
+    // Start at the first lease above the lower bound.
+    for (Lease6StorageAddressIndex::const_iterator lease =
+             index.upper_bound(lower_bound_address);
+         (lease != index.end()) && (collection.size() < page_size);
+         ++lease) {
+        if ((subnet_id == 0) || ((*lease)->subnet_id_ == subnet_id)) {
+            collection.push_back(boost::make_shared<Lease6>(**lease));
+        }
+    }
+
+    return (collection);
 }
 
 void
@@ -868,10 +928,11 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
               DHCPSRV_MEMFILE_UPDATE_ADDR4).arg(lease->addr_.toText());
 
     // Obtain 'by address' index.
-    Lease4StorageAddressIndex& index = storage4_.get<AddressIndexTag>();
+    Lease4RecordStorageAddressIndex& index = storage4_.get<AddressIndexTag>();
 
     // Lease must exist if it is to be updated.
-    Lease4StorageAddressIndex::const_iterator lease_it = index.find(lease->addr_);
+    Lease4RecordStorageAddressIndex::const_iterator lease_it =
+        index.find(lease->addr_);
     if (lease_it == index.end()) {
         isc_throw(NoSuchLease, "failed to update the lease with address "
                   << lease->addr_ << " - no such lease");
@@ -884,8 +945,15 @@ Memfile_LeaseMgr::updateLease4(const Lease4Ptr& lease) {
         lease_file4_->append(*lease);
     }
 
-    // Use replace() to re-index leases.
-    index.replace(lease_it, Lease4Ptr(new Lease4(*lease)));
+    // Use replace() to re-index leases. The replaced record is destroyed,
+    // so it is counted before.
+    Lease4Record record(*lease);
+    countLease(*lease_it, -1);
+    if (index.replace(lease_it, record)) {
+        countLease(record, 1);
+    } else {
+        countLease(*lease_it, 1);
+    }
 }
 
 void
@@ -910,8 +978,65 @@ Memfile_LeaseMgr::updateLease6(const Lease6Ptr& lease) {
         lease_file6_->append(*lease);
     }
 
-    // Use replace() to re-index leases.
-    index.replace(lease_it, Lease6Ptr(new Lease6(*lease)));
+    // Use replace() to re-index leases. The DUID of the replaced lease
+    // is no longer shared if the new lease has a different one.
+    Lease6Ptr old_lease = *lease_it;
+    DuidPtr old_duid = old_lease->duid_;
+    if (index.replace(lease_it, createStoredLease(*lease))) {
+        countLease(*old_lease, -1);
+        countLease(*lease, 1);
+    }
+    old_lease.reset();
+    releaseDuid(old_duid);
+}
+
+Lease4Collection
+Memfile_LeaseMgr::storeLeases4(const Lease4Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MEMFILE_STORE_ADDRS4).arg(leases.size());
+
+    // The duplicates would be written to the lease file before the
+    // second one is found to replace the first one.
+    std::set<isc::asiolink::IOAddress> addrs;
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        if (!addrs.insert((*lease)->addr_).second) {
+            isc_throw(BadValue, "unable to store multiple leases for"
+                      " the address " << (*lease)->addr_);
+        }
+    }
+
+    // Try to write all leases to disk first. If this fails, none of the
+    // leases will be inserted to the memory and the disk and in-memory
+    // data will remain consistent.
+    if (persistLeases(V4)) {
+        lease_file4_->append(leases);
+    }
+
+    Lease4RecordStorageAddressIndex& index = storage4_.get<AddressIndexTag>();
+    Lease4Collection replaced;
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        Lease4Record record(**lease);
+        Lease4RecordStorageAddressIndex::iterator lease_it =
+            index.find(record.addr_);
+        if (lease_it == index.end()) {
+            storage4_.insert(record);
+            countLease(record, 1);
+            continue;
+        }
+
+        // Use replace() to re-index leases.
+        Lease4Ptr old_lease = lease_it->toLease();
+        countLease(*lease_it, -1);
+        if (index.replace(lease_it, record)) {
+            countLease(record, 1);
+            replaced.push_back(old_lease);
+        } else {
+            countLease(*lease_it, 1);
+        }
+    }
+    return (replaced);
 }
 
 bool
@@ -920,20 +1045,21 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
               DHCPSRV_MEMFILE_DELETE_ADDR).arg(addr.toText());
     if (addr.isV4()) {
         // v4 lease
-        Lease4Storage::iterator l = storage4_.find(addr);
+        Lease4RecordStorage::iterator l = storage4_.find(addr);
         if (l == storage4_.end()) {
             // No such lease
             return (false);
         } else {
             if (persistLeases(V4)) {
-                // Copy the lease. The valid lifetime needs to be modified and
-                // we don't modify the original lease.
-                Lease4 lease_copy = **l;
+                // Create the lease from the record. The valid lifetime needs
+                // to be modified and we don't modify the stored record.
+                Lease4Ptr lease_copy = l->toLease();
                 // Setting valid lifetime to 0 means that lease is being
                 // removed.
-                lease_copy.valid_lft_ = 0;
-                lease_file4_->append(lease_copy);
+                lease_copy->valid_lft_ = 0;
+                lease_file4_->append(*lease_copy);
             }
+            countLease(*l, -1);
             storage4_.erase(l);
             return (true);
         }
@@ -955,7 +1081,10 @@ Memfile_LeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
                 lease_file6_->append(lease_copy);
             }
 
+            DuidPtr duid = (*l)->duid_;
+            countLease(**l, -1);
             storage6_.erase(l);
+            releaseDuid(duid);
             return (true);
         }
     }
@@ -967,7 +1096,7 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED4)
         .arg(secs);
     return (deleteExpiredReclaimedLeases<
-            Lease4StorageExpirationIndex, Lease4
+            Lease4RecordStorageExpirationIndex, Lease4
             >(secs, V4, storage4_, lease_file4_));
 }
 
@@ -976,9 +1105,13 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MEMFILE_DELETE_EXPIRED_RECLAIMED6)
         .arg(secs);
-    return (deleteExpiredReclaimedLeases<
-            Lease6StorageExpirationIndex, Lease6
-            >(secs, V6, storage6_, lease_file6_));
+    uint64_t deleted = deleteExpiredReclaimedLeases<
+        Lease6StorageExpirationIndex, Lease6
+        >(secs, V6, storage6_, lease_file6_);
+    if (deleted > 0) {
+        purgeDuids();
+    }
+    return (deleted);
 }
 
 template<typename IndexType, typename LeaseType, typename StorageType,
@@ -1028,15 +1161,17 @@ Memfile_LeaseMgr::deleteExpiredReclaimedLeases(const uint32_t secs,
             for (typename IndexType::const_iterator lease = lower_limit;
                  lease != upper_limit; ++lease) {
                 // Copy lease to not affect the lease in the container.
-                LeaseType lease_copy(**lease);
+                boost::shared_ptr<LeaseType> lease_copy =
+                    copyStoredLease(*lease);
                 // Set the valid lifetime to 0 to indicate the removal
                 // of the lease.
-                lease_copy.valid_lft_ = 0;
-                lease_file->append(lease_copy);
+                lease_copy->valid_lft_ = 0;
+                lease_file->append(*lease_copy);
             }
         }
 
-        // Erase leases from memory.
+        // Erase leases from memory. The leases in the expired-reclaimed
+        // state are not included in the lease counts.
         index.erase(lower_limit, upper_limit);
     }
     // Return number of leases deleted.
@@ -1201,9 +1336,184 @@ bool Memfile_LeaseMgr::loadLeasesFromFiles(const std::string& filename,
                                            MAX_LEASE_ERRORS, false);
     conversion_needed =  conversion_needed || lease_file->needsConversion();
 
+    compactStorage(storage);
+
     return (conversion_needed);
 }
 
+Lease6Ptr
+Memfile_LeaseMgr::createStoredLease(const Lease6& lease) {
+    Lease6Ptr stored = boost::make_shared<Lease6>(lease);
+    stored->duid_ = internDuid(lease.duid_);
+    return (stored);
+}
+
+void
+Memfile_LeaseMgr::compactStorage(Lease4RecordStorage& storage) {
+    // The leases are counted, so as the statistics can be recounted later
+    // without iterating over them.
+    for (Lease4RecordStorage::const_iterator lease = storage.begin();
+         lease != storage.end(); ++lease) {
+        countLease(*lease, 1);
+    }
+}
+
+void
+Memfile_LeaseMgr::compactStorage(Lease6Storage& storage) {
+    // The leases loaded from the lease files don't share the DUIDs.
+    // Replacing them doesn't modify any of the keys. The leases are
+    // also counted, so as the statistics can be recounted later without
+    // iterating over them.
+    for (Lease6Storage::iterator lease = storage.begin();
+         lease != storage.end(); ++lease) {
+        storage.replace(lease, createStoredLease(**lease));
+        countLease(**lease, 1);
+    }
+    purgeDuids();
+}
+
+void
+Memfile_LeaseMgr::countLease(const Lease4Record& lease, const int64_t delta) {
+    if ((lease.state_ != Lease::STATE_DEFAULT) &&
+        (lease.state_ != Lease::STATE_DECLINED)) {
+        return;
+    }
+
+    SubnetLeaseCounts& counts = lease_counts4_[lease.subnet_id_];
+    if (lease.state_ == Lease::STATE_DEFAULT) {
+        counts.assigned_ += delta;
+    } else {
+        counts.declined_ += delta;
+    }
+
+    if (counts.empty()) {
+        lease_counts4_.erase(lease.subnet_id_);
+    }
+}
+
+void
+Memfile_LeaseMgr::countLease(const Lease6& lease, const int64_t delta) {
+    // In theory only NAs can be declined.
+    if (lease.state_ == Lease::STATE_DEFAULT) {
+        if (lease.type_ == Lease::TYPE_NA) {
+            lease_counts6_[lease.subnet_id_].assigned_ += delta;
+
+        } else if (lease.type_ == Lease::TYPE_PD) {
+            lease_counts6_[lease.subnet_id_].assigned_pds_ += delta;
+
+        } else {
+            return;
+        }
+
+    } else if ((lease.state_ == Lease::STATE_DECLINED) &&
+               (lease.type_ == Lease::TYPE_NA)) {
+        lease_counts6_[lease.subnet_id_].declined_ += delta;
+
+    } else {
+        return;
+    }
+
+    if (lease_counts6_[lease.subnet_id_].empty()) {
+        lease_counts6_.erase(lease.subnet_id_);
+    }
+}
+
+DuidPtr
+Memfile_LeaseMgr::internDuid(const DuidPtr& duid) {
+    if (!duid) {
+        return (duid);
+    }
+    std::set<DuidPtr, DuidValueLess>::const_iterator it = duids_.find(duid);
+    if (it != duids_.end()) {
+        return (*it);
+    }
+    // Don't share the instance with the caller, which may hold it for
+    // an arbitrary time.
+    DuidPtr shared = boost::make_shared<DUID>(*duid);
+    duids_.insert(shared);
+    return (shared);
+}
+
+void
+Memfile_LeaseMgr::releaseDuid(const DuidPtr& duid) {
+    if (!duid) {
+        return;
+    }
+    // The remaining references are held by the caller and by the set.
+    std::set<DuidPtr, DuidValueLess>::iterator it = duids_.find(duid);
+    if ((it != duids_.end()) && (*it == duid) && (duid.use_count() <= 2)) {
+        duids_.erase(it);
+    }
+}
+
+void
+Memfile_LeaseMgr::purgeDuids() {
+    for (std::set<DuidPtr, DuidValueLess>::iterator it = duids_.begin();
+         it != duids_.end();) {
+        if (it->unique()) {
+            duids_.erase(it++);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void
+Memfile_LeaseMgr::logMemoryUsage(Universe u, const size_t count) const {
+    if (count > 0) {
+        const size_t usage = getMemoryUsage(u);
+        LOG_INFO(dhcpsrv_logger, DHCPSRV_MEMFILE_LEASES_MEMORY)
+            .arg(count)
+            .arg(usage)
+            .arg(usage / count);
+    }
+}
+
+size_t
+Memfile_LeaseMgr::getMemoryUsage(Universe u) const {
+    // Each index holds the pointer to the lease along with three pointers
+    // to the other nodes of the ordered index. The reference counter of
+    // the shared pointer holds two counts and a pointer to the table of
+    // virtual functions.
+    const size_t node_size = sizeof(Lease6Ptr) + 3 * sizeof(void*);
+    const size_t counter_size = 2 * sizeof(long) + sizeof(void*);
+
+    size_t usage = 0;
+    if (u == V4) {
+        // The DHCPv4 lease records are held in the nodes by value. Each
+        // index adds three pointers to the node.
+        const size_t index_count =
+            boost::mpl::size<Lease4RecordStorage::index_type_list>::value;
+        for (Lease4RecordStorage::const_iterator lease = storage4_.begin();
+             lease != storage4_.end(); ++lease) {
+            usage += sizeof(Lease4Record) + index_count * 3 * sizeof(void*) +
+                lease->getAllocatedSize();
+        }
+
+    } else {
+        const size_t index_count =
+            boost::mpl::size<Lease6Storage::index_type_list>::value;
+        for (Lease6Storage::const_iterator lease = storage6_.begin();
+             lease != storage6_.end(); ++lease) {
+            usage += index_count * node_size + counter_size + sizeof(Lease6);
+            if ((*lease)->hostname_.capacity() >= sizeof(std::string)) {
+                usage += (*lease)->hostname_.capacity() + 1;
+            }
+            if ((*lease)->hwaddr_) {
+                usage += counter_size + sizeof(HWAddr) +
+                    (*lease)->hwaddr_->hwaddr_.capacity();
+            }
+        }
+        // The DUIDs are shared by the leases, so they are counted once.
+        for (std::set<DuidPtr, DuidValueLess>::const_iterator duid =
+                 duids_.begin(); duid != duids_.end(); ++duid) {
+            usage += node_size + counter_size + sizeof(DUID) +
+                (*duid)->getDuid().capacity();
+        }
+    }
+    return (usage);
+}
+
 
 bool
 Memfile_LeaseMgr::isLFCRunning() const {
@@ -1237,13 +1547,7 @@ Memfile_LeaseMgr::lfcSetup(bool conversion_needed) {
         // Ignore and default to 0.
     }
 
-    uint32_t lfc_interval = 0;
-    try {
-        lfc_interval = boost::lexical_cast<uint32_t>(lfc_interval_str);
-    } catch (boost::bad_lexical_cast&) {
-        isc_throw(isc::BadValue, "invalid value of the lfc-interval "
-                  << lfc_interval_str << " specified");
-    }
+    const uint32_t lfc_interval = parseLFCInterval(lfc_interval_str);
 
     if (lfc_interval > 0 || conversion_needed) {
         lfc_setup_.reset(new LFCSetup(boost::bind(&Memfile_LeaseMgr::lfcCallback, this)));
@@ -1311,16 +1615,47 @@ void Memfile_LeaseMgr::lfcExecute(boost::shared_ptr<LeaseFileType>& lease_file)
     }
 }
 
+bool
+Memfile_LeaseMgr::reconfigure(const DatabaseConnection::ParameterMap& parameters,
+                              const std::set<std::string>& changed) {
+    for (std::set<std::string>::const_iterator name = changed.begin();
+         name != changed.end(); ++name) {
+        if (*name != "lfc-interval") {
+            return (false);
+        }
+    }
+
+    // Validate the new interval before anything is changed, so as the
+    // invalid value leaves the current parameters and LFC timer in place.
+    DatabaseConnection::ParameterMap::const_iterator lfc_interval =
+        parameters.find("lfc-interval");
+    if (lfc_interval != parameters.end()) {
+        parseLFCInterval(lfc_interval->second);
+    }
+
+    // Store the new parameters, so as they are reported and used by the
+    // backend in the same way as those it has been created with.
+    conn_.setParameters(parameters);
+
+    // Remove the current LFC timer, if any, and set it up with the new
+    // interval.
+    lfc_setup_.reset();
+    if (persistLeases(V4) || persistLeases(V6)) {
+        lfcSetup();
+    }
+    return (true);
+}
+
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery4() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(storage4_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery4(lease_counts4_));
     query->start();
     return(query);
 }
 
 LeaseStatsQueryPtr
 Memfile_LeaseMgr::startLeaseStatsQuery6() {
-    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(storage6_));
+    LeaseStatsQueryPtr query(new MemfileLeaseStatsQuery6(lease_counts6_));
     query->start();
     return(query);
 }
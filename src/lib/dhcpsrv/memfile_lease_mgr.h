@@ -18,6 +18,7 @@
 
 #include <boost/scoped_ptr.hpp>
 #include <boost/shared_ptr.hpp>
+#include <set>
 
 namespace isc {
 namespace dhcp {
@@ -286,6 +287,82 @@ public:
     virtual void getExpiredLeases4(Lease4Collection& expired_leases,
                                    const size_t max_leases) const;
 
+    /// @brief Returns a collection of expired DHCPv6 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The leases are searched using the expiration index, which orders
+    /// them by expiration time and address.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// are added.
+    /// @param max_leases A maximum number of leases to be returned or 0.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases6(Lease6Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The leases are searched using the expiration index, which orders
+    /// them by expiration time and address.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// are added.
+    /// @param max_leases A maximum number of leases to be returned or 0.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases4(Lease4Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a page of IPv4 leases ordered by address.
+    ///
+    /// The page starts at the first lease found by the address index
+    /// above the lower bound, so the cost of fetching the page doesn't
+    /// depend on the number of the preceding leases.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses greater than this address.
+    /// @param upper_bound_address The page includes the leases with the
+    /// addresses lower than or equal to this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    virtual Lease4Collection
+    getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const isc::asiolink::IOAddress& upper_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Returns a page of IPv6 leases ordered by address.
+    ///
+    /// The page starts at the first lease found by the address index
+    /// above the lower bound, as in @c getLeases4Page.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses greater than this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    virtual Lease6Collection
+    getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
     /// @brief Updates IPv4 lease.
     ///
     /// @warning This function does not validate the pointer to the lease.
@@ -306,6 +383,20 @@ public:
     /// If no such lease is present, an exception will be thrown.
     virtual void updateLease6(const Lease6Ptr& lease6);
 
+    /// @brief Stores a collection of IPv4 leases.
+    ///
+    /// All leases are written to the lease file at once, before any of
+    /// them is stored in memory, so the lease file is flushed once for the
+    /// whole collection. If the leases can't be written, none of them is
+    /// stored.
+    ///
+    /// @param leases Collection of leases to be stored.
+    ///
+    /// @return Leases replaced by the stored ones.
+    /// @throw BadValue if the collection holds more than one lease for
+    /// the same address.
+    virtual Lease4Collection storeLeases4(const Lease4Collection& leases);
+
     /// @brief Deletes a lease.
     ///
     /// @param addr Address of the lease to be deleted. (This can be IPv4 or
@@ -354,10 +445,11 @@ private:
     ///
     /// @tparam IndexType Index type to be used to search for the
     /// expired-reclaimed leases, i.e.
-    /// @c Lease4StorageExpirationIndex or @c Lease6StorageExpirationIndex.
+    /// @c Lease4RecordStorageExpirationIndex or
+    /// @c Lease6StorageExpirationIndex.
     /// @tparam LeaseType Lease type, i.e. @c Lease4 or @c Lease6.
     /// @tparam StorageType Type of storage where leases are held, i.e.
-    /// @c Lease4Storage or @c Lease6Storage.
+    /// @c Lease4RecordStorage or @c Lease6Storage.
     /// @tparam LeaseFileType Type of the lease file, i.e. DHCPv4 or
     /// DHCPv6 lease file type.
     template<typename IndexType, typename LeaseType, typename StorageType,
@@ -552,7 +644,7 @@ private:
     /// @param storage A storage for leases read from the lease file.
     /// @tparam LeaseObjectType @c Lease4 or @c Lease6.
     /// @tparam LeaseFileType @c CSVLeaseFile4 or @c CSVLeaseFile6.
-    /// @tparam StorageType @c Lease4Storage or @c Lease6Storage.
+    /// @tparam StorageType @c Lease4RecordStorage or @c Lease6Storage.
     ///
     /// @return Returns true if any of the files loaded need conversion from
     /// an older or newer schema.
@@ -565,8 +657,102 @@ private:
                              boost::shared_ptr<LeaseFileType>& lease_file,
                              StorageType& storage);
 
-    /// @brief stores IPv4 leases
-    Lease4Storage storage4_;
+    /// @name Compact storage of the leases.
+    ///
+    /// The DHCPv4 leases are held in the compact @c Lease4Record objects.
+    /// The DHCPv6 leases held in the storage are the backend's own copies.
+    /// In both cases the callers receive the copies of the stored leases.
+    /// This allows for sharing the DUIDs between the DHCPv6 leases of the
+    /// same client, because the lease objects referring to them are never
+    /// modified in place.
+    //@{
+
+    /// @brief Creates a copy of the IPv6 lease to be held in the storage.
+    ///
+    /// The DUID of the copy is shared with the other leases held in the
+    /// storage for the same DUID.
+    ///
+    /// @param lease Lease to be copied.
+    ///
+    /// @return Pointer to the copy.
+    Lease6Ptr createStoredLease(const Lease6& lease);
+
+    /// @brief Counts the DHCPv4 leases loaded from the lease files.
+    ///
+    /// The loaded leases are already held in the compact records.
+    ///
+    /// @param storage Storage holding the loaded leases.
+    void compactStorage(Lease4RecordStorage& storage);
+
+    /// @brief Replaces the DHCPv6 leases loaded from the lease files with
+    /// the copies sharing the DUIDs and counts them.
+    ///
+    /// @param storage Storage holding the loaded leases.
+    void compactStorage(Lease6Storage& storage);
+
+    /// @brief Returns the DUID shared by the stored leases.
+    ///
+    /// @param duid DUID of the lease being stored.
+    ///
+    /// @return Pointer to the shared instance of the DUID equal to the
+    /// specified one.
+    DuidPtr internDuid(const DuidPtr& duid);
+
+    /// @brief Stops sharing the DUID if no stored lease refers to it.
+    ///
+    /// @param duid DUID of the lease removed from the storage. The caller
+    /// must not hold other references to this DUID instance.
+    void releaseDuid(const DuidPtr& duid);
+
+    /// @brief Stops sharing the DUIDs to which no stored lease refers.
+    ///
+    /// This is used after removing multiple leases at once.
+    void purgeDuids();
+
+    /// @brief Updates the per subnet lease counts for an IPv4 lease.
+    ///
+    /// @param lease Lease record added to or removed from the storage.
+    /// @param delta 1 if the lease has been added, -1 if it has been removed.
+    void countLease(const Lease4Record& lease, const int64_t delta);
+
+    /// @brief Updates the per subnet lease counts for an IPv6 lease.
+    ///
+    /// @param lease Lease added to or removed from the storage.
+    /// @param delta 1 if the lease has been added, -1 if it has been removed.
+    void countLease(const Lease6& lease, const int64_t delta);
+
+    /// @brief Logs the memory used by the loaded leases.
+    ///
+    /// @param u Universe (V4 or V6).
+    /// @param count Number of leases held in the storage.
+    void logMemoryUsage(Universe u, const size_t count) const;
+
+    /// @brief Orders the DUIDs by their values.
+    struct DuidValueLess {
+        /// @brief Compares the DUIDs.
+        ///
+        /// @param duid1 First DUID.
+        /// @param duid2 Second DUID.
+        ///
+        /// @return true if the first DUID precedes the second one.
+        bool operator()(const DuidPtr& duid1, const DuidPtr& duid2) const {
+            return (duid1->getDuid() < duid2->getDuid());
+        }
+    };
+
+    /// @brief DUIDs shared by the stored DHCPv6 leases.
+    std::set<DuidPtr, DuidValueLess> duids_;
+
+    //@}
+
+    /// @brief IPv4 lease counts per subnet.
+    SubnetLeaseCountsMap lease_counts4_;
+
+    /// @brief IPv6 lease counts per subnet.
+    SubnetLeaseCountsMap lease_counts6_;
+
+    /// @brief stores IPv4 lease records
+    Lease4RecordStorage storage4_;
 
     /// @brief stores IPv6 leases
     Lease6Storage storage6_;
@@ -595,6 +781,27 @@ public:
     int getLFCExitStatus() const;
     //@}
 
+    /// @brief Returns the approximate amount of memory used by the
+    /// leases held by the backend.
+    ///
+    /// The returned value includes the lease objects or records, their
+    /// identifiers and host names, and the nodes of the storage indexes. It doesn't
+    /// include the overhead of the memory allocator.
+    ///
+    /// @param u Universe (V4 or V6).
+    ///
+    /// @return Number of bytes.
+    size_t getMemoryUsage(Universe u) const;
+
+    /// @brief Returns the lease counts per subnet.
+    ///
+    /// @param u Universe (V4 or V6).
+    ///
+    /// @return Lease counts maintained for the stored leases.
+    const SubnetLeaseCountsMap& getLeaseCounts(Universe u) const {
+        return (u == V4 ? lease_counts4_ : lease_counts6_);
+    }
+
     /// @brief Creates and runs the IPv4 lease stats query
     ///
     /// It creates an instance of a MemfileLeaseStatsQuery4 and then
@@ -613,6 +820,27 @@ public:
     /// @return The populated query as a pointer to an LeaseStatsQuery.
     virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
 
+    /// @brief Applies new database access parameters to the backend.
+    ///
+    /// The backend accepts the change of the "lfc-interval" parameter and
+    /// sets up the %Lease File Cleanup with the new interval. The lease
+    /// files are not reloaded. The change of any other parameter requires
+    /// the backend to be recreated.
+    ///
+    /// The LFC timer is set up again even if the parameters are unchanged,
+    /// because the server removes all timers when it is reconfigured.
+    ///
+    /// @param parameters New database access parameters.
+    /// @param changed Names of the changed parameters.
+    ///
+    /// @return true if the backend has been reconfigured, false if it has
+    /// to be recreated.
+    /// @throw isc::BadValue if the new value of the "lfc-interval" is
+    /// invalid. The current parameters and LFC timer are left unchanged.
+    virtual bool
+    reconfigure(const DatabaseConnection::ParameterMap& parameters,
+                const std::set<std::string>& changed);
+
     /// @name Protected methods used for %Lease File Cleanup.
     /// The following methods are protected so as they can be accessed and
     /// tested by unit tests.
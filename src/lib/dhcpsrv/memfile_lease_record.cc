@@ -0,0 +1,159 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/memfile_lease_record.h>
+#include <exceptions/exceptions.h>
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace isc::asiolink;
+
+namespace isc {
+namespace dhcp {
+
+CompactBuffer::CompactBuffer(const uint8_t* data, const size_t size)
+    : size_(0) {
+    assign(data, size);
+}
+
+CompactBuffer::CompactBuffer(const std::vector<uint8_t>& data)
+    : size_(0) {
+    assign(data.empty() ? NULL : &data[0], data.size());
+}
+
+CompactBuffer::CompactBuffer(const std::string& data)
+    : size_(0) {
+    assign(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+}
+
+CompactBuffer::CompactBuffer(const CompactBuffer& other)
+    : size_(0) {
+    assign(other.data(), other.size_);
+}
+
+CompactBuffer::~CompactBuffer() {
+    release();
+}
+
+CompactBuffer&
+CompactBuffer::operator=(const CompactBuffer& other) {
+    if (this != &other) {
+        release();
+        assign(other.data(), other.size_);
+    }
+    return (*this);
+}
+
+const uint8_t*
+CompactBuffer::data() const {
+    return (size_ > INLINE_SIZE ? getExternal() : buf_);
+}
+
+std::vector<uint8_t>
+CompactBuffer::toVector() const {
+    const uint8_t* begin = data();
+    return (std::vector<uint8_t>(begin, begin + size_));
+}
+
+std::string
+CompactBuffer::toString() const {
+    return (std::string(reinterpret_cast<const char*>(data()), size_));
+}
+
+bool
+CompactBuffer::operator<(const CompactBuffer& other) const {
+    const uint8_t* this_data = data();
+    const uint8_t* other_data = other.data();
+    return (std::lexicographical_compare(this_data, this_data + size_,
+                                         other_data,
+                                         other_data + other.size_));
+}
+
+bool
+CompactBuffer::operator==(const CompactBuffer& other) const {
+    return ((size_ == other.size_) &&
+            (std::memcmp(data(), other.data(), size_) == 0));
+}
+
+void
+CompactBuffer::assign(const uint8_t* data, const size_t size) {
+    if (size > std::numeric_limits<uint16_t>::max()) {
+        isc_throw(isc::OutOfRange, "unable to store " << size
+                  << " bytes in the lease record");
+    }
+    if (size > INLINE_SIZE) {
+        uint8_t* external = new uint8_t[size];
+        std::memcpy(external, data, size);
+        std::memcpy(buf_, &external, sizeof(external));
+    } else if (size > 0) {
+        std::memcpy(buf_, data, size);
+    }
+    size_ = static_cast<uint16_t>(size);
+}
+
+void
+CompactBuffer::release() {
+    if (size_ > INLINE_SIZE) {
+        delete[] getExternal();
+    }
+    size_ = 0;
+}
+
+uint8_t*
+CompactBuffer::getExternal() const {
+    uint8_t* external;
+    std::memcpy(&external, buf_, sizeof(external));
+    return (external);
+}
+
+Lease4Record::Lease4Record(const Lease4& lease)
+    : addr_(lease.addr_.toUint32()), t1_(lease.t1_), t2_(lease.t2_),
+      valid_lft_(lease.valid_lft_), cltt_(lease.cltt_),
+      subnet_id_(lease.subnet_id_), state_(lease.state_),
+      hwaddr_source_(lease.hwaddr_ ? lease.hwaddr_->source_ : 0),
+      hwaddr_type_(lease.hwaddr_ ? lease.hwaddr_->htype_ : 0),
+      has_hwaddr_(static_cast<bool>(lease.hwaddr_)),
+      fqdn_fwd_(lease.fqdn_fwd_), fqdn_rev_(lease.fqdn_rev_),
+      hwaddr_(lease.getHWAddrVector()),
+      client_id_(lease.getClientIdVector()), hostname_(lease.hostname_) {
+}
+
+Lease4Record::Lease4Record(const Lease4Ptr& lease)
+    : Lease4Record(*lease) {
+}
+
+Lease4Ptr
+Lease4Record::toLease() const {
+    HWAddrPtr hwaddr;
+    if (has_hwaddr_) {
+        hwaddr = boost::make_shared<HWAddr>(hwaddr_.data(), hwaddr_.size(),
+                                            hwaddr_type_);
+        hwaddr->source_ = hwaddr_source_;
+    }
+    ClientIdPtr client_id;
+    if (!client_id_.empty()) {
+        client_id = boost::make_shared<ClientId>(client_id_.data(),
+                                                 client_id_.size());
+    }
+    Lease4Ptr lease = boost::make_shared<Lease4>(IOAddress(addr_), hwaddr,
+                                                 client_id, valid_lft_, t1_,
+                                                 t2_,
+                                                 static_cast<time_t>(cltt_),
+                                                 subnet_id_, fqdn_fwd_,
+                                                 fqdn_rev_,
+                                                 hostname_.toString());
+    lease->state_ = state_;
+    return (lease);
+}
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
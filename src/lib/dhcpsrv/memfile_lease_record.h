@@ -0,0 +1,279 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef MEMFILE_LEASE_RECORD_H
+#define MEMFILE_LEASE_RECORD_H
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/lease.h>
+#include <dhcpsrv/subnet_id.h>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Sequence of bytes held by the compact lease record.
+///
+/// The sequences not longer than @c INLINE_SIZE bytes, i.e. all hardware
+/// addresses and most client identifiers, are held within the object.
+/// The longer sequences are held in a buffer allocated for their exact
+/// size. The empty sequence doesn't use any memory outside of the object.
+class CompactBuffer {
+public:
+
+    /// @brief Maximum number of bytes held within the object.
+    static const size_t INLINE_SIZE = 22;
+
+    /// @brief Constructor.
+    ///
+    /// Creates an empty buffer.
+    CompactBuffer()
+        : size_(0) {
+    }
+
+    /// @brief Constructor.
+    ///
+    /// @param data Pointer to the data to be copied.
+    /// @param size Size of the data.
+    ///
+    /// @throw isc::OutOfRange if the data is longer than 65535 bytes.
+    CompactBuffer(const uint8_t* data, const size_t size);
+
+    /// @brief Constructor.
+    ///
+    /// @param data Data to be copied.
+    explicit CompactBuffer(const std::vector<uint8_t>& data);
+
+    /// @brief Constructor.
+    ///
+    /// @param data String to be copied.
+    explicit CompactBuffer(const std::string& data);
+
+    /// @brief Copy constructor.
+    ///
+    /// @param other Buffer to be copied.
+    CompactBuffer(const CompactBuffer& other);
+
+    /// @brief Destructor.
+    ~CompactBuffer();
+
+    /// @brief Assignment operator.
+    ///
+    /// @param other Buffer to be copied.
+    CompactBuffer& operator=(const CompactBuffer& other);
+
+    /// @brief Returns the size of the data.
+    size_t size() const {
+        return (size_);
+    }
+
+    /// @brief Checks if the buffer is empty.
+    bool empty() const {
+        return (size_ == 0);
+    }
+
+    /// @brief Returns the pointer to the data.
+    const uint8_t* data() const;
+
+    /// @brief Returns the number of bytes allocated outside of the object.
+    size_t getAllocatedSize() const {
+        return (size_ > INLINE_SIZE ? size_ : 0);
+    }
+
+    /// @brief Returns the copy of the data as a vector.
+    std::vector<uint8_t> toVector() const;
+
+    /// @brief Returns the copy of the data as a string.
+    std::string toString() const;
+
+    /// @brief Compares the data of two buffers.
+    ///
+    /// The buffers are ordered in the same way as vectors holding
+    /// their data.
+    ///
+    /// @param other Buffer to compare to.
+    ///
+    /// @return true if the data of this buffer precedes the data of the
+    /// other buffer.
+    bool operator<(const CompactBuffer& other) const;
+
+    /// @brief Checks if two buffers hold the same data.
+    ///
+    /// @param other Buffer to compare to.
+    bool operator==(const CompactBuffer& other) const;
+
+    /// @brief Checks if two buffers hold different data.
+    ///
+    /// @param other Buffer to compare to.
+    bool operator!=(const CompactBuffer& other) const {
+        return (!(*this == other));
+    }
+
+private:
+
+    /// @brief Copies the data to the buffer.
+    ///
+    /// @param data Pointer to the data to be copied.
+    /// @param size Size of the data.
+    void assign(const uint8_t* data, const size_t size);
+
+    /// @brief Frees the buffer allocated outside of the object.
+    void release();
+
+    /// @brief Returns the pointer to the buffer allocated outside of
+    /// the object.
+    ///
+    /// The pointer is held in the inline buffer, which is not aligned.
+    uint8_t* getExternal() const;
+
+    /// @brief Size of the data.
+    uint16_t size_;
+
+    /// @brief Data or the pointer to the buffer allocated outside of
+    /// the object.
+    uint8_t buf_[INLINE_SIZE];
+};
+
+/// @brief Compact representation of the DHCPv4 lease held by the Memfile
+/// backend.
+///
+/// The record holds the values of all members of the @c Lease4 object.
+/// The IPv4 address is held as a number and the hardware address, client
+/// identifier and hostname are held in the @c CompactBuffer objects. The
+/// records are held in the lease storage by value, so the lease doesn't
+/// need the shared pointers and their reference counters.
+///
+/// The @c Lease4 objects are created from the records by the backend
+/// when they are returned to the callers.
+struct Lease4Record {
+
+    /// @brief Constructor.
+    ///
+    /// @param lease Lease to be stored.
+    explicit Lease4Record(const Lease4& lease);
+
+    /// @brief Constructor.
+    ///
+    /// This constructor is used by the @c LeaseFileLoader.
+    ///
+    /// @param lease Pointer to the lease to be stored.
+    explicit Lease4Record(const Lease4Ptr& lease);
+
+    /// @brief Creates the lease object holding the values of the record.
+    Lease4Ptr toLease() const;
+
+    /// @brief Returns the IPv4 address of the lease.
+    isc::asiolink::IOAddress getAddress() const {
+        return (isc::asiolink::IOAddress(addr_));
+    }
+
+    /// @brief Returns the lease expiration time.
+    ///
+    /// @return Lease expiration time computed in the same way as
+    /// @c Lease::getExpirationTime.
+    int64_t getExpirationTime() const {
+        return (cltt_ + valid_lft_);
+    }
+
+    /// @brief Indicates if the lease is in the "expired-reclaimed" state.
+    bool stateExpiredReclaimed() const {
+        return (state_ == Lease::STATE_EXPIRED_RECLAIMED);
+    }
+
+    /// @brief Checks if the lease belongs to the hardware address.
+    ///
+    /// @param hwaddr Hardware address.
+    /// @param key Data of the hardware address held in the buffer.
+    bool hasHWAddr(const HWAddr& hwaddr, const CompactBuffer& key) const {
+        return (has_hwaddr_ && (hwaddr_type_ == hwaddr.htype_) &&
+                (hwaddr_ == key));
+    }
+
+    /// @brief Returns the number of bytes allocated for the record
+    /// outside of the object.
+    size_t getAllocatedSize() const {
+        return (hwaddr_.getAllocatedSize() + client_id_.getAllocatedSize() +
+                hostname_.getAllocatedSize());
+    }
+
+    /// @brief IPv4 address.
+    uint32_t addr_;
+
+    /// @brief Renewal timer.
+    uint32_t t1_;
+
+    /// @brief Rebinding timer.
+    uint32_t t2_;
+
+    /// @brief Valid lifetime.
+    uint32_t valid_lft_;
+
+    /// @brief Client last transmission time.
+    int64_t cltt_;
+
+    /// @brief Subnet identifier.
+    SubnetID subnet_id_;
+
+    /// @brief Lease state.
+    uint32_t state_;
+
+    /// @brief Source of the hardware address.
+    uint32_t hwaddr_source_;
+
+    /// @brief Hardware type.
+    uint16_t hwaddr_type_;
+
+    /// @brief Indicates if the lease has a hardware address.
+    bool has_hwaddr_;
+
+    /// @brief Forward DNS update performed.
+    bool fqdn_fwd_;
+
+    /// @brief Reverse DNS update performed.
+    bool fqdn_rev_;
+
+    /// @brief Hardware address.
+    CompactBuffer hwaddr_;
+
+    /// @brief Client identifier or empty buffer if the lease has no
+    /// client identifier.
+    CompactBuffer client_id_;
+
+    /// @brief Hostname.
+    CompactBuffer hostname_;
+};
+
+/// @brief Orders the addresses of the DHCPv4 lease records.
+///
+/// The addresses can be also compared with the @c IOAddress objects
+/// holding IPv4 addresses, so as the records can be searched by them.
+struct Lease4RecordAddressLess {
+
+    /// @brief Compares two addresses.
+    bool operator()(const uint32_t addr1, const uint32_t addr2) const {
+        return (addr1 < addr2);
+    }
+
+    /// @brief Compares the address with the @c IOAddress object.
+    bool operator()(const uint32_t addr1,
+                    const isc::asiolink::IOAddress& addr2) const {
+        return (addr1 < addr2.toUint32());
+    }
+
+    /// @brief Compares the @c IOAddress object with the address.
+    bool operator()(const isc::asiolink::IOAddress& addr1,
+                    const uint32_t addr2) const {
+        return (addr1.toUint32() < addr2);
+    }
+};
+
+} // end of isc::dhcp namespace
+} // end of isc namespace
+
+#endif // MEMFILE_LEASE_RECORD_H
@@ -9,6 +9,7 @@
 
 #include <asiolink/io_address.h>
 #include <dhcpsrv/lease.h>
+#include <dhcpsrv/memfile_lease_record.h>
 #include <dhcpsrv/subnet_id.h>
 
 #include <boost/multi_index/indexed_by.hpp>
@@ -18,6 +19,7 @@
 #include <boost/multi_index_container.hpp>
 #include <boost/multi_index/composite_key.hpp>
 
+#include <map>
 #include <vector>
 
 namespace isc {
@@ -93,7 +95,8 @@ typedef boost::multi_index_container<
             // This is a composite index that will be used to search for
             // the expired leases. Depending on the value of the first component
             // of the search key, the reclaimed or not reclaimed leases will can
-            // be searched.
+            // be searched. The address orders the leases expiring at the same
+            // time, so as the expired leases can be fetched in slices.
             boost::multi_index::composite_key<
                 Lease6,
                 // The boolean value specifying if lease is reclaimed or not.
@@ -101,7 +104,10 @@ typedef boost::multi_index_container<
                                                   &Lease::stateExpiredReclaimed>,
                 // Lease expiration time.
                 boost::multi_index::const_mem_fun<Lease, int64_t,
-                                                  &Lease::getExpirationTime>
+                                                  &Lease::getExpirationTime>,
+                // IPv6 address.
+                boost::multi_index::member<Lease, isc::asiolink::IOAddress,
+                                           &Lease::addr_>
             >
         >
      >
@@ -214,6 +220,80 @@ typedef boost::multi_index_container<
     >
 > Lease4Storage; // Specify the type name for this container.
 
+/// @brief A multi index container holding compact DHCPv4 lease records.
+///
+/// This container is used by the Memfile backend. It has the same indexes
+/// as the @c Lease4Storage, but it holds the @c Lease4Record objects by
+/// value.
+typedef boost::multi_index_container<
+    // It holds the lease records.
+    Lease4Record,
+    boost::multi_index::indexed_by<
+        // This index sorts the records by IPv4 addresses. The records can
+        // be also searched using the IOAddress objects.
+        boost::multi_index::ordered_unique<
+            boost::multi_index::tag<AddressIndexTag>,
+            boost::multi_index::member<Lease4Record, uint32_t,
+                                       &Lease4Record::addr_>,
+            Lease4RecordAddressLess
+        >,
+
+        // This index sorts the records by HW address and subnet id.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<HWAddressSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                Lease4Record,
+                boost::multi_index::member<Lease4Record, CompactBuffer,
+                                           &Lease4Record::hwaddr_>,
+                boost::multi_index::member<Lease4Record, SubnetID,
+                                           &Lease4Record::subnet_id_>
+            >
+        >,
+
+        // This index sorts the records by client id and subnet id.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ClientIdSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                Lease4Record,
+                boost::multi_index::member<Lease4Record, CompactBuffer,
+                                           &Lease4Record::client_id_>,
+                boost::multi_index::member<Lease4Record, SubnetID,
+                                           &Lease4Record::subnet_id_>
+            >
+        >,
+
+        // This index sorts the records by client id, HW address and
+        // subnet id.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ClientIdHWAddressSubnetIdIndexTag>,
+            boost::multi_index::composite_key<
+                Lease4Record,
+                boost::multi_index::member<Lease4Record, CompactBuffer,
+                                           &Lease4Record::client_id_>,
+                boost::multi_index::member<Lease4Record, CompactBuffer,
+                                           &Lease4Record::hwaddr_>,
+                boost::multi_index::member<Lease4Record, SubnetID,
+                                           &Lease4Record::subnet_id_>
+            >
+        >,
+
+        // This index sorts the records by the "expired-reclaimed" state,
+        // expiration time and address.
+        boost::multi_index::ordered_non_unique<
+            boost::multi_index::tag<ExpirationIndexTag>,
+            boost::multi_index::composite_key<
+                Lease4Record,
+                boost::multi_index::const_mem_fun<Lease4Record, bool,
+                                                  &Lease4Record::stateExpiredReclaimed>,
+                boost::multi_index::const_mem_fun<Lease4Record, int64_t,
+                                                  &Lease4Record::getExpirationTime>,
+                boost::multi_index::member<Lease4Record, uint32_t,
+                                           &Lease4Record::addr_>
+            >
+        >
+    >
+> Lease4RecordStorage;
+
 //@}
 
 /// @name Indexes used by the multi index containers
@@ -247,7 +327,60 @@ Lease4StorageClientIdSubnetIdIndex;
 typedef Lease4Storage::index<ClientIdHWAddressSubnetIdIndexTag>::type
 Lease4StorageClientIdHWAddressSubnetIdIndex;
 
+/// @brief DHCPv4 lease record storage index by address.
+typedef Lease4RecordStorage::index<AddressIndexTag>::type
+Lease4RecordStorageAddressIndex;
+
+/// @brief DHCPv4 lease record storage index by expiration time.
+typedef Lease4RecordStorage::index<ExpirationIndexTag>::type
+Lease4RecordStorageExpirationIndex;
+
+/// @brief DHCPv4 lease record storage index by HW address and subnet
+/// identifier.
+typedef Lease4RecordStorage::index<HWAddressSubnetIdIndexTag>::type
+Lease4RecordStorageHWAddressSubnetIdIndex;
+
+/// @brief DHCPv4 lease record storage index by client and subnet identifier.
+typedef Lease4RecordStorage::index<ClientIdSubnetIdIndexTag>::type
+Lease4RecordStorageClientIdSubnetIdIndex;
+
+/// @brief DHCPv4 lease record storage index by client id, HW address and
+/// subnet id.
+typedef Lease4RecordStorage::index<ClientIdHWAddressSubnetIdIndexTag>::type
+Lease4RecordStorageClientIdHWAddressSubnetIdIndex;
+
 //@}
+
+/// @brief Numbers of leases of a subnet in the states which are counted
+/// in the lease statistics.
+///
+/// The counts are maintained by the Memfile backend as the leases are
+/// added, updated and removed, so as the lease statistics can be
+/// recounted without iterating over all leases.
+struct SubnetLeaseCounts {
+
+    /// @brief Constructor.
+    SubnetLeaseCounts()
+        : assigned_(0), declined_(0), assigned_pds_(0) {
+    }
+
+    /// @brief Checks if all counts are zero.
+    bool empty() const {
+        return ((assigned_ == 0) && (declined_ == 0) && (assigned_pds_ == 0));
+    }
+
+    /// @brief Number of the assigned addresses (IPv4 or IPv6 non-temporary).
+    int64_t assigned_;
+
+    /// @brief Number of the declined addresses.
+    int64_t declined_;
+
+    /// @brief Number of the assigned IPv6 prefixes.
+    int64_t assigned_pds_;
+};
+
+/// @brief Lease counts of the subnets ordered by subnet identifier.
+typedef std::map<SubnetID, SubnetLeaseCounts> SubnetLeaseCountsMap;
 } // end of isc::dhcp namespace
 } // end of isc namespace
 
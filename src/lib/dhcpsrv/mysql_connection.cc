@@ -388,6 +388,14 @@ MySqlConnection::rollback() {
     }
 }
 
+bool
+MySqlConnection::ping() {
+    // The thread id changes when the client library reconnects.
+    unsigned long thread_id = mysql_thread_id(mysql_);
+    return ((mysql_ping(mysql_) == 0) &&
+            (mysql_thread_id(mysql_) == thread_id));
+}
+
 
 } // namespace isc::dhcp
 } // namespace isc
@@ -345,6 +345,17 @@ public:
     /// @throw DbOperationError If the rollback failed.
     void rollback();
 
+    /// @brief Checks if the connection to the database is usable.
+    ///
+    /// Pings the server. The connection is re-established automatically
+    /// when the server has gone away, but this invalidates the prepared
+    /// statements. Such connection is therefore reported as unusable and
+    /// should be replaced with a new one.
+    ///
+    /// @return true if the connection is alive and its prepared statements
+    /// are valid, false otherwise.
+    bool ping();
+
     /// @brief Check Error and Throw Exception
     ///
     /// Virtually all MySQL functions return a status which, if non-zero,
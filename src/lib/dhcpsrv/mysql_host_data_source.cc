@@ -21,6 +21,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/static_assert.hpp>
 
@@ -2356,47 +2357,73 @@ MySqlHostDataSourceImpl::checkReadOnly() const {
 }
 
 
+namespace {
+
+/// @brief Creates the implementation of the data source for the pool.
+///
+/// @param parameters Parameters used to open the connection.
+DbConnectionPool<MySqlHostDataSourceImpl>::ConnectionPtr
+createImpl(const MySqlConnection::ParameterMap& parameters) {
+    return (DbConnectionPool<MySqlHostDataSourceImpl>::
+            ConnectionPtr(new MySqlHostDataSourceImpl(parameters)));
+}
+
+/// @brief Checks if the pooled connection is usable.
+///
+/// @param impl Pooled implementation of the data source.
+bool
+checkImpl(MySqlHostDataSourceImpl& impl) {
+    return (impl.conn_.ping());
+}
+
+} // end of anonymous namespace
+
 MySqlHostDataSource::
 MySqlHostDataSource(const MySqlConnection::ParameterMap& parameters)
-    : impl_(new MySqlHostDataSourceImpl(parameters)) {
+    : pool_(new ImplPool(boost::bind(&createImpl, parameters), &checkImpl,
+                         DatabaseConnection(parameters).configuredPoolSize())) {
+    // Open the first connection right away, so as the errors in the
+    // database parameters are reported when the data source is created.
+    ImplPool::Handle impl(*pool_);
 }
 
 MySqlHostDataSource::~MySqlHostDataSource() {
-    delete impl_;
 }
 
 void
 MySqlHostDataSource::add(const HostPtr& host) {
+    ImplPool::Handle impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
+    impl->checkReadOnly();
 
     // Initiate MySQL transaction as we will have to make multiple queries
     // to insert host information into multiple tables. If that fails on
     // any stage, the transaction will be rolled back by the destructor of
     // the MySqlTransaction class.
-    MySqlTransaction transaction(impl_->conn_);
+    MySqlTransaction transaction(impl->conn_);
 
     // Create the MYSQL_BIND array for the host
-    std::vector<MYSQL_BIND> bind = impl_->host_exchange_->createBindForSend(host);
+    std::vector<MYSQL_BIND> bind = impl->host_exchange_->createBindForSend(host);
 
     // ... and insert the host.
-    impl_->addStatement(MySqlHostDataSourceImpl::INSERT_HOST, bind);
+    impl->addStatement(MySqlHostDataSourceImpl::INSERT_HOST, bind);
 
     // Gets the last inserted hosts id
-    uint64_t host_id = mysql_insert_id(impl_->conn_.mysql_);
+    uint64_t host_id = mysql_insert_id(impl->conn_.mysql_);
 
     // Insert DHCPv4 options.
     ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
     if (cfg_option4) {
-        impl_->addOptions(MySqlHostDataSourceImpl::INSERT_V4_OPTION,
-                          cfg_option4, host_id);
+        impl->addOptions(MySqlHostDataSourceImpl::INSERT_V4_OPTION,
+                         cfg_option4, host_id);
     }
 
     // Insert DHCPv6 options.
     ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
     if (cfg_option6) {
-        impl_->addOptions(MySqlHostDataSourceImpl::INSERT_V6_OPTION,
-                          cfg_option6, host_id);
+        impl->addOptions(MySqlHostDataSourceImpl::INSERT_V6_OPTION,
+                         cfg_option6, host_id);
     }
 
     // Insert IPv6 reservations.
@@ -2404,7 +2431,7 @@ MySqlHostDataSource::add(const HostPtr& host) {
     if (std::distance(v6resv.first, v6resv.second) > 0) {
         for (IPv6ResrvIterator resv = v6resv.first; resv != v6resv.second;
              ++resv) {
-            impl_->addResv(resv->second, host_id);
+            impl->addResv(resv->second, host_id);
         }
     }
 
@@ -2433,6 +2460,8 @@ ConstHostCollection
 MySqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
                             const uint8_t* identifier_begin,
                             const size_t identifier_len) const {
+    ImplPool::Handle impl(*pool_);
+
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -2453,15 +2482,17 @@ MySqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
     inbind[0].length = &length;
 
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_DHCPID, inbind,
-                             impl_->host_ipv46_exchange_,
-                             result, false);
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_DHCPID, inbind,
+                            impl->host_ipv46_exchange_,
+                            result, false);
     return (result);
 }
 
 ConstHostCollection
 MySqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
 
+    ImplPool::Handle impl(*pool_);
+
     // Set up the WHERE clause value
     MYSQL_BIND inbind[1];
     memset(inbind, 0, sizeof(inbind));
@@ -2472,8 +2503,8 @@ MySqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
     inbind[0].is_unsigned = MLM_TRUE;
 
     ConstHostCollection result;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_ADDR, inbind,
-                             impl_->host_exchange_, result, false);
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_ADDR, inbind,
+                            impl->host_exchange_, result, false);
 
     return (result);
 }
@@ -2511,14 +2542,18 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    ImplPool::Handle impl(*pool_);
+
+    return (impl->getHost(subnet_id, identifier_type, identifier_begin,
                    identifier_len, MySqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
-                   impl_->host_exchange_));
+                   impl->host_exchange_));
 }
 
 ConstHostPtr
 MySqlHostDataSource::get4(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
+    ImplPool::Handle impl(*pool_);
+
     /// @todo: check that address is really v4, not v6.
 
     // Set up the WHERE clause value
@@ -2535,8 +2570,8 @@ MySqlHostDataSource::get4(const SubnetID& subnet_id,
     inbind[1].is_unsigned = MLM_TRUE;
 
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
-                             inbind, impl_->host_exchange_, collection, true);
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
+                            inbind, impl->host_exchange_, collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2578,14 +2613,18 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    ImplPool::Handle impl(*pool_);
+
+    return (impl->getHost(subnet_id, identifier_type, identifier_begin,
                    identifier_len, MySqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
-                   impl_->host_ipv6_exchange_));
+                   impl->host_ipv6_exchange_));
 }
 
 ConstHostPtr
 MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
                           const uint8_t prefix_len) const {
+    ImplPool::Handle impl(*pool_);
+
     /// @todo: Check that prefix is v6 address, not v4.
 
     // Set up the WHERE clause value
@@ -2609,9 +2648,9 @@ MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
 
 
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_PREFIX,
-                             inbind, impl_->host_ipv6_exchange_,
-                             collection, true);
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_PREFIX,
+                            inbind, impl->host_ipv6_exchange_,
+                            collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2625,6 +2664,8 @@ MySqlHostDataSource::get6(const asiolink::IOAddress& prefix,
 ConstHostPtr
 MySqlHostDataSource::get6(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
+    ImplPool::Handle impl(*pool_);
+
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -2644,9 +2685,9 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
     inbind[1].buffer_length = addr6_length;
 
     ConstHostCollection collection;
-    impl_->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
-                             inbind, impl_->host_ipv6_exchange_,
-                             collection, true);
+    impl->getHostCollection(MySqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
+                            inbind, impl->host_ipv6_exchange_,
+                            collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2661,9 +2702,11 @@ MySqlHostDataSource::get6(const SubnetID& subnet_id,
 // Miscellaneous database methods.
 
 std::string MySqlHostDataSource::getName() const {
+    ImplPool::Handle impl(*pool_);
+
     std::string name = "";
     try {
-        name = impl_->conn_.getParameter("name");
+        name = impl->conn_.getParameter("name");
     } catch (...) {
         // Return an empty name
     }
@@ -2676,6 +2719,8 @@ std::string MySqlHostDataSource::getDescription() const {
 }
 
 std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
+    ImplPool::Handle impl(*pool_);
+
     const MySqlHostDataSourceImpl::StatementIndex stindex =
         MySqlHostDataSourceImpl::GET_VERSION;
 
@@ -2686,11 +2731,11 @@ std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
     uint32_t minor;      // Minor version number
 
     // Execute the prepared statement
-    int status = mysql_stmt_execute(impl_->conn_.statements_[stindex]);
+    int status = mysql_stmt_execute(impl->conn_.statements_[stindex]);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to execute <"
-                  << impl_->conn_.text_statements_[stindex]
-                  << "> - reason: " << mysql_error(impl_->conn_.mysql_));
+                  << impl->conn_.text_statements_[stindex]
+                  << "> - reason: " << mysql_error(impl->conn_.mysql_));
     }
 
     // Bind the output of the statement to the appropriate variables.
@@ -2707,20 +2752,20 @@ std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
     bind[1].buffer = &minor;
     bind[1].buffer_length = sizeof(minor);
 
-    status = mysql_stmt_bind_result(impl_->conn_.statements_[stindex], bind);
+    status = mysql_stmt_bind_result(impl->conn_.statements_[stindex], bind);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to bind result set: "
-                  << mysql_error(impl_->conn_.mysql_));
+                  << mysql_error(impl->conn_.mysql_));
     }
 
     // Fetch the data and set up the "release" object to release associated
     // resources when this method exits then retrieve the data.
     // mysql_stmt_fetch return value other than 0 means error occurrence.
-    MySqlFreeResult fetch_release(impl_->conn_.statements_[stindex]);
-    status = mysql_stmt_fetch(impl_->conn_.statements_[stindex]);
+    MySqlFreeResult fetch_release(impl->conn_.statements_[stindex]);
+    status = mysql_stmt_fetch(impl->conn_.statements_[stindex]);
     if (status != 0) {
         isc_throw(DbOperationError, "unable to obtain result set: "
-                  << mysql_error(impl_->conn_.mysql_));
+                  << mysql_error(impl->conn_.mysql_));
     }
 
     return (std::make_pair(major, minor));
@@ -2728,17 +2773,25 @@ std::pair<uint32_t, uint32_t> MySqlHostDataSource::getVersion() const {
 
 void
 MySqlHostDataSource::commit() {
+    ImplPool::Handle impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
-    impl_->conn_.commit();
+    impl->checkReadOnly();
+
+    // The connection checked out here is not necessarily the one used by
+    // the previous calls, so there is nothing to commit. The hosts are
+    // added within their own transactions.
 }
 
 
 void
 MySqlHostDataSource::rollback() {
+    ImplPool::Handle impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
-    impl_->conn_.rollback();
+    impl->checkReadOnly();
+
+    // There is nothing to roll back for the same reason as in commit().
 }
 
 
@@ -9,16 +9,20 @@
 #include <asiolink/io_address.h>
 #include <dhcp/duid.h>
 #include <dhcp/hwaddr.h>
+#include <dhcp/iface_mgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/mysql_lease_mgr.h>
 #include <dhcpsrv/mysql_connection.h>
 
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/static_assert.hpp>
 #include <mysqld_error.h>
 
+#include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <limits>
 #include <limits.h>
 #include <sstream>
 #include <string>
@@ -26,6 +30,7 @@
 
 using namespace isc;
 using namespace isc::dhcp;
+using namespace isc::util::thread;
 using namespace std;
 
 /// @file
@@ -72,6 +77,40 @@ using namespace std;
 
 namespace {
 
+/// @brief Looks up IPv4 lease by address.
+///
+/// This function is used by the worker thread performing asynchronous
+/// lookups.
+///
+/// @param lease_mgr Lease manager executing the lookup.
+/// @param addr address of the searched lease.
+Lease4Ptr
+lookupLease4(const LeaseMgr& lease_mgr, const isc::asiolink::IOAddress& addr) {
+    return (lease_mgr.getLease4(addr));
+}
+
+/// @brief Looks up IPv4 lease by HW address and subnet identifier.
+///
+/// @param lease_mgr Lease manager executing the lookup.
+/// @param hwaddr hardware address of the client.
+/// @param subnet_id identifier of the subnet that lease must belong to.
+Lease4Ptr
+lookupLease4(const LeaseMgr& lease_mgr, const HWAddr& hwaddr,
+             SubnetID subnet_id) {
+    return (lease_mgr.getLease4(hwaddr, subnet_id));
+}
+
+/// @brief Looks up IPv4 lease by client identifier and subnet identifier.
+///
+/// @param lease_mgr Lease manager executing the lookup.
+/// @param clientid client identifier.
+/// @param subnet_id identifier of the subnet that lease must belong to.
+Lease4Ptr
+lookupLease4(const LeaseMgr& lease_mgr, const ClientId& clientid,
+             SubnetID subnet_id) {
+    return (lease_mgr.getLease4(clientid, subnet_id));
+}
+
 /// @brief Maximum length of the hostname stored in DNS.
 ///
 /// This length is restricted by the length of the domain-name carried
@@ -84,63 +123,92 @@ const size_t HOSTNAME_MAX_LEN = 255;
 /// colon separators.
 const size_t ADDRESS6_TEXT_MAX_LEN = 39;
 
-boost::array<TaggedStatement, MySqlLeaseMgr::NUM_STATEMENTS>
+boost::array<TaggedStatement, MySqlLeaseMgrImpl::NUM_STATEMENTS>
 tagged_statements = { {
-    {MySqlLeaseMgr::DELETE_LEASE4,
+    {MySqlLeaseMgrImpl::DELETE_LEASE4,
                     "DELETE FROM lease4 WHERE address = ?"},
-    {MySqlLeaseMgr::DELETE_LEASE4_STATE_EXPIRED,
+    {MySqlLeaseMgrImpl::DELETE_LEASE4_STATE_EXPIRED,
                     "DELETE FROM lease4 "
                         "WHERE state = ? AND expire < ?"},
-    {MySqlLeaseMgr::DELETE_LEASE6,
+    {MySqlLeaseMgrImpl::DELETE_LEASE6,
                     "DELETE FROM lease6 WHERE address = ?"},
-    {MySqlLeaseMgr::DELETE_LEASE6_STATE_EXPIRED,
+    {MySqlLeaseMgrImpl::DELETE_LEASE6_STATE_EXPIRED,
                     "DELETE FROM lease6 "
                         "WHERE state = ? AND expire < ?"},
-    {MySqlLeaseMgr::GET_LEASE4_ADDR,
+    {MySqlLeaseMgrImpl::GET_LEASE4_ADDR,
                     "SELECT address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
                         "fqdn_fwd, fqdn_rev, hostname, "
                         "state "
                             "FROM lease4 "
                             "WHERE address = ?"},
-    {MySqlLeaseMgr::GET_LEASE4_CLIENTID,
+    {MySqlLeaseMgrImpl::GET_LEASE4_CLIENTID,
                     "SELECT address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
                         "fqdn_fwd, fqdn_rev, hostname, "
                         "state "
                             "FROM lease4 "
                             "WHERE client_id = ?"},
-    {MySqlLeaseMgr::GET_LEASE4_CLIENTID_SUBID,
+    {MySqlLeaseMgrImpl::GET_LEASE4_CLIENTID_SUBID,
                     "SELECT address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
                         "fqdn_fwd, fqdn_rev, hostname, "
                         "state "
                             "FROM lease4 "
                             "WHERE client_id = ? AND subnet_id = ?"},
-    {MySqlLeaseMgr::GET_LEASE4_HWADDR,
+    {MySqlLeaseMgrImpl::GET_LEASE4_HWADDR,
                     "SELECT address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
                         "fqdn_fwd, fqdn_rev, hostname, "
                         "state "
                             "FROM lease4 "
                             "WHERE hwaddr = ?"},
-    {MySqlLeaseMgr::GET_LEASE4_HWADDR_SUBID,
+    {MySqlLeaseMgrImpl::GET_LEASE4_HWADDR_SUBID,
                     "SELECT address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
                         "fqdn_fwd, fqdn_rev, hostname, "
                         "state "
                             "FROM lease4 "
                             "WHERE hwaddr = ? AND subnet_id = ?"},
-    {MySqlLeaseMgr::GET_LEASE4_EXPIRE,
+    {MySqlLeaseMgrImpl::GET_LEASE4_EXPIRE,
                     "SELECT address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
                         "fqdn_fwd, fqdn_rev, hostname, "
                         "state "
                             "FROM lease4 "
                             "WHERE state != ? AND expire < ? "
-                            "ORDER BY expire ASC "
+                            "ORDER BY expire ASC, address ASC "
+                            "LIMIT ?"},
+    {MySqlLeaseMgrImpl::GET_LEASE4_EXPIRE_NEXT,
+                    "SELECT address, hwaddr, client_id, "
+                        "valid_lifetime, expire, subnet_id, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "state "
+                            "FROM lease4 "
+                            "WHERE state != ? AND expire < ? "
+                            "AND (expire > ? OR (expire = ? AND address > ?)) "
+                            "ORDER BY expire ASC, address ASC "
+                            "LIMIT ?"},
+    {MySqlLeaseMgrImpl::GET_LEASE4_PAGE,
+                    "SELECT address, hwaddr, client_id, "
+                        "valid_lifetime, expire, subnet_id, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "state "
+                            "FROM lease4 "
+                            "WHERE address > ? AND address <= ? "
+                            "ORDER BY address "
+                            "LIMIT ?"},
+    {MySqlLeaseMgrImpl::GET_LEASE4_PAGE_SUBID,
+                    "SELECT address, hwaddr, client_id, "
+                        "valid_lifetime, expire, subnet_id, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "state "
+                            "FROM lease4 "
+                            "WHERE address > ? AND address <= ? "
+                            "AND subnet_id = ? "
+                            "ORDER BY address "
                             "LIMIT ?"},
-    {MySqlLeaseMgr::GET_LEASE6_ADDR,
+    {MySqlLeaseMgrImpl::GET_LEASE6_ADDR,
                     "SELECT address, duid, valid_lifetime, "
                         "expire, subnet_id, pref_lifetime, "
                         "lease_type, iaid, prefix_len, "
@@ -149,7 +217,7 @@ tagged_statements = { {
                         "state "
                             "FROM lease6 "
                             "WHERE address = ? AND lease_type = ?"},
-    {MySqlLeaseMgr::GET_LEASE6_DUID_IAID,
+    {MySqlLeaseMgrImpl::GET_LEASE6_DUID_IAID,
                     "SELECT address, duid, valid_lifetime, "
                         "expire, subnet_id, pref_lifetime, "
                         "lease_type, iaid, prefix_len, "
@@ -158,7 +226,7 @@ tagged_statements = { {
                         "state "
                             "FROM lease6 "
                             "WHERE duid = ? AND iaid = ? AND lease_type = ?"},
-    {MySqlLeaseMgr::GET_LEASE6_DUID_IAID_SUBID,
+    {MySqlLeaseMgrImpl::GET_LEASE6_DUID_IAID_SUBID,
                     "SELECT address, duid, valid_lifetime, "
                         "expire, subnet_id, pref_lifetime, "
                         "lease_type, iaid, prefix_len, "
@@ -168,7 +236,18 @@ tagged_statements = { {
                             "FROM lease6 "
                             "WHERE duid = ? AND iaid = ? AND subnet_id = ? "
                             "AND lease_type = ?"},
-    {MySqlLeaseMgr::GET_LEASE6_EXPIRE,
+    {MySqlLeaseMgrImpl::GET_LEASE6_EXPIRE,
+                    "SELECT address, duid, valid_lifetime, "
+                        "expire, subnet_id, pref_lifetime, "
+                        "lease_type, iaid, prefix_len, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "hwaddr, hwtype, hwaddr_source, "
+                        "state "
+                            "FROM lease6 "
+                            "WHERE state != ? AND expire < ? "
+                            "ORDER BY expire ASC, address ASC "
+                            "LIMIT ?"},
+    {MySqlLeaseMgrImpl::GET_LEASE6_EXPIRE_NEXT,
                     "SELECT address, duid, valid_lifetime, "
                         "expire, subnet_id, pref_lifetime, "
                         "lease_type, iaid, prefix_len, "
@@ -177,16 +256,39 @@ tagged_statements = { {
                         "state "
                             "FROM lease6 "
                             "WHERE state != ? AND expire < ? "
-                            "ORDER BY expire ASC "
+                            "AND (expire > ? OR (expire = ? AND address > ?)) "
+                            "ORDER BY expire ASC, address ASC "
                             "LIMIT ?"},
-    {MySqlLeaseMgr::GET_VERSION,
+    {MySqlLeaseMgrImpl::GET_LEASE6_PAGE,
+                    "SELECT address, duid, valid_lifetime, "
+                        "expire, subnet_id, pref_lifetime, "
+                        "lease_type, iaid, prefix_len, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "hwaddr, hwtype, hwaddr_source, "
+                        "state "
+                            "FROM lease6 "
+                            "WHERE address > ? "
+                            "ORDER BY address "
+                            "LIMIT ?"},
+    {MySqlLeaseMgrImpl::GET_LEASE6_PAGE_SUBID,
+                    "SELECT address, duid, valid_lifetime, "
+                        "expire, subnet_id, pref_lifetime, "
+                        "lease_type, iaid, prefix_len, "
+                        "fqdn_fwd, fqdn_rev, hostname, "
+                        "hwaddr, hwtype, hwaddr_source, "
+                        "state "
+                            "FROM lease6 "
+                            "WHERE address > ? AND subnet_id = ? "
+                            "ORDER BY address "
+                            "LIMIT ?"},
+    {MySqlLeaseMgrImpl::GET_VERSION,
                     "SELECT version, minor FROM schema_version"},
-    {MySqlLeaseMgr::INSERT_LEASE4,
+    {MySqlLeaseMgrImpl::INSERT_LEASE4,
                     "INSERT INTO lease4(address, hwaddr, client_id, "
                         "valid_lifetime, expire, subnet_id, "
                         "fqdn_fwd, fqdn_rev, hostname, state) "
                             "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"},
-    {MySqlLeaseMgr::INSERT_LEASE6,
+    {MySqlLeaseMgrImpl::INSERT_LEASE6,
                     "INSERT INTO lease6(address, duid, valid_lifetime, "
                         "expire, subnet_id, pref_lifetime, "
                         "lease_type, iaid, prefix_len, "
@@ -194,13 +296,13 @@ tagged_statements = { {
                         "hwaddr, hwtype, hwaddr_source, "
                         "state) "
                             "VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"},
-    {MySqlLeaseMgr::UPDATE_LEASE4,
+    {MySqlLeaseMgrImpl::UPDATE_LEASE4,
                     "UPDATE lease4 SET address = ?, hwaddr = ?, "
                         "client_id = ?, valid_lifetime = ?, expire = ?, "
                         "subnet_id = ?, fqdn_fwd = ?, fqdn_rev = ?, "
                         "hostname = ?, state = ? "
                             "WHERE address = ?"},
-    {MySqlLeaseMgr::UPDATE_LEASE6,
+    {MySqlLeaseMgrImpl::UPDATE_LEASE6,
                     "UPDATE lease6 SET address = ?, duid = ?, "
                         "valid_lifetime = ?, expire = ?, subnet_id = ?, "
                         "pref_lifetime = ?, lease_type = ?, iaid = ?, "
@@ -208,10 +310,10 @@ tagged_statements = { {
                         "hostname = ?, hwaddr = ?, hwtype = ?, hwaddr_source = ?, "
                         "state = ? "
                             "WHERE address = ?"},
-    {MySqlLeaseMgr::RECOUNT_LEASE4_STATS,
+    {MySqlLeaseMgrImpl::RECOUNT_LEASE4_STATS,
      "SELECT subnet_id, state, count(state) as state_count "
      "  FROM lease4 GROUP BY subnet_id, state ORDER BY subnet_id"},
-    {MySqlLeaseMgr::RECOUNT_LEASE6_STATS,
+    {MySqlLeaseMgrImpl::RECOUNT_LEASE6_STATS,
      "SELECT subnet_id, lease_type, state, count(state) as state_count"
      "  FROM lease6 GROUP BY subnet_id, lease_type, state "
      "  ORDER BY subnet_id" }
@@ -298,7 +400,7 @@ public:
 /// to hold things like data length etc.  This object holds those variables.
 ///
 /// @note There are no unit tests for this class.  It is tested indirectly
-/// in all MySqlLeaseMgr::xxx4() calls where it is used.
+/// in all MySqlLeaseMgrImpl::xxx4() calls where it is used.
 
 class MySqlLease4Exchange : public MySqlLeaseExchange {
     /// @brief Set number of database columns for this lease structure
@@ -676,7 +778,7 @@ private:
 /// to hold things like data length etc.  This object holds those variables.
 ///
 /// @note There are no unit tests for this class.  It is tested indirectly
-/// in all MySqlLeaseMgr::xxx6() calls where it is used.
+/// in all MySqlLeaseMgrImpl::xxx6() calls where it is used.
 
 class MySqlLease6Exchange : public MySqlLeaseExchange {
     /// @brief Set number of database columns for this lease structure
@@ -1245,7 +1347,7 @@ public:
           // This is the number of columns expected in the result set
           bind_(fetch_type_ ? 4 : 3),
           subnet_id_(0), lease_type_(0), lease_state_(0), state_count_(0) {
-        if (statement_index_ >= MySqlLeaseMgr::NUM_STATEMENTS) {
+        if (statement_index_ >= MySqlLeaseMgrImpl::NUM_STATEMENTS) {
             isc_throw(BadValue, "MySqlLeaseStatsQuery"
                       " - invalid statement index" << statement_index_);
         }
@@ -1364,9 +1466,9 @@ private:
     uint32_t state_count_;
 };
 
-// MySqlLeaseMgr Constructor and Destructor
+// MySqlLeaseMgrImpl Constructor and Destructor
 
-MySqlLeaseMgr::MySqlLeaseMgr(const MySqlConnection::ParameterMap& parameters)
+MySqlLeaseMgrImpl::MySqlLeaseMgrImpl(const MySqlConnection::ParameterMap& parameters)
     : conn_(parameters) {
 
     // Open the database.
@@ -1392,11 +1494,189 @@ MySqlLeaseMgr::MySqlLeaseMgr(const MySqlConnection::ParameterMap& parameters)
 }
 
 
-MySqlLeaseMgr::~MySqlLeaseMgr() {
+MySqlLeaseMgrImpl::~MySqlLeaseMgrImpl() {
     // There is no need to close the database in this destructor: it is
     // closed in the destructor of the mysql_ member variable.
 }
 
+// MySqlLeaseMgr Constructor and Destructor
+
+MySqlLeaseMgr::MySqlLeaseMgr(const MySqlConnection::ParameterMap& parameters)
+    : PooledLeaseMgr(parameters,
+                     boost::bind(&MySqlLeaseMgr::createPooledMgr, parameters),
+                     &MySqlLeaseMgr::checkPooledMgr),
+      async_outstanding_(0), async_stop_(false) {
+}
+
+MySqlLeaseMgr::~MySqlLeaseMgr() {
+    stopAsyncWorker();
+}
+
+void
+MySqlLeaseMgr::asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                              const Lease4Handler& handler) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_ASYNC_QUERY).arg(addr.toText());
+    queueAsyncQuery(boost::bind(static_cast<Lease4Ptr (*)
+                                (const LeaseMgr&, const isc::asiolink::IOAddress&)>
+                                (&lookupLease4), _1, addr), handler);
+}
+
+void
+MySqlLeaseMgr::asyncGetLease4(const HWAddr& hwaddr, SubnetID subnet_id,
+                              const Lease4Handler& handler) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_ASYNC_QUERY).arg(hwaddr.toText());
+    queueAsyncQuery(boost::bind(static_cast<Lease4Ptr (*)
+                                (const LeaseMgr&, const HWAddr&, SubnetID)>
+                                (&lookupLease4), _1, hwaddr, subnet_id),
+                    handler);
+}
+
+void
+MySqlLeaseMgr::asyncGetLease4(const ClientId& clientid, SubnetID subnet_id,
+                              const Lease4Handler& handler) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_ASYNC_QUERY).arg(clientid.toText());
+    queueAsyncQuery(boost::bind(static_cast<Lease4Ptr (*)
+                                (const LeaseMgr&, const ClientId&, SubnetID)>
+                                (&lookupLease4), _1, clientid, subnet_id),
+                    handler);
+}
+
+void
+MySqlLeaseMgr::queueAsyncQuery(const boost::function<Lease4Ptr (const LeaseMgr&)>&
+                               lookup, const Lease4Handler& handler) {
+    if (!async_thread_) {
+        try {
+            // The worker uses its own connection rather than the pooled
+            // ones, so as the lookups don't hold up the queries issued by
+            // the main thread, even if the pool holds a single connection.
+            async_watch_.reset(new util::WatchSocket());
+            IfaceMgr::instance().addExternalSocket(async_watch_->getSelectFd(),
+                                                   boost::bind(&MySqlLeaseMgr::
+                                                               processAsyncResults,
+                                                               this));
+            async_stop_ = false;
+            async_thread_.reset(new Thread(boost::bind(&MySqlLeaseMgr::
+                                                       asyncWorker, this)));
+
+        } catch (const std::exception& ex) {
+            stopAsyncWorker();
+            handler(Lease4Ptr(), ex.what());
+            return;
+        }
+    }
+
+    AsyncQueryPtr query(new AsyncQuery());
+    query->lookup_ = lookup;
+    query->handler_ = handler;
+
+    Mutex::Locker lock(async_mutex_);
+    async_pending_.push_back(query);
+    ++async_outstanding_;
+    async_cond_.signal();
+}
+
+void
+MySqlLeaseMgr::asyncWorker() {
+    // The MySQL client library requires per thread initialization.
+    mysql_thread_init();
+
+    // The lease manager executing the lookups is created upon the first
+    // lookup and re-created after the connection has been lost. It is
+    // destroyed before the thread specific data is released.
+    LeasePool::ConnectionPtr mgr;
+
+    for (;;) {
+        AsyncQueryPtr query;
+        {
+            Mutex::Locker lock(async_mutex_);
+            while (async_pending_.empty() && !async_stop_) {
+                async_cond_.wait(async_mutex_);
+            }
+            if (async_stop_) {
+                break;
+            }
+            query = async_pending_.front();
+            async_pending_.pop_front();
+        }
+
+        try {
+            if (!mgr) {
+                mgr = createPooledMgr(parameters_);
+            }
+            query->lease_ = query->lookup_(*mgr);
+
+        } catch (const std::exception& ex) {
+            query->error_ = ex.what();
+            if (mgr && !checkPooledMgr(*mgr)) {
+                mgr.reset();
+            }
+        }
+
+        // The watch socket is marked under the mutex, so as it can't be
+        // cleared by the main thread between checking and marking it.
+        Mutex::Locker lock(async_mutex_);
+        async_completed_.push_back(query);
+        async_watch_->markReady();
+    }
+
+    mgr.reset();
+    mysql_thread_end();
+}
+
+void
+MySqlLeaseMgr::processAsyncResults() {
+    std::list<AsyncQueryPtr> completed;
+    {
+        Mutex::Locker lock(async_mutex_);
+        completed.swap(async_completed_);
+        if (async_watch_) {
+            async_watch_->clearReady();
+        }
+    }
+
+    for (std::list<AsyncQueryPtr>::const_iterator query = completed.begin();
+         query != completed.end(); ++query) {
+        --async_outstanding_;
+        (*query)->handler_((*query)->lease_, (*query)->error_);
+    }
+}
+
+MySqlLeaseMgr::LeasePool::ConnectionPtr
+MySqlLeaseMgr::createPooledMgr(const MySqlConnection::ParameterMap& parameters) {
+    return (LeasePool::ConnectionPtr(new MySqlLeaseMgrImpl(parameters)));
+}
+
+bool
+MySqlLeaseMgr::checkPooledMgr(LeaseMgr& mgr) {
+    return (static_cast<MySqlLeaseMgrImpl&>(mgr).ping());
+}
+
+void
+MySqlLeaseMgr::stopAsyncWorker() {
+    if (async_thread_) {
+        {
+            Mutex::Locker lock(async_mutex_);
+            async_stop_ = true;
+            async_cond_.signal();
+        }
+        async_thread_->wait();
+        async_thread_.reset();
+    }
+
+    if (async_watch_) {
+        IfaceMgr::instance().deleteExternalSocket(async_watch_->getSelectFd());
+        async_watch_.reset();
+    }
+
+    // Lookups which haven't been completed are dropped.
+    async_pending_.clear();
+    async_completed_.clear();
+    async_outstanding_ = 0;
+}
+
 std::string
 MySqlLeaseMgr::getDBVersion() {
     std::stringstream tmp;
@@ -1411,8 +1691,8 @@ MySqlLeaseMgr::getDBVersion() {
 // statement, then call common code to execute the statement.
 
 bool
-MySqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
-                              std::vector<MYSQL_BIND>& bind) {
+MySqlLeaseMgrImpl::addLeaseCommon(StatementIndex stindex,
+                                  std::vector<MYSQL_BIND>& bind) {
 
     // Bind the parameters to the statement
     int status = mysql_stmt_bind_param(conn_.statements_[stindex], &bind[0]);
@@ -1436,7 +1716,7 @@ MySqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
 }
 
 bool
-MySqlLeaseMgr::addLease(const Lease4Ptr& lease) {
+MySqlLeaseMgrImpl::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_ADD_ADDR4).arg(lease->addr_.toText());
 
@@ -1448,7 +1728,7 @@ MySqlLeaseMgr::addLease(const Lease4Ptr& lease) {
 }
 
 bool
-MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
+MySqlLeaseMgrImpl::addLease(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_ADD_ADDR6).arg(lease->addr_.toText())
               .arg(lease->type_);
@@ -1486,11 +1766,11 @@ MySqlLeaseMgr::addLease(const Lease6Ptr& lease) {
 // holding zero or one leases into an appropriate Lease object.
 
 template <typename Exchange, typename LeaseCollection>
-void MySqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
-                                       MYSQL_BIND* bind,
-                                       Exchange& exchange,
-                                       LeaseCollection& result,
-                                       bool single) const {
+void MySqlLeaseMgrImpl::getLeaseCollection(StatementIndex stindex,
+                                           MYSQL_BIND* bind,
+                                           Exchange& exchange,
+                                           LeaseCollection& result,
+                                           bool single) const {
 
     // Bind the selection parameters to the statement
     int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
@@ -1546,8 +1826,8 @@ void MySqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
 }
 
 
-void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
-                             Lease4Ptr& result) const {
+void MySqlLeaseMgrImpl::getLease(StatementIndex stindex, MYSQL_BIND* bind,
+                                 Lease4Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
     // that the called method should throw an exception if multiple
@@ -1565,8 +1845,8 @@ void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
 }
 
 
-void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
-                             Lease6Ptr& result) const {
+void MySqlLeaseMgrImpl::getLease(StatementIndex stindex, MYSQL_BIND* bind,
+                                 Lease6Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
     // that the called method should throw an exception if multiple
@@ -1588,7 +1868,7 @@ void MySqlLeaseMgr::getLease(StatementIndex stindex, MYSQL_BIND* bind,
 // criteria.
 
 Lease4Ptr
-MySqlLeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
+MySqlLeaseMgrImpl::getLease4(const isc::asiolink::IOAddress& addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_ADDR4).arg(addr.toText());
 
@@ -1610,7 +1890,7 @@ MySqlLeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
 
 
 Lease4Collection
-MySqlLeaseMgr::getLease4(const HWAddr& hwaddr) const {
+MySqlLeaseMgrImpl::getLease4(const HWAddr& hwaddr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_HWADDR).arg(hwaddr.toText());
 
@@ -1640,7 +1920,7 @@ MySqlLeaseMgr::getLease4(const HWAddr& hwaddr) const {
 
 
 Lease4Ptr
-MySqlLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
+MySqlLeaseMgrImpl::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_SUBID_HWADDR)
         .arg(subnet_id).arg(hwaddr.toText());
@@ -1675,7 +1955,7 @@ MySqlLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
 
 
 Lease4Collection
-MySqlLeaseMgr::getLease4(const ClientId& clientid) const {
+MySqlLeaseMgrImpl::getLease4(const ClientId& clientid) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_CLIENTID).arg(clientid.toText());
 
@@ -1698,17 +1978,17 @@ MySqlLeaseMgr::getLease4(const ClientId& clientid) const {
 }
 
 Lease4Ptr
-MySqlLeaseMgr::getLease4(const ClientId&, const HWAddr&, SubnetID) const {
+MySqlLeaseMgrImpl::getLease4(const ClientId&, const HWAddr&, SubnetID) const {
     /// This function is currently not implemented because allocation engine
     /// searches for the lease using HW address or client identifier.
     /// It never uses both parameters in the same time. We need to
     /// consider if this function is needed at all.
-    isc_throw(NotImplemented, "The MySqlLeaseMgr::getLease4 function was"
+    isc_throw(NotImplemented, "The MySqlLeaseMgrImpl::getLease4 function was"
               " called, but it is not implemented");
 }
 
 Lease4Ptr
-MySqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
+MySqlLeaseMgrImpl::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_SUBID_CLIENTID)
               .arg(subnet_id).arg(clientid.toText());
@@ -1737,8 +2017,8 @@ MySqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
 
 
 Lease6Ptr
-MySqlLeaseMgr::getLease6(Lease::Type lease_type,
-                         const isc::asiolink::IOAddress& addr) const {
+MySqlLeaseMgrImpl::getLease6(Lease::Type lease_type,
+                             const isc::asiolink::IOAddress& addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_ADDR6).arg(addr.toText())
               .arg(lease_type);
@@ -1770,8 +2050,8 @@ MySqlLeaseMgr::getLease6(Lease::Type lease_type,
 
 
 Lease6Collection
-MySqlLeaseMgr::getLeases6(Lease::Type lease_type,
-                          const DUID& duid, uint32_t iaid) const {
+MySqlLeaseMgrImpl::getLeases6(Lease::Type lease_type,
+                              const DUID& duid, uint32_t iaid) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_IAID_DUID).arg(iaid).arg(duid.toText())
               .arg(lease_type);
@@ -1818,9 +2098,9 @@ MySqlLeaseMgr::getLeases6(Lease::Type lease_type,
 }
 
 Lease6Collection
-MySqlLeaseMgr::getLeases6(Lease::Type lease_type,
-                          const DUID& duid, uint32_t iaid,
-                          SubnetID subnet_id) const {
+MySqlLeaseMgrImpl::getLeases6(Lease::Type lease_type,
+                              const DUID& duid, uint32_t iaid,
+                              SubnetID subnet_id) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_GET_IAID_SUBID_DUID)
               .arg(iaid).arg(subnet_id).arg(duid.toText())
@@ -1863,26 +2143,180 @@ MySqlLeaseMgr::getLeases6(Lease::Type lease_type,
 }
 
 void
-MySqlLeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
-                                 const size_t max_leases) const {
+MySqlLeaseMgrImpl::getExpiredLeases6(Lease6Collection& expired_leases,
+                                     const size_t max_leases) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_EXPIRED6)
         .arg(max_leases);
     getExpiredLeasesCommon(expired_leases, max_leases, GET_LEASE6_EXPIRE);
 }
 
 void
-MySqlLeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
-                                 const size_t max_leases) const {
+MySqlLeaseMgrImpl::getExpiredLeases4(Lease4Collection& expired_leases,
+                                     const size_t max_leases) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_EXPIRED4)
         .arg(max_leases);
     getExpiredLeasesCommon(expired_leases, max_leases, GET_LEASE4_EXPIRE);
 }
 
+void
+MySqlLeaseMgrImpl::getNextExpiredLeases6(Lease6Collection& expired_leases,
+                                         const size_t max_leases,
+                                         const int64_t last_expire,
+                                         const isc::asiolink::IOAddress& last_address) const {
+    // Start from the first expired lease.
+    if (last_expire == std::numeric_limits<int64_t>::min()) {
+        getExpiredLeases6(expired_leases, max_leases);
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_EXPIRED6)
+        .arg(max_leases);
+
+    MYSQL_BIND address_bind;
+    memset(&address_bind, 0, sizeof(address_bind));
+
+    std::string addr6 = last_address.toText();
+    unsigned long addr6_length = addr6.size();
+    address_bind.buffer_type = MYSQL_TYPE_STRING;
+    address_bind.buffer = const_cast<char*>(addr6.c_str());
+    address_bind.buffer_length = addr6_length;
+    address_bind.length = &addr6_length;
+
+    getNextExpiredLeasesCommon(expired_leases, max_leases, last_expire,
+                               address_bind, GET_LEASE6_EXPIRE_NEXT);
+}
+
+void
+MySqlLeaseMgrImpl::getNextExpiredLeases4(Lease4Collection& expired_leases,
+                                         const size_t max_leases,
+                                         const int64_t last_expire,
+                                         const isc::asiolink::IOAddress& last_address) const {
+    // Start from the first expired lease.
+    if (last_expire == std::numeric_limits<int64_t>::min()) {
+        getExpiredLeases4(expired_leases, max_leases);
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_EXPIRED4)
+        .arg(max_leases);
+
+    MYSQL_BIND address_bind;
+    memset(&address_bind, 0, sizeof(address_bind));
+
+    uint32_t addr4 = last_address.toUint32();
+    address_bind.buffer_type = MYSQL_TYPE_LONG;
+    address_bind.buffer = reinterpret_cast<char*>(&addr4);
+    address_bind.is_unsigned = MLM_TRUE;
+
+    getNextExpiredLeasesCommon(expired_leases, max_leases, last_expire,
+                               address_bind, GET_LEASE4_EXPIRE_NEXT);
+}
+
+Lease4Collection
+MySqlLeaseMgrImpl::getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                                  const isc::asiolink::IOAddress& upper_bound_address,
+                                  const SubnetID& subnet_id,
+                                  const size_t page_size) const {
+    checkLeases4PageArgs(lower_bound_address, upper_bound_address, page_size);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_PAGE4)
+        .arg(page_size)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    // Set up the WHERE clause value
+    MYSQL_BIND inbind[4];
+    memset(inbind, 0, sizeof(inbind));
+    size_t index = 0;
+
+    uint32_t lower_bound = lower_bound_address.toUint32();
+    inbind[index].buffer_type = MYSQL_TYPE_LONG;
+    inbind[index].buffer = reinterpret_cast<char*>(&lower_bound);
+    inbind[index++].is_unsigned = MLM_TRUE;
+
+    uint32_t upper_bound = upper_bound_address.toUint32();
+    inbind[index].buffer_type = MYSQL_TYPE_LONG;
+    inbind[index].buffer = reinterpret_cast<char*>(&upper_bound);
+    inbind[index++].is_unsigned = MLM_TRUE;
+
+    uint32_t subnet = static_cast<uint32_t>(subnet_id);
+    if (subnet_id != 0) {
+        inbind[index].buffer_type = MYSQL_TYPE_LONG;
+        inbind[index].buffer = reinterpret_cast<char*>(&subnet);
+        inbind[index++].is_unsigned = MLM_TRUE;
+    }
+
+    // The page size is limited by the LIMIT type.
+    uint32_t limit = static_cast<uint32_t>(std::min(page_size,
+        static_cast<size_t>(std::numeric_limits<uint32_t>::max())));
+    inbind[index].buffer_type = MYSQL_TYPE_LONG;
+    inbind[index].buffer = reinterpret_cast<char*>(&limit);
+    inbind[index].is_unsigned = MLM_TRUE;
+
+    // Get the data
+    Lease4Collection result;
+    getLeaseCollection(subnet_id == 0 ? GET_LEASE4_PAGE : GET_LEASE4_PAGE_SUBID,
+                       inbind, result);
+    return (result);
+}
+
+Lease6Collection
+MySqlLeaseMgrImpl::getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                                  const SubnetID& subnet_id,
+                                  const size_t page_size) const {
+    checkLeases6PageArgs(lower_bound_address, page_size);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_GET_PAGE6)
+        .arg(page_size)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    // Set up the WHERE clause value
+    MYSQL_BIND inbind[3];
+    memset(inbind, 0, sizeof(inbind));
+    size_t index = 0;
+
+    // The addresses are compared as text and "::" does not precede the
+    // other addresses, so the first page starts after an empty string.
+    std::string lower_bound;
+    if (!lower_bound_address.isV6Zero()) {
+        lower_bound = lower_bound_address.toText();
+    }
+    unsigned long lower_bound_length = lower_bound.size();
+
+    // See the earlier description of the use of "const_cast" when accessing
+    // the address for an explanation of the reason.
+    inbind[index].buffer_type = MYSQL_TYPE_STRING;
+    inbind[index].buffer = const_cast<char*>(lower_bound.c_str());
+    inbind[index].buffer_length = lower_bound_length;
+    inbind[index++].length = &lower_bound_length;
+
+    uint32_t subnet = static_cast<uint32_t>(subnet_id);
+    if (subnet_id != 0) {
+        inbind[index].buffer_type = MYSQL_TYPE_LONG;
+        inbind[index].buffer = reinterpret_cast<char*>(&subnet);
+        inbind[index++].is_unsigned = MLM_TRUE;
+    }
+
+    // The page size is limited by the LIMIT type.
+    uint32_t limit = static_cast<uint32_t>(std::min(page_size,
+        static_cast<size_t>(std::numeric_limits<uint32_t>::max())));
+    inbind[index].buffer_type = MYSQL_TYPE_LONG;
+    inbind[index].buffer = reinterpret_cast<char*>(&limit);
+    inbind[index].is_unsigned = MLM_TRUE;
+
+    // Get the data
+    Lease6Collection result;
+    getLeaseCollection(subnet_id == 0 ? GET_LEASE6_PAGE : GET_LEASE6_PAGE_SUBID,
+                       inbind, result);
+    return (result);
+}
+
 template<typename LeaseCollection>
 void
-MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
-                                      const size_t max_leases,
-                                      StatementIndex statement_index) const {
+MySqlLeaseMgrImpl::getExpiredLeasesCommon(LeaseCollection& expired_leases,
+                                          const size_t max_leases,
+                                          StatementIndex statement_index) const {
     // Set up the WHERE clause value
     MYSQL_BIND inbind[3];
     memset(inbind, 0, sizeof(inbind));
@@ -1912,6 +2346,56 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     getLeaseCollection(statement_index, inbind, expired_leases);
 }
 
+template<typename LeaseCollection>
+void
+MySqlLeaseMgrImpl::getNextExpiredLeasesCommon(LeaseCollection& expired_leases,
+                                              const size_t max_leases,
+                                              const int64_t last_expire,
+                                              const MYSQL_BIND& address_bind,
+                                              StatementIndex statement_index) const {
+    // Set up the WHERE clause value
+    MYSQL_BIND inbind[6];
+    memset(inbind, 0, sizeof(inbind));
+
+    // Exclude reclaimed leases.
+    uint32_t state = static_cast<uint32_t>(Lease::STATE_EXPIRED_RECLAIMED);
+    inbind[0].buffer_type = MYSQL_TYPE_LONG;
+    inbind[0].buffer = reinterpret_cast<char*>(&state);
+    inbind[0].is_unsigned = MLM_TRUE;
+
+    // Expiration timestamp.
+    MYSQL_TIME expire_time;
+    conn_.convertToDatabaseTime(time(NULL), expire_time);
+    inbind[1].buffer_type = MYSQL_TYPE_TIMESTAMP;
+    inbind[1].buffer = reinterpret_cast<char*>(&expire_time);
+    inbind[1].buffer_length = sizeof(expire_time);
+
+    // Expiration time of the last lease returned previously, compared
+    // twice by the query.
+    MYSQL_TIME last_expire_time;
+    conn_.convertToDatabaseTime(static_cast<time_t>(last_expire),
+                                last_expire_time);
+    for (int i = 2; i < 4; ++i) {
+        inbind[i].buffer_type = MYSQL_TYPE_TIMESTAMP;
+        inbind[i].buffer = reinterpret_cast<char*>(&last_expire_time);
+        inbind[i].buffer_length = sizeof(last_expire_time);
+    }
+
+    // Address of the last lease returned previously.
+    inbind[4] = address_bind;
+
+    // If the number of leases is 0, we will return all leases. This is
+    // achieved by setting the limit to a very high value.
+    uint32_t limit = max_leases > 0 ? static_cast<uint32_t>(max_leases) :
+        std::numeric_limits<uint32_t>::max();
+    inbind[5].buffer_type = MYSQL_TYPE_LONG;
+    inbind[5].buffer = reinterpret_cast<char*>(&limit);
+    inbind[5].is_unsigned = MLM_TRUE;
+
+    // Get the data
+    getLeaseCollection(statement_index, inbind, expired_leases);
+}
+
 
 
 // Update lease methods.  These comprise common code that handles the actual
@@ -1920,8 +2404,8 @@ MySqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
 
 template <typename LeasePtr>
 void
-MySqlLeaseMgr::updateLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind,
-                                 const LeasePtr& lease) {
+MySqlLeaseMgrImpl::updateLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind,
+                                     const LeasePtr& lease) {
 
     // Bind the parameters to the statement
     int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
@@ -1947,7 +2431,7 @@ MySqlLeaseMgr::updateLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind,
 
 
 void
-MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
+MySqlLeaseMgrImpl::updateLease4(const Lease4Ptr& lease) {
     const StatementIndex stindex = UPDATE_LEASE4;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1972,7 +2456,7 @@ MySqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
 
 
 void
-MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
+MySqlLeaseMgrImpl::updateLease6(const Lease6Ptr& lease) {
     const StatementIndex stindex = UPDATE_LEASE6;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -2007,7 +2491,7 @@ MySqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 // handles the common processing.
 
 uint64_t
-MySqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind) {
+MySqlLeaseMgrImpl::deleteLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind) {
 
     // Bind the input parameters to the statement
     int status = mysql_stmt_bind_param(conn_.statements_[stindex], bind);
@@ -2023,7 +2507,7 @@ MySqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex, MYSQL_BIND* bind) {
 }
 
 bool
-MySqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
+MySqlLeaseMgrImpl::deleteLease(const isc::asiolink::IOAddress& addr) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_DELETE_ADDR).arg(addr.toText());
 
@@ -2055,8 +2539,80 @@ MySqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
     }
 }
 
+void
+MySqlLeaseMgrImpl::updateLeases4(const Lease4Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_UPDATE_ADDRS4).arg(leases.size());
+
+    if (leases.empty()) {
+        return;
+    }
+
+    // Run all updates within a single transaction. This overrides the
+    // autocommit setting, so the changes are flushed to disk once for the
+    // whole collection rather than once per lease.
+    MySqlTransaction transaction(conn_);
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        updateLease4(*lease);
+    }
+    transaction.commit();
+}
+
+uint64_t
+MySqlLeaseMgrImpl::deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_DELETE_ADDRS4).arg(addrs.size());
+
+    if (addrs.empty()) {
+        return (0);
+    }
+
+    // Set up the WHERE clause value. The same binding is reused for all
+    // addresses, only the bound value changes.
+    uint32_t addr4 = 0;
+    MYSQL_BIND inbind[1];
+    memset(inbind, 0, sizeof(inbind));
+    inbind[0].buffer_type = MYSQL_TYPE_LONG;
+    inbind[0].buffer = reinterpret_cast<char*>(&addr4);
+    inbind[0].is_unsigned = MLM_TRUE;
+
+    uint64_t deleted = 0;
+    MySqlTransaction transaction(conn_);
+    for (std::vector<isc::asiolink::IOAddress>::const_iterator addr =
+             addrs.begin(); addr != addrs.end(); ++addr) {
+        if (!addr->isV4()) {
+            isc_throw(BadValue, "unable to delete leases: address "
+                      << *addr << " is not an IPv4 address");
+        }
+        addr4 = addr->toUint32();
+        deleted += deleteLeaseCommon(DELETE_LEASE4, inbind);
+    }
+    transaction.commit();
+
+    return (deleted);
+}
+
+Lease4Collection
+MySqlLeaseMgrImpl::storeLeases4(const Lease4Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_MYSQL_STORE_ADDRS4).arg(leases.size());
+
+    if (leases.empty()) {
+        return (Lease4Collection());
+    }
+
+    // Add or update all leases within a single transaction, so the changes
+    // are committed once for the whole collection and none of them is
+    // stored if any of the queries fails.
+    MySqlTransaction transaction(conn_);
+    Lease4Collection replaced = LeaseMgr::storeLeases4(leases);
+    transaction.commit();
+    return (replaced);
+}
+
 uint64_t
-MySqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
+MySqlLeaseMgrImpl::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED4)
         .arg(secs);
@@ -2064,7 +2620,7 @@ MySqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
 }
 
 uint64_t
-MySqlLeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
+MySqlLeaseMgrImpl::deleteExpiredReclaimedLeases6(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_MYSQL_DELETE_EXPIRED_RECLAIMED6)
         .arg(secs);
@@ -2072,8 +2628,8 @@ MySqlLeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
 }
 
 uint64_t
-MySqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
-                                                  StatementIndex statement_index) {
+MySqlLeaseMgrImpl::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
+                                                      StatementIndex statement_index) {
     // Set up the WHERE clause value
     MYSQL_BIND inbind[2];
     memset(inbind, 0, sizeof(inbind));
@@ -2105,7 +2661,7 @@ MySqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
 // Miscellaneous database methods.
 
 std::string
-MySqlLeaseMgr::getName() const {
+MySqlLeaseMgrImpl::getName() const {
     std::string name = "";
     try {
         name = conn_.getParameter("name");
@@ -2116,6 +2672,12 @@ MySqlLeaseMgr::getName() const {
 }
 
 
+std::string
+MySqlLeaseMgrImpl::getDescription() const {
+    return (std::string("MySQL Database"));
+}
+
+
 std::string
 MySqlLeaseMgr::getDescription() const {
     return (std::string("MySQL Database"));
@@ -2123,7 +2685,7 @@ MySqlLeaseMgr::getDescription() const {
 
 
 std::pair<uint32_t, uint32_t>
-MySqlLeaseMgr::getVersion() const {
+MySqlLeaseMgrImpl::getVersion() const {
     const StatementIndex stindex = GET_VERSION;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -2173,7 +2735,7 @@ MySqlLeaseMgr::getVersion() const {
 }
 
 LeaseStatsQueryPtr
-MySqlLeaseMgr::startLeaseStatsQuery4() {
+MySqlLeaseMgrImpl::startLeaseStatsQuery4() {
     LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
                                                       RECOUNT_LEASE4_STATS,
                                                       false));
@@ -2182,7 +2744,7 @@ MySqlLeaseMgr::startLeaseStatsQuery4() {
 }
 
 LeaseStatsQueryPtr
-MySqlLeaseMgr::startLeaseStatsQuery6() {
+MySqlLeaseMgrImpl::startLeaseStatsQuery6() {
     LeaseStatsQueryPtr query(new MySqlLeaseStatsQuery(conn_,
                                                       RECOUNT_LEASE6_STATS,
                                                       true));
@@ -2191,7 +2753,7 @@ MySqlLeaseMgr::startLeaseStatsQuery6() {
 }
 
 void
-MySqlLeaseMgr::commit() {
+MySqlLeaseMgrImpl::commit() {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_COMMIT);
     if (mysql_commit(conn_.mysql_) != 0) {
         isc_throw(DbOperationError, "commit failed: " << mysql_error(conn_.mysql_));
@@ -2200,7 +2762,7 @@ MySqlLeaseMgr::commit() {
 
 
 void
-MySqlLeaseMgr::rollback() {
+MySqlLeaseMgrImpl::rollback() {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_MYSQL_ROLLBACK);
     if (mysql_rollback(conn_.mysql_) != 0) {
         isc_throw(DbOperationError, "rollback failed: " << mysql_error(conn_.mysql_));
@@ -2208,7 +2770,7 @@ MySqlLeaseMgr::rollback() {
 }
 
 void
-MySqlLeaseMgr::checkError(int status, StatementIndex index,
+MySqlLeaseMgrImpl::checkError(int status, StatementIndex index,
                            const char* what) const {
     conn_.checkError(status, index, what);
 }
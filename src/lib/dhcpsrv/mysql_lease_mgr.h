@@ -10,11 +10,19 @@
 #include <dhcp/hwaddr.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/mysql_connection.h>
+#include <dhcpsrv/pooled_lease_mgr.h>
 
+#include <util/threads/sync.h>
+#include <util/threads/thread.h>
+#include <util/watch_socket.h>
+
+#include <boost/function.hpp>
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/utility.hpp>
 #include <mysql.h>
 
+#include <list>
 #include <time.h>
 
 namespace isc {
@@ -25,29 +33,19 @@ namespace dhcp {
 class MySqlLease4Exchange;
 class MySqlLease6Exchange;
 
-/// @brief MySQL Lease Manager
+/// @brief MySQL lease manager using a single connection
 ///
-/// This class provides the \ref isc::dhcp::LeaseMgr interface to the MySQL
-/// database.  Use of this backend presupposes that a MySQL database is
-/// available and that the Kea schema has been created within it.
-
-class MySqlLeaseMgr : public LeaseMgr {
+/// This class implements the \ref isc::dhcp::LeaseMgr interface using a
+/// single connection to the MySQL database and the statements prepared for
+/// this connection, so it can execute one query at the time. The instances
+/// of this class are held in the pool of the @c MySqlLeaseMgr.
+class MySqlLeaseMgrImpl : public LeaseMgr {
 public:
 
     /// @brief Constructor
     ///
-    /// Uses the following keywords in the parameters passed to it to
-    /// connect to the database:
-    /// - name - Name of the database to which to connect (mandatory)
-    /// - host - Host to which to connect (optional, defaults to "localhost")
-    /// - user - Username under which to connect (optional)
-    /// - password - Password for "user" on the database (optional)
-    ///
-    /// If the database is successfully opened, the version number in the
-    /// schema_version table will be checked against hard-coded value in
-    /// the implementation file.
-    ///
-    /// Finally, all the SQL commands are pre-compiled.
+    /// Opens the database using the specified parameters and pre-compiles
+    /// all the SQL commands.
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
@@ -56,13 +54,10 @@ public:
     /// @throw isc::dhcp::DbOpenError Error opening the database
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
-    MySqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters);
+    MySqlLeaseMgrImpl(const DatabaseConnection::ParameterMap& parameters);
 
     /// @brief Destructor (closes database)
-    virtual ~MySqlLeaseMgr();
-
-    /// @brief Local version of getDBVersion() class method
-    static std::string getDBVersion();
+    virtual ~MySqlLeaseMgrImpl();
 
     /// @brief Adds an IPv4 lease
     ///
@@ -283,6 +278,87 @@ public:
     virtual void getExpiredLeases4(Lease4Collection& expired_leases,
                                    const size_t max_leases) const;
 
+    /// @brief Returns a collection of expired DHCPv6 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The leases are ordered by expiration time and address.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// are added.
+    /// @param max_leases A maximum number of leases to be returned or 0.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases6(Lease6Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The leases are ordered by expiration time and address.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// are added.
+    /// @param max_leases A maximum number of leases to be returned or 0.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases4(Lease4Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a page of IPv4 leases ordered by address.
+    ///
+    /// The page is selected using the primary key on the address column,
+    /// so the cost of fetching the page doesn't depend on the number of
+    /// the preceding leases.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses greater than this address.
+    /// @param upper_bound_address The page includes the leases with the
+    /// addresses lower than or equal to this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection
+    getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const isc::asiolink::IOAddress& upper_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Returns a page of IPv6 leases ordered by address.
+    ///
+    /// The addresses are stored as text, so the leases are ordered by the
+    /// textual representation of the address.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses following this address in the textual order. The "::"
+    /// address returns the first page.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection
+    getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
     /// @brief Updates IPv4 lease.
     ///
     /// Updates the record of the lease in the database (as identified by the
@@ -320,6 +396,47 @@ public:
     ///        failed.
     virtual bool deleteLease(const isc::asiolink::IOAddress& addr);
 
+    /// @brief Updates a collection of IPv4 leases.
+    ///
+    /// All leases are updated within a single transaction. If any of the
+    /// updates fails, the transaction is rolled back and none of the leases
+    /// is updated.
+    ///
+    /// @param leases Collection of leases to be updated.
+    ///
+    /// @throw isc::dhcp::NoSuchLease Attempt to update a lease that did not
+    ///        exist.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual void updateLeases4(const Lease4Collection& leases);
+
+    /// @brief Deletes a collection of IPv4 leases.
+    ///
+    /// All leases are deleted within a single transaction, so the changes
+    /// are committed to the database once for the whole collection.
+    ///
+    /// @param addrs Addresses of the leases to be deleted.
+    ///
+    /// @return Number of leases deleted.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual uint64_t
+    deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs);
+
+    /// @brief Stores a collection of IPv4 leases.
+    ///
+    /// All leases are added or updated within a single transaction, so
+    /// either all of them or none of them are stored.
+    ///
+    /// @param leases Collection of leases to be stored.
+    ///
+    /// @return Leases replaced by the stored ones.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection storeLeases4(const Lease4Collection& leases);
+
     /// @brief Deletes all expired-reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -400,10 +517,16 @@ public:
         GET_LEASE4_HWADDR,           // Get lease4 by HW address
         GET_LEASE4_HWADDR_SUBID,     // Get lease4 by HW address & subnet ID
         GET_LEASE4_EXPIRE,           // Get lease4 by expiration.
+        GET_LEASE4_EXPIRE_NEXT,      // Get lease4 by expiration & last lease
+        GET_LEASE4_PAGE,             // Get page of lease4 by address
+        GET_LEASE4_PAGE_SUBID,       // Get page of lease4 by address & subnet ID
         GET_LEASE6_ADDR,             // Get lease6 by address
         GET_LEASE6_DUID_IAID,        // Get lease6 by DUID and IAID
         GET_LEASE6_DUID_IAID_SUBID,  // Get lease6 by DUID, IAID and subnet ID
         GET_LEASE6_EXPIRE,           // Get lease6 by expiration.
+        GET_LEASE6_EXPIRE_NEXT,      // Get lease6 by expiration & last lease
+        GET_LEASE6_PAGE,             // Get page of lease6 by address
+        GET_LEASE6_PAGE_SUBID,       // Get page of lease6 by address & subnet ID
         GET_VERSION,                 // Obtain version number
         INSERT_LEASE4,               // Add entry to lease4 table
         INSERT_LEASE6,               // Add entry to lease6 table
@@ -414,7 +537,15 @@ public:
         NUM_STATEMENTS               // Number of statements
     };
 
+    /// @brief Checks if the connection is usable.
+    ///
+    /// @return true if the server responds to the ping.
+    bool ping() {
+        return (conn_.ping());
+    }
+
 private:
+
     /// @brief Add Lease Common Code
     ///
     /// This method performs the common actions for both flavours (V4 and V6)
@@ -542,6 +673,28 @@ private:
                                 const size_t max_leases,
                                 StatementIndex statement_index) const;
 
+    /// @brief Get expired leases following the last returned lease.
+    ///
+    /// This method retrieves expired and not reclaimed leases which follow
+    /// the specified expiration time and address in the order of the
+    /// expiration time and address.
+    ///
+    /// @param [out] expired_leases Reference to the container where the
+    ///        retrieved leases are put.
+    /// @param max_leases Maximum number of leases to be returned.
+    /// @param last_expire Expiration time of the last returned lease.
+    /// @param address_bind Binding of the address of the last returned lease.
+    /// @param statement_index One of the @c GET_LEASE4_EXPIRE_NEXT or
+    ///        @c GET_LEASE6_EXPIRE_NEXT.
+    ///
+    /// @tparam One of the @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollection>
+    void getNextExpiredLeasesCommon(LeaseCollection& expired_leases,
+                                    const size_t max_leases,
+                                    const int64_t last_expire,
+                                    const MYSQL_BIND& address_bind,
+                                    StatementIndex statement_index) const;
+
     /// @brief Update lease common code
     ///
     /// Holds the common code for updating a lease.  It binds the parameters
@@ -637,6 +790,191 @@ private:
     MySqlConnection conn_;
 };
 
+/// @brief MySQL Lease Manager
+///
+/// This class provides the \ref isc::dhcp::LeaseMgr interface to the MySQL
+/// database.  Use of this backend presupposes that a MySQL database is
+/// available and that the Kea schema has been created within it.
+///
+/// The queries are executed by the @c MySqlLeaseMgrImpl instances checked
+/// out from the pool of the @c PooledLeaseMgr.
+class MySqlLeaseMgr : public PooledLeaseMgr {
+public:
+
+    /// @brief Constructor
+    ///
+    /// Uses the following keywords in the parameters passed to it to
+    /// connect to the database:
+    /// - name - Name of the database to which to connect (mandatory)
+    /// - host - Host to which to connect (optional, defaults to "localhost")
+    /// - user - Username under which to connect (optional)
+    /// - password - Password for "user" on the database (optional)
+    ///
+    /// If the database is successfully opened, the version number in the
+    /// schema_version table will be checked against hard-coded value in
+    /// the implementation file.
+    ///
+    /// Finally, all the SQL commands are pre-compiled.
+    ///
+    /// The queries are executed using a pool of connections. The maximum
+    /// number of connections is specified with the "connection-pool-size"
+    /// keyword and defaults to 1. The first connection is opened by the
+    /// constructor, further connections are opened when the queries are
+    /// issued concurrently.
+    ///
+    /// @param parameters A data structure relating keywords and values
+    ///        concerned with the database.
+    ///
+    /// @throw isc::dhcp::NoDatabaseName Mandatory database name not given
+    /// @throw isc::dhcp::DbOpenError Error opening the database
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    /// @throw isc::dhcp::DbInvalidPoolSize Invalid connection pool size.
+    MySqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters);
+
+    /// @brief Destructor
+    virtual ~MySqlLeaseMgr();
+
+    /// @brief Local version of getDBVersion() class method
+    static std::string getDBVersion();
+
+    /// @brief Asynchronously returns an IPv4 lease for specified IPv4
+    /// address.
+    ///
+    /// The MySQL client library doesn't support non-blocking queries, so
+    /// the lookups are executed by a worker thread. The worker opens its
+    /// own connection rather than checking out the connections from the
+    /// pool, so as the lookups never hold up the queries issued by the
+    /// main thread. The worker thread is started upon the first
+    /// asynchronous lookup. When the lookup completes, the worker
+    /// signals it over a watch socket registered with the @c IfaceMgr, so
+    /// the @c handler is always invoked from within the server's receive
+    /// loop, i.e. by the main thread.
+    ///
+    /// @param addr address of the searched lease
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                                const Lease4Handler& handler);
+
+    /// @brief Asynchronously returns an IPv4 lease for specified hardware
+    /// address and a subnet.
+    ///
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const isc::dhcp::HWAddr& hwaddr,
+                                SubnetID subnet_id,
+                                const Lease4Handler& handler);
+
+    /// @brief Asynchronously returns an IPv4 lease for specified client-id
+    /// and a subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const ClientId& clientid,
+                                SubnetID subnet_id,
+                                const Lease4Handler& handler);
+
+    /// @brief Returns the number of asynchronous lookups in progress.
+    virtual size_t getAsyncPending() const {
+        return (async_outstanding_);
+    }
+
+    /// @brief Invokes handlers of the lookups completed by the worker thread.
+    ///
+    /// This method is invoked by the @c IfaceMgr when the watch socket
+    /// signals that there are completed lookups.
+    void processAsyncResults();
+
+    /// @brief Return backend type
+    ///
+    /// Returns the type of the backend (e.g. "mysql", "memfile" etc.)
+    ///
+    /// @return Type of the backend.
+    virtual std::string getType() const {
+        return (std::string("mysql"));
+    }
+
+    /// @brief Returns description of the backend.
+    ///
+    /// This description may be multiline text that describes the backend.
+    ///
+    /// @return Description of the backend.
+    virtual std::string getDescription() const;
+
+private:
+
+    /// @brief Creates a lease manager for the pool.
+    ///
+    /// @param parameters Parameters used to open the connection.
+    static LeasePool::ConnectionPtr
+    createPooledMgr(const DatabaseConnection::ParameterMap& parameters);
+
+    /// @brief Checks if the pooled lease manager's connection is usable.
+    ///
+    /// @param mgr Pooled lease manager.
+    static bool checkPooledMgr(LeaseMgr& mgr);
+
+    /// @brief Asynchronous IPv4 lease lookup.
+    struct AsyncQuery {
+        /// @brief Function performing the lookup using the worker's lease
+        /// manager.
+        boost::function<Lease4Ptr (const LeaseMgr&)> lookup_;
+
+        /// @brief Callback invoked when the lookup completes.
+        Lease4Handler handler_;
+
+        /// @brief Lease returned by the lookup.
+        Lease4Ptr lease_;
+
+        /// @brief Error description if the lookup failed.
+        std::string error_;
+    };
+
+    /// @brief Pointer to the asynchronous lookup.
+    typedef boost::shared_ptr<AsyncQuery> AsyncQueryPtr;
+
+    /// @brief Queues the lookup for the worker thread.
+    ///
+    /// Starts the worker thread if it hasn't been started yet.
+    ///
+    /// @param lookup Function performing the lookup.
+    /// @param handler Callback invoked when the lookup completes.
+    void queueAsyncQuery(const boost::function<Lease4Ptr (const LeaseMgr&)>&
+                         lookup, const Lease4Handler& handler);
+
+    /// @brief Main function of the worker thread.
+    void asyncWorker();
+
+    /// @brief Stops the worker thread.
+    void stopAsyncWorker();
+
+    /// @brief Worker thread executing asynchronous lookups.
+    boost::scoped_ptr<util::thread::Thread> async_thread_;
+
+    /// @brief Watch socket used by the worker to signal completed lookups.
+    boost::scoped_ptr<util::WatchSocket> async_watch_;
+
+    /// @brief Mutex protecting the queues and the watch socket.
+    util::thread::Mutex async_mutex_;
+
+    /// @brief Condition variable signalled when a lookup is queued.
+    util::thread::CondVar async_cond_;
+
+    /// @brief Lookups waiting for the worker thread.
+    std::list<AsyncQueryPtr> async_pending_;
+
+    /// @brief Lookups completed by the worker thread.
+    std::list<AsyncQueryPtr> async_completed_;
+
+    /// @brief Number of lookups whose handlers haven't been invoked.
+    size_t async_outstanding_;
+
+    /// @brief Indicates that the worker thread should terminate.
+    bool async_stop_;
+};
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
@@ -56,6 +56,8 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
     int64_t lfc_interval = 0;
     int64_t timeout = 0;
     int64_t port = 0;
+    int64_t cache_size = 0;
+    int64_t pool_size = 1;
     // 2. Update the copy with the passed keywords.
     BOOST_FOREACH(ConfigPair param, database_config->mapValue()) {
         try {
@@ -78,6 +80,16 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
                 values_copy[param.first] =
                     boost::lexical_cast<std::string>(port);
 
+            } else if (param.first == "cache-size") {
+                cache_size = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(cache_size);
+
+            } else if (param.first == "connection-pool-size") {
+                pool_size = param.second->intValue();
+                values_copy[param.first] =
+                    boost::lexical_cast<std::string>(pool_size);
+
             } else {
                 values_copy[param.first] = param.second->stringValue();
             }
@@ -144,6 +156,26 @@ DbAccessParser::parse(CfgDbAccessPtr& cfg_db,
                   << " (" << value->getPosition() << ")");
     }
 
+    // f. Check that the cache size is within a reasonable range.
+    if ((cache_size < 0) ||
+        (cache_size > std::numeric_limits<uint32_t>::max())) {
+        ConstElementPtr value = database_config->get("cache-size");
+        isc_throw(DhcpConfigError, "cache-size value: " << cache_size
+                  << " is out of range, expected value: 0.."
+                  << std::numeric_limits<uint32_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
+    // g. Check that the connection pool size is within a reasonable range.
+    if ((pool_size < 1) ||
+        (pool_size > std::numeric_limits<uint16_t>::max())) {
+        ConstElementPtr value = database_config->get("connection-pool-size");
+        isc_throw(DhcpConfigError, "connection-pool-size value: " << pool_size
+                  << " is out of range, expected value: 1.."
+                  << std::numeric_limits<uint16_t>::max()
+                  << " (" << value->getPosition() << ")");
+    }
+
     // 4. If all is OK, update the stored keyword/value pairs.  We do this by
     // swapping contents - values_copy is destroyed immediately after the
     // operation (when the method exits), so we are not interested in its new
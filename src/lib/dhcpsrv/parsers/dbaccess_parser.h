@@ -58,6 +58,8 @@ public:
     /// - "lfc-interval" is a number from the range of 0 to 4294967295.
     /// - "connect-timeout" is a number from the range of 0 to 4294967295.
     /// - "port" is a number from the range of 0 to 65535.
+    /// - "cache-size" is a number from the range of 0 to 4294967295.
+    /// - "connection-pool-size" is a number from the range of 1 to 65535.
     ///
     /// Once all has been validated, constructs the database access string
     /// expected by the lease manager.
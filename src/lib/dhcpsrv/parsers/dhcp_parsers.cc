@@ -570,7 +570,8 @@ OptionDefParser::parse(ConstElementPtr option_def) {
 
 // ******************************** OptionDefListParser ************************
 void
-OptionDefListParser::parse(CfgOptionDefPtr storage, ConstElementPtr option_def_list) {
+OptionDefListParser::parse(CfgOptionDefPtr storage, ConstElementPtr option_def_list,
+                           bool runtime_defs) {
     if (!option_def_list) {
         isc_throw(DhcpConfigError, "parser error: a pointer to a list of"
                   << " option definitions is NULL ("
@@ -593,7 +594,9 @@ OptionDefListParser::parse(CfgOptionDefPtr storage, ConstElementPtr option_def_l
 
     // All definitions have been prepared. Put them as runtime options into
     // the libdhcp++.
-    LibDHCP::setRuntimeOptionDefs(storage->getContainer());
+    if (runtime_defs) {
+        LibDHCP::setRuntimeOptionDefs(storage->getContainer());
+    }
 }
 
 //****************************** RelayInfoParser ********************************
@@ -527,7 +527,10 @@ public:
     ///
     /// @param def_list JSON list describing option definitions
     /// @param cfg parsed option definitions will be stored here
-    void parse(CfgOptionDefPtr cfg, isc::data::ConstElementPtr def_list);
+    /// @param runtime_defs whether the parsed option definitions are also
+    /// set as runtime option definitions in the libdhcp++.
+    void parse(CfgOptionDefPtr cfg, isc::data::ConstElementPtr def_list,
+               bool runtime_defs = true);
 };
 
 /// @brief a collection of pools
@@ -54,6 +54,11 @@ ExpirationConfigParser::parse(ConstElementPtr expiration_config) {
             cfg->setUnwarnedReclaimCycles(
                 getInteger(expiration_config, param));
         }
+
+        param = "reuse-quarantine-time";
+        if (expiration_config->contains(param)) {
+            cfg->setReuseQuarantineTime(getInteger(expiration_config, param));
+        }
     } catch (const DhcpConfigError&) {
         throw;
     } catch (const std::exception& ex) {
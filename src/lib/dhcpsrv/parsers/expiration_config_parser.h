@@ -27,7 +27,8 @@ namespace dhcp {
 /// - hold-reclaimed-time,
 /// - max-reclaim-leases,
 /// - max-reclaim-time,
-/// - unwarned-reclaim-cycles.
+/// - unwarned-reclaim-cycles,
+/// - reuse-quarantine-time.
 ///
 /// These parameters are optional and the default values are used for
 /// those that aren't specified.
@@ -280,6 +280,15 @@ PgSqlConnection::compareError(const PgSqlResult& r, const char* error_state) {
             (memcmp(sqlstate, error_state, PGSQL_STATECODE_LEN) == 0));
 }
 
+bool
+PgSqlConnection::ping() {
+    if (!conn_ || (PQstatus(conn_) != CONNECTION_OK)) {
+        return (false);
+    }
+    PgSqlResult r(PQexec(conn_, ""));
+    return (PQresultStatus(r) == PGRES_EMPTY_QUERY);
+}
+
 void
 PgSqlConnection::checkStatementError(const PgSqlResult& r,
                                      PgSqlTaggedStatement& statement) const {
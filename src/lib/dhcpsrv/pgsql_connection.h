@@ -362,6 +362,14 @@ public:
     /// @throw DbOperationError If the rollback failed.
     void rollback();
 
+    /// @brief Checks if the connection to the database is usable.
+    ///
+    /// Sends an empty query to the server to detect a connection which
+    /// has been broken since the last operation.
+    ///
+    /// @return true if the connection is alive, false otherwise.
+    bool ping();
+
     /// @brief Checks a result set's SQL state against an error state.
     ///
     /// @param r result set to check
@@ -21,6 +21,7 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/classification.hpp>
 #include <boost/array.hpp>
+#include <boost/bind.hpp>
 #include <boost/pointer_cast.hpp>
 #include <boost/static_assert.hpp>
 
@@ -1767,45 +1768,71 @@ PgSqlHostDataSourceImpl::checkReadOnly() const {
 /*********** PgSqlHostDataSource *********************/
 
 
+namespace {
+
+/// @brief Creates the implementation of the data source for the pool.
+///
+/// @param parameters Parameters used to open the connection.
+DbConnectionPool<PgSqlHostDataSourceImpl>::ConnectionPtr
+createImpl(const PgSqlConnection::ParameterMap& parameters) {
+    return (DbConnectionPool<PgSqlHostDataSourceImpl>::
+            ConnectionPtr(new PgSqlHostDataSourceImpl(parameters)));
+}
+
+/// @brief Checks if the pooled connection is usable.
+///
+/// @param impl Pooled implementation of the data source.
+bool
+checkImpl(PgSqlHostDataSourceImpl& impl) {
+    return (impl.conn_.ping());
+}
+
+} // end of anonymous namespace
+
 PgSqlHostDataSource::
 PgSqlHostDataSource(const PgSqlConnection::ParameterMap& parameters)
-    : impl_(new PgSqlHostDataSourceImpl(parameters)) {
+    : pool_(new ImplPool(boost::bind(&createImpl, parameters), &checkImpl,
+                         DatabaseConnection(parameters).configuredPoolSize())) {
+    // Open the first connection right away, so as the errors in the
+    // database parameters are reported when the data source is created.
+    ImplPool::Handle impl(*pool_);
 }
 
 PgSqlHostDataSource::~PgSqlHostDataSource() {
-    delete impl_;
 }
 
 void
 PgSqlHostDataSource::add(const HostPtr& host) {
+    ImplPool::Handle impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
+    impl->checkReadOnly();
 
     // Initiate PostgreSQL transaction as we will have to make multiple queries
     // to insert host information into multiple tables. If that fails on
     // any stage, the transaction will be rolled back by the destructor of
     // the PgSqlTransaction class.
-    PgSqlTransaction transaction(impl_->conn_);
+    PgSqlTransaction transaction(impl->conn_);
 
     // Create the MYSQL_BIND array for the host
-    PsqlBindArrayPtr bind_array = impl_->host_exchange_->createBindForSend(host);
+    PsqlBindArrayPtr bind_array = impl->host_exchange_->createBindForSend(host);
 
     // ... and insert the host.
-    uint32_t host_id = impl_->addStatement(PgSqlHostDataSourceImpl::INSERT_HOST,
-                                           bind_array, true);
+    uint32_t host_id = impl->addStatement(PgSqlHostDataSourceImpl::INSERT_HOST,
+                                          bind_array, true);
 
     // Insert DHCPv4 options.
     ConstCfgOptionPtr cfg_option4 = host->getCfgOption4();
     if (cfg_option4) {
-        impl_->addOptions(PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
-                          cfg_option4, host_id);
+        impl->addOptions(PgSqlHostDataSourceImpl::INSERT_V4_HOST_OPTION,
+                         cfg_option4, host_id);
     }
 
     // Insert DHCPv6 options.
     ConstCfgOptionPtr cfg_option6 = host->getCfgOption6();
     if (cfg_option6) {
-        impl_->addOptions(PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
-                          cfg_option6, host_id);
+        impl->addOptions(PgSqlHostDataSourceImpl::INSERT_V6_HOST_OPTION,
+                         cfg_option6, host_id);
     }
 
     // Insert IPv6 reservations.
@@ -1813,7 +1840,7 @@ PgSqlHostDataSource::add(const HostPtr& host) {
     if (std::distance(v6resv.first, v6resv.second) > 0) {
         for (IPv6ResrvIterator resv = v6resv.first; resv != v6resv.second;
              ++resv) {
-            impl_->addResv(resv->second, host_id);
+            impl->addResv(resv->second, host_id);
         }
     }
 
@@ -1842,6 +1869,8 @@ ConstHostCollection
 PgSqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
                             const uint8_t* identifier_begin,
                             const size_t identifier_len) const {
+    ImplPool::Handle impl(*pool_);
+
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -1852,15 +1881,17 @@ PgSqlHostDataSource::getAll(const Host::IdentifierType& identifier_type,
     bind_array->add(static_cast<uint8_t>(identifier_type));
 
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_DHCPID,
-                             bind_array, impl_->host_ipv46_exchange_,
-                             result, false);
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_DHCPID,
+                            bind_array, impl->host_ipv46_exchange_,
+                            result, false);
     return (result);
 }
 
 ConstHostCollection
 PgSqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
 
+    ImplPool::Handle impl(*pool_);
+
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -1868,8 +1899,8 @@ PgSqlHostDataSource::getAll4(const asiolink::IOAddress& address) const {
     bind_array->add(address);
 
     ConstHostCollection result;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_ADDR, bind_array,
-                             impl_->host_exchange_, result, false);
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_ADDR, bind_array,
+                            impl->host_exchange_, result, false);
 
     return (result);
 }
@@ -1907,10 +1938,12 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
-                           identifier_len,
-                           PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
-                           impl_->host_exchange_));
+    ImplPool::Handle impl(*pool_);
+
+    return (impl->getHost(subnet_id, identifier_type, identifier_begin,
+                          identifier_len,
+                          PgSqlHostDataSourceImpl::GET_HOST_SUBID4_DHCPID,
+                          impl->host_exchange_));
 }
 
 ConstHostPtr
@@ -1921,6 +1954,8 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
                   " wrong address type, address supplied is an IPv6 address");
     }
 
+    ImplPool::Handle impl(*pool_);
+
     // Set up the WHERE clause value
     PsqlBindArrayPtr bind_array(new PsqlBindArray());
 
@@ -1931,9 +1966,9 @@ PgSqlHostDataSource::get4(const SubnetID& subnet_id,
     bind_array->add(address);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
-                             bind_array, impl_->host_exchange_, collection,
-                             true);
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID_ADDR,
+                            bind_array, impl->host_exchange_, collection,
+                            true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -1975,14 +2010,18 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
                           const uint8_t* identifier_begin,
                           const size_t identifier_len) const {
 
-    return (impl_->getHost(subnet_id, identifier_type, identifier_begin,
+    ImplPool::Handle impl(*pool_);
+
+    return (impl->getHost(subnet_id, identifier_type, identifier_begin,
                    identifier_len, PgSqlHostDataSourceImpl::GET_HOST_SUBID6_DHCPID,
-                   impl_->host_ipv6_exchange_));
+                   impl->host_ipv6_exchange_));
 }
 
 ConstHostPtr
 PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
                           const uint8_t prefix_len) const {
+    ImplPool::Handle impl(*pool_);
+
     /// @todo: Check that prefix is v6 address, not v4.
 
     // Set up the WHERE clause value
@@ -1995,9 +2034,9 @@ PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
     bind_array->add(prefix_len);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_PREFIX,
-                             bind_array, impl_->host_ipv6_exchange_,
-                             collection, true);
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_PREFIX,
+                            bind_array, impl->host_ipv6_exchange_,
+                            collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2011,6 +2050,8 @@ PgSqlHostDataSource::get6(const asiolink::IOAddress& prefix,
 ConstHostPtr
 PgSqlHostDataSource::get6(const SubnetID& subnet_id,
                           const asiolink::IOAddress& address) const {
+    ImplPool::Handle impl(*pool_);
+
     /// @todo: Check that prefix is v6 address, not v4.
 
     // Set up the WHERE clause value
@@ -2023,9 +2064,9 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
     bind_array->add(address);
 
     ConstHostCollection collection;
-    impl_->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
-                             bind_array, impl_->host_ipv6_exchange_,
-                             collection, true);
+    impl->getHostCollection(PgSqlHostDataSourceImpl::GET_HOST_SUBID6_ADDR,
+                            bind_array, impl->host_ipv6_exchange_,
+                            collection, true);
 
     // Return single record if present, else clear the host.
     ConstHostPtr result;
@@ -2039,9 +2080,11 @@ PgSqlHostDataSource::get6(const SubnetID& subnet_id,
 // Miscellaneous database methods.
 
 std::string PgSqlHostDataSource::getName() const {
+    ImplPool::Handle impl(*pool_);
+
     std::string name = "";
     try {
-        name = impl_->conn_.getParameter("name");
+        name = impl->conn_.getParameter("name");
     } catch (...) {
         // Return an empty name
     }
@@ -2054,22 +2097,32 @@ std::string PgSqlHostDataSource::getDescription() const {
 }
 
 std::pair<uint32_t, uint32_t> PgSqlHostDataSource::getVersion() const {
-    return(impl_->getVersion());
+    ImplPool::Handle impl(*pool_);
+
+    return(impl->getVersion());
 }
 
 void
 PgSqlHostDataSource::commit() {
+    ImplPool::Handle impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
-    impl_->conn_.commit();
+    impl->checkReadOnly();
+
+    // The connection checked out here is not necessarily the one used by
+    // the previous calls, so there is nothing to commit. The hosts are
+    // added within their own transactions.
 }
 
 
 void
 PgSqlHostDataSource::rollback() {
+    ImplPool::Handle impl(*pool_);
+
     // If operating in read-only mode, throw exception.
-    impl_->checkReadOnly();
-    impl_->conn_.rollback();
+    impl->checkReadOnly();
+
+    // There is nothing to roll back for the same reason as in commit().
 }
 
 }; // end of isc::dhcp namespace
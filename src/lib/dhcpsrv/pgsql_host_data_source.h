@@ -8,9 +8,12 @@
 #define PGSQL_HOST_DATA_SOURCE_H
 
 #include <dhcpsrv/base_host_data_source.h>
+#include <dhcpsrv/db_connection_pool.h>
 #include <dhcpsrv/pgsql_connection.h>
 #include <dhcpsrv/pgsql_exchange.h>
 
+#include <boost/scoped_ptr.hpp>
+
 namespace isc {
 namespace dhcp {
 
@@ -50,6 +53,10 @@ public:
     ///
     /// Finally, all the SQL commands are pre-compiled.
     ///
+    /// The queries are executed using a pool of connections. The maximum
+    /// number of connections is specified with the "connection-pool-size"
+    /// keyword and defaults to 1.
+    ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
     ///
@@ -57,11 +64,12 @@ public:
     /// @throw isc::dhcp::DbOpenError Error opening the database
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
+    /// @throw isc::dhcp::DbInvalidPoolSize Invalid connection pool size.
     PgSqlHostDataSource(const DatabaseConnection::ParameterMap& parameters);
 
     /// @brief Virtual destructor.
     /// Frees database resources and closes the database connection through
-    /// the destruction of member impl_.
+    /// the destruction of the pooled implementations.
     virtual ~PgSqlHostDataSource();
 
     /// @brief Return all hosts for the specified HW address or DUID.
@@ -285,18 +293,30 @@ public:
 
     /// @brief Commit Transactions
     ///
-    /// Commits all pending database operations.
+    /// Each call is executed using a connection checked out from the pool,
+    /// so there is no transaction spanning multiple calls and this method
+    /// only checks that the backend is not read-only. The connections run
+    /// in the autocommit mode and the hosts are added within their own
+    /// transactions.
     virtual void commit();
 
     /// @brief Rollback Transactions
     ///
-    /// Rolls back all pending database operations.
+    /// Only checks that the backend is not read-only, see @c commit.
     virtual void rollback();
 
 private:
 
-    /// @brief Pointer to the implementation of the @ref PgSqlHostDataSource.
-    PgSqlHostDataSourceImpl* impl_;
+    /// @brief Pool of the implementations of the @ref PgSqlHostDataSource.
+    typedef DbConnectionPool<PgSqlHostDataSourceImpl> ImplPool;
+
+    /// @brief Implementations of the @ref PgSqlHostDataSource checked out
+    /// by the methods issuing the queries.
+    ///
+    /// Each of them owns a separate connection to the database with its
+    /// own prepared statements. A connection lost between the queries is
+    /// replaced with a new one.
+    boost::scoped_ptr<ImplPool> pool_;
 };
 
 }
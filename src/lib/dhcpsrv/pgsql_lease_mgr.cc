@@ -9,9 +9,11 @@
 #include <asiolink/io_address.h>
 #include <dhcp/duid.h>
 #include <dhcp/hwaddr.h>
+#include <dhcp/iface_mgr.h>
 #include <dhcpsrv/dhcpsrv_log.h>
 #include <dhcpsrv/pgsql_lease_mgr.h>
 
+#include <boost/bind.hpp>
 #include <boost/static_assert.hpp>
 
 #include <iomanip>
@@ -38,6 +40,11 @@ PgSqlTaggedStatement tagged_statements[] = {
       "delete_lease4",
       "DELETE FROM lease4 WHERE address = $1"},
 
+    // DELETE_LEASE4_ADDRS
+    { 1, { OID_TEXT },
+      "delete_lease4_addrs",
+      "DELETE FROM lease4 WHERE address = ANY(CAST($1 AS BIGINT[]))"},
+
     // DELETE_LEASE4_STATE_EXPIRED
     { 2, { OID_INT8, OID_TIMESTAMP },
       "delete_lease4_state_expired",
@@ -108,9 +115,43 @@ PgSqlTaggedStatement tagged_statements[] = {
           "fqdn_fwd, fqdn_rev, hostname, state "
               "FROM lease4 "
               "WHERE state != $1 AND expire < $2 "
-              "ORDER BY expire "
+              "ORDER BY expire, address "
+              "LIMIT $3"},
+
+    // GET_LEASE4_EXPIRE_NEXT
+    { 5, { OID_INT8, OID_TIMESTAMP, OID_TIMESTAMP, OID_INT8, OID_INT8 },
+      "get_lease4_expire_next",
+      "SELECT address, hwaddr, client_id, "
+          "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+          "fqdn_fwd, fqdn_rev, hostname, state "
+              "FROM lease4 "
+              "WHERE state != $1 AND expire < $2 "
+              "AND (expire > $3 OR (expire = $3 AND address > $4)) "
+              "ORDER BY expire, address "
+              "LIMIT $5"},
+
+    // GET_LEASE4_PAGE
+    { 3, { OID_INT8, OID_INT8, OID_INT8 },
+      "get_lease4_page",
+      "SELECT address, hwaddr, client_id, "
+          "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+          "fqdn_fwd, fqdn_rev, hostname, state "
+              "FROM lease4 "
+              "WHERE address > $1 AND address <= $2 "
+              "ORDER BY address "
               "LIMIT $3"},
 
+    // GET_LEASE4_PAGE_SUBID
+    { 4, { OID_INT8, OID_INT8, OID_INT8, OID_INT8 },
+      "get_lease4_page_subid",
+      "SELECT address, hwaddr, client_id, "
+          "valid_lifetime, extract(epoch from expire)::bigint, subnet_id, "
+          "fqdn_fwd, fqdn_rev, hostname, state "
+              "FROM lease4 "
+              "WHERE address > $1 AND address <= $2 AND subnet_id = $3 "
+              "ORDER BY address "
+              "LIMIT $4"},
+
     // GET_LEASE6_ADDR
     { 2, { OID_VARCHAR, OID_INT2 },
       "get_lease6_addr",
@@ -152,7 +193,44 @@ PgSqlTaggedStatement tagged_statements[] = {
           "state "
               "FROM lease6 "
               "WHERE state != $1 AND expire < $2 "
-              "ORDER BY expire "
+              "ORDER BY expire, address "
+              "LIMIT $3"},
+
+    // GET_LEASE6_EXPIRE_NEXT
+    { 5, { OID_INT8, OID_TIMESTAMP, OID_TIMESTAMP, OID_VARCHAR, OID_INT8 },
+      "get_lease6_expire_next",
+      "SELECT address, duid, valid_lifetime, "
+          "extract(epoch from expire)::bigint, subnet_id, pref_lifetime, "
+          "lease_type, iaid, prefix_len, "
+          "fqdn_fwd, fqdn_rev, hostname, state "
+              "FROM lease6 "
+              "WHERE state != $1 AND expire < $2 "
+              "AND (expire > $3 OR (expire = $3 AND address > $4)) "
+              "ORDER BY expire, address "
+              "LIMIT $5"},
+
+    // GET_LEASE6_PAGE
+    { 2, { OID_VARCHAR, OID_INT8 },
+      "get_lease6_page",
+      "SELECT address, duid, valid_lifetime, "
+          "extract(epoch from expire)::bigint, subnet_id, pref_lifetime, "
+          "lease_type, iaid, prefix_len, "
+          "fqdn_fwd, fqdn_rev, hostname, state "
+              "FROM lease6 "
+              "WHERE address > $1 "
+              "ORDER BY address "
+              "LIMIT $2"},
+
+    // GET_LEASE6_PAGE_SUBID
+    { 3, { OID_VARCHAR, OID_INT8, OID_INT8 },
+      "get_lease6_page_subid",
+      "SELECT address, duid, valid_lifetime, "
+          "extract(epoch from expire)::bigint, subnet_id, pref_lifetime, "
+          "lease_type, iaid, prefix_len, "
+          "fqdn_fwd, fqdn_rev, hostname, state "
+              "FROM lease6 "
+              "WHERE address > $1 AND subnet_id = $2 "
+              "ORDER BY address "
               "LIMIT $3"},
 
     // GET_VERSION
@@ -803,7 +881,7 @@ protected:
     bool fetch_type_;
 };
 
-PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
+PgSqlLeaseMgrImpl::PgSqlLeaseMgrImpl(const DatabaseConnection::ParameterMap& parameters)
     : LeaseMgr(), exchange4_(new PgSqlLease4Exchange()),
     exchange6_(new PgSqlLease6Exchange()), conn_(parameters) {
     conn_.openDatabase();
@@ -829,7 +907,31 @@ PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
     }
 }
 
+PgSqlLeaseMgrImpl::~PgSqlLeaseMgrImpl() {
+}
+
+PgSqlLeaseMgr::PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters)
+    : PooledLeaseMgr(parameters,
+                     boost::bind(&PgSqlLeaseMgr::createPooledMgr, parameters),
+                     &PgSqlLeaseMgr::checkPooledMgr),
+      exchange4_(new PgSqlLease4Exchange()), async_conn_(), async_queries_(),
+      async_flush_pending_(false) {
+}
+
 PgSqlLeaseMgr::~PgSqlLeaseMgr() {
+    if (async_conn_) {
+        IfaceMgr::instance().deleteExternalSocket(PQsocket(async_conn_->conn_));
+    }
+}
+
+PgSqlLeaseMgr::LeasePool::ConnectionPtr
+PgSqlLeaseMgr::createPooledMgr(const DatabaseConnection::ParameterMap& parameters) {
+    return (LeasePool::ConnectionPtr(new PgSqlLeaseMgrImpl(parameters)));
+}
+
+bool
+PgSqlLeaseMgr::checkPooledMgr(LeaseMgr& mgr) {
+    return (static_cast<PgSqlLeaseMgrImpl&>(mgr).ping());
 }
 
 std::string
@@ -842,8 +944,8 @@ PgSqlLeaseMgr::getDBVersion() {
 }
 
 bool
-PgSqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
-                              PsqlBindArray& bind_array) {
+PgSqlLeaseMgrImpl::addLeaseCommon(StatementIndex stindex,
+                                  PsqlBindArray& bind_array) {
     PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
@@ -867,7 +969,7 @@ PgSqlLeaseMgr::addLeaseCommon(StatementIndex stindex,
 }
 
 bool
-PgSqlLeaseMgr::addLease(const Lease4Ptr& lease) {
+PgSqlLeaseMgrImpl::addLease(const Lease4Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR4).arg(lease->addr_.toText());
 
@@ -877,7 +979,7 @@ PgSqlLeaseMgr::addLease(const Lease4Ptr& lease) {
 }
 
 bool
-PgSqlLeaseMgr::addLease(const Lease6Ptr& lease) {
+PgSqlLeaseMgrImpl::addLease(const Lease6Ptr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR6).arg(lease->addr_.toText());
     PsqlBindArray bind_array;
@@ -887,11 +989,11 @@ PgSqlLeaseMgr::addLease(const Lease6Ptr& lease) {
 }
 
 template <typename Exchange, typename LeaseCollection>
-void PgSqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
-                                       PsqlBindArray& bind_array,
-                                       Exchange& exchange,
-                                       LeaseCollection& result,
-                                       bool single) const {
+void PgSqlLeaseMgrImpl::getLeaseCollection(StatementIndex stindex,
+                                           PsqlBindArray& bind_array,
+                                           Exchange& exchange,
+                                           LeaseCollection& result,
+                                           bool single) const {
     PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
@@ -914,7 +1016,7 @@ void PgSqlLeaseMgr::getLeaseCollection(StatementIndex stindex,
 
 
 void
-PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
+PgSqlLeaseMgrImpl::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
                              Lease4Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
@@ -934,7 +1036,7 @@ PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
 
 
 void
-PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
+PgSqlLeaseMgrImpl::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
                              Lease6Ptr& result) const {
     // Create appropriate collection object and get all leases matching
     // the selection criteria.  The "single" parameter is true to indicate
@@ -953,7 +1055,7 @@ PgSqlLeaseMgr::getLease(StatementIndex stindex, PsqlBindArray& bind_array,
 }
 
 Lease4Ptr
-PgSqlLeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
+PgSqlLeaseMgrImpl::getLease4(const isc::asiolink::IOAddress& addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_ADDR4).arg(addr.toText());
 
@@ -972,8 +1074,242 @@ PgSqlLeaseMgr::getLease4(const isc::asiolink::IOAddress& addr) const {
     return (result);
 }
 
+void
+PgSqlLeaseMgr::asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                              const Lease4Handler& handler) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_GET_ADDR4).arg(addr.toText());
+
+    AsyncQueryPtr query(new AsyncQuery(PgSqlLeaseMgrImpl::GET_LEASE4_ADDR, handler));
+
+    // LEASE ADDRESS
+    query->bind_array_.addTempString(boost::lexical_cast<std::string>
+                                     (addr.toUint32()));
+
+    queueAsyncQuery(query);
+}
+
+void
+PgSqlLeaseMgr::asyncGetLease4(const HWAddr& hwaddr, SubnetID subnet_id,
+                              const Lease4Handler& handler) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_GET_SUBID_HWADDR)
+              .arg(subnet_id).arg(hwaddr.toText());
+
+    AsyncQueryPtr query(new AsyncQuery(PgSqlLeaseMgrImpl::GET_LEASE4_HWADDR_SUBID, handler));
+
+    // HWADDR
+    query->data_ = hwaddr.hwaddr_;
+    if (!query->data_.empty()) {
+        query->bind_array_.add(query->data_);
+    } else {
+        query->bind_array_.add("");
+    }
+
+    // SUBNET_ID
+    query->bind_array_.addTempString(boost::lexical_cast<std::string>
+                                     (subnet_id));
+
+    queueAsyncQuery(query);
+}
+
+void
+PgSqlLeaseMgr::asyncGetLease4(const ClientId& clientid, SubnetID subnet_id,
+                              const Lease4Handler& handler) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_GET_SUBID_CLIENTID)
+              .arg(subnet_id).arg(clientid.toText());
+
+    AsyncQueryPtr query(new AsyncQuery(PgSqlLeaseMgrImpl::GET_LEASE4_CLIENTID_SUBID, handler));
+
+    // CLIENT_ID
+    query->data_ = clientid.getClientId();
+    query->bind_array_.add(query->data_);
+
+    // SUBNET_ID
+    query->bind_array_.addTempString(boost::lexical_cast<std::string>
+                                     (subnet_id));
+
+    queueAsyncQuery(query);
+}
+
+void
+PgSqlLeaseMgr::openAsyncConnection() {
+    if (async_conn_) {
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_ASYNC_DB);
+
+    boost::scoped_ptr<PgSqlConnection> conn(new PgSqlConnection(parameters_));
+    conn->openDatabase();
+    for (int i = 0; tagged_statements[i].text != NULL; ++i) {
+        conn->prepareStatement(tagged_statements[i]);
+    }
+
+    // Statements have been prepared in the blocking mode. From now on
+    // the queries are sent without waiting for the database.
+    if (PQsetnonblocking(conn->conn_, 1) != 0) {
+        isc_throw(DbOpenError, "unable to set non-blocking mode for the"
+                  " asynchronous connection: " << PQerrorMessage(conn->conn_));
+    }
+
+    async_conn_.swap(conn);
+    async_flush_pending_ = false;
+    IfaceMgr::instance().addExternalSocket(PQsocket(async_conn_->conn_),
+                                           boost::bind(&PgSqlLeaseMgr::
+                                                       processAsyncResults,
+                                                       this));
+}
+
+void
+PgSqlLeaseMgr::queueAsyncQuery(const AsyncQueryPtr& query) {
+    try {
+        openAsyncConnection();
+
+    } catch (const std::exception& ex) {
+        query->handler_(Lease4Ptr(), ex.what());
+        return;
+    }
+
+    async_queries_.push_back(query);
+    sendAsyncQuery();
+}
+
+void
+PgSqlLeaseMgr::sendAsyncQuery() {
+    while (async_conn_ && !async_queries_.empty()) {
+        AsyncQueryPtr query = async_queries_.front();
+        // Only one query at the time may be in progress on a connection.
+        if (query->sent_) {
+            return;
+        }
+
+        PgSqlTaggedStatement& statement = tagged_statements[query->stindex_];
+        if (PQsendQueryPrepared(async_conn_->conn_, statement.name,
+                                statement.nbparams,
+                                &query->bind_array_.values_[0],
+                                &query->bind_array_.lengths_[0],
+                                &query->bind_array_.formats_[0], 0) != 0) {
+            query->sent_ = true;
+            // If the query couldn't be sent entirely, the remaining part
+            // is sent when the socket becomes writable.
+            flushAsyncConnection();
+            return;
+        }
+
+        // The query couldn't be sent. Report an error and try the next one.
+        async_queries_.pop_front();
+        query->handler_(Lease4Ptr(), PQerrorMessage(async_conn_->conn_));
+    }
+}
+
+void
+PgSqlLeaseMgr::processAsyncResults() {
+    if (!async_conn_) {
+        return;
+    }
+
+    PGconn* pgconn = async_conn_->conn_;
+    if (PQconsumeInput(pgconn) == 0) {
+        failAsyncQueries(PQerrorMessage(pgconn));
+        return;
+    }
+
+    // The server may need to read the data sent by the database before
+    // it accepts more, so try sending the rest of the query again.
+    if (async_flush_pending_) {
+        flushAsyncConnection();
+        if (!async_conn_) {
+            return;
+        }
+    }
+
+    while (!async_queries_.empty() && async_queries_.front()->sent_) {
+        // Don't block waiting for the rest of the result.
+        if (PQisBusy(pgconn)) {
+            return;
+        }
+
+        AsyncQueryPtr query = async_queries_.front();
+        PGresult* result = PQgetResult(pgconn);
+        if (result) {
+            PgSqlResult r(result);
+            if (PQresultStatus(r) != PGRES_TUPLES_OK) {
+                query->error_ = PQresultErrorMessage(r);
+
+            } else if (r.getRows() > 1) {
+                query->error_ = std::string("multiple records were found in"
+                                            " the database where only one was"
+                                            " expected for query ") +
+                    tagged_statements[query->stindex_].name;
+
+            } else if (r.getRows() == 1) {
+                try {
+                    query->lease_ = exchange4_->convertFromDatabase(r, 0);
+                } catch (const std::exception& ex) {
+                    query->error_ = ex.what();
+                }
+            }
+            continue;
+        }
+
+        // Null result indicates that the query is complete. Send the next
+        // one before invoking the handler, because the handler may queue
+        // new queries.
+        async_queries_.pop_front();
+        sendAsyncQuery();
+        query->handler_(query->error_.empty() ? query->lease_ : Lease4Ptr(),
+                        query->error_);
+    }
+}
+
+void
+PgSqlLeaseMgr::flushAsyncConnection() {
+    if (!async_conn_) {
+        return;
+    }
+
+    int socketfd = PQsocket(async_conn_->conn_);
+    int status = PQflush(async_conn_->conn_);
+    if (status < 0) {
+        failAsyncQueries(PQerrorMessage(async_conn_->conn_));
+        return;
+    }
+
+    // PQflush returns 1 when the data couldn't be sent entirely. Continue
+    // when the socket is ready for writing rather than waiting for the
+    // database to send anything back.
+    bool flush_pending = (status > 0);
+    if (flush_pending != async_flush_pending_) {
+        IfaceMgr::instance().setExternalSocketWriteCallback(socketfd,
+            flush_pending ?
+            boost::bind(&PgSqlLeaseMgr::flushAsyncConnection, this) :
+            IfaceMgr::SocketCallback());
+        async_flush_pending_ = flush_pending;
+    }
+}
+
+void
+PgSqlLeaseMgr::failAsyncQueries(const std::string& error) {
+    LOG_ERROR(dhcpsrv_logger, DHCPSRV_PGSQL_ASYNC_ERROR).arg(error);
+
+    // The connection is unusable. It is re-opened upon the next
+    // asynchronous lookup.
+    IfaceMgr::instance().deleteExternalSocket(PQsocket(async_conn_->conn_));
+    async_conn_.reset();
+
+    std::list<AsyncQueryPtr> queries;
+    queries.swap(async_queries_);
+    for (std::list<AsyncQueryPtr>::const_iterator query = queries.begin();
+         query != queries.end(); ++query) {
+        (*query)->handler_(Lease4Ptr(), error);
+    }
+}
+
 Lease4Collection
-PgSqlLeaseMgr::getLease4(const HWAddr& hwaddr) const {
+PgSqlLeaseMgrImpl::getLease4(const HWAddr& hwaddr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_HWADDR).arg(hwaddr.toText());
 
@@ -995,7 +1331,7 @@ PgSqlLeaseMgr::getLease4(const HWAddr& hwaddr) const {
 }
 
 Lease4Ptr
-PgSqlLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
+PgSqlLeaseMgrImpl::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_SUBID_HWADDR)
               .arg(subnet_id).arg(hwaddr.toText());
@@ -1022,7 +1358,7 @@ PgSqlLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
 }
 
 Lease4Collection
-PgSqlLeaseMgr::getLease4(const ClientId& clientid) const {
+PgSqlLeaseMgrImpl::getLease4(const ClientId& clientid) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_CLIENTID).arg(clientid.toText());
 
@@ -1040,7 +1376,7 @@ PgSqlLeaseMgr::getLease4(const ClientId& clientid) const {
 }
 
 Lease4Ptr
-PgSqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
+PgSqlLeaseMgrImpl::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_SUBID_CLIENTID)
               .arg(subnet_id).arg(clientid.toText());
@@ -1063,18 +1399,18 @@ PgSqlLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
 }
 
 Lease4Ptr
-PgSqlLeaseMgr::getLease4(const ClientId&, const HWAddr&, SubnetID) const {
+PgSqlLeaseMgrImpl::getLease4(const ClientId&, const HWAddr&, SubnetID) const {
     /// This function is currently not implemented because allocation engine
     /// searches for the lease using HW address or client identifier.
     /// It never uses both parameters in the same time. We need to
     /// consider if this function is needed at all.
-    isc_throw(NotImplemented, "The PgSqlLeaseMgr::getLease4 function was"
+    isc_throw(NotImplemented, "The PgSqlLeaseMgrImpl::getLease4 function was"
               " called, but it is not implemented");
 }
 
 Lease6Ptr
-PgSqlLeaseMgr::getLease6(Lease::Type lease_type,
-                         const isc::asiolink::IOAddress& addr) const {
+PgSqlLeaseMgrImpl::getLease6(Lease::Type lease_type,
+                             const isc::asiolink::IOAddress& addr) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_ADDR6)
               .arg(addr.toText()).arg(lease_type);
 
@@ -1097,8 +1433,8 @@ PgSqlLeaseMgr::getLease6(Lease::Type lease_type,
 }
 
 Lease6Collection
-PgSqlLeaseMgr::getLeases6(Lease::Type lease_type, const DUID& duid,
-                          uint32_t iaid) const {
+PgSqlLeaseMgrImpl::getLeases6(Lease::Type lease_type, const DUID& duid,
+                              uint32_t iaid) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_IAID_DUID)
               .arg(iaid).arg(duid.toText()).arg(lease_type);
@@ -1125,8 +1461,8 @@ PgSqlLeaseMgr::getLeases6(Lease::Type lease_type, const DUID& duid,
 }
 
 Lease6Collection
-PgSqlLeaseMgr::getLeases6(Lease::Type lease_type, const DUID& duid,
-                          uint32_t iaid, SubnetID subnet_id) const {
+PgSqlLeaseMgrImpl::getLeases6(Lease::Type lease_type, const DUID& duid,
+                              uint32_t iaid, SubnetID subnet_id) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_IAID_SUBID_DUID)
               .arg(iaid).arg(subnet_id).arg(duid.toText()).arg(lease_type);
@@ -1157,24 +1493,133 @@ PgSqlLeaseMgr::getLeases6(Lease::Type lease_type, const DUID& duid,
 }
 
 void
-PgSqlLeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
-                                 const size_t max_leases) const {
+PgSqlLeaseMgrImpl::getExpiredLeases6(Lease6Collection& expired_leases,
+                                     const size_t max_leases) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_EXPIRED6)
         .arg(max_leases);
     getExpiredLeasesCommon(expired_leases, max_leases, GET_LEASE6_EXPIRE);
 }
 
 void
-PgSqlLeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
-                                 const size_t max_leases) const {
+PgSqlLeaseMgrImpl::getExpiredLeases4(Lease4Collection& expired_leases,
+                                     const size_t max_leases) const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_EXPIRED4)
         .arg(max_leases);
     getExpiredLeasesCommon(expired_leases, max_leases, GET_LEASE4_EXPIRE);
 }
 
+void
+PgSqlLeaseMgrImpl::getNextExpiredLeases6(Lease6Collection& expired_leases,
+                                         const size_t max_leases,
+                                         const int64_t last_expire,
+                                         const isc::asiolink::IOAddress& last_address) const {
+    // Start from the first expired lease.
+    if (last_expire == std::numeric_limits<int64_t>::min()) {
+        getExpiredLeases6(expired_leases, max_leases);
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_EXPIRED6)
+        .arg(max_leases);
+    getNextExpiredLeasesCommon(expired_leases, max_leases, last_expire,
+                               last_address.toText(), GET_LEASE6_EXPIRE_NEXT);
+}
+
+void
+PgSqlLeaseMgrImpl::getNextExpiredLeases4(Lease4Collection& expired_leases,
+                                         const size_t max_leases,
+                                         const int64_t last_expire,
+                                         const isc::asiolink::IOAddress& last_address) const {
+    // Start from the first expired lease.
+    if (last_expire == std::numeric_limits<int64_t>::min()) {
+        getExpiredLeases4(expired_leases, max_leases);
+        return;
+    }
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_EXPIRED4)
+        .arg(max_leases);
+    getNextExpiredLeasesCommon(expired_leases, max_leases, last_expire,
+                               boost::lexical_cast<std::string>
+                               (last_address.toUint32()),
+                               GET_LEASE4_EXPIRE_NEXT);
+}
+
+Lease4Collection
+PgSqlLeaseMgrImpl::getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                                  const isc::asiolink::IOAddress& upper_bound_address,
+                                  const SubnetID& subnet_id,
+                                  const size_t page_size) const {
+    checkLeases4PageArgs(lower_bound_address, upper_bound_address, page_size);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_PAGE4)
+        .arg(page_size)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    PsqlBindArray bind_array;
+
+    std::string lower_bound_str = boost::lexical_cast<std::string>
+                                  (lower_bound_address.toUint32());
+    bind_array.add(lower_bound_str);
+
+    std::string upper_bound_str = boost::lexical_cast<std::string>
+                                  (upper_bound_address.toUint32());
+    bind_array.add(upper_bound_str);
+
+    std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
+    if (subnet_id != 0) {
+        bind_array.add(subnet_id_str);
+    }
+
+    std::string limit_str = boost::lexical_cast<std::string>(page_size);
+    bind_array.add(limit_str);
+
+    // Retrieve leases from the database.
+    Lease4Collection result;
+    getLeaseCollection(subnet_id == 0 ? GET_LEASE4_PAGE : GET_LEASE4_PAGE_SUBID,
+                       bind_array, result);
+    return (result);
+}
+
+Lease6Collection
+PgSqlLeaseMgrImpl::getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                                  const SubnetID& subnet_id,
+                                  const size_t page_size) const {
+    checkLeases6PageArgs(lower_bound_address, page_size);
+
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL, DHCPSRV_PGSQL_GET_PAGE6)
+        .arg(page_size)
+        .arg(lower_bound_address.toText())
+        .arg(subnet_id);
+
+    PsqlBindArray bind_array;
+
+    // The addresses are compared as text and "::" does not precede the
+    // other addresses, so the first page starts after an empty string.
+    std::string lower_bound_str;
+    if (!lower_bound_address.isV6Zero()) {
+        lower_bound_str = lower_bound_address.toText();
+    }
+    bind_array.add(lower_bound_str);
+
+    std::string subnet_id_str = boost::lexical_cast<std::string>(subnet_id);
+    if (subnet_id != 0) {
+        bind_array.add(subnet_id_str);
+    }
+
+    std::string limit_str = boost::lexical_cast<std::string>(page_size);
+    bind_array.add(limit_str);
+
+    // Retrieve leases from the database.
+    Lease6Collection result;
+    getLeaseCollection(subnet_id == 0 ? GET_LEASE6_PAGE : GET_LEASE6_PAGE_SUBID,
+                       bind_array, result);
+    return (result);
+}
+
 template<typename LeaseCollection>
 void
-PgSqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
+PgSqlLeaseMgrImpl::getExpiredLeasesCommon(LeaseCollection& expired_leases,
                                        const size_t max_leases,
                                        StatementIndex statement_index) const {
     PsqlBindArray bind_array;
@@ -1198,12 +1643,46 @@ PgSqlLeaseMgr::getExpiredLeasesCommon(LeaseCollection& expired_leases,
     getLeaseCollection(statement_index, bind_array, expired_leases);
 }
 
+template<typename LeaseCollection>
+void
+PgSqlLeaseMgrImpl::getNextExpiredLeasesCommon(LeaseCollection& expired_leases,
+                                           const size_t max_leases,
+                                           const int64_t last_expire,
+                                           const std::string& last_address,
+                                           StatementIndex statement_index) const {
+    PsqlBindArray bind_array;
+
+    // Exclude reclaimed leases.
+    std::string state_str = boost::lexical_cast<std::string>(Lease::STATE_EXPIRED_RECLAIMED);
+    bind_array.add(state_str);
+
+    // Expiration timestamp.
+    std::string timestamp_str = PgSqlLeaseExchange::convertToDatabaseTime(time(NULL));
+    bind_array.add(timestamp_str);
+
+    // Expiration time and address of the last lease returned previously.
+    std::string last_expire_str =
+        PgSqlLeaseExchange::convertToDatabaseTime(static_cast<time_t>(last_expire));
+    bind_array.add(last_expire_str);
+    bind_array.add(last_address);
+
+    // If the number of leases is 0, we will return all leases. This is
+    // achieved by setting the limit to a very high value.
+    uint32_t limit = max_leases > 0 ? static_cast<uint32_t>(max_leases) :
+        std::numeric_limits<uint32_t>::max();
+    std::string limit_str = boost::lexical_cast<std::string>(limit);
+    bind_array.add(limit_str);
+
+    // Retrieve leases from the database.
+    getLeaseCollection(statement_index, bind_array, expired_leases);
+}
+
 
 template<typename LeasePtr>
 void
-PgSqlLeaseMgr::updateLeaseCommon(StatementIndex stindex,
-                                 PsqlBindArray& bind_array,
-                                 const LeasePtr& lease) {
+PgSqlLeaseMgrImpl::updateLeaseCommon(StatementIndex stindex,
+                                     PsqlBindArray& bind_array,
+                                     const LeasePtr& lease) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_ADD_ADDR4).arg(tagged_statements[stindex].name);
 
@@ -1236,7 +1715,7 @@ PgSqlLeaseMgr::updateLeaseCommon(StatementIndex stindex,
 
 
 void
-PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
+PgSqlLeaseMgrImpl::updateLease4(const Lease4Ptr& lease) {
     const StatementIndex stindex = UPDATE_LEASE4;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1256,7 +1735,7 @@ PgSqlLeaseMgr::updateLease4(const Lease4Ptr& lease) {
 }
 
 void
-PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
+PgSqlLeaseMgrImpl::updateLease6(const Lease6Ptr& lease) {
     const StatementIndex stindex = UPDATE_LEASE6;
 
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
@@ -1275,8 +1754,8 @@ PgSqlLeaseMgr::updateLease6(const Lease6Ptr& lease) {
 }
 
 uint64_t
-PgSqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
-                                 PsqlBindArray& bind_array) {
+PgSqlLeaseMgrImpl::deleteLeaseCommon(StatementIndex stindex,
+                                     PsqlBindArray& bind_array) {
     PgSqlResult r(PQexecPrepared(conn_, tagged_statements[stindex].name,
                                  tagged_statements[stindex].nbparams,
                                  &bind_array.values_[0],
@@ -1290,7 +1769,7 @@ PgSqlLeaseMgr::deleteLeaseCommon(StatementIndex stindex,
 }
 
 bool
-PgSqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
+PgSqlLeaseMgrImpl::deleteLease(const isc::asiolink::IOAddress& addr) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_DELETE_ADDR).arg(addr.toText());
 
@@ -1309,8 +1788,77 @@ PgSqlLeaseMgr::deleteLease(const isc::asiolink::IOAddress& addr) {
     return (deleteLeaseCommon(DELETE_LEASE6, bind_array) > 0);
 }
 
+void
+PgSqlLeaseMgrImpl::updateLeases4(const Lease4Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_UPDATE_ADDRS4).arg(leases.size());
+
+    if (leases.empty()) {
+        return;
+    }
+
+    // Run all updates within a single transaction. This avoids a commit
+    // for each updated lease and guarantees that either all or none of
+    // the leases are updated.
+    PgSqlTransaction transaction(conn_);
+    for (Lease4Collection::const_iterator lease = leases.begin();
+         lease != leases.end(); ++lease) {
+        updateLease4(*lease);
+    }
+    transaction.commit();
+}
+
+uint64_t
+PgSqlLeaseMgrImpl::deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_DELETE_ADDRS4).arg(addrs.size());
+
+    if (addrs.empty()) {
+        return (0);
+    }
+
+    // Addresses are passed as a single array literal, e.g. "{1,2,3}", so
+    // the leases are deleted with one round trip to the database.
+    std::ostringstream addrs_array;
+    addrs_array << "{";
+    for (std::vector<isc::asiolink::IOAddress>::const_iterator addr =
+             addrs.begin(); addr != addrs.end(); ++addr) {
+        if (!addr->isV4()) {
+            isc_throw(BadValue, "unable to delete leases: address "
+                      << *addr << " is not an IPv4 address");
+        }
+        if (addr != addrs.begin()) {
+            addrs_array << ",";
+        }
+        addrs_array << addr->toUint32();
+    }
+    addrs_array << "}";
+
+    PsqlBindArray bind_array;
+    bind_array.addTempString(addrs_array.str());
+    return (deleteLeaseCommon(DELETE_LEASE4_ADDRS, bind_array));
+}
+
+Lease4Collection
+PgSqlLeaseMgrImpl::storeLeases4(const Lease4Collection& leases) {
+    LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
+              DHCPSRV_PGSQL_STORE_ADDRS4).arg(leases.size());
+
+    if (leases.empty()) {
+        return (Lease4Collection());
+    }
+
+    // Add or update all leases within a single transaction, so the changes
+    // are committed once for the whole collection and none of them is
+    // stored if any of the queries fails.
+    PgSqlTransaction transaction(conn_);
+    Lease4Collection replaced = LeaseMgr::storeLeases4(leases);
+    transaction.commit();
+    return (replaced);
+}
+
 uint64_t
-PgSqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
+PgSqlLeaseMgrImpl::deleteExpiredReclaimedLeases4(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED4)
         .arg(secs);
@@ -1318,7 +1866,7 @@ PgSqlLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
 }
 
 uint64_t
-PgSqlLeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
+PgSqlLeaseMgrImpl::deleteExpiredReclaimedLeases6(const uint32_t secs) {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_DELETE_EXPIRED_RECLAIMED6)
         .arg(secs);
@@ -1326,8 +1874,8 @@ PgSqlLeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
 }
 
 uint64_t
-PgSqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
-                                                  StatementIndex statement_index) {
+PgSqlLeaseMgrImpl::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
+                                                      StatementIndex statement_index) {
     PsqlBindArray bind_array;
 
     // State is reclaimed.
@@ -1344,7 +1892,7 @@ PgSqlLeaseMgr::deleteExpiredReclaimedLeasesCommon(const uint32_t secs,
 }
 
 LeaseStatsQueryPtr
-PgSqlLeaseMgr::startLeaseStatsQuery4() {
+PgSqlLeaseMgrImpl::startLeaseStatsQuery4() {
     LeaseStatsQueryPtr query(
         new PgSqlLeaseStatsQuery(conn_,
                                  tagged_statements[RECOUNT_LEASE4_STATS],
@@ -1354,7 +1902,7 @@ PgSqlLeaseMgr::startLeaseStatsQuery4() {
 }
 
 LeaseStatsQueryPtr
-PgSqlLeaseMgr::startLeaseStatsQuery6() {
+PgSqlLeaseMgrImpl::startLeaseStatsQuery6() {
     LeaseStatsQueryPtr query(
         new PgSqlLeaseStatsQuery(conn_,
                                  tagged_statements[RECOUNT_LEASE6_STATS],
@@ -1364,7 +1912,7 @@ PgSqlLeaseMgr::startLeaseStatsQuery6() {
 }
 
 string
-PgSqlLeaseMgr::getName() const {
+PgSqlLeaseMgrImpl::getName() const {
     string name = "";
     try {
         name = conn_.getParameter("name");
@@ -1374,13 +1922,18 @@ PgSqlLeaseMgr::getName() const {
     return (name);
 }
 
+string
+PgSqlLeaseMgrImpl::getDescription() const {
+    return (string("PostgreSQL Database"));
+}
+
 string
 PgSqlLeaseMgr::getDescription() const {
     return (string("PostgreSQL Database"));
 }
 
 pair<uint32_t, uint32_t>
-PgSqlLeaseMgr::getVersion() const {
+PgSqlLeaseMgrImpl::getVersion() const {
     LOG_DEBUG(dhcpsrv_logger, DHCPSRV_DBG_TRACE_DETAIL,
               DHCPSRV_PGSQL_GET_VERSION);
 
@@ -1402,12 +1955,12 @@ PgSqlLeaseMgr::getVersion() const {
 }
 
 void
-PgSqlLeaseMgr::commit() {
+PgSqlLeaseMgrImpl::commit() {
     conn_.commit();
 }
 
 void
-PgSqlLeaseMgr::rollback() {
+PgSqlLeaseMgrImpl::rollback() {
     conn_.rollback();
 }
 
@@ -11,10 +11,13 @@
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/pgsql_connection.h>
 #include <dhcpsrv/pgsql_exchange.h>
+#include <dhcpsrv/pooled_lease_mgr.h>
 
 #include <boost/scoped_ptr.hpp>
+#include <boost/shared_ptr.hpp>
 #include <boost/utility.hpp>
 
+#include <list>
 #include <vector>
 
 namespace isc {
@@ -25,28 +28,20 @@ namespace dhcp {
 class PgSqlLease4Exchange;
 class PgSqlLease6Exchange;
 
-/// @brief PostgreSQL Lease Manager
+/// @brief PostgreSQL lease manager using a single connection
 ///
-/// This class provides the \ref isc::dhcp::LeaseMgr interface to the PostgreSQL
-/// database.  Use of this backend presupposes that a PostgreSQL database is
-/// available and that the Kea schema has been created within it.
-class PgSqlLeaseMgr : public LeaseMgr {
+/// This class implements the \ref isc::dhcp::LeaseMgr interface using a
+/// single connection to the PostgreSQL database and the statements
+/// prepared for this connection, so it can execute one query at the time.
+/// The instances of this class are held in the pool of the
+/// @c PgSqlLeaseMgr.
+class PgSqlLeaseMgrImpl : public LeaseMgr {
 public:
 
     /// @brief Constructor
     ///
-    /// Uses the following keywords in the parameters passed to it to
-    /// connect to the database:
-    /// - name - Name of the database to which to connect (mandatory)
-    /// - host - Host to which to connect (optional, defaults to "localhost")
-    /// - user - Username under which to connect (optional)
-    /// - password - Password for "user" on the database (optional)
-    ///
-    /// If the database is successfully opened, the version number in the
-    /// schema_version table will be checked against hard-coded value in
-    /// the implementation file.
-    ///
-    /// Finally, all the SQL commands are pre-compiled.
+    /// Opens the database using the specified parameters, pre-compiles
+    /// all the SQL commands and checks the schema version.
     ///
     /// @param parameters A data structure relating keywords and values
     ///        concerned with the database.
@@ -55,13 +50,10 @@ public:
     /// @throw isc::dhcp::DbOpenError Error opening the database
     /// @throw isc::dhcp::DbOperationError An operation on the open database has
     ///        failed.
-    PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters);
+    PgSqlLeaseMgrImpl(const DatabaseConnection::ParameterMap& parameters);
 
     /// @brief Destructor (closes database)
-    virtual ~PgSqlLeaseMgr();
-
-    /// @brief Local version of getDBVersion() class method
-    static std::string getDBVersion();
+    virtual ~PgSqlLeaseMgrImpl();
 
     /// @brief Adds an IPv4 lease
     ///
@@ -258,6 +250,87 @@ public:
     virtual void getExpiredLeases4(Lease4Collection& expired_leases,
                                    const size_t max_leases) const;
 
+    /// @brief Returns a collection of expired DHCPv6 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The leases are ordered by expiration time and address.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// are added.
+    /// @param max_leases A maximum number of leases to be returned or 0.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases6(Lease6Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// The leases are ordered by expiration time and address.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// are added.
+    /// @param max_leases A maximum number of leases to be returned or 0.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases4(Lease4Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a page of IPv4 leases ordered by address.
+    ///
+    /// The page is selected using the primary key on the address column,
+    /// so the cost of fetching the page doesn't depend on the number of
+    /// the preceding leases.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses greater than this address.
+    /// @param upper_bound_address The page includes the leases with the
+    /// addresses lower than or equal to this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection
+    getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const isc::asiolink::IOAddress& upper_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Returns a page of IPv6 leases ordered by address.
+    ///
+    /// The addresses are stored as text, so the leases are ordered by the
+    /// textual representation of the address.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses following this address in the textual order. The "::"
+    /// address returns the first page.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease6Collection
+    getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
     /// @brief Updates IPv4 lease.
     ///
     /// Updates the record of the lease in the database (as identified by the
@@ -295,6 +368,47 @@ public:
     ///        failed.
     virtual bool deleteLease(const isc::asiolink::IOAddress& addr);
 
+    /// @brief Updates a collection of IPv4 leases.
+    ///
+    /// All leases are updated within a single transaction. If any of the
+    /// updates fails, the transaction is rolled back and none of the leases
+    /// is updated.
+    ///
+    /// @param leases Collection of leases to be updated.
+    ///
+    /// @throw isc::dhcp::NoSuchLease Attempt to update a lease that did not
+    ///        exist.
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual void updateLeases4(const Lease4Collection& leases);
+
+    /// @brief Deletes a collection of IPv4 leases.
+    ///
+    /// All leases are deleted with a single query which takes an array of
+    /// addresses as a parameter.
+    ///
+    /// @param addrs Addresses of the leases to be deleted.
+    ///
+    /// @return Number of leases deleted.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual uint64_t
+    deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs);
+
+    /// @brief Stores a collection of IPv4 leases.
+    ///
+    /// All leases are added or updated within a single transaction, so
+    /// either all of them or none of them are stored.
+    ///
+    /// @param leases Collection of leases to be stored.
+    ///
+    /// @return Leases replaced by the stored ones.
+    ///
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    virtual Lease4Collection storeLeases4(const Lease4Collection& leases);
+
     /// @brief Deletes all expired-reclaimed DHCPv4 leases.
     ///
     /// @param secs Number of seconds since expiration of leases before
@@ -383,6 +497,7 @@ public:
     /// statements
     enum StatementIndex {
         DELETE_LEASE4,              // Delete from lease4 by address
+        DELETE_LEASE4_ADDRS,        // Delete from lease4 by address array
         DELETE_LEASE4_STATE_EXPIRED,// Delete expired lease4s in certain state.
         DELETE_LEASE6,              // Delete from lease6 by address
         DELETE_LEASE6_STATE_EXPIRED,// Delete expired lease6s in certain state.
@@ -392,10 +507,16 @@ public:
         GET_LEASE4_HWADDR,          // Get lease4 by HW address
         GET_LEASE4_HWADDR_SUBID,    // Get lease4 by HW address & subnet ID
         GET_LEASE4_EXPIRE,          // Get expired lease4
+        GET_LEASE4_EXPIRE_NEXT,     // Get expired lease4 after last lease
+        GET_LEASE4_PAGE,            // Get page of lease4 by address
+        GET_LEASE4_PAGE_SUBID,      // Get page of lease4 by address & subnet ID
         GET_LEASE6_ADDR,            // Get lease6 by address
         GET_LEASE6_DUID_IAID,       // Get lease6 by DUID and IAID
         GET_LEASE6_DUID_IAID_SUBID, // Get lease6 by DUID, IAID and subnet ID
         GET_LEASE6_EXPIRE,          // Get expired lease6
+        GET_LEASE6_EXPIRE_NEXT,     // Get expired lease6 after last lease
+        GET_LEASE6_PAGE,            // Get page of lease6 by address
+        GET_LEASE6_PAGE_SUBID,      // Get page of lease6 by address & subnet ID
         GET_VERSION,                // Obtain version number
         INSERT_LEASE4,              // Add entry to lease4 table
         INSERT_LEASE6,              // Add entry to lease6 table
@@ -406,6 +527,13 @@ public:
         NUM_STATEMENTS              // Number of statements
     };
 
+    /// @brief Checks if the connection is usable.
+    ///
+    /// @return true if the server responds to the ping.
+    bool ping() {
+        return (conn_.ping());
+    }
+
 private:
 
     /// @brief Add Lease Common Code
@@ -534,6 +662,29 @@ private:
                                 const size_t max_leases,
                                 StatementIndex statement_index) const;
 
+    /// @brief Get expired leases following the last returned lease.
+    ///
+    /// This method retrieves expired and not reclaimed leases which follow
+    /// the specified expiration time and address in the order of the
+    /// expiration time and address.
+    ///
+    /// @param [out] expired_leases Reference to the container where the
+    ///        retrieved leases are put.
+    /// @param max_leases Maximum number of leases to be returned.
+    /// @param last_expire Expiration time of the last returned lease.
+    /// @param last_address Address of the last returned lease in the
+    ///        format of the address column.
+    /// @param statement_index One of the @c GET_LEASE4_EXPIRE_NEXT or
+    ///        @c GET_LEASE6_EXPIRE_NEXT.
+    ///
+    /// @tparam One of the @c Lease4Collection or @c Lease6Collection.
+    template<typename LeaseCollection>
+    void getNextExpiredLeasesCommon(LeaseCollection& expired_leases,
+                                    const size_t max_leases,
+                                    const int64_t last_expire,
+                                    const std::string& last_address,
+                                    StatementIndex statement_index) const;
+
     /// @brief Update lease common code
     ///
     /// Holds the common code for updating a lease.  It binds the parameters
@@ -593,6 +744,226 @@ private:
     PgSqlConnection conn_;
 };
 
+/// @brief PostgreSQL Lease Manager
+///
+/// This class provides the \ref isc::dhcp::LeaseMgr interface to the PostgreSQL
+/// database.  Use of this backend presupposes that a PostgreSQL database is
+/// available and that the Kea schema has been created within it.
+///
+/// The blocking queries are executed by the @c PgSqlLeaseMgrImpl instances
+/// checked out from the pool of the @c PooledLeaseMgr. The asynchronous
+/// queries are sent over a separate, non-blocking connection.
+class PgSqlLeaseMgr : public PooledLeaseMgr {
+public:
+
+    /// @brief Constructor
+    ///
+    /// Uses the following keywords in the parameters passed to it to
+    /// connect to the database:
+    /// - name - Name of the database to which to connect (mandatory)
+    /// - host - Host to which to connect (optional, defaults to "localhost")
+    /// - user - Username under which to connect (optional)
+    /// - password - Password for "user" on the database (optional)
+    ///
+    /// If the database is successfully opened, the version number in the
+    /// schema_version table will be checked against hard-coded value in
+    /// the implementation file.
+    ///
+    /// Finally, all the SQL commands are pre-compiled.
+    ///
+    /// The blocking queries are executed using a pool of connections. The
+    /// maximum number of connections is specified with the
+    /// "connection-pool-size" keyword and defaults to 1. The first
+    /// connection is opened by the constructor, further connections are
+    /// opened when the queries are issued concurrently.
+    ///
+    /// @param parameters A data structure relating keywords and values
+    ///        concerned with the database.
+    ///
+    /// @throw isc::dhcp::NoDatabaseName Mandatory database name not given
+    /// @throw isc::dhcp::DbOpenError Error opening the database
+    /// @throw isc::dhcp::DbOperationError An operation on the open database has
+    ///        failed.
+    /// @throw isc::dhcp::DbInvalidPoolSize Invalid connection pool size.
+    PgSqlLeaseMgr(const DatabaseConnection::ParameterMap& parameters);
+
+    /// @brief Destructor
+    virtual ~PgSqlLeaseMgr();
+
+    /// @brief Local version of getDBVersion() class method
+    static std::string getDBVersion();
+
+    /// @brief Asynchronously returns an IPv4 lease for specified IPv4
+    /// address.
+    ///
+    /// The query is sent to the database over a dedicated, non-blocking
+    /// connection which is opened upon the first asynchronous lookup. The
+    /// socket of this connection is registered with the @c IfaceMgr, so
+    /// the results are processed from within the server's receive loop and
+    /// the @c handler is invoked when the result is available.
+    ///
+    /// Queries are processed in the order in which they have been issued.
+    ///
+    /// @param addr address of the searched lease
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const isc::asiolink::IOAddress& addr,
+                                const Lease4Handler& handler);
+
+    /// @brief Asynchronously returns an IPv4 lease for specified hardware
+    /// address and a subnet.
+    ///
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const isc::dhcp::HWAddr& hwaddr,
+                                SubnetID subnet_id,
+                                const Lease4Handler& handler);
+
+    /// @brief Asynchronously returns an IPv4 lease for specified client-id
+    /// and a subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    /// @param handler callback invoked when the lookup completes
+    virtual void asyncGetLease4(const ClientId& clientid,
+                                SubnetID subnet_id,
+                                const Lease4Handler& handler);
+
+    /// @brief Returns the number of asynchronous lookups in progress.
+    virtual size_t getAsyncPending() const {
+        return (async_queries_.size());
+    }
+
+    /// @brief Processes results of the asynchronous queries.
+    ///
+    /// This method is invoked by the @c IfaceMgr when the socket of the
+    /// asynchronous connection becomes readable. It consumes the available
+    /// input, invokes the handlers of the completed queries and sends the
+    /// next queued query. It never blocks waiting for the database.
+    void processAsyncResults();
+
+    /// @brief Return backend type
+    ///
+    /// Returns the type of the backend (e.g. "mysql", "memfile" etc.)
+    ///
+    /// @return Type of the backend.
+    virtual std::string getType() const {
+        return (std::string("postgresql"));
+    }
+
+    /// @brief Returns description of the backend.
+    ///
+    /// This description may be multiline text that describes the backend.
+    ///
+    /// @return Description of the backend.
+    virtual std::string getDescription() const;
+
+private:
+
+    /// @brief Creates a lease manager for the pool.
+    ///
+    /// @param parameters Parameters used to open the connection.
+    static LeasePool::ConnectionPtr
+    createPooledMgr(const DatabaseConnection::ParameterMap& parameters);
+
+    /// @brief Checks if the pooled lease manager's connection is usable.
+    ///
+    /// @param mgr Pooled lease manager.
+    static bool checkPooledMgr(LeaseMgr& mgr);
+
+    /// @brief Asynchronous IPv4 lease query.
+    struct AsyncQuery {
+        /// @brief Index of the prepared statement to be executed.
+        PgSqlLeaseMgrImpl::StatementIndex stindex_;
+
+        /// @brief Binary parameter of the query, i.e. HW address or
+        /// client identifier.
+        ///
+        /// The bind array points to this buffer, so it must remain valid
+        /// until the query is sent.
+        std::vector<uint8_t> data_;
+
+        /// @brief Parameters of the query.
+        PsqlBindArray bind_array_;
+
+        /// @brief Callback invoked when the query completes.
+        Lease4Handler handler_;
+
+        /// @brief Indicates if the query has been sent to the database.
+        bool sent_;
+
+        /// @brief Lease returned by the query.
+        Lease4Ptr lease_;
+
+        /// @brief Error description if the query failed.
+        std::string error_;
+
+        /// @brief Constructor.
+        ///
+        /// @param stindex Index of the prepared statement to be executed.
+        /// @param handler Callback invoked when the query completes.
+        AsyncQuery(PgSqlLeaseMgrImpl::StatementIndex stindex, const Lease4Handler& handler)
+            : stindex_(stindex), data_(), bind_array_(), handler_(handler),
+              sent_(false), lease_(), error_() {
+        }
+    };
+
+    /// @brief Pointer to the asynchronous query.
+    typedef boost::shared_ptr<AsyncQuery> AsyncQueryPtr;
+
+    /// @brief Opens the connection used for asynchronous queries.
+    ///
+    /// The connection is opened with the same parameters as the main
+    /// connection, switched to the non-blocking mode and its socket is
+    /// registered with the @c IfaceMgr. This is a no-op if the connection
+    /// is already open.
+    ///
+    /// @throw isc::dhcp::DbOpenError Error opening the database
+    void openAsyncConnection();
+
+    /// @brief Appends the query to the queue of asynchronous queries and
+    /// sends it if no other query is in progress.
+    ///
+    /// @param query Pointer to the query.
+    void queueAsyncQuery(const AsyncQueryPtr& query);
+
+    /// @brief Sends the query at the front of the queue to the database.
+    ///
+    /// If sending the query fails, its handler is invoked with an error
+    /// and the next query is sent.
+    void sendAsyncQuery();
+
+    /// @brief Sends the data buffered by libpq for the asynchronous
+    /// connection.
+    ///
+    /// If the data can't be sent entirely without blocking, the socket is
+    /// watched by the @c IfaceMgr for writing and this method is invoked
+    /// again when the socket becomes writable. The watch is removed when
+    /// all data have been sent.
+    void flushAsyncConnection();
+
+    /// @brief Invokes handlers of all queued queries with an error.
+    ///
+    /// @param error Error description passed to the handlers.
+    void failAsyncQueries(const std::string& error);
+
+    /// @brief Exchange object converting the results of the asynchronous
+    /// queries.
+    boost::scoped_ptr<PgSqlLease4Exchange> exchange4_;
+
+    /// @brief Non-blocking connection used for asynchronous queries.
+    boost::scoped_ptr<PgSqlConnection> async_conn_;
+
+    /// @brief Queue of asynchronous queries.
+    ///
+    /// The query at the front of the queue is the one being executed.
+    std::list<AsyncQueryPtr> async_queries_;
+
+    /// @brief Indicates if the socket of the asynchronous connection is
+    /// watched for writing.
+    bool async_flush_pending_;
+};
+
 }; // end of isc::dhcp namespace
 }; // end of isc namespace
 
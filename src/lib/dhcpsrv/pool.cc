@@ -14,6 +14,8 @@ using namespace isc::asiolink;
 namespace isc {
 namespace dhcp {
 
+const size_t Pool::MAX_FREE_ADDRESSES = 65536;
+
 Pool::Pool(Lease::Type type, const isc::asiolink::IOAddress& first,
            const isc::asiolink::IOAddress& last)
     :id_(getNextID()), first_(first), last_(last), type_(type),
@@ -24,6 +26,34 @@ bool Pool::inRange(const isc::asiolink::IOAddress& addr) const {
     return (first_.smallerEqual(addr) && addr.smallerEqual(last_));
 }
 
+void
+Pool::addFreeAddress(const isc::asiolink::IOAddress& address,
+                     const time_t freed_time) {
+    if ((free_addresses_.size() >= MAX_FREE_ADDRESSES) ||
+        (free_addresses_.size() >= capacity_) || !inRange(address) ||
+        !queued_addresses_.insert(address).second) {
+        return;
+    }
+    free_addresses_.push_back(std::make_pair(address, freed_time));
+}
+
+bool
+Pool::popFreeAddress(const uint32_t quarantine_time,
+                     isc::asiolink::IOAddress& address,
+                     const time_t now) {
+    // The addresses are queued in the order of freeing, so if the first
+    // address is still in quarantine, all remaining addresses are too.
+    if (free_addresses_.empty() ||
+        (free_addresses_.front().second +
+         static_cast<time_t>(quarantine_time) > now)) {
+        return (false);
+    }
+    address = free_addresses_.front().first;
+    free_addresses_.pop_front();
+    queued_addresses_.erase(address);
+    return (true);
+}
+
 std::string
 Pool::toText() const {
     std::stringstream tmp;
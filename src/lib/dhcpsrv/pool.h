@@ -15,6 +15,10 @@
 #include <dhcpsrv/lease.h>
 #include <boost/shared_ptr.hpp>
 
+#include <ctime>
+#include <deque>
+#include <set>
+#include <utility>
 #include <vector>
 
 namespace isc {
@@ -106,6 +110,53 @@ public:
         user_context_ = ctx;
     }
 
+    /// @brief Queues an address which has become free for reuse.
+    ///
+    /// The allocation engine records the addresses returned to the pool
+    /// by the lease release, reclamation of the expired leases and the
+    /// reclamation of the declined leases, and tries them before walking
+    /// the pool with the allocator. The addresses are handed out in the
+    /// order in which they have been freed.
+    ///
+    /// The number of queued addresses is limited by the pool capacity and
+    /// by the @c MAX_FREE_ADDRESSES. The addresses above this limit are
+    /// not queued and are found by the allocator instead. The address
+    /// which is already queued is not queued again, so it keeps its
+    /// position and freeing time.
+    ///
+    /// @param address Address which has become free.
+    /// @param freed_time Time when the address has become free.
+    void addFreeAddress(const isc::asiolink::IOAddress& address,
+                        const time_t freed_time = time(NULL));
+
+    /// @brief Takes the first free address which has been held in the queue
+    /// for at least the specified time.
+    ///
+    /// @param quarantine_time Time in seconds for which the address must
+    /// be held in the queue before it can be reused.
+    /// @param [out] address The address taken from the queue.
+    /// @param now Current time.
+    ///
+    /// @return true if the address has been taken from the queue, false
+    /// if the queue is empty or the first address is still in quarantine.
+    bool popFreeAddress(const uint32_t quarantine_time,
+                        isc::asiolink::IOAddress& address,
+                        const time_t now = time(NULL));
+
+    /// @brief Returns the number of queued free addresses.
+    size_t getFreeAddressesCount() const {
+        return (free_addresses_.size());
+    }
+
+    /// @brief Removes all queued free addresses.
+    void clearFreeAddresses() {
+        free_addresses_.clear();
+        queued_addresses_.clear();
+    }
+
+    /// @brief Maximum number of queued free addresses.
+    static const size_t MAX_FREE_ADDRESSES;
+
 protected:
 
     /// @brief protected constructor
@@ -161,6 +212,13 @@ protected:
 
     /// @brief Pointer to the user context (may be NULL)
     data::ConstElementPtr user_context_;
+
+    /// @brief Queue of the free addresses and the times when they have
+    /// been freed, in the order of freeing.
+    std::deque<std::pair<isc::asiolink::IOAddress, time_t> > free_addresses_;
+
+    /// @brief Addresses held in the @c free_addresses_ queue.
+    std::set<isc::asiolink::IOAddress> queued_addresses_;
 };
 
 /// @brief Pool information for IPv4 addresses
@@ -0,0 +1,283 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+
+#include <dhcpsrv/pooled_lease_mgr.h>
+
+#include <boost/shared_ptr.hpp>
+
+using namespace isc::asiolink;
+
+namespace {
+
+using namespace isc::dhcp;
+
+/// @brief Lease statistics query run by a pooled lease manager.
+///
+/// The query returned by the pooled lease manager uses its connection
+/// to fetch the rows, so the lease manager is returned to the pool when
+/// this query is destroyed.
+class PooledLeaseStatsQuery : public LeaseStatsQuery {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// @param mgr Handle of the pooled lease manager running the query.
+    /// @param query Query started by the pooled lease manager.
+    PooledLeaseStatsQuery(const boost::shared_ptr<PooledLeaseMgr::LeasePool::Handle>& mgr,
+                          const LeaseStatsQueryPtr& query)
+        : mgr_(mgr), query_(query) {
+    }
+
+    /// @brief Fetches the next row from the query started by the pooled
+    /// lease manager.
+    ///
+    /// @param[out] row Storage into which the row is fetched
+    ///
+    /// @return True if a row was fetched, false if there are no more rows.
+    virtual bool getNextRow(LeaseStatsRow& row) {
+        return (query_->getNextRow(row));
+    }
+
+private:
+
+    /// @brief Handle of the pooled lease manager running the query.
+    boost::shared_ptr<PooledLeaseMgr::LeasePool::Handle> mgr_;
+
+    /// @brief Query started by the pooled lease manager.
+    ///
+    /// It is declared after the handle, so as it is destroyed before the
+    /// lease manager is returned to the pool.
+    LeaseStatsQueryPtr query_;
+};
+
+}
+
+namespace isc {
+namespace dhcp {
+
+PooledLeaseMgr::PooledLeaseMgr(const DatabaseConnection::ParameterMap& parameters,
+                               const LeasePool::Factory& factory,
+                               const LeasePool::Validator& validator)
+    : parameters_(parameters) {
+    pool_.reset(new LeasePool(factory, validator,
+                              DatabaseConnection(parameters_).configuredPoolSize()));
+
+    // Open the first connection right away, so as the errors in the
+    // database parameters are reported when the lease manager is created.
+    LeasePool::Handle mgr(*pool_);
+}
+
+PooledLeaseMgr::~PooledLeaseMgr() {
+}
+
+bool
+PooledLeaseMgr::addLease(const Lease4Ptr& lease) {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->addLease(lease));
+}
+
+bool
+PooledLeaseMgr::addLease(const Lease6Ptr& lease) {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->addLease(lease));
+}
+
+Lease4Ptr
+PooledLeaseMgr::getLease4(const IOAddress& addr) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLease4(addr));
+}
+
+Lease4Collection
+PooledLeaseMgr::getLease4(const HWAddr& hwaddr) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLease4(hwaddr));
+}
+
+Lease4Ptr
+PooledLeaseMgr::getLease4(const HWAddr& hwaddr, SubnetID subnet_id) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLease4(hwaddr, subnet_id));
+}
+
+Lease4Collection
+PooledLeaseMgr::getLease4(const ClientId& clientid) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLease4(clientid));
+}
+
+Lease4Ptr
+PooledLeaseMgr::getLease4(const ClientId& clientid, const HWAddr& hwaddr,
+                          SubnetID subnet_id) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLease4(clientid, hwaddr, subnet_id));
+}
+
+Lease4Ptr
+PooledLeaseMgr::getLease4(const ClientId& clientid, SubnetID subnet_id) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLease4(clientid, subnet_id));
+}
+
+Lease6Ptr
+PooledLeaseMgr::getLease6(Lease::Type type, const IOAddress& addr) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLease6(type, addr));
+}
+
+Lease6Collection
+PooledLeaseMgr::getLeases6(Lease::Type type, const DUID& duid,
+                           uint32_t iaid) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLeases6(type, duid, iaid));
+}
+
+Lease6Collection
+PooledLeaseMgr::getLeases6(Lease::Type type, const DUID& duid,
+                           uint32_t iaid, SubnetID subnet_id) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLeases6(type, duid, iaid, subnet_id));
+}
+
+void
+PooledLeaseMgr::getExpiredLeases6(Lease6Collection& expired_leases,
+                                  const size_t max_leases) const {
+    LeasePool::Handle mgr(*pool_);
+    mgr->getExpiredLeases6(expired_leases, max_leases);
+}
+
+void
+PooledLeaseMgr::getExpiredLeases4(Lease4Collection& expired_leases,
+                                  const size_t max_leases) const {
+    LeasePool::Handle mgr(*pool_);
+    mgr->getExpiredLeases4(expired_leases, max_leases);
+}
+
+void
+PooledLeaseMgr::getNextExpiredLeases6(Lease6Collection& expired_leases,
+                                      const size_t max_leases,
+                                      const int64_t last_expire,
+                                      const IOAddress& last_address) const {
+    LeasePool::Handle mgr(*pool_);
+    mgr->getNextExpiredLeases6(expired_leases, max_leases, last_expire,
+                               last_address);
+}
+
+void
+PooledLeaseMgr::getNextExpiredLeases4(Lease4Collection& expired_leases,
+                                      const size_t max_leases,
+                                      const int64_t last_expire,
+                                      const IOAddress& last_address) const {
+    LeasePool::Handle mgr(*pool_);
+    mgr->getNextExpiredLeases4(expired_leases, max_leases, last_expire,
+                               last_address);
+}
+
+Lease4Collection
+PooledLeaseMgr::getLeases4Page(const IOAddress& lower_bound_address,
+                               const IOAddress& upper_bound_address,
+                               const SubnetID& subnet_id,
+                               const size_t page_size) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLeases4Page(lower_bound_address, upper_bound_address,
+                                subnet_id, page_size));
+}
+
+Lease6Collection
+PooledLeaseMgr::getLeases6Page(const IOAddress& lower_bound_address,
+                               const SubnetID& subnet_id,
+                               const size_t page_size) const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getLeases6Page(lower_bound_address, subnet_id, page_size));
+}
+
+void
+PooledLeaseMgr::updateLease4(const Lease4Ptr& lease4) {
+    LeasePool::Handle mgr(*pool_);
+    mgr->updateLease4(lease4);
+}
+
+void
+PooledLeaseMgr::updateLease6(const Lease6Ptr& lease6) {
+    LeasePool::Handle mgr(*pool_);
+    mgr->updateLease6(lease6);
+}
+
+bool
+PooledLeaseMgr::deleteLease(const IOAddress& addr) {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->deleteLease(addr));
+}
+
+void
+PooledLeaseMgr::updateLeases4(const Lease4Collection& leases) {
+    LeasePool::Handle mgr(*pool_);
+    mgr->updateLeases4(leases);
+}
+
+uint64_t
+PooledLeaseMgr::deleteLeases4(const std::vector<IOAddress>& addrs) {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->deleteLeases4(addrs));
+}
+
+Lease4Collection
+PooledLeaseMgr::storeLeases4(const Lease4Collection& leases) {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->storeLeases4(leases));
+}
+
+uint64_t
+PooledLeaseMgr::deleteExpiredReclaimedLeases4(const uint32_t secs) {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->deleteExpiredReclaimedLeases4(secs));
+}
+
+uint64_t
+PooledLeaseMgr::deleteExpiredReclaimedLeases6(const uint32_t secs) {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->deleteExpiredReclaimedLeases6(secs));
+}
+
+LeaseStatsQueryPtr
+PooledLeaseMgr::startLeaseStatsQuery4() {
+    boost::shared_ptr<LeasePool::Handle> mgr(new LeasePool::Handle(*pool_));
+    LeaseStatsQueryPtr query = (*mgr)->startLeaseStatsQuery4();
+    return (LeaseStatsQueryPtr(new PooledLeaseStatsQuery(mgr, query)));
+}
+
+LeaseStatsQueryPtr
+PooledLeaseMgr::startLeaseStatsQuery6() {
+    boost::shared_ptr<LeasePool::Handle> mgr(new LeasePool::Handle(*pool_));
+    LeaseStatsQueryPtr query = (*mgr)->startLeaseStatsQuery6();
+    return (LeaseStatsQueryPtr(new PooledLeaseStatsQuery(mgr, query)));
+}
+
+std::string
+PooledLeaseMgr::getName() const {
+    DatabaseConnection::ParameterMap::const_iterator name =
+        parameters_.find("name");
+    return (name != parameters_.end() ? name->second : std::string());
+}
+
+std::pair<uint32_t, uint32_t>
+PooledLeaseMgr::getVersion() const {
+    LeasePool::Handle mgr(*pool_);
+    return (mgr->getVersion());
+}
+
+void
+PooledLeaseMgr::commit() {
+}
+
+void
+PooledLeaseMgr::rollback() {
+}
+
+}; // end of isc::dhcp namespace
+}; // end of isc namespace
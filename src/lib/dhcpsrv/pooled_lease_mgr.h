@@ -0,0 +1,345 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef POOLED_LEASE_MGR_H
+#define POOLED_LEASE_MGR_H
+
+#include <asiolink/io_address.h>
+#include <dhcpsrv/database_connection.h>
+#include <dhcpsrv/db_connection_pool.h>
+#include <dhcpsrv/lease_mgr.h>
+
+#include <boost/scoped_ptr.hpp>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace isc {
+namespace dhcp {
+
+/// @brief Lease manager executing the queries using a pool of lease
+/// managers.
+///
+/// The SQL lease managers can execute one query at the time, because
+/// each of them owns a single connection and the statements prepared for
+/// this connection. This lease manager holds a pool of such lease
+/// managers and forwards each call to a lease manager checked out from
+/// the pool for the duration of the call, so as the calls issued
+/// concurrently by different threads are executed using different
+/// connections. The maximum number of connections is specified with
+/// the "connection-pool-size" parameter.
+///
+/// The SQL backends derive from this class and provide the factory
+/// function creating the pooled lease managers and the function checking
+/// if the connection of the pooled lease manager is still usable.
+///
+/// A call is never split between the pooled lease managers, so the
+/// methods modifying multiple leases within a single transaction are
+/// still atomic. However, there is no connection to which the
+/// @c commit and @c rollback would apply, so they are no-ops.
+class PooledLeaseMgr : public LeaseMgr {
+public:
+
+    /// @brief Pool of lease managers executing the queries.
+    typedef DbConnectionPool<LeaseMgr> LeasePool;
+
+    /// @brief Constructor.
+    ///
+    /// Opens the first connection right away, so as the errors in the
+    /// database parameters are reported when the lease manager is created.
+    ///
+    /// @param parameters A data structure relating keywords and values
+    ///        concerned with the database.
+    /// @param factory Function creating the pooled lease managers.
+    /// @param validator Function checking if the connection of the pooled
+    ///        lease manager is usable.
+    ///
+    /// @throw isc::dhcp::DbInvalidPoolSize Invalid connection pool size.
+    PooledLeaseMgr(const DatabaseConnection::ParameterMap& parameters,
+                   const LeasePool::Factory& factory,
+                   const LeasePool::Validator& validator);
+
+    /// @brief Destructor.
+    virtual ~PooledLeaseMgr();
+
+    /// @brief Adds an IPv4 lease.
+    ///
+    /// @param lease lease to be added
+    virtual bool addLease(const Lease4Ptr& lease);
+
+    /// @brief Adds an IPv6 lease.
+    ///
+    /// @param lease lease to be added
+    virtual bool addLease(const Lease6Ptr& lease);
+
+    /// @brief Returns existing IPv4 lease for specified IPv4 address.
+    ///
+    /// @param addr address of the searched lease
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual Lease4Ptr getLease4(const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Returns existing IPv4 leases for specified hardware address.
+    ///
+    /// @param hwaddr hardware address of the client
+    ///
+    /// @return lease collection
+    virtual Lease4Collection getLease4(const isc::dhcp::HWAddr& hwaddr) const;
+
+    /// @brief Returns existing IPv4 lease for specified hardware address
+    /// and a subnet.
+    ///
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual Lease4Ptr getLease4(const isc::dhcp::HWAddr& hwaddr,
+                                SubnetID subnet_id) const;
+
+    /// @brief Returns existing IPv4 leases for specified client-id.
+    ///
+    /// @param clientid client identifier
+    ///
+    /// @return lease collection
+    virtual Lease4Collection getLease4(const ClientId& clientid) const;
+
+    /// @brief Returns IPv4 lease for specified client-id, hardware address
+    /// and subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param hwaddr hardware address of the client
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual Lease4Ptr getLease4(const ClientId& clientid, const HWAddr& hwaddr,
+                                SubnetID subnet_id) const;
+
+    /// @brief Returns existing IPv4 lease for specified client-id and
+    /// a subnet.
+    ///
+    /// @param clientid client identifier
+    /// @param subnet_id identifier of the subnet that lease must belong to
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual Lease4Ptr getLease4(const ClientId& clientid,
+                                SubnetID subnet_id) const;
+
+    /// @brief Returns existing IPv6 lease for a given IPv6 address.
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param addr address of the searched lease
+    ///
+    /// @return smart pointer to the lease (or NULL if a lease is not found)
+    virtual Lease6Ptr getLease6(Lease::Type type,
+                                const isc::asiolink::IOAddress& addr) const;
+
+    /// @brief Returns existing IPv6 leases for a given DUID+IA combination
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param duid client DUID
+    /// @param iaid IA identifier
+    ///
+    /// @return collection of IPv6 leases
+    virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
+                                        uint32_t iaid) const;
+
+    /// @brief Returns existing IPv6 leases for a given DUID+IA combination
+    ///
+    /// @param type specifies lease type: (NA, TA or PD)
+    /// @param duid client DUID
+    /// @param iaid IA identifier
+    /// @param subnet_id subnet id of the subnet the lease belongs to
+    ///
+    /// @return collection of IPv6 leases
+    virtual Lease6Collection getLeases6(Lease::Type type, const DUID& duid,
+                                        uint32_t iaid, SubnetID subnet_id) const;
+
+    /// @brief Returns a collection of expired DHCPv6 leases.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the pooled lease manager are appended.
+    /// @param max_leases A maximum number of leases to be returned.
+    virtual void getExpiredLeases6(Lease6Collection& expired_leases,
+                                   const size_t max_leases) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the pooled lease manager are appended.
+    /// @param max_leases A maximum number of leases to be returned.
+    virtual void getExpiredLeases4(Lease4Collection& expired_leases,
+                                   const size_t max_leases) const;
+
+    /// @brief Returns a collection of expired DHCPv6 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the pooled lease manager are appended.
+    /// @param max_leases A maximum number of leases to be returned.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases6(Lease6Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a collection of expired DHCPv4 leases following the
+    /// specified position in the expiration order.
+    ///
+    /// @param [out] expired_leases A container to which expired leases
+    /// returned by the pooled lease manager are appended.
+    /// @param max_leases A maximum number of leases to be returned.
+    /// @param last_expire Expiration time of the last lease returned by the
+    /// previous call.
+    /// @param last_address Address of the last lease returned by the
+    /// previous call.
+    virtual void
+    getNextExpiredLeases4(Lease4Collection& expired_leases,
+                          const size_t max_leases,
+                          const int64_t last_expire,
+                          const isc::asiolink::IOAddress& last_address) const;
+
+    /// @brief Returns a page of IPv4 leases ordered by address.
+    ///
+    /// @param lower_bound_address The page includes the leases with the
+    /// addresses greater than this address.
+    /// @param upper_bound_address The page includes the leases with the
+    /// addresses lower than or equal to this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    virtual Lease4Collection
+    getLeases4Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const isc::asiolink::IOAddress& upper_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Returns a page of IPv6 leases ordered by address.
+    ///
+    /// @param lower_bound_address The page includes the leases following
+    /// this address.
+    /// @param subnet_id Identifier of the subnet to which the returned leases
+    /// belong or 0 if the leases from all subnets are returned.
+    /// @param page_size Maximum number of leases to be returned.
+    ///
+    /// @return Collection of at most @c page_size leases ordered by address.
+    virtual Lease6Collection
+    getLeases6Page(const isc::asiolink::IOAddress& lower_bound_address,
+                   const SubnetID& subnet_id,
+                   const size_t page_size) const;
+
+    /// @brief Updates IPv4 lease.
+    ///
+    /// @param lease4 The lease to be updated.
+    virtual void updateLease4(const Lease4Ptr& lease4);
+
+    /// @brief Updates IPv6 lease.
+    ///
+    /// @param lease6 The lease to be updated.
+    virtual void updateLease6(const Lease6Ptr& lease6);
+
+    /// @brief Deletes a lease.
+    ///
+    /// @param addr Address of the lease to be deleted.
+    ///
+    /// @return true if deletion was successful, false if no such lease
+    /// exists
+    virtual bool deleteLease(const isc::asiolink::IOAddress& addr);
+
+    /// @brief Updates multiple IPv4 leases within a single transaction.
+    ///
+    /// @param leases Collection of leases to be updated.
+    virtual void updateLeases4(const Lease4Collection& leases);
+
+    /// @brief Deletes multiple IPv4 leases within a single transaction.
+    ///
+    /// @param addrs Addresses of the leases to be deleted.
+    ///
+    /// @return Number of deleted leases.
+    virtual uint64_t
+    deleteLeases4(const std::vector<isc::asiolink::IOAddress>& addrs);
+
+    /// @brief Stores multiple IPv4 leases within a single transaction.
+    ///
+    /// @param leases Collection of leases to be stored.
+    ///
+    /// @return Leases replaced by the stored ones.
+    virtual Lease4Collection storeLeases4(const Lease4Collection& leases);
+
+    /// @brief Deletes all expired and reclaimed DHCPv4 leases.
+    ///
+    /// @param secs Number of seconds since expiration of leases before
+    /// they can be removed.
+    ///
+    /// @return Number of leases deleted.
+    virtual uint64_t deleteExpiredReclaimedLeases4(const uint32_t secs);
+
+    /// @brief Deletes all expired and reclaimed DHCPv6 leases.
+    ///
+    /// @param secs Number of seconds since expiration of leases before
+    /// they can be removed.
+    ///
+    /// @return Number of leases deleted.
+    virtual uint64_t deleteExpiredReclaimedLeases6(const uint32_t secs);
+
+    /// @brief Creates and runs the IPv4 lease stats query.
+    ///
+    /// The returned query holds the pooled lease manager which runs it
+    /// until the query is destroyed.
+    virtual LeaseStatsQueryPtr startLeaseStatsQuery4();
+
+    /// @brief Creates and runs the IPv6 lease stats query.
+    ///
+    /// The returned query holds the pooled lease manager which runs it
+    /// until the query is destroyed.
+    virtual LeaseStatsQueryPtr startLeaseStatsQuery6();
+
+    /// @brief Returns backend name.
+    ///
+    /// @return Name of the database.
+    virtual std::string getName() const;
+
+    /// @brief Returns backend version.
+    ///
+    /// @return Version number as a pair of unsigned integers.  "first" is the
+    ///         major version number, "second" the minor number.
+    virtual std::pair<uint32_t, uint32_t> getVersion() const;
+
+    /// @brief Commit Transactions
+    ///
+    /// This is a no-op: subsequent calls may be executed using different
+    /// connections, so there is no transaction spanning multiple calls.
+    /// The pooled lease managers run in the autocommit mode and use their
+    /// own transactions where multiple leases are modified.
+    virtual void commit();
+
+    /// @brief Rollback Transactions
+    ///
+    /// This is a no-op for the same reason as @c commit.
+    virtual void rollback();
+
+protected:
+
+    /// @brief Parameters used to open the pooled connections.
+    DatabaseConnection::ParameterMap parameters_;
+
+    /// @brief Pooled lease managers executing the queries.
+    ///
+    /// Each of them owns a separate connection to the database. A
+    /// connection lost between the queries is replaced with a new one.
+    boost::scoped_ptr<LeasePool> pool_;
+};
+
+}; // end of isc::dhcp namespace
+}; // end of isc namespace
+
+#endif // POOLED_LEASE_MGR_H
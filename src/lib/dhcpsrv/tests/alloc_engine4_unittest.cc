@@ -1824,6 +1824,78 @@ TEST_F(AllocEngine4Test, reservedAddressExistingLeaseStat) {
     EXPECT_FALSE(ctx.fake_allocation_);
 }
 
+// This test checks that the addresses which have become free are allocated
+// before the addresses picked by the allocator, after the quarantine time.
+TEST_F(AllocEngine4Test, allocateFreeAddress4) {
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 0, false);
+    EXPECT_EQ(0, engine.getReuseQuarantineTime());
+
+    // The freed address should be allocated first.
+    pool_->addFreeAddress(IOAddress("192.0.2.105"));
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("0.0.0.0"), false, false,
+                                    "", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease = engine.allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.105", lease->addr_.toText());
+    EXPECT_EQ(0, pool_->getFreeAddressesCount());
+
+    // The address in quarantine should not be allocated.
+    engine.setReuseQuarantineTime(3600);
+    pool_->addFreeAddress(IOAddress("192.0.2.107"));
+    AllocEngine::ClientContext4 ctx2(subnet_, clientid2_, hwaddr2_,
+                                     IOAddress("0.0.0.0"), false, false,
+                                     "", false);
+    ctx2.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    lease = engine.allocateLease4(ctx2);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.100", lease->addr_.toText());
+    EXPECT_EQ(1, pool_->getFreeAddressesCount());
+
+    // The address freed before the quarantine time should be allocated.
+    pool_->clearFreeAddresses();
+    pool_->addFreeAddress(IOAddress("192.0.2.107"), time(NULL) - 3600);
+    ASSERT_TRUE(LeaseMgrFactory::instance().deleteLease(lease->addr_));
+    lease = engine.allocateLease4(ctx2);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.107", lease->addr_.toText());
+
+    // The freed address in use by another client should be skipped.
+    engine.setReuseQuarantineTime(0);
+    pool_->addFreeAddress(IOAddress("192.0.2.105"));
+    ASSERT_TRUE(LeaseMgrFactory::instance().deleteLease(lease->addr_));
+    lease = engine.allocateLease4(ctx2);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.101", lease->addr_.toText());
+    EXPECT_EQ(0, pool_->getFreeAddressesCount());
+}
+
+// This test checks that the addresses of the reclaimed leases are reused.
+TEST_F(AllocEngine4Test, reuseReclaimedAddress4) {
+    AllocEngine engine(AllocEngine::ALLOC_ITERATIVE, 0, false);
+
+    // Create the expired lease for another client.
+    Lease4Ptr expired(new Lease4(IOAddress("192.0.2.108"), hwaddr2_,
+                                 &clientid2_->getClientId()[0],
+                                 clientid2_->getClientId().size(),
+                                 100, 30, 60, time(NULL) - 500,
+                                 subnet_->getID(), false, false, ""));
+    ASSERT_TRUE(LeaseMgrFactory::instance().addLease(expired));
+
+    // Reclaiming the lease should queue its address.
+    ASSERT_NO_THROW(engine.reclaimExpiredLeases4(0, 0, true));
+    EXPECT_EQ(1, pool_->getFreeAddressesCount());
+
+    AllocEngine::ClientContext4 ctx(subnet_, clientid_, hwaddr_,
+                                    IOAddress("0.0.0.0"), false, false,
+                                    "", false);
+    ctx.query_.reset(new Pkt4(DHCPREQUEST, 1234));
+    Lease4Ptr lease = engine.allocateLease4(ctx);
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.108", lease->addr_.toText());
+}
+
 }; // namespace test
 }; // namespace dhcp
 }; // namespace isc
@@ -1540,6 +1540,29 @@ TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesHooksWithSkip) {
     testReclaimExpiredLeasesHooksWithSkip();
 }
 
+// This test verifies that the expired leases are reclaimed in slices
+// and that the slice size must be greater than 0.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesSlices) {
+    EXPECT_THROW(engine_->setReclamationSliceSize(0), BadValue);
+    ASSERT_NO_THROW(engine_->setReclamationSliceSize(3));
+    EXPECT_EQ(3, engine_->getReclamationSliceSize());
+    testReclaimExpiredLeasesUpdateState();
+}
+
+// This test verifies that the limit of the reclaimed leases is honored
+// when it is not a multiple of the slice size.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesLimitSlices) {
+    ASSERT_NO_THROW(engine_->setReclamationSliceSize(3));
+    testReclaimExpiredLeasesLimit();
+}
+
+// This test verifies that the leases left expired by the callouts are
+// not processed again by the subsequent slices.
+TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesHooksWithSkipSlices) {
+    ASSERT_NO_THROW(engine_->setReclamationSliceSize(3));
+    testReclaimExpiredLeasesHooksWithSkip();
+}
+
 // This test verifies that it is possible to set the timeout for the
 // execution of the lease reclamation routine.
 TEST_F(ExpirationAllocEngine6Test, reclaimExpiredLeasesTimeout) {
@@ -2203,6 +2226,29 @@ TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesHooksWithSkip) {
     testReclaimExpiredLeasesHooksWithSkip();
 }
 
+// This test verifies that the expired leases are reclaimed in slices
+// and that the slice size must be greater than 0.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesSlices) {
+    EXPECT_THROW(engine_->setReclamationSliceSize(0), BadValue);
+    ASSERT_NO_THROW(engine_->setReclamationSliceSize(3));
+    EXPECT_EQ(3, engine_->getReclamationSliceSize());
+    testReclaimExpiredLeasesUpdateState();
+}
+
+// This test verifies that the limit of the reclaimed leases is honored
+// when it is not a multiple of the slice size.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesLimitSlices) {
+    ASSERT_NO_THROW(engine_->setReclamationSliceSize(3));
+    testReclaimExpiredLeasesLimit();
+}
+
+// This test verifies that the leases left expired by the callouts are
+// not processed again by the subsequent slices.
+TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesHooksWithSkipSlices) {
+    ASSERT_NO_THROW(engine_->setReclamationSliceSize(3));
+    testReclaimExpiredLeasesHooksWithSkip();
+}
+
 // This test verifies that it is possible to set the timeout for the
 // execution of the lease reclamation routine.
 TEST_F(ExpirationAllocEngine4Test, reclaimExpiredLeasesTimeout) {
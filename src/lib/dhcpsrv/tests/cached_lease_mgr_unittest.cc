@@ -0,0 +1,294 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcpsrv/cached_lease_mgr.h>
+#include <dhcpsrv/lease_mgr_factory.h>
+#include <dhcpsrv/memfile_lease_mgr.h>
+#include <dhcpsrv/tests/generic_lease_mgr_unittest.h>
+#include <dhcpsrv/tests/test_utils.h>
+#include <boost/scoped_ptr.hpp>
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace std;
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+using namespace isc::dhcp::test;
+
+namespace {
+
+/// @brief Test fixture class for @c CachedLeaseMgr.
+///
+/// The cache is created in front of the in-memory instance of the
+/// memfile backend.
+class CachedLeaseMgrTest : public GenericLeaseMgrTest {
+public:
+
+    /// @brief Constructor.
+    ///
+    /// Creates the cached lease manager using the @c LeaseMgrFactory.
+    CachedLeaseMgrTest() {
+        LeaseMgrFactory::destroy();
+        startBackend(V4);
+    }
+
+    /// @brief Destructor.
+    virtual ~CachedLeaseMgrTest() {
+        LeaseMgrFactory::destroy();
+    }
+
+    /// @brief Reopens the backend.
+    ///
+    /// The in-memory backend loses the leases on reopen, so the tests
+    /// using this function are not run for the cache.
+    virtual void reopen(Universe u) {
+        LeaseMgrFactory::destroy();
+        startBackend(u);
+    }
+
+    /// @brief Creates the cached lease manager.
+    ///
+    /// @param u Universe (V4 or V6).
+    void startBackend(Universe u) {
+        LeaseMgrFactory::create(std::string("type=memfile persist=false "
+                                            "cache-size=100 universe=") +
+                                (u == V4 ? "4" : "6"));
+        lmptr_ = &(LeaseMgrFactory::instance());
+        cache_ = dynamic_cast<CachedLeaseMgr*>(lmptr_);
+        ASSERT_TRUE(cache_);
+    }
+
+    /// @brief Creates a small cache in place of the current one.
+    ///
+    /// @param max_size Maximum number of cached leases.
+    void startSmallCache(const size_t max_size) {
+        LeaseMgrFactory::destroy();
+        DatabaseConnection::ParameterMap pmap;
+        pmap["type"] = "memfile";
+        pmap["universe"] = "4";
+        pmap["persist"] = "false";
+        small_cache_.reset(new CachedLeaseMgr(new Memfile_LeaseMgr(pmap),
+                                              max_size));
+        cache_ = small_cache_.get();
+        lmptr_ = cache_;
+    }
+
+    /// @brief Pointer to the tested cache.
+    CachedLeaseMgr* cache_;
+
+    /// @brief Cache created outside of the @c LeaseMgrFactory.
+    boost::scoped_ptr<CachedLeaseMgr> small_cache_;
+};
+
+// Checks that the factory creates the cache only when requested.
+TEST_F(CachedLeaseMgrTest, factory) {
+    LeaseMgrFactory::destroy();
+    ASSERT_NO_THROW(LeaseMgrFactory::create("type=memfile persist=false "
+                                            "universe=4 cache-size=0"));
+    EXPECT_FALSE(dynamic_cast<CachedLeaseMgr*>(&LeaseMgrFactory::instance()));
+
+    LeaseMgrFactory::destroy();
+    EXPECT_THROW(LeaseMgrFactory::create("type=memfile persist=false "
+                                         "universe=4 cache-size=-1"),
+                 InvalidParameter);
+    EXPECT_THROW(LeaseMgrFactory::create("type=memfile persist=false "
+                                         "universe=4 cache-size=many"),
+                 InvalidParameter);
+    EXPECT_FALSE(LeaseMgrFactory::haveInstance());
+
+    // The type of the cached backend should be returned.
+    ASSERT_NO_THROW(startBackend(V4));
+    EXPECT_EQ("memfile", lmptr_->getType());
+}
+
+// Checks that the cached lookups don't query the backend.
+TEST_F(CachedLeaseMgrTest, lookupFromCache) {
+    Lease4Ptr lease = initializeLease4("192.0.2.1");
+    ASSERT_TRUE(lmptr_->addLease(lease));
+    EXPECT_EQ(1, cache_->getCachedLeasesCount());
+
+    // Remove the lease from the backend bypassing the cache. The cached
+    // lease should still be returned.
+    ASSERT_TRUE(cache_->getBackend().deleteLease(lease->addr_));
+    Lease4Ptr cached = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(cached);
+    detailCompareLease(lease, cached);
+
+    // Lookups by client identifier and hardware address are served from
+    // the cache once the backend has been queried.
+    ASSERT_TRUE(cache_->getBackend().addLease(lease));
+    ASSERT_TRUE(lmptr_->getLease4(*lease->client_id_, lease->subnet_id_));
+    ASSERT_TRUE(lmptr_->getLease4(*lease->hwaddr_, lease->subnet_id_));
+    ASSERT_TRUE(cache_->getBackend().deleteLease(lease->addr_));
+    EXPECT_TRUE(lmptr_->getLease4(*lease->client_id_, lease->subnet_id_));
+    EXPECT_TRUE(lmptr_->getLease4(*lease->hwaddr_, lease->subnet_id_));
+
+    // Deleting the lease through the cache removes it from the cache.
+    lmptr_->deleteLease(lease->addr_);
+    EXPECT_FALSE(lmptr_->getLease4(lease->addr_));
+    EXPECT_FALSE(lmptr_->getLease4(*lease->client_id_, lease->subnet_id_));
+    EXPECT_FALSE(lmptr_->getLease4(*lease->hwaddr_, lease->subnet_id_));
+}
+
+// Checks that the lookups which returned no lease are cached and that
+// they are updated when the lease is added.
+TEST_F(CachedLeaseMgrTest, negativeLookup) {
+    Lease4Ptr lease = initializeLease4("192.0.2.1");
+    EXPECT_FALSE(lmptr_->getLease4(lease->addr_));
+    EXPECT_FALSE(lmptr_->getLease4(*lease->client_id_, lease->subnet_id_));
+    EXPECT_FALSE(lmptr_->getLease4(*lease->hwaddr_, lease->subnet_id_));
+
+    // The lease added to the backend directly is not seen by the cache.
+    ASSERT_TRUE(cache_->getBackend().addLease(lease));
+    EXPECT_FALSE(lmptr_->getLease4(lease->addr_));
+    EXPECT_FALSE(lmptr_->getLease4(*lease->client_id_, lease->subnet_id_));
+
+    // The lease updated through the cache is seen by all lookups.
+    lease->hostname_ = "cached.example.org";
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease));
+    Lease4Ptr cached = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(cached);
+    detailCompareLease(lease, cached);
+    cached = lmptr_->getLease4(*lease->client_id_, lease->subnet_id_);
+    ASSERT_TRUE(cached);
+    detailCompareLease(lease, cached);
+    cached = lmptr_->getLease4(*lease->hwaddr_, lease->subnet_id_);
+    ASSERT_TRUE(cached);
+    detailCompareLease(lease, cached);
+}
+
+// Checks that the caller can't modify the cached lease.
+TEST_F(CachedLeaseMgrTest, copies) {
+    Lease4Ptr lease = initializeLease4("192.0.2.1");
+    ASSERT_TRUE(lmptr_->addLease(lease));
+    lease->hostname_ = "modified.example.org";
+
+    Lease4Ptr cached = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(cached);
+    EXPECT_NE(lease->hostname_, cached->hostname_);
+
+    cached->hostname_ = "modified.example.org";
+    cached = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(cached);
+    EXPECT_NE(lease->hostname_, cached->hostname_);
+}
+
+// Checks that the least recently used leases are evicted.
+TEST_F(CachedLeaseMgrTest, eviction) {
+    startSmallCache(2);
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_TRUE(lmptr_->addLease(leases[1]));
+    ASSERT_TRUE(lmptr_->addLease(leases[2]));
+
+    // Use the first lease, so as the second one is evicted next.
+    ASSERT_TRUE(lmptr_->getLease4(leases[1]->addr_));
+    ASSERT_TRUE(lmptr_->addLease(leases[3]));
+    EXPECT_EQ(2, cache_->getCachedLeasesCount());
+
+    // Remove the leases from the backend to check which are cached.
+    for (int i = 1; i <= 3; ++i) {
+        ASSERT_TRUE(cache_->getBackend().deleteLease(leases[i]->addr_));
+    }
+    EXPECT_TRUE(lmptr_->getLease4(leases[1]->addr_));
+    EXPECT_FALSE(lmptr_->getLease4(leases[2]->addr_));
+    EXPECT_TRUE(lmptr_->getLease4(leases[3]->addr_));
+}
+
+// Checks that the cache is flushed when the leases are removed in bulk.
+TEST_F(CachedLeaseMgrTest, flush) {
+    Lease4Ptr lease = initializeLease4("192.0.2.1");
+    ASSERT_TRUE(lmptr_->addLease(lease));
+    ASSERT_EQ(1, cache_->getCachedLeasesCount());
+    lmptr_->rollback();
+    EXPECT_EQ(0, cache_->getCachedLeasesCount());
+}
+
+/// @brief Checks lookups by client id.
+TEST_F(CachedLeaseMgrTest, getLease4ClientId) {
+    testGetLease4ClientId();
+}
+
+/// @brief Checks that the lease with null client id is returned.
+TEST_F(CachedLeaseMgrTest, getLease4NullClientId) {
+    testGetLease4NullClientId();
+}
+
+/// @brief Checks lookups by hardware address.
+TEST_F(CachedLeaseMgrTest, getLease4HWAddr1) {
+    testGetLease4HWAddr1();
+}
+
+/// @brief Checks lookups by hardware address.
+TEST_F(CachedLeaseMgrTest, getLease4HWAddr2) {
+    testGetLease4HWAddr2();
+}
+
+/// @brief Checks lookups by client id, hardware address and subnet id.
+TEST_F(CachedLeaseMgrTest, getLease4ClientIdHWAddrSubnetId) {
+    testGetLease4ClientIdHWAddrSubnetId();
+}
+
+/// @brief Checks lookups by hardware address and subnet id.
+TEST_F(CachedLeaseMgrTest, getLease4HWAddrSubnetId) {
+    testGetLease4HWAddrSubnetId();
+}
+
+/// @brief Checks lookups by client id.
+TEST_F(CachedLeaseMgrTest, getLease4ClientId2) {
+    testGetLease4ClientId2();
+}
+
+/// @brief Checks lookups by client id and subnet id.
+TEST_F(CachedLeaseMgrTest, getLease4ClientIdSubnetId) {
+    testGetLease4ClientIdSubnetId();
+}
+
+/// @brief Checks that the IPv4 lease can be updated.
+TEST_F(CachedLeaseMgrTest, updateLease4) {
+    testUpdateLease4();
+}
+
+/// @brief Checks that multiple IPv4 leases can be updated.
+TEST_F(CachedLeaseMgrTest, updateLeases4) {
+    testUpdateLeases4();
+}
+
+/// @brief Checks that multiple IPv4 leases can be deleted.
+TEST_F(CachedLeaseMgrTest, deleteLeases4) {
+    testDeleteLeases4();
+}
+
+/// @brief Checks that multiple IPv4 leases can be stored at once.
+TEST_F(CachedLeaseMgrTest, storeLeases4) {
+    testStoreLeases4();
+}
+
+/// @brief Checks that the expired IPv4 leases are returned.
+TEST_F(CachedLeaseMgrTest, getExpiredLeases4) {
+    testGetExpiredLeases4();
+}
+
+/// @brief Checks that the IPv4 leases are returned in pages.
+TEST_F(CachedLeaseMgrTest, getLeases4Page) {
+    testGetLeases4Page();
+}
+
+/// @brief Checks that the IPv6 leases are returned in pages.
+TEST_F(CachedLeaseMgrTest, getLeases6Page) {
+    reopen(V6);
+    testGetLeases6Page();
+}
+
+/// @brief Checks the asynchronous IPv4 lease lookups.
+TEST_F(CachedLeaseMgrTest, asyncGetLease4) {
+    testAsyncGetLease4();
+}
+
+}; // end of anonymous namespace
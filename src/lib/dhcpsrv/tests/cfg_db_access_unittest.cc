@@ -5,15 +5,19 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <asiolink/io_address.h>
 #include <cc/data.h>
+#include <dhcp/hwaddr.h>
 #include <dhcpsrv/cfg_db_access.h>
 #include <dhcpsrv/host_data_source_factory.h>
 #include <dhcpsrv/host_mgr.h>
+#include <dhcpsrv/lease.h>
 #include <dhcpsrv/lease_mgr.h>
 #include <dhcpsrv/lease_mgr_factory.h>
 #include <dhcpsrv/testutils/mysql_schema.h>
 #include <testutils/test_to_element.h>
 #include <gtest/gtest.h>
+#include <ctime>
 
 using namespace isc;
 using namespace isc::dhcp;
@@ -56,6 +60,18 @@ TEST(CfgDbAccessTest, setLeaseDbAccessString) {
     EXPECT_TRUE(cfg.getLeaseDbAccessString().empty());
 }
 
+// This test verifies that the integer parameters of the lease database
+// string are unparsed as integers.
+TEST(CfgDbAccessTest, unparseIntegerParameters) {
+    CfgDbAccess cfg;
+    ASSERT_NO_THROW(cfg.setLeaseDbAccessString("type=mysql "
+                                                "connection-pool-size=4 "
+                                                "cache-size=1000"));
+    std::string expected = "{ \"type\": \"mysql\", "
+        "\"connection-pool-size\": 4, \"cache-size\": 1000 }";
+    runToElementTest<CfgLeaseDbAccess>(expected, CfgLeaseDbAccess(cfg));
+}
+
 
 // This test verifies that it is possible to set the host database
 // string.
@@ -90,6 +106,50 @@ TEST(CfgDbAccessTest, createLeaseMgr) {
         LeaseMgr& lease_mgr = LeaseMgrFactory::instance();
         EXPECT_EQ("memfile",lease_mgr.getType());
     });
+
+    // The lease manager is kept by the next configuration, so it must be
+    // removed explicitly.
+    LeaseMgrFactory::destroy();
+}
+
+// This test verifies that the lease manager is kept when the lease
+// database configuration doesn't change and it is recreated otherwise.
+TEST(CfgDbAccessTest, keepLeaseMgr) {
+    CfgDbAccess cfg;
+    ASSERT_NO_THROW(cfg.setLeaseDbAccessString("type=memfile persist=false universe=4"));
+    ASSERT_NO_THROW(cfg.createManagers());
+    LeaseMgr* lease_mgr = &LeaseMgrFactory::instance();
+
+    // Store a lease to check that it survives the reconfiguration.
+    uint8_t hwaddr_data[] = { 0, 1, 2, 3, 4, 5 };
+    HWAddrPtr hwaddr(new HWAddr(hwaddr_data, sizeof(hwaddr_data), HTYPE_ETHER));
+    Lease4Ptr lease(new Lease4(asiolink::IOAddress("192.0.2.1"), hwaddr,
+                               ClientIdPtr(), 3600, 0, 0, time(NULL), 1));
+    ASSERT_TRUE(lease_mgr->addLease(lease));
+
+    // The same configuration keeps the lease manager and its leases.
+    CfgDbAccess same_cfg;
+    ASSERT_NO_THROW(same_cfg.setLeaseDbAccessString("type=memfile persist=false universe=4"));
+    ASSERT_NO_THROW(same_cfg.createManagers());
+    EXPECT_EQ(lease_mgr, &LeaseMgrFactory::instance());
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(lease->addr_));
+
+    // Changing the LFC interval is applied to the existing lease manager.
+    CfgDbAccess lfc_cfg;
+    ASSERT_NO_THROW(lfc_cfg.setLeaseDbAccessString("type=memfile persist=false "
+                                                   "universe=4 lfc-interval=0"));
+    ASSERT_NO_THROW(lfc_cfg.createManagers());
+    EXPECT_EQ(lease_mgr, &LeaseMgrFactory::instance());
+    EXPECT_TRUE(LeaseMgrFactory::instance().getLease4(lease->addr_));
+
+    // Other changes require a new lease manager.
+    CfgDbAccess other_cfg;
+    ASSERT_NO_THROW(other_cfg.setLeaseDbAccessString("type=memfile persist=false "
+                                                     "universe=4 cache-size=10"));
+    ASSERT_NO_THROW(other_cfg.createManagers());
+    EXPECT_FALSE(LeaseMgrFactory::instance().getLease4(lease->addr_));
+
+    LeaseMgrFactory::destroy();
 }
 
 // The following tests require MySQL enabled.
@@ -112,6 +112,8 @@ TEST(CfgExpirationTest, defaults) {
               cfg.getMaxReclaimTime());
     EXPECT_EQ(CfgExpiration::DEFAULT_UNWARNED_RECLAIM_CYCLES,
               cfg.getUnwarnedReclaimCycles());
+    EXPECT_EQ(CfgExpiration::DEFAULT_REUSE_QUARANTINE_TIME,
+              cfg.getReuseQuarantineTime());
 }
 
 /// @brief Tests that unparse returns an expected value
@@ -125,6 +127,18 @@ TEST(CfgExpirationTest, unparse) {
         "\"max-reclaim-time\": 250,\n"
         "\"unwarned-reclaim-cycles\": 5 }";
     isc::test::runToElementTest<CfgExpiration>(defaults, cfg);
+
+    // The reuse-quarantine-time is unparsed when it is not the default.
+    cfg.setReuseQuarantineTime(60);
+    std::string quarantine = "{\n"
+        "\"reclaim-timer-wait-time\": 10,\n"
+        "\"flush-reclaimed-timer-wait-time\": 25,\n"
+        "\"hold-reclaimed-time\": 3600,\n"
+        "\"max-reclaim-leases\": 100,\n"
+        "\"max-reclaim-time\": 250,\n"
+        "\"unwarned-reclaim-cycles\": 5,\n"
+        "\"reuse-quarantine-time\": 60 }";
+    isc::test::runToElementTest<CfgExpiration>(quarantine, cfg);
 }
 
 // Test the {get,set}ReclaimTimerWaitTime.
@@ -169,6 +183,13 @@ TEST(CfgExpirationTest, getUnwarnedReclaimCycles) {
                            &CfgExpiration::getUnwarnedReclaimCycles);
 }
 
+// Test the {get,set}ReuseQuarantineTime.
+TEST(CfgExpirationTest, getReuseQuarantineTime) {
+    testAccessModifyUint32(CfgExpiration::LIMIT_REUSE_QUARANTINE_TIME,
+                           &CfgExpiration::setReuseQuarantineTime,
+                           &CfgExpiration::getReuseQuarantineTime);
+}
+
 /// @brief Implements test routines for leases reclamation.
 ///
 /// This class implements two routines called by the @c CfgExpiration object
@@ -641,4 +641,113 @@ TEST_F(CfgOptionTest, unparse) {
     isc::test::runToElementTest<CfgOption>(expected, cfg);
 }
 
+// This test verifies that the revision is incremented when the
+// configuration is modified.
+TEST_F(CfgOptionTest, revision) {
+    CfgOption cfg;
+    uint64_t revision = cfg.getRevision();
+
+    OptionPtr option(new Option(Option::V6, 100, OptionBuffer(4, 1)));
+    ASSERT_NO_THROW(cfg.add(option, false, DHCP6_OPTION_SPACE));
+    EXPECT_GT(cfg.getRevision(), revision);
+    revision = cfg.getRevision();
+
+    // Copying the configuration modifies the destination only.
+    CfgOption cfg_copy;
+    uint64_t copy_revision = cfg_copy.getRevision();
+    ASSERT_NO_THROW(cfg.copyTo(cfg_copy));
+    EXPECT_GT(cfg_copy.getRevision(), copy_revision);
+    EXPECT_EQ(revision, cfg.getRevision());
+
+    ASSERT_NO_THROW(cfg.encapsulate());
+    EXPECT_GT(cfg.getRevision(), revision);
+}
+
+// This test verifies that the options are returned for the requested
+// codes according to the precedence of the configurations.
+TEST(CfgOptionListCacheTest, get) {
+    CfgOptionPtr subnet_cfg(new CfgOption());
+    CfgOptionPtr global_cfg(new CfgOption());
+    OptionPtr subnet_opt(new Option(Option::V4, 5, OptionBuffer(4, 1)));
+    OptionPtr global_opt5(new Option(Option::V4, 5, OptionBuffer(4, 2)));
+    OptionPtr global_opt6(new Option(Option::V4, 6, OptionBuffer(4, 3)));
+    subnet_cfg->add(subnet_opt, false, "dhcp4");
+    global_cfg->add(global_opt5, false, "dhcp4");
+    global_cfg->add(global_opt6, false, "dhcp4");
+
+    CfgOptionList co_list;
+    co_list.push_back(subnet_cfg);
+    co_list.push_back(global_cfg);
+
+    CfgOptionListCache cache;
+    std::vector<uint8_t> codes;
+    codes.push_back(6);
+    codes.push_back(7);
+    codes.push_back(5);
+
+    // The subnet option takes precedence and the option 7 is not
+    // configured.
+    CfgOptionListCache::OptionPtrVector opts = cache.get(co_list, "dhcp4",
+                                                         codes);
+    ASSERT_EQ(2, opts.size());
+    EXPECT_TRUE(opts[0] == global_opt6);
+    EXPECT_TRUE(opts[1] == subnet_opt);
+    EXPECT_EQ(1, cache.getSize());
+
+    // The same result is returned from the cache.
+    opts = cache.get(co_list, "dhcp4", codes);
+    ASSERT_EQ(2, opts.size());
+    EXPECT_TRUE(opts[0] == global_opt6);
+    EXPECT_TRUE(opts[1] == subnet_opt);
+    EXPECT_EQ(1, cache.getSize());
+
+    // A different set of codes creates a new entry.
+    codes.pop_back();
+    opts = cache.get(co_list, "dhcp4", codes);
+    ASSERT_EQ(1, opts.size());
+    EXPECT_TRUE(opts[0] == global_opt6);
+    EXPECT_EQ(2, cache.getSize());
+
+    // Uncached lookup returns the same options.
+    CfgOptionListCache::OptionPtrVector found;
+    CfgOptionListCache::find(co_list, "dhcp4", codes, found);
+    EXPECT_TRUE(opts == found);
+
+    cache.clear();
+    EXPECT_EQ(0, cache.getSize());
+}
+
+// This test verifies that the cached options are looked up again when
+// the configuration is modified.
+TEST(CfgOptionListCacheTest, modified) {
+    CfgOptionPtr cfg(new CfgOption());
+    CfgOptionList co_list;
+    co_list.push_back(cfg);
+
+    CfgOptionListCache cache;
+    std::vector<uint16_t> codes(1, D6O_STATUS_CODE);
+    EXPECT_TRUE(cache.get(co_list, DHCP6_OPTION_SPACE, codes).empty());
+
+    OptionPtr opt(new Option(Option::V6, D6O_STATUS_CODE, OptionBuffer(2, 0)));
+    cfg->add(opt, false, DHCP6_OPTION_SPACE);
+    CfgOptionListCache::OptionPtrVector opts =
+        cache.get(co_list, DHCP6_OPTION_SPACE, codes);
+    ASSERT_EQ(1, opts.size());
+    EXPECT_TRUE(opts[0] == opt);
+}
+
+// This test verifies that the number of cached entries is limited.
+TEST(CfgOptionListCacheTest, maxSize) {
+    EXPECT_THROW(CfgOptionListCache(0), BadValue);
+
+    CfgOptionList co_list;
+    co_list.push_back(CfgOptionPtr(new CfgOption()));
+    CfgOptionListCache cache(2);
+    for (uint8_t code = 1; code <= 3; ++code) {
+        std::vector<uint8_t> codes(1, code);
+        cache.get(co_list, "dhcp4", codes);
+    }
+    EXPECT_EQ(1, cache.getSize());
+}
+
 } // end of anonymous namespace
@@ -5,6 +5,7 @@
 // file, You can obtain one at http://mozilla.org/MPL/2.0/.
 
 #include <config.h>
+#include <cc/data.h>
 #include <dhcp/classify.h>
 #include <dhcp/tests/iface_mgr_test_config.h>
 #include <dhcpsrv/cfg_subnets4.h>
@@ -17,6 +18,7 @@
 
 using namespace isc;
 using namespace isc::asiolink;
+using namespace isc::data;
 using namespace isc::dhcp;
 using namespace isc::dhcp::test;
 using namespace isc::test;
@@ -357,6 +359,36 @@ TEST(CfgSubnets4Test, duplication) {
     EXPECT_THROW(cfg.add(subnet3), isc::dhcp::DuplicateSubnetID);
 }
 
+// Checks that the subnet is returned by its identifier.
+TEST(CfgSubnets4Test, getSubnet) {
+    CfgSubnets4 cfg;
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 123));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.64"), 26, 1, 2, 3, 124));
+    cfg.add(subnet1);
+    cfg.add(subnet2);
+
+    EXPECT_EQ(subnet1, cfg.getSubnet(123));
+    EXPECT_EQ(subnet2, cfg.getSubnet(124));
+    EXPECT_FALSE(cfg.getSubnet(125));
+}
+
+// Checks that the subnet configuration is returned by the subnet identifier.
+TEST(CfgSubnets4Test, getSubnetConfig) {
+    CfgSubnets4 cfg;
+
+    Subnet4Ptr subnet1(new Subnet4(IOAddress("192.0.2.0"), 26, 1, 2, 3, 123));
+    Subnet4Ptr subnet2(new Subnet4(IOAddress("192.0.2.64"), 26, 1, 2, 3, 124));
+    ConstElementPtr config = Element::fromJSON("{ \"id\": 123, "
+                                               "\"subnet\": \"192.0.2.0/26\" }");
+    cfg.add(subnet1, config);
+    cfg.add(subnet2);
+
+    EXPECT_EQ(config, cfg.getSubnetConfig(123));
+    EXPECT_FALSE(cfg.getSubnetConfig(124));
+    EXPECT_FALSE(cfg.getSubnetConfig(125));
+}
+
 // This test checks if the IPv4 subnet can be selected based on the IPv6 address.
 TEST(CfgSubnets4Test, 4o6subnetMatchByAddress) {
     CfgSubnets4 cfg;
@@ -622,6 +622,14 @@ TEST_F(CqlLeaseMgrTest, getExpiredLeases4) {
     testCqlGetExpiredLeases4();
 }
 
+/// @brief Check that the expired DHCPv4 leases can be retrieved in slices.
+///
+/// This test walks through the expired leases in slices following the
+/// last returned lease and checks that each lease is returned once.
+TEST_F(CqlLeaseMgrTest, getNextExpiredLeases4) {
+    testGetNextExpiredLeases4();
+}
+
 /// @brief Check that the expired DHCPv6 leases can be retrieved.
 ///
 /// This test adds a number of leases to the lease database and marks
@@ -633,6 +641,14 @@ TEST_F(CqlLeaseMgrTest, getExpiredLeases6) {
     testCqlGetExpiredLeases6();
 }
 
+/// @brief Check that the expired DHCPv6 leases can be retrieved in slices.
+///
+/// This test walks through the expired leases in slices following the
+/// last returned lease and checks that each lease is returned once.
+TEST_F(CqlLeaseMgrTest, getNextExpiredLeases6) {
+    testGetNextExpiredLeases6();
+}
+
 /// @brief Check that expired reclaimed DHCPv6 leases are removed.
 TEST_F(CqlLeaseMgrTest, deleteExpiredReclaimedLeases6) {
     testDeleteExpiredReclaimedLeases6();
@@ -643,4 +659,19 @@ TEST_F(CqlLeaseMgrTest, deleteExpiredReclaimedLeases4) {
     testDeleteExpiredReclaimedLeases4();
 }
 
+/// @brief Check that multiple IPv4 leases can be updated at once.
+TEST_F(CqlLeaseMgrTest, updateLeases4) {
+    testUpdateLeases4();
+}
+
+/// @brief Check that multiple IPv4 leases can be deleted at once.
+TEST_F(CqlLeaseMgrTest, deleteLeases4) {
+    testDeleteLeases4();
+}
+
+/// @brief Check that multiple IPv4 leases can be stored at once.
+TEST_F(CqlLeaseMgrTest, storeLeases4) {
+    testStoreLeases4();
+}
+
 }; // Of anonymous namespace
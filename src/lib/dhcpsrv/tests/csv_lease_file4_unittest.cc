@@ -1,4 +1,4 @@
-// Copyright (C) 2014-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2014-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -238,6 +238,38 @@ TEST_F(CSVLeaseFile4Test, recreate) {
               io_.readFile());
 }
 
+// This test checks that multiple leases are written with a single call.
+TEST_F(CSVLeaseFile4Test, appendCollection) {
+    CSVLeaseFile4 lf(filename_);
+    ASSERT_NO_THROW(lf.recreate());
+
+    Lease4Collection leases;
+    leases.push_back(Lease4Ptr(new Lease4(IOAddress("192.0.3.2"), hwaddr0_,
+                                          NULL, 0, 200, 50, 80, 0, 8, true,
+                                          true, "host.example.com")));
+    leases.push_back(Lease4Ptr(new Lease4(IOAddress("192.0.3.10"), hwaddr1_,
+                                          CLIENTID, sizeof(CLIENTID),
+                                          100, 60, 90, 0, 7)));
+    ASSERT_NO_THROW(lf.append(leases));
+    checkStats(lf, 0, 0, 0, 2, 2, 0);
+
+    // None of the leases is written if any of them lacks the hardware
+    // address.
+    Lease4Collection invalid(leases);
+    invalid.push_back(Lease4Ptr(new Lease4(*leases[0])));
+    invalid.back()->hwaddr_.reset();
+    EXPECT_THROW(lf.append(invalid), BadValue);
+    checkStats(lf, 0, 0, 0, 5, 2, 3);
+
+    lf.close();
+    EXPECT_EQ("address,hwaddr,client_id,valid_lifetime,expire,subnet_id,"
+              "fqdn_fwd,fqdn_rev,hostname,state\n"
+              "192.0.3.2,00:01:02:03:04:05,,200,200,8,1,1,host.example.com,0\n"
+              "192.0.3.10,0d:0e:0a:0d:0b:0e:0e:0f,01:02:03:04,100,100,7,0,"
+              "0,,0\n",
+              io_.readFile());
+}
+
 // Verifies that a schema 1.0 file with records from
 // schema 1.0 and 2.0 loads correctly.
 TEST_F(CSVLeaseFile4Test, mixedSchemaload) {
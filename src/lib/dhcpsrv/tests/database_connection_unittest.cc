@@ -28,6 +28,29 @@ TEST(DatabaseConnectionTest, getParameter) {
     EXPECT_THROW(datasrc.getParameter("param3"), isc::BadValue);
 }
 
+// This test checks that the connection pool size is read from the
+// parameters and validated.
+TEST(DatabaseConnectionTest, configuredPoolSize) {
+    DatabaseConnection::ParameterMap pmap;
+    // A single connection is used by default.
+    EXPECT_EQ(1, DatabaseConnection(pmap).configuredPoolSize());
+
+    pmap["connection-pool-size"] = "8";
+    EXPECT_EQ(8, DatabaseConnection(pmap).configuredPoolSize());
+
+    pmap["connection-pool-size"] = "0";
+    EXPECT_THROW(DatabaseConnection(pmap).configuredPoolSize(),
+                 DbInvalidPoolSize);
+
+    pmap["connection-pool-size"] = "-1";
+    EXPECT_THROW(DatabaseConnection(pmap).configuredPoolSize(),
+                 DbInvalidPoolSize);
+
+    pmap["connection-pool-size"] = "many";
+    EXPECT_THROW(DatabaseConnection(pmap).configuredPoolSize(),
+                 DbInvalidPoolSize);
+}
+
 // This test checks that a database access string can be parsed correctly.
 TEST(DatabaseConnectionTest, parse) {
 
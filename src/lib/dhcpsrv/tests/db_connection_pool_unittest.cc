@@ -0,0 +1,169 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <dhcpsrv/db_connection_pool.h>
+#include <exceptions/exceptions.h>
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <gtest/gtest.h>
+
+using namespace isc;
+using namespace isc::dhcp;
+
+namespace {
+
+/// @brief Connection used in the tests.
+struct TestConnection {
+    /// @brief Constructor.
+    ///
+    /// @param id Connection identifier.
+    TestConnection(const int id)
+        : id_(id), alive_(true) {
+    }
+
+    /// @brief Connection identifier.
+    int id_;
+
+    /// @brief Indicates if the connection passes validation.
+    bool alive_;
+};
+
+/// @brief Pool of test connections.
+typedef DbConnectionPool<TestConnection> TestPool;
+
+/// @brief Test fixture class for @c DbConnectionPool.
+class DbConnectionPoolTest : public ::testing::Test {
+public:
+
+    /// @brief Constructor.
+    DbConnectionPoolTest()
+        : created_(0), fail_open_(false) {
+    }
+
+    /// @brief Creates the pool of the specified size.
+    ///
+    /// @param max_size Maximum number of connections.
+    TestPool* createPool(const size_t max_size) {
+        return (new TestPool(boost::bind(&DbConnectionPoolTest::create, this),
+                             &DbConnectionPoolTest::check, max_size));
+    }
+
+    /// @brief Connection factory.
+    TestPool::ConnectionPtr create() {
+        if (fail_open_) {
+            isc_throw(DbOpenError, "unable to open connection");
+        }
+        return (TestPool::ConnectionPtr(new TestConnection(++created_)));
+    }
+
+    /// @brief Connection validator.
+    static bool check(TestConnection& conn) {
+        return (conn.alive_);
+    }
+
+    /// @brief Number of connections created by the factory.
+    int created_;
+
+    /// @brief Indicates if the factory should fail.
+    bool fail_open_;
+};
+
+// Checks that the pool can't be created with invalid parameters.
+TEST_F(DbConnectionPoolTest, invalidParameters) {
+    EXPECT_THROW(TestPool(TestPool::Factory(), TestPool::Validator(), 1),
+                 BadValue);
+    EXPECT_THROW(createPool(0), BadValue);
+}
+
+// Checks that the connections are created on demand and reused when
+// returned to the pool.
+TEST_F(DbConnectionPoolTest, acquireRelease) {
+    boost::scoped_ptr<TestPool> pool(createPool(2));
+    EXPECT_EQ(0, pool->getSize());
+
+    TestPool::ConnectionPtr conn1 = pool->acquire();
+    TestPool::ConnectionPtr conn2 = pool->acquire();
+    ASSERT_TRUE(conn1);
+    ASSERT_TRUE(conn2);
+    EXPECT_NE(conn1->id_, conn2->id_);
+    EXPECT_EQ(2, pool->getSize());
+    EXPECT_EQ(0, pool->getIdleCount());
+
+    pool->release(conn1);
+    EXPECT_EQ(1, pool->getIdleCount());
+
+    // The idle connection should be handed out rather than a new one.
+    TestPool::ConnectionPtr conn3 = pool->acquire();
+    EXPECT_EQ(conn1, conn3);
+    EXPECT_EQ(2, created_);
+}
+
+// Checks that the handle returns the connection to the pool.
+TEST_F(DbConnectionPoolTest, handle) {
+    boost::scoped_ptr<TestPool> pool(createPool(1));
+    {
+        TestPool::Handle conn(*pool);
+        EXPECT_EQ(1, conn->id_);
+        EXPECT_EQ(0, pool->getIdleCount());
+    }
+    EXPECT_EQ(1, pool->getIdleCount());
+
+    // Invalidated connection should be destroyed.
+    {
+        TestPool::Handle conn(*pool);
+        EXPECT_EQ(1, (*conn).id_);
+        conn.invalidate();
+    }
+    EXPECT_EQ(0, pool->getIdleCount());
+    EXPECT_EQ(0, pool->getSize());
+
+    TestPool::Handle conn(*pool);
+    EXPECT_EQ(2, conn->id_);
+}
+
+// Checks that the broken connection is replaced with a new one.
+TEST_F(DbConnectionPoolTest, reconnect) {
+    boost::scoped_ptr<TestPool> pool(createPool(1));
+    TestPool::ConnectionPtr conn = pool->acquire();
+    conn->alive_ = false;
+    pool->release(conn);
+
+    conn = pool->acquire();
+    ASSERT_TRUE(conn);
+    EXPECT_EQ(2, conn->id_);
+    EXPECT_EQ(1, pool->getSize());
+}
+
+// Checks that the failure to open a connection doesn't consume the slot.
+TEST_F(DbConnectionPoolTest, openFailure) {
+    boost::scoped_ptr<TestPool> pool(createPool(1));
+    fail_open_ = true;
+    EXPECT_THROW(pool->acquire(), DbOpenError);
+    EXPECT_EQ(0, pool->getSize());
+
+    fail_open_ = false;
+    TestPool::ConnectionPtr conn;
+    ASSERT_NO_THROW(conn = pool->acquire());
+    EXPECT_EQ(1, pool->getSize());
+}
+
+// Checks that clearing the pool destroys the idle connections only.
+TEST_F(DbConnectionPoolTest, clear) {
+    boost::scoped_ptr<TestPool> pool(createPool(2));
+    TestPool::ConnectionPtr conn1 = pool->acquire();
+    TestPool::ConnectionPtr conn2 = pool->acquire();
+    pool->release(conn2);
+
+    pool->clear();
+    EXPECT_EQ(1, pool->getSize());
+    EXPECT_EQ(0, pool->getIdleCount());
+
+    pool->release(conn1);
+    EXPECT_EQ(1, pool->getIdleCount());
+}
+
+}
@@ -179,6 +179,8 @@ private:
          return ((parameter != "persist") && (parameter != "lfc-interval") &&
                  (parameter != "connect-timeout") &&
                  (parameter != "port") &&
+                 (parameter != "cache-size") &&
+                 (parameter != "connection-pool-size") &&
                  (parameter != "readonly"));
     }
 
@@ -353,6 +355,46 @@ TEST_F(DbAccessParserTest, largeLFCInterval) {
     EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
 }
 
+// This test checks that the parser accepts the valid value of the
+// cache-size parameter.
+TEST_F(DbAccessParserTest, validCacheSize) {
+    const char* config[] = {"type", "mysql",
+                            "host", "erewhon",
+                            "user", "kea",
+                            "password", "keapassword",
+                            "name", "keatest",
+                            "cache-size", "10000",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid cache size", parser.getDbAccessParameters(),
+                      config);
+}
+
+// This test checks that the parser rejects the negative value of the
+// cache-size parameter.
+TEST_F(DbAccessParserTest, negativeCacheSize) {
+    const char* config[] = {"type", "mysql",
+                            "host", "erewhon",
+                            "user", "kea",
+                            "password", "keapassword",
+                            "name", "keatest",
+                            "cache-size", "-1",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
 // This test checks that the parser accepts the valid value of the
 // timeout parameter.
 TEST_F(DbAccessParserTest, validTimeout) {
@@ -453,6 +495,48 @@ TEST_F(DbAccessParserTest, largePort) {
     EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
 }
 
+// This test checks that the parser accepts the valid value of the
+// connection pool size.
+TEST_F(DbAccessParserTest, validConnectionPoolSize) {
+    const char* config[] = {"type", "mysql",
+                            "name", "keatest",
+                            "connection-pool-size", "8",
+                            NULL};
+
+    string json_config = toJson(config);
+    ConstElementPtr json_elements = Element::fromJSON(json_config);
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_NO_THROW(parser.parse(json_elements));
+    checkAccessString("Valid connection pool size",
+                      parser.getDbAccessParameters(), config);
+}
+
+// This test checks that the parser rejects the connection pool size
+// of 0 and the value greater than the max uint16_t.
+TEST_F(DbAccessParserTest, invalidConnectionPoolSize) {
+    const char* zero_config[] = {"type", "mysql",
+                                 "name", "keatest",
+                                 "connection-pool-size", "0",
+                                 NULL};
+
+    ConstElementPtr json_elements = Element::fromJSON(toJson(zero_config));
+    EXPECT_TRUE(json_elements);
+
+    TestDbAccessParser parser(DbAccessParser::LEASE_DB);
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+
+    const char* large_config[] = {"type", "mysql",
+                                  "name", "keatest",
+                                  "connection-pool-size", "65536",
+                                  NULL};
+
+    json_elements = Element::fromJSON(toJson(large_config));
+    EXPECT_TRUE(json_elements);
+    EXPECT_THROW(parser.parse(json_elements), DhcpConfigError);
+}
+
 // Check that the parser works with a valid MySQL configuration
 TEST_F(DbAccessParserTest, validTypeMysql) {
     const char* config[] = {"type",     "mysql",
@@ -150,6 +150,7 @@ TEST_F(ExpirationConfigParserTest, allParameters) {
     addParam("max-reclaim-leases", 50);
     addParam("max-reclaim-time", 100);
     addParam("unwarned-reclaim-cycles", 10);
+    addParam("reuse-quarantine-time", 30);
 
     CfgExpirationPtr cfg;
     ASSERT_NO_THROW(cfg = renderConfig());
@@ -159,6 +160,7 @@ TEST_F(ExpirationConfigParserTest, allParameters) {
     EXPECT_EQ(50, cfg->getMaxReclaimLeases());
     EXPECT_EQ(100, cfg->getMaxReclaimTime());
     EXPECT_EQ(10, cfg->getUnwarnedReclaimCycles());
+    EXPECT_EQ(30, cfg->getReuseQuarantineTime());
 }
 
 // This test verifies that default values are used if no parameter is
@@ -235,6 +237,8 @@ TEST_F(ExpirationConfigParserTest, outOfRangeValues) {
                    CfgExpiration::LIMIT_MAX_RECLAIM_TIME);
     testOutOfRange("unwarned-reclaim-cycles",
                    CfgExpiration::LIMIT_UNWARNED_RECLAIM_CYCLES);
+    testOutOfRange("reuse-quarantine-time",
+                   CfgExpiration::LIMIT_REUSE_QUARANTINE_TIME);
 }
 
 // This test verifies that it is not allowed to specify a value as
@@ -7,20 +7,85 @@
 #include <config.h>
 
 #include <asiolink/io_address.h>
+#include <dhcp/iface_mgr.h>
 #include <dhcpsrv/cfgmgr.h>
 #include <dhcpsrv/database_connection.h>
 #include <dhcpsrv/tests/generic_lease_mgr_unittest.h>
 #include <dhcpsrv/tests/test_utils.h>
 #include <stats/stats_mgr.h>
+#include <util/threads/thread.h>
 
+#include <boost/bind.hpp>
 #include <boost/foreach.hpp>
+#include <boost/shared_ptr.hpp>
 
 #include <gtest/gtest.h>
 
+#include <limits>
+#include <set>
 #include <sstream>
 
 using namespace std;
 using namespace isc::asiolink;
+using isc::util::thread::Thread;
+
+namespace {
+
+/// @brief Handler recording the results of the asynchronous lease lookups.
+///
+/// @param [out] leases Collection to which the lease is appended.
+/// @param [out] errors Collection to which the error is appended.
+/// @param lease Lease returned by the lookup.
+/// @param error Error returned by the lookup.
+void
+asyncLease4Handler(isc::dhcp::Lease4Collection& leases,
+                   std::vector<std::string>& errors,
+                   const isc::dhcp::Lease4Ptr& lease,
+                   const std::string& error) {
+    leases.push_back(lease);
+    errors.push_back(error);
+}
+
+/// @brief Looks up the IPv4 leases repeatedly.
+///
+/// This function is executed by the threads started by the concurrent
+/// lookup test.
+///
+/// @param lease_mgr Lease manager used for the lookups.
+/// @param leases Leases to be looked up.
+/// @param thread_init Function invoked before the first lookup.
+/// @param thread_end Function invoked after the last lookup.
+/// @param [out] mismatches Number of lookups which didn't return the
+/// expected lease.
+void
+lookupLeases4(const isc::dhcp::LeaseMgr* lease_mgr,
+              const std::vector<isc::dhcp::Lease4Ptr>& leases,
+              const boost::function<void ()>& thread_init,
+              const boost::function<void ()>& thread_end,
+              size_t& mismatches) {
+    if (thread_init) {
+        thread_init();
+    }
+    for (int pass = 0; pass < 20; ++pass) {
+        for (size_t i = 0; i < leases.size(); ++i) {
+            try {
+                isc::dhcp::Lease4Ptr lease =
+                    lease_mgr->getLease4(leases[i]->addr_);
+                if (!lease || (lease->valid_lft_ != leases[i]->valid_lft_) ||
+                    (lease->subnet_id_ != leases[i]->subnet_id_)) {
+                    ++mismatches;
+                }
+            } catch (...) {
+                ++mismatches;
+            }
+        }
+    }
+    if (thread_end) {
+        thread_end();
+    }
+}
+
+}
 
 namespace isc {
 namespace dhcp {
@@ -1498,6 +1563,185 @@ GenericLeaseMgrTest::testUpdateLease4() {
     EXPECT_THROW(lmptr_->updateLease4(leases[2]), isc::dhcp::NoSuchLease);
 }
 
+void
+GenericLeaseMgrTest::testAsyncGetLease4() {
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_TRUE(lmptr_->addLease(leases[1]));
+
+    Lease4Collection found;
+    std::vector<std::string> errors;
+    Lease4Handler handler = boost::bind(&asyncLease4Handler, boost::ref(found),
+                                        boost::ref(errors), _1, _2);
+
+    // Issue several lookups, including one for non-existing lease.
+    lmptr_->asyncGetLease4(ioaddress4_[1], handler);
+    lmptr_->asyncGetLease4(ioaddress4_[2], handler);
+    lmptr_->asyncGetLease4(*leases[1]->hwaddr_, leases[1]->subnet_id_, handler);
+    lmptr_->asyncGetLease4(*leases[1]->client_id_, leases[1]->subnet_id_,
+                           handler);
+
+    // Backends supporting asynchronous lookups invoke the handlers from
+    // within the receive loop, so run it until all lookups complete.
+    for (int i = 0; (i < 100) && (lmptr_->getAsyncPending() > 0); ++i) {
+        IfaceMgr::instance().receive4(0, 100000);
+    }
+    EXPECT_EQ(0, lmptr_->getAsyncPending());
+
+    // The handlers should have been invoked in order.
+    ASSERT_EQ(4, found.size());
+    ASSERT_EQ(4, errors.size());
+    for (size_t i = 0; i < errors.size(); ++i) {
+        EXPECT_TRUE(errors[i].empty()) << errors[i];
+    }
+    ASSERT_TRUE(found[0]);
+    detailCompareLease(leases[1], found[0]);
+    EXPECT_FALSE(found[1]);
+    ASSERT_TRUE(found[2]);
+    detailCompareLease(leases[1], found[2]);
+    ASSERT_TRUE(found[3]);
+    detailCompareLease(leases[1], found[3]);
+}
+
+void
+GenericLeaseMgrTest::testConcurrentGetLease4(const boost::function<void ()>&
+                                             thread_init,
+                                             const boost::function<void ()>&
+                                             thread_end) {
+    vector<Lease4Ptr> leases = createLeases4();
+    for (size_t i = 0; i < leases.size(); ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Each thread looks up all leases several times. The backends using
+    // the connection pool execute the concurrent lookups using separate
+    // connections.
+    std::vector<size_t> mismatches(4, 0);
+    std::vector<boost::shared_ptr<Thread> > threads;
+    for (size_t i = 0; i < mismatches.size(); ++i) {
+        threads.push_back(boost::shared_ptr<Thread>
+                          (new Thread(boost::bind(&lookupLeases4, lmptr_,
+                                                  boost::cref(leases),
+                                                  thread_init, thread_end,
+                                                  boost::ref(mismatches[i])))));
+    }
+    for (size_t i = 0; i < threads.size(); ++i) {
+        threads[i]->wait();
+        EXPECT_EQ(0, mismatches[i]) << "thread " << i;
+    }
+}
+
+void
+GenericLeaseMgrTest::testUpdateLeases4() {
+    // Get the leases to be used for the test and add them to the database.
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_GE(leases.size(), 3);
+    for (size_t i = 0; i < leases.size(); ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Updating an empty collection is a no-op.
+    ASSERT_NO_THROW(lmptr_->updateLeases4(Lease4Collection()));
+
+    // Modify the first three leases and update them at once.
+    Lease4Collection updated;
+    for (size_t i = 0; i < 3; ++i) {
+        leases[i]->valid_lft_ *= 2;
+        leases[i]->hostname_ = "modified.hostname.";
+        leases[i]->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+        updated.push_back(leases[i]);
+    }
+    ASSERT_NO_THROW(lmptr_->updateLeases4(updated));
+
+    // Check that all leases have been updated.
+    for (size_t i = 0; i < 3; ++i) {
+        Lease4Ptr l_returned = lmptr_->getLease4(ioaddress4_[i]);
+        ASSERT_TRUE(l_returned);
+        detailCompareLease(leases[i], l_returned);
+    }
+
+    // Try updating a collection including a lease not in the database.
+    lmptr_->deleteLease(ioaddress4_[2]);
+    EXPECT_THROW(lmptr_->updateLeases4(updated), isc::dhcp::NoSuchLease);
+}
+
+void
+GenericLeaseMgrTest::testStoreLeases4() {
+    // Get the leases to be used for the test and add the first two of
+    // them to the database.
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_GE(leases.size(), 4);
+    for (size_t i = 0; i < 2; ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Storing an empty collection is a no-op.
+    Lease4Collection replaced;
+    ASSERT_NO_THROW(replaced = lmptr_->storeLeases4(Lease4Collection()));
+    EXPECT_TRUE(replaced.empty());
+
+    // Store the modified second lease along with two new leases.
+    Lease4Ptr old_lease(new Lease4(*leases[1]));
+    leases[1]->valid_lft_ *= 2;
+    leases[1]->hostname_ = "modified.hostname.";
+    leases[1]->state_ = Lease::STATE_DECLINED;
+    Lease4Collection stored;
+    for (size_t i = 1; i < 4; ++i) {
+        stored.push_back(leases[i]);
+    }
+    ASSERT_NO_THROW(replaced = lmptr_->storeLeases4(stored));
+
+    // Only the second lease has been replaced.
+    ASSERT_EQ(1, replaced.size());
+    detailCompareLease(old_lease, replaced[0]);
+
+    // Check that all leases are in the database.
+    for (size_t i = 0; i < 4; ++i) {
+        Lease4Ptr l_returned = lmptr_->getLease4(ioaddress4_[i]);
+        ASSERT_TRUE(l_returned);
+        detailCompareLease(leases[i], l_returned);
+    }
+}
+
+void
+GenericLeaseMgrTest::testDeleteLeases4() {
+    // Get the leases to be used for the test and add them to the database.
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_GE(leases.size(), 4);
+    for (size_t i = 0; i < leases.size(); ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Deleting an empty collection is a no-op.
+    uint64_t deleted_num = 1;
+    ASSERT_NO_THROW(
+        deleted_num = lmptr_->deleteLeases4(std::vector<IOAddress>())
+    );
+    EXPECT_EQ(0, deleted_num);
+
+    // Delete first three leases at once.
+    std::vector<IOAddress> addrs(ioaddress4_.begin(), ioaddress4_.begin() + 3);
+    ASSERT_NO_THROW(deleted_num = lmptr_->deleteLeases4(addrs));
+    EXPECT_EQ(3, deleted_num);
+
+    for (size_t i = 0; i < leases.size(); ++i) {
+        Lease4Ptr lease = lmptr_->getLease4(ioaddress4_[i]);
+        if (i < 3) {
+            EXPECT_FALSE(lease) << "lease " << ioaddress4_[i] << " should"
+                " have been deleted";
+        } else {
+            EXPECT_TRUE(lease) << "lease " << ioaddress4_[i] << " shouldn't"
+                " have been deleted";
+        }
+    }
+
+    // Deleting leases which no longer exist should return the number of
+    // actually deleted leases.
+    addrs.push_back(ioaddress4_[3]);
+    ASSERT_NO_THROW(deleted_num = lmptr_->deleteLeases4(addrs));
+    EXPECT_EQ(1, deleted_num);
+    EXPECT_FALSE(lmptr_->getLease4(ioaddress4_[3]));
+}
+
 void
 GenericLeaseMgrTest::testUpdateLease6() {
     // Get the leases to be used for the test.
@@ -1775,6 +2019,125 @@ GenericLeaseMgrTest::testGetExpiredLeases4() {
     }
 }
 
+void
+GenericLeaseMgrTest::testGetLeases4Page() {
+    // Get the leases to be used for the test and add them to the database.
+    vector<Lease4Ptr> leases = createLeases4();
+    ASSERT_EQ(8, leases.size());
+    for (size_t i = 0; i < leases.size(); ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    const IOAddress start("0.0.0.0");
+    const IOAddress end("255.255.255.255");
+
+    // Walk through all leases in pages of 3 leases.
+    Lease4Collection page;
+    ASSERT_NO_THROW(page = lmptr_->getLeases4Page(start, end, 0, 3));
+    ASSERT_EQ(3, page.size());
+    for (size_t i = 0; i < page.size(); ++i) {
+        EXPECT_EQ(ioaddress4_[i], page[i]->addr_);
+    }
+    detailCompareLease(leases[0], page[0]);
+
+    ASSERT_NO_THROW(page = lmptr_->getLeases4Page(page.back()->addr_, end, 0, 3));
+    ASSERT_EQ(3, page.size());
+    for (size_t i = 0; i < page.size(); ++i) {
+        EXPECT_EQ(ioaddress4_[i + 3], page[i]->addr_);
+    }
+
+    ASSERT_NO_THROW(page = lmptr_->getLeases4Page(page.back()->addr_, end, 0, 3));
+    ASSERT_EQ(2, page.size());
+    EXPECT_EQ(ioaddress4_[6], page[0]->addr_);
+    EXPECT_EQ(ioaddress4_[7], page[1]->addr_);
+
+    ASSERT_NO_THROW(page = lmptr_->getLeases4Page(page.back()->addr_, end, 0, 3));
+    EXPECT_TRUE(page.empty());
+
+    // The leases above the upper bound are not returned.
+    ASSERT_NO_THROW(page = lmptr_->getLeases4Page(ioaddress4_[2], ioaddress4_[4],
+                                                  0, 10));
+    ASSERT_EQ(2, page.size());
+    EXPECT_EQ(ioaddress4_[3], page[0]->addr_);
+    EXPECT_EQ(ioaddress4_[4], page[1]->addr_);
+
+    // Only the leases 1 and 2 belong to the subnet 73.
+    ASSERT_NO_THROW(page = lmptr_->getLeases4Page(start, end, 73, 10));
+    ASSERT_EQ(2, page.size());
+    EXPECT_EQ(ioaddress4_[1], page[0]->addr_);
+    EXPECT_EQ(ioaddress4_[2], page[1]->addr_);
+
+    ASSERT_NO_THROW(page = lmptr_->getLeases4Page(ioaddress4_[1], end, 73, 1));
+    ASSERT_EQ(1, page.size());
+    EXPECT_EQ(ioaddress4_[2], page[0]->addr_);
+
+    // There are no leases in the subnet 1.
+    ASSERT_NO_THROW(page = lmptr_->getLeases4Page(start, end, 1, 10));
+    EXPECT_TRUE(page.empty());
+
+    // The page size must be positive and the bounds must be IPv4 addresses.
+    EXPECT_THROW(lmptr_->getLeases4Page(start, end, 0, 0), BadValue);
+    EXPECT_THROW(lmptr_->getLeases4Page(IOAddress("::"), end, 0, 10), BadValue);
+    EXPECT_THROW(lmptr_->getLeases4Page(start, IOAddress("::1"), 0, 10),
+                 BadValue);
+}
+
+void
+GenericLeaseMgrTest::testGetLeases6Page() {
+    // Get the leases to be used for the test and add them to the database.
+    // The test addresses have the same numeric and textual order, so the
+    // test applies to all backends.
+    vector<Lease6Ptr> leases = createLeases6();
+    ASSERT_EQ(8, leases.size());
+    for (size_t i = 0; i < leases.size(); ++i) {
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    const IOAddress start("::");
+
+    // Walk through all leases in pages of 3 leases.
+    Lease6Collection page;
+    ASSERT_NO_THROW(page = lmptr_->getLeases6Page(start, 0, 3));
+    ASSERT_EQ(3, page.size());
+    for (size_t i = 0; i < page.size(); ++i) {
+        EXPECT_EQ(ioaddress6_[i], page[i]->addr_);
+    }
+    detailCompareLease(leases[0], page[0]);
+
+    ASSERT_NO_THROW(page = lmptr_->getLeases6Page(page.back()->addr_, 0, 3));
+    ASSERT_EQ(3, page.size());
+    for (size_t i = 0; i < page.size(); ++i) {
+        EXPECT_EQ(ioaddress6_[i + 3], page[i]->addr_);
+    }
+
+    ASSERT_NO_THROW(page = lmptr_->getLeases6Page(page.back()->addr_, 0, 3));
+    ASSERT_EQ(2, page.size());
+    EXPECT_EQ(ioaddress6_[6], page[0]->addr_);
+    EXPECT_EQ(ioaddress6_[7], page[1]->addr_);
+
+    ASSERT_NO_THROW(page = lmptr_->getLeases6Page(page.back()->addr_, 0, 3));
+    EXPECT_TRUE(page.empty());
+
+    // Only the leases 1 and 2 belong to the subnet 73.
+    ASSERT_NO_THROW(page = lmptr_->getLeases6Page(start, 73, 10));
+    ASSERT_EQ(2, page.size());
+    EXPECT_EQ(ioaddress6_[1], page[0]->addr_);
+    EXPECT_EQ(ioaddress6_[2], page[1]->addr_);
+
+    ASSERT_NO_THROW(page = lmptr_->getLeases6Page(ioaddress6_[1], 73, 1));
+    ASSERT_EQ(1, page.size());
+    EXPECT_EQ(ioaddress6_[2], page[0]->addr_);
+
+    // There are no leases in the subnet 1.
+    ASSERT_NO_THROW(page = lmptr_->getLeases6Page(start, 1, 10));
+    EXPECT_TRUE(page.empty());
+
+    // The page size must be positive and the bound must be IPv6 address.
+    EXPECT_THROW(lmptr_->getLeases6Page(start, 0, 0), BadValue);
+    EXPECT_THROW(lmptr_->getLeases6Page(IOAddress("0.0.0.0"), 0, 10),
+                 BadValue);
+}
+
 void
 GenericLeaseMgrTest::testGetExpiredLeases6() {
     // Get the leases to be used for the test.
@@ -1895,6 +2258,120 @@ GenericLeaseMgrTest::testGetExpiredLeases6() {
     }
 }
 
+void
+GenericLeaseMgrTest::testGetNextExpiredLeases4() {
+    // Get the leases to be used for the test.
+    vector<Lease4Ptr> leases = createLeases4();
+    // Make sure we have at least 6 leases there.
+    ASSERT_GE(leases.size(), 6);
+
+    // Expire all leases. The leases expire in pairs at the same time, so
+    // as the leases expiring at the same time are ordered by address.
+    time_t current_time = time(NULL);
+    for (size_t i = 0; i < leases.size(); ++i) {
+        leases[i]->cltt_ = current_time - leases[i]->valid_lft_ - 100 + i / 2;
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Reclaim the last lease.
+    leases.back()->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(leases.back()));
+
+    // Walk through the expired leases in slices of 2 leases. The leases
+    // are not modified, so as they remain expired.
+    Lease4Collection expired_leases;
+    int64_t last_expire = std::numeric_limits<int64_t>::min();
+    IOAddress last_address = IOAddress::IPV4_ZERO_ADDRESS();
+    for (size_t slices = 0; slices < leases.size(); ++slices) {
+        Lease4Collection slice;
+        ASSERT_NO_THROW(lmptr_->getNextExpiredLeases4(slice, 2, last_expire,
+                                                       last_address));
+        ASSERT_LE(slice.size(), 2);
+        if (slice.empty()) {
+            break;
+        }
+        expired_leases.insert(expired_leases.end(), slice.begin(), slice.end());
+        last_expire = slice.back()->getExpirationTime();
+        last_address = slice.back()->addr_;
+    }
+
+    // Each not reclaimed lease should have been returned exactly once and
+    // the leases should be ordered by the expiration time.
+    ASSERT_EQ(leases.size() - 1, expired_leases.size());
+    std::set<IOAddress> addresses;
+    for (size_t i = 0; i < expired_leases.size(); ++i) {
+        EXPECT_TRUE(addresses.insert(expired_leases[i]->addr_).second);
+        EXPECT_NE(leases.back()->addr_, expired_leases[i]->addr_);
+        if (i > 0) {
+            EXPECT_LE(expired_leases[i - 1]->getExpirationTime(),
+                      expired_leases[i]->getExpirationTime());
+        }
+    }
+
+    // There should be no leases after the last lease returned.
+    Lease4Collection next_leases;
+    ASSERT_NO_THROW(lmptr_->getNextExpiredLeases4(next_leases, 0, last_expire,
+                                                   last_address));
+    EXPECT_TRUE(next_leases.empty());
+}
+
+void
+GenericLeaseMgrTest::testGetNextExpiredLeases6() {
+    // Get the leases to be used for the test.
+    vector<Lease6Ptr> leases = createLeases6();
+    // Make sure we have at least 6 leases there.
+    ASSERT_GE(leases.size(), 6);
+
+    // Expire all leases. The leases expire in pairs at the same time, so
+    // as the leases expiring at the same time are ordered by address.
+    time_t current_time = time(NULL);
+    for (size_t i = 0; i < leases.size(); ++i) {
+        leases[i]->cltt_ = current_time - leases[i]->valid_lft_ - 100 + i / 2;
+        ASSERT_TRUE(lmptr_->addLease(leases[i]));
+    }
+
+    // Reclaim the last lease.
+    leases.back()->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    ASSERT_NO_THROW(lmptr_->updateLease6(leases.back()));
+
+    // Walk through the expired leases in slices of 2 leases. The leases
+    // are not modified, so as they remain expired.
+    Lease6Collection expired_leases;
+    int64_t last_expire = std::numeric_limits<int64_t>::min();
+    IOAddress last_address = IOAddress::IPV6_ZERO_ADDRESS();
+    for (size_t slices = 0; slices < leases.size(); ++slices) {
+        Lease6Collection slice;
+        ASSERT_NO_THROW(lmptr_->getNextExpiredLeases6(slice, 2, last_expire,
+                                                       last_address));
+        ASSERT_LE(slice.size(), 2);
+        if (slice.empty()) {
+            break;
+        }
+        expired_leases.insert(expired_leases.end(), slice.begin(), slice.end());
+        last_expire = slice.back()->getExpirationTime();
+        last_address = slice.back()->addr_;
+    }
+
+    // Each not reclaimed lease should have been returned exactly once and
+    // the leases should be ordered by the expiration time.
+    ASSERT_EQ(leases.size() - 1, expired_leases.size());
+    std::set<IOAddress> addresses;
+    for (size_t i = 0; i < expired_leases.size(); ++i) {
+        EXPECT_TRUE(addresses.insert(expired_leases[i]->addr_).second);
+        EXPECT_NE(leases.back()->addr_, expired_leases[i]->addr_);
+        if (i > 0) {
+            EXPECT_LE(expired_leases[i - 1]->getExpirationTime(),
+                      expired_leases[i]->getExpirationTime());
+        }
+    }
+
+    // There should be no leases after the last lease returned.
+    Lease6Collection next_leases;
+    ASSERT_NO_THROW(lmptr_->getNextExpiredLeases6(next_leases, 0, last_expire,
+                                                   last_address));
+    EXPECT_TRUE(next_leases.empty());
+}
+
 void
 GenericLeaseMgrTest::testDeleteExpiredReclaimedLeases4() {
     // Get the leases to be used for the test.
@@ -8,6 +8,7 @@
 #define GENERIC_LEASE_MGR_UNITTEST_H
 
 #include <dhcpsrv/lease_mgr.h>
+#include <boost/function.hpp>
 #include <gtest/gtest.h>
 #include <vector>
 
@@ -284,6 +285,46 @@ public:
     /// Checks that the code is able to update an IPv4 lease in the database.
     void testUpdateLease4();
 
+    /// @brief Asynchronous Lease4 lookup test
+    ///
+    /// Checks that the code is able to look up IPv4 leases with the
+    /// asynchronous API and that the handlers are invoked in the order
+    /// in which the lookups have been issued.
+    void testAsyncGetLease4();
+
+    /// @brief Concurrent Lease4 lookup test
+    ///
+    /// Checks that the IPv4 leases can be looked up by several threads
+    /// at the same time.
+    ///
+    /// @param thread_init Function invoked by each thread before the
+    /// first lookup, e.g. to initialize the database client library.
+    /// @param thread_end Function invoked by each thread after the last
+    /// lookup.
+    void testConcurrentGetLease4(const boost::function<void ()>& thread_init =
+                                 boost::function<void ()>(),
+                                 const boost::function<void ()>& thread_end =
+                                 boost::function<void ()>());
+
+    /// @brief Lease4 batch update test
+    ///
+    /// Checks that the code is able to update multiple IPv4 leases in
+    /// the database with a single call.
+    void testUpdateLeases4();
+
+    /// @brief Lease4 batch delete test
+    ///
+    /// Checks that the code is able to delete multiple IPv4 leases from
+    /// the database with a single call.
+    void testDeleteLeases4();
+
+    /// @brief Lease4 batch store test
+    ///
+    /// Checks that the code is able to add and replace multiple IPv4
+    /// leases in the database with a single call and that it returns
+    /// the replaced leases.
+    void testStoreLeases4();
+
     /// @brief Lease6 update test
     ///
     /// Checks that the code is able to update an IPv6 lease in the database.
@@ -314,6 +355,25 @@ public:
     /// - reclaimed leases are not returned.
     void testGetExpiredLeases4();
 
+    /// @brief Checks that the DHCPv4 leases can be retrieved in pages.
+    ///
+    /// This test checks the following:
+    /// - leases are returned in the order of their addresses
+    /// - the next page starts after the last lease of the previous page
+    /// - the leases above the upper bound are not returned
+    /// - leases can be filtered by subnet identifier
+    /// - invalid bounds and page size are rejected.
+    void testGetLeases4Page();
+
+    /// @brief Checks that the DHCPv6 leases can be retrieved in pages.
+    ///
+    /// This test checks the following:
+    /// - leases are returned in the order of their addresses
+    /// - the next page starts after the last lease of the previous page
+    /// - leases can be filtered by subnet identifier
+    /// - invalid lower bound and page size are rejected.
+    void testGetLeases6Page();
+
     /// @brief Checks that the expired IPv6 leases can be retrieved.
     ///
     /// This test checks the following:
@@ -324,6 +384,26 @@ public:
     /// - reclaimed leases are not returned.
     void testGetExpiredLeases6();
 
+    /// @brief Checks that the expired DHCPv4 leases can be retrieved in
+    /// slices following the last returned lease.
+    ///
+    /// This test checks the following:
+    /// - each expired and not reclaimed lease is returned exactly once
+    ///   when the leases remain expired between the slices
+    /// - leases are returned in the order of the expiration time
+    /// - reclaimed leases are not returned.
+    void testGetNextExpiredLeases4();
+
+    /// @brief Checks that the expired DHCPv6 leases can be retrieved in
+    /// slices following the last returned lease.
+    ///
+    /// This test checks the following:
+    /// - each expired and not reclaimed lease is returned exactly once
+    ///   when the leases remain expired between the slices
+    /// - leases are returned in the order of the expiration time
+    /// - reclaimed leases are not returned.
+    void testGetNextExpiredLeases6();
+
     /// @brief Checks that declined IPv4 leases that have expired can be retrieved.
     ///
     /// This test checks that the following:
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 #include <time.h>
@@ -165,10 +166,12 @@ public:
 
     /// @brief Returns expired DHCPv6 leases.
     ///
-    /// This method is not implemented.
-    virtual void getExpiredLeases6(Lease6Collection&, const size_t) const {
-        isc_throw(NotImplemented, "ConcreteLeaseMgr::getExpiredLeases6 is not"
-                  " implemented");
+    /// @param [out] expired_leases Container to which the leases held in
+    /// the leases6_ field are appended as is.
+    virtual void getExpiredLeases6(Lease6Collection& expired_leases,
+                                   const size_t) const {
+        expired_leases.insert(expired_leases.end(), leases6_.begin(),
+                              leases6_.end());
     }
 
     /// @brief Returns expired DHCPv4 leases.
@@ -324,6 +327,47 @@ TEST_F(LeaseMgrTest, getLease6) {
                  MultipleRecords);
 }
 
+// This test checks that the default getNextExpiredLeases6() returns the
+// expired leases in slices ordered by expiration time and address.
+TEST_F(LeaseMgrTest, getNextExpiredLeases6) {
+
+    DatabaseConnection::ParameterMap pmap;
+    boost::scoped_ptr<ConcreteLeaseMgr> mgr(new ConcreteLeaseMgr(pmap));
+
+    vector<Lease6Ptr> leases = createLeases6();
+
+    // The leases 0 and 1 expire at the same time, the other leases expire
+    // in the reverse order of their addresses.
+    const time_t current_time = time(NULL);
+    for (size_t i = 0; i < leases.size(); ++i) {
+        leases[i]->valid_lft_ = 10;
+        leases[i]->cltt_ = current_time - 100 - (i > 1 ? i : 1);
+        mgr->leases6_.push_back(leases[i]);
+    }
+
+    // Walk through the leases in slices of 3 leases.
+    const size_t order[] = { 7, 6, 5, 4, 3, 2, 0, 1 };
+    int64_t last_expire = std::numeric_limits<int64_t>::min();
+    IOAddress last_address("::");
+    size_t returned = 0;
+    for (;;) {
+        Lease6Collection slice;
+        ASSERT_NO_THROW(mgr->getNextExpiredLeases6(slice, 3, last_expire,
+                                                   last_address));
+        ASSERT_LE(slice.size(), 3);
+        if (slice.empty()) {
+            break;
+        }
+        for (size_t i = 0; i < slice.size(); ++i) {
+            ASSERT_LT(returned, leases.size());
+            EXPECT_EQ(ioaddress6_[order[returned++]], slice[i]->addr_);
+        }
+        last_expire = slice.back()->getExpirationTime();
+        last_address = slice.back()->addr_;
+    }
+    EXPECT_EQ(leases.size(), returned);
+}
+
 // There's no point in calling any other methods in LeaseMgr, as they
 // are purely virtual, so we would only call ConcreteLeaseMgr methods.
 // Those methods are just stubs that do not return anything.
@@ -1,4 +1,4 @@
-// Copyright (C) 2013-2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2013-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -423,6 +423,82 @@ TEST_F(Lease4Test, toText) {
     EXPECT_EQ(expected.str(), lease.toText());
 }
 
+// Verify that the lease converted to the element map is restored by
+// fromElement().
+TEST_F(Lease4Test, toAndFromElement) {
+    Lease4 lease(IOAddress("192.0.2.3"), hwaddr_, clientid_, 3600, 0, 0,
+                 12345678, 789, true, false, "host.example.org");
+    lease.state_ = Lease::STATE_DECLINED;
+
+    Lease4Ptr restored;
+    ASSERT_NO_THROW(restored = Lease4::fromElement(lease.toElement()));
+    ASSERT_TRUE(restored);
+    EXPECT_TRUE(lease == *restored);
+
+    // The lease without the client identifier.
+    lease.client_id_.reset();
+    ASSERT_NO_THROW(restored = Lease4::fromElement(lease.toElement()));
+    EXPECT_TRUE(lease == *restored);
+}
+
+// Verify that fromElement() uses the default values of the optional
+// parameters and rejects the malformed leases.
+TEST_F(Lease4Test, fromElement) {
+    const time_t current_time = time(NULL);
+    Lease4Ptr lease;
+    ASSERT_NO_THROW(lease = Lease4::fromElement(data::Element::fromJSON(
+        "{ \"ip-address\": \"192.0.2.3\","
+        "  \"hw-address\": \"08:00:2b:02:3f:4e\","
+        "  \"valid-lft\": 3600 }")));
+    ASSERT_TRUE(lease);
+    EXPECT_EQ("192.0.2.3", lease->addr_.toText());
+    ASSERT_TRUE(lease->hwaddr_);
+    EXPECT_TRUE(*hwaddr_ == *lease->hwaddr_);
+    EXPECT_FALSE(lease->client_id_);
+    EXPECT_EQ(3600, lease->valid_lft_);
+    EXPECT_GE(lease->cltt_, current_time);
+    EXPECT_EQ(0, lease->subnet_id_);
+    EXPECT_FALSE(lease->fqdn_fwd_);
+    EXPECT_FALSE(lease->fqdn_rev_);
+    EXPECT_TRUE(lease->hostname_.empty());
+    EXPECT_EQ(Lease::STATE_DEFAULT, lease->state_);
+
+    const char* invalid[] = {
+        "[ ]",
+        // Missing mandatory parameters.
+        "{ \"hw-address\": \"08:00:2b:02:3f:4e\", \"valid-lft\": 1 }",
+        "{ \"ip-address\": \"192.0.2.3\", \"valid-lft\": 1 }",
+        "{ \"ip-address\": \"192.0.2.3\","
+        "  \"hw-address\": \"08:00:2b:02:3f:4e\" }",
+        // Invalid values.
+        "{ \"ip-address\": \"2001:db8::1\","
+        "  \"hw-address\": \"08:00:2b:02:3f:4e\", \"valid-lft\": 1 }",
+        "{ \"ip-address\": \"192.0.2.3\","
+        "  \"hw-address\": \"08:00:2b:02:3f:4e\", \"valid-lft\": -1 }",
+        "{ \"ip-address\": \"192.0.2.3\","
+        "  \"hw-address\": \"08:00:2b:02:3f:4e\", \"valid-lft\": \"1\" }",
+        "{ \"ip-address\": \"192.0.2.3\", \"hw-address\": \"\","
+        "  \"valid-lft\": 1 }",
+        "{ \"ip-address\": \"192.0.2.3\","
+        "  \"hw-address\": \"08:00:2b:02:3f:4e\", \"valid-lft\": 1,"
+        "  \"state\": 3 }",
+        // Unsupported parameter.
+        "{ \"ip-address\": \"192.0.2.3\","
+        "  \"hw-address\": \"08:00:2b:02:3f:4e\", \"valid-lft\": 1,"
+        "  \"subnet_id\": 1 }"
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); ++i) {
+        SCOPED_TRACE(invalid[i]);
+        EXPECT_THROW(Lease4::fromElement(data::Element::fromJSON(invalid[i])),
+                     BadValue);
+    }
+
+    // The empty hardware address is accepted for the declined lease.
+    EXPECT_NO_THROW(Lease4::fromElement(data::Element::fromJSON(
+        "{ \"ip-address\": \"192.0.2.3\", \"hw-address\": \"\","
+        "  \"valid-lft\": 1, \"state\": 1 }")));
+}
+
 // Verify that decline() method properly clears up specific fields.
 TEST_F(Lease4Test, decline) {
 
@@ -848,6 +924,42 @@ TEST(Lease6Test, toText) {
     EXPECT_EQ(expected.str(), lease.toText());
 }
 
+// Verify that the lease is converted to the element map.
+TEST(Lease6Test, toElement) {
+    HWAddrPtr hwaddr(new HWAddr(HWADDR, sizeof(HWADDR), HTYPE_ETHER));
+
+    uint8_t llt[] = {0, 1, 2, 3, 4, 5, 6, 0xa, 0xb, 0xc, 0xd, 0xe, 0xf};
+    DuidPtr duid(new DUID(llt, sizeof(llt)));
+
+    Lease6 lease(Lease::TYPE_PD, IOAddress("2001:db8:1::"), duid, 123456,
+                 400, 800, 100, 200, 5678, true, false, "host.example.org",
+                 hwaddr, 48);
+    lease.cltt_ = 12345678;
+    lease.state_ = Lease::STATE_DECLINED;
+
+    data::ElementPtr expected = data::Element::fromJSON(
+        "{ \"ip-address\": \"2001:db8:1::\","
+        "  \"type\": \"IA_PD\","
+        "  \"prefix-len\": 48,"
+        "  \"duid\": \"00:01:02:03:04:05:06:0a:0b:0c:0d:0e:0f\","
+        "  \"iaid\": 123456,"
+        "  \"hw-address\": \"" + hwaddr->toText(false) + "\","
+        "  \"subnet-id\": 5678,"
+        "  \"preferred-lft\": 400,"
+        "  \"valid-lft\": 800,"
+        "  \"cltt\": 12345678,"
+        "  \"fqdn-fwd\": true,"
+        "  \"fqdn-rev\": false,"
+        "  \"hostname\": \"host.example.org\","
+        "  \"state\": 1 }");
+    EXPECT_TRUE(expected->equals(*lease.toElement()));
+
+    // The hardware address is omitted when it is not set.
+    lease.hwaddr_.reset();
+    expected->remove("hw-address");
+    EXPECT_TRUE(expected->equals(*lease.toElement()));
+}
+
 // Verify that the lease states are correctly returned in the textual format.
 TEST(Lease6Test, stateToText) {
     EXPECT_EQ("default", Lease6::statesToText(Lease::STATE_DEFAULT));
@@ -28,6 +28,7 @@
 #include <iostream>
 #include <fstream>
 #include <queue>
+#include <set>
 #include <sstream>
 #include <unistd.h>
 
@@ -489,6 +490,65 @@ TEST_F(MemfileLeaseMgrTest, lfcTimerDisabled) {
     EXPECT_EQ(0, lease_mgr->getLFCCount());
 }
 
+// This test checks that the LFC interval can be changed without
+// recreating the lease manager and that the other parameters can't.
+TEST_F(MemfileLeaseMgrTest, reconfigure) {
+    DatabaseConnection::ParameterMap pmap;
+    pmap["type"] = "memfile";
+    pmap["universe"] = "4";
+    pmap["name"] = getLeaseFilePath("leasefile4_0.csv");
+    pmap["lfc-interval"] = "0";
+
+    boost::scoped_ptr<LFCMemfileLeaseMgr>
+        lease_mgr(new LFCMemfileLeaseMgr(pmap));
+
+    // Enable the LFC in place.
+    std::set<std::string> changed;
+    changed.insert("lfc-interval");
+    pmap["lfc-interval"] = "1";
+    ASSERT_TRUE(lease_mgr->reconfigure(pmap, changed));
+
+    ASSERT_NO_THROW(timer_mgr_->startThread());
+    setTestTime(1900);
+    ASSERT_NO_THROW(timer_mgr_->stopThread());
+    EXPECT_EQ(1, lease_mgr->getLFCCount());
+
+    // The timers are re-registered when nothing has changed. The new
+    // interval must have been stored by the lease manager.
+    ASSERT_TRUE(lease_mgr->reconfigure(pmap, std::set<std::string>()));
+    ASSERT_NO_THROW(timer_mgr_->startThread());
+    setTestTime(1900);
+    ASSERT_NO_THROW(timer_mgr_->stopThread());
+    EXPECT_EQ(2, lease_mgr->getLFCCount());
+
+    // Disable it again.
+    pmap["lfc-interval"] = "0";
+    ASSERT_TRUE(lease_mgr->reconfigure(pmap, changed));
+    ASSERT_NO_THROW(timer_mgr_->startThread());
+    setTestTime(1900);
+    ASSERT_NO_THROW(timer_mgr_->stopThread());
+    EXPECT_EQ(2, lease_mgr->getLFCCount());
+
+    // The invalid interval is rejected and the current one is kept.
+    pmap["lfc-interval"] = "1";
+    ASSERT_TRUE(lease_mgr->reconfigure(pmap, changed));
+    pmap["lfc-interval"] = "often";
+    EXPECT_THROW(lease_mgr->reconfigure(pmap, changed), isc::BadValue);
+    ASSERT_NO_THROW(timer_mgr_->startThread());
+    setTestTime(1900);
+    ASSERT_NO_THROW(timer_mgr_->stopThread());
+    EXPECT_EQ(3, lease_mgr->getLFCCount());
+
+    // Any other parameter requires a new lease manager.
+    pmap["lfc-interval"] = "0";
+    changed.insert("name");
+    pmap["name"] = getLeaseFilePath("leasefile4_1.csv");
+    EXPECT_FALSE(lease_mgr->reconfigure(pmap, changed));
+
+    // Nothing to do when nothing has changed.
+    EXPECT_TRUE(lease_mgr->reconfigure(pmap, std::set<std::string>()));
+}
+
 // This test checks that the callback function executing the cleanup of the
 // DHCPv4 lease file works as expected.
 TEST_F(MemfileLeaseMgrTest, leaseFileCleanup4) {
@@ -955,6 +1015,31 @@ TEST_F(MemfileLeaseMgrTest, getExpiredLeases4) {
     testGetExpiredLeases4();
 }
 
+/// @brief Check that the expired DHCPv4 leases can be retrieved in slices.
+///
+/// This test walks through the expired leases in slices following the
+/// last returned lease and checks that each lease is returned once.
+TEST_F(MemfileLeaseMgrTest, getNextExpiredLeases4) {
+    startBackend(V4);
+    testGetNextExpiredLeases4();
+}
+
+/// @brief Check that the DHCPv4 leases can be retrieved in pages.
+///
+/// This test adds a number of leases to the lease database and walks
+/// through them in pages, checking that the pages are ordered by address,
+/// don't overlap, respect the upper bound and can be limited to a subnet.
+TEST_F(MemfileLeaseMgrTest, getLeases4Page) {
+    startBackend(V4);
+    testGetLeases4Page();
+}
+
+/// @brief Check that the DHCPv6 leases can be retrieved in pages.
+TEST_F(MemfileLeaseMgrTest, getLeases6Page) {
+    startBackend(V6);
+    testGetLeases6Page();
+}
+
 /// @brief Check that the expired DHCPv6 leases can be retrieved.
 ///
 /// This test adds a number of leases to the lease database and marks
@@ -967,6 +1052,15 @@ TEST_F(MemfileLeaseMgrTest, getExpiredLeases6) {
     testGetExpiredLeases6();
 }
 
+/// @brief Check that the expired DHCPv6 leases can be retrieved in slices.
+///
+/// This test walks through the expired leases in slices following the
+/// last returned lease and checks that each lease is returned once.
+TEST_F(MemfileLeaseMgrTest, getNextExpiredLeases6) {
+    startBackend(V6);
+    testGetNextExpiredLeases6();
+}
+
 /// @brief Check that expired reclaimed DHCPv6 leases are removed.
 TEST_F(MemfileLeaseMgrTest, deleteExpiredReclaimedLeases6) {
     startBackend(V6);
@@ -979,6 +1073,182 @@ TEST_F(MemfileLeaseMgrTest, deleteExpiredReclaimedLeases4) {
     testDeleteExpiredReclaimedLeases4();
 }
 
+/// @brief Check that IPv4 leases can be looked up asynchronously.
+TEST_F(MemfileLeaseMgrTest, asyncGetLease4) {
+    startBackend(V4);
+    testAsyncGetLease4();
+}
+
+/// @brief Check that multiple IPv4 leases can be updated at once.
+TEST_F(MemfileLeaseMgrTest, updateLeases4) {
+    startBackend(V4);
+    testUpdateLeases4();
+}
+
+/// @brief Check that multiple IPv4 leases can be deleted at once.
+TEST_F(MemfileLeaseMgrTest, deleteLeases4) {
+    startBackend(V4);
+    testDeleteLeases4();
+}
+
+/// @brief Check that multiple IPv4 leases can be stored at once.
+TEST_F(MemfileLeaseMgrTest, storeLeases4) {
+    startBackend(V4);
+    testStoreLeases4();
+}
+
+/// @brief Check that the backend holds its own copies of the leases.
+TEST_F(MemfileLeaseMgrTest, storedLeaseCopies) {
+    startBackend(V4);
+    Lease4Ptr lease = initializeLease4(straddress4_[1]);
+    ASSERT_TRUE(lmptr_->addLease(lease));
+
+    // Modifying the added lease doesn't affect the stored lease.
+    lease->hostname_ = "modified.example.org";
+    Lease4Ptr stored = lmptr_->getLease4(lease->addr_);
+    ASSERT_TRUE(stored);
+    EXPECT_NE(lease->hostname_, stored->hostname_);
+
+    // Modifying the returned lease doesn't affect the stored lease.
+    stored = lmptr_->getLease4(*stored->client_id_, *stored->hwaddr_,
+                               stored->subnet_id_);
+    ASSERT_TRUE(stored);
+    stored->hostname_ = "modified.example.org";
+    Lease4Collection leases = lmptr_->getLease4(*stored->hwaddr_);
+    ASSERT_EQ(1, leases.size());
+    EXPECT_NE(stored->hostname_, leases[0]->hostname_);
+}
+
+/// @brief Check that the memory used by the DHCPv4 lease records is
+/// reported.
+TEST_F(MemfileLeaseMgrTest, recordMemoryUsage) {
+    startBackend(V4);
+    Memfile_LeaseMgr* memfile = dynamic_cast<Memfile_LeaseMgr*>(lmptr_);
+    ASSERT_TRUE(memfile);
+    EXPECT_EQ(0, memfile->getMemoryUsage(Memfile_LeaseMgr::V4));
+
+    Lease4Ptr lease = initializeLease4(straddress4_[1]);
+    ASSERT_TRUE(lmptr_->addLease(lease));
+    EXPECT_GE(memfile->getMemoryUsage(Memfile_LeaseMgr::V4),
+              sizeof(Lease4Record));
+
+    ASSERT_TRUE(lmptr_->deleteLease(lease->addr_));
+    EXPECT_EQ(0, memfile->getMemoryUsage(Memfile_LeaseMgr::V4));
+}
+
+/// @brief Check that the DHCPv6 leases of the same client share the DUID
+/// and that the memory usage is reported.
+TEST_F(MemfileLeaseMgrTest, sharedDuids) {
+    startBackend(V6);
+    Memfile_LeaseMgr* memfile = dynamic_cast<Memfile_LeaseMgr*>(lmptr_);
+    ASSERT_TRUE(memfile);
+    EXPECT_EQ(0, memfile->getMemoryUsage(Memfile_LeaseMgr::V6));
+
+    // Create two leases holding distinct instances of the same DUID.
+    Lease6Ptr lease1 = initializeLease6(straddress6_[1]);
+    Lease6Ptr lease2 = initializeLease6(straddress6_[2]);
+    lease2->duid_.reset(new DUID(lease1->duid_->getDuid()));
+    ASSERT_TRUE(lmptr_->addLease(lease1));
+    const size_t usage = memfile->getMemoryUsage(Memfile_LeaseMgr::V6);
+    EXPECT_GT(usage, 0);
+    ASSERT_TRUE(lmptr_->addLease(lease2));
+
+    Lease6Ptr stored1 = lmptr_->getLease6(lease1->type_, lease1->addr_);
+    Lease6Ptr stored2 = lmptr_->getLease6(lease2->type_, lease2->addr_);
+    ASSERT_TRUE(stored1);
+    ASSERT_TRUE(stored2);
+    EXPECT_EQ(stored1->duid_.get(), stored2->duid_.get());
+
+    // The second lease doesn't add the DUID to the memory usage.
+    EXPECT_LT(memfile->getMemoryUsage(Memfile_LeaseMgr::V6) - usage, usage);
+
+    // The memory is not used when the leases are gone.
+    stored1.reset();
+    stored2.reset();
+    ASSERT_TRUE(lmptr_->deleteLease(lease1->addr_));
+    ASSERT_TRUE(lmptr_->deleteLease(lease2->addr_));
+    EXPECT_EQ(0, memfile->getMemoryUsage(Memfile_LeaseMgr::V6));
+}
+
+/// @brief Check that the lease counts per subnet are maintained as the
+/// IPv4 leases are added, updated, removed and loaded from the file.
+TEST_F(MemfileLeaseMgrTest, leaseCounts4) {
+    startBackend(V4);
+    Memfile_LeaseMgr* memfile = dynamic_cast<Memfile_LeaseMgr*>(lmptr_);
+    ASSERT_TRUE(memfile);
+    EXPECT_TRUE(memfile->getLeaseCounts(Memfile_LeaseMgr::V4).empty());
+
+    Lease4Ptr lease1 = initializeLease4(straddress4_[1]);
+    Lease4Ptr lease2 = initializeLease4(straddress4_[2]);
+    lease1->subnet_id_ = 1;
+    lease2->subnet_id_ = 1;
+    ASSERT_TRUE(lmptr_->addLease(lease1));
+    ASSERT_TRUE(lmptr_->addLease(lease2));
+    ASSERT_EQ(1, memfile->getLeaseCounts(Memfile_LeaseMgr::V4).count(1));
+    SubnetLeaseCounts counts =
+        memfile->getLeaseCounts(Memfile_LeaseMgr::V4).find(1)->second;
+    EXPECT_EQ(2, counts.assigned_);
+    EXPECT_EQ(0, counts.declined_);
+
+    // Declining the lease moves it to the other counter.
+    lease2->state_ = Lease::STATE_DECLINED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease2));
+    counts = memfile->getLeaseCounts(Memfile_LeaseMgr::V4).find(1)->second;
+    EXPECT_EQ(1, counts.assigned_);
+    EXPECT_EQ(1, counts.declined_);
+
+    // The counts are rebuilt when the leases are loaded.
+    LeaseMgrFactory::destroy();
+    startBackend(V4);
+    memfile = dynamic_cast<Memfile_LeaseMgr*>(lmptr_);
+    ASSERT_TRUE(memfile);
+    ASSERT_EQ(1, memfile->getLeaseCounts(Memfile_LeaseMgr::V4).count(1));
+    counts = memfile->getLeaseCounts(Memfile_LeaseMgr::V4).find(1)->second;
+    EXPECT_EQ(1, counts.assigned_);
+    EXPECT_EQ(1, counts.declined_);
+
+    // The reclaimed leases are not counted and the subnets without leases
+    // are not listed.
+    lease1->state_ = Lease::STATE_EXPIRED_RECLAIMED;
+    ASSERT_NO_THROW(lmptr_->updateLease4(lease1));
+    ASSERT_TRUE(lmptr_->deleteLease(lease2->addr_));
+    EXPECT_TRUE(memfile->getLeaseCounts(Memfile_LeaseMgr::V4).empty());
+}
+
+/// @brief Check that the lease counts per subnet are maintained as the
+/// IPv6 leases are added, updated and removed.
+TEST_F(MemfileLeaseMgrTest, leaseCounts6) {
+    startBackend(V6);
+    Memfile_LeaseMgr* memfile = dynamic_cast<Memfile_LeaseMgr*>(lmptr_);
+    ASSERT_TRUE(memfile);
+
+    Lease6Ptr lease1 = initializeLease6(straddress6_[1]);
+    Lease6Ptr lease2 = initializeLease6(straddress6_[2]);
+    lease1->subnet_id_ = 1;
+    lease1->type_ = Lease::TYPE_NA;
+    lease2->subnet_id_ = 1;
+    lease2->type_ = Lease::TYPE_PD;
+    ASSERT_TRUE(lmptr_->addLease(lease1));
+    ASSERT_TRUE(lmptr_->addLease(lease2));
+    ASSERT_EQ(1, memfile->getLeaseCounts(Memfile_LeaseMgr::V6).count(1));
+    SubnetLeaseCounts counts =
+        memfile->getLeaseCounts(Memfile_LeaseMgr::V6).find(1)->second;
+    EXPECT_EQ(1, counts.assigned_);
+    EXPECT_EQ(0, counts.declined_);
+    EXPECT_EQ(1, counts.assigned_pds_);
+
+    lease1->state_ = Lease::STATE_DECLINED;
+    ASSERT_NO_THROW(lmptr_->updateLease6(lease1));
+    counts = memfile->getLeaseCounts(Memfile_LeaseMgr::V6).find(1)->second;
+    EXPECT_EQ(0, counts.assigned_);
+    EXPECT_EQ(1, counts.declined_);
+    EXPECT_EQ(1, counts.assigned_pds_);
+
+    ASSERT_TRUE(lmptr_->deleteLease(lease1->addr_));
+    ASSERT_TRUE(lmptr_->deleteLease(lease2->addr_));
+    EXPECT_TRUE(memfile->getLeaseCounts(Memfile_LeaseMgr::V6).empty());
+}
+
 /// @brief Check that getLease6 methods discriminate by lease type.
 ///
 /// Adds six leases, two per lease type all with the same duid and iad but
@@ -0,0 +1,94 @@
+// Copyright (C) 2017 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <asiolink/io_address.h>
+#include <dhcp/duid.h>
+#include <dhcp/hwaddr.h>
+#include <dhcpsrv/memfile_lease_record.h>
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+
+using namespace isc;
+using namespace isc::asiolink;
+using namespace isc::dhcp;
+
+namespace {
+
+/// Hardware address used by different tests.
+const uint8_t HWADDR[] = {0x08, 0x00, 0x2b, 0x02, 0x3f, 0x4e};
+/// Client id used by different tests.
+const uint8_t CLIENTID[] = {0x17, 0x34, 0xe2, 0xff, 0x09, 0x92, 0x54};
+
+// This test verifies that the short and long data are held by the
+// buffer and that the buffers are copied and compared.
+TEST(CompactBufferTest, data) {
+    CompactBuffer empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_EQ(0, empty.getAllocatedSize());
+
+    std::vector<uint8_t> short_data(HWADDR, HWADDR + sizeof(HWADDR));
+    CompactBuffer short_buf(short_data);
+    EXPECT_EQ(sizeof(HWADDR), short_buf.size());
+    EXPECT_EQ(0, short_buf.getAllocatedSize());
+    EXPECT_TRUE(short_data == short_buf.toVector());
+
+    const std::string long_data(CompactBuffer::INLINE_SIZE + 1, 'a');
+    CompactBuffer long_buf(long_data);
+    EXPECT_EQ(long_data.size(), long_buf.getAllocatedSize());
+    EXPECT_EQ(long_data, long_buf.toString());
+
+    // The copies hold their own data.
+    CompactBuffer long_copy(long_buf);
+    EXPECT_TRUE(long_copy == long_buf);
+    EXPECT_NE(long_buf.data(), long_copy.data());
+    long_copy = short_buf;
+    EXPECT_TRUE(long_copy == short_buf);
+    EXPECT_EQ(0, long_copy.getAllocatedSize());
+
+    // The buffers are ordered in the same way as the vectors.
+    std::vector<uint8_t> prefix(short_data.begin(), short_data.end() - 1);
+    EXPECT_TRUE(CompactBuffer(prefix) < short_buf);
+    EXPECT_FALSE(short_buf < CompactBuffer(prefix));
+    EXPECT_TRUE(empty < short_buf);
+    EXPECT_FALSE(short_buf < short_buf);
+}
+
+// This test verifies that the lease created from the record is equal
+// to the stored lease.
+TEST(Lease4RecordTest, toLease) {
+    HWAddrPtr hwaddr(new HWAddr(HWADDR, sizeof(HWADDR), HTYPE_ETHER));
+    hwaddr->source_ = HWAddr::HWADDR_SOURCE_RAW;
+    ClientIdPtr client_id(new ClientId(CLIENTID, sizeof(CLIENTID)));
+    Lease4 lease(IOAddress("192.0.2.3"), hwaddr, client_id, 3600, 1200,
+                 2400, 1000, 5, true, false,
+                 "a-long-host-name.example.org.");
+    lease.state_ = Lease::STATE_DECLINED;
+
+    Lease4Record record(lease);
+    EXPECT_EQ(lease.getExpirationTime(), record.getExpirationTime());
+    EXPECT_EQ(lease.addr_, record.getAddress());
+    EXPECT_TRUE(record.hasHWAddr(*hwaddr, CompactBuffer(hwaddr->hwaddr_)));
+    EXPECT_FALSE(record.stateExpiredReclaimed());
+
+    Lease4Ptr copy = record.toLease();
+    ASSERT_TRUE(copy);
+    EXPECT_TRUE(lease == *copy);
+    ASSERT_TRUE(copy->hwaddr_);
+    EXPECT_EQ(hwaddr->source_, copy->hwaddr_->source_);
+
+    // The lease without hardware address and client identifier.
+    Lease4 bare(IOAddress("192.0.2.4"), HWAddrPtr(), ClientIdPtr(), 3600,
+                1200, 2400, 1000, 5);
+    copy = Lease4Record(bare).toLease();
+    ASSERT_TRUE(copy);
+    EXPECT_FALSE(copy->hwaddr_);
+    EXPECT_FALSE(copy->client_id_);
+    EXPECT_TRUE(bare == *copy);
+}
+
+} // end of anonymous namespace
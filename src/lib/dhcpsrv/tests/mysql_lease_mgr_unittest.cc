@@ -15,6 +15,7 @@
 #include <dhcpsrv/testutils/mysql_schema.h>
 #include <exceptions/exceptions.h>
 
+#include <boost/bind.hpp>
 #include <gtest/gtest.h>
 
 #include <algorithm>
@@ -456,6 +457,28 @@ TEST_F(MySqlLeaseMgrTest, getExpiredLeases4) {
     testGetExpiredLeases4();
 }
 
+/// @brief Check that the expired DHCPv4 leases can be retrieved in slices.
+///
+/// This test walks through the expired leases in slices following the
+/// last returned lease and checks that each lease is returned once.
+TEST_F(MySqlLeaseMgrTest, getNextExpiredLeases4) {
+    testGetNextExpiredLeases4();
+}
+
+/// @brief Check that the DHCPv4 leases can be retrieved in pages.
+///
+/// This test adds a number of leases to the lease database and walks
+/// through them in pages, checking that the pages are ordered by address,
+/// don't overlap, respect the upper bound and can be limited to a subnet.
+TEST_F(MySqlLeaseMgrTest, getLeases4Page) {
+    testGetLeases4Page();
+}
+
+/// @brief Check that the DHCPv6 leases can be retrieved in pages.
+TEST_F(MySqlLeaseMgrTest, getLeases6Page) {
+    testGetLeases6Page();
+}
+
 /// @brief Check that the expired DHCPv6 leases can be retrieved.
 ///
 /// This test adds a number of leases to the lease database and marks
@@ -467,6 +490,14 @@ TEST_F(MySqlLeaseMgrTest, getExpiredLeases6) {
     testGetExpiredLeases6();
 }
 
+/// @brief Check that the expired DHCPv6 leases can be retrieved in slices.
+///
+/// This test walks through the expired leases in slices following the
+/// last returned lease and checks that each lease is returned once.
+TEST_F(MySqlLeaseMgrTest, getNextExpiredLeases6) {
+    testGetNextExpiredLeases6();
+}
+
 /// @brief Check that expired reclaimed DHCPv6 leases are removed.
 TEST_F(MySqlLeaseMgrTest, deleteExpiredReclaimedLeases6) {
     testDeleteExpiredReclaimedLeases6();
@@ -477,6 +508,50 @@ TEST_F(MySqlLeaseMgrTest, deleteExpiredReclaimedLeases4) {
     testDeleteExpiredReclaimedLeases4();
 }
 
+/// @brief Check that IPv4 leases can be looked up asynchronously.
+TEST_F(MySqlLeaseMgrTest, asyncGetLease4) {
+    testAsyncGetLease4();
+}
+
+/// @brief Check that IPv4 leases can be looked up by several threads using
+/// the pool of connections.
+TEST_F(MySqlLeaseMgrTest, concurrentGetLease4) {
+    LeaseMgrFactory::destroy();
+    LeaseMgrFactory::create(validMySQLConnectionString() +
+                            std::string(" connection-pool-size=4"));
+    lmptr_ = &(LeaseMgrFactory::instance());
+
+    // The threads use the connections opened by other threads, so they
+    // have to initialize the client library.
+    testConcurrentGetLease4(boost::bind(&mysql_thread_init),
+                            &mysql_thread_end);
+}
+
+/// @brief Check that the invalid connection pool size is rejected.
+TEST_F(MySqlLeaseMgrTest, invalidConnectionPoolSize) {
+    LeaseMgrFactory::destroy();
+    EXPECT_THROW(LeaseMgrFactory::create(validMySQLConnectionString() +
+                                         std::string(" connection-pool-size=0")),
+                 DbInvalidPoolSize);
+    LeaseMgrFactory::create(validMySQLConnectionString());
+    lmptr_ = &(LeaseMgrFactory::instance());
+}
+
+/// @brief Check that multiple IPv4 leases can be updated at once.
+TEST_F(MySqlLeaseMgrTest, updateLeases4) {
+    testUpdateLeases4();
+}
+
+/// @brief Check that multiple IPv4 leases can be deleted at once.
+TEST_F(MySqlLeaseMgrTest, deleteLeases4) {
+    testDeleteLeases4();
+}
+
+/// @brief Check that multiple IPv4 leases can be stored at once.
+TEST_F(MySqlLeaseMgrTest, storeLeases4) {
+    testStoreLeases4();
+}
+
 // Verifies that IPv4 lease statistics can be recalculated.
 TEST_F(MySqlLeaseMgrTest, recountLeaseStats4) {
     testRecountLeaseStats4();
@@ -308,11 +308,63 @@ TEST_F(PgSqlLeaseMgrTest, getExpiredLeases4) {
     testGetExpiredLeases4();
 }
 
+/// @brief Check that the expired DHCPv4 leases can be retrieved in slices.
+///
+/// This test walks through the expired leases in slices following the
+/// last returned lease and checks that each lease is returned once.
+TEST_F(PgSqlLeaseMgrTest, getNextExpiredLeases4) {
+    testGetNextExpiredLeases4();
+}
+
+/// @brief Check that the DHCPv4 leases can be retrieved in pages.
+///
+/// This test adds a number of leases to the lease database and walks
+/// through them in pages, checking that the pages are ordered by address,
+/// don't overlap, respect the upper bound and can be limited to a subnet.
+TEST_F(PgSqlLeaseMgrTest, getLeases4Page) {
+    testGetLeases4Page();
+}
+
+/// @brief Check that the DHCPv6 leases can be retrieved in pages.
+TEST_F(PgSqlLeaseMgrTest, getLeases6Page) {
+    testGetLeases6Page();
+}
+
 /// @brief Check that expired reclaimed DHCPv4 leases are removed.
 TEST_F(PgSqlLeaseMgrTest, deleteExpiredReclaimedLeases4) {
     testDeleteExpiredReclaimedLeases4();
 }
 
+/// @brief Check that IPv4 leases can be looked up asynchronously.
+TEST_F(PgSqlLeaseMgrTest, asyncGetLease4) {
+    testAsyncGetLease4();
+}
+
+/// @brief Check that IPv4 leases can be looked up by several threads using
+/// the pool of connections.
+TEST_F(PgSqlLeaseMgrTest, concurrentGetLease4) {
+    LeaseMgrFactory::destroy();
+    LeaseMgrFactory::create(validPgSQLConnectionString() +
+                            std::string(" connection-pool-size=4"));
+    lmptr_ = &(LeaseMgrFactory::instance());
+    testConcurrentGetLease4();
+}
+
+/// @brief Check that multiple IPv4 leases can be updated at once.
+TEST_F(PgSqlLeaseMgrTest, updateLeases4) {
+    testUpdateLeases4();
+}
+
+/// @brief Check that multiple IPv4 leases can be deleted at once.
+TEST_F(PgSqlLeaseMgrTest, deleteLeases4) {
+    testDeleteLeases4();
+}
+
+/// @brief Check that multiple IPv4 leases can be stored at once.
+TEST_F(PgSqlLeaseMgrTest, storeLeases4) {
+    testStoreLeases4();
+}
+
 ////////////////////////////////////////////////////////////////////////////////
 /// LEASE6 /////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////
@@ -402,6 +454,14 @@ TEST_F(PgSqlLeaseMgrTest, getExpiredLeases6) {
     testGetExpiredLeases6();
 }
 
+/// @brief Check that the expired DHCPv6 leases can be retrieved in slices.
+///
+/// This test walks through the expired leases in slices following the
+/// last returned lease and checks that each lease is returned once.
+TEST_F(PgSqlLeaseMgrTest, getNextExpiredLeases6) {
+    testGetNextExpiredLeases6();
+}
+
 // Verifies that IPv4 lease statistics can be recalculated.
 TEST_F(PgSqlLeaseMgrTest, recountLeaseStats4) {
     testRecountLeaseStats4();
@@ -111,6 +111,57 @@ TEST(Pool4Test, unique_id) {
     }
 }
 
+// Checks that the free addresses are queued and taken in order, honoring
+// the quarantine time.
+TEST(Pool4Test, freeAddresses) {
+    Pool4 pool(IOAddress("192.0.2.10"), IOAddress("192.0.2.12"));
+    IOAddress address("0.0.0.0");
+    EXPECT_FALSE(pool.popFreeAddress(0, address));
+
+    // Addresses out of the pool are not queued.
+    pool.addFreeAddress(IOAddress("192.0.2.20"), 1000);
+    EXPECT_EQ(0, pool.getFreeAddressesCount());
+
+    pool.addFreeAddress(IOAddress("192.0.2.11"), 1000);
+    pool.addFreeAddress(IOAddress("192.0.2.10"), 1010);
+    EXPECT_EQ(2, pool.getFreeAddressesCount());
+
+    // The first address is still in quarantine.
+    EXPECT_FALSE(pool.popFreeAddress(20, address, 1015));
+
+    ASSERT_TRUE(pool.popFreeAddress(20, address, 1020));
+    EXPECT_EQ("192.0.2.11", address.toText());
+    EXPECT_FALSE(pool.popFreeAddress(20, address, 1020));
+    ASSERT_TRUE(pool.popFreeAddress(20, address, 1030));
+    EXPECT_EQ("192.0.2.10", address.toText());
+    EXPECT_EQ(0, pool.getFreeAddressesCount());
+
+    // The address which is already queued is not queued again and keeps
+    // its freeing time.
+    pool.addFreeAddress(IOAddress("192.0.2.12"), 1000);
+    pool.addFreeAddress(IOAddress("192.0.2.12"), 1010);
+    EXPECT_EQ(1, pool.getFreeAddressesCount());
+    ASSERT_TRUE(pool.popFreeAddress(20, address, 1020));
+    EXPECT_EQ("192.0.2.12", address.toText());
+
+    // The address taken from the queue can be queued again.
+    pool.addFreeAddress(IOAddress("192.0.2.12"), 1000);
+    EXPECT_EQ(1, pool.getFreeAddressesCount());
+
+    // Each address of the pool is queued at most once.
+    for (int i = 0; i < 2; ++i) {
+        pool.addFreeAddress(IOAddress("192.0.2.10"), 1000);
+        pool.addFreeAddress(IOAddress("192.0.2.11"), 1000);
+    }
+    EXPECT_EQ(3, pool.getFreeAddressesCount());
+    pool.clearFreeAddresses();
+    EXPECT_EQ(0, pool.getFreeAddressesCount());
+
+    // The cleared addresses can be queued again.
+    pool.addFreeAddress(IOAddress("192.0.2.12"), 1000);
+    EXPECT_EQ(1, pool.getFreeAddressesCount());
+}
+
 // Simple check if toText returns reasonable values
 TEST(Pool4Test,toText) {
     Pool4 pool1(IOAddress("192.0.2.7"), IOAddress("192.0.2.17"));
@@ -22,7 +22,7 @@ SocketCallback::operator()(boost::system::error_code ec, size_t length) {
     if (ec.value() == boost::asio::error::operation_aborted) {
         return;
     }
-    callback_(ec, length);
+    strand_->dispatch(boost::bind(callback_, ec, length));
 }
 
 HttpConnection:: HttpConnection(asiolink::IOService& io_service,
@@ -30,14 +30,15 @@ HttpConnection:: HttpConnection(asiolink::IOService& io_service,
                                 HttpConnectionPool& connection_pool,
                                 const HttpResponseCreatorPtr& response_creator,
                                 const HttpAcceptorCallback& callback,
-                                const long request_timeout)
-    : request_timer_(io_service),
+                                const long request_timeout,
+                                const long idle_timeout)
+    : strand_(new IOStrand(io_service)),
+      request_timer_(io_service, strand_),
       request_timeout_(request_timeout),
+      idle_timeout_(idle_timeout),
+      idle_(false),
+      persistent_(false),
       socket_(io_service),
-      socket_callback_(boost::bind(&HttpConnection::socketReadCallback, this,
-                                   _1, _2)),
-      socket_write_callback_(boost::bind(&HttpConnection::socketWriteCallback,
-                                         this, _1, _2)),
       acceptor_(acceptor),
       connection_pool_(connection_pool),
       response_creator_(response_creator),
@@ -54,6 +55,7 @@ HttpConnection::~HttpConnection() {
 
 void
 HttpConnection::close() {
+    request_timer_.cancel();
     socket_.close();
 }
 
@@ -68,10 +70,29 @@ HttpConnection::stopThisConnection() {
     }
 }
 
+void
+HttpConnection::setupTimer(void (HttpConnection::*callback)(),
+                           const long timeout) {
+    boost::weak_ptr<HttpConnection> connection(shared_from_this());
+    request_timer_.setup(boost::bind(&HttpConnection::timerCallback,
+                                     connection, callback),
+                         timeout, IntervalTimer::ONE_SHOT);
+}
+
+void
+HttpConnection::timerCallback(const boost::weak_ptr<HttpConnection>& connection,
+                              void (HttpConnection::*callback)()) {
+    HttpConnectionPtr conn = connection.lock();
+    if (conn) {
+        ((*conn).*callback)();
+    }
+}
+
 void
 HttpConnection::asyncAccept() {
-    HttpAcceptorCallback cb = boost::bind(&HttpConnection::acceptorCallback,
-                                          this, _1);
+    HttpAcceptorCallback cb =
+        SocketCallback(boost::bind(&HttpConnection::acceptorCallback,
+                                   shared_from_this(), _1), strand_);
     try {
         acceptor_.asyncAccept(socket_, cb);
 
@@ -85,8 +106,10 @@ void
 HttpConnection::doRead() {
     try {
         TCPEndpoint endpoint;
+        SocketCallback cb(boost::bind(&HttpConnection::socketReadCallback,
+                                      shared_from_this(), _1, _2), strand_);
         socket_.asyncReceive(static_cast<void*>(buf_.data()), buf_.size(),
-                             0, &endpoint, socket_callback_);
+                             0, &endpoint, cb);
 
     } catch (const std::exception& ex) {
         stopThisConnection();
@@ -97,9 +120,14 @@ void
 HttpConnection::doWrite() {
     try {
         if (!output_buf_.empty()) {
+            SocketCallback cb(boost::bind(&HttpConnection::socketWriteCallback,
+                                          shared_from_this(), _1, _2),
+                              strand_);
             socket_.asyncSend(output_buf_.data(),
                               output_buf_.length(),
-                              socket_write_callback_);
+                              cb);
+        } else if (persistent_) {
+            startNextRequest();
         } else {
             stopThisConnection();
         }
@@ -131,45 +159,112 @@ HttpConnection::acceptorCallback(const boost::system::error_code& ec) {
         LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL, HTTP_REQUEST_RECEIVE_START)
             .arg(getRemoteEndpointAddressAsText())
             .arg(static_cast<unsigned>(request_timeout_/1000));
-        request_timer_.setup(boost::bind(&HttpConnection::requestTimeoutCallback, this),
-                             request_timeout_, IntervalTimer::ONE_SHOT);
+        setupTimer(&HttpConnection::requestTimeoutCallback, request_timeout_);
         doRead();
     }
 }
 
 void
-HttpConnection::socketReadCallback(boost::system::error_code, size_t length) {
+HttpConnection::socketReadCallback(boost::system::error_code ec, size_t length) {
+    // The client has closed the connection or the read failed.
+    if (ec) {
+        stopThisConnection();
+        return;
+    }
+
     if (length != 0) {
         LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL_DATA, HTTP_DATA_RECEIVED)
             .arg(length)
             .arg(getRemoteEndpointAddressAsText());
+
+        // The persistent connection has received the beginning of the
+        // next request, so the whole request must now be received within
+        // the request timeout.
+        if (idle_) {
+            idle_ = false;
+            LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL,
+                      HTTP_REQUEST_RECEIVE_START)
+                .arg(getRemoteEndpointAddressAsText())
+                .arg(static_cast<unsigned>(request_timeout_/1000));
+            setupTimer(&HttpConnection::requestTimeoutCallback,
+                       request_timeout_);
+        }
     }
-    std::string s(&buf_[0], buf_[0] + length);
     parser_->postBuffer(static_cast<void*>(buf_.data()), length);
+    processData();
+}
+
+void
+HttpConnection::processData() {
     parser_->poll();
     if (parser_->needData()) {
         doRead();
+        return;
+    }
 
-    } else {
-        LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL, HTTP_REQUEST_RECEIVED)
-            .arg(getRemoteEndpointAddressAsText());
+    request_timer_.cancel();
+
+    LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL, HTTP_REQUEST_RECEIVED)
+        .arg(getRemoteEndpointAddressAsText());
+    try {
+        request_->finalize();
+    } catch (...) {
+    }
+
+    // After a parsing error we can't tell where the next request starts,
+    // so the connection is closed after sending the response.
+    persistent_ = false;
+    if (parser_->httpParseOk()) {
         try {
-            request_->finalize();
+            persistent_ = request_->isPersistent();
         } catch (...) {
         }
+    }
 
-        HttpResponsePtr response = response_creator_->createHttpResponse(request_);
-        LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL, HTTP_RESPONSE_SEND)
-            .arg(response->toBriefString())
-            .arg(getRemoteEndpointAddressAsText());
-        asyncSendResponse(response);
+    HttpResponsePtr response = response_creator_->createHttpResponse(request_);
+    if (!persistent_) {
+        response->addHeader("Connection", "close");
+    } else if (request_->getHttpVersion() < HttpVersion(1, 1)) {
+        response->addHeader("Connection", "keep-alive");
+    }
+    LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL, HTTP_RESPONSE_SEND)
+        .arg(response->toBriefString())
+        .arg(getRemoteEndpointAddressAsText());
+    asyncSendResponse(response);
+}
+
+void
+HttpConnection::startNextRequest() {
+    // The next pipelined request may have been already received.
+    const std::string unparsed = parser_->getUnparsedData();
+
+    request_ = response_creator_->createNewHttpRequest();
+    parser_.reset(new HttpRequestParser(*request_));
+    parser_->initModel();
+
+    if (unparsed.empty()) {
+        idle_ = true;
+        setupTimer(&HttpConnection::idleTimeoutCallback, idle_timeout_);
+        doRead();
+
+    } else {
+        LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL, HTTP_REQUEST_RECEIVE_START)
+            .arg(getRemoteEndpointAddressAsText())
+            .arg(static_cast<unsigned>(request_timeout_/1000));
+        setupTimer(&HttpConnection::requestTimeoutCallback, request_timeout_);
+        parser_->postBuffer(unparsed.data(), unparsed.size());
+        processData();
     }
 }
 
 void
-HttpConnection::socketWriteCallback(boost::system::error_code,
+HttpConnection::socketWriteCallback(boost::system::error_code ec,
                                     size_t length) {
-    if (length <= output_buf_.size()) {
+    if (ec) {
+        output_buf_.clear();
+        stopThisConnection();
+
+    } else if (length <= output_buf_.size()) {
         output_buf_.erase(0, length);
         doWrite();
 
@@ -186,9 +281,21 @@ HttpConnection::requestTimeoutCallback() {
     HttpResponsePtr response =
         response_creator_->createStockHttpResponse(request_,
                                                    HttpStatusCode::REQUEST_TIMEOUT);
+    // The rest of the request may still arrive, so the connection can't
+    // be used for the next request.
+    persistent_ = false;
+    response->addHeader("Connection", "close");
     asyncSendResponse(response);
 }
 
+void
+HttpConnection::idleTimeoutCallback() {
+    LOG_DEBUG(http_logger, DBGLVL_TRACE_DETAIL,
+              HTTP_IDLE_CONNECTION_TIMEOUT_OCCURRED)
+        .arg(getRemoteEndpointAddressAsText());
+    stopThisConnection();
+}
+
 std::string
 HttpConnection::getRemoteEndpointAddressAsText() const {
     try {
@@ -9,6 +9,7 @@
 
 #include <asiolink/interval_timer.h>
 #include <asiolink/io_service.h>
+#include <asiolink/io_strand.h>
 #include <http/http_acceptor.h>
 #include <http/request_parser.h>
 #include <http/response_creator_factory.h>
@@ -16,6 +17,7 @@
 #include <boost/enable_shared_from_this.hpp>
 #include <boost/system/error_code.hpp>
 #include <boost/shared_ptr.hpp>
+#include <boost/weak_ptr.hpp>
 #include <array>
 #include <string>
 
@@ -40,6 +42,21 @@ class HttpConnection;
 typedef boost::shared_ptr<HttpConnection> HttpConnectionPtr;
 
 /// @brief Accepts and handles a single HTTP connection.
+///
+/// The connection is persistent unless the client asks to close it (see
+/// @ref HttpRequest::isPersistent), i.e. it is used to receive subsequent
+/// requests after sending the response. The persistent connection is closed
+/// when no new request is received within the idle timeout.
+///
+/// The client may send the next request without waiting for the response
+/// (pipelining). The requests are processed in order and the next request
+/// is processed after the response to the previous one has been sent.
+///
+/// The IO service may be run by many threads, in which case the different
+/// connections are handled in parallel. All handlers of the connection are
+/// run in the connection's strand, so they never run concurrently. The
+/// pending asynchronous operations hold the pointer to the connection, so
+/// as the connection is not destroyed while its handler is running.
 class HttpConnection : public boost::enable_shared_from_this<HttpConnection> {
 private:
 
@@ -50,7 +67,8 @@ private:
 
     /// @brief Functor associated with the socket object.
     ///
-    /// This functor calls a callback function specified in the constructor.
+    /// This functor calls a callback function specified in the constructor
+    /// within the connection's strand.
     class SocketCallback {
     public:
 
@@ -58,8 +76,10 @@ private:
         ///
         /// @param socket_callback Callback to be invoked by the functor upon
         /// an event associated with the socket.
-        SocketCallback(SocketCallbackFunction socket_callback)
-            : callback_(socket_callback) {
+        /// @param strand Strand in which the callback is invoked.
+        SocketCallback(SocketCallbackFunction socket_callback,
+                       const asiolink::IOStrandPtr& strand)
+            : callback_(socket_callback), strand_(strand) {
         }
 
         /// @brief Operator called when event associated with a socket occurs.
@@ -76,6 +96,9 @@ private:
     private:
         /// @brief Supplied callback.
         SocketCallbackFunction callback_;
+
+        /// @brief Strand in which the callback is invoked.
+        asiolink::IOStrandPtr strand_;
     };
 
 
@@ -92,12 +115,15 @@ public:
     /// create HTTP response from the HTTP request received.
     /// @param callback Callback invoked when new connection is accepted.
     /// @param request_timeout Configured timeout for a HTTP request.
+    /// @param idle_timeout Timeout after which the persistent connection
+    /// is closed if no new request is received.
     HttpConnection(asiolink::IOService& io_service,
                    HttpAcceptor& acceptor,
                    HttpConnectionPool& connection_pool,
                    const HttpResponseCreatorPtr& response_creator,
                    const HttpAcceptorCallback& callback,
-                   const long request_timeout);
+                   const long request_timeout,
+                   const long idle_timeout);
 
     /// @brief Destructor.
     ///
@@ -110,7 +136,11 @@ public:
     /// setup and the asynchronous read from the socket is started.
     void asyncAccept();
 
-    /// @brief Closes the socket.
+    /// @brief Closes the socket and cancels the timer.
+    ///
+    /// The pending handlers of the connection are called with the
+    /// @c boost::asio::error::operation_aborted error, which releases
+    /// the connection.
     void close();
 
     /// @brief Starts asynchronous read from the socket.
@@ -127,11 +157,27 @@ private:
 
     /// @brief Starts asynchronous write to the socket.
     ///
-    /// The @c output_buf_ must contain the data to be sent.
+    /// The @c output_buf_ must contain the data to be sent. When all data
+    /// have been sent, the persistent connection starts receiving the next
+    /// request and the other connections are stopped.
     ///
     /// In case of error the connection is stopped.
     void doWrite();
 
+    /// @brief Parses the received data and sends the response when the
+    /// whole request has been received.
+    ///
+    /// If the request is incomplete, it starts asynchronous read.
+    void processData();
+
+    /// @brief Prepares the connection for the next request.
+    ///
+    /// It creates the new request and parser. The data received after
+    /// the previous request are passed to the new parser. If there are no
+    /// such data, the idle timer is started and the connection waits for
+    /// the next request.
+    void startNextRequest();
+
     /// @brief Sends HTTP response asynchronously.
     ///
     /// Internally it calls @ref HttpConnection::doWrite to send the data.
@@ -172,26 +218,57 @@ private:
     /// and sends it to the client.
     void requestTimeoutCallback();
 
+    /// @brief Callback invoked when the idle timeout occurs.
+    ///
+    /// This callback stops the persistent connection on which no new
+    /// request has been received.
+    void idleTimeoutCallback();
+
     /// @brief Stops current connection.
     void stopThisConnection();
 
+    /// @brief Sets up the timer to call the connection's callback.
+    ///
+    /// The timer holds a weak pointer to the connection, so as the timer
+    /// doesn't prevent the connection from being destroyed.
+    ///
+    /// @param callback Member function invoked when the timer expires.
+    /// @param timeout Timeout in milliseconds.
+    void setupTimer(void (HttpConnection::*callback)(), const long timeout);
+
+    /// @brief Invokes the timer callback if the connection still exists.
+    ///
+    /// @param connection Weak pointer to the connection.
+    /// @param callback Member function to be invoked.
+    static void timerCallback(const boost::weak_ptr<HttpConnection>& connection,
+                              void (HttpConnection::*callback)());
+
     /// @brief returns remote address in textual form
     std::string getRemoteEndpointAddressAsText() const;
 
+    /// @brief Strand serializing the handlers of this connection.
+    asiolink::IOStrandPtr strand_;
+
     /// @brief Timer used to detect Request Timeout.
     asiolink::IntervalTimer request_timer_;
 
     /// @brief Configured Request Timeout in milliseconds.
     long request_timeout_;
 
-    /// @brief Socket used by this connection.
-    asiolink::TCPSocket<SocketCallback> socket_;
+    /// @brief Configured idle timeout of the persistent connection in
+    /// milliseconds.
+    long idle_timeout_;
+
+    /// @brief Indicates if the connection waits for the next request,
+    /// i.e. the idle timer is running.
+    bool idle_;
 
-    /// @brief Callback invoked when data received over the socket.
-    SocketCallback socket_callback_;
+    /// @brief Indicates if the connection should be kept open after
+    /// sending the current response.
+    bool persistent_;
 
-    /// @brief Callback invoked when data sent over the socket.
-    SocketCallback socket_write_callback_;
+    /// @brief Socket used by this connection.
+    asiolink::TCPSocket<SocketCallback> socket_;
 
     /// @brief Reference to the TCP acceptor used to accept new connections.
     HttpAcceptor& acceptor_;
@@ -213,7 +290,7 @@ private:
     HttpAcceptorCallback acceptor_callback_;
 
     /// @brief Buffer for received data.
-    std::array<char, 4096> buf_;
+    std::array<char, 32768> buf_;
 
     /// @brief Buffer used for outbound data.
     std::string output_buf_;
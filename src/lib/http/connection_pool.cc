@@ -6,23 +6,39 @@
 
 #include <asiolink/asio_wrapper.h>
 #include <http/connection_pool.h>
+#include <algorithm>
+
+using namespace isc::util::thread;
 
 namespace isc {
 namespace http {
 
 void
 HttpConnectionPool::start(const HttpConnectionPtr& connection) {
-    connections_.insert(connections_.end(), connection);
+    {
+        Mutex::Locker lock(mutex_);
+        connections_.insert(connections_.end(), connection);
+    }
     connection->asyncAccept();
 }
 
 void
 HttpConnectionPool::stop(const HttpConnectionPtr& connection) {
-    connections_.remove(connection);
+    {
+        Mutex::Locker lock(mutex_);
+        auto it = std::find(connections_.begin(), connections_.end(),
+                            connection);
+        if (it == connections_.end()) {
+            return;
+        }
+        connections_.erase(it);
+    }
+    connection->close();
 }
 
 void
 HttpConnectionPool::stopAll() {
+    Mutex::Locker lock(mutex_);
     for (auto connection = connections_.begin();
          connection != connections_.end();
          ++connection) {
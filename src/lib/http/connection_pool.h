@@ -8,6 +8,7 @@
 #define HTTP_CONNECTION_POOL_H
 
 #include <http/connection.h>
+#include <util/threads/sync.h>
 #include <list>
 
 namespace isc {
@@ -24,7 +25,9 @@ namespace http {
 /// is received.
 ///
 /// This object is a simple container for the server connections which provides
-/// means to terminate them on request.
+/// means to terminate them on request. The connections may be started and
+/// stopped by the handlers running in different threads, so the access to
+/// the container is protected with a mutex.
 class HttpConnectionPool {
 public:
 
@@ -38,12 +41,16 @@ public:
 
     /// @brief Stops a connection and removes it from the pool.
     ///
-    /// If the connection is not found in the pool, this method is no-op.
+    /// The connection's socket is closed. If the connection is not found
+    /// in the pool, this method is no-op.
     ///
     /// @param connection Pointer to the connection.
     void stop(const HttpConnectionPtr& connection);
 
     /// @brief Stops all connections and removes them from the pool.
+    ///
+    /// This method must not be called when the handlers of the connections
+    /// may be running in other threads.
     void stopAll();
 
 protected:
@@ -51,6 +58,9 @@ protected:
     /// @brief Set of connections.
     std::list<HttpConnectionPtr> connections_;
 
+    /// @brief Mutex protecting the set of connections.
+    util::thread::Mutex mutex_;
+
 };
 
 }
@@ -37,6 +37,8 @@ public:
     /// create @ref HttpResponseCreator instances.
     /// @param request_timeout Timeout after which the HTTP Request Timeout
     /// is generated.
+    /// @param idle_timeout Timeout after which the persistent connection is
+    /// closed if no new request is received.
     ///
     /// @throw HttpListenerError when any of the specified parameters is
     /// invalid.
@@ -44,7 +46,8 @@ public:
                      const asiolink::IOAddress& server_address,
                      const unsigned short server_port,
                      const HttpResponseCreatorFactoryPtr& creator_factory,
-                     const long request_timeout);
+                     const long request_timeout,
+                     const long idle_timeout);
 
     /// @brief Starts accepting new connections.
     ///
@@ -94,16 +97,20 @@ private:
 
     /// @brief Timeout for HTTP Request Timeout desired.
     long request_timeout_;
+
+    /// @brief Timeout after which the idle persistent connection is closed.
+    long idle_timeout_;
 };
 
 HttpListenerImpl::HttpListenerImpl(IOService& io_service,
                                    const asiolink::IOAddress& server_address,
                                    const unsigned short server_port,
                                    const HttpResponseCreatorFactoryPtr& creator_factory,
-                                   const long request_timeout)
+                                   const long request_timeout,
+                                   const long idle_timeout)
     : io_service_(io_service), acceptor_(io_service),
       endpoint_(), creator_factory_(creator_factory),
-      request_timeout_(request_timeout) {
+      request_timeout_(request_timeout), idle_timeout_(idle_timeout) {
     // Try creating an endpoint. This may cause exceptions.
     try {
         endpoint_.reset(new TCPEndpoint(server_address, server_port));
@@ -124,6 +131,12 @@ HttpListenerImpl::HttpListenerImpl(IOService& io_service,
         isc_throw(HttpListenerError, "Invalid desired HTTP request timeout "
                   << request_timeout_);
     }
+
+    // Idle persistent connection timeout is signed and must be greater than 0.
+    if (idle_timeout_ <= 0) {
+        isc_throw(HttpListenerError, "Invalid desired HTTP idle persistent"
+                  " connection timeout " << idle_timeout_);
+    }
 }
 
 void
@@ -161,7 +174,8 @@ HttpListenerImpl::accept() {
                                               connections_,
                                               response_creator,
                                               acceptor_callback,
-                                              request_timeout_));
+                                              request_timeout_,
+                                              idle_timeout_));
     // Add this new connection to the pool.
     connections_.start(conn);
 }
@@ -177,9 +191,11 @@ HttpListener::HttpListener(IOService& io_service,
                            const asiolink::IOAddress& server_address,
                            const unsigned short server_port,
                            const HttpResponseCreatorFactoryPtr& creator_factory,
-                           const long request_timeout)
+                           const long request_timeout,
+                           const long idle_timeout)
     : impl_(new HttpListenerImpl(io_service, server_address, server_port,
-                                 creator_factory, request_timeout)) {
+                                 creator_factory, request_timeout,
+                                 idle_timeout)) {
 }
 
 HttpListener::~HttpListener() {
@@ -45,6 +45,11 @@ class HttpListenerImpl;
 /// HTTP request and sending appropriate response. The listener can handle
 /// many HTTP connections simultaneously.
 ///
+/// The connections are persistent unless the client asks to close them,
+/// i.e. the client may send many requests over the same connection. The
+/// connection on which no new request is received within the idle timeout
+/// is closed by the server.
+///
 /// When the @ref HttpListener::stop is invoked, all active connections are
 /// closed and the listener stops accepting new connections.
 class HttpListener {
@@ -66,6 +71,8 @@ public:
     /// create @ref HttpResponseCreator instances.
     /// @param request_timeout Timeout after which the HTTP Request Timeout
     /// is generated.
+    /// @param idle_timeout Timeout after which the persistent connection is
+    /// closed if no new request is received.
     ///
     /// @throw HttpListenerError when any of the specified parameters is
     /// invalid.
@@ -73,7 +80,8 @@ public:
                  const asiolink::IOAddress& server_address,
                  const unsigned short server_port,
                  const HttpResponseCreatorFactoryPtr& creator_factory,
-                 const long request_timeout);
+                 const long request_timeout,
+                 const long idle_timeout);
 
     /// @brief Destructor.
     ///
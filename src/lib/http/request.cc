@@ -185,6 +185,25 @@ HttpRequest::getBody() const {
     return (context_->body_);
 }
 
+bool
+HttpRequest::isPersistent() const {
+    checkCreated();
+
+    // The header names are case insensitive.
+    std::string connection;
+    for (auto header = headers_.begin(); header != headers_.end(); ++header) {
+        if (boost::iequals(header->first, "Connection")) {
+            connection = boost::to_lower_copy(header->second);
+            break;
+        }
+    }
+
+    if (getHttpVersion() < HttpVersion(1, 1)) {
+        return (connection.find("keep-alive") != std::string::npos);
+    }
+    return (connection.find("close") == std::string::npos);
+}
+
 void
 HttpRequest::checkCreated() const {
     if (!created_) {
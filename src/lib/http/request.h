@@ -197,6 +197,16 @@ public:
     /// @brief Returns HTTP message body as string.
     std::string getBody() const;
 
+    /// @brief Checks if the connection should be kept open after sending
+    /// the response to this request.
+    ///
+    /// The HTTP/1.1 connections are persistent unless the client sends the
+    /// "Connection: close" header. The HTTP/1.0 connections are persistent
+    /// only if the client sends the "Connection: keep-alive" header.
+    ///
+    /// @return true if the connection should be kept open, false otherwise.
+    bool isPersistent() const;
+
     /// @brief Checks if the request has been successfully finalized.
     ///
     /// The request is gets finalized on successfull call to
@@ -1,4 +1,4 @@
-// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+// Copyright (C) 2016-2017 Internet Systems Consortium, Inc. ("ISC")
 //
 // This Source Code Form is subject to the terms of the Mozilla Public
 // License, v. 2.0. If a copy of the MPL was not distributed with this
@@ -6,8 +6,8 @@
 
 #include <http/request_parser.h>
 #include <boost/bind.hpp>
+#include <algorithm>
 #include <cctype>
-#include <iostream>
 
 using namespace isc::util;
 
@@ -45,7 +45,7 @@ const int HttpRequestParser::HTTP_PARSE_OK_EVT;
 const int HttpRequestParser::HTTP_PARSE_FAILED_EVT;
 
 HttpRequestParser::HttpRequestParser(HttpRequest& request)
-    : StateModel(), buffer_(), request_(request),
+    : StateModel(), buffer_(), buffer_pos_(0), request_(request),
       context_(request_.context()), error_message_() {
 }
 
@@ -97,11 +97,20 @@ HttpRequestParser::postBuffer(const void* buf, const size_t buf_size) {
         if (getNextEvent() == NEED_MORE_DATA_EVT) {
             transition(getCurrState(), MORE_DATA_PROVIDED_EVT);
         }
-        buffer_.insert(buffer_.end(), static_cast<const char*>(buf),
-                       static_cast<const char*>(buf) + buf_size);
+        // Drop the data which have been already parsed.
+        if (buffer_pos_ > 0) {
+            buffer_.erase(0, buffer_pos_);
+            buffer_pos_ = 0;
+        }
+        buffer_.append(static_cast<const char*>(buf), buf_size);
     }
 }
 
+std::string
+HttpRequestParser::getUnparsedData() const {
+    return (buffer_.substr(buffer_pos_));
+}
+
 void
 HttpRequestParser::defineEvents() {
     StateModel::defineEvents();
@@ -158,7 +167,7 @@ HttpRequestParser::defineStates() {
 
     defineState(HTTP_VERSION_SLASH_ST, "HTTP_VERSION_SLASH_ST",
                 boost::bind(&HttpRequestParser::versionHTTPHandler, this, '/',
-                            HTTP_VERSION_MAJOR_ST));
+                            HTTP_VERSION_MAJOR_START_ST));
 
     defineState(HTTP_VERSION_MAJOR_START_ST, "HTTP_VERSION_MAJOR_START_ST",
                 boost::bind(&HttpRequestParser::versionNumberStartHandler, this,
@@ -349,9 +358,12 @@ HttpRequestParser::uriHandler() {
             parseFailure("control character found in HTTP URI");
 
         } else {
-            // Still parsing the URI. Append the next character to the
-            // method name.
+            // Still parsing the URI. Append the next character and all
+            // following characters of the URI received so far.
             context_->uri_.push_back(c);
+            appendFromBuffer(context_->uri_, [this](const char next) {
+                return ((next != ' ') && !isCtl(next));
+            });
             transition(HTTP_URI_ST, DATA_READ_OK_EVT);
         }
     });
@@ -415,6 +427,7 @@ HttpRequestParser::versionNumberHandler(const char following_character,
         } else if (isdigit(c)) {
             // Current character is a digit, so update the version number.
             *storage = *storage * 10 + c - '0';
+            transition(getCurrState(), DATA_READ_OK_EVT);
 
         } else {
             parseFailure("expected digit in HTTP version, found " +
@@ -535,6 +548,10 @@ HttpRequestParser::headerNameHandler() {
         } else {
             // Parsing a header name, so update it.
             context_->headers_.back().name_.push_back(c);
+            appendFromBuffer(context_->headers_.back().name_,
+                             [this](const char next) {
+                return (isChar(next) && !isCtl(next) && !isSpecial(next));
+            });
             transition(getCurrState(), DATA_READ_OK_EVT);
         }
     });
@@ -579,6 +596,10 @@ HttpRequestParser::headerValueHandler() {
         } else {
             // Still parsing the value, so let's update it.
             context_->headers_.back().value_.push_back(c);
+            appendFromBuffer(context_->headers_.back().value_,
+                             [this](const char next) {
+                return (!isCtl(next));
+            });
             transition(HEADER_VALUE_ST, DATA_READ_OK_EVT);
         }
     });
@@ -588,10 +609,19 @@ void
 HttpRequestParser::bodyHandler() {
     stateWithReadHandler("bodyHandler", [this](const char c) {
         // We don't validate the body at this stage. Simply record the
-        // number of characters specified within "Content-Length".
+        // number of characters specified within "Content-Length". Take
+        // as much of the body as has been received so far.
         context_->body_.push_back(c);
-        if (context_->body_.length() <
-            request_.getHeaderValueAsUint64("Content-Length")) {
+        const uint64_t content_length =
+            request_.getHeaderValueAsUint64("Content-Length");
+        if (context_->body_.length() < content_length) {
+            const size_t length =
+                std::min(static_cast<uint64_t>(buffer_.size() - buffer_pos_),
+                         content_length - context_->body_.length());
+            context_->body_.append(buffer_, buffer_pos_, length);
+            buffer_pos_ += length;
+        }
+        if (context_->body_.length() < content_length) {
             transition(HTTP_BODY_ST, DATA_READ_OK_EVT);
         } else {
             transition(HTTP_PARSE_OK_ST, HTTP_PARSE_OK_EVT);
@@ -619,14 +649,24 @@ HttpRequestParser::parseEndedHandler() {
 bool
 HttpRequestParser::popNextFromBuffer(char& next) {
     // If there are any characters in the buffer, pop next.
-    if (!buffer_.empty()) {
-        next = buffer_.front();
-        buffer_.pop_front();
+    if (buffer_pos_ < buffer_.size()) {
+        next = buffer_[buffer_pos_++];
         return (true);
     }
     return (false);
 }
 
+template<typename Predicate>
+void
+HttpRequestParser::appendFromBuffer(std::string& value, Predicate accept) {
+    size_t end = buffer_pos_;
+    while ((end < buffer_.size()) && accept(buffer_[end])) {
+        ++end;
+    }
+    value.append(buffer_, buffer_pos_, end - buffer_pos_);
+    buffer_pos_ = end;
+}
+
 
 bool
 HttpRequestParser::isChar(const char c) const {
@@ -12,7 +12,6 @@
 #include <util/state_model.h>
 #include <boost/function.hpp>
 #include <boost/shared_ptr.hpp>
-#include <list>
 #include <stdint.h>
 #include <string>
 
@@ -89,7 +88,15 @@ typedef boost::shared_ptr<HttpRequestParser> HttpRequestParserPtr;
 /// constitute the HTTP request and not parse the extraneous data. The caller
 /// should test the @ref HttpRequestParser::needData and
 /// @ref HttpRequestParser::httpParseOk to determine whether parsing has
-/// completed.
+/// completed. The extraneous data, e.g. the next request pipelined by the
+/// client, can be retrieved with @ref HttpRequestParser::getUnparsedData and
+/// provided to the parser of the next request.
+///
+/// The parser keeps the received data in a contiguous buffer. The states
+/// parsing the variable length parts of the request, i.e. URI, header names
+/// and values, and body, consume all characters available in the buffer
+/// which belong to the parsed part at once, rather than running the state
+/// model for each character.
 ///
 /// The @ref util::StateModel::runModel must not be used to run the
 /// @ref HttpRequestParser state machine, thus it is made private method.
@@ -249,6 +256,14 @@ public:
     /// @param buf_size Size of the data within the buffer.
     void postBuffer(const void* buf, const size_t buf_size);
 
+    /// @brief Returns the data which haven't been parsed.
+    ///
+    /// When the parsing is completed, these are the data received after
+    /// the end of the parsed request, e.g. the next pipelined request.
+    ///
+    /// @return Unparsed data.
+    std::string getUnparsedData() const;
+
 private:
 
     /// @brief Make @ref runModel private to make sure that the caller uses
@@ -428,6 +443,15 @@ private:
     /// @return true if character was successfully read, false otherwise.
     bool popNextFromBuffer(char& next);
 
+    /// @brief Moves the characters from the buffer to the specified string
+    /// as long as they are accepted by the predicate.
+    ///
+    /// @param [out] value String to which the characters are appended.
+    /// @param accept Predicate returning true for the characters which
+    /// should be appended.
+    template<typename Predicate>
+    void appendFromBuffer(std::string& value, Predicate accept);
+
     /// @brief Checks if specified value is a character.
     ///
     /// @return true, if specified value is a character.
@@ -444,7 +468,10 @@ private:
     bool isSpecial(const char c) const;
 
     /// @brief Internal buffer from which parser reads data.
-    std::list<char> buffer_;
+    std::string buffer_;
+
+    /// @brief Position of the next character to be read from the buffer.
+    size_t buffer_pos_;
 
     /// @brief Reference to the request object specified in the constructor.
     HttpRequest& request_;
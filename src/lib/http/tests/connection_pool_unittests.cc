@@ -114,12 +114,12 @@ TEST_F(HttpConnectionPoolTest, startStop) {
                                                connection_pool_,
                                                response_creator_,
                                                HttpAcceptorCallback(),
-                                               1000));
+                                               1000, 1000));
     HttpConnectionPtr conn2(new HttpConnection(io_service_, acceptor_,
                                                connection_pool_,
                                                response_creator_,
                                                HttpAcceptorCallback(),
-                                               1000));
+                                               1000, 1000));
     // The pool should be initially empty.
     TestHttpConnectionPool pool;
     ASSERT_TRUE(pool.connections_.empty());
@@ -152,12 +152,12 @@ TEST_F(HttpConnectionPoolTest, stopAll) {
                                                connection_pool_,
                                                response_creator_,
                                                HttpAcceptorCallback(),
-                                               1000));
+                                               1000, 1000));
     HttpConnectionPtr conn2(new HttpConnection(io_service_, acceptor_,
                                                connection_pool_,
                                                response_creator_,
                                                HttpAcceptorCallback(),
-                                               1000));
+                                               1000, 1000));
     TestHttpConnectionPool pool;
     ASSERT_NO_THROW(pool.start(conn1));
     ASSERT_NO_THROW(pool.start(conn2));
@@ -176,12 +176,12 @@ TEST_F(HttpConnectionPoolTest, stopInvalid) {
                                                connection_pool_,
                                                response_creator_,
                                                HttpAcceptorCallback(),
-                                               1000));
+                                               1000, 1000));
     HttpConnectionPtr conn2(new HttpConnection(io_service_, acceptor_,
                                                connection_pool_,
                                                response_creator_,
                                                HttpAcceptorCallback(),
-                                               1000));
+                                               1000, 1000));
     TestHttpConnectionPool pool;
     ASSERT_NO_THROW(pool.start(conn1));
     ASSERT_NO_THROW(pool.stop(conn2));
@@ -19,6 +19,9 @@
 #include <gtest/gtest.h>
 #include <list>
 #include <string>
+#include <vector>
+#include <sys/socket.h>
+#include <sys/time.h>
 
 using namespace boost::asio::ip;
 using namespace isc::asiolink;
@@ -36,6 +39,9 @@ const unsigned short SERVER_PORT = 18123;
 /// @brief Request Timeout used in most of the tests (ms).
 const long REQUEST_TIMEOUT = 10000;
 
+/// @brief Persistent connection idle timeout used in most of the tests (ms).
+const long IDLE_TIMEOUT = 10000;
+
 /// @brief Test timeout (ms).
 const long TEST_TIMEOUT = 10000;
 
@@ -116,7 +122,7 @@ public:
     /// @param io_service IO service to be stopped on error.
     explicit HttpClient(IOService& io_service)
         : io_service_(io_service.get_io_service()), socket_(io_service_),
-          buf_(), response_() {
+          buf_(), response_(), expected_responses_(1), closed_(false) {
     }
 
     /// @brief Destructor.
@@ -193,6 +199,13 @@ public:
                     return;
                 }
 
+                // The server has closed the connection.
+                if (ec == boost::asio::error::eof) {
+                    closed_ = true;
+                    io_service_.stop();
+                    return;
+                }
+
                 // Error occurred, bail...
                 ADD_FAILURE() << "error occurred while receiving HTTP"
                     " response from the server: " << ec.message();
@@ -206,7 +219,7 @@ public:
 
             // Two consecutive new lines end the part of the response we're
             // expecting.
-            if (response_.find("\r\n\r\n", 0) != std::string::npos) {
+            if (countResponses() >= expected_responses_) {
                 io_service_.stop();
 
             } else {
@@ -225,8 +238,35 @@ public:
         return (response_);
     }
 
+    /// @brief Sets the number of responses to be received before the
+    /// IO service is stopped.
+    ///
+    /// @param expected_responses Number of expected responses.
+    void setExpectedResponses(const size_t expected_responses) {
+        expected_responses_ = expected_responses;
+    }
+
+    /// @brief Checks if the server has closed the connection.
+    bool isClosed() const {
+        return (closed_);
+    }
+
 private:
 
+    /// @brief Returns the number of responses received so far.
+    ///
+    /// The responses used in the tests have no body or have a body which
+    /// is not followed by two new lines, so the number of responses is the
+    /// number of two consecutive new lines.
+    size_t countResponses() const {
+        size_t count = 0;
+        for (size_t pos = response_.find("\r\n\r\n"); pos != std::string::npos;
+             pos = response_.find("\r\n\r\n", pos + 4)) {
+            ++count;
+        }
+        return (count);
+    }
+
     /// @brief Holds reference to the IO service.
     boost::asio::io_service& io_service_;
 
@@ -238,6 +278,13 @@ private:
 
     /// @brief Response in the textual format.
     std::string response_;
+
+    /// @brief Number of responses to be received before the IO service
+    /// is stopped.
+    size_t expected_responses_;
+
+    /// @brief Indicates if the server has closed the connection.
+    bool closed_;
 };
 
 /// @brief Pointer to the HttpClient.
@@ -277,6 +324,13 @@ public:
         clients_.back()->startRequest(request);
     }
 
+    /// @brief Runs the IO service until it is stopped by the client
+    /// or the test timer.
+    void runIOService() {
+        io_service_.get_io_service().reset();
+        io_service_.run();
+    }
+
     /// @brief Callback function invoke upon test timeout.
     ///
     /// It stops the IO service and reports test timeout.
@@ -307,7 +361,7 @@ TEST_F(HttpListenerTest, listen) {
         "{ }";
 
     HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
-                          factory_, REQUEST_TIMEOUT);
+                          factory_, REQUEST_TIMEOUT, IDLE_TIMEOUT);
     ASSERT_NO_THROW(listener.start());
     ASSERT_NO_THROW(startRequest(request));
     ASSERT_NO_THROW(io_service_.run());
@@ -327,7 +381,7 @@ TEST_F(HttpListenerTest, listen) {
 // This test verifies that the HTTP listener can't be started twice.
 TEST_F(HttpListenerTest, startTwice) {
     HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
-                          factory_, REQUEST_TIMEOUT);
+                          factory_, REQUEST_TIMEOUT, IDLE_TIMEOUT);
     ASSERT_NO_THROW(listener.start());
     EXPECT_THROW(listener.start(), HttpListenerError);
 }
@@ -342,7 +396,7 @@ TEST_F(HttpListenerTest, badRequest) {
         "{ }";
 
     HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
-                          factory_, REQUEST_TIMEOUT);
+                          factory_, REQUEST_TIMEOUT, IDLE_TIMEOUT);
     ASSERT_NO_THROW(listener.start());
     ASSERT_NO_THROW(startRequest(request));
     ASSERT_NO_THROW(io_service_.run());
@@ -350,6 +404,7 @@ TEST_F(HttpListenerTest, badRequest) {
     HttpClientPtr client = *clients_.begin();
     ASSERT_TRUE(client);
     EXPECT_EQ("HTTP/1.1 400 Bad Request\r\n"
+              "Connection: close\r\n"
               "Content-Length: 40\r\n"
               "Content-Type: application/json\r\n"
               "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
@@ -363,7 +418,7 @@ TEST_F(HttpListenerTest, badRequest) {
 TEST_F(HttpListenerTest, invalidFactory) {
     EXPECT_THROW(HttpListener(io_service_, IOAddress(SERVER_ADDRESS),
                               SERVER_PORT, HttpResponseCreatorFactoryPtr(),
-                              REQUEST_TIMEOUT),
+                              REQUEST_TIMEOUT, IDLE_TIMEOUT),
                  HttpListenerError);
 }
 
@@ -371,7 +426,15 @@ TEST_F(HttpListenerTest, invalidFactory) {
 // Request Timeout.
 TEST_F(HttpListenerTest, invalidRequestTimeout) {
     EXPECT_THROW(HttpListener(io_service_, IOAddress(SERVER_ADDRESS),
-                              SERVER_PORT, factory_, 0),
+                              SERVER_PORT, factory_, 0, IDLE_TIMEOUT),
+                 HttpListenerError);
+}
+
+// This test verifies that the timeout of 0 can't be specified for the
+// idle persistent connection timeout.
+TEST_F(HttpListenerTest, invalidIdleTimeout) {
+    EXPECT_THROW(HttpListener(io_service_, IOAddress(SERVER_ADDRESS),
+                              SERVER_PORT, factory_, REQUEST_TIMEOUT, 0),
                  HttpListenerError);
 }
 
@@ -389,7 +452,8 @@ TEST_F(HttpListenerTest, addressInUse) {
     // Listener should report an error when we try to start it because another
     // acceptor is bound to that port and address.
     HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS),
-                          SERVER_PORT + 1, factory_, REQUEST_TIMEOUT);
+                          SERVER_PORT + 1, factory_, REQUEST_TIMEOUT,
+                          IDLE_TIMEOUT);
     EXPECT_THROW(listener.start(), HttpListenerError);
 }
 
@@ -405,7 +469,7 @@ TEST_F(HttpListenerTest, requestTimeout) {
     // Open the listener with the Request Timeout of 1 sec and post the
     // partial request.
     HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
-                          factory_, 1000);
+                          factory_, 1000, IDLE_TIMEOUT);
     ASSERT_NO_THROW(listener.start());
     ASSERT_NO_THROW(startRequest(request));
     ASSERT_NO_THROW(io_service_.run());
@@ -417,6 +481,7 @@ TEST_F(HttpListenerTest, requestTimeout) {
     // The missing part never arrives so the server should respond with the
     // HTTP Request Timeout status.
     EXPECT_EQ("HTTP/1.1 408 Request Timeout\r\n"
+              "Connection: close\r\n"
               "Content-Length: 44\r\n"
               "Content-Type: application/json\r\n"
               "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
@@ -425,4 +490,203 @@ TEST_F(HttpListenerTest, requestTimeout) {
               client->getResponse());
 }
 
+// This test verifies that the HTTP/1.1 connection is kept open after
+// sending the response and can be used to send the next request.
+TEST_F(HttpListenerTest, persistentConnection) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+    const std::string response = "HTTP/1.1 200 OK\r\n"
+        "Content-Length: 0\r\n"
+        "Content-Type: application/json\r\n"
+        "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+        "\r\n";
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT, IDLE_TIMEOUT);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    ASSERT_TRUE(client);
+    EXPECT_EQ(response, client->getResponse());
+
+    // Send the next request over the same connection.
+    ASSERT_NO_THROW(client->sendRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    EXPECT_FALSE(client->isClosed());
+    EXPECT_EQ(response, client->getResponse());
+    listener.stop();
+    io_service_.poll();
+}
+
+// This test verifies that the requests sent over the connection without
+// waiting for the responses are all processed and the responses are sent
+// in order.
+TEST_F(HttpListenerTest, pipelinedRequests) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+    // The second request is malformed, so the server should respond with
+    // Bad Request and close the connection.
+    const std::string bad_request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: foo\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT, IDLE_TIMEOUT);
+    ASSERT_NO_THROW(listener.start());
+    HttpClientPtr client(new HttpClient(io_service_));
+    clients_.push_back(client);
+    // The connection is closed after the response to the malformed
+    // request, so read until the end of the data sent by the server.
+    client->setExpectedResponses(4);
+    ASSERT_NO_THROW(client->startRequest(request + request + bad_request));
+    ASSERT_NO_THROW(runIOService());
+    EXPECT_TRUE(client->isClosed());
+
+    EXPECT_EQ("HTTP/1.1 200 OK\r\n"
+              "Content-Length: 0\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n"
+              "HTTP/1.1 200 OK\r\n"
+              "Content-Length: 0\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n"
+              "HTTP/1.1 400 Bad Request\r\n"
+              "Connection: close\r\n"
+              "Content-Length: 40\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n"
+              "{ \"result\": 400, \"text\": \"Bad Request\" }",
+              client->getResponse());
+}
+
+// This test verifies that the connection is closed after sending the
+// response when the client asks for it.
+TEST_F(HttpListenerTest, connectionClose) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Connection: close\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT, IDLE_TIMEOUT);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    ASSERT_TRUE(client);
+    EXPECT_EQ("HTTP/1.1 200 OK\r\n"
+              "Connection: close\r\n"
+              "Content-Length: 0\r\n"
+              "Content-Type: application/json\r\n"
+              "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+              "\r\n",
+              client->getResponse());
+
+    // The server should close the connection.
+    ASSERT_NO_THROW(client->receivePartialResponse());
+    ASSERT_NO_THROW(runIOService());
+    EXPECT_TRUE(client->isClosed());
+}
+
+// This test verifies that the persistent connection is closed when no
+// new request is received within the idle timeout.
+TEST_F(HttpListenerTest, idleTimeout) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+
+    // Open the listener with the idle timeout of 1 sec.
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT, 1000);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(startRequest(request));
+    ASSERT_NO_THROW(runIOService());
+    ASSERT_EQ(1, clients_.size());
+    HttpClientPtr client = *clients_.begin();
+    ASSERT_TRUE(client);
+    EXPECT_FALSE(client->isClosed());
+
+    // No more requests are sent, so the server should close the connection
+    // after 1 second.
+    ASSERT_NO_THROW(client->receivePartialResponse());
+    ASSERT_NO_THROW(runIOService());
+    EXPECT_TRUE(client->isClosed());
+}
+
+// This test verifies that the requests received over many connections are
+// handled when the IO service is run by many threads.
+TEST_F(HttpListenerTest, multipleThreads) {
+    const std::string request = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "Content-Length: 3\r\n\r\n"
+        "{ }";
+    const std::string response = "HTTP/1.1 200 OK\r\n"
+        "Content-Length: 0\r\n"
+        "Content-Type: application/json\r\n"
+        "Date: Tue, 19 Dec 2016 18:53:35 GMT\r\n"
+        "\r\n";
+    const size_t connections = 10;
+    const size_t requests = 5;
+
+    HttpListener listener(io_service_, IOAddress(SERVER_ADDRESS), SERVER_PORT,
+                          factory_, REQUEST_TIMEOUT, IDLE_TIMEOUT);
+    ASSERT_NO_THROW(listener.start());
+    ASSERT_NO_THROW(io_service_.startThreads(4));
+
+    // The clients use blocking sockets, because the IO service is run
+    // by the server threads.
+    boost::asio::io_service client_io_service;
+    std::vector<boost::shared_ptr<tcp::socket> > sockets;
+    std::string pipelined;
+    for (size_t i = 0; i < requests; ++i) {
+        pipelined += request;
+    }
+    for (size_t i = 0; i < connections; ++i) {
+        boost::shared_ptr<tcp::socket> socket(new tcp::socket(client_io_service));
+        socket->connect(tcp::endpoint(address::from_string(SERVER_ADDRESS),
+                                      SERVER_PORT));
+        // Don't wait forever if the server doesn't respond.
+        struct timeval tv;
+        tv.tv_sec = TEST_TIMEOUT / 1000;
+        tv.tv_usec = 0;
+        setsockopt(socket->native_handle(), SOL_SOCKET, SO_RCVTIMEO, &tv,
+                   sizeof(tv));
+        boost::asio::write(*socket, boost::asio::buffer(pipelined));
+        sockets.push_back(socket);
+    }
+
+    std::string expected;
+    for (size_t i = 0; i < requests; ++i) {
+        expected += response;
+    }
+    for (size_t i = 0; i < connections; ++i) {
+        std::string received;
+        std::array<char, 8192> buf;
+        while (received.size() < expected.size()) {
+            boost::system::error_code ec;
+            size_t length = sockets[i]->read_some(boost::asio::buffer(buf), ec);
+            ASSERT_FALSE(ec) << "connection " << i << ": " << ec.message();
+            received.append(buf.data(), length);
+        }
+        EXPECT_EQ(expected, received);
+    }
+
+    ASSERT_NO_THROW(io_service_.stopThreads());
+    listener.stop();
+    io_service_.poll();
+}
+
 }
@@ -171,6 +171,67 @@ TEST_F(HttpRequestParserTest, extraneousDataInRequest) {
     EXPECT_TRUE(parser.getErrorMessage().empty());
 }
 
+// This test verifies that the data following the parsed request, e.g. the
+// next pipelined request, are returned as unparsed and can be parsed by
+// another parser.
+TEST_F(HttpRequestParserTest, pipelinedRequests) {
+    std::string http_req = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n";
+    std::string json1 = "{ \"service\": \"dhcp4\", \"command\": \"shutdown\" }";
+    std::string json2 = "{ \"command\": \"list-commands\" }";
+    std::string http_req2 = createRequestString(http_req, json2);
+    http_req = createRequestString(http_req, json1) + http_req2;
+
+    PostHttpRequestJson request1;
+    HttpRequestParser parser1(request1);
+    ASSERT_NO_THROW(parser1.initModel());
+    parser1.postBuffer(&http_req[0], http_req.size());
+    ASSERT_NO_THROW(parser1.poll());
+    ASSERT_TRUE(parser1.httpParseOk());
+    EXPECT_EQ(json1, request1.getBody());
+
+    // The second request hasn't been parsed.
+    std::string unparsed = parser1.getUnparsedData();
+    EXPECT_EQ(http_req2, unparsed);
+
+    // Let's parse it with the new parser.
+    PostHttpRequestJson request2;
+    HttpRequestParser parser2(request2);
+    ASSERT_NO_THROW(parser2.initModel());
+    parser2.postBuffer(&unparsed[0], unparsed.size());
+    ASSERT_NO_THROW(parser2.poll());
+    ASSERT_TRUE(parser2.httpParseOk());
+    EXPECT_EQ(json2, request2.getBody());
+    EXPECT_TRUE(parser2.getUnparsedData().empty());
+}
+
+// This test verifies that the request is parsed correctly when it is
+// received one byte at a time.
+TEST_F(HttpRequestParserTest, byteByByte) {
+    std::string http_req = "POST /foo/bar HTTP/1.1\r\n"
+        "Content-Type: application/json\r\n"
+        "X-Folded: first\r\n second\r\n";
+    std::string json = "{ \"service\": \"dhcp4\", \"command\": \"shutdown\" }";
+    http_req = createRequestString(http_req, json);
+
+    PostHttpRequestJson request;
+    HttpRequestParser parser(request);
+    ASSERT_NO_THROW(parser.initModel());
+
+    for (size_t i = 0; i < http_req.size(); ++i) {
+        ASSERT_FALSE(parser.httpParseOk());
+        parser.postBuffer(&http_req[i], 1);
+        ASSERT_NO_THROW(parser.poll());
+    }
+
+    ASSERT_FALSE(parser.needData());
+    ASSERT_TRUE(parser.httpParseOk());
+    EXPECT_EQ("/foo/bar", request.getUri());
+    EXPECT_EQ("application/json", request.getHeaderValue("Content-Type"));
+    EXPECT_EQ("firstsecond", request.getHeaderValue("X-Folded"));
+    EXPECT_EQ(json, request.getBody());
+}
+
 
 // This test verifies that LWS is parsed correctly. The LWS marks line breaks
 // in the HTTP header values.
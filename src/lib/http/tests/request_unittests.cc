@@ -149,6 +149,31 @@ TEST_F(HttpRequestTest, getBody) {
     EXPECT_EQ(json_body, request_.getBody());
 }
 
+// This test verifies that the HTTP/1.1 connections are persistent unless
+// the client asks to close them and the HTTP/1.0 connections are persistent
+// only when the client asks to keep them open.
+TEST_F(HttpRequestTest, isPersistent) {
+    setContextBasics("GET", "/isc/org", HttpVersion(1, 1));
+    ASSERT_NO_THROW(request_.create());
+    EXPECT_TRUE(request_.isPersistent());
+
+    request_.reset();
+    addHeaderToContext("Connection", "Close");
+    ASSERT_NO_THROW(request_.create());
+    EXPECT_FALSE(request_.isPersistent());
+
+    request_.reset();
+    request_.context()->headers_.clear();
+    setContextBasics("GET", "/isc/org", HttpVersion(1, 0));
+    ASSERT_NO_THROW(request_.create());
+    EXPECT_FALSE(request_.isPersistent());
+
+    request_.reset();
+    addHeaderToContext("connection", "Keep-Alive");
+    ASSERT_NO_THROW(request_.create());
+    EXPECT_TRUE(request_.isPersistent());
+}
+
 TEST_F(HttpRequestTest, requiresBody) {
     ASSERT_FALSE(request_.requiresBody());
     request_.requireHeader("Content-Length");
@@ -10,6 +10,7 @@
 #include <asiolink/io_service.h>
 #include <cc/data.h>
 #include <process/d_cfg_mgr.h>
+#include <util/threads/sync.h>
 
 #include <boost/shared_ptr.hpp>
 
@@ -145,16 +146,35 @@ public:
 
     /// @brief Checks if the process has been instructed to shut down.
     ///
+    /// The flag may be set by the handlers run by other threads, so it
+    /// is protected with the mutex.
+    ///
     /// @return true if process shutdown flag is true.
     bool shouldShutdown() const {
+        util::thread::Mutex::Locker lock(shut_down_mutex_);
         return (shut_down_flag_);
     }
 
     /// @brief Sets the process shut down flag to the given value.
     ///
+    /// The thread waiting in @ref waitForShutdown is woken up.
+    ///
     /// @param value is the new value to assign the flag.
     void setShutdownFlag(bool value) {
+        util::thread::Mutex::Locker lock(shut_down_mutex_);
         shut_down_flag_ = value;
+        shut_down_cond_.signal();
+    }
+
+    /// @brief Waits until the process is instructed to shut down.
+    ///
+    /// This is used by the process which doesn't run the IO service in
+    /// the calling thread, when all handlers are run by other threads.
+    void waitForShutdown() {
+        util::thread::Mutex::Locker lock(shut_down_mutex_);
+        while (!shut_down_flag_) {
+            shut_down_cond_.wait(shut_down_mutex_);
+        }
     }
 
     /// @brief Fetches the application name.
@@ -197,6 +217,12 @@ private:
     /// @brief Boolean flag set when shutdown has been requested.
     bool shut_down_flag_;
 
+    /// @brief Mutex protecting the shutdown flag.
+    mutable util::thread::Mutex shut_down_mutex_;
+
+    /// @brief Condition variable signaled when the shutdown flag is set.
+    util::thread::CondVar shut_down_cond_;
+
     /// @brief  Pointer to the configuration manager.
     DCfgMgrBasePtr cfg_mgr_;
 };
@@ -161,6 +161,37 @@ CSVFile::append(const CSVRow& row) const {
     }
 }
 
+void
+CSVFile::append(const std::vector<CSVRow>& rows) const {
+    checkStreamStatusAndReset("append");
+
+    for (std::vector<CSVRow>::const_iterator row = rows.begin();
+         row != rows.end(); ++row) {
+        if (row->getValuesCount() != getColumnCount()) {
+            isc_throw(CSVFileError, "number of values in the CSV row '"
+                      << row->getValuesCount() << "' doesn't match the number"
+                      " of columns in the CSV file '" << getColumnCount()
+                      << "'");
+        }
+    }
+
+    // See the comment in the append function writing single row.
+    fs_->seekp(0, std::ios_base::end);
+    fs_->seekg(0, std::ios_base::end);
+    fs_->clear();
+
+    for (std::vector<CSVRow>::const_iterator row = rows.begin();
+         row != rows.end(); ++row) {
+        *fs_ << row->render() << "\n";
+    }
+    fs_->flush();
+    if (!fs_->good()) {
+        fs_->clear();
+        isc_throw(CSVFileError, "failed to write " << rows.size()
+                  << " CSV rows to the file '" << filename_ << "'");
+    }
+}
+
 void
 CSVFile::checkStreamStatusAndReset(const std::string& operation) const {
     if (!fs_) {
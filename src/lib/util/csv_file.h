@@ -317,6 +317,19 @@ public:
     /// size of the row doesn't match the number of columns.
     void append(const CSVRow& row) const;
 
+    /// @brief Writes multiple CSV rows into the file.
+    ///
+    /// The rows are written to the file and the file is flushed once, after
+    /// the last row, rather than after each row. This significantly speeds
+    /// up writing large number of rows. The sizes of all rows are checked
+    /// before writing any of them.
+    ///
+    /// @param rows Collection of the rows to be written.
+    ///
+    /// @throw CSVFileError When error occurred during IO operation or if the
+    /// size of any row doesn't match the number of columns.
+    void append(const std::vector<CSVRow>& rows) const;
+
     /// @brief Closes the CSV file.
     void close();
 
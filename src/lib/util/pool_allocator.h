@@ -0,0 +1,394 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#ifndef POOL_ALLOCATOR_H
+#define POOL_ALLOCATOR_H
+
+#include <util/threads/sync.h>
+#include <boost/noncopyable.hpp>
+#include <cstddef>
+#include <new>
+
+namespace isc {
+namespace util {
+
+/// @brief Statistics of all free lists.
+///
+/// The free lists for different block sizes are distinct types. This
+/// class counts the system allocations made by all of them, so as the
+/// caller can verify that an operation doesn't allocate new blocks,
+/// whatever the sizes of the objects it creates.
+class BlockFreeListStats : public boost::noncopyable {
+public:
+
+    /// @brief Returns the statistics object.
+    static BlockFreeListStats& instance() {
+        static BlockFreeListStats* stats = new BlockFreeListStats();
+        return (*stats);
+    }
+
+    /// @brief Counts the block allocated by the system allocator.
+    void countSystemAlloc() {
+        thread::Mutex::Locker lock(mutex_);
+        ++system_alloc_count_;
+    }
+
+    /// @brief Returns the number of blocks allocated by the system
+    /// allocator by all free lists since the program started.
+    size_t getSystemAllocCount() {
+        thread::Mutex::Locker lock(mutex_);
+        return (system_alloc_count_);
+    }
+
+private:
+
+    /// @brief Constructor.
+    BlockFreeListStats()
+        : system_alloc_count_(0) {
+    }
+
+    /// @brief Mutex protecting the counter.
+    thread::Mutex mutex_;
+
+    /// @brief Number of blocks allocated by the system allocator.
+    size_t system_alloc_count_;
+};
+
+/// @brief Free list of memory blocks of the same size.
+///
+/// The blocks released to the free list are handed out by the subsequent
+/// allocations instead of being returned to the system. This is useful
+/// for the objects which are created and destroyed at a high rate, e.g.
+/// the packets processed by the server, because in the steady state they
+/// are allocated without calling the system allocator.
+///
+/// The number of blocks held in the free list is limited. The blocks
+/// released above this limit are returned to the system.
+///
+/// There is one free list per block size, shared by all types of this
+/// size. The free list is thread safe. The objects may be released by
+/// other threads than the ones which allocated them, e.g. when the last
+/// reference to a packet is dropped by the thread fetching a lease.
+///
+/// @tparam BlockSize Size of the memory blocks in bytes.
+template<size_t BlockSize>
+class BlockFreeList : public boost::noncopyable {
+public:
+
+    /// @brief Returns the free list for the block size.
+    ///
+    /// The free list is never destroyed, so as the objects released
+    /// during the program termination can still be returned to it.
+    static BlockFreeList& instance() {
+        static BlockFreeList* list = new BlockFreeList();
+        return (*list);
+    }
+
+    /// @brief Allocates a block.
+    ///
+    /// @return Pointer to the block taken from the free list or allocated
+    /// by the system allocator when the free list is empty.
+    /// @throw std::bad_alloc if the system allocation fails.
+    void* allocate() {
+        {
+            thread::Mutex::Locker lock(mutex_);
+            if (head_) {
+                Node* node = head_;
+                head_ = node->next_;
+                --free_count_;
+                return (node);
+            }
+            ++system_alloc_count_;
+        }
+        BlockFreeListStats::instance().countSystemAlloc();
+        return (::operator new(sizeof(Node)));
+    }
+
+    /// @brief Releases a block to the free list.
+    ///
+    /// @param block Pointer to the block returned by @c allocate.
+    void deallocate(void* block) {
+        if (!block) {
+            return;
+        }
+        {
+            thread::Mutex::Locker lock(mutex_);
+            if (free_count_ < max_free_count_) {
+                Node* node = static_cast<Node*>(block);
+                node->next_ = head_;
+                head_ = node;
+                ++free_count_;
+                return;
+            }
+        }
+        ::operator delete(block);
+    }
+
+    /// @brief Returns the number of blocks in the free list.
+    size_t getFreeCount() {
+        thread::Mutex::Locker lock(mutex_);
+        return (free_count_);
+    }
+
+    /// @brief Returns the number of blocks allocated by the system
+    /// allocator since the program started.
+    size_t getSystemAllocCount() {
+        thread::Mutex::Locker lock(mutex_);
+        return (system_alloc_count_);
+    }
+
+    /// @brief Sets the maximum number of blocks in the free list.
+    ///
+    /// @param max_free_count Maximum number of blocks. Blocks above this
+    /// number are returned to the system immediately.
+    void setMaxFreeCount(const size_t max_free_count) {
+        thread::Mutex::Locker lock(mutex_);
+        max_free_count_ = max_free_count;
+        while (free_count_ > max_free_count_) {
+            Node* node = head_;
+            head_ = node->next_;
+            --free_count_;
+            ::operator delete(node);
+        }
+    }
+
+private:
+
+    /// @brief Constructor.
+    BlockFreeList()
+        : head_(0), free_count_(0), max_free_count_(1024),
+          system_alloc_count_(0) {
+    }
+
+    /// @brief Block in the free list.
+    ///
+    /// The link to the next free block is stored in the block itself.
+    union Node {
+        /// @brief Next block in the free list.
+        Node* next_;
+        /// @brief Storage for the allocated object.
+        char data_[BlockSize];
+    };
+
+    /// @brief Mutex protecting the free list.
+    thread::Mutex mutex_;
+
+    /// @brief First block in the free list.
+    Node* head_;
+
+    /// @brief Number of blocks in the free list.
+    size_t free_count_;
+
+    /// @brief Maximum number of blocks in the free list.
+    size_t max_free_count_;
+
+    /// @brief Number of blocks allocated by the system allocator.
+    size_t system_alloc_count_;
+};
+
+/// @brief Allocator recycling the memory of the released objects.
+///
+/// This allocator is meant to be used with the @c boost::allocate_shared
+/// to create the objects held by the shared pointers, e.g.:
+///
+/// @code
+/// Pkt4Ptr pkt = boost::allocate_shared<Pkt4>(PoolAllocator<Pkt4>(),
+///                                            DHCPOFFER, transid);
+/// @endcode
+///
+/// The object and the reference counter of the shared pointer are then
+/// placed in a single block taken from the @ref BlockFreeList. Allocations
+/// of multiple objects at once are passed to the system allocator.
+///
+/// @tparam T Type of the allocated objects.
+template<typename T>
+class PoolAllocator {
+public:
+
+    /// @name Types required by the standard allocator interface.
+    //@{
+    typedef T value_type;
+    typedef T* pointer;
+    typedef const T* const_pointer;
+    typedef T& reference;
+    typedef const T& const_reference;
+    typedef size_t size_type;
+    typedef ptrdiff_t difference_type;
+
+    template<typename U>
+    struct rebind {
+        typedef PoolAllocator<U> other;
+    };
+    //@}
+
+    /// @brief Constructor.
+    PoolAllocator() {
+    }
+
+    /// @brief Converting constructor.
+    template<typename U>
+    PoolAllocator(const PoolAllocator<U>&) {
+    }
+
+    /// @brief Allocates memory for the objects.
+    ///
+    /// @param n Number of objects.
+    ///
+    /// @return Pointer to the allocated memory.
+    /// @throw std::bad_alloc if the allocation fails.
+    pointer allocate(const size_type n, const void* = 0) {
+        if (n != 1) {
+            return (static_cast<pointer>(::operator new(n * sizeof(T))));
+        }
+        return (static_cast<pointer>(BlockFreeList<sizeof(T)>::instance().
+                                     allocate()));
+    }
+
+    /// @brief Releases memory of the objects.
+    ///
+    /// @param p Pointer returned by @c allocate.
+    /// @param n Number of objects.
+    void deallocate(const pointer p, const size_type n) {
+        if (n != 1) {
+            ::operator delete(p);
+            return;
+        }
+        BlockFreeList<sizeof(T)>::instance().deallocate(p);
+    }
+
+    /// @brief Constructs the object in the allocated memory.
+    void construct(const pointer p, const T& value) {
+        new(static_cast<void*>(p)) T(value);
+    }
+
+    /// @brief Destroys the object.
+    void destroy(const pointer p) {
+        p->~T();
+    }
+
+    /// @brief Returns the maximum number of objects which can be allocated.
+    size_type max_size() const {
+        return (static_cast<size_type>(-1) / sizeof(T));
+    }
+};
+
+/// @brief All pool allocators are interchangeable.
+template<typename T, typename U>
+bool operator==(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+    return (true);
+}
+
+/// @brief All pool allocators are interchangeable.
+template<typename T, typename U>
+bool operator!=(const PoolAllocator<T>&, const PoolAllocator<U>&) {
+    return (false);
+}
+
+/// @brief Granularity of the block sizes used by @ref PoolAllocated.
+const size_t POOL_SIZE_GRANULARITY = 16;
+
+/// @brief Size of the largest object allocated by @ref PoolAllocated
+/// from the free lists.
+const size_t POOL_MAX_OBJECT_SIZE = 512;
+
+namespace detail {
+
+/// @brief Selects the free list for the size class at run time.
+///
+/// The size class N holds the blocks of N * @c POOL_SIZE_GRANULARITY
+/// bytes.
+///
+/// @tparam SizeClass Largest size class handled by this instance.
+template<size_t SizeClass>
+struct SizeClassFreeLists {
+
+    /// @brief Allocates a block of the size class.
+    ///
+    /// @param size_class Size class between 1 and @c SizeClass.
+    static void* allocate(const size_t size_class) {
+        if (size_class == SizeClass) {
+            return (BlockFreeList<SizeClass * POOL_SIZE_GRANULARITY>::
+                    instance().allocate());
+        }
+        return (SizeClassFreeLists<SizeClass - 1>::allocate(size_class));
+    }
+
+    /// @brief Releases a block of the size class.
+    ///
+    /// @param block Pointer to the block.
+    /// @param size_class Size class between 1 and @c SizeClass.
+    static void deallocate(void* block, const size_t size_class) {
+        if (size_class == SizeClass) {
+            BlockFreeList<SizeClass * POOL_SIZE_GRANULARITY>::
+                instance().deallocate(block);
+            return;
+        }
+        SizeClassFreeLists<SizeClass - 1>::deallocate(block, size_class);
+    }
+};
+
+/// @brief Terminates the size class recursion.
+template<>
+struct SizeClassFreeLists<0> {
+    static void* allocate(const size_t) {
+        return (0);
+    }
+    static void deallocate(void*, const size_t) {
+    }
+};
+
+} // namespace isc::util::detail
+
+/// @brief Base class of the objects allocated from the free lists.
+///
+/// The classes deriving from this class are allocated with the plain
+/// @c new from the @ref BlockFreeList of the object size rounded up to
+/// the multiple of @ref POOL_SIZE_GRANULARITY. This covers the objects
+/// which are created by many factories with @c new and held by the
+/// shared pointers, e.g. the options. For the polymorphic classes the
+/// size of the most derived class is used, so all derived classes are
+/// covered. The objects larger than @ref POOL_MAX_OBJECT_SIZE use the
+/// system allocator.
+class PoolAllocated {
+public:
+
+    /// @brief Allocates memory for the object.
+    ///
+    /// @param size Size of the object.
+    /// @throw std::bad_alloc if the allocation fails.
+    static void* operator new(size_t size) {
+        if ((size == 0) || (size > POOL_MAX_OBJECT_SIZE)) {
+            return (::operator new(size));
+        }
+        return (detail::SizeClassFreeLists<POOL_MAX_OBJECT_SIZE /
+                POOL_SIZE_GRANULARITY>::allocate(sizeClass(size)));
+    }
+
+    /// @brief Releases memory of the object.
+    ///
+    /// @param block Pointer to the object memory.
+    /// @param size Size of the object.
+    static void operator delete(void* block, size_t size) {
+        if ((size == 0) || (size > POOL_MAX_OBJECT_SIZE)) {
+            ::operator delete(block);
+            return;
+        }
+        detail::SizeClassFreeLists<POOL_MAX_OBJECT_SIZE /
+            POOL_SIZE_GRANULARITY>::deallocate(block, sizeClass(size));
+    }
+
+private:
+
+    /// @brief Returns the size class of the object size.
+    static size_t sizeClass(const size_t size) {
+        return ((size + POOL_SIZE_GRANULARITY - 1) / POOL_SIZE_GRANULARITY);
+    }
+};
+
+} // namespace isc::util
+} // namespace isc
+
+#endif // POOL_ALLOCATOR_H
@@ -350,6 +350,41 @@ TEST_F(CSVFileTest, openReadAllWrite) {
               readFile());
 }
 
+// This test checks that multiple rows can be appended to the file
+// with a single call.
+TEST_F(CSVFileTest, appendMultipleRows) {
+    writeFile("animal,age,color\n"
+              "cat,10,white\n");
+
+    boost::scoped_ptr<CSVFile> csv(new CSVFile(testfile_));
+    ASSERT_NO_THROW(csv->open(true));
+
+    std::vector<CSVRow> rows(2, CSVRow(3));
+    rows[0].writeAt(0, "dog");
+    rows[0].writeAt(1, 2);
+    rows[0].writeAt(2, "blue");
+    rows[1].writeAt(0, "bird");
+    rows[1].writeAt(1, 3);
+    rows[1].writeAt(2, "purple");
+    ASSERT_NO_THROW(csv->append(rows));
+
+    // Appending an empty collection is a no-op.
+    ASSERT_NO_THROW(csv->append(std::vector<CSVRow>()));
+
+    // None of the rows is written if any of them has invalid size.
+    rows.push_back(CSVRow(2));
+    EXPECT_THROW(csv->append(rows), CSVFileError);
+
+    // The file is flushed by the append, so its contents can be checked
+    // before closing it.
+    EXPECT_EQ("animal,age,color\n"
+              "cat,10,white\n"
+              "dog,2,blue\n"
+              "bird,3,purple\n",
+              readFile());
+    csv->close();
+}
+
 // This test checks that contents may be appended to a file which hasn't
 // been fully parsed/read.
 TEST_F(CSVFileTest, openReadPartialWrite) {
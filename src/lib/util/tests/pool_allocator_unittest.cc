@@ -0,0 +1,164 @@
+// Copyright (C) 2016 Internet Systems Consortium, Inc. ("ISC")
+//
+// This Source Code Form is subject to the terms of the Mozilla Public
+// License, v. 2.0. If a copy of the MPL was not distributed with this
+// file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+#include <config.h>
+#include <util/pool_allocator.h>
+#include <util/threads/thread.h>
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/shared_ptr.hpp>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+
+using namespace isc::util;
+
+/// @brief Object of the size not used by the other tests, so as it
+/// gets its own free list.
+struct TestObject {
+    /// @brief Constructor.
+    ///
+    /// @param value Value of the first byte.
+    TestObject(const char value) {
+        data_[0] = value;
+    }
+
+    /// @brief Object data.
+    char data_[1237];
+};
+
+/// @brief Object allocated from the free lists with the plain new.
+struct PooledObject : public PoolAllocated {
+    /// @brief Destructor.
+    virtual ~PooledObject() {
+    }
+
+    /// @brief Object data.
+    char data_[200];
+};
+
+/// @brief Object derived from the @c PooledObject.
+struct DerivedPooledObject : public PooledObject {
+    /// @brief Additional data.
+    char more_data_[100];
+};
+
+/// @brief Allocates and releases blocks of the free list.
+///
+/// @param list Free list.
+void allocateBlocks(BlockFreeList<1235>* list) {
+    for (int i = 0; i < 10000; ++i) {
+        list->deallocate(list->allocate());
+    }
+}
+
+// This test verifies that the released blocks are reused.
+TEST(BlockFreeListTest, reuse) {
+    BlockFreeList<1231>& list = BlockFreeList<1231>::instance();
+    ASSERT_EQ(0, list.getFreeCount());
+
+    void* block = list.allocate();
+    ASSERT_TRUE(block);
+    EXPECT_EQ(1, list.getSystemAllocCount());
+    list.deallocate(block);
+    EXPECT_EQ(1, list.getFreeCount());
+
+    // The released block is returned without calling the system allocator.
+    EXPECT_EQ(block, list.allocate());
+    EXPECT_EQ(0, list.getFreeCount());
+    EXPECT_EQ(1, list.getSystemAllocCount());
+    list.deallocate(block);
+}
+
+// This test verifies that the number of free blocks is limited.
+TEST(BlockFreeListTest, maxFreeCount) {
+    BlockFreeList<1233>& list = BlockFreeList<1233>::instance();
+    std::vector<void*> blocks;
+    for (int i = 0; i < 5; ++i) {
+        blocks.push_back(list.allocate());
+    }
+    list.setMaxFreeCount(3);
+    for (int i = 0; i < 5; ++i) {
+        list.deallocate(blocks[i]);
+    }
+    EXPECT_EQ(3, list.getFreeCount());
+
+    list.setMaxFreeCount(1);
+    EXPECT_EQ(1, list.getFreeCount());
+}
+
+// This test verifies that the free list can be used by multiple threads.
+TEST(BlockFreeListTest, threads) {
+    BlockFreeList<1235>& list = BlockFreeList<1235>::instance();
+    isc::util::thread::Thread thread1(boost::bind(allocateBlocks, &list));
+    isc::util::thread::Thread thread2(boost::bind(allocateBlocks, &list));
+    thread1.wait();
+    thread2.wait();
+
+    // Each thread holds at most one block at a time, so at most two
+    // blocks have been allocated by the system and all have been
+    // released to the free list.
+    EXPECT_GE(2, list.getSystemAllocCount());
+    EXPECT_EQ(list.getSystemAllocCount(), list.getFreeCount());
+}
+
+// This test verifies that the objects created with the pool allocator
+// reuse the memory of the released objects.
+TEST(PoolAllocatorTest, allocateShared) {
+    boost::shared_ptr<TestObject> obj =
+        boost::allocate_shared<TestObject>(PoolAllocator<TestObject>(), 'a');
+    ASSERT_TRUE(obj);
+    EXPECT_EQ('a', obj->data_[0]);
+    TestObject* address = obj.get();
+
+    // Repeated creation and destruction of the objects doesn't allocate
+    // new memory.
+    obj.reset();
+    for (int i = 0; i < 10; ++i) {
+        obj = boost::allocate_shared<TestObject>(PoolAllocator<TestObject>(),
+                                                 'b');
+        EXPECT_EQ(address, obj.get());
+        EXPECT_EQ('b', obj->data_[0]);
+        obj.reset();
+    }
+}
+
+// This test verifies that the allocator can be used with the containers.
+TEST(PoolAllocatorTest, container) {
+    std::vector<int, PoolAllocator<int> > values;
+    for (int i = 0; i < 100; ++i) {
+        values.push_back(i);
+    }
+    ASSERT_EQ(100, values.size());
+    EXPECT_EQ(99, values.back());
+}
+
+// This test verifies that the objects derived from PoolAllocated reuse
+// the memory of the released objects of the same size, including the
+// objects of the derived classes.
+TEST(PoolAllocatedTest, reuse) {
+    PooledObject* obj = new DerivedPooledObject();
+    void* derived_address = obj;
+    delete obj;
+    obj = new PooledObject();
+    void* address = obj;
+    delete obj;
+
+    BlockFreeListStats& stats = BlockFreeListStats::instance();
+    size_t system_alloc_count = stats.getSystemAllocCount();
+    for (int i = 0; i < 10; ++i) {
+        obj = new DerivedPooledObject();
+        EXPECT_EQ(derived_address, obj);
+        delete obj;
+        obj = new PooledObject();
+        EXPECT_EQ(address, obj);
+        delete obj;
+    }
+    EXPECT_EQ(system_alloc_count, stats.getSystemAllocCount());
+}
+
+}